@@ -0,0 +1,163 @@
+// AnalyticsArchiver
+//
+// moves the keys of finished sessions out of redis into FastLZ block files, see SessionArchiver
+//
+//	AnalyticsArchiver [options]
+//
+//	--host <host> --port <port>		the redis server, 127.0.0.1:6379 by default
+//	--out <directory>				where the <session>.gas files go, the working directory by default
+//	--session <name>				archive this session whether or not it ended, can repeat
+//	--idle <seconds>				also archive sessions whose catalog entry hasn't updated for this long
+//	--expire <seconds>				let the keys expire this long after archiving instead of deleting them
+//	--keep							write the archives and leave redis as it is
+//	--list							lists the sessions that would be archived and exits
+//	--dump <file.gas>				lists the keys of an archive and exits
+//
+// without --session the ended sessions of the catalog are archived, for example from a scheduled task
+//
+//	AnalyticsArchiver --out D:\archives --idle 3600
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+
+#include "GameAnalytics_archive.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+static const char* KeyTypeName(ArchiveKeyType type)
+{
+	switch (type)
+	{
+	case ArchiveKey_String: return "string";
+	case ArchiveKey_List: return "list";
+	case ArchiveKey_Hash: return "hash";
+	case ArchiveKey_Set: return "set";
+	case ArchiveKey_SortedSet: return "zset";
+	}
+	return "";
+}
+
+static void Usage()
+{
+	std::cerr << "usage: AnalyticsArchiver [--host host] [--port port] [--out directory] [--session name]... [--idle seconds]" << std::endl;
+	std::cerr << "                         [--expire seconds] [--keep] [--list] [--dump file.gas]" << std::endl;
+}
+
+static int Dump(const std::string& filename)
+{
+	std::string error;
+
+	SessionArchiveReader reader;
+	if (!reader.Open(filename, error) || !reader.Verify(error))
+	{
+		std::cerr << error << std::endl;
+		return 1;
+	}
+
+	std::cout << reader.GetSession() << ", " << reader.GetKeys().size() << " keys" << std::endl;
+	for (size_t k = 0; k < reader.GetKeys().size(); ++k)
+	{
+		const ArchivedKey& key = reader.GetKeys()[k];
+		std::cout << "\t" << key.mName << "\t" << KeyTypeName(key.mType) << "\t" << key.mNumValues << std::endl;
+	}
+	return 0;
+}
+
+int main(int argc, char* argv[])
+{
+	std::string host = "127.0.0.1";
+	int port = 6379;
+	std::string directory = ".";
+	std::vector<std::string> sessions;
+	int64_t idleTime = 0;
+	int expireSeconds = 0;
+	bool keepKeys = false;
+	bool listOnly = false;
+	std::string error;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+
+		if (arg == "--host" && hasValue)
+			host = argv[++i];
+		else if (arg == "--port" && hasValue)
+			port = atoi(argv[++i]);
+		else if (arg == "--out" && hasValue)
+			directory = argv[++i];
+		else if (arg == "--session" && hasValue)
+			sessions.push_back(argv[++i]);
+		else if (arg == "--idle" && hasValue)
+			idleTime = atoll(argv[++i]) * 1000;
+		else if (arg == "--expire" && hasValue)
+			expireSeconds = atoi(argv[++i]);
+		else if (arg == "--keep")
+			keepKeys = true;
+		else if (arg == "--list")
+			listOnly = true;
+		else if (arg == "--dump" && hasValue)
+			return Dump(argv[++i]);
+		else
+		{
+			Usage();
+			return 1;
+		}
+	}
+
+	SessionArchiver archiver(host, port);
+	archiver.SetExpire(expireSeconds);
+	archiver.SetKeepKeys(keepKeys);
+
+	if (!archiver.Connect(error))
+	{
+		std::cerr << "can't connect to " << host << ":" << port << ": " << error << std::endl;
+		return 1;
+	}
+
+	if (sessions.empty() && !archiver.FindEndedSessions(idleTime, sessions, error))
+	{
+		std::cerr << error << std::endl;
+		return 1;
+	}
+
+	if (listOnly)
+	{
+		for (size_t s = 0; s < sessions.size(); ++s)
+			std::cout << sessions[s] << std::endl;
+		return 0;
+	}
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	// a failed session is left in redis and the rest still go
+	size_t archived = 0;
+	uint64_t rawSize = 0, fileSize = 0;
+	for (size_t s = 0; s < sessions.size(); ++s)
+	{
+		SessionArchiveStats stats;
+		const std::string filename = SessionArchiveFilename(directory, sessions[s]);
+		if (!archiver.ArchiveSession(sessions[s], filename, stats, error))
+		{
+			std::cerr << sessions[s] << ": " << error << std::endl;
+			continue;
+		}
+
+		fprintf(stdout, "%s\t%zu keys\t%llu values\t%llu -> %llu bytes\n", filename.c_str(), stats.mNumKeys,
+			(unsigned long long)stats.mNumValues, (unsigned long long)stats.mRawSize, (unsigned long long)stats.mFileSize);
+
+		++archived;
+		rawSize += stats.mRawSize;
+		fileSize += stats.mFileSize;
+	}
+
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	fprintf(stderr, "%zu of %zu sessions archived, %llu -> %llu bytes, %.3f s\n",
+		archived, sessions.size(), (unsigned long long)rawSize, (unsigned long long)fileSize, seconds);
+	return archived == sessions.size() ? 0 : 1;
+}
@@ -0,0 +1,511 @@
+// protoc-gen-analytics
+//
+// protoc plugin that emits reflection free encoders for the event messages, run alongside --cpp_out
+//
+//	protoc --plugin=protoc-gen-analytics=<path to this exe> --cpp_out=. --analytics_out=. analytics.proto
+//
+// for every <name>.proto this writes <name>.ga.h/.ga.cc with a direct json writer, the redis key suffix and
+// hash key formatters and the routing traits of each message, collected into a table indexed by message
+// index that FindEventEncoder looks up. see GameAnalytics_codegen.h for the runtime side.
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <cstdio>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/descriptor.pb.h"
+#include "google/protobuf/compiler/plugin.pb.h"
+
+// linked in for the message and field option extensions
+#include "analytics.pb.h"
+
+using google::protobuf::Descriptor;
+using google::protobuf::EnumDescriptor;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::FileDescriptor;
+using google::protobuf::compiler::CodeGeneratorRequest;
+using google::protobuf::compiler::CodeGeneratorResponse;
+
+//////////////////////////////////////////////////////////////////////////
+
+static std::string StripProto(const std::string& filename)
+{
+	const std::string ext = ".proto";
+	if (filename.size() > ext.size() && filename.compare(filename.size() - ext.size(), ext.size(), ext) == 0)
+		return filename.substr(0, filename.size() - ext.size());
+	return filename;
+}
+
+static std::string Replace(std::string str, const std::string& from, const std::string& to)
+{
+	for (size_t pos = str.find(from); pos != std::string::npos; pos = str.find(from, pos + to.size()))
+		str.replace(pos, from.size(), to);
+	return str;
+}
+
+static std::string Namespace(const FileDescriptor* file)
+{
+	return file->package().empty() ? "" : "::" + Replace(file->package(), ".", "::");
+}
+
+// nested types are flattened with underscores, the same as the cpp generator
+static std::string ClassName(const std::string& fullName, const FileDescriptor* file)
+{
+	const std::string name = file->package().empty() ? fullName : fullName.substr(file->package().size() + 1);
+	return Namespace(file) + "::" + Replace(name, ".", "_");
+}
+
+static std::string ClassName(const Descriptor* desc)
+{
+	return ClassName(desc->full_name(), desc->file());
+}
+
+static std::string ClassName(const EnumDescriptor* desc)
+{
+	return ClassName(desc->full_name(), desc->file());
+}
+
+// a unique identifier for the generated functions of a message
+static std::string FunctionSuffix(const Descriptor* desc)
+{
+	return Replace(desc->full_name(), ".", "_");
+}
+
+static std::string FieldName(const FieldDescriptor* fdesc)
+{
+	static const char* keywords[] =
+	{
+		"and", "asm", "auto", "bool", "break", "case", "catch", "char", "class", "const", "continue",
+		"default", "delete", "do", "double", "else", "enum", "explicit", "extern", "false", "float",
+		"for", "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "not",
+		"operator", "or", "private", "protected", "public", "register", "return", "short", "signed",
+		"sizeof", "static", "struct", "switch", "template", "this", "throw", "true", "try", "typedef",
+		"typeid", "typename", "union", "unsigned", "using", "virtual", "void", "volatile", "while", "xor",
+	};
+
+	const std::string name = fdesc->lowercase_name();
+	for (size_t i = 0; i < sizeof(keywords) / sizeof(keywords[0]); ++i)
+	{
+		if (name == keywords[i])
+			return name + "_";
+	}
+	return name;
+}
+
+static std::string CString(const std::string& str)
+{
+	return "\"" + Replace(Replace(str, "\\", "\\\\"), "\"", "\\\"") + "\"";
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// messages that only reference message types of the same file, without maps or groups. well known types
+// have their own json mapping, so anything outside the file goes through the reflection path
+static bool CanEncodeJson(const Descriptor* desc)
+{
+	for (int i = 0; i < desc->field_count(); ++i)
+	{
+		const FieldDescriptor* fdesc = desc->field(i);
+		if (fdesc->is_map() || fdesc->type() == FieldDescriptor::TYPE_GROUP)
+			return false;
+		if (fdesc->type() == FieldDescriptor::TYPE_MESSAGE && fdesc->message_type()->file() != desc->file())
+			return false;
+	}
+	return true;
+}
+
+// the json encoded messages and everything they reference, empty if any of them can't be encoded directly
+static bool CollectJsonMessages(const Descriptor* desc, std::set<const Descriptor*>& messages)
+{
+	if (!messages.insert(desc).second)
+		return true;
+
+	if (!CanEncodeJson(desc))
+		return false;
+
+	for (int i = 0; i < desc->field_count(); ++i)
+	{
+		const FieldDescriptor* fdesc = desc->field(i);
+		if (fdesc->type() == FieldDescriptor::TYPE_MESSAGE && !CollectJsonMessages(fdesc->message_type(), messages))
+			return false;
+	}
+	return true;
+}
+
+static void CollectMessages(const Descriptor* desc, std::vector<const Descriptor*>& messages)
+{
+	messages.push_back(desc);
+	for (int i = 0; i < desc->nested_type_count(); ++i)
+		CollectMessages(desc->nested_type(i), messages);
+}
+
+static std::string HasCondition(const FieldDescriptor* fdesc)
+{
+	const std::string value = "msg." + FieldName(fdesc) + "()";
+
+	if (fdesc->has_presence())
+		return "msg.has_" + FieldName(fdesc) + "()";
+
+	switch (fdesc->cpp_type())
+	{
+	case FieldDescriptor::CPPTYPE_STRING:
+		return "!" + value + ".empty()";
+	case FieldDescriptor::CPPTYPE_BOOL:
+		return value;
+	default:
+		return value + " != 0";
+	}
+}
+
+static std::string JsonValue(const FieldDescriptor* fdesc, const std::string& value)
+{
+	switch (fdesc->cpp_type())
+	{
+	case FieldDescriptor::CPPTYPE_INT32:
+		return "JsonAppendInt(out, " + value + ");";
+	case FieldDescriptor::CPPTYPE_UINT32:
+		return "JsonAppendUInt(out, " + value + ");";
+	case FieldDescriptor::CPPTYPE_INT64:
+		return "JsonAppendInt64(out, " + value + ");";
+	case FieldDescriptor::CPPTYPE_UINT64:
+		return "JsonAppendUInt64(out, " + value + ");";
+	case FieldDescriptor::CPPTYPE_FLOAT:
+		return "JsonAppendFloat(out, " + value + ");";
+	case FieldDescriptor::CPPTYPE_DOUBLE:
+		return "JsonAppendDouble(out, " + value + ");";
+	case FieldDescriptor::CPPTYPE_BOOL:
+		return "out += " + value + " ? \"true\" : \"false\";";
+	case FieldDescriptor::CPPTYPE_STRING:
+		if (fdesc->type() == FieldDescriptor::TYPE_BYTES)
+			return "JsonAppendBytes(out, " + value + ");";
+		return "JsonAppendString(out, " + value + ");";
+	case FieldDescriptor::CPPTYPE_ENUM:
+		return "JsonAppendEnum(out, " + ClassName(fdesc->enum_type()) + "_Name(" + value + "), (int)" + value + ");";
+	case FieldDescriptor::CPPTYPE_MESSAGE:
+		return "AppendJson(" + value + ", out);";
+	}
+	return "";
+}
+
+static void WriteJsonWriter(std::ostream& out, const Descriptor* desc)
+{
+	out << "void AppendJson(const " << ClassName(desc) << "& msg, std::string& out)\n";
+	out << "{\n";
+	out << "\tbool first = true;\n";
+	out << "\tout += '{';\n";
+	out << "\n";
+
+	for (int i = 0; i < desc->field_count(); ++i)
+	{
+		const FieldDescriptor* fdesc = desc->field(i);
+		const std::string name = FieldName(fdesc);
+		const std::string key = CString("\"" + fdesc->json_name() + "\":");
+
+		if (fdesc->is_repeated())
+		{
+			out << "\tif (msg." << name << "_size() > 0)\n";
+			out << "\t{\n";
+			out << "\t\tJsonBeginField(out, first, " << key << ");\n";
+			out << "\t\tout += '[';\n";
+			out << "\t\tfor (int i = 0; i < msg." << name << "_size(); ++i)\n";
+			out << "\t\t{\n";
+			out << "\t\t\tif (i > 0)\n";
+			out << "\t\t\t\tout += ',';\n";
+			out << "\t\t\t" << JsonValue(fdesc, "msg." + name + "(i)") << "\n";
+			out << "\t\t}\n";
+			out << "\t\tout += ']';\n";
+			out << "\t}\n";
+		}
+		else
+		{
+			out << "\tif (" << HasCondition(fdesc) << ")\n";
+			out << "\t{\n";
+			out << "\t\tJsonBeginField(out, first, " << key << ");\n";
+			out << "\t\t" << JsonValue(fdesc, "msg." + name + "()") << "\n";
+			out << "\t}\n";
+		}
+	}
+
+	out << "\n";
+	out << "\tout += '}';\n";
+	out << "}\n\n";
+}
+
+// mirrors StringFromField, false for the field types it can't format
+static bool WriteKeyFormat(std::ostream& out, const FieldDescriptor* fdesc, const std::string& var, const std::string& literal)
+{
+	if (fdesc == NULL || fdesc->is_repeated())
+		return false;
+
+	const std::string value = "msg." + FieldName(fdesc) + "()";
+	switch (fdesc->cpp_type())
+	{
+	case FieldDescriptor::CPPTYPE_INT32:
+	case FieldDescriptor::CPPTYPE_INT64:
+		out << "\tKeyFormatInt(" << var << ", " << value << ");\n";
+		return true;
+	case FieldDescriptor::CPPTYPE_UINT32:
+	case FieldDescriptor::CPPTYPE_UINT64:
+		out << "\tKeyFormatUInt(" << var << ", " << value << ");\n";
+		return true;
+	case FieldDescriptor::CPPTYPE_FLOAT:
+	case FieldDescriptor::CPPTYPE_DOUBLE:
+		out << "\tKeyFormatFloat(" << var << ", " << value << ");\n";
+		return true;
+	case FieldDescriptor::CPPTYPE_BOOL:
+		out << "\t" << var << " = " << value << " ? \"1\" : \"0\";\n";
+		return true;
+	case FieldDescriptor::CPPTYPE_STRING:
+		if (fdesc->type() == FieldDescriptor::TYPE_BYTES)
+			return false;
+		out << "\t" << var << " = " << value << ";\n";
+		return true;
+	case FieldDescriptor::CPPTYPE_ENUM:
+		out << "\t" << var << " = " << ClassName(fdesc->enum_type()) << "_Name(" << value << ");\n";
+		out << "\tif (" << var << ".empty())\n";
+		out << "\t\t" << var << " = " << CString(literal) << ";\n";
+		return true;
+	default:
+		return false;
+	}
+}
+
+static void WriteKeyFunction(std::ostream& out, const Descriptor* desc, const std::string& function, const std::string& option)
+{
+	out << "bool " << function << "_" << FunctionSuffix(desc) << "(const ::google::protobuf::Message& base, std::string& key)\n";
+	out << "{\n";
+
+	std::ostringstream body;
+	if (WriteKeyFormat(body, desc->FindFieldByCamelcaseName(option), "key", option))
+	{
+		out << "\tconst " << ClassName(desc) << "& msg = static_cast<const " << ClassName(desc) << "&>(base);\n";
+		out << body.str();
+	}
+	else
+	{
+		out << "\tkey = " << CString(option) << ";\n";
+	}
+	out << "\treturn true;\n";
+	out << "}\n\n";
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+static void GenerateFile(const FileDescriptor* file, CodeGeneratorResponse& response)
+{
+	const std::string baseName = StripProto(file->name());
+	const std::string guard = "PROTOC_GEN_ANALYTICS_" + Replace(Replace(Replace(baseName, "/", "_2f"), ".", "_2e"), "-", "_2d") + "_2eproto";
+
+	std::vector<const Descriptor*> messages;
+	for (int i = 0; i < file->message_type_count(); ++i)
+		CollectMessages(file->message_type(i), messages);
+
+	std::set<const Descriptor*> jsonEncodable;
+	for (int i = 0; i < file->message_type_count(); ++i)
+	{
+		const Descriptor* desc = file->message_type(i);
+		if (!desc->options().GetExtension(Analytics::useJsonEncoding))
+			continue;
+
+		std::set<const Descriptor*> referenced;
+		if (CollectJsonMessages(desc, referenced))
+			jsonEncodable.insert(referenced.begin(), referenced.end());
+	}
+
+	// header
+	{
+		std::ostringstream out;
+		out << "// Generated by protoc-gen-analytics.  DO NOT EDIT!\n";
+		out << "// source: " << file->name() << "\n\n";
+		out << "#ifndef " << guard << "\n";
+		out << "#define " << guard << "\n\n";
+		out << "#include <string>\n\n";
+		out << "#include \"" << baseName << ".pb.h\"\n";
+		out << "#include \"GameAnalytics_codegen.h\"\n\n";
+
+		const std::string ns = file->package().empty() ? "" : Replace(file->package(), ".", " { namespace ");
+		if (!ns.empty())
+			out << "namespace " << ns << " {\n\n";
+
+		out << "// the encoder of a message type declared in " << file->name() << ", NULL for any other type\n";
+		out << "const ::EventEncoder* FindEventEncoder(const ::google::protobuf::Descriptor* desc);\n\n";
+
+		for (size_t i = 0; i < messages.size(); ++i)
+		{
+			if (jsonEncodable.count(messages[i]))
+				out << "void AppendJson(const " << ClassName(messages[i]) << "& msg, std::string& out);\n";
+		}
+
+		if (!ns.empty())
+		{
+			out << "\n";
+			for (int i = 0, n = (int)std::count(file->package().begin(), file->package().end(), '.'); i <= n; ++i)
+				out << "}";
+			out << "\n";
+		}
+
+		out << "\n#endif\n";
+
+		CodeGeneratorResponse::File* f = response.add_file();
+		f->set_name(baseName + ".ga.h");
+		f->set_content(out.str());
+	}
+
+	// source
+	{
+		std::ostringstream out;
+		out << "// Generated by protoc-gen-analytics.  DO NOT EDIT!\n";
+		out << "// source: " << file->name() << "\n\n";
+		out << "#include \"" << baseName << ".ga.h\"\n\n";
+
+		const std::string ns = file->package().empty() ? "" : Replace(file->package(), ".", " { namespace ");
+		if (!ns.empty())
+			out << "namespace " << ns << " {\n\n";
+
+		for (size_t i = 0; i < messages.size(); ++i)
+		{
+			if (jsonEncodable.count(messages[i]))
+				WriteJsonWriter(out, messages[i]);
+		}
+
+		out << "namespace {\n\n";
+
+		std::ostringstream table;
+		for (int i = 0; i < file->message_type_count(); ++i)
+		{
+			const Descriptor* desc = file->message_type(i);
+			const google::protobuf::MessageOptions& options = desc->options();
+			const std::string suffix = FunctionSuffix(desc);
+			const bool json = options.GetExtension(Analytics::useJsonEncoding);
+
+			std::string encode = "NULL";
+			if (!json || jsonEncodable.count(desc))
+			{
+				encode = "&Encode_" + suffix;
+				out << "void Encode_" << suffix << "(const ::google::protobuf::Message& msg, std::string& payload)\n";
+				out << "{\n";
+				if (json)
+				{
+					out << "\tpayload.clear();\n";
+					out << "\tAppendJson(static_cast<const " << ClassName(desc) << "&>(msg), payload);\n";
+				}
+				else
+				{
+					out << "\tstatic_cast<const " << ClassName(desc) << "&>(msg).SerializeToString(&payload);\n";
+				}
+				out << "}\n\n";
+			}
+
+			std::string keySuffix = "NULL";
+			if (options.HasExtension(Analytics::rediskeysuffix))
+			{
+				keySuffix = "&KeySuffix_" + suffix;
+				WriteKeyFunction(out, desc, "KeySuffix", options.GetExtension(Analytics::rediskeysuffix));
+			}
+
+			std::string hashKey = "NULL";
+			if (options.GetExtension(Analytics::rediskeytype) == Analytics::HMSET)
+			{
+				// the type name when there is no option, like the reflection path
+				hashKey = "&HashKey_" + suffix;
+				WriteKeyFunction(out, desc, "HashKey", options.HasExtension(Analytics::redishmsetkey) ? options.GetExtension(Analytics::redishmsetkey) : desc->full_name());
+			}
+
+			table << "\t{ " << CString(desc->name()) << ", ::Analytics::" << Analytics::RedisKeyType_Name(options.GetExtension(Analytics::rediskeytype))
+				<< ", " << (json ? "true" : "false") << ", " << encode << ", " << keySuffix << ", " << hashKey << " },\n";
+		}
+
+		if (file->message_type_count() > 0)
+		{
+			out << "// indexed by Descriptor::index()\n";
+			out << "const ::EventEncoder kEncoders[] =\n";
+			out << "{\n";
+			out << table.str();
+			out << "};\n\n";
+		}
+
+		out << "}\n\n";
+
+		out << "const ::EventEncoder* FindEventEncoder(const ::google::protobuf::Descriptor* desc)\n";
+		out << "{\n";
+		if (file->message_type_count() > 0)
+		{
+			out << "\tif (desc == NULL || desc->containing_type() != NULL || desc->file() != " << ClassName(file->message_type(0)) << "::descriptor()->file())\n";
+			out << "\t\treturn NULL;\n";
+			out << "\treturn &kEncoders[desc->index()];\n";
+		}
+		else
+		{
+			out << "\treturn NULL;\n";
+		}
+		out << "}\n";
+
+		if (!ns.empty())
+		{
+			out << "\n";
+			for (int i = 0, n = (int)std::count(file->package().begin(), file->package().end(), '.'); i <= n; ++i)
+				out << "}";
+			out << "\n";
+		}
+
+		CodeGeneratorResponse::File* f = response.add_file();
+		f->set_name(baseName + ".ga.cc");
+		f->set_content(out.str());
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+#ifdef _WIN32
+	_setmode(_fileno(stdin), _O_BINARY);
+	_setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+	CodeGeneratorRequest request;
+	if (!request.ParseFromIstream(&std::cin))
+	{
+		std::cerr << "protoc-gen-analytics: failed to parse the CodeGeneratorRequest" << std::endl;
+		return 1;
+	}
+
+	// the request carries every file in dependency order
+	google::protobuf::DescriptorPool pool;
+	for (int i = 0; i < request.proto_file_size(); ++i)
+	{
+		if (pool.BuildFile(request.proto_file(i)) == NULL)
+		{
+			std::cerr << "protoc-gen-analytics: failed to build " << request.proto_file(i).name() << std::endl;
+			return 1;
+		}
+	}
+
+	CodeGeneratorResponse response;
+	for (int i = 0; i < request.file_to_generate_size(); ++i)
+	{
+		const FileDescriptor* file = pool.FindFileByName(request.file_to_generate(i));
+		if (file == NULL)
+		{
+			response.set_error(request.file_to_generate(i) + ": not found");
+			break;
+		}
+		GenerateFile(file, response);
+	}
+
+	if (!response.SerializeToOstream(&std::cout))
+	{
+		std::cerr << "protoc-gen-analytics: failed to write the CodeGeneratorResponse" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,221 @@
+// AnalyticsQuery
+//
+// filters and group-bys over the column archives written by GameAnalytics::ExportColumnArchive
+//
+//	AnalyticsQuery [options] <file.gac>...
+//
+//	--from <ms> --to <ms>			session time range
+//	--where <column>=<value>		a string, an enum name or a number
+//	--where <column>=<a>,<b>,...	any of the values
+//	--where <column>=<min>..<max>	an inclusive range
+//	--exclude <column>=<value>		like --where, keeping the rows that don't match
+//	--group <column>				up to 4 of them
+//	--count --sum <column> --min <column> --max <column> --mean <column>
+//	--enums <enums.txt>				enum names for (enumkey) columns
+//	--threads <n>					0 uses every hardware thread
+//	--index							writes the missing bitmap indexes (.gai) of the files before the query
+//	--columns						lists the columns of the first file and exits
+//
+// for example the damage done with each weapon by the red team
+//
+//	AnalyticsQuery --where attackTeam=RED --group weaponId --sum damageAmount --enums enums.txt GameInflictDamage.gac
+//
+// value filters on (track_event) columns are answered from the index next to an archive when there is one
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+
+#include "GameAnalytics_query.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+static const char* ColumnTypeName(ColumnType type)
+{
+	switch (type)
+	{
+	case ColumnType_Int32: return "int32";
+	case ColumnType_UInt32: return "uint32";
+	case ColumnType_Int64: return "int64";
+	case ColumnType_UInt64: return "uint64";
+	case ColumnType_Float: return "float";
+	case ColumnType_Double: return "double";
+	case ColumnType_String: return "string";
+	}
+	return "";
+}
+
+static bool ParseFilter(const std::string& arg, bool exclude, ColumnQuery& query)
+{
+	const size_t eq = arg.find('=');
+	if (eq == std::string::npos || eq == 0)
+		return false;
+
+	const std::string column = arg.substr(0, eq);
+	const std::string value = arg.substr(eq + 1);
+
+	const size_t range = value.find("..");
+	if (range != std::string::npos)
+	{
+		const std::string lo = value.substr(0, range);
+		const std::string hi = value.substr(range + 2);
+		query.WhereRange(column, lo.empty() ? -HUGE_VAL : atof(lo.c_str()), hi.empty() ? HUGE_VAL : atof(hi.c_str()), exclude);
+	}
+	else if (value.find(',') != std::string::npos)
+	{
+		std::vector<std::string> values;
+		for (size_t start = 0; start <= value.size();)
+		{
+			size_t end = value.find(',', start);
+			if (end == std::string::npos)
+				end = value.size();
+			values.push_back(value.substr(start, end - start));
+			start = end + 1;
+		}
+		query.WhereAny(column, values, exclude);
+	}
+	else
+	{
+		query.WhereValue(column, value, exclude);
+	}
+	return true;
+}
+
+static void Usage()
+{
+	std::cerr << "usage: AnalyticsQuery [--from ms] [--to ms] [--where col=value|col=a,b|col=min..max] [--exclude col=value] [--group col]" << std::endl;
+	std::cerr << "                      [--count] [--sum col] [--min col] [--max col] [--mean col] [--enums file] [--threads n] [--index] [--columns] file.gac..." << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	ColumnQueryEngine engine;
+	ColumnQuery query;
+	bool listColumns = false;
+	bool buildIndexes = false;
+	std::string firstFile;
+	std::string error;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+
+		if (arg == "--from" && hasValue)
+			query.mStartTime = atoll(argv[++i]);
+		else if (arg == "--to" && hasValue)
+			query.mEndTime = atoll(argv[++i]);
+		else if ((arg == "--where" || arg == "--exclude") && hasValue)
+		{
+			if (!ParseFilter(argv[++i], arg == "--exclude", query))
+			{
+				std::cerr << "bad filter " << argv[i] << std::endl;
+				return 1;
+			}
+		}
+		else if (arg == "--group" && hasValue)
+			query.GroupBy(argv[++i]);
+		else if (arg == "--count")
+			query.Measure(ColumnAggregate_Count);
+		else if (arg == "--sum" && hasValue)
+			query.Measure(ColumnAggregate_Sum, argv[++i]);
+		else if (arg == "--min" && hasValue)
+			query.Measure(ColumnAggregate_Min, argv[++i]);
+		else if (arg == "--max" && hasValue)
+			query.Measure(ColumnAggregate_Max, argv[++i]);
+		else if (arg == "--mean" && hasValue)
+			query.Measure(ColumnAggregate_Mean, argv[++i]);
+		else if (arg == "--enums" && hasValue)
+		{
+			if (!engine.GetEnumNames().Load(argv[++i], error))
+			{
+				std::cerr << error << std::endl;
+				return 1;
+			}
+		}
+		else if (arg == "--threads" && hasValue)
+			engine.SetThreadCount(atoi(argv[++i]));
+		else if (arg == "--columns")
+			listColumns = true;
+		else if (arg == "--index")
+			buildIndexes = true;
+		else if (arg.compare(0, 2, "--") == 0)
+		{
+			Usage();
+			return 1;
+		}
+		else if (!engine.AddFile(arg, error))
+		{
+			std::cerr << error << std::endl;
+			return 1;
+		}
+		else if (firstFile.empty())
+			firstFile = arg;
+	}
+
+	if (engine.GetNumFiles() == 0)
+	{
+		Usage();
+		return 1;
+	}
+
+	if (listColumns)
+	{
+		ColumnarReader file;
+		if (!file.Open(firstFile, error))
+		{
+			std::cerr << error << std::endl;
+			return 1;
+		}
+
+		std::cout << file.GetTypeName() << ", " << file.GetNumRows() << " rows in " << file.GetNumBlocks() << " blocks" << std::endl;
+		for (size_t c = 0; c < file.GetNumColumns(); ++c)
+			std::cout << "\t" << file.GetColumn(c).mName << "\t" << ColumnTypeName(file.GetColumn(c).mType) << std::endl;
+		return 0;
+	}
+
+	if (buildIndexes && !engine.BuildIndexes(error))
+	{
+		std::cerr << error << std::endl;
+		return 1;
+	}
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	ColumnQueryResult result;
+	if (!engine.Run(query, result, error))
+	{
+		std::cerr << error << std::endl;
+		return 1;
+	}
+
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	// tab separated with a header line, the row count after the keys
+	for (size_t k = 0; k < result.mKeyNames.size(); ++k)
+		std::cout << result.mKeyNames[k] << "\t";
+	std::cout << "rows";
+	for (size_t v = 0; v < result.mValueNames.size(); ++v)
+		std::cout << "\t" << result.mValueNames[v];
+	std::cout << std::endl;
+
+	for (size_t r = 0; r < result.mRows.size(); ++r)
+	{
+		const ColumnQueryRow& row = result.mRows[r];
+		for (size_t k = 0; k < row.mKeys.size(); ++k)
+			std::cout << row.mKeys[k] << "\t";
+		std::cout << row.mCount;
+		for (size_t v = 0; v < row.mValues.size(); ++v)
+			std::cout << "\t" << row.mValues[v];
+		std::cout << std::endl;
+	}
+
+	fprintf(stderr, "%llu of %llu rows matched, %zu blocks scanned (%zu by index), %zu skipped, %.3f s\n",
+		(unsigned long long)result.mRowsMatched, (unsigned long long)result.mRowsScanned, result.mBlocksScanned, result.mBlocksIndexed, result.mBlocksSkipped, seconds);
+	return 0;
+}
@@ -84,6 +84,32 @@ void AnalyticsScene::processMessage(const Analytics::GameEntityInfo & msg)
 		foundEntity->setProperty("ammo", ammo);
 }
 
+void AnalyticsScene::SetRecordedState(const SessionRecordingState& state)
+{
+	// entities that left before the time go away with the rest, the state has every entity still around
+	const QObjectList sceneChildren = children();
+	for (int i = 0; i < sceneChildren.size(); ++i)
+	{
+		Qt3DCore::QEntity* entity = qobject_cast<Qt3DCore::QEntity*>(sceneChildren[i]);
+		if (entity && entity->property("entityId").isValid())
+		{
+			// deleteLater leaves it a child until the event loop runs, detached so processMessage doesn't find it below
+			entity->setParent((Qt3DCore::QNode*)nullptr);
+			entity->deleteLater();
+		}
+	}
+
+	for (auto it = state.mValues.begin(); it != state.mValues.end(); ++it)
+	{
+		if (it->second.mType != Analytics::GameEntityInfo::descriptor())
+			continue;
+
+		Analytics::GameEntityInfo info;
+		if (info.ParseFromString(it->second.mPayload))
+			processMessage(info);
+	}
+}
+
 void AnalyticsScene::processMessage(MessageUnionPtr msg)
 {
 	if (msg->has_gameentitylist())
@@ -7,6 +7,7 @@
 
 #include "analytics.pb.h"
 #include "modeldata.pb.h"
+#include "GameAnalytics_recording.h"
 
 class AnalyticsScene : public Qt3DCore::QEntity
 {
@@ -16,6 +17,9 @@ public:
 	
 	explicit AnalyticsScene( Qt3DCore::QNode *parent = 0 );
 	~AnalyticsScene();
+
+	// replaces the entities of the scene with those of a recording seeked to a time
+	void SetRecordedState( const SessionRecordingState& state );
  Q_SIGNALS:
 	void info( const QString &info, const QString &details );
 	void warn( const QString &info, const QString &details );
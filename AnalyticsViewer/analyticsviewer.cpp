@@ -16,6 +16,7 @@
 #include <QtWidgets/QFileDialog>
 #include <QtCore/QTimer>
 #include <strstream>
+#include <memory>
 #include <QtGui/QVector2D>
 #include <QtGui/QVector3D>
 #include <QtGui/QVector4D>
@@ -39,6 +40,7 @@ QVariant VariantFromField(const google::protobuf::Message & msg, const google::p
 
 AnalyticsViewer::AnalyticsViewer(QWidget *parent)
 	: QMainWindow(parent)
+	, mScene(NULL)
 {
 	qRegisterMetaType<MessageUnionPtr>("MessageUnionPtr");
 
@@ -179,6 +181,8 @@ AnalyticsViewer::~AnalyticsViewer()
 
 void AnalyticsViewer::sceneCreated(QObject* rootObject)
 {
+	mScene = qobject_cast<AnalyticsScene*>(rootObject);
+
 	mMessageThread = new HostThread0MQ(this);
 	connect(mMessageThread, SIGNAL(info(QString, QString)), this, SLOT(LogInfo(QString, QString)));
 	connect(mMessageThread, SIGNAL(warn(QString, QString)), this, SLOT(LogWarn(QString, QString)));
@@ -312,10 +316,74 @@ void AnalyticsViewer::RebuildLogTable()
 
 void AnalyticsViewer::FileLoad(const QString & filePath)
 {
-	/*if ( ui.renderBg->importModelToScene( filePath, false ) )
-		AppendToLog( LOG_INFO, tr( "Loading %1" ).arg( filePath ), QString() );
-		else
-		AppendToLog( LOG_INFO, tr( "Problem Loading %1" ).arg( filePath ), QString() );*/
+	std::string error;
+	if (!mRecording.Open(filePath.toStdString(), error))
+	{
+		AppendToLog(LOG_ERROR, tr("Problem Loading %1").arg(filePath), QString(error.c_str()));
+		return;
+	}
+
+	AppendToLog(LOG_INFO, tr("Loading %1").arg(filePath), QString("%1, %2 ms to %3 ms, %4 blocks, %5 keyframes")
+		.arg(mRecording.GetSession().c_str())
+		.arg(mRecording.GetStartTime())
+		.arg(mRecording.GetEndTime())
+		.arg(mRecording.GetNumBlocks())
+		.arg(mRecording.GetNumKeyframes()));
+
+	// the rows of a previous recording go, they come after the rows of the live events
+	if (!mRecordingRows.isEmpty())
+	{
+		int firstRow = mRecordingRows.first();
+		for (auto it = mRecordingRows.begin(); it != mRecordingRows.end(); ++it)
+			firstRow = qMin(firstRow, it.value());
+
+		mTimeline.RemoveRows(firstRow);
+		mRecordingRows.clear();
+	}
+
+	// the events that happen go on the timeline, a row per type. the state and the positions come from seeking
+	const bool ok = mRecording.ReadEvents(mRecording.GetStartTime(), mRecording.GetEndTime() + 1, [this](const SessionRecordingEvent& ev)
+	{
+		if (ev.mKeyType != Analytics::RPUSH || ev.mType == Analytics::GameEntityPosition::descriptor())
+			return;
+
+		const QString typeName(ev.mTypeName.c_str());
+		if (!mRecordingRows.contains(typeName))
+			mRecordingRows[typeName] = mTimeline.AddRow(typeName);
+
+		auto item = mTimeline.AddTick(mRecordingRows[typeName], ev.mTime);
+		if (item != nullptr)
+		{
+			std::unique_ptr<google::protobuf::Message> msg(ev.ParseMessage());
+			if (msg)
+				item->setData(0, VariantMapFromMessage(*msg));
+		}
+	}, error);
+
+	if (!ok)
+		AppendToLog(LOG_ERROR, tr("Problem Loading %1").arg(filePath), QString(error.c_str()));
+
+	SeekRecording(mRecording.GetStartTime());
+}
+
+void AnalyticsViewer::SeekRecording(qint64 milliseconds)
+{
+	if (!mRecording.IsOpen())
+		return;
+
+	// one keyframe and the tail of events after it
+	SessionRecordingState state;
+	std::string error;
+	if (!mRecording.Seek(milliseconds, state, error))
+	{
+		LogError(QString("Seek to %1 ms failed").arg(milliseconds), QString(error.c_str()));
+		return;
+	}
+
+	if (mScene != NULL)
+		mScene->SetRecordedState(state);
+
+	StatusInfo(QString("%1 at %2 ms").arg(mRecording.GetSession().c_str()).arg(milliseconds));
 }
 
 void AnalyticsViewer::FileSave(const QString & filePath)
@@ -328,7 +396,7 @@ void AnalyticsViewer::FileSave(const QString & filePath)
 
 void AnalyticsViewer::FileOpen()
 {
-	QString openFileName = QFileDialog::getOpenFileName(this, tr("Open Model"), "", tr("Model Files (*.obj, *.osgb)"));
+	QString openFileName = QFileDialog::getOpenFileName(this, tr("Open Recording"), "", tr("Session Recordings (*.gar)"));
 
 	if (!openFileName.isEmpty())
 	{
@@ -754,6 +822,11 @@ void AnalyticsViewer::TimelineSelectionChanged()
 	for (int i = 0; i < selected.size(); ++i)
 	{
 		QGraphicsItem* sel = selected[i];
+
+		const qint64 tickTime = TimelineGraphicsScene::GetTickTime(sel);
+		if (tickTime >= 0)
+			SeekRecording(tickTime);
+
 		auto val = sel->data(0);
 		if (!val.isNull() && val.type() == QVariant::Type::Map)
 		{
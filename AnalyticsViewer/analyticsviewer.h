@@ -12,7 +12,9 @@
 #include "ui_analyticsviewer.h"
 
 #include "Messaging.h"
+#include "GameAnalytics_recording.h"
 
+class AnalyticsScene;
 class RenderWindow;
 class HostThreadENET;
 
@@ -74,6 +76,7 @@ public:
 private:
 	Ui::AnalyticsViewerClass			ui;
 	RenderWindow*						mView;
+	AnalyticsScene*						mScene;
 	HostThread0MQ*						mMessageThread;
 	QLabel*								mNetworkLabel;
 
@@ -98,8 +101,13 @@ private:
 	typedef QMap<int, EventInfo> EventMap;
 	EventMap							mEventMap;
 
+	// a session opened from a recording file, the timeline rows of its event types
+	SessionRecordingReader				mRecording;
+	QMap<QString, int>					mRecordingRows;
+
 	void FileLoad(const QString & filePath);
 	void FileSave(const QString & filePath);
+	void SeekRecording(qint64 milliseconds);
 
 	void AddToTable(const LogEntry & log);
 
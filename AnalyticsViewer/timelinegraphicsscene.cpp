@@ -95,6 +95,37 @@ QGraphicsItem* TimelineGraphicsScene::AddTick( int row, qint64 milliseconds )
 	return nullptr;
 }
 
+void TimelineGraphicsScene::RemoveRows( int first )
+{
+	if ( first < 0 )
+		first = 0;
+
+	for ( int i = first; i < mRows.size(); ++i )
+	{
+		for ( size_t t = 0; t < mRows[ i ].mTicks.size(); ++t )
+			delete mRows[ i ].mTicks[ t ];
+		delete mRows[ i ].mRowText;
+	}
+
+	if ( first < mRows.size() )
+		mRows.resize( first );
+
+	// with no ticks left the next one starts the time over
+	bool hasTicks = false;
+	for ( int i = 0; i < mRows.size() && !hasTicks; ++i )
+		hasTicks = !mRows[ i ].mTicks.empty();
+	if ( !hasTicks )
+		mTimeBase = -1;
+
+	mDividerLineV->setLine( 0.0, 0.0, 0.0, mRows.size() * mRowHeight );
+}
+
+qint64 TimelineGraphicsScene::GetTickTime( const QGraphicsItem* item )
+{
+	const QVariant var = item->data( DataTimestamp );
+	return var.isValid() ? var.toLongLong() : -1;
+}
+
 bool TimelineGraphicsScene::focusNextPrevChild( bool next )
 {
 	QGraphicsItem* item = focusItem();
@@ -14,6 +14,11 @@ public:
 
 	int AddRow( const QString& text );
 	QGraphicsItem* AddTick( int row, qint64 milliseconds );
+	// removes the rows from first on with their ticks, the rows before keep their indices
+	void RemoveRows( int first );
+
+	// the time AddTick placed a tick at, -1 for other items
+	static qint64 GetTickTime( const QGraphicsItem* item );
 protected:
 private Q_SLOTS:
 	void SceneSizeChanged( const QRectF &rect );
@@ -4,6 +4,8 @@
 #include <set>
 #include <cctype>
 #include <algorithm> // std::remove
+#include <memory>
+#include <cfloat>
 
 #include "sqlite3.h"
 
@@ -19,6 +21,8 @@
 #include "google/protobuf/io/coded_stream.h"
 #include "google/protobuf/util/json_util.h"
 
+#include "analytics.ga.h"
+
 #include <cpp_redis/cpp_redis>
 #include <cpp_redis/core/client.hpp>
 
@@ -53,6 +57,14 @@ vaAnalytics::vaAnalytics(const char* msg, ...)
 	va_end(list);
 }
 
+// the catalog entry of a running session is refreshed this often, so sessions that never close still show about how long they ran
+static const int64_t CatalogUpdateInterval = 10000;
+
+static int64_t UnixMilliseconds()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 //void GameAnalyticsEvent::WriteToObject( Json::Value & obj ) const
@@ -81,6 +93,19 @@ GameAnalytics::GameAnalytics(GameAnalyticsCallbacks* callbacks)
 	, mCallbacks(callbacks)
 	, mClient(nullptr)
 	, mSubscriber(nullptr)
+	, mTrajectoryMode(false)
+	, mStringInterning(false)
+	, mCompactKeys(false)
+	, mLiveHeatmapInterval(0)
+	, mLiveHeatmapPublished(0)
+	, mRollupFlushInterval(1000)
+	, mRollupFlushed(0)
+	, mSketching(false)
+	, mSketchesChanged(false)
+	, mSketchInterval(10000)
+	, mSketchStored(0)
+	, mCatalogUpdated(0)
+	, mSessionStart(std::chrono::steady_clock::now())
 {
 }
 
@@ -89,9 +114,19 @@ GameAnalytics::GameAnalytics(GameAnalyticsCallbacks* callbacks)
 GameAnalytics::~GameAnalytics()
 {
 	CloseDatabase();
+	CloseRecording();
 
 	if (mClient != nullptr)
 	{
+		FlushTrajectories();
+		FlushRollups();
+		if (mSketchesChanged)
+			StoreSketches();
+
+		mCatalogEntry.mEndTime = UnixMilliseconds();
+		UpdateSessionCatalog();
+		mClient->sync_commit();
+
 		mClient->disconnect(true);
 		delete mClient;
 		mClient = nullptr;
@@ -110,7 +145,7 @@ bool GameAnalytics::OpenDatabase(const char * filename)
 
 	CheckSqliteError(sqlite3_exec(mDatabase, "VACUUM", 0, 0, 0));
 
-	return true;
+	return OpenEventSink(filename);
 }
 
 bool GameAnalytics::CreateDatabase(const char * filename)
@@ -122,7 +157,7 @@ bool GameAnalytics::CreateDatabase(const char * filename)
 		return false;
 
 	CheckSqliteError(sqlite3_exec(mDatabase, "PRAGMA synchronous=OFF", NULL, NULL, NULL));
-	CheckSqliteError(sqlite3_exec(mDatabase, "PRAGMA journal_mode=MEMORY", NULL, NULL, NULL));
+	CheckSqliteError(sqlite3_exec(mDatabase, "PRAGMA journal_mode=WAL", NULL, NULL, NULL));
 	CheckSqliteError(sqlite3_exec(mDatabase, "PRAGMA temp_store=MEMORY", NULL, NULL, NULL));
 
 	/*enum { NumDefaultTables = 2 };
@@ -174,11 +209,32 @@ bool GameAnalytics::CreateDatabase(const char * filename)
 		}
 	}*/
 
-	// todo: http://www.sqlite.org/rtree.html
+	return OpenEventSink(filename);
+}
 
+bool GameAnalytics::OpenEventSink(const char * filename)
+{
+	std::string error;
+	if (!mEventSink.Open(filename, error))
+	{
+		ReportError(vaAnalytics("failed to open %s for writing: %s", filename, error.c_str()));
+		return false;
+	}
 	return true;
 }
 
+void GameAnalytics::ReportError(const char * str)
+{
+	if (mCallbacks)
+		mCallbacks->AnalyticsError(str);
+}
+
+void GameAnalytics::ReportWarning(const char * str)
+{
+	if (mCallbacks)
+		mCallbacks->AnalyticsWarn(str);
+}
+
 int GameAnalytics::CheckSqliteError(int errcode)
 {
 	switch (errcode)
@@ -197,8 +253,7 @@ int GameAnalytics::CheckSqliteError(int errcode)
 			exerr ? "\n" : "",
 			sqlite3_errmsg(mDatabase));
 
-		if (mCallbacks)
-			mCallbacks->AnalyticsError(str.c_str());
+		ReportError(str.c_str());
 	}
 	}
 	return errcode;
@@ -206,224 +261,705 @@ int GameAnalytics::CheckSqliteError(int errcode)
 
 void GameAnalytics::CloseDatabase()
 {
+	mEventSink.Close();
+
 	sqlite3_close_v2(mDatabase);
+	mDatabase = NULL;
+}
+
+bool GameAnalytics::QueryRegion(const RegionQuery& query, RegionQueryCallback callback)
+{
+	if (mDatabase == NULL)
+		return false;
+
+	// make the events of the frames handed to the writer visible to this connection
+	if (mEventSink.IsOpen())
+		mEventSink.Flush();
+
+	std::string error;
+	if (!SqliteEventSink::QueryRegion(mDatabase, query, callback, error))
+	{
+		ReportError(vaAnalytics("region query failed: %s", error.c_str()));
+		return false;
+	}
+	return true;
 }
 
-void GameAnalytics::WriteHeatmapScript(const HeatmapDef & def, std::string & scriptContents)
+bool GameAnalytics::ExportColumnArchive(const std::string & directory, uint32_t blockRows)
 {
-	scriptContents.clear();
-#if(0)
-	if (mDatabase != NULL)
+	if (mDatabase == NULL)
+		return false;
+
+	std::vector< EventCatalogEntry > entries;
+	GetEventCatalog(entries);
+
+	const google::protobuf::DescriptorPool* pool = google::protobuf::DescriptorPool::generated_pool();
+
+	bool ok = true;
+	std::string error;
+	for (size_t i = 0; i < entries.size(); ++i)
 	{
-		const double worldSizeX = ceil(def.mWorldMaxs[0] - def.mWorldMins[0]);
-		const double worldSizeY = ceil(def.mWorldMaxs[1] - def.mWorldMins[1]);
-		const double aspect = (double)worldSizeX / (double)worldSizeY;
+		const google::protobuf::Descriptor* desc = pool->FindMessageTypeByName(std::string("Analytics.") + entries[i].mName);
+		if (desc == NULL)
+			continue;
 
-		const double worldCenterX = (def.mWorldMaxs[0] + def.mWorldMins[0]) * 0.5;
-		const double worldCenterY = (def.mWorldMaxs[1] + def.mWorldMins[1]) * 0.5;
+		const std::string filename = directory + "/" + desc->name() + ".gac";
 
-		int imageX = 0;
-		int imageY = 0;
-		if (worldSizeX > worldSizeY)
+		ColumnarWriter writer(desc, blockRows);
+		if (!writer.Open(filename, error))
 		{
-			imageX = def.mImageSize;
-			imageY = (int)ceil((double)def.mImageSize / aspect);
+			ReportError(vaAnalytics("column archive: %s", error.c_str()));
+			ok = false;
+			continue;
 		}
-		else
+
+		RegionQuery query(desc);
+		const bool queried = QueryRegion(query, [&writer](const google::protobuf::Message& msg, int64_t timeStamp)
+		{
+			return writer.AddEvent(msg, timeStamp);
+		});
+
+		// a table that couldn't be read completely leaves no archive rather than one missing events
+		if (!queried)
+		{
+			writer.Close(error);
+			remove(filename.c_str());
+			ReportError(vaAnalytics("column archive: can't read the %s events, skipped", desc->name().c_str()));
+			ok = false;
+			continue;
+		}
+
+		if (!writer.Close(error))
+		{
+			ReportError(vaAnalytics("column archive: %s", error.c_str()));
+			ok = false;
+			continue;
+		}
+
+		// the bitmaps of the (track_event) columns next to the archive
+		ColumnarReader reader;
+		if (!reader.Open(filename, error) || !BuildColumnIndex(reader, ColumnIndexFilename(filename), 0, error))
 		{
-			imageX = (int)(aspect * def.mImageSize);
-			imageY = def.mImageSize;
+			ReportError(vaAnalytics("column archive: %s", error.c_str()));
+			ok = false;
 		}
+	}
 
-		const double scaleX = (double)imageX / worldSizeX;
-		const double scaleY = (double)imageY / worldSizeY;
+	// the enums only keep their values in the repeated field, which has no column
+	bool hasEnums = false;
+	for (size_t i = 0; i < entries.size() && !hasEnums; ++i)
+		hasEnums = entries[i].mName == Analytics::GameEnum::descriptor()->name();
 
-		std::stringstream str;
-		str << "-gravity center" << std::endl;
-		str << va("-print 'Generating Image Buffer(%d x %d)\\n'", imageX, imageY) << std::endl;
-		str << va("-size %dx%d", imageX, imageY) << std::endl;
-		str << "xc:black" << std::endl;
-		str << "-print 'Rasterizing $(NUMEVENTS) Events\\n'" << std::endl;
-		str << std::endl;
+	// a session without enums has no table for them and gets an empty enums.txt
+	EnumNameTable enumNames;
+	const bool queried = !hasEnums || QueryRegion(RegionQuery(Analytics::GameEnum::descriptor()), [&enumNames](const google::protobuf::Message& msg, int64_t)
+	{
+		enumNames.Add(static_cast<const Analytics::GameEnum&>(msg));
+		return true;
+	});
 
-		int progressCounter = 0;
-		const int progressMarker = 1000;
+	if (!queried)
+	{
+		ReportError("column archive: can't read the GameEnum events, enums.txt skipped");
+		ok = false;
+	}
+	else if (!enumNames.Save(directory + "/enums.txt", error))
+	{
+		ReportError(vaAnalytics("column archive: %s", error.c_str()));
+		ok = false;
+	}
+	return ok;
+}
 
-		sqlite3_stmt * statement = NULL;
-		if (SQLITE_OK == CheckSqliteError(sqlite3_prepare_v2(mDatabase,
-			"SELECT x, y, z, value FROM eventsGame WHERE ( areaId=? AND eventId=? AND x NOT NULL )",
-			-1, &statement, NULL)))
-		{
-			sqlite3_bind_text(statement, 1, def.mAreaId, strlen(def.mAreaId), NULL);
-			sqlite3_bind_text(statement, 2, def.mEventId, strlen(def.mEventId), NULL);
+GameAnalytics::HeatmapDef::HeatmapDef()
+	: mAreaId("")
+	, mEventId("")
+	, mEventRadius(0.0f)
+	, mImageSize(1024)
+	, mLines(false)
+{
+	mWorldMins[0] = mWorldMins[1] = 0.0f;
+	mWorldMaxs[0] = mWorldMaxs[1] = 0.0f;
 
-			while (SQLITE_ROW == CheckSqliteError(sqlite3_step(statement)))
-			{
-				if ((progressCounter % progressMarker) == 0)
-					str << va("-print 'Generating Event Gradients %d...\\n'", progressCounter) << std::endl;
-				++progressCounter;
-
-				const double resultX = sqlite3_column_double(statement, 0) - worldCenterX;
-				const double resultY = sqlite3_column_double(statement, 1) - worldCenterY;
-				const double resultZ = sqlite3_column_double(statement, 2);
-				const double value = sqlite3_column_double(statement, 3);
-
-				const float multiplier = 1.0f;
-
-				str << va("( -size %dx%d radial-gradient: -evaluate Multiply %g ) -geometry +%d+%d -compose Plus -composite",
-					(int)(def.mEventRadius * scaleX),
-					(int)(def.mEventRadius * scaleY),
-					multiplier,
-					(int)(resultX * scaleX),
-					(int)(resultY * scaleY)) << std::endl;
-			}
-		}
-		if (progressCounter == 0)
-			str << va("-print 'No Events.\\n'", progressCounter) << std::endl;
+	// every floor unless sliced
+	mWorldMins[2] = -FLT_MAX;
+	mWorldMaxs[2] = FLT_MAX;
+}
 
-		CheckSqliteError(sqlite3_finalize(statement));
+bool GameAnalytics::FindHeatmapEvent(const HeatmapDef & def, const PointEventAccessor*& points, const LineEventAccessor*& lines)
+{
+	points = NULL;
+	lines = NULL;
+
+	// event ids are the table names of the sink, which are the message names
+	const google::protobuf::DescriptorPool* pool = google::protobuf::DescriptorPool::generated_pool();
+	const google::protobuf::Descriptor* desc = pool->FindMessageTypeByName(std::string("Analytics.") + def.mEventId);
+	if (desc == NULL)
+		desc = pool->FindMessageTypeByName(def.mEventId);
+	if (desc == NULL)
+	{
+		ReportError(vaAnalytics("heatmap: unknown event type %s", def.mEventId));
+		return false;
+	}
+
+	if (def.mLines)
+		lines = LineEventAccessor::Find(desc);
+	else
+		points = PointEventAccessor::Find(desc);
+
+	if (points == NULL && lines == NULL)
+	{
+		ReportError(vaAnalytics("heatmap: %s has no usable (%s) field", def.mEventId, def.mLines ? "line_event" : "point_event"));
+		return false;
+	}
+	return true;
+}
 
-		str << std::endl;
-		str << "-print 'Colorizing Heatmap\\n'" << std::endl;
+bool GameAnalytics::AddHeatmapEvents(const HeatmapDef & def, HeatmapPointSink & heatmap)
+{
+	if (mDatabase == NULL)
+		return false;
+
+	const PointEventAccessor* accessor = NULL;
+	const LineEventAccessor* lineAccessor = NULL;
+	if (!FindHeatmapEvent(def, accessor, lineAccessor))
+		return false;
 
-		str << "-auto-level" << std::endl;
-		str << "(" << std::endl;
-		str << "	-size 1x250" << std::endl;
-		str << "	gradient:#004-#804" << std::endl;
-		str << "	gradient:#804-#f00" << std::endl;
-		str << "	gradient:#f00-#f80" << std::endl;
-		str << "	gradient:#f80-#ff0" << std::endl;
-		str << "	gradient:#ff0-#ffa" << std::endl;
-		str << "	-append" << std::endl;
-		str << ") -clut" << std::endl;
+	const float radiusOverride = def.mEventRadius;
 
-		str << "-print 'Writing Heatmap\\n'" << std::endl;
-		str << "-write " << va("heatmap_%s_%s.png", def.mAreaId, def.mEventId) << std::endl;
-		str << "-exit" << std::endl;
+	if (lineAccessor != NULL)
+	{
+		// segments cross the map from events anywhere and paths need every sample, so no box
+		HeatmapPathBuilder paths(heatmap, lineAccessor->GetMaxStep());
+		paths.SetZRange(def.mWorldMins[2], def.mWorldMaxs[2]);
+		if (!QueryRegion(RegionQuery(lineAccessor->GetLineField()->containing_type()), [&paths, lineAccessor, radiusOverride](const google::protobuf::Message& msg, int64_t)
+		{
+			paths.AddEvent(msg, *lineAccessor, radiusOverride);
+			return true;
+		}))
+			return false;
 
-		scriptContents = str.str();
+		// trajectory mode sends the positions in chunks instead
+		if (lineAccessor->GetLineField()->containing_type() != Analytics::GameEntityPosition::descriptor())
+			return true;
 
-		// replace variables
-		const std::string varNumEvents = "$(NUMEVENTS)";
-		const size_t p = scriptContents.find(varNumEvents);
-		if (p != std::string::npos)
+		std::vector< EventCatalogEntry > entries;
+		GetEventCatalog(entries);
+		for (size_t i = 0; i < entries.size(); ++i)
 		{
-			scriptContents.replace(scriptContents.begin() + p, scriptContents.begin() + p + varNumEvents.length(), va("%d", progressCounter));
+			if (entries[i].mName != Analytics::GameEntityTrajectory::descriptor()->name())
+				continue;
+
+			return QueryRegion(RegionQuery(Analytics::GameEntityTrajectory::descriptor()), [&paths, lineAccessor, radiusOverride](const google::protobuf::Message& msg, int64_t)
+			{
+				paths.AddTrajectory(static_cast<const Analytics::GameEntityTrajectory&>(msg), *lineAccessor, radiusOverride);
+				return true;
+			});
 		}
+		return true;
 	}
-#endif
+
+	RegionQuery query(accessor->GetPointField()->containing_type());
+	query.mPointField = accessor->GetPointField();
+
+	// events just outside of the map still spread into it, but not from the floors above or below
+	for (int i = 0; i < 2; ++i)
+	{
+		query.mMins[i] = def.mWorldMins[i] - def.mEventRadius * 1.5f;
+		query.mMaxs[i] = def.mWorldMaxs[i] + def.mEventRadius * 1.5f;
+	}
+	query.mMins[2] = def.mWorldMins[2];
+	query.mMaxs[2] = def.mWorldMaxs[2];
+
+	return QueryRegion(query, [&heatmap, accessor, radiusOverride](const google::protobuf::Message& msg, int64_t)
+	{
+		float pos[3], radius, weight;
+		if (accessor->Read(msg, pos, radius, weight))
+			heatmap.AddPoint(pos[0], pos[1], weight, radiusOverride > 0.0f ? radiusOverride : radius);
+		return true;
+	});
 }
 
-void GameAnalytics::GetUniqueEventNames(std::vector< std::string > & eventNames)
+bool GameAnalytics::AddSessionHeatmapEvents(const std::string & keySpacePrefix, const HeatmapDef & def, HeatmapPointSink & heatmap)
 {
-	if (mDatabase)
+	if (mClient == nullptr)
+		return false;
+
+	const PointEventAccessor* accessor = NULL;
+	const LineEventAccessor* lineAccessor = NULL;
+	if (!FindHeatmapEvent(def, accessor, lineAccessor))
+		return false;
+
+	if (lineAccessor != NULL)
 	{
-		sqlite3_stmt * statement = NULL;
-		if (SQLITE_OK == CheckSqliteError(sqlite3_prepare_v2(mDatabase,
-			"SELECT eventId FROM eventsGame", -1, &statement, NULL)))
+		// list order is event order, which is what joins the samples of a path
+		HeatmapPathBuilder paths(heatmap, lineAccessor->GetMaxStep());
+		paths.SetZRange(def.mWorldMins[2], def.mWorldMaxs[2]);
+		if (!ForEachSessionEvent(keySpacePrefix, lineAccessor->GetLineField()->containing_type(), [&paths, lineAccessor, &def](const google::protobuf::Message& msg)
 		{
-			while (SQLITE_ROW == CheckSqliteError(sqlite3_step(statement)))
-			{
-				const unsigned char * eventName = sqlite3_column_text(statement, 0);
-				if (eventName != NULL)
-				{
-					if (std::find(eventNames.begin(), eventNames.end(), (const char *)eventName) == eventNames.end())
-						eventNames.push_back((const char *)eventName);
-				}
-			}
-		}
+			paths.AddEvent(msg, *lineAccessor, def.mEventRadius);
+		}))
+			return false;
+
+		// trajectory mode sends the positions in chunks instead, a list per entity
+		if (lineAccessor->GetLineField()->containing_type() != Analytics::GameEntityPosition::descriptor())
+			return true;
+
+		return ForEachSessionEvent(keySpacePrefix, Analytics::GameEntityTrajectory::descriptor(), [&paths, lineAccessor, &def](const google::protobuf::Message& msg)
+		{
+			paths.AddTrajectory(static_cast<const Analytics::GameEntityTrajectory&>(msg), *lineAccessor, def.mEventRadius);
+		});
 	}
+
+	return ForEachSessionEvent(keySpacePrefix, accessor->GetPointField()->containing_type(), [&heatmap, accessor, &def](const google::protobuf::Message& msg)
+	{
+		float pos[3], radius, weight;
+		if (accessor->Read(msg, pos, radius, weight) && pos[2] >= def.mWorldMins[2] && pos[2] <= def.mWorldMaxs[2])
+			heatmap.AddPoint(pos[0], pos[1], weight, def.mEventRadius > 0.0f ? def.mEventRadius : radius);
+	});
 }
 
-bool StringFromField(std::string & strOut, const google::protobuf::Message & msg, const google::protobuf::FieldDescriptor* fdesc)
+bool GameAnalytics::AddVoxelHeatmapEvents(const HeatmapDef & def, HeatmapVoxelGrid & grid)
 {
-	if (fdesc->is_repeated())
+	const bool ok = ForEachHeatmapPoint(std::string(), def, [&grid](const float pos[3], float weight, float radius)
+	{
+		grid.AddPoint(pos, weight, radius);
+	});
+
+	grid.Build();
+	return ok;
+}
+
+bool GameAnalytics::AddSessionVoxelHeatmapEvents(const std::string & keySpacePrefix, const HeatmapDef & def, HeatmapVoxelGrid & grid)
+{
+	if (keySpacePrefix.empty())
 		return false;
 
-	switch (fdesc->type())
+	const bool ok = ForEachHeatmapPoint(keySpacePrefix, def, [&grid](const float pos[3], float weight, float radius)
 	{
-	case google::protobuf::FieldDescriptor::TYPE_DOUBLE:
+		grid.AddPoint(pos, weight, radius);
+	});
+
+	grid.Build();
+	return ok;
+}
+
+bool GameAnalytics::AddMeshHeatmapEvents(const HeatmapDef & def, MeshHeatmap & mesh)
+{
+	const bool ok = ForEachHeatmapPoint(std::string(), def, [&mesh](const float pos[3], float weight, float)
 	{
-		const double val = msg.GetReflection()->GetBool(msg, fdesc);
-		strOut = vaAnalytics("%f", val);
-		break;
-	}
-	case google::protobuf::FieldDescriptor::TYPE_FLOAT:
+		mesh.AddPoint(pos, weight);
+	});
+
+	mesh.Build();
+	return ok;
+}
+
+bool GameAnalytics::AddSessionMeshHeatmapEvents(const std::string & keySpacePrefix, const HeatmapDef & def, MeshHeatmap & mesh)
+{
+	if (keySpacePrefix.empty())
+		return false;
+
+	const bool ok = ForEachHeatmapPoint(keySpacePrefix, def, [&mesh](const float pos[3], float weight, float)
 	{
-		const float val = msg.GetReflection()->GetFloat(msg, fdesc);
-		strOut = vaAnalytics("%f", val);
-		break;
-	}
-	case google::protobuf::FieldDescriptor::TYPE_INT64:
-	case google::protobuf::FieldDescriptor::TYPE_FIXED64:
-	case google::protobuf::FieldDescriptor::TYPE_SINT64:
-	case google::protobuf::FieldDescriptor::TYPE_SFIXED64:
+		mesh.AddPoint(pos, weight);
+	});
+
+	mesh.Build();
+	return ok;
+}
+
+bool GameAnalytics::LoadSessionMesh(const std::string & keySpacePrefix, const std::string & modelName, Analytics::Mesh & mesh)
+{
+	if (mClient == nullptr)
+		return false;
+
+	if (keySpacePrefix != mParseSessionPrefix && !LoadStringTable(keySpacePrefix))
+		return false;
+
+	std::string meshKey;
+	if (!GetParseTypeKey(Analytics::GameMeshData::descriptor(), meshKey))
+		return false;
+
+	std::future<cpp_redis::reply> f = mClient->hget(meshKey, modelName);
+	mClient->sync_commit();
+
+	const cpp_redis::reply reply = f.get();
+	if (!reply.is_string())
+		return false;
+
+	Analytics::GameMeshData meshData;
+	if (!ParseEvent(reply.as_string(), meshData))
+		return false;
+
+	if (meshData.compressiontype() != Analytics::Compression_None)
 	{
-		const google::protobuf::int64 val = msg.GetReflection()->GetInt64(msg, fdesc);
-		strOut = vaAnalytics("%ll", val);
-		break;
+		ReportError(vaAnalytics("Mesh %s has unsupported compression %d", modelName.c_str(), (int)meshData.compressiontype()));
+		return false;
 	}
-	case google::protobuf::FieldDescriptor::TYPE_UINT64:
+
+	return mesh.ParseFromString(meshData.modelbytes());
+}
+
+MeshHeatmap * GameAnalytics::GetMeshHeatmap(const std::string & keySpacePrefix, const std::string & modelName)
+{
+	std::unique_ptr<MeshHeatmap>& cached = mMeshHeatmaps[modelName];
+	if (cached)
+		return cached.get();
+
+	Analytics::Mesh mesh;
+	if (!LoadSessionMesh(keySpacePrefix, modelName, mesh))
 	{
-		const google::protobuf::uint64 val = msg.GetReflection()->GetUInt64(msg, fdesc);
-		strOut = vaAnalytics("%ull", val);
-		break;
+		mMeshHeatmaps.erase(modelName);
+		return NULL;
 	}
-	case google::protobuf::FieldDescriptor::TYPE_SINT32:
-	case google::protobuf::FieldDescriptor::TYPE_FIXED32:
-	case google::protobuf::FieldDescriptor::TYPE_SFIXED32:
-	case google::protobuf::FieldDescriptor::TYPE_INT32:
+
+	std::unique_ptr<MeshHeatmap> heatmap(new MeshHeatmap());
+	if (!heatmap->Init(mesh))
 	{
-		const google::protobuf::uint32 val = msg.GetReflection()->GetInt32(msg, fdesc);
-		strOut = vaAnalytics("%d", val);
-		break;
+		mMeshHeatmaps.erase(modelName);
+		return NULL;
 	}
-	case google::protobuf::FieldDescriptor::TYPE_UINT32:
+
+	cached = std::move(heatmap);
+	return cached.get();
+}
+
+bool GameAnalytics::ForEachHeatmapPoint(const std::string & keySpacePrefix, const HeatmapDef & def, const std::function<void(const float pos[3], float weight, float radius)> & fn)
+{
+	if (keySpacePrefix.empty() ? mDatabase == NULL : mClient == nullptr)
+		return false;
+
+	const PointEventAccessor* accessor = NULL;
+	const LineEventAccessor* lineAccessor = NULL;
+	HeatmapDef pointDef = def;
+	pointDef.mLines = false;
+	if (!FindHeatmapEvent(pointDef, accessor, lineAccessor))
+		return false;
+
+	const float radiusOverride = def.mEventRadius;
+	if (keySpacePrefix.empty())
 	{
-		const google::protobuf::uint32 val = msg.GetReflection()->GetUInt32(msg, fdesc);
-		strOut = vaAnalytics("%d", val);
-		break;
+		RegionQuery query(accessor->GetPointField()->containing_type());
+		query.mPointField = accessor->GetPointField();
+		for (int i = 0; i < 3; ++i)
+		{
+			query.mMins[i] = def.mWorldMins[i];
+			query.mMaxs[i] = def.mWorldMaxs[i];
+		}
+
+		return QueryRegion(query, [&fn, accessor, radiusOverride](const google::protobuf::Message& msg, int64_t)
+		{
+			float pos[3], radius, weight;
+			if (accessor->Read(msg, pos, radius, weight))
+				fn(pos, weight, radiusOverride > 0.0f ? radiusOverride : radius);
+			return true;
+		});
 	}
-	case google::protobuf::FieldDescriptor::TYPE_BOOL:
+
+	return ForEachSessionEvent(keySpacePrefix, accessor->GetPointField()->containing_type(), [&fn, accessor, &def, radiusOverride](const google::protobuf::Message& msg)
 	{
-		const bool val = msg.GetReflection()->GetBool(msg, fdesc);
-		strOut = val ? "1" : "0";
-		break;
+		float pos[3], radius, weight;
+		if (!accessor->Read(msg, pos, radius, weight))
+			return;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			if (pos[i] < def.mWorldMins[i] || pos[i] > def.mWorldMaxs[i])
+				return;
+		}
+		fn(pos, weight, radiusOverride > 0.0f ? radiusOverride : radius);
+	});
+}
+
+bool GameAnalytics::ForEachSessionEvent(const std::string & keySpacePrefix, const google::protobuf::Descriptor* eventType, const std::function<void(const google::protobuf::Message&)> & fn)
+{
+	if (keySpacePrefix != mParseSessionPrefix && !LoadStringTable(keySpacePrefix))
+		return false;
+
+	std::string infoKey, eventKey;
+	if (!GetParseTypeKey(Analytics::GameInfo::descriptor(), infoKey) || !GetParseTypeKey(eventType, eventKey))
+		return true;
+
+	// a (rediskeysuffix) type has a list per suffix value, found with SCAN and read in key order
+	std::vector<std::string> eventKeys;
+	if (!eventType->options().HasExtension(Analytics::rediskeysuffix))
+		eventKeys.push_back(eventKey);
+	else
+	{
+		size_t cursor = 0;
+		do
+		{
+			std::future<cpp_redis::reply> f = mClient->scan(cursor, eventKey + ":*", 1000);
+			mClient->sync_commit();
+
+			const cpp_redis::reply r = f.get();
+			if (!r.is_array() || r.as_array().size() != 2 || !r.as_array()[0].is_string() || !r.as_array()[1].is_array())
+			{
+				ReportError(vaAnalytics("heatmap: %s", r.is_error() ? r.error().c_str() : "unexpected reply"));
+				return false;
+			}
+
+			cursor = (size_t)strtoull(r.as_array()[0].as_string().c_str(), NULL, 10);
+
+			const std::vector<cpp_redis::reply>& found = r.as_array()[1].as_array();
+			for (size_t i = 0; i < found.size(); ++i)
+			{
+				if (found[i].is_string())
+					eventKeys.push_back(found[i].as_string());
+			}
+		} while (cursor != 0);
+
+		std::sort(eventKeys.begin(), eventKeys.end());
+		eventKeys.erase(std::unique(eventKeys.begin(), eventKeys.end()), eventKeys.end());
 	}
-	case google::protobuf::FieldDescriptor::TYPE_STRING:
+
+	// the world bounds of quantized positions come from the GameInfo of the session
+	std::future<cpp_redis::reply> info = mClient->get(infoKey);
+	std::vector< std::future<cpp_redis::reply> > lengths;
+	for (size_t k = 0; k < eventKeys.size(); ++k)
+		lengths.push_back(mClient->llen(eventKeys[k]));
+	mClient->sync_commit();
+
+	const cpp_redis::reply infoReply = info.get();
+	if (infoReply.is_string())
 	{
-		strOut = msg.GetReflection()->GetString(msg, fdesc);
-		break;
+		Analytics::GameInfo gameInfo;
+		ParseEvent(infoReply.as_string(), gameInfo);
 	}
-	case google::protobuf::FieldDescriptor::TYPE_ENUM:
+
+	// the whole lists in pipelined pages
+	const int pageSize = 4096;
+
+	std::vector< std::future<cpp_redis::reply> > pages;
+	for (size_t k = 0; k < eventKeys.size(); ++k)
 	{
-		const google::protobuf::EnumValueDescriptor* eval = msg.GetReflection()->GetEnum(msg, fdesc);
-		if (eval == NULL)
+		const cpp_redis::reply lengthReply = lengths[k].get();
+		if (!lengthReply.is_integer())
+		{
+			ReportError(vaAnalytics("heatmap: %s", lengthReply.is_error() ? lengthReply.error().c_str() : "unexpected reply"));
 			return false;
+		}
 
-		strOut = eval->name();
-		break;
+		const int64_t count = lengthReply.as_integer();
+		for (int64_t start = 0; start < count; start += pageSize)
+			pages.push_back(mClient->lrange(eventKeys[k], (int)start, (int)(start + pageSize - 1)));
 	}
-	default:
+	mClient->sync_commit();
+
+	std::unique_ptr<google::protobuf::Message> msg(google::protobuf::MessageFactory::generated_factory()->GetPrototype(eventType)->New());
+
+	for (size_t p = 0; p < pages.size(); ++p)
 	{
-		return false;
-	}
+		const cpp_redis::reply r = pages[p].get();
+		if (!r.is_array())
+			continue;
+
+		const std::vector<cpp_redis::reply>& values = r.as_array();
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			msg->Clear();
+			if (values[i].is_string() && ParseEvent(values[i].as_string(), *msg))
+				fn(*msg);
+		}
 	}
 	return true;
 }
 
-//void GameAnalytics::AddEvent(const google::protobuf::Message& msg)
-//{
-//	/*
-//	std::string cacheKey;
-//
-//	if (cacheLast)
-//	{
-//		MsgKeyCache& keyCache = mMessageCache[msg.GetTypeName()];
-//
-//		// figure out the key with which to cache this message, to allow us to cache more than one of the same type message
-//		cacheKey = msg.GetTypeName();
-//
+bool GameAnalytics::WriteHeatmap(const HeatmapDef & def, const char * filename)
+{
+	HeatmapRasterizer heatmap;
+	heatmap.Init(def.mWorldMins, def.mWorldMaxs, def.mImageSize, def.mEventRadius);
+
+	if (!AddHeatmapEvents(def, heatmap))
+		return false;
+
+	return WriteHeatmapFile(heatmap, def, filename);
+}
+
+bool GameAnalytics::WriteSessionHeatmap(const std::string & keySpacePrefix, const HeatmapDef & def, const char * filename)
+{
+	HeatmapRasterizer heatmap;
+	heatmap.Init(def.mWorldMins, def.mWorldMaxs, def.mImageSize, def.mEventRadius);
+
+	if (!AddSessionHeatmapEvents(keySpacePrefix, def, heatmap))
+		return false;
+
+	return WriteHeatmapFile(heatmap, def, filename);
+}
+
+bool GameAnalytics::UpdateHeatmapTiles(HeatmapTilePyramid & tiles, const HeatmapDef & def, const std::vector<std::string> & keySpacePrefixes, std::vector<std::string> & layerKeys)
+{
+	const PointEventAccessor* accessor = NULL;
+	const LineEventAccessor* lineAccessor = NULL;
+	if (!FindHeatmapEvent(def, accessor, lineAccessor))
+		return false;
+
+	const std::string source = lineAccessor != NULL ?
+		lineAccessor->GetLineField()->containing_type()->name() + "-lines" : accessor->GetPointField()->containing_type()->name();
+
+	// what the def changes about the pixels besides the pyramid settings, the floors it slices and the radius override
+	std::vector< std::pair<std::string, std::string> > settings;
+	settings.push_back(std::make_pair(std::string("minZ"), std::string(vaAnalytics("%.9g", def.mWorldMins[2]))));
+	settings.push_back(std::make_pair(std::string("maxZ"), std::string(vaAnalytics("%.9g", def.mWorldMaxs[2]))));
+	settings.push_back(std::make_pair(std::string("radius"), std::string(vaAnalytics("%.9g", def.mEventRadius))));
+
+	layerKeys.clear();
+	for (size_t i = 0; i < keySpacePrefixes.size(); ++i)
+	{
+		const std::string layerKey = tiles.LayerKey(keySpacePrefixes[i], source, settings);
+		layerKeys.push_back(layerKey);
+
+		// a running session still gets events, only the layer of one that ended is complete and can be reused
+		SessionCatalogEntry entry;
+		if (ReadSessionCatalog(keySpacePrefixes[i], entry) && entry.mEndTime > 0 && tiles.HasLayer(layerKey))
+			continue;
+
+		if (!AddSessionHeatmapEvents(keySpacePrefixes[i], def, tiles))
+			return false;
+
+		std::string error;
+		if (!tiles.BuildLayer(layerKey, false, error))
+		{
+			ReportError(vaAnalytics("heatmap tiles: %s", error.c_str()));
+			return false;
+		}
+	}
+	return true;
+}
+
+bool GameAnalytics::WriteHeatmapFile(HeatmapRasterizer & heatmap, const HeatmapDef & def, const char * filename)
+{
+	heatmap.Render();
+
+	const std::string defaultName = vaAnalytics("heatmap_%s_%s%s.png", def.mAreaId, def.mEventId, def.mLines ? "_lines" : "").c_str();
+	if (filename == NULL)
+		filename = defaultName.c_str();
+
+	// .raw writes the unnormalized floats for other tools
+	const size_t len = strlen(filename);
+	const bool raw = len >= 4 && strcmp(filename + len - 4, ".raw") == 0;
+
+	std::string error;
+	if (!(raw ? heatmap.WriteRaw(filename, error) : heatmap.WritePng(filename, error)))
+	{
+		ReportError(vaAnalytics("heatmap: %s", error.c_str()));
+		return false;
+	}
+	return true;
+}
+
+void GameAnalytics::GetEventCatalog(std::vector< EventCatalogEntry > & entries)
+{
+	if (mDatabase == NULL)
+		return;
+
+	if (mEventSink.IsOpen())
+		mEventSink.Flush();
+
+	std::string error;
+	if (!SqliteEventSink::ReadCatalog(mDatabase, entries, error))
+		ReportError(vaAnalytics("failed to read the event catalog: %s", error.c_str()));
+}
+
+void GameAnalytics::GetUniqueEventNames(std::vector< std::string > & eventNames)
+{
+	std::vector< EventCatalogEntry > entries;
+	GetEventCatalog(entries);
+
+	for (size_t i = 0; i < entries.size(); ++i)
+		eventNames.push_back(entries[i].mName);
+}
+
+bool StringFromField(std::string & strOut, const google::protobuf::Message & msg, const google::protobuf::FieldDescriptor* fdesc)
+{
+	if (fdesc->is_repeated())
+		return false;
+
+	switch (fdesc->type())
+	{
+	case google::protobuf::FieldDescriptor::TYPE_DOUBLE:
+	{
+		const double val = msg.GetReflection()->GetDouble(msg, fdesc);
+		strOut = vaAnalytics("%f", val);
+		break;
+	}
+	case google::protobuf::FieldDescriptor::TYPE_FLOAT:
+	{
+		const float val = msg.GetReflection()->GetFloat(msg, fdesc);
+		strOut = vaAnalytics("%f", val);
+		break;
+	}
+	case google::protobuf::FieldDescriptor::TYPE_INT64:
+	case google::protobuf::FieldDescriptor::TYPE_FIXED64:
+	case google::protobuf::FieldDescriptor::TYPE_SINT64:
+	case google::protobuf::FieldDescriptor::TYPE_SFIXED64:
+	{
+		const google::protobuf::int64 val = msg.GetReflection()->GetInt64(msg, fdesc);
+		strOut = vaAnalytics("%lld", (long long)val);
+		break;
+	}
+	case google::protobuf::FieldDescriptor::TYPE_UINT64:
+	{
+		const google::protobuf::uint64 val = msg.GetReflection()->GetUInt64(msg, fdesc);
+		strOut = vaAnalytics("%llu", (unsigned long long)val);
+		break;
+	}
+	case google::protobuf::FieldDescriptor::TYPE_SINT32:
+	case google::protobuf::FieldDescriptor::TYPE_FIXED32:
+	case google::protobuf::FieldDescriptor::TYPE_SFIXED32:
+	case google::protobuf::FieldDescriptor::TYPE_INT32:
+	{
+		const google::protobuf::int32 val = msg.GetReflection()->GetInt32(msg, fdesc);
+		strOut = vaAnalytics("%d", val);
+		break;
+	}
+	case google::protobuf::FieldDescriptor::TYPE_UINT32:
+	{
+		const google::protobuf::uint32 val = msg.GetReflection()->GetUInt32(msg, fdesc);
+		strOut = vaAnalytics("%u", val);
+		break;
+	}
+	case google::protobuf::FieldDescriptor::TYPE_BOOL:
+	{
+		const bool val = msg.GetReflection()->GetBool(msg, fdesc);
+		strOut = val ? "1" : "0";
+		break;
+	}
+	case google::protobuf::FieldDescriptor::TYPE_STRING:
+	{
+		strOut = msg.GetReflection()->GetString(msg, fdesc);
+		break;
+	}
+	case google::protobuf::FieldDescriptor::TYPE_ENUM:
+	{
+		const google::protobuf::EnumValueDescriptor* eval = msg.GetReflection()->GetEnum(msg, fdesc);
+		if (eval == NULL)
+			return false;
+
+		strOut = eval->name();
+		break;
+	}
+	default:
+	{
+		return false;
+	}
+	}
+	return true;
+}
+
+//void GameAnalytics::AddEvent(const google::protobuf::Message& msg)
+//{
+//	/*
+//	std::string cacheKey;
+//
+//	if (cacheLast)
+//	{
+//		MsgKeyCache& keyCache = mMessageCache[msg.GetTypeName()];
+//
+//		// figure out the key with which to cache this message, to allow us to cache more than one of the same type message
+//		cacheKey = msg.GetTypeName();
+//
 //		if (msg.GetDescriptor()->options().HasExtension(Analytics::cachekeysuffix))
 //		{
 //			cacheKey = msg.GetDescriptor()->options().GetExtension(Analytics::cachekeysuffix);
@@ -524,9 +1060,7 @@ void GameAnalytics::SendMesh(const std::string& modelName, const Analytics::Mesh
 
 void GameAnalytics::SendGameEnum(const google::protobuf::EnumDescriptor* descriptor)
 {
-	if (mClient == nullptr)
-		return;
-
+	// AddEvent sends it when there is a connection, the database and recording keep it either way
 	std::string enumName = descriptor->name();
 	std::transform(enumName.begin(), enumName.end(), enumName.begin(), [](unsigned char c) { return std::toupper(c); });
 
@@ -547,28 +1081,25 @@ void GameAnalytics::SendGameEnum(const google::protobuf::EnumDescriptor* descrip
 
 //////////////////////////////////////////////////////////////////////////
 
-void GameAnalytics::AddEvent(const google::protobuf::Message& msg)
+// the key type of an event, the suffix of its key past the type name, ":<suffix>" for per entity keys, and the hash field of a HMSET
+static Analytics::RedisKeyType GetEventKeyParts(const google::protobuf::Message& msg, const EventEncoder* encoder, std::string& keySuffix, std::string& hashKey)
 {
-	if (mClient == nullptr)
-		return;
-
-	std::string payload;
-
-	if (msg.GetDescriptor()->options().HasExtension(Analytics::useJsonEncoding))
-	{
-		google::protobuf::util::MessageToJsonString(msg, &payload);
-	}
-	else
-	{
-		payload = msg.SerializeAsString();
-	}
+	keySuffix.clear();
+	hashKey.clear();
 
 	Analytics::RedisKeyType redisKeyType = Analytics::UNKNOWN;
-	if (msg.GetDescriptor()->options().HasExtension(Analytics::rediskeytype))
+	if (encoder != NULL)
+		redisKeyType = encoder->mKeyType;
+	else if (msg.GetDescriptor()->options().HasExtension(Analytics::rediskeytype))
 		redisKeyType = msg.GetDescriptor()->options().GetExtension(Analytics::rediskeytype);
 
-	std::string keyName = msg.GetDescriptor()->name();
-	if (msg.GetDescriptor()->options().HasExtension(Analytics::rediskeysuffix))
+	if (encoder != NULL)
+	{
+		std::string suffix;
+		if (encoder->mKeySuffix != NULL && encoder->mKeySuffix(msg, suffix))
+			keySuffix = ":" + suffix;
+	}
+	else if (msg.GetDescriptor()->options().HasExtension(Analytics::rediskeysuffix))
 	{
 		std::string suffix = msg.GetDescriptor()->options().GetExtension(Analytics::rediskeysuffix);
 
@@ -582,9 +1113,203 @@ void GameAnalytics::AddEvent(const google::protobuf::Message& msg)
 			}
 		}
 
-		keyName += ":" + suffix;
+		keySuffix = ":" + suffix;
+	}
+
+	if (redisKeyType == Analytics::HMSET)
+	{
+		hashKey = msg.GetTypeName();
+
+		if (encoder != NULL && encoder->mHashKey != NULL)
+		{
+			encoder->mHashKey(msg, hashKey);
+		}
+		else if (msg.GetDescriptor()->options().HasExtension(Analytics::redishmsetkey))
+		{
+			hashKey = msg.GetDescriptor()->options().GetExtension(Analytics::redishmsetkey);
+
+			const google::protobuf::FieldDescriptor* fdesc = msg.GetDescriptor()->FindFieldByCamelcaseName(hashKey);
+			if (fdesc != NULL && !fdesc->is_repeated())
+			{
+				std::string fieldString;
+				if (StringFromField(fieldString, msg, fdesc))
+				{
+					hashKey = fieldString;
+				}
+			}
+		}
+	}
+
+	return redisKeyType;
+}
+
+void GameAnalytics::AddEvent(const google::protobuf::Message& msg)
+{
+	const int64_t timeStamp = GetSessionTime();
+
+	++mCatalogEntry.mEventCount;
+
+	// the database keeps every event, the filtering below only applies to what goes over the wire
+	mEventSink.AddEvent(msg, timeStamp);
+
+	for (size_t i = 0; i < mLiveHeatmaps.size(); ++i)
+	{
+		if (mLiveHeatmaps[i]->GetEventType() == msg.GetDescriptor())
+			mLiveHeatmaps[i]->AddEvent(msg, timeStamp);
+	}
+
+	if (mSketching)
+	{
+		mSketches.AddEvent(msg);
+		mSketchesChanged = true;
+	}
+
+	// keyed by type name like redis would key it without compact keys, so recordings don't depend on the type ids of a session
+	if (mRecording.IsOpen())
+	{
+		std::string keySuffix, hashKey;
+		const Analytics::RedisKeyType keyType = GetEventKeyParts(msg, Analytics::FindEventEncoder(msg.GetDescriptor()), keySuffix, hashKey);
+		mRecording.AddEvent(timeStamp, msg, keyType, msg.GetDescriptor()->name() + keySuffix, hashKey);
+	}
+
+	if (mClient == nullptr)
+		return;
+
+	// every event counts, before the tolerance filters drop any
+	mRollup.AddEvent(msg, timeStamp);
+
+	if (msg.GetDescriptor() == Analytics::GameInfo::descriptor())
+		CatalogGameInfo(static_cast<const Analytics::GameInfo&>(msg));
+
+	if (msg.GetDescriptor() == Analytics::GameEntityPosition::descriptor())
+	{
+		AddEntityPosition(static_cast<const Analytics::GameEntityPosition&>(msg));
+		return;
+	}
+
+	if (msg.GetDescriptor() == Analytics::GameEntityInfo::descriptor())
+	{
+		if (!FilterEntityInfo(static_cast<const Analytics::GameEntityInfo&>(msg)))
+			return;
+	}
+
+	SendEvent(msg);
+}
+
+void GameAnalytics::AddEntityPosition(const Analytics::GameEntityPosition& msg)
+{
+	const int64_t timeStamp = GetSessionTime();
+
+	Analytics::GameEntityPosition sample(msg);
+	if (mPositionFilter.GetTolerance() > 0.0f)
+	{
+		// trajectory chunks don't carry velocity, so readers of those hold the last position
+		if (!mPositionFilter.Filter(sample.entityindex(), (uint64_t)sample.team(), timeStamp, sample.position(), !mTrajectoryMode, sample.mutable_velocity()))
+			return;
+
+		sample.set_timestamp(timeStamp);
+	}
+
+	if (mTrajectoryMode)
+	{
+		Analytics::GameEntityTrajectory chunk;
+		if (mTrajectories.AddSample(sample.entityindex(), sample.team(), timeStamp, sample.position(), chunk))
+			SendEvent(chunk);
+		return;
+	}
+
+	SendEvent(sample);
+}
+
+bool GameAnalytics::FilterEntityInfo(const Analytics::GameEntityInfo& msg)
+{
+	if (mEntityInfoFilter.GetTolerance() <= 0.0f)
+		return true;
+
+	if (msg.deleted())
+	{
+		mEntityInfoFilter.Remove(msg.entityindex());
+		return true;
+	}
+
+	// any change besides the position is always sent
+	Analytics::GameEntityInfo state(msg);
+	state.clear_position();
+	const uint64_t stateHash = std::hash<std::string>()(state.SerializeAsString());
+
+	// entity info is a HMSET snapshot with no velocity, so readers hold the last position
+	return mEntityInfoFilter.Filter(msg.entityindex(), stateHash, GetSessionTime(), msg.position(), false, NULL);
+}
+
+void GameAnalytics::SetPositionTolerance(float tolerance)
+{
+	mPositionFilter.SetTolerance(tolerance);
+	mEntityInfoFilter.SetTolerance(tolerance);
+}
+
+void GameAnalytics::MarkDiscontinuity(int entityIndex)
+{
+	mPositionFilter.MarkDiscontinuity(entityIndex);
+	mEntityInfoFilter.MarkDiscontinuity(entityIndex);
+}
+
+void GameAnalytics::SendEvent(const google::protobuf::Message& msg)
+{
+	// the map bounds are the reference frame for quantized positions
+	if (msg.GetDescriptor() == Analytics::GameInfo::descriptor())
+	{
+		const Analytics::GameInfo& info = static_cast<const Analytics::GameInfo&>(msg);
+		if (info.has_worldmins() && info.has_worldmaxs())
+			mSendQuantizer.SetBounds(info.worldmins(), info.worldmaxs());
+	}
+
+	const google::protobuf::Message* encodeMsg = &msg;
+
+	const bool quantize = mSendQuantizer.HasBounds() && mSendQuantizer.HasQuantizedFields(msg.GetDescriptor());
+	const bool intern = mStringInterning && mSendStrings.HasInternedFields(msg.GetDescriptor());
+
+	std::unique_ptr<google::protobuf::Message> encodedMsg;
+	if (quantize || intern)
+	{
+		encodedMsg.reset(msg.New());
+		encodedMsg->CopyFrom(msg);
+		encodeMsg = encodedMsg.get();
+
+		if (quantize)
+			mSendQuantizer.QuantizeMessage(*encodedMsg);
+
+		if (intern)
+		{
+			// new strings go out ahead of the first event that refers to them
+			std::vector<Analytics::GameString> newStrings;
+			mSendStrings.InternMessage(*encodedMsg, newStrings);
+			for (size_t i = 0; i < newStrings.size(); ++i)
+				SendEvent(newStrings[i]);
+		}
+	}
+
+	std::string payload;
+
+	// the generated encoders skip reflection, anything they don't cover takes the reflection path
+	const EventEncoder* encoder = Analytics::FindEventEncoder(msg.GetDescriptor());
+	if (encoder != NULL && encoder->mEncode != NULL)
+	{
+		encoder->mEncode(*encodeMsg, payload);
+	}
+	else if (msg.GetDescriptor()->options().HasExtension(Analytics::useJsonEncoding))
+	{
+		google::protobuf::util::MessageToJsonString(*encodeMsg, &payload);
+	}
+	else
+	{
+		payload = encodeMsg->SerializeAsString();
 	}
 
+	std::string keySuffix, setKey;
+	const Analytics::RedisKeyType redisKeyType = GetEventKeyParts(msg, encoder, keySuffix, setKey);
+
+	const std::string keyName = (mCompactKeys ? GetTypeKey(msg.GetDescriptor()) : msg.GetDescriptor()->name()) + keySuffix;
+
 	const std::string eventKey = vaAnalytics("%s:%s", mKeySpacePrefix.c_str(), keyName.c_str()).c_str();
 
 	switch (redisKeyType)
@@ -608,23 +1333,6 @@ void GameAnalytics::AddEvent(const google::protobuf::Message& msg)
 	}
 	case Analytics::HMSET:
 	{
-		std::string setKey = msg.GetTypeName();
-
-		if (msg.GetDescriptor()->options().HasExtension(Analytics::redishmsetkey))
-		{
-			setKey = msg.GetDescriptor()->options().GetExtension(Analytics::redishmsetkey);
-
-			const google::protobuf::FieldDescriptor* fdesc = msg.GetDescriptor()->FindFieldByCamelcaseName(setKey);
-			if (fdesc != NULL && !fdesc->is_repeated())
-			{
-				std::string fieldString;
-				if (StringFromField(fieldString, msg, fdesc))
-				{
-					setKey = fieldString;
-				}
-			}
-		}
-
 		std::vector<std::string> keys, args;
 		keys.push_back(eventKey);
 		args.push_back(setKey);
@@ -637,14 +1345,618 @@ void GameAnalytics::AddEvent(const google::protobuf::Message& msg)
 
 //////////////////////////////////////////////////////////////////////////
 
+bool GameAnalytics::ParseEvent(const std::string& payload, google::protobuf::Message& msg)
+{
+	if (msg.GetDescriptor()->options().HasExtension(Analytics::useJsonEncoding))
+	{
+		if (!google::protobuf::util::JsonStringToMessage(payload, &msg).ok())
+			return false;
+	}
+	else if (!msg.ParseFromString(payload))
+	{
+		return false;
+	}
+
+	if (msg.GetDescriptor() == Analytics::GameInfo::descriptor())
+	{
+		const Analytics::GameInfo& info = static_cast<const Analytics::GameInfo&>(msg);
+		if (info.has_worldmins() && info.has_worldmaxs())
+			mParseQuantizer.SetBounds(info.worldmins(), info.worldmaxs());
+	}
+
+	mParseQuantizer.DequantizeMessage(msg);
+
+	if (msg.GetDescriptor() == Analytics::GameString::descriptor())
+	{
+		const Analytics::GameString& str = static_cast<const Analytics::GameString&>(msg);
+		mParseStrings.Insert(str.id(), str.value());
+	}
+	else if (mParseStrings.HasInternedFields(msg.GetDescriptor()))
+	{
+		std::vector<uint32_t> missingIds;
+		if (!mParseStrings.ResolveMessage(msg, &missingIds) && FetchStrings(missingIds))
+			mParseStrings.ResolveMessage(msg);
+	}
+	return true;
+}
+
+bool GameAnalytics::FetchStrings(const std::vector<uint32_t>& ids)
+{
+	std::string stringsKey;
+	if (mClient == nullptr || !GetParseTypeKey(Analytics::GameString::descriptor(), stringsKey))
+		return false;
+
+	std::vector<std::string> fields;
+	for (size_t i = 0; i < ids.size(); ++i)
+		fields.push_back(std::to_string(ids[i]));
+
+	std::future<cpp_redis::reply> f = mClient->hmget(stringsKey, fields);
+	mClient->sync_commit();
+
+	const cpp_redis::reply r = f.get();
+	if (!r.is_array())
+		return false;
+
+	bool found = false;
+	const std::vector<cpp_redis::reply>& values = r.as_array();
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		Analytics::GameString str;
+		if (values[i].is_string() && str.ParseFromString(values[i].as_string()))
+		{
+			mParseStrings.Insert(str.id(), str.value());
+			found = true;
+		}
+	}
+	return found;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void GameAnalytics::EndOfFrame()
 {
+	mEventSink.EndOfFrame();
+
+	std::vector<std::string> errors;
+	mEventSink.GetErrors(errors);
+	for (size_t i = 0; i < errors.size(); ++i)
+		ReportError(errors[i].c_str());
+
 	if (mClient != nullptr)
 	{
+		if (mLiveHeatmapInterval > 0 && GetSessionTime() - mLiveHeatmapPublished >= mLiveHeatmapInterval)
+			PublishLiveHeatmaps();
+
+		if (mRollupFlushInterval > 0 && mRollup.HasPending() && GetSessionTime() - mRollupFlushed >= mRollupFlushInterval)
+			FlushRollups();
+
+		if (mSketchInterval > 0 && mSketchesChanged && GetSessionTime() - mSketchStored >= mSketchInterval)
+			StoreSketches();
+
+		if (GetSessionTime() - mCatalogUpdated >= CatalogUpdateInterval)
+			UpdateSessionCatalog();
+
 		mClient->commit();
 	}
 }
 
+LiveHeatmap* GameAnalytics::AddLiveHeatmap(const google::protobuf::Descriptor* eventType, const float worldMins[2], const float worldMaxs[2], int resolution)
+{
+	const PointEventAccessor* accessor = PointEventAccessor::Find(eventType);
+	if (accessor == NULL)
+	{
+		ReportError(vaAnalytics("AddLiveHeatmap: %s has no usable (point_event) field", eventType->full_name().c_str()));
+		return NULL;
+	}
+
+	mLiveHeatmaps.push_back(std::unique_ptr<LiveHeatmap>(new LiveHeatmap(*accessor, worldMins, worldMaxs, resolution)));
+	return mLiveHeatmaps.back().get();
+}
+
+void GameAnalytics::SetLiveHeatmapPublishing(int64_t interval)
+{
+	mLiveHeatmapInterval = interval;
+}
+
+void GameAnalytics::PublishLiveHeatmaps()
+{
+	mLiveHeatmapPublished = GetSessionTime();
+
+	const std::string channel = mKeySpacePrefix + ":" + Analytics::LiveHeatmap::descriptor()->name();
+
+	std::vector<std::string> keys;
+	for (size_t i = 0; i < mLiveHeatmaps.size(); ++i)
+	{
+		keys.clear();
+		mLiveHeatmaps[i]->GetKeys(keys);
+
+		for (size_t k = 0; k < keys.size(); ++k)
+		{
+			Analytics::LiveHeatmap snapshot;
+			if (mLiveHeatmaps[i]->GetSnapshot(keys[k], mLiveHeatmapPublished, snapshot))
+				mClient->publish(channel, snapshot.SerializeAsString());
+		}
+	}
+}
+
+void GameAnalytics::SetTrajectoryMode(bool enable, int samplesPerChunk, float precision)
+{
+	if (mTrajectoryMode && !enable)
+		FlushTrajectories();
+
+	mTrajectoryMode = enable;
+	mTrajectories.SetChunkSize(samplesPerChunk);
+	mTrajectories.SetPrecision(precision);
+}
+
+void GameAnalytics::FlushTrajectories()
+{
+	std::vector<Analytics::GameEntityTrajectory> chunks;
+	mTrajectories.FlushAll(chunks);
+
+	for (size_t i = 0; i < chunks.size(); ++i)
+		SendEvent(chunks[i]);
+}
+
+void GameAnalytics::SetStringInterning(bool enable)
+{
+	mStringInterning = enable;
+}
+
+bool GameAnalytics::LoadStringTable(const std::string& keySpacePrefix)
+{
+	mParseStrings.Clear();
+	mParseQuantizer.ClearBounds();
+
+	if (keySpacePrefix != mKeySpacePrefix && !LoadTypeRegistry(keySpacePrefix))
+		return false;
+
+	mParseSessionPrefix = keySpacePrefix;
+
+	std::string stringsKey;
+	if (mClient == nullptr || !GetParseTypeKey(Analytics::GameString::descriptor(), stringsKey))
+		return false;
+
+	std::future<cpp_redis::reply> f = mClient->hgetall(stringsKey);
+	mClient->sync_commit();
+
+	const cpp_redis::reply r = f.get();
+	if (!r.is_array())
+	{
+		ReportError(vaAnalytics("LoadStringTable: %s", r.is_error() ? r.error().c_str() : "unexpected reply"));
+		return false;
+	}
+
+	// field/value pairs, the values are serialized GameStrings
+	const std::vector<cpp_redis::reply>& values = r.as_array();
+	for (size_t i = 1; i < values.size(); i += 2)
+	{
+		Analytics::GameString str;
+		if (values[i].is_string() && str.ParseFromString(values[i].as_string()))
+			mParseStrings.Insert(str.id(), str.value());
+	}
+	return true;
+}
+
+void GameAnalytics::SetCompactKeys(bool enable)
+{
+	mCompactKeys = enable;
+}
+
+bool GameAnalytics::LoadTypeRegistry(const std::string& keySpacePrefix)
+{
+	mParseTypes.Clear();
+	mParseSessionPrefix = keySpacePrefix;
+
+	if (mClient == nullptr)
+		return false;
+
+	std::future<cpp_redis::reply> f = mClient->hgetall(keySpacePrefix + ":types");
+	mClient->sync_commit();
+
+	const cpp_redis::reply r = f.get();
+	if (!r.is_array())
+	{
+		ReportError(vaAnalytics("LoadTypeRegistry: %s", r.is_error() ? r.error().c_str() : "unexpected reply"));
+		return false;
+	}
+
+	// id/type name pairs, an empty registry means the session uses named keys
+	const std::vector<cpp_redis::reply>& values = r.as_array();
+	for (size_t i = 0; i + 1 < values.size(); i += 2)
+	{
+		if (!values[i].is_string() || !values[i + 1].is_string())
+			continue;
+
+		const uint32_t typeId = (uint32_t)strtoul(values[i].as_string().c_str(), NULL, 10);
+		if (!mParseTypes.Insert(typeId, values[i + 1].as_string()))
+			ReportWarning(vaAnalytics("LoadTypeRegistry: unknown type %s", values[i + 1].as_string().c_str()));
+	}
+	return true;
+}
+
+const google::protobuf::Descriptor* GameAnalytics::FindSessionType(uint32_t typeId) const
+{
+	return mParseSessionPrefix == mKeySpacePrefix ? mSendTypes.Find(typeId) : mParseTypes.Find(typeId);
+}
+
+std::string GameAnalytics::GetTypeKey(const google::protobuf::Descriptor* desc)
+{
+	bool isNew = false;
+	const uint32_t typeId = mSendTypes.Register(desc, isNew);
+	if (isNew)
+	{
+		// published through the hash script so live readers see new types as they appear
+		std::vector<std::string> keys, args;
+		keys.push_back(mKeySpacePrefix + ":types");
+		args.push_back(std::to_string(typeId));
+		args.push_back(desc->full_name());
+		mClient->evalsha(mScriptSHA_HMSET, 1, keys, args);
+	}
+	return SessionTypeRegistry::TypeKey(typeId);
+}
+
+bool GameAnalytics::GetParseTypeKey(const google::protobuf::Descriptor* desc, std::string& keyOut) const
+{
+	if (mParseSessionPrefix.empty())
+		return false;
+
+	const bool ownSession = mParseSessionPrefix == mKeySpacePrefix;
+	const SessionTypeRegistry& types = ownSession ? mSendTypes : mParseTypes;
+
+	if (ownSession ? mCompactKeys : !types.Empty())
+	{
+		const uint32_t typeId = types.FindId(desc);
+		if (typeId == 0)
+			return false;
+		keyOut = mParseSessionPrefix + ":" + SessionTypeRegistry::TypeKey(typeId);
+	}
+	else
+	{
+		keyOut = mParseSessionPrefix + ":" + desc->name();
+	}
+	return true;
+}
+
+void GameAnalytics::SetRollupBucketSize(int64_t bucketSize, int64_t flushInterval)
+{
+	// what was counted in the old buckets goes out first
+	if (mClient != nullptr)
+		FlushRollups();
+
+	mRollup.SetBucketSize(bucketSize);
+	mRollupFlushInterval = flushInterval;
+}
+
+std::string GameAnalytics::RollupKey(const std::string& typeKey, int64_t bucketSize, int64_t startTime)
+{
+	return typeKey + ":rollup:" + std::to_string(bucketSize) + ":" + std::to_string(startTime);
+}
+
+void GameAnalytics::FlushRollups()
+{
+	mRollupFlushed = GetSessionTime();
+	if (mClient == nullptr || !mRollup.HasPending())
+		return;
+
+	std::vector<EventRollup::Increment> increments;
+	mRollup.Flush(increments);
+
+	// a script call per bucket, the count of HINCRBY pairs first and the HINCRBYFLOAT pairs after them
+	for (size_t i = 0; i < increments.size(); ++i)
+	{
+		const EventRollup::Increment& inc = increments[i];
+		const std::string typeKey = mKeySpacePrefix + ":" + (mCompactKeys ? GetTypeKey(inc.mType) : inc.mType->name());
+
+		std::vector<std::string> keys, args;
+		keys.push_back(RollupKey(typeKey, mRollup.GetBucketSize(), inc.mStartTime));
+		args.push_back(std::to_string(inc.mCounts.size()));
+		for (size_t c = 0; c < inc.mCounts.size(); ++c)
+		{
+			args.push_back(inc.mCounts[c].first);
+			args.push_back(std::to_string(inc.mCounts[c].second));
+		}
+		for (size_t s = 0; s < inc.mSums.size(); ++s)
+		{
+			args.push_back(inc.mSums[s].first);
+			args.push_back(vaAnalytics("%.17g", inc.mSums[s].second).c_str());
+		}
+		mClient->evalsha(mScriptSHA_ROLLUP, 1, keys, args);
+	}
+}
+
+bool GameAnalytics::ReadRollups(const std::string & keySpacePrefix, const google::protobuf::Descriptor* eventType, int64_t bucketSize, int64_t startTime, int64_t endTime, std::vector<RollupBucket> & buckets)
+{
+	buckets.clear();
+	if (mClient == nullptr || bucketSize <= 0)
+		return false;
+
+	// a session of our own still has counts that haven't gone out
+	if (keySpacePrefix == mKeySpacePrefix)
+		FlushRollups();
+
+	if (keySpacePrefix != mParseSessionPrefix && !LoadStringTable(keySpacePrefix))
+		return false;
+
+	std::string typeKey;
+	if (!GetParseTypeKey(eventType, typeKey))
+		return true;
+
+	const int64_t firstStart = startTime - ((startTime % bucketSize) + bucketSize) % bucketSize;
+	if (endTime < firstStart || (endTime - firstStart) / bucketSize >= 1000000)
+	{
+		ReportError(vaAnalytics("ReadRollups: bad time range %lld to %lld", (long long)startTime, (long long)endTime));
+		return false;
+	}
+
+	std::vector< std::future<cpp_redis::reply> > replies;
+	for (int64_t start = firstStart; start <= endTime; start += bucketSize)
+		replies.push_back(mClient->hgetall(RollupKey(typeKey, bucketSize, start)));
+	mClient->sync_commit();
+
+	std::vector< std::pair<std::string, std::string> > hash;
+	for (size_t i = 0; i < replies.size(); ++i)
+	{
+		const cpp_redis::reply r = replies[i].get();
+		if (!r.is_array())
+		{
+			ReportError(vaAnalytics("ReadRollups: %s", r.is_error() ? r.error().c_str() : "unexpected reply"));
+			return false;
+		}
+
+		const std::vector<cpp_redis::reply>& values = r.as_array();
+		if (values.empty())
+			continue;
+
+		hash.clear();
+		for (size_t v = 0; v + 1 < values.size(); v += 2)
+		{
+			if (values[v].is_string() && values[v + 1].is_string())
+				hash.push_back(std::make_pair(values[v].as_string(), values[v + 1].as_string()));
+		}
+
+		RollupBucket bucket;
+		bucket.mStartTime = firstStart + (int64_t)i * bucketSize;
+		EventRollup::ParseBucket(hash, bucket);
+		buckets.push_back(bucket);
+	}
+	return true;
+}
+
+void GameAnalytics::SetSketches(bool enable, int64_t storeInterval)
+{
+	mSketching = enable;
+	mSketchInterval = storeInterval;
+}
+
+void GameAnalytics::StoreSketches()
+{
+	mSketchStored = GetSessionTime();
+	if (mClient == nullptr || mSketches.Empty())
+		return;
+
+	// the sketches of a session only grow, each store replaces the last
+	std::vector< std::pair<std::string, std::string> > fields;
+	mSketches.Serialize(fields);
+	mClient->hmset(mKeySpacePrefix + ":sketches", fields);
+	mSketchesChanged = false;
+}
+
+bool GameAnalytics::ReadSketches(const std::string & keySpacePrefix, EventSketches & sketches)
+{
+	if (mClient == nullptr)
+		return false;
+
+	std::future<cpp_redis::reply> f = mClient->hgetall(keySpacePrefix + ":sketches");
+	mClient->sync_commit();
+
+	const cpp_redis::reply r = f.get();
+	if (!r.is_array())
+	{
+		ReportError(vaAnalytics("ReadSketches: %s", r.is_error() ? r.error().c_str() : "unexpected reply"));
+		return false;
+	}
+
+	const std::vector<cpp_redis::reply>& values = r.as_array();
+	for (size_t i = 0; i + 1 < values.size(); i += 2)
+	{
+		if (!values[i].is_string() || !values[i + 1].is_string())
+			continue;
+
+		if (!sketches.MergeSerialized(values[i].as_string(), values[i + 1].as_string()))
+			ReportWarning(vaAnalytics("ReadSketches: can't merge %s of %s", values[i].as_string().c_str(), keySpacePrefix.c_str()));
+	}
+	return true;
+}
+
+void GameAnalytics::StartSessionCatalog()
+{
+	mCatalogEntry = SessionCatalogEntry();
+	mCatalogEntry.mSession = mKeySpacePrefix;
+	mCatalogEntry.mStartTime = UnixMilliseconds();
+
+	// the GameInfo indexes the rest once it is sent
+	IndexSession(SessionCatalog::StartKey());
+	UpdateSessionCatalog();
+}
+
+void GameAnalytics::CatalogGameInfo(const Analytics::GameInfo& info)
+{
+	mCatalogEntry.mMapName = info.mapname();
+	mCatalogEntry.mGameName = info.gamename();
+	mCatalogEntry.mGameVersion = info.gameversion();
+
+	if (!info.mapname().empty())
+		IndexSession(SessionCatalog::MapKey(info.mapname()));
+	if (!info.gamename().empty())
+		IndexSession(SessionCatalog::GameKey(info.gamename()));
+	if (!info.gameversion().empty())
+		IndexSession(SessionCatalog::VersionKey(info.gameversion()));
+
+	UpdateSessionCatalog();
+}
+
+void GameAnalytics::UpdateSessionCatalog()
+{
+	mCatalogUpdated = GetSessionTime();
+	if (mClient == nullptr || mCatalogEntry.mSession.empty())
+		return;
+
+	mCatalogEntry.mDuration = GetSessionTime();
+
+	std::vector< std::pair<std::string, std::string> > fields;
+	SessionCatalog::ToFields(mCatalogEntry, fields);
+	mClient->hmset(SessionCatalog::EntryKey(mCatalogEntry.mSession), fields);
+}
+
+void GameAnalytics::IndexSession(const std::string& indexKey)
+{
+	std::multimap<std::string, std::string> members;
+	members.insert(std::make_pair(std::to_string(mCatalogEntry.mStartTime), mCatalogEntry.mSession));
+	mClient->zadd(indexKey, std::vector<std::string>(), members);
+}
+
+bool GameAnalytics::ReadSessionCatalog(const std::string & keySpacePrefix, SessionCatalogEntry & entry)
+{
+	entry = SessionCatalogEntry();
+	entry.mSession = keySpacePrefix;
+
+	if (mClient == nullptr)
+		return false;
+
+	std::future<cpp_redis::reply> f = mClient->hgetall(SessionCatalog::EntryKey(keySpacePrefix));
+	mClient->sync_commit();
+
+	const cpp_redis::reply r = f.get();
+	if (!r.is_array())
+	{
+		ReportError(vaAnalytics("ReadSessionCatalog: %s", r.is_error() ? r.error().c_str() : "unexpected reply"));
+		return false;
+	}
+
+	std::vector< std::pair<std::string, std::string> > fields;
+	const std::vector<cpp_redis::reply>& values = r.as_array();
+	for (size_t i = 0; i + 1 < values.size(); i += 2)
+	{
+		if (values[i].is_string() && values[i + 1].is_string())
+			fields.push_back(std::make_pair(values[i].as_string(), values[i + 1].as_string()));
+	}
+
+	SessionCatalog::FromFields(fields, entry);
+	return !fields.empty();
+}
+
+bool GameAnalytics::FindSessions(const SessionCatalogQuery & query, std::vector<SessionCatalogEntry> & sessions)
+{
+	sessions.clear();
+	if (mClient == nullptr)
+		return false;
+
+	const std::string indexKey = SessionCatalog::SelectIndex(query);
+	const std::string minScore = SessionCatalog::MinScore(query);
+	const std::string maxScore = SessionCatalog::MaxScore(query);
+	const bool filter = SessionCatalog::NeedsFilter(query);
+
+	// a limited range is read a page at a time, larger ones when the entries filter some of it out
+	const size_t pageSize = query.mLimit == 0 ? 0 : filter ? std::max<size_t>(query.mLimit * 2, 256) : query.mLimit;
+
+	for (size_t offset = 0;; offset += pageSize)
+	{
+		std::future<cpp_redis::reply> range;
+		if (pageSize == 0)
+		{
+			range = query.mNewestFirst ? mClient->zrevrangebyscore(indexKey, maxScore, minScore) : mClient->zrangebyscore(indexKey, minScore, maxScore);
+		}
+		else
+		{
+			range = query.mNewestFirst ? mClient->zrevrangebyscore(indexKey, maxScore, minScore, offset, pageSize) :
+				mClient->zrangebyscore(indexKey, minScore, maxScore, offset, pageSize);
+		}
+		mClient->sync_commit();
+
+		const cpp_redis::reply r = range.get();
+		if (!r.is_array())
+		{
+			ReportError(vaAnalytics("FindSessions: %s", r.is_error() ? r.error().c_str() : "unexpected reply"));
+			return false;
+		}
+
+		const std::vector<cpp_redis::reply>& members = r.as_array();
+
+		// the entries of the page in one round trip
+		std::vector<std::string> names;
+		std::vector< std::future<cpp_redis::reply> > entries;
+		for (size_t i = 0; i < members.size(); ++i)
+		{
+			if (!members[i].is_string())
+				continue;
+
+			names.push_back(members[i].as_string());
+			entries.push_back(mClient->hgetall(SessionCatalog::EntryKey(names.back())));
+		}
+		mClient->sync_commit();
+
+		for (size_t i = 0; i < entries.size(); ++i)
+		{
+			const cpp_redis::reply e = entries[i].get();
+			if (!e.is_array() || e.as_array().empty())
+				continue;
+
+			std::vector< std::pair<std::string, std::string> > fields;
+			const std::vector<cpp_redis::reply>& values = e.as_array();
+			for (size_t v = 0; v + 1 < values.size(); v += 2)
+			{
+				if (values[v].is_string() && values[v + 1].is_string())
+					fields.push_back(std::make_pair(values[v].as_string(), values[v + 1].as_string()));
+			}
+
+			SessionCatalogEntry entry;
+			entry.mSession = names[i];
+			SessionCatalog::FromFields(fields, entry);
+			if (filter && !SessionCatalog::Matches(query, entry))
+				continue;
+
+			sessions.push_back(entry);
+			if (query.mLimit > 0 && sessions.size() >= query.mLimit)
+				return true;
+		}
+
+		if (pageSize == 0 || members.size() < pageSize)
+			break;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+bool GameAnalytics::OpenRecording(const std::string & filename, int64_t keyframeInterval)
+{
+	std::string error;
+	if (!mRecording.Open(filename, mKeySpacePrefix, keyframeInterval, SessionRecordingWriter::DefaultBlockSize, error))
+	{
+		ReportError(error.c_str());
+		return false;
+	}
+	return true;
+}
+
+void GameAnalytics::CloseRecording()
+{
+	if (!mRecording.IsOpen())
+		return;
+
+	std::string error;
+	if (!mRecording.Close(error))
+		ReportError(error.c_str());
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+int64_t GameAnalytics::GetSessionTime() const
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - mSessionStart).count();
+}
+
 bool GameAnalytics::AnyFieldSet(const google::protobuf::Message & msg)
 {
 	using namespace google;
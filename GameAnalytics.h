@@ -9,6 +9,8 @@
 #include <thread>
 #include <mutex>
 #include <queue>
+#include <chrono>
+#include <memory>
 
 //#include "json\json.h"
 
@@ -16,6 +18,24 @@
 #include "google/protobuf/text_format.h"
 #include "google/protobuf/util/json_util.h"
 
+#include "GameAnalytics_quantize.h"
+#include "GameAnalytics_trajectory.h"
+#include "GameAnalytics_deadreckoning.h"
+#include "GameAnalytics_strings.h"
+#include "GameAnalytics_types.h"
+#include "GameAnalytics_sqlite.h"
+#include "GameAnalytics_heatmap.h"
+#include "GameAnalytics_liveheatmap.h"
+#include "GameAnalytics_tiles.h"
+#include "GameAnalytics_voxels.h"
+#include "GameAnalytics_meshheatmap.h"
+#include "GameAnalytics_columns.h"
+#include "GameAnalytics_query.h"
+#include "GameAnalytics_rollup.h"
+#include "GameAnalytics_sketch.h"
+#include "GameAnalytics_catalog.h"
+#include "GameAnalytics_recording.h"
+
 namespace cpp_redis
 {
 	class client;
@@ -58,15 +78,50 @@ public:
 
 	void AddEvent(const google::protobuf::Message & msg);
 
+	// decodes a payload produced by AddEvent, undoing any session specific encoding
+	bool ParseEvent(const std::string& payload, google::protobuf::Message & msg);
+
 	void SendMesh(const std::string& modelName, const Analytics::Mesh& message);
 	void SendGameEnum(const google::protobuf::EnumDescriptor* descriptor);
 
+	// commits the events of the frame to the database and hands the redis commands to the client
 	void EndOfFrame();
 
+	// buffer GameEntityPosition samples per entity and send them as compact GameEntityTrajectory chunks
+	void SetTrajectoryMode(bool enable, int samplesPerChunk = 64, float precision = 0.0625f);
+	void FlushTrajectories();
+
+	// only send entity positions that deviate from the dead reckoned path by more than this, 0 disables
+	void SetPositionTolerance(float tolerance);
+	// always send the next position of this entity, for deaths, teleports, respawns
+	void MarkDiscontinuity(int entityIndex);
+
+	// send (intern) tagged string fields as session ids, each string is sent once as a GameString
+	void SetStringInterning(bool enable);
+	// load the string table of a session so ParseEvent can resolve interned ids, for late joining readers
+	bool LoadStringTable(const std::string& keySpacePrefix);
+
+	// key sessions and types by small integers, s:{session}:t:{type}, instead of by name. set before OpenRedisConnection
+	void SetCompactKeys(bool enable);
+	// load the type ids of a compact keyed session, for readers mapping keys back to message types
+	bool LoadTypeRegistry(const std::string& keySpacePrefix);
+	const google::protobuf::Descriptor* FindSessionType(uint32_t typeId) const;
+
+	// milliseconds since the session started
+	int64_t GetSessionTime() const;
+
 	bool OpenDatabase(const char * filename);
 	bool CreateDatabase(const char * filename);
 	void CloseDatabase();
 
+	// events of the database in a box and time range, through the R*Tree of the point_event field
+	bool QueryRegion(const RegionQuery& query, RegionQueryCallback callback);
+
+	// writes every event type of the database to <directory>/<TypeName>.gac in time order, see ColumnarWriter,
+	// its bitmap index, see BuildColumnIndex, and the GameEnum names to <directory>/enums.txt for ColumnQueryEngine.
+	// the directory has to exist
+	bool ExportColumnArchive(const std::string & directory, uint32_t blockRows = ColumnarWriter::DefaultBlockRows);
+
 	bool OpenRedisConnection(const char *ipAddress = "127.0.0.1", int port = 6379);
 
 	struct HeatmapDef
@@ -75,11 +130,73 @@ public:
 		const char *	mEventId;
 		float			mEventRadius;
 		int				mImageSize;
-		float			mWorldMins[2];
-		float			mWorldMaxs[2];
+		// z bounds the floors that go into 2D heatmaps, unbounded by default
+		float			mWorldMins[3];
+		float			mWorldMaxs[3];
+		// the (line_event) field of the event instead of the (point_event) one
+		bool			mLines;
+
+		HeatmapDef();
 	};
-	void WriteHeatmapScript(const HeatmapDef & def, std::string & scriptContents);
+	// feeds the (point_event) or (line_event) events of def.mEventId into the rasterizer, weighted and sized by their annotation.
+	// a positive def.mEventRadius overrides the annotated radius
+	bool AddHeatmapEvents(const HeatmapDef & def, HeatmapPointSink & heatmap);
+	bool AddSessionHeatmapEvents(const std::string & keySpacePrefix, const HeatmapDef & def, HeatmapPointSink & heatmap);
+
+	// rasterizes the events of def.mEventId from the database or a redis session into a png, or raw floats for a .raw filename.
+	// NULL writes heatmap_<area>_<event>.png
+	bool WriteHeatmap(const HeatmapDef & def, const char * filename = NULL);
+	bool WriteSessionHeatmap(const std::string & keySpacePrefix, const HeatmapDef & def, const char * filename = NULL);
+
+	// accumulates the (point_event) events of def.mEventId inside the 3D bounds of def into the voxel grid and builds it
+	bool AddVoxelHeatmapEvents(const HeatmapDef & def, HeatmapVoxelGrid & grid);
+	bool AddSessionVoxelHeatmapEvents(const std::string & keySpacePrefix, const HeatmapDef & def, HeatmapVoxelGrid & grid);
+
+	// paints the (point_event) events of def.mEventId inside the 3D bounds of def onto the nearest triangles of the mesh and builds it
+	bool AddMeshHeatmapEvents(const HeatmapDef & def, MeshHeatmap & mesh);
+	bool AddSessionMeshHeatmapEvents(const std::string & keySpacePrefix, const HeatmapDef & def, MeshHeatmap & mesh);
+
+	// the Mesh a session uploaded with SendMesh
+	bool LoadSessionMesh(const std::string & keySpacePrefix, const std::string & modelName, Analytics::Mesh & mesh);
+	// the mesh heatmap of a model, hashed the first time it is asked for and kept for the next heatmaps over it.
+	// NULL when the session has no triangles for the model
+	MeshHeatmap * GetMeshHeatmap(const std::string & keySpacePrefix, const std::string & modelName);
+
+	// renders a tile layer into the pyramid for each of the sessions that is still running or doesn't have one cached yet,
+	// going by the session catalog, and returns the layer keys of all of them, for ReadTile or WriteTilePng over the combined sessions
+	bool UpdateHeatmapTiles(HeatmapTilePyramid & tiles, const HeatmapDef & def, const std::vector<std::string> & keySpacePrefixes, std::vector<std::string> & layerKeys);
+
+	// heatmaps of a (point_event) type updated by AddEvent, NULL if the type has no point field. owned by this object
+	LiveHeatmap* AddLiveHeatmap(const google::protobuf::Descriptor* eventType, const float worldMins[2], const float worldMaxs[2], int resolution = 128);
+	// publish snapshots of every live heatmap grid to the LiveHeatmap channel of the session this often, 0 stops
+	void SetLiveHeatmapPublishing(int64_t interval);
+
+	// count the events of each type per combination of (track_event) values and sum their weight fields in buckets of
+	// this many milliseconds, see EventRollup. the counts go out every flushInterval milliseconds, 0 stops
+	void SetRollupBucketSize(int64_t bucketSize, int64_t flushInterval = 1000);
+	void FlushRollups();
+	// the rollup buckets of a type overlapping a time range of a session, read with one pipelined HGETALL per bucket
+	bool ReadRollups(const std::string & keySpacePrefix, const google::protobuf::Descriptor* eventType, int64_t bucketSize, int64_t startTime, int64_t endTime, std::vector<RollupBucket> & buckets);
+
+	// keep EventSketches of every event AddEvent sees, stored in the <session>:sketches hash this often, 0 only keeps them
+	void SetSketches(bool enable, int64_t storeInterval = 10000);
+	const EventSketches & GetSketches() const { return mSketches; }
+	void StoreSketches();
+	// merges the stored sketches of a session into sketches, call it for each session or server to combine
+	bool ReadSketches(const std::string & keySpacePrefix, EventSketches & sketches);
 
+	// the sessions of the catalog matching the query, see SessionCatalog. the start time, event count and duration of
+	// each session are kept at start, when its GameInfo is sent, every few seconds while it runs and at its end
+	bool FindSessions(const SessionCatalogQuery & query, std::vector<SessionCatalogEntry> & sessions);
+	bool ReadSessionCatalog(const std::string & keySpacePrefix, SessionCatalogEntry & entry);
+
+	// also writes every event AddEvent sees to a seekable recording (.gar), see SessionRecordingWriter, with a keyframe of
+	// the SET and HMSET state this often. works without a redis connection and is closed with the session or CloseRecording
+	bool OpenRecording(const std::string & filename, int64_t keyframeInterval = SessionRecordingWriter::DefaultKeyframeInterval);
+	void CloseRecording();
+
+	// event types in the database with their counts and time ranges, from the catalog kept by the writer
+	void GetEventCatalog(std::vector< EventCatalogEntry > & entries);
 	void GetUniqueEventNames(std::vector< std::string > & eventNames);
 
 	static bool AnyFieldSet(const google::protobuf::Message & msg);
@@ -87,6 +204,7 @@ private:
 	GameAnalyticsCallbacks*		mCallbacks;
 	
 	sqlite3 *					mDatabase;
+	SqliteEventSink				mEventSink;
 	
 	// NEW REDIS
 	cpp_redis::client *		mClient;
@@ -100,10 +218,77 @@ private:
 	std::string				mScriptSHA_SET;
 	std::string				mScriptSHA_RPUSH;
 	std::string				mScriptSHA_HMSET;
+	std::string				mScriptSHA_ROLLUP;
+
+	Vec3Quantizer			mSendQuantizer;
+	Vec3Quantizer			mParseQuantizer;
+
+	bool					mTrajectoryMode;
+	TrajectoryEncoder		mTrajectories;
+
+	DeadReckoningFilter		mPositionFilter;
+	DeadReckoningFilter		mEntityInfoFilter;
+
+	bool					mStringInterning;
+	SessionStringTable		mSendStrings;
+	SessionStringTable		mParseStrings;
+
+	bool					mCompactKeys;
+	SessionTypeRegistry		mSendTypes;
+	SessionTypeRegistry		mParseTypes;
+
+	std::string				mParseSessionPrefix;
+
+	std::vector< std::unique_ptr<LiveHeatmap> > mLiveHeatmaps;
+	int64_t					mLiveHeatmapInterval;
+	int64_t					mLiveHeatmapPublished;
+
+	EventRollup				mRollup;
+	int64_t					mRollupFlushInterval;
+	int64_t					mRollupFlushed;
+
+	bool					mSketching;
+	bool					mSketchesChanged;
+	EventSketches			mSketches;
+	int64_t					mSketchInterval;
+	int64_t					mSketchStored;
+
+	SessionCatalogEntry		mCatalogEntry;
+	int64_t					mCatalogUpdated;
+
+	SessionRecordingWriter	mRecording;
+
+	std::map< std::string, std::unique_ptr<MeshHeatmap> > mMeshHeatmaps;
+
+	std::chrono::steady_clock::time_point mSessionStart;
 
 	GameAnalytics & operator=(const GameAnalytics & other);
+
+	void AddEntityPosition(const Analytics::GameEntityPosition& msg);
+	bool FilterEntityInfo(const Analytics::GameEntityInfo& msg);
+	void SendEvent(const google::protobuf::Message & msg);
+	bool FetchStrings(const std::vector<uint32_t>& ids);
+	void PublishLiveHeatmaps();
+	std::string GetTypeKey(const google::protobuf::Descriptor* desc);
+	static std::string RollupKey(const std::string& typeKey, int64_t bucketSize, int64_t startTime);
+	void StartSessionCatalog();
+	void CatalogGameInfo(const Analytics::GameInfo& info);
+	void UpdateSessionCatalog();
+	void IndexSession(const std::string& indexKey);
+	bool GetParseTypeKey(const google::protobuf::Descriptor* desc, std::string& keyOut) const;
 	
+	// the callbacks are optional, everything reports through these
+	void ReportError(const char * str);
+	void ReportWarning(const char * str);
 	int CheckSqliteError(int errcode);
+	bool OpenEventSink(const char * filename);
+
+	bool FindHeatmapEvent(const HeatmapDef & def, const PointEventAccessor*& points, const LineEventAccessor*& lines);
+	bool WriteHeatmapFile(HeatmapRasterizer & heatmap, const HeatmapDef & def, const char * filename);
+	// parses every event of the type in the list of a session, in order, and per key for a (rediskeysuffix) type
+	bool ForEachSessionEvent(const std::string & keySpacePrefix, const google::protobuf::Descriptor* eventType, const std::function<void(const google::protobuf::Message&)> & fn);
+	// the position, weight and radius of the (point_event) events of def inside its 3D bounds, from the database for an empty prefix
+	bool ForEachHeatmapPoint(const std::string & keySpacePrefix, const HeatmapDef & def, const std::function<void(const float pos[3], float weight, float radius)> & fn);
 };
 
 class vaAnalytics
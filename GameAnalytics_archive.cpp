@@ -0,0 +1,767 @@
+#include "GameAnalytics_archive.h"
+#include "GameAnalytics_catalog.h"
+
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+#include "fastlz.h"
+
+#include <cpp_redis/cpp_redis>
+#include <cpp_redis/core/client.hpp>
+
+//////////////////////////////////////////////////////////////////////////
+
+// 'GASA' and the layout version, at the start of the file and again after the footer offset at its end
+static const uint32_t ArchiveFileMagic = 0x41534147;
+static const uint32_t ArchiveFileVersion = 1;
+
+// FastLZ doesn't expand a block more than about 255 times, a raw size past that is a broken footer
+static const uint64_t ArchiveMaxBlockRatio = 256;
+
+static void AppendString(std::string& buffer, const std::string& str)
+{
+	const uint32_t size = (uint32_t)str.size();
+	buffer.append((const char*)&size, sizeof(size));
+	buffer.append(str);
+}
+
+template<typename T>
+static void AppendPod(std::string& buffer, T value)
+{
+	buffer.append((const char*)&value, sizeof(T));
+}
+
+// bounds checked reads over mapped or decompressed bytes
+struct ArchiveCursor
+{
+	const uint8_t*	mData;
+	uint64_t		mSize;
+	uint64_t		mPos;
+
+	template<typename T>
+	bool Read(T& value)
+	{
+		if (mSize - mPos < sizeof(T))
+			return false;
+		memcpy(&value, mData + mPos, sizeof(T));
+		mPos += sizeof(T);
+		return true;
+	}
+
+	bool ReadString(std::string& str)
+	{
+		uint32_t size = 0;
+		if (!Read(size) || mSize - mPos < size)
+			return false;
+		str.assign((const char*)mData + mPos, size);
+		mPos += size;
+		return true;
+	}
+
+	bool Skip(uint32_t size)
+	{
+		if (mSize - mPos < size)
+			return false;
+		mPos += size;
+		return true;
+	}
+};
+
+std::string SessionArchiveFilename(const std::string& directory, const std::string& session)
+{
+	std::string name = session;
+	std::replace(name.begin(), name.end(), ':', '_');
+	return directory + "/" + name + ".gas";
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SessionArchiveWriter::SessionArchiveWriter(uint32_t blockSize)
+	: mFile(NULL)
+	, mBlockSize(std::max(blockSize, 1024u))
+	, mOffset(0)
+	, mRawSize(0)
+	, mFailed(false)
+	, mRecordStart(std::string::npos)
+	, mRecordKey(0)
+	, mRecordValues(0)
+{
+}
+
+SessionArchiveWriter::~SessionArchiveWriter()
+{
+	if (mFile != NULL)
+		fclose(mFile);
+}
+
+bool SessionArchiveWriter::Write(const void* data, size_t size)
+{
+	if (!mFailed && fwrite(data, 1, size, mFile) != size)
+		mFailed = true;
+	mOffset += size;
+	return !mFailed;
+}
+
+bool SessionArchiveWriter::Open(const std::string& filename, const std::string& session, std::string& error)
+{
+	if (mFile != NULL)
+		fclose(mFile);
+
+	mFile = fopen(filename.c_str(), "wb");
+	if (mFile == NULL)
+	{
+		error = "can't write " + filename;
+		return false;
+	}
+
+	mFilename = filename;
+	mSession = session;
+	mOffset = 0;
+	mRawSize = 0;
+	mFailed = false;
+	mKeys.clear();
+	mKeyIndex.clear();
+	mBlocks.clear();
+	mBlock.clear();
+	mRecordStart = std::string::npos;
+
+	const uint32_t header[2] = { ArchiveFileMagic, ArchiveFileVersion };
+	return Write(header, sizeof(header));
+}
+
+void SessionArchiveWriter::EndRecord()
+{
+	if (mRecordStart == std::string::npos)
+		return;
+
+	// the count goes after the key index at the start of the record
+	memcpy(&mBlock[mRecordStart + sizeof(uint32_t)], &mRecordValues, sizeof(mRecordValues));
+	mRecordStart = std::string::npos;
+}
+
+void SessionArchiveWriter::FlushBlock()
+{
+	EndRecord();
+	if (mBlock.empty())
+		return;
+
+	// fastlz needs 5% and at least 66 bytes of headroom
+	const int size = (int)mBlock.size();
+	mCompressed.resize(size + size / 16 + 66);
+
+	Block block;
+	block.mOffset = mOffset;
+	block.mSize = (uint32_t)fastlz_compress(mBlock.data(), size, &mCompressed[0]);
+	block.mRawSize = (uint32_t)size;
+	mBlocks.push_back(block);
+
+	Write(&mCompressed[0], block.mSize);
+	mRawSize += size;
+	mBlock.clear();
+}
+
+void SessionArchiveWriter::AddValues(const std::string& key, ArchiveKeyType type, const std::vector<std::string>& values)
+{
+	if (mFile == NULL)
+		return;
+
+	std::pair<std::map<std::string, uint32_t>::iterator, bool> it = mKeyIndex.insert(std::make_pair(key, (uint32_t)mKeys.size()));
+	if (it.second)
+	{
+		ArchivedKey archived;
+		archived.mName = key;
+		archived.mType = type;
+		archived.mNumValues = 0;
+		archived.mFirstBlock = (uint32_t)mBlocks.size();
+		archived.mNumBlocks = 0;
+		mKeys.push_back(archived);
+	}
+
+	const uint32_t keyIndex = it.first->second;
+	ArchivedKey& archived = mKeys[keyIndex];
+
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		if (mRecordStart == std::string::npos || mRecordKey != keyIndex)
+		{
+			EndRecord();
+			mRecordStart = mBlock.size();
+			mRecordKey = keyIndex;
+			mRecordValues = 0;
+			AppendPod(mBlock, keyIndex);
+			AppendPod(mBlock, mRecordValues);
+		}
+
+		AppendString(mBlock, values[i]);
+		++mRecordValues;
+		++archived.mNumValues;
+		archived.mNumBlocks = (uint32_t)mBlocks.size() - archived.mFirstBlock + 1;
+
+		if (mBlock.size() >= mBlockSize)
+			FlushBlock();
+	}
+}
+
+bool SessionArchiveWriter::Close(std::string& error)
+{
+	if (mFile == NULL)
+	{
+		error = "no archive open";
+		return false;
+	}
+
+	FlushBlock();
+
+	std::string footer;
+	AppendString(footer, mSession);
+
+	AppendPod(footer, (uint32_t)mBlocks.size());
+	for (size_t b = 0; b < mBlocks.size(); ++b)
+	{
+		AppendPod(footer, mBlocks[b].mOffset);
+		AppendPod(footer, mBlocks[b].mSize);
+		AppendPod(footer, mBlocks[b].mRawSize);
+	}
+
+	AppendPod(footer, (uint32_t)mKeys.size());
+	for (size_t k = 0; k < mKeys.size(); ++k)
+	{
+		AppendString(footer, mKeys[k].mName);
+		AppendPod(footer, (uint32_t)mKeys[k].mType);
+		AppendPod(footer, mKeys[k].mNumValues);
+		AppendPod(footer, mKeys[k].mFirstBlock);
+		AppendPod(footer, mKeys[k].mNumBlocks);
+	}
+
+	const uint64_t footerOffset = mOffset;
+	AppendPod(footer, footerOffset);
+	AppendPod(footer, ArchiveFileMagic);
+	AppendPod(footer, ArchiveFileVersion);
+	Write(footer.data(), footer.size());
+
+	if (fclose(mFile) != 0)
+		mFailed = true;
+	mFile = NULL;
+
+	if (mFailed)
+	{
+		error = "failed to write " + mFilename;
+		return false;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SessionArchiveReader::SessionArchiveReader()
+{
+}
+
+void SessionArchiveReader::Close()
+{
+	mFile.Close();
+	mSession.clear();
+	mBlocks.clear();
+	mKeys.clear();
+	mKeyIndex.clear();
+}
+
+bool SessionArchiveReader::Open(const std::string& filename, std::string& error)
+{
+	Close();
+
+	if (!mFile.Open(filename, error))
+		return false;
+
+	mFilename = filename;
+
+	const uint8_t* data = mFile.GetData();
+	const uint64_t size = mFile.GetSize();
+
+	uint32_t header[2] = {};
+	uint64_t footerOffset = 0;
+	uint32_t trailer[2] = {};
+	if (size >= sizeof(header) + sizeof(footerOffset) + sizeof(trailer))
+	{
+		memcpy(header, data, sizeof(header));
+		memcpy(&footerOffset, data + size - sizeof(trailer) - sizeof(footerOffset), sizeof(footerOffset));
+		memcpy(trailer, data + size - sizeof(trailer), sizeof(trailer));
+	}
+
+	if (header[0] != ArchiveFileMagic || trailer[0] != ArchiveFileMagic || header[1] != ArchiveFileVersion || trailer[1] != ArchiveFileVersion || footerOffset >= size)
+	{
+		error = filename + " is not a session archive of version " + std::to_string(ArchiveFileVersion);
+		Close();
+		return false;
+	}
+
+	ArchiveCursor cursor = { data, size - sizeof(trailer) - sizeof(footerOffset), footerOffset };
+
+	bool ok = cursor.ReadString(mSession);
+
+	uint32_t numBlocks = 0;
+	ok = ok && cursor.Read(numBlocks);
+	for (uint32_t b = 0; ok && b < numBlocks; ++b)
+	{
+		Block block;
+		ok = cursor.Read(block.mOffset) && cursor.Read(block.mSize) && cursor.Read(block.mRawSize) &&
+			block.mOffset <= footerOffset && block.mSize <= footerOffset - block.mOffset && block.mRawSize <= block.mSize * ArchiveMaxBlockRatio;
+		mBlocks.push_back(block);
+	}
+
+	uint32_t numKeys = 0;
+	ok = ok && cursor.Read(numKeys);
+	for (uint32_t k = 0; ok && k < numKeys; ++k)
+	{
+		ArchivedKey key;
+		uint32_t type = 0;
+		ok = cursor.ReadString(key.mName) && cursor.Read(type) && cursor.Read(key.mNumValues) && cursor.Read(key.mFirstBlock) && cursor.Read(key.mNumBlocks) &&
+			type <= ArchiveKey_SortedSet && key.mFirstBlock <= numBlocks && key.mNumBlocks <= numBlocks - key.mFirstBlock;
+		if (!ok)
+			break;
+
+		// every value takes at least its size in the blocks of the key, which bounds what ReadKey reserves
+		uint64_t rawSize = 0;
+		for (uint32_t b = key.mFirstBlock; b < key.mFirstBlock + key.mNumBlocks; ++b)
+			rawSize += mBlocks[b].mRawSize;
+		ok = key.mNumValues <= rawSize / sizeof(uint32_t);
+
+		key.mType = (ArchiveKeyType)type;
+		mKeyIndex[key.mName] = mKeys.size();
+		mKeys.push_back(key);
+	}
+
+	if (!ok)
+	{
+		error = filename + " has a broken footer";
+		Close();
+		return false;
+	}
+	return true;
+}
+
+const ArchivedKey* SessionArchiveReader::FindKey(const std::string& name) const
+{
+	std::map<std::string, size_t>::const_iterator it = mKeyIndex.find(name);
+	return it != mKeyIndex.end() ? &mKeys[it->second] : NULL;
+}
+
+template<typename Fn>
+bool SessionArchiveReader::ForEachValue(uint32_t block, std::vector<char>& buffer, std::string& error, Fn fn) const
+{
+	const Block& b = mBlocks[block];
+	buffer.resize(std::max<uint32_t>(b.mRawSize, 1));
+
+	if (fastlz_decompress(mFile.GetData() + b.mOffset, (int)b.mSize, &buffer[0], (int)b.mRawSize) != (int)b.mRawSize)
+	{
+		error = mFilename + ": block " + std::to_string(block) + " doesn't decompress";
+		return false;
+	}
+
+	ArchiveCursor cursor = { (const uint8_t*)&buffer[0], b.mRawSize, 0 };
+	while (cursor.mPos < cursor.mSize)
+	{
+		uint32_t keyIndex = 0, count = 0;
+		if (!cursor.Read(keyIndex) || !cursor.Read(count) || keyIndex >= mKeys.size())
+		{
+			error = mFilename + ": block " + std::to_string(block) + " has a broken record";
+			return false;
+		}
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			uint32_t size = 0;
+			if (!cursor.Read(size) || cursor.mSize - cursor.mPos < size)
+			{
+				error = mFilename + ": block " + std::to_string(block) + " has a broken value";
+				return false;
+			}
+
+			fn(keyIndex, (const char*)cursor.mData + cursor.mPos, size);
+			cursor.Skip(size);
+		}
+	}
+	return true;
+}
+
+bool SessionArchiveReader::ReadKey(const ArchivedKey& key, std::vector<std::string>& values, std::string& error) const
+{
+	values.clear();
+
+	const uint32_t keyIndex = (uint32_t)(&key - &mKeys[0]);
+	if (mKeys.empty() || keyIndex >= mKeys.size())
+	{
+		error = "the key is not from this archive";
+		return false;
+	}
+
+	values.reserve((size_t)key.mNumValues);
+
+	std::vector<char> buffer;
+	for (uint32_t b = key.mFirstBlock; b < key.mFirstBlock + key.mNumBlocks; ++b)
+	{
+		const bool ok = ForEachValue(b, buffer, error, [&values, keyIndex](uint32_t index, const char* data, uint32_t size)
+		{
+			if (index == keyIndex)
+				values.push_back(std::string(data, size));
+		});
+
+		if (!ok)
+			return false;
+	}
+	return true;
+}
+
+bool SessionArchiveReader::Verify(std::string& error) const
+{
+	std::vector<uint64_t> counts(mKeys.size(), 0);
+	std::vector<char> buffer;
+	for (uint32_t b = 0; b < (uint32_t)mBlocks.size(); ++b)
+	{
+		const bool ok = ForEachValue(b, buffer, error, [this, &counts, b](uint32_t index, const char*, uint32_t)
+		{
+			// a value outside of the blocks the footer gives its key would be missed by ReadKey
+			if (b >= mKeys[index].mFirstBlock && b < mKeys[index].mFirstBlock + mKeys[index].mNumBlocks)
+				++counts[index];
+		});
+
+		if (!ok)
+			return false;
+	}
+
+	for (size_t k = 0; k < mKeys.size(); ++k)
+	{
+		if (counts[k] != mKeys[k].mNumValues)
+		{
+			error = mFilename + ": " + mKeys[k].mName + " has " + std::to_string(counts[k]) + " of " + std::to_string(mKeys[k].mNumValues) + " values";
+			return false;
+		}
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+static std::string ReplyError(const cpp_redis::reply& r)
+{
+	return r.is_error() ? r.error() : "unexpected reply";
+}
+
+// strings and arrays of strings, as the values of a key
+static bool ReplyValues(const cpp_redis::reply& r, std::vector<std::string>& values)
+{
+	values.clear();
+	if (r.is_string())
+	{
+		values.push_back(r.as_string());
+		return true;
+	}
+
+	if (!r.is_array())
+		return false;
+
+	const std::vector<cpp_redis::reply>& items = r.as_array();
+	values.reserve(items.size());
+	for (size_t i = 0; i < items.size(); ++i)
+	{
+		if (!items[i].is_string())
+			return false;
+		values.push_back(items[i].as_string());
+	}
+	return true;
+}
+
+SessionArchiver::SessionArchiver(const std::string& host, int port)
+	: mHost(host)
+	, mPort(port)
+	, mClient(nullptr)
+	, mExpireSeconds(0)
+	, mKeepKeys(false)
+{
+}
+
+SessionArchiver::~SessionArchiver()
+{
+	if (mClient != nullptr)
+	{
+		mClient->disconnect(true);
+		delete mClient;
+	}
+}
+
+bool SessionArchiver::Connect(std::string& error)
+{
+	mClient = new cpp_redis::client();
+	try
+	{
+		mClient->connect(mHost, mPort);
+		return true;
+	}
+	catch (const std::exception& e)
+	{
+		error = e.what();
+		delete mClient;
+		mClient = nullptr;
+		return false;
+	}
+}
+
+bool SessionArchiver::ScanKeys(const std::string& pattern, std::vector<std::string>& keys, std::string& error)
+{
+	keys.clear();
+
+	size_t cursor = 0;
+	do
+	{
+		std::future<cpp_redis::reply> f = mClient->scan(cursor, pattern, 1000);
+		mClient->sync_commit();
+
+		const cpp_redis::reply r = f.get();
+		if (!r.is_array() || r.as_array().size() != 2 || !r.as_array()[0].is_string() || !r.as_array()[1].is_array())
+		{
+			error = ReplyError(r);
+			return false;
+		}
+
+		cursor = (size_t)strtoull(r.as_array()[0].as_string().c_str(), NULL, 10);
+
+		const std::vector<cpp_redis::reply>& found = r.as_array()[1].as_array();
+		for (size_t i = 0; i < found.size(); ++i)
+		{
+			if (found[i].is_string())
+				keys.push_back(found[i].as_string());
+		}
+	} while (cursor != 0);
+
+	// a key can come up more than once while the table rehashes
+	std::sort(keys.begin(), keys.end());
+	keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+	return true;
+}
+
+bool SessionArchiver::FindEndedSessions(int64_t idleTime, std::vector<std::string>& sessions, std::string& error)
+{
+	sessions.clear();
+	if (mClient == nullptr)
+	{
+		error = "not connected";
+		return false;
+	}
+
+	std::future<cpp_redis::reply> range = mClient->zrangebyscore(SessionCatalog::StartKey(), std::string("-inf"), std::string("+inf"));
+	mClient->sync_commit();
+
+	const cpp_redis::reply r = range.get();
+	if (!r.is_array())
+	{
+		error = ReplyError(r);
+		return false;
+	}
+
+	std::vector<std::string> names;
+	std::vector< std::future<cpp_redis::reply> > entries;
+	const std::vector<cpp_redis::reply>& members = r.as_array();
+	for (size_t i = 0; i < members.size(); ++i)
+	{
+		if (!members[i].is_string())
+			continue;
+
+		names.push_back(members[i].as_string());
+		entries.push_back(mClient->hgetall(SessionCatalog::EntryKey(names.back())));
+	}
+	mClient->sync_commit();
+
+	const int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		std::vector<std::string> values;
+		if (!ReplyValues(entries[i].get(), values) || values.empty())
+			continue;
+
+		std::vector< std::pair<std::string, std::string> > fields;
+		for (size_t v = 0; v + 1 < values.size(); v += 2)
+			fields.push_back(std::make_pair(values[v], values[v + 1]));
+
+		SessionCatalogEntry entry;
+		SessionCatalog::FromFields(fields, entry);
+		if (!entry.mArchive.empty())
+			continue;
+
+		// the duration is as of the last update of the entry
+		const bool idle = idleTime > 0 && now - (entry.mStartTime + entry.mDuration) >= idleTime;
+		if (entry.mEndTime > 0 || idle)
+			sessions.push_back(names[i]);
+	}
+	return true;
+}
+
+bool SessionArchiver::ArchiveSession(const std::string& session, const std::string& filename, SessionArchiveStats& stats, std::string& error)
+{
+	stats = SessionArchiveStats();
+	if (mClient == nullptr)
+	{
+		error = "not connected";
+		return false;
+	}
+
+	// every key of the session but the catalog entry, which stays to say where the archive is
+	std::vector<std::string> keys;
+	if (!ScanKeys(session + ":*", keys, error))
+		return false;
+	keys.erase(std::remove(keys.begin(), keys.end(), SessionCatalog::EntryKey(session)), keys.end());
+
+	if (keys.empty())
+	{
+		error = "no keys for " + session;
+		return false;
+	}
+
+	SessionArchiveWriter writer;
+	if (!writer.Open(filename, session, error))
+		return false;
+
+	const size_t batchSize = 256;
+	const int pageSize = 4096;
+
+	std::vector<std::string> values;
+	for (size_t begin = 0; begin < keys.size(); begin += batchSize)
+	{
+		const size_t end = std::min(keys.size(), begin + batchSize);
+
+		std::vector< std::future<cpp_redis::reply> > typeReplies;
+		for (size_t k = begin; k < end; ++k)
+			typeReplies.push_back(mClient->type(keys[k]));
+		mClient->sync_commit();
+
+		// the contents in one round trip, lengths for lists
+		std::vector<ArchiveKeyType> types;
+		std::vector<bool> present;
+		std::vector< std::future<cpp_redis::reply> > contents;
+		for (size_t k = begin; k < end; ++k)
+		{
+			const cpp_redis::reply r = typeReplies[k - begin].get();
+			const std::string type = r.is_string() ? r.as_string() : std::string();
+
+			ArchiveKeyType keyType = ArchiveKey_String;
+			if (type == "string")
+				contents.push_back(mClient->get(keys[k]));
+			else if (type == "list")
+				keyType = ArchiveKey_List, contents.push_back(mClient->llen(keys[k]));
+			else if (type == "hash")
+				keyType = ArchiveKey_Hash, contents.push_back(mClient->hgetall(keys[k]));
+			else if (type == "set")
+				keyType = ArchiveKey_Set, contents.push_back(mClient->smembers(keys[k]));
+			else if (type == "zset")
+				keyType = ArchiveKey_SortedSet, contents.push_back(mClient->zrange(keys[k], 0, -1, true));
+			else if (type == "none")
+				contents.push_back(std::future<cpp_redis::reply>());
+			else
+			{
+				error = keys[k] + " is a " + (type.empty() ? ReplyError(r) : type) + ", which archives don't keep";
+				writer.Close(error);
+				remove(filename.c_str());
+				return false;
+			}
+
+			types.push_back(keyType);
+			present.push_back(type != "none");
+		}
+		mClient->sync_commit();
+
+		std::vector< std::vector< std::future<cpp_redis::reply> > > pages(end - begin);
+		std::vector<cpp_redis::reply> replies(end - begin);
+		for (size_t k = begin; k < end; ++k)
+		{
+			if (!present[k - begin])
+				continue;
+
+			replies[k - begin] = contents[k - begin].get();
+			if (types[k - begin] == ArchiveKey_List && replies[k - begin].is_integer())
+			{
+				for (int64_t start = 0; start < replies[k - begin].as_integer(); start += pageSize)
+					pages[k - begin].push_back(mClient->lrange(keys[k], (int)start, (int)(start + pageSize - 1)));
+			}
+		}
+		mClient->sync_commit();
+
+		for (size_t k = begin; k < end; ++k)
+		{
+			const size_t i = k - begin;
+			if (!present[i])
+				continue;
+
+			bool ok = true;
+			if (types[i] == ArchiveKey_List)
+			{
+				ok = replies[i].is_integer();
+				for (size_t p = 0; ok && p < pages[i].size(); ++p)
+				{
+					const cpp_redis::reply r = pages[i][p].get();
+					ok = ReplyValues(r, values);
+					if (!ok)
+						replies[i] = r;
+					writer.AddValues(keys[k], ArchiveKey_List, values);
+					stats.mNumValues += values.size();
+				}
+			}
+			else if ((ok = ReplyValues(replies[i], values)))
+			{
+				writer.AddValues(keys[k], types[i], values);
+				stats.mNumValues += values.size();
+			}
+
+			if (!ok)
+			{
+				error = keys[k] + ": " + ReplyError(replies[i]);
+				std::string closeError;
+				writer.Close(closeError);
+				remove(filename.c_str());
+				return false;
+			}
+			++stats.mNumKeys;
+		}
+	}
+
+	if (!writer.Close(error))
+		return false;
+
+	stats.mRawSize = writer.GetRawSize();
+	stats.mFileSize = writer.GetFileSize();
+
+	// nothing leaves redis unless the archive reads back whole
+	SessionArchiveReader reader;
+	if (!reader.Open(filename, error) || !reader.Verify(error))
+		return false;
+
+	if (mKeepKeys)
+		return true;
+
+	for (size_t begin = 0; begin < keys.size(); begin += batchSize)
+	{
+		const size_t end = std::min(keys.size(), begin + batchSize);
+		if (mExpireSeconds > 0)
+		{
+			for (size_t k = begin; k < end; ++k)
+				mClient->expire(keys[k], mExpireSeconds);
+		}
+		else
+		{
+			mClient->del(std::vector<std::string>(keys.begin() + begin, keys.begin() + end));
+		}
+	}
+
+	std::future<cpp_redis::reply> listed = mClient->lrem("event_streams", 0, session);
+	std::future<cpp_redis::reply> recorded = mClient->hset(SessionCatalog::EntryKey(session), "archive", filename);
+	mClient->sync_commit();
+
+	const cpp_redis::reply r = recorded.get();
+	if (r.is_error())
+	{
+		error = r.error();
+		return false;
+	}
+	return true;
+}
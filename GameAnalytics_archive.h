@@ -0,0 +1,175 @@
+#ifndef GAMEANALYTICS_ARCHIVE_H
+#define GAMEANALYTICS_ARCHIVE_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+
+#include "GameAnalytics_mmap.h"
+
+namespace cpp_redis
+{
+	class client;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// the redis types an archive keeps, hash and sorted set values alternate field, value and member, score
+enum ArchiveKeyType
+{
+	ArchiveKey_String,
+	ArchiveKey_List,
+	ArchiveKey_Hash,
+	ArchiveKey_Set,
+	ArchiveKey_SortedSet,
+};
+
+struct ArchivedKey
+{
+	std::string		mName;
+	ArchiveKeyType	mType;
+	uint64_t		mNumValues;
+	// the blocks holding its values
+	uint32_t		mFirstBlock;
+	uint32_t		mNumBlocks;
+};
+
+// <directory>/<session>.gas, with the ':' of compact session names as '_'
+std::string SessionArchiveFilename(const std::string& directory, const std::string& session);
+
+// Writes the keys of a session to a block file. The values of each key go into records in the order they are
+// added and the records into blocks of about blockSize bytes, each compressed with FastLZ on its own, so a key
+// reads back by decompressing only the blocks it spans. A key can be added in several calls, like the pages of a
+// long list, which append to it.
+//
+// file: 'GASA' and version, the blocks, the footer with the session, the block offsets and the keys, the
+// footer offset and 'GASA' and version again. a block is records of a key index, a value count and the values
+class SessionArchiveWriter
+{
+public:
+	enum { DefaultBlockSize = 256 * 1024 };
+
+	explicit SessionArchiveWriter(uint32_t blockSize = DefaultBlockSize);
+	~SessionArchiveWriter();
+
+	bool Open(const std::string& filename, const std::string& session, std::string& error);
+	void AddValues(const std::string& key, ArchiveKeyType type, const std::vector<std::string>& values);
+	bool Close(std::string& error);
+
+	uint64_t GetRawSize() const { return mRawSize; }
+	uint64_t GetFileSize() const { return mOffset; }
+private:
+	struct Block
+	{
+		uint64_t	mOffset;
+		uint32_t	mSize;
+		uint32_t	mRawSize;
+	};
+
+	FILE *							mFile;
+	std::string						mFilename;
+	std::string						mSession;
+	uint32_t						mBlockSize;
+	uint64_t						mOffset;
+	uint64_t						mRawSize;
+	bool							mFailed;
+
+	std::vector<ArchivedKey>		mKeys;
+	std::map<std::string, uint32_t>	mKeyIndex;
+	std::vector<Block>				mBlocks;
+
+	std::string						mBlock;
+	std::vector<char>				mCompressed;
+	size_t							mRecordStart;
+	uint32_t						mRecordKey;
+	uint32_t						mRecordValues;
+
+	void EndRecord();
+	void FlushBlock();
+	bool Write(const void* data, size_t size);
+};
+
+class SessionArchiveReader
+{
+public:
+	SessionArchiveReader();
+
+	bool Open(const std::string& filename, std::string& error);
+	void Close();
+
+	const std::string& GetSession() const { return mSession; }
+	const std::vector<ArchivedKey>& GetKeys() const { return mKeys; }
+	// NULL when the session had no such key
+	const ArchivedKey* FindKey(const std::string& name) const;
+
+	// the values of a key in the order they were added
+	bool ReadKey(const ArchivedKey& key, std::vector<std::string>& values, std::string& error) const;
+	// decompresses every block and checks each key has the values the footer says it has
+	bool Verify(std::string& error) const;
+private:
+	struct Block
+	{
+		uint64_t	mOffset;
+		uint32_t	mSize;
+		uint32_t	mRawSize;
+	};
+
+	MappedFile						mFile;
+	std::string						mFilename;
+	std::string						mSession;
+	std::vector<Block>				mBlocks;
+	std::vector<ArchivedKey>		mKeys;
+	std::map<std::string, size_t>	mKeyIndex;
+
+	// calls fn for each value of the block with the index of its key
+	template<typename Fn>
+	bool ForEachValue(uint32_t block, std::vector<char>& buffer, std::string& error, Fn fn) const;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+struct SessionArchiveStats
+{
+	size_t		mNumKeys;
+	uint64_t	mNumValues;
+	uint64_t	mRawSize;
+	uint64_t	mFileSize;
+
+	SessionArchiveStats() : mNumKeys(0), mNumValues(0), mRawSize(0), mFileSize(0) {}
+};
+
+// Moves finished sessions out of redis. The keys of a session are found with SCAN and read in pipelined batches,
+// their types in one round trip and their contents in the next, long lists in pages, and streamed into a
+// SessionArchiveWriter. Once the archive reads back whole the keys are deleted or set to expire, the session
+// leaves event_streams and its catalog entry, which stays in redis, gets the archive filename.
+class SessionArchiver
+{
+public:
+	SessionArchiver(const std::string& host, int port = 6379);
+	~SessionArchiver();
+
+	bool Connect(std::string& error);
+
+	// expire the keys this many seconds after archiving them instead of deleting them, 0 deletes
+	void SetExpire(int seconds) { mExpireSeconds = seconds; }
+	// write the archives and leave redis as it is
+	void SetKeepKeys(bool keep) { mKeepKeys = keep; }
+
+	// the catalog sessions that have ended, and with an idle time in milliseconds those that stopped updating their
+	// entry that long ago, which covers servers that never closed them. archived sessions are left out, oldest first
+	bool FindEndedSessions(int64_t idleTime, std::vector<std::string>& sessions, std::string& error);
+
+	bool ArchiveSession(const std::string& session, const std::string& filename, SessionArchiveStats& stats, std::string& error);
+private:
+	std::string				mHost;
+	int						mPort;
+	cpp_redis::client *		mClient;
+	int						mExpireSeconds;
+	bool					mKeepKeys;
+
+	bool ScanKeys(const std::string& pattern, std::vector<std::string>& keys, std::string& error);
+};
+
+#endif
@@ -0,0 +1,703 @@
+#include "GameAnalytics_bitmap.h"
+#include "GameAnalytics_workpool.h"
+
+#include <map>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+// 'GAIX' and the layout version, at the start of the file and again after the footer offset at its end
+static const uint32_t IndexFileMagic = 0x58494147;
+static const uint32_t IndexFileVersion = 1;
+
+enum ContainerKind
+{
+	ContainerKind_Array,
+	ContainerKind_Bitmap,
+};
+
+static inline uint32_t PopCount64(uint64_t v)
+{
+#if defined(__GNUC__)
+	return (uint32_t)__builtin_popcountll(v);
+#else
+	// no popcnt instruction assumed
+	v = v - ((v >> 1) & 0x5555555555555555ull);
+	v = (v & 0x3333333333333333ull) + ((v >> 2) & 0x3333333333333333ull);
+	v = (v + (v >> 4)) & 0x0f0f0f0f0f0f0f0full;
+	return (uint32_t)((v * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+static uint32_t PopCount(const std::vector<uint64_t>& bits)
+{
+	uint32_t count = 0;
+	for (size_t i = 0; i < bits.size(); ++i)
+		count += PopCount64(bits[i]);
+	return count;
+}
+
+static inline bool TestBit(const std::vector<uint64_t>& bits, uint16_t value)
+{
+	return (bits[value >> 6] >> (value & 63)) & 1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void RoaringBitmap::ToBitmap(Container& c)
+{
+	c.mBits.assign(BitmapWords, 0);
+	for (size_t i = 0; i < c.mArray.size(); ++i)
+		c.mBits[c.mArray[i] >> 6] |= 1ull << (c.mArray[i] & 63);
+	std::vector<uint16_t>().swap(c.mArray);
+}
+
+void RoaringBitmap::Normalize(Container& c)
+{
+	if (c.IsBitmap() && c.mCardinality <= ArrayLimit)
+	{
+		c.mArray.clear();
+		c.mArray.reserve(c.mCardinality);
+		for (uint32_t w = 0; w < BitmapWords; ++w)
+		{
+			for (uint64_t word = c.mBits[w]; word != 0; word &= word - 1)
+			{
+				uint32_t bit = 0;
+				while (((word >> bit) & 1) == 0)
+					++bit;
+				c.mArray.push_back((uint16_t)(w * 64 + bit));
+			}
+		}
+		std::vector<uint64_t>().swap(c.mBits);
+	}
+	else if (!c.IsBitmap() && c.mCardinality > ArrayLimit)
+	{
+		ToBitmap(c);
+	}
+}
+
+void RoaringBitmap::Add(uint32_t value)
+{
+	const uint16_t key = (uint16_t)(value >> 16);
+	const uint16_t low = (uint16_t)(value & 0xffff);
+
+	Container* c = NULL;
+	if (!mContainers.empty() && mContainers.back().mKey == key)
+	{
+		c = &mContainers.back();
+	}
+	else
+	{
+		std::vector<Container>::iterator it = mContainers.begin();
+		if (!mContainers.empty() && mContainers.back().mKey < key)
+			it = mContainers.end();
+		else
+			it = std::lower_bound(mContainers.begin(), mContainers.end(), key, [](const Container& a, uint16_t k) { return a.mKey < k; });
+
+		if (it == mContainers.end() || it->mKey != key)
+		{
+			Container added;
+			added.mKey = key;
+			added.mCardinality = 0;
+			it = mContainers.insert(it, added);
+		}
+		c = &*it;
+	}
+
+	if (c->IsBitmap())
+	{
+		uint64_t& word = c->mBits[low >> 6];
+		const uint64_t bit = 1ull << (low & 63);
+		if ((word & bit) == 0)
+		{
+			word |= bit;
+			++c->mCardinality;
+		}
+		return;
+	}
+
+	if (c->mArray.empty() || c->mArray.back() < low)
+	{
+		c->mArray.push_back(low);
+	}
+	else
+	{
+		std::vector<uint16_t>::iterator it = std::lower_bound(c->mArray.begin(), c->mArray.end(), low);
+		if (it != c->mArray.end() && *it == low)
+			return;
+		c->mArray.insert(it, low);
+	}
+
+	if (++c->mCardinality > ArrayLimit)
+		ToBitmap(*c);
+}
+
+bool RoaringBitmap::Contains(uint32_t value) const
+{
+	const uint16_t key = (uint16_t)(value >> 16);
+	const uint16_t low = (uint16_t)(value & 0xffff);
+
+	std::vector<Container>::const_iterator it = std::lower_bound(mContainers.begin(), mContainers.end(), key, [](const Container& a, uint16_t k) { return a.mKey < k; });
+	if (it == mContainers.end() || it->mKey != key)
+		return false;
+
+	return it->IsBitmap() ? TestBit(it->mBits, low) : std::binary_search(it->mArray.begin(), it->mArray.end(), low);
+}
+
+uint64_t RoaringBitmap::Cardinality() const
+{
+	uint64_t count = 0;
+	for (size_t i = 0; i < mContainers.size(); ++i)
+		count += mContainers[i].mCardinality;
+	return count;
+}
+
+void RoaringBitmap::Range(uint32_t begin, uint32_t end, RoaringBitmap& out)
+{
+	out.Clear();
+	for (uint64_t v = begin; v < end;)
+	{
+		const uint64_t chunkEnd = std::min<uint64_t>(end, ((v >> 16) + 1) << 16);
+
+		Container c;
+		c.mKey = (uint16_t)(v >> 16);
+		c.mCardinality = (uint32_t)(chunkEnd - v);
+		if (c.mCardinality > ArrayLimit)
+		{
+			c.mBits.assign(BitmapWords, 0);
+			for (uint64_t i = v; i < chunkEnd; ++i)
+				c.mBits[(i & 0xffff) >> 6] |= 1ull << (i & 63);
+		}
+		else
+		{
+			for (uint64_t i = v; i < chunkEnd; ++i)
+				c.mArray.push_back((uint16_t)(i & 0xffff));
+		}
+		out.mContainers.push_back(c);
+		v = chunkEnd;
+	}
+}
+
+void RoaringBitmap::AndContainers(const Container& a, const Container& b, Container& out)
+{
+	out.mKey = a.mKey;
+	out.mArray.clear();
+	out.mBits.clear();
+
+	if (a.IsBitmap() && b.IsBitmap())
+	{
+		out.mBits.resize(BitmapWords);
+		for (uint32_t i = 0; i < BitmapWords; ++i)
+			out.mBits[i] = a.mBits[i] & b.mBits[i];
+		out.mCardinality = PopCount(out.mBits);
+		Normalize(out);
+		return;
+	}
+
+	if (a.IsBitmap() || b.IsBitmap())
+	{
+		const Container& bitmap = a.IsBitmap() ? a : b;
+		const Container& array = a.IsBitmap() ? b : a;
+		for (size_t i = 0; i < array.mArray.size(); ++i)
+		{
+			if (TestBit(bitmap.mBits, array.mArray[i]))
+				out.mArray.push_back(array.mArray[i]);
+		}
+	}
+	else
+	{
+		std::set_intersection(a.mArray.begin(), a.mArray.end(), b.mArray.begin(), b.mArray.end(), std::back_inserter(out.mArray));
+	}
+	out.mCardinality = (uint32_t)out.mArray.size();
+}
+
+void RoaringBitmap::OrContainers(const Container& a, const Container& b, Container& out)
+{
+	out.mKey = a.mKey;
+	out.mArray.clear();
+	out.mBits.clear();
+
+	if (a.IsBitmap() || b.IsBitmap())
+	{
+		const Container& bitmap = a.IsBitmap() ? a : b;
+		const Container& other = a.IsBitmap() ? b : a;
+		out.mBits = bitmap.mBits;
+		if (other.IsBitmap())
+		{
+			for (uint32_t i = 0; i < BitmapWords; ++i)
+				out.mBits[i] |= other.mBits[i];
+		}
+		else
+		{
+			for (size_t i = 0; i < other.mArray.size(); ++i)
+				out.mBits[other.mArray[i] >> 6] |= 1ull << (other.mArray[i] & 63);
+		}
+		out.mCardinality = PopCount(out.mBits);
+		return;
+	}
+
+	std::set_union(a.mArray.begin(), a.mArray.end(), b.mArray.begin(), b.mArray.end(), std::back_inserter(out.mArray));
+	out.mCardinality = (uint32_t)out.mArray.size();
+	Normalize(out);
+}
+
+void RoaringBitmap::AndNotContainers(const Container& a, const Container& b, Container& out)
+{
+	out.mKey = a.mKey;
+	out.mArray.clear();
+	out.mBits.clear();
+
+	if (a.IsBitmap())
+	{
+		out.mBits = a.mBits;
+		if (b.IsBitmap())
+		{
+			for (uint32_t i = 0; i < BitmapWords; ++i)
+				out.mBits[i] &= ~b.mBits[i];
+		}
+		else
+		{
+			for (size_t i = 0; i < b.mArray.size(); ++i)
+				out.mBits[b.mArray[i] >> 6] &= ~(1ull << (b.mArray[i] & 63));
+		}
+		out.mCardinality = PopCount(out.mBits);
+		Normalize(out);
+		return;
+	}
+
+	if (b.IsBitmap())
+	{
+		for (size_t i = 0; i < a.mArray.size(); ++i)
+		{
+			if (!TestBit(b.mBits, a.mArray[i]))
+				out.mArray.push_back(a.mArray[i]);
+		}
+	}
+	else
+	{
+		std::set_difference(a.mArray.begin(), a.mArray.end(), b.mArray.begin(), b.mArray.end(), std::back_inserter(out.mArray));
+	}
+	out.mCardinality = (uint32_t)out.mArray.size();
+}
+
+void RoaringBitmap::And(const RoaringBitmap& a, const RoaringBitmap& b, RoaringBitmap& out)
+{
+	RoaringBitmap result;
+	for (size_t i = 0, j = 0; i < a.mContainers.size() && j < b.mContainers.size();)
+	{
+		if (a.mContainers[i].mKey < b.mContainers[j].mKey)
+			++i;
+		else if (a.mContainers[i].mKey > b.mContainers[j].mKey)
+			++j;
+		else
+		{
+			Container c;
+			AndContainers(a.mContainers[i++], b.mContainers[j++], c);
+			if (c.mCardinality > 0)
+				result.mContainers.push_back(c);
+		}
+	}
+	out.mContainers.swap(result.mContainers);
+}
+
+void RoaringBitmap::Or(const RoaringBitmap& a, const RoaringBitmap& b, RoaringBitmap& out)
+{
+	RoaringBitmap result;
+	size_t i = 0, j = 0;
+	while (i < a.mContainers.size() || j < b.mContainers.size())
+	{
+		if (j >= b.mContainers.size() || (i < a.mContainers.size() && a.mContainers[i].mKey < b.mContainers[j].mKey))
+			result.mContainers.push_back(a.mContainers[i++]);
+		else if (i >= a.mContainers.size() || a.mContainers[i].mKey > b.mContainers[j].mKey)
+			result.mContainers.push_back(b.mContainers[j++]);
+		else
+		{
+			Container c;
+			OrContainers(a.mContainers[i++], b.mContainers[j++], c);
+			result.mContainers.push_back(c);
+		}
+	}
+	out.mContainers.swap(result.mContainers);
+}
+
+void RoaringBitmap::AndNot(const RoaringBitmap& a, const RoaringBitmap& b, RoaringBitmap& out)
+{
+	RoaringBitmap result;
+	size_t j = 0;
+	for (size_t i = 0; i < a.mContainers.size(); ++i)
+	{
+		while (j < b.mContainers.size() && b.mContainers[j].mKey < a.mContainers[i].mKey)
+			++j;
+
+		if (j < b.mContainers.size() && b.mContainers[j].mKey == a.mContainers[i].mKey)
+		{
+			Container c;
+			AndNotContainers(a.mContainers[i], b.mContainers[j], c);
+			if (c.mCardinality > 0)
+				result.mContainers.push_back(c);
+		}
+		else
+		{
+			result.mContainers.push_back(a.mContainers[i]);
+		}
+	}
+	out.mContainers.swap(result.mContainers);
+}
+
+void RoaringBitmap::ToMask(uint8_t* mask, uint32_t count) const
+{
+	memset(mask, 0, count);
+	for (size_t i = 0; i < mContainers.size(); ++i)
+	{
+		const Container& c = mContainers[i];
+		const uint64_t base = (uint64_t)c.mKey << 16;
+		if (base >= count)
+			break;
+
+		if (c.IsBitmap())
+		{
+			const uint32_t words = (uint32_t)std::min<uint64_t>(BitmapWords, (count - base + 63) / 64);
+			for (uint32_t w = 0; w < words; ++w)
+			{
+				const uint64_t word = c.mBits[w];
+				const uint64_t first = base + w * 64;
+				const uint32_t bits = (uint32_t)std::min<uint64_t>(64, count - first);
+				for (uint32_t b = 0; b < bits; ++b)
+					mask[first + b] = (uint8_t)((word >> b) & 1);
+			}
+		}
+		else
+		{
+			for (size_t a = 0; a < c.mArray.size() && base + c.mArray[a] < count; ++a)
+				mask[base + c.mArray[a]] = 1;
+		}
+	}
+}
+
+void RoaringBitmap::Serialize(std::string& out) const
+{
+	const uint32_t numContainers = (uint32_t)mContainers.size();
+	out.append((const char*)&numContainers, sizeof(numContainers));
+
+	for (size_t i = 0; i < mContainers.size(); ++i)
+	{
+		const Container& c = mContainers[i];
+		const uint16_t header[2] = { c.mKey, (uint16_t)(c.IsBitmap() ? ContainerKind_Bitmap : ContainerKind_Array) };
+		out.append((const char*)header, sizeof(header));
+		out.append((const char*)&c.mCardinality, sizeof(c.mCardinality));
+
+		if (c.IsBitmap())
+			out.append((const char*)c.mBits.data(), c.mBits.size() * sizeof(uint64_t));
+		else
+			out.append((const char*)c.mArray.data(), c.mArray.size() * sizeof(uint16_t));
+	}
+}
+
+bool RoaringBitmap::Deserialize(const uint8_t* data, size_t size)
+{
+	Clear();
+
+	uint32_t numContainers = 0;
+	if (size < sizeof(numContainers))
+		return false;
+	memcpy(&numContainers, data, sizeof(numContainers));
+
+	size_t pos = sizeof(numContainers);
+	for (uint32_t i = 0; i < numContainers; ++i)
+	{
+		uint16_t header[2];
+		Container c;
+		if (size - pos < sizeof(header) + sizeof(c.mCardinality))
+			return false;
+		memcpy(header, data + pos, sizeof(header));
+		memcpy(&c.mCardinality, data + pos + sizeof(header), sizeof(c.mCardinality));
+		pos += sizeof(header) + sizeof(c.mCardinality);
+
+		c.mKey = header[0];
+		const size_t bytes = header[1] == ContainerKind_Bitmap ? BitmapWords * sizeof(uint64_t) : c.mCardinality * sizeof(uint16_t);
+		if (size - pos < bytes || c.mCardinality > 65536)
+			return false;
+
+		if (header[1] == ContainerKind_Bitmap)
+		{
+			c.mBits.resize(BitmapWords);
+			memcpy(c.mBits.data(), data + pos, bytes);
+		}
+		else
+		{
+			c.mArray.resize(c.mCardinality);
+			if (bytes > 0)
+				memcpy(c.mArray.data(), data + pos, bytes);
+		}
+		pos += bytes;
+		mContainers.push_back(c);
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+std::string ColumnIndexFilename(const std::string& archiveFilename)
+{
+	const std::string ext = ".gac";
+	if (archiveFilename.size() > ext.size() && archiveFilename.compare(archiveFilename.size() - ext.size(), ext.size(), ext) == 0)
+		return archiveFilename.substr(0, archiveFilename.size() - ext.size()) + ".gai";
+	return archiveFilename + ".gai";
+}
+
+static bool IsIndexedColumn(const ColumnInfo& column)
+{
+	if (column.mPath.empty() || column.mType == ColumnType_Float || column.mType == ColumnType_Double)
+		return false;
+	return column.mPath.back()->options().GetExtension(Analytics::track_event);
+}
+
+template<typename T>
+static void BuildBitmaps(const void* data, uint32_t rows, std::map<int64_t, RoaringBitmap>& bitmaps)
+{
+	const T* values = static_cast<const T*>(data);
+
+	// runs of the same value are common, events of one team or weapon come in bursts
+	RoaringBitmap* last = NULL;
+	int64_t lastValue = 0;
+	for (uint32_t i = 0; i < rows; ++i)
+	{
+		const int64_t value = (int64_t)values[i];
+		if (last == NULL || value != lastValue)
+		{
+			last = &bitmaps[value];
+			lastValue = value;
+		}
+		last->Add(i);
+	}
+}
+
+bool BuildColumnIndex(const ColumnarReader& file, const std::string& filename, int numThreads, std::string& error)
+{
+	std::vector<size_t> columns;
+	for (size_t c = 0; c < file.GetNumColumns(); ++c)
+	{
+		if (IsIndexedColumn(file.GetColumn(c)))
+			columns.push_back(c);
+	}
+
+	FILE* fp = fopen(filename.c_str(), "wb");
+	if (fp == NULL)
+	{
+		error = "failed to open " + filename + " for writing";
+		return false;
+	}
+
+	const uint32_t header[2] = { IndexFileMagic, IndexFileVersion };
+	bool ok = fwrite(header, sizeof(header), 1, fp) == 1;
+	uint64_t offset = sizeof(header);
+
+	struct Entry
+	{
+		int64_t		mValue;
+		uint64_t	mOffset;
+		uint32_t	mSize;
+	};
+
+	// the bitmaps of a batch of blocks are built in parallel and written in order, which bounds the memory
+	const size_t numBlocks = file.GetNumBlocks();
+	const size_t batchBlocks = std::max<size_t>((size_t)WorkStealingThreads(numBlocks * columns.size(), numThreads) * 4, 16);
+	std::vector< std::vector<Entry> > entries(columns.size() * numBlocks);
+
+	for (size_t batchStart = 0; ok && batchStart < numBlocks && !columns.empty(); batchStart += batchBlocks)
+	{
+		const size_t batchEnd = std::min(numBlocks, batchStart + batchBlocks);
+		const size_t numTasks = (batchEnd - batchStart) * columns.size();
+
+		std::vector<std::string> payloads(numTasks);
+		std::vector< std::vector<Entry> > taskEntries(numTasks);
+		WorkStealingFor(numTasks, numThreads, [&](size_t task, int)
+		{
+			const size_t block = batchStart + task / columns.size();
+			const size_t column = columns[task % columns.size()];
+
+			std::map<int64_t, RoaringBitmap> bitmaps;
+			const void* data = file.GetData(block, column);
+			const uint32_t rows = file.GetBlockRows(block);
+			switch (file.GetColumn(column).mType)
+			{
+			case ColumnType_Int32: BuildBitmaps<int32_t>(data, rows, bitmaps); break;
+			case ColumnType_Int64: BuildBitmaps<int64_t>(data, rows, bitmaps); break;
+			case ColumnType_UInt64: BuildBitmaps<uint64_t>(data, rows, bitmaps); break;
+			default: BuildBitmaps<uint32_t>(data, rows, bitmaps); break;
+			}
+
+			for (std::map<int64_t, RoaringBitmap>::const_iterator it = bitmaps.begin(); it != bitmaps.end(); ++it)
+			{
+				Entry entry;
+				entry.mValue = it->first;
+				entry.mOffset = payloads[task].size();
+				it->second.Serialize(payloads[task]);
+				entry.mSize = (uint32_t)(payloads[task].size() - entry.mOffset);
+				taskEntries[task].push_back(entry);
+			}
+		});
+
+		for (size_t task = 0; ok && task < numTasks; ++task)
+		{
+			const size_t block = batchStart + task / columns.size();
+			const size_t slot = task % columns.size();
+
+			std::vector<Entry>& blockEntries = entries[slot * numBlocks + block];
+			blockEntries = taskEntries[task];
+			for (size_t e = 0; e < blockEntries.size(); ++e)
+				blockEntries[e].mOffset += offset;
+
+			ok = payloads[task].empty() || fwrite(payloads[task].data(), payloads[task].size(), 1, fp) == 1;
+			offset += payloads[task].size();
+		}
+	}
+
+	std::string footer;
+	auto appendPod = [&footer](const void* data, size_t size) { footer.append((const char*)data, size); };
+
+	const uint32_t counts[2] = { (uint32_t)numBlocks, (uint32_t)columns.size() };
+	appendPod(counts, sizeof(counts));
+	for (size_t s = 0; s < columns.size(); ++s)
+	{
+		const std::string& name = file.GetColumn(columns[s]).mName;
+		const uint32_t size = (uint32_t)name.size();
+		appendPod(&size, sizeof(size));
+		footer.append(name);
+	}
+
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		const uint32_t count = (uint32_t)entries[i].size();
+		appendPod(&count, sizeof(count));
+		for (size_t e = 0; e < entries[i].size(); ++e)
+		{
+			appendPod(&entries[i][e].mValue, sizeof(entries[i][e].mValue));
+			appendPod(&entries[i][e].mOffset, sizeof(entries[i][e].mOffset));
+			appendPod(&entries[i][e].mSize, sizeof(entries[i][e].mSize));
+		}
+	}
+
+	appendPod(&offset, sizeof(offset));
+	appendPod(header, sizeof(header));
+
+	ok = ok && fwrite(footer.data(), footer.size(), 1, fp) == 1;
+	ok = fclose(fp) == 0 && ok;
+	if (!ok)
+		error = "failed to write " + filename;
+	return ok;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+bool ColumnIndexReader::Open(const std::string& filename, const ColumnarReader& file, std::string& error)
+{
+	Close();
+
+	if (!mFile.Open(filename, error))
+		return false;
+
+	const uint8_t* data = mFile.GetData();
+	const uint64_t size = mFile.GetSize();
+
+	uint32_t header[2] = {};
+	uint64_t footerOffset = 0;
+	uint32_t trailer[2] = {};
+	if (size >= sizeof(header) + sizeof(footerOffset) + sizeof(trailer))
+	{
+		memcpy(header, data, sizeof(header));
+		memcpy(&footerOffset, data + size - sizeof(trailer) - sizeof(footerOffset), sizeof(footerOffset));
+		memcpy(trailer, data + size - sizeof(trailer), sizeof(trailer));
+	}
+
+	if (header[0] != IndexFileMagic || trailer[0] != IndexFileMagic || header[1] != IndexFileVersion || trailer[1] != IndexFileVersion || footerOffset >= size)
+	{
+		error = filename + " is not a column index of version " + std::to_string(IndexFileVersion);
+		Close();
+		return false;
+	}
+
+	const uint64_t footerEnd = size - sizeof(trailer) - sizeof(footerOffset);
+	uint64_t pos = footerOffset;
+	auto read = [&](void* out, size_t bytes)
+	{
+		if (footerEnd - pos < bytes)
+			return false;
+		memcpy(out, data + pos, bytes);
+		pos += bytes;
+		return true;
+	};
+
+	uint32_t counts[2] = {};
+	bool ok = read(counts, sizeof(counts)) && counts[0] == file.GetNumBlocks();
+	mNumBlocks = counts[0];
+	mColumnSlots.assign(file.GetNumColumns(), -1);
+
+	for (uint32_t s = 0; ok && s < counts[1]; ++s)
+	{
+		uint32_t length = 0;
+		ok = read(&length, sizeof(length)) && footerEnd - pos >= length;
+		if (!ok)
+			break;
+
+		const int column = file.FindColumn(std::string((const char*)data + pos, length));
+		pos += length;
+		ok = column >= 0;
+		if (ok)
+			mColumnSlots[column] = (int)s;
+	}
+
+	mRanges.push_back(0);
+	for (uint64_t i = 0; ok && i < (uint64_t)counts[1] * mNumBlocks; ++i)
+	{
+		uint32_t count = 0;
+		ok = read(&count, sizeof(count));
+		for (uint32_t e = 0; ok && e < count; ++e)
+		{
+			Entry entry;
+			ok = read(&entry.mValue, sizeof(entry.mValue)) && read(&entry.mOffset, sizeof(entry.mOffset)) && read(&entry.mSize, sizeof(entry.mSize)) &&
+				entry.mOffset <= footerOffset && footerOffset - entry.mOffset >= entry.mSize;
+			mEntries.push_back(entry);
+		}
+		mRanges.push_back(mEntries.size());
+	}
+
+	if (!ok)
+	{
+		error = filename + " doesn't match its archive or is damaged";
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void ColumnIndexReader::Close()
+{
+	mFile.Close();
+	mNumBlocks = 0;
+	mColumnSlots.clear();
+	mRanges.clear();
+	mEntries.clear();
+}
+
+bool ColumnIndexReader::GetBitmap(size_t block, size_t column, int64_t value, RoaringBitmap& bitmap) const
+{
+	if (!HasColumn(column) || block >= mNumBlocks)
+		return false;
+
+	const size_t range = mColumnSlots[column] * mNumBlocks + block;
+	std::vector<Entry>::const_iterator begin = mEntries.begin() + mRanges[range];
+	std::vector<Entry>::const_iterator end = mEntries.begin() + mRanges[range + 1];
+	std::vector<Entry>::const_iterator it = std::lower_bound(begin, end, value, [](const Entry& e, int64_t v) { return e.mValue < v; });
+
+	if (it == end || it->mValue != value)
+	{
+		bitmap.Clear();
+		return true;
+	}
+	return bitmap.Deserialize(mFile.GetData() + it->mOffset, it->mSize);
+}
@@ -0,0 +1,101 @@
+#ifndef GAMEANALYTICS_BITMAP_H
+#define GAMEANALYTICS_BITMAP_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include "GameAnalytics_columns.h"
+#include "GameAnalytics_mmap.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// A compressed set of 32 bit values in the layout of roaring bitmaps. Values are split by their high 16 bits into
+// containers, sparse containers are sorted arrays of the low 16 bits and dense ones, past ArrayLimit values,
+// are 65536 bit maps. A block of the column archive is a single container, so AND and OR of the rows of two
+// values is a merge of two short arrays or 1024 word operations.
+class RoaringBitmap
+{
+public:
+	enum { ArrayLimit = 4096, BitmapWords = 1024 };
+
+	void Clear() { mContainers.clear(); }
+	// fastest in increasing order, like the rows of a block
+	void Add(uint32_t value);
+	bool Contains(uint32_t value) const;
+
+	bool Empty() const { return mContainers.empty(); }
+	uint64_t Cardinality() const;
+
+	// the values of [begin, end)
+	static void Range(uint32_t begin, uint32_t end, RoaringBitmap& out);
+	static void And(const RoaringBitmap& a, const RoaringBitmap& b, RoaringBitmap& out);
+	static void Or(const RoaringBitmap& a, const RoaringBitmap& b, RoaringBitmap& out);
+	// the values of a that aren't in b
+	static void AndNot(const RoaringBitmap& a, const RoaringBitmap& b, RoaringBitmap& out);
+
+	// 1 for the values below count and 0 for the rest
+	void ToMask(uint8_t* mask, uint32_t count) const;
+
+	void Serialize(std::string& out) const;
+	bool Deserialize(const uint8_t* data, size_t size);
+private:
+	struct Container
+	{
+		uint16_t				mKey;
+		uint32_t				mCardinality;
+		// one of them is used, the bits past ArrayLimit values
+		std::vector<uint16_t>	mArray;
+		std::vector<uint64_t>	mBits;
+
+		bool IsBitmap() const { return !mBits.empty(); }
+	};
+
+	std::vector<Container>		mContainers;
+
+	static void ToBitmap(Container& c);
+	static void Normalize(Container& c);
+	static void AndContainers(const Container& a, const Container& b, Container& out);
+	static void OrContainers(const Container& a, const Container& b, Container& out);
+	static void AndNotContainers(const Container& a, const Container& b, Container& out);
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// the index file next to a column archive, foo.gac indexes into foo.gai
+std::string ColumnIndexFilename(const std::string& archiveFilename);
+
+// Writes a bitmap of the rows of each value of every (track_event) column in each block of the archive,
+// built over the blocks in parallel. Integer, enum and string columns are indexed, strings by their code
+bool BuildColumnIndex(const ColumnarReader& file, const std::string& filename, int numThreads, std::string& error);
+
+class ColumnIndexReader
+{
+public:
+	// the index has to be built from the archive it is opened with
+	bool Open(const std::string& filename, const ColumnarReader& file, std::string& error);
+	void Close();
+
+	bool IsOpen() const { return mFile.IsOpen(); }
+	bool HasColumn(size_t column) const { return column < mColumnSlots.size() && mColumnSlots[column] >= 0; }
+
+	// the rows of the block with the value, empty when it has none. false when the column isn't indexed
+	bool GetBitmap(size_t block, size_t column, int64_t value, RoaringBitmap& bitmap) const;
+private:
+	struct Entry
+	{
+		int64_t		mValue;
+		uint64_t	mOffset;
+		uint32_t	mSize;
+	};
+
+	MappedFile				mFile;
+	size_t					mNumBlocks;
+	// the index slot of each archive column, -1 when it isn't indexed
+	std::vector<int>		mColumnSlots;
+	// the sorted entries of slot s in block b are mEntries[mRanges[s * blocks + b], mRanges[s * blocks + b + 1])
+	std::vector<size_t>		mRanges;
+	std::vector<Entry>		mEntries;
+};
+
+#endif
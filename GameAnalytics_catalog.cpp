@@ -0,0 +1,135 @@
+#include "GameAnalytics_catalog.h"
+
+#include <cstdlib>
+#include <climits>
+
+//////////////////////////////////////////////////////////////////////////
+
+SessionCatalogEntry::SessionCatalogEntry()
+	: mStartTime(0)
+	, mEndTime(0)
+	, mDuration(0)
+	, mEventCount(0)
+{
+}
+
+SessionCatalogQuery::SessionCatalogQuery()
+	: mStartMin(LLONG_MIN)
+	, mStartMax(LLONG_MAX)
+	, mMinDuration(0)
+	, mLimit(0)
+	, mNewestFirst(true)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+std::string SessionCatalog::StartKey()
+{
+	return "sessions:start";
+}
+
+std::string SessionCatalog::MapKey(const std::string& mapName)
+{
+	return "sessions:map:" + mapName;
+}
+
+std::string SessionCatalog::GameKey(const std::string& gameName)
+{
+	return "sessions:game:" + gameName;
+}
+
+std::string SessionCatalog::VersionKey(const std::string& gameVersion)
+{
+	return "sessions:version:" + gameVersion;
+}
+
+std::string SessionCatalog::EntryKey(const std::string& session)
+{
+	return session + ":catalog";
+}
+
+void SessionCatalog::ToFields(const SessionCatalogEntry& entry, std::vector< std::pair<std::string, std::string> >& fields)
+{
+	fields.clear();
+	fields.push_back(std::make_pair("start", std::to_string(entry.mStartTime)));
+	fields.push_back(std::make_pair("end", std::to_string(entry.mEndTime)));
+	fields.push_back(std::make_pair("duration", std::to_string(entry.mDuration)));
+	fields.push_back(std::make_pair("events", std::to_string(entry.mEventCount)));
+
+	if (!entry.mMapName.empty())
+		fields.push_back(std::make_pair("mapName", entry.mMapName));
+	if (!entry.mGameName.empty())
+		fields.push_back(std::make_pair("gameName", entry.mGameName));
+	if (!entry.mGameVersion.empty())
+		fields.push_back(std::make_pair("gameVersion", entry.mGameVersion));
+	if (!entry.mArchive.empty())
+		fields.push_back(std::make_pair("archive", entry.mArchive));
+}
+
+void SessionCatalog::FromFields(const std::vector< std::pair<std::string, std::string> >& fields, SessionCatalogEntry& entry)
+{
+	for (size_t i = 0; i < fields.size(); ++i)
+	{
+		const std::string& name = fields[i].first;
+		const std::string& value = fields[i].second;
+
+		if (name == "start")
+			entry.mStartTime = strtoll(value.c_str(), NULL, 10);
+		else if (name == "end")
+			entry.mEndTime = strtoll(value.c_str(), NULL, 10);
+		else if (name == "duration")
+			entry.mDuration = strtoll(value.c_str(), NULL, 10);
+		else if (name == "events")
+			entry.mEventCount = strtoll(value.c_str(), NULL, 10);
+		else if (name == "mapName")
+			entry.mMapName = value;
+		else if (name == "gameName")
+			entry.mGameName = value;
+		else if (name == "gameVersion")
+			entry.mGameVersion = value;
+		else if (name == "archive")
+			entry.mArchive = value;
+	}
+}
+
+std::string SessionCatalog::SelectIndex(const SessionCatalogQuery& query)
+{
+	// a version is usually one build of one game, a map is shared by fewer sessions than a game
+	if (!query.mGameVersion.empty())
+		return VersionKey(query.mGameVersion);
+	if (!query.mMapName.empty())
+		return MapKey(query.mMapName);
+	if (!query.mGameName.empty())
+		return GameKey(query.mGameName);
+	return StartKey();
+}
+
+bool SessionCatalog::NeedsFilter(const SessionCatalogQuery& query)
+{
+	const int fields = (query.mMapName.empty() ? 0 : 1) + (query.mGameName.empty() ? 0 : 1) + (query.mGameVersion.empty() ? 0 : 1);
+	return fields > 1 || query.mMinDuration > 0;
+}
+
+bool SessionCatalog::Matches(const SessionCatalogQuery& query, const SessionCatalogEntry& entry)
+{
+	if (!query.mMapName.empty() && entry.mMapName != query.mMapName)
+		return false;
+	if (!query.mGameName.empty() && entry.mGameName != query.mGameName)
+		return false;
+	if (!query.mGameVersion.empty() && entry.mGameVersion != query.mGameVersion)
+		return false;
+	if (entry.mDuration < query.mMinDuration)
+		return false;
+	return entry.mStartTime >= query.mStartMin && entry.mStartTime <= query.mStartMax;
+}
+
+std::string SessionCatalog::MinScore(const SessionCatalogQuery& query)
+{
+	return query.mStartMin == LLONG_MIN ? "-inf" : std::to_string(query.mStartMin);
+}
+
+std::string SessionCatalog::MaxScore(const SessionCatalogQuery& query)
+{
+	return query.mStartMax == LLONG_MAX ? "+inf" : std::to_string(query.mStartMax);
+}
@@ -0,0 +1,77 @@
+#ifndef GAMEANALYTICS_CATALOG_H
+#define GAMEANALYTICS_CATALOG_H
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////
+
+// a session as the catalog has it
+struct SessionCatalogEntry
+{
+	std::string		mSession;
+	// unix milliseconds, the end is 0 while the session runs
+	int64_t			mStartTime;
+	int64_t			mEndTime;
+	// milliseconds, as of the last update of a running session
+	int64_t			mDuration;
+	int64_t			mEventCount;
+	// from the GameInfo of the session, empty until it is sent
+	std::string		mMapName;
+	std::string		mGameName;
+	std::string		mGameVersion;
+	// the file the keys of the session were moved to, see SessionArchiver
+	std::string		mArchive;
+
+	SessionCatalogEntry();
+};
+
+struct SessionCatalogQuery
+{
+	// empty matches every value
+	std::string		mMapName;
+	std::string		mGameName;
+	std::string		mGameVersion;
+	// inclusive range of start times in unix milliseconds
+	int64_t			mStartMin;
+	int64_t			mStartMax;
+	int64_t			mMinDuration;
+	// 0 returns every match
+	size_t			mLimit;
+	bool			mNewestFirst;
+
+	SessionCatalogQuery();
+};
+
+// The keys and hash layout of the session catalog in redis. Every session is a member of the sessions:start sorted
+// set scored by its start time, and once its GameInfo is in of sessions:map:<mapName>, sessions:game:<gameName> and
+// sessions:version:<gameVersion> with the same score. A session that changes map is listed under each. The entry
+// itself is the <session>:catalog hash. A lookup ranges over a single sorted set, O(log n) plus the sessions it
+// reads, and filters those by the fields the set didn't cover.
+class SessionCatalog
+{
+public:
+	static std::string StartKey();
+	static std::string MapKey(const std::string& mapName);
+	static std::string GameKey(const std::string& gameName);
+	static std::string VersionKey(const std::string& gameVersion);
+	static std::string EntryKey(const std::string& session);
+
+	// the hash fields of an entry, the GameInfo ones only when set
+	static void ToFields(const SessionCatalogEntry& entry, std::vector< std::pair<std::string, std::string> >& fields);
+	static void FromFields(const std::vector< std::pair<std::string, std::string> >& fields, SessionCatalogEntry& entry);
+
+	// the sorted set to range over, the most selective field the query has: version, then map, then game
+	static std::string SelectIndex(const SessionCatalogQuery& query);
+	// whether the sessions of the index need checking against the entries, or the range is the answer
+	static bool NeedsFilter(const SessionCatalogQuery& query);
+	static bool Matches(const SessionCatalogQuery& query, const SessionCatalogEntry& entry);
+
+	// score bounds of the start time range, -inf and +inf when open
+	static std::string MinScore(const SessionCatalogQuery& query);
+	static std::string MaxScore(const SessionCatalogQuery& query);
+};
+
+#endif
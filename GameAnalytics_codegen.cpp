@@ -0,0 +1,164 @@
+#include "GameAnalytics_codegen.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////
+
+void JsonAppendInt(std::string& out, int32_t val)
+{
+	char buffer[16];
+	const int len = snprintf(buffer, sizeof(buffer), "%d", val);
+	out.append(buffer, len);
+}
+
+void JsonAppendUInt(std::string& out, uint32_t val)
+{
+	char buffer[16];
+	const int len = snprintf(buffer, sizeof(buffer), "%u", val);
+	out.append(buffer, len);
+}
+
+void JsonAppendInt64(std::string& out, int64_t val)
+{
+	char buffer[32];
+	const int len = snprintf(buffer, sizeof(buffer), "\"%lld\"", (long long)val);
+	out.append(buffer, len);
+}
+
+void JsonAppendUInt64(std::string& out, uint64_t val)
+{
+	char buffer[32];
+	const int len = snprintf(buffer, sizeof(buffer), "\"%llu\"", (unsigned long long)val);
+	out.append(buffer, len);
+}
+
+static bool JsonAppendNonFinite(std::string& out, double val)
+{
+	if (std::isnan(val))
+		out += "\"NaN\"";
+	else if (std::isinf(val))
+		out += val > 0 ? "\"Infinity\"" : "\"-Infinity\"";
+	else
+		return false;
+	return true;
+}
+
+void JsonAppendFloat(std::string& out, float val)
+{
+	if (JsonAppendNonFinite(out, val))
+		return;
+
+	// shortest of the two precisions that round trips
+	char buffer[32];
+	int len = snprintf(buffer, sizeof(buffer), "%.6g", val);
+	if (strtof(buffer, NULL) != val)
+		len = snprintf(buffer, sizeof(buffer), "%.9g", val);
+	out.append(buffer, len);
+}
+
+void JsonAppendDouble(std::string& out, double val)
+{
+	if (JsonAppendNonFinite(out, val))
+		return;
+
+	char buffer[32];
+	int len = snprintf(buffer, sizeof(buffer), "%.15g", val);
+	if (strtod(buffer, NULL) != val)
+		len = snprintf(buffer, sizeof(buffer), "%.17g", val);
+	out.append(buffer, len);
+}
+
+void JsonAppendString(std::string& out, const std::string& val)
+{
+	static const char* hex = "0123456789abcdef";
+
+	out += '"';
+	for (size_t i = 0; i < val.size(); ++i)
+	{
+		const unsigned char c = (unsigned char)val[i];
+		switch (c)
+		{
+		case '"': out += "\\\""; break;
+		case '\\': out += "\\\\"; break;
+		case '\b': out += "\\b"; break;
+		case '\f': out += "\\f"; break;
+		case '\n': out += "\\n"; break;
+		case '\r': out += "\\r"; break;
+		case '\t': out += "\\t"; break;
+		default:
+			if (c < 0x20)
+			{
+				out += "\\u00";
+				out += hex[c >> 4];
+				out += hex[c & 0xf];
+			}
+			else
+			{
+				out += (char)c;
+			}
+			break;
+		}
+	}
+	out += '"';
+}
+
+void JsonAppendBytes(std::string& out, const std::string& val)
+{
+	static const char* table = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	out += '"';
+	size_t i = 0;
+	for (; i + 2 < val.size(); i += 3)
+	{
+		const uint32_t v = ((uint8_t)val[i] << 16) | ((uint8_t)val[i + 1] << 8) | (uint8_t)val[i + 2];
+		out += table[(v >> 18) & 63];
+		out += table[(v >> 12) & 63];
+		out += table[(v >> 6) & 63];
+		out += table[v & 63];
+	}
+
+	const size_t remaining = val.size() - i;
+	if (remaining > 0)
+	{
+		uint32_t v = (uint8_t)val[i] << 16;
+		if (remaining > 1)
+			v |= (uint8_t)val[i + 1] << 8;
+
+		out += table[(v >> 18) & 63];
+		out += table[(v >> 12) & 63];
+		out += remaining > 1 ? table[(v >> 6) & 63] : '=';
+		out += '=';
+	}
+	out += '"';
+}
+
+void JsonAppendEnum(std::string& out, const std::string& name, int val)
+{
+	// values this build doesn't know about go out as numbers
+	if (name.empty())
+		JsonAppendInt(out, val);
+	else
+		JsonAppendString(out, name);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void KeyFormatInt(std::string& out, int64_t val)
+{
+	char buffer[32];
+	out.assign(buffer, snprintf(buffer, sizeof(buffer), "%lld", (long long)val));
+}
+
+void KeyFormatUInt(std::string& out, uint64_t val)
+{
+	char buffer[32];
+	out.assign(buffer, snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)val));
+}
+
+void KeyFormatFloat(std::string& out, double val)
+{
+	char buffer[512];
+	out.assign(buffer, snprintf(buffer, sizeof(buffer), "%f", val));
+}
@@ -0,0 +1,56 @@
+#ifndef GAMEANALYTICS_CODEGEN_H
+#define GAMEANALYTICS_CODEGEN_H
+
+#include <string>
+#include <cstdint>
+
+#include "analytics.pb.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// Routing traits and encoders for one message type, emitted by protoc-gen-analytics (AnalyticsCodeGen)
+// into analytics.ga.cc so the send path doesn't walk reflection per field per event.
+// Any of the functions may be NULL, in which case the caller falls back to the reflection path.
+struct EventEncoder
+{
+	const char*				mName;
+	Analytics::RedisKeyType	mKeyType;
+	bool					mJsonEncoding;
+
+	// the payload as stored in redis, json for useJsonEncoding types, otherwise the binary encoding
+	void					(*mEncode)(const google::protobuf::Message& msg, std::string& payload);
+	// the rediskeysuffix, false if the type has none
+	bool					(*mKeySuffix)(const google::protobuf::Message& msg, std::string& suffix);
+	// the redishmsetkey, or the type name when there is no option
+	bool					(*mHashKey)(const google::protobuf::Message& msg, std::string& field);
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// helpers used by the generated code. the json output follows the MessageToJsonString defaults,
+// lowerCamelCase names, default values omitted, 64 bit integers quoted, enums by name, bytes as base64
+
+inline void JsonBeginField(std::string& out, bool& first, const char* key)
+{
+	if (!first)
+		out += ',';
+	first = false;
+	out += key;
+}
+
+void JsonAppendInt(std::string& out, int32_t val);
+void JsonAppendUInt(std::string& out, uint32_t val);
+void JsonAppendInt64(std::string& out, int64_t val);
+void JsonAppendUInt64(std::string& out, uint64_t val);
+void JsonAppendFloat(std::string& out, float val);
+void JsonAppendDouble(std::string& out, double val);
+void JsonAppendString(std::string& out, const std::string& val);
+void JsonAppendBytes(std::string& out, const std::string& val);
+void JsonAppendEnum(std::string& out, const std::string& name, int val);
+
+// key fragments, formatted the same way as the reflection path
+void KeyFormatInt(std::string& out, int64_t val);
+void KeyFormatUInt(std::string& out, uint64_t val);
+void KeyFormatFloat(std::string& out, double val);
+
+#endif
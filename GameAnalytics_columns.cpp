@@ -0,0 +1,550 @@
+#include "GameAnalytics_columns.h"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+// 'GACF' and the layout version, at the start of the file and again after the footer offset at its end
+static const uint32_t ColumnFileMagic = 0x46434147;
+static const uint32_t ColumnFileVersion = 1;
+static const size_t MaxFlattenDepth = 4;
+static const char* TimeColumn = "_time";
+
+size_t ColumnTypeSize(ColumnType type)
+{
+	switch (type)
+	{
+	case ColumnType_Int64:
+	case ColumnType_UInt64:
+	case ColumnType_Double:
+		return 8;
+	default:
+		return 4;
+	}
+}
+
+static void CollectColumns(const google::protobuf::Descriptor* desc, const std::string& prefix, std::vector<const google::protobuf::FieldDescriptor*>& path, std::vector<ColumnInfo>& columns)
+{
+	for (int i = 0; i < desc->field_count(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* fdesc = desc->field(i);
+		if (fdesc->is_repeated() || fdesc->type() == google::protobuf::FieldDescriptor::TYPE_BYTES)
+			continue;
+
+		path.push_back(fdesc);
+
+		if (fdesc->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
+		{
+			if (path.size() < MaxFlattenDepth)
+				CollectColumns(fdesc->message_type(), prefix + fdesc->name() + "_", path, columns);
+		}
+		else
+		{
+			ColumnInfo column;
+			column.mName = prefix + fdesc->name();
+			column.mPath = path;
+
+			switch (fdesc->cpp_type())
+			{
+			case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+				column.mType = ColumnType_UInt32;
+				break;
+			case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+				column.mType = ColumnType_Int64;
+				break;
+			case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+				column.mType = ColumnType_UInt64;
+				break;
+			case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+				column.mType = ColumnType_Float;
+				break;
+			case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+				column.mType = ColumnType_Double;
+				break;
+			case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+				column.mType = ColumnType_String;
+				break;
+			default:
+				// int32, enums and bools
+				column.mType = ColumnType_Int32;
+				break;
+			}
+			columns.push_back(column);
+		}
+
+		path.pop_back();
+	}
+}
+
+void CollectArchiveColumns(const google::protobuf::Descriptor* desc, std::vector<ColumnInfo>& columns)
+{
+	columns.clear();
+
+	ColumnInfo time;
+	time.mName = TimeColumn;
+	time.mType = ColumnType_Int64;
+	columns.push_back(time);
+
+	std::vector<const google::protobuf::FieldDescriptor*> path;
+	CollectColumns(desc, "", path, columns);
+}
+
+template<typename T>
+static void AppendValue(std::vector<uint8_t>& values, T value)
+{
+	const size_t size = values.size();
+	values.resize(size + sizeof(T));
+	memcpy(&values[size], &value, sizeof(T));
+}
+
+// past 2^53 a double rounds to the nearest even, so the stat is nudged out to still bound the value
+static double Outward(double value, bool down)
+{
+	return fabs(value) >= 9007199254740992.0 ? nextafter(value, down ? -HUGE_VAL : HUGE_VAL) : value;
+}
+
+template<typename T>
+static ColumnStats ComputeStats(const uint8_t* data, uint32_t rows)
+{
+	ColumnStats stats;
+	stats.mMin = HUGE_VAL;
+	stats.mMax = -HUGE_VAL;
+
+	bool first = true;
+	T minValue = T(), maxValue = T();
+	for (uint32_t i = 0; i < rows; ++i)
+	{
+		T value;
+		memcpy(&value, data + i * sizeof(T), sizeof(T));
+
+		// nan compares false both ways and doesn't narrow anything
+		if (value != value)
+			continue;
+
+		if (first || value < minValue)
+			minValue = value;
+		if (first || value > maxValue)
+			maxValue = value;
+		first = false;
+	}
+
+	if (!first)
+	{
+		stats.mMin = Outward((double)minValue, true);
+		stats.mMax = Outward((double)maxValue, false);
+	}
+	return stats;
+}
+
+static void AppendString(std::string& buffer, const std::string& str)
+{
+	const uint32_t size = (uint32_t)str.size();
+	buffer.append((const char*)&size, sizeof(size));
+	buffer.append(str);
+}
+
+template<typename T>
+static void AppendPod(std::string& buffer, T value)
+{
+	buffer.append((const char*)&value, sizeof(T));
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ColumnarWriter::ColumnarWriter(const google::protobuf::Descriptor* desc, uint32_t blockRows)
+	: mDescriptor(desc)
+	, mBlockRows(std::max(blockRows, 1u))
+	, mFile(NULL)
+	, mOffset(0)
+	, mNumRows(0)
+	, mFailed(false)
+	, mRows(0)
+{
+	CollectArchiveColumns(desc, mColumns);
+	mValues.resize(mColumns.size());
+}
+
+ColumnarWriter::~ColumnarWriter()
+{
+	if (mFile != NULL)
+	{
+		std::string error;
+		Close(error);
+	}
+}
+
+bool ColumnarWriter::Open(const std::string& filename, std::string& error)
+{
+	if (mFile != NULL && !Close(error))
+		return false;
+
+	mFile = fopen(filename.c_str(), "wb");
+	if (mFile == NULL)
+	{
+		error = "failed to open " + filename + " for writing";
+		return false;
+	}
+
+	mFilename = filename;
+	mOffset = 0;
+	mNumRows = 0;
+	mFailed = false;
+	mRows = 0;
+	mBlocks.clear();
+	mStringCodes.clear();
+	mStrings.clear();
+	for (size_t i = 0; i < mValues.size(); ++i)
+		mValues[i].clear();
+
+	const uint32_t header[2] = { ColumnFileMagic, ColumnFileVersion };
+	return Write(header, sizeof(header));
+}
+
+bool ColumnarWriter::AddEvent(const google::protobuf::Message& msg, int64_t timeStamp)
+{
+	if (mFile == NULL || msg.GetDescriptor() != mDescriptor)
+		return false;
+
+	AppendValue(mValues[0], timeStamp);
+
+	for (size_t c = 1; c < mColumns.size(); ++c)
+	{
+		const ColumnInfo& column = mColumns[c];
+
+		// unset messages on the way read as their defaults
+		const google::protobuf::Message* parent = &msg;
+		for (size_t i = 0; i + 1 < column.mPath.size(); ++i)
+			parent = &parent->GetReflection()->GetMessage(*parent, column.mPath[i]);
+
+		const google::protobuf::Reflection* reflection = parent->GetReflection();
+		const google::protobuf::FieldDescriptor* fdesc = column.mPath.back();
+		std::vector<uint8_t>& values = mValues[c];
+
+		switch (fdesc->cpp_type())
+		{
+		case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+			AppendValue(values, reflection->GetInt32(*parent, fdesc));
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+			AppendValue(values, (int32_t)reflection->GetEnumValue(*parent, fdesc));
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+			AppendValue(values, (int32_t)reflection->GetBool(*parent, fdesc));
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+			AppendValue(values, reflection->GetUInt32(*parent, fdesc));
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+			AppendValue(values, (int64_t)reflection->GetInt64(*parent, fdesc));
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+			AppendValue(values, (uint64_t)reflection->GetUInt64(*parent, fdesc));
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+			AppendValue(values, reflection->GetFloat(*parent, fdesc));
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+			AppendValue(values, reflection->GetDouble(*parent, fdesc));
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+		{
+			std::string scratch;
+			const std::string& str = reflection->GetStringReference(*parent, fdesc, &scratch);
+
+			std::pair<std::map<std::string, uint32_t>::iterator, bool> it = mStringCodes.insert(std::make_pair(str, (uint32_t)mStrings.size()));
+			if (it.second)
+				mStrings.push_back(str);
+			AppendValue(values, it.first->second);
+			break;
+		}
+		default:
+			AppendValue(values, (int32_t)0);
+			break;
+		}
+	}
+
+	++mNumRows;
+	if (++mRows >= mBlockRows)
+		return FlushBlock();
+	return true;
+}
+
+bool ColumnarWriter::Write(const void* data, size_t size)
+{
+	if (size > 0 && fwrite(data, 1, size, mFile) != size)
+		mFailed = true;
+	mOffset += size;
+	return !mFailed;
+}
+
+bool ColumnarWriter::FlushBlock()
+{
+	if (mRows == 0)
+		return !mFailed;
+
+	Block block;
+	block.mRows = mRows;
+
+	for (size_t c = 0; c < mColumns.size(); ++c)
+	{
+		// columns start 8 byte aligned so the mapped values can be read in place
+		static const uint8_t padding[8] = {};
+		Write(padding, (size_t)((8 - (mOffset & 7)) & 7));
+
+		const uint8_t* data = mValues[c].data();
+		ColumnStats stats;
+		switch (mColumns[c].mType)
+		{
+		case ColumnType_Int32: stats = ComputeStats<int32_t>(data, mRows); break;
+		case ColumnType_UInt32: stats = ComputeStats<uint32_t>(data, mRows); break;
+		case ColumnType_Int64: stats = ComputeStats<int64_t>(data, mRows); break;
+		case ColumnType_UInt64: stats = ComputeStats<uint64_t>(data, mRows); break;
+		case ColumnType_Float: stats = ComputeStats<float>(data, mRows); break;
+		case ColumnType_Double: stats = ComputeStats<double>(data, mRows); break;
+		default: stats = ComputeStats<uint32_t>(data, mRows); break;
+		}
+
+		block.mOffsets.push_back(mOffset);
+		block.mStats.push_back(stats);
+
+		Write(data, mValues[c].size());
+		mValues[c].clear();
+	}
+
+	mBlocks.push_back(block);
+	mRows = 0;
+	return !mFailed;
+}
+
+bool ColumnarWriter::Close(std::string& error)
+{
+	if (mFile == NULL)
+		return true;
+
+	FlushBlock();
+
+	std::string footer;
+	AppendString(footer, mDescriptor->full_name());
+
+	AppendPod(footer, (uint32_t)mColumns.size());
+	for (size_t c = 0; c < mColumns.size(); ++c)
+	{
+		AppendString(footer, mColumns[c].mName);
+		AppendPod(footer, (uint32_t)mColumns[c].mType);
+	}
+
+	AppendPod(footer, (uint32_t)mStrings.size());
+	for (size_t i = 0; i < mStrings.size(); ++i)
+		AppendString(footer, mStrings[i]);
+
+	AppendPod(footer, (uint32_t)mBlocks.size());
+	for (size_t b = 0; b < mBlocks.size(); ++b)
+	{
+		AppendPod(footer, mBlocks[b].mRows);
+		for (size_t c = 0; c < mColumns.size(); ++c)
+		{
+			AppendPod(footer, mBlocks[b].mOffsets[c]);
+			AppendPod(footer, mBlocks[b].mStats[c].mMin);
+			AppendPod(footer, mBlocks[b].mStats[c].mMax);
+		}
+	}
+
+	const uint64_t footerOffset = mOffset;
+	AppendPod(footer, footerOffset);
+	AppendPod(footer, ColumnFileMagic);
+	AppendPod(footer, ColumnFileVersion);
+	Write(footer.data(), footer.size());
+
+	if (fclose(mFile) != 0)
+		mFailed = true;
+	mFile = NULL;
+	mBlocks.clear();
+
+	if (mFailed)
+	{
+		error = "failed to write " + mFilename;
+		return false;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// bounds checked reads over the mapped footer
+struct FooterCursor
+{
+	const uint8_t*	mData;
+	uint64_t		mSize;
+	uint64_t		mPos;
+
+	template<typename T>
+	bool Read(T& value)
+	{
+		if (mSize - mPos < sizeof(T))
+			return false;
+		memcpy(&value, mData + mPos, sizeof(T));
+		mPos += sizeof(T);
+		return true;
+	}
+
+	bool ReadString(std::string& str)
+	{
+		uint32_t size = 0;
+		if (!Read(size) || mSize - mPos < size)
+			return false;
+		str.assign((const char*)mData + mPos, size);
+		mPos += size;
+		return true;
+	}
+};
+
+ColumnarReader::ColumnarReader()
+	: mDescriptor(NULL)
+	, mNumRows(0)
+{
+}
+
+bool ColumnarReader::Open(const std::string& filename, std::string& error)
+{
+	Close();
+
+	if (!mFile.Open(filename, error))
+		return false;
+
+	const uint8_t* data = mFile.GetData();
+	const uint64_t size = mFile.GetSize();
+
+	uint32_t header[2] = {};
+	uint64_t footerOffset = 0;
+	uint32_t trailer[2] = {};
+	if (size >= sizeof(header) + sizeof(footerOffset) + sizeof(trailer))
+	{
+		memcpy(header, data, sizeof(header));
+		memcpy(&footerOffset, data + size - sizeof(trailer) - sizeof(footerOffset), sizeof(footerOffset));
+		memcpy(trailer, data + size - sizeof(trailer), sizeof(trailer));
+	}
+
+	if (header[0] != ColumnFileMagic || trailer[0] != ColumnFileMagic || header[1] != ColumnFileVersion || trailer[1] != ColumnFileVersion || footerOffset >= size)
+	{
+		error = filename + " is not a column archive of version " + std::to_string(ColumnFileVersion);
+		Close();
+		return false;
+	}
+
+	FooterCursor cursor = { data, size - sizeof(trailer) - sizeof(footerOffset), footerOffset };
+
+	bool ok = cursor.ReadString(mTypeName);
+
+	uint32_t numColumns = 0;
+	ok = ok && cursor.Read(numColumns);
+	for (uint32_t c = 0; ok && c < numColumns; ++c)
+	{
+		ColumnInfo column;
+		uint32_t type = 0;
+		ok = cursor.ReadString(column.mName) && cursor.Read(type) && type <= ColumnType_String;
+		column.mType = (ColumnType)type;
+		mColumns.push_back(column);
+	}
+
+	uint32_t numStrings = 0;
+	ok = ok && cursor.Read(numStrings);
+	for (uint32_t i = 0; ok && i < numStrings; ++i)
+	{
+		mStrings.push_back(std::string());
+		ok = cursor.ReadString(mStrings.back());
+	}
+
+	uint32_t numBlocks = 0;
+	ok = ok && cursor.Read(numBlocks);
+	for (uint32_t b = 0; ok && b < numBlocks; ++b)
+	{
+		uint32_t rows = 0;
+		ok = cursor.Read(rows);
+		mBlockRows.push_back(rows);
+		mBlockStarts.push_back(mNumRows);
+		mNumRows += rows;
+
+		for (uint32_t c = 0; ok && c < numColumns; ++c)
+		{
+			uint64_t offset = 0;
+			ColumnStats stats;
+			ok = cursor.Read(offset) && cursor.Read(stats.mMin) && cursor.Read(stats.mMax);
+
+			// the values have to lie before the footer
+			ok = ok && offset <= footerOffset && (footerOffset - offset) / ColumnTypeSize(mColumns[c].mType) >= rows;
+			mOffsets.push_back(offset);
+			mStats.push_back(stats);
+		}
+	}
+
+	if (!ok)
+	{
+		error = filename + " has a damaged footer";
+		Close();
+		return false;
+	}
+
+	// the fields of the columns, for readers that decode enums or match the event type
+	mDescriptor = google::protobuf::DescriptorPool::generated_pool()->FindMessageTypeByName(mTypeName);
+	if (mDescriptor != NULL)
+	{
+		std::vector<ColumnInfo> fields;
+		CollectArchiveColumns(mDescriptor, fields);
+		for (size_t c = 0; c < mColumns.size(); ++c)
+		{
+			for (size_t f = 0; f < fields.size(); ++f)
+			{
+				if (fields[f].mName == mColumns[c].mName && fields[f].mType == mColumns[c].mType)
+				{
+					mColumns[c].mPath = fields[f].mPath;
+					break;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+void ColumnarReader::Close()
+{
+	mFile.Close();
+	mTypeName.clear();
+	mDescriptor = NULL;
+	mColumns.clear();
+	mNumRows = 0;
+	mBlockRows.clear();
+	mBlockStarts.clear();
+	mOffsets.clear();
+	mStats.clear();
+	mStrings.clear();
+}
+
+int ColumnarReader::FindColumn(const std::string& name) const
+{
+	for (size_t c = 0; c < mColumns.size(); ++c)
+	{
+		if (mColumns[c].mName == name)
+			return (int)c;
+	}
+	return -1;
+}
+
+bool ColumnarReader::BlockOverlaps(size_t block, size_t column, double minValue, double maxValue) const
+{
+	const ColumnStats& stats = GetStats(block, column);
+	return stats.mMax >= minValue && stats.mMin <= maxValue;
+}
+
+bool ColumnarReader::FindString(const std::string& str, uint32_t& code) const
+{
+	std::vector<std::string>::const_iterator it = std::find(mStrings.begin(), mStrings.end(), str);
+	if (it == mStrings.end())
+		return false;
+
+	code = (uint32_t)(it - mStrings.begin());
+	return true;
+}
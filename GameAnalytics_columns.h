@@ -0,0 +1,158 @@
+#ifndef GAMEANALYTICS_COLUMNS_H
+#define GAMEANALYTICS_COLUMNS_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+
+#include "analytics.pb.h"
+#include "GameAnalytics_mmap.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// The archive layout of events, one file per message type with a column per scalar field. Singular message
+// fields are flattened into parent_child columns like the sqlite tables, so a Vec3 becomes three float
+// columns, and the _time column holds the session time of each event. Rows are written in blocks that
+// keep each column contiguous with its min and max, so a scan maps the file and only touches the columns
+// it reads in the blocks its ranges can match. Enums and bools are stored as int32, strings as uint32
+// codes into a dictionary of the file, bytes and repeated fields are left out.
+enum ColumnType
+{
+	ColumnType_Int32,
+	ColumnType_UInt32,
+	ColumnType_Int64,
+	ColumnType_UInt64,
+	ColumnType_Float,
+	ColumnType_Double,
+	ColumnType_String,
+};
+
+size_t ColumnTypeSize(ColumnType type);
+
+struct ColumnInfo
+{
+	std::string										mName;
+	ColumnType										mType;
+	// the fields down to the value, empty when the reader couldn't find the type in the generated pool
+	std::vector<const google::protobuf::FieldDescriptor*>	mPath;
+};
+
+// integer stats are rounded outwards where a double can't hold them
+struct ColumnStats
+{
+	double	mMin;
+	double	mMax;
+};
+
+// the columns of a message type, _time first
+void CollectArchiveColumns(const google::protobuf::Descriptor* desc, std::vector<ColumnInfo>& columns);
+
+//////////////////////////////////////////////////////////////////////////
+
+class ColumnarWriter
+{
+public:
+	enum { DefaultBlockRows = 65536 };
+
+	ColumnarWriter(const google::protobuf::Descriptor* desc, uint32_t blockRows = DefaultBlockRows);
+	~ColumnarWriter();
+
+	bool Open(const std::string& filename, std::string& error);
+	// false for events of another type
+	bool AddEvent(const google::protobuf::Message& msg, int64_t timeStamp);
+	// writes the last block and the footer, the file isn't readable before
+	bool Close(std::string& error);
+
+	bool IsOpen() const { return mFile != NULL; }
+	uint64_t GetNumRows() const { return mNumRows; }
+private:
+	struct Block
+	{
+		uint32_t				mRows;
+		std::vector<uint64_t>	mOffsets;
+		std::vector<ColumnStats> mStats;
+	};
+
+	const google::protobuf::Descriptor*	mDescriptor;
+	uint32_t							mBlockRows;
+	std::vector<ColumnInfo>				mColumns;
+
+	FILE*								mFile;
+	std::string							mFilename;
+	uint64_t							mOffset;
+	uint64_t							mNumRows;
+	bool								mFailed;
+
+	// the values of the current block, column by column
+	std::vector< std::vector<uint8_t> >	mValues;
+	uint32_t							mRows;
+	std::vector<Block>					mBlocks;
+
+	std::map<std::string, uint32_t>		mStringCodes;
+	std::vector<std::string>			mStrings;
+
+	bool Write(const void* data, size_t size);
+	bool FlushBlock();
+
+	ColumnarWriter(const ColumnarWriter& other);
+	ColumnarWriter& operator=(const ColumnarWriter& other);
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+class ColumnarReader
+{
+public:
+	ColumnarReader();
+
+	bool Open(const std::string& filename, std::string& error);
+	void Close();
+
+	const std::string& GetTypeName() const { return mTypeName; }
+	// NULL when the type isn't in the generated pool
+	const google::protobuf::Descriptor* GetDescriptor() const { return mDescriptor; }
+
+	size_t GetNumColumns() const { return mColumns.size(); }
+	const ColumnInfo& GetColumn(size_t column) const { return mColumns[column]; }
+	// -1 when the file has no such column
+	int FindColumn(const std::string& name) const;
+
+	uint64_t GetNumRows() const { return mNumRows; }
+	size_t GetNumBlocks() const { return mBlockRows.size(); }
+	uint32_t GetBlockRows(size_t block) const { return mBlockRows[block]; }
+	// the first row of the block in the file
+	uint64_t GetBlockStart(size_t block) const { return mBlockStarts[block]; }
+	const ColumnStats& GetStats(size_t block, size_t column) const { return mStats[block * mColumns.size() + column]; }
+	// false when the stats of the block rule out any value in [minValue, maxValue]
+	bool BlockOverlaps(size_t block, size_t column, double minValue, double maxValue) const;
+
+	// GetBlockRows values of the column type, mapped from the file
+	const void* GetData(size_t block, size_t column) const { return mFile.GetData() + mOffsets[block * mColumns.size() + column]; }
+	template<typename T>
+	const T* GetValues(size_t block, size_t column) const { return static_cast<const T*>(GetData(block, column)); }
+
+	// the dictionary of string columns
+	size_t GetNumStrings() const { return mStrings.size(); }
+	const std::string& GetString(uint32_t code) const { return mStrings[code]; }
+	// false when no row of the file has the string
+	bool FindString(const std::string& str, uint32_t& code) const;
+private:
+	MappedFile							mFile;
+
+	std::string							mTypeName;
+	const google::protobuf::Descriptor*	mDescriptor;
+	std::vector<ColumnInfo>				mColumns;
+	uint64_t							mNumRows;
+
+	std::vector<uint32_t>				mBlockRows;
+	std::vector<uint64_t>				mBlockStarts;
+	// block major, a column after another
+	std::vector<uint64_t>				mOffsets;
+	std::vector<ColumnStats>			mStats;
+
+	std::vector<std::string>			mStrings;
+};
+
+#endif
@@ -0,0 +1,96 @@
+#include "GameAnalytics_deadreckoning.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+DeadReckoningFilter::EntityState::EntityState()
+	: mState(0)
+	, mHasSent(false)
+	, mHasPrev(false)
+	, mDiscontinuity(false)
+	, mSentTime(0)
+	, mPrevTime(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+DeadReckoningFilter::DeadReckoningFilter(float tolerance)
+	: mTolerance(0.0f)
+{
+	SetTolerance(tolerance);
+}
+
+void DeadReckoningFilter::SetTolerance(float tolerance)
+{
+	mTolerance = tolerance > 0.0f ? tolerance : 0.0f;
+}
+
+bool DeadReckoningFilter::Filter(int entityIndex, uint64_t state, int64_t timeStamp, const Analytics::Vec3& position, bool extrapolate, Analytics::Vec3* velocityOut)
+{
+	EntityState& entity = mEntities[entityIndex];
+
+	// finite difference against the previous real sample, not the last sent one
+	Analytics::Vec3 velocity;
+	if (extrapolate && entity.mHasPrev && !entity.mDiscontinuity && timeStamp > entity.mPrevTime)
+	{
+		const float invDt = 1000.0f / (float)(timeStamp - entity.mPrevTime);
+		velocity.set_x((position.x() - entity.mPrevPos.x()) * invDt);
+		velocity.set_y((position.y() - entity.mPrevPos.y()) * invDt);
+		velocity.set_z((position.z() - entity.mPrevPos.z()) * invDt);
+	}
+
+	bool send = !entity.mHasSent || entity.mDiscontinuity || entity.mState != state || mTolerance <= 0.0f;
+	if (!send)
+	{
+		Analytics::Vec3 predicted;
+		Extrapolate(entity.mSentPos, entity.mSentVel, entity.mSentTime, timeStamp, predicted);
+
+		const float dx = position.x() - predicted.x();
+		const float dy = position.y() - predicted.y();
+		const float dz = position.z() - predicted.z();
+		send = (dx * dx + dy * dy + dz * dz) > mTolerance * mTolerance;
+	}
+
+	if (send)
+	{
+		entity.mHasSent = true;
+		entity.mSentTime = timeStamp;
+		entity.mSentPos = position;
+		entity.mSentVel = velocity;
+
+		if (velocityOut != NULL)
+			*velocityOut = velocity;
+	}
+
+	entity.mState = state;
+	entity.mDiscontinuity = false;
+	entity.mHasPrev = true;
+	entity.mPrevTime = timeStamp;
+	entity.mPrevPos = position;
+	return send;
+}
+
+void DeadReckoningFilter::MarkDiscontinuity(int entityIndex)
+{
+	EntityMap::iterator it = mEntities.find(entityIndex);
+	if (it != mEntities.end())
+		it->second.mDiscontinuity = true;
+}
+
+void DeadReckoningFilter::Remove(int entityIndex)
+{
+	mEntities.erase(entityIndex);
+}
+
+void DeadReckoningFilter::Clear()
+{
+	mEntities.clear();
+}
+
+void DeadReckoningFilter::Extrapolate(const Analytics::Vec3& position, const Analytics::Vec3& velocity, int64_t fromTime, int64_t toTime, Analytics::Vec3& positionOut)
+{
+	const float dt = (float)(toTime - fromTime) * 0.001f;
+	positionOut.set_x(position.x() + velocity.x() * dt);
+	positionOut.set_y(position.y() + velocity.y() * dt);
+	positionOut.set_z(position.z() + velocity.z() * dt);
+}
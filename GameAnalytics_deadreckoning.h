@@ -0,0 +1,59 @@
+#ifndef GAMEANALYTICS_DEADRECKONING_H
+#define GAMEANALYTICS_DEADRECKONING_H
+
+#include <map>
+#include <cstdint>
+
+#include "analytics.pb.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// Error bounded send suppression for entity positions. A sample is only sent when the position
+// extrapolated from the last sent sample deviates from the real one by more than the tolerance,
+// so a reader extrapolating the same way stays within the tolerance at every sample time.
+class DeadReckoningFilter
+{
+public:
+	DeadReckoningFilter(float tolerance = 0.0f);
+
+	// a tolerance of 0 sends every sample
+	void SetTolerance(float tolerance);
+	float GetTolerance() const { return mTolerance; }
+
+	// returns true if the sample should be sent. when extrapolate is set the sent samples
+	// are extrapolated linearly using velocityOut, otherwise readers are expected to hold the last position.
+	// state is an opaque signature of everything else about the entity, a change in it forces a send
+	bool Filter(int entityIndex, uint64_t state, int64_t timeStamp, const Analytics::Vec3& position, bool extrapolate, Analytics::Vec3* velocityOut);
+
+	// force the next sample of the entity to be sent without velocity, for deaths, teleports and the like
+	void MarkDiscontinuity(int entityIndex);
+	void Remove(int entityIndex);
+	void Clear();
+
+	// the reader side reconstruction, velocity is in units per second
+	static void Extrapolate(const Analytics::Vec3& position, const Analytics::Vec3& velocity, int64_t fromTime, int64_t toTime, Analytics::Vec3& positionOut);
+private:
+	struct EntityState
+	{
+		uint64_t		mState;
+		bool			mHasSent;
+		bool			mHasPrev;
+		bool			mDiscontinuity;
+
+		int64_t			mSentTime;
+		Analytics::Vec3	mSentPos;
+		Analytics::Vec3	mSentVel;
+
+		int64_t			mPrevTime;
+		Analytics::Vec3	mPrevPos;
+
+		EntityState();
+	};
+
+	typedef std::map<int, EntityState> EntityMap;
+	EntityMap		mEntities;
+
+	float			mTolerance;
+};
+
+#endif
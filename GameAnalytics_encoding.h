@@ -0,0 +1,57 @@
+#ifndef GAMEANALYTICS_ENCODING_H
+#define GAMEANALYTICS_ENCODING_H
+
+#include <string>
+#include <cstdint>
+
+// small helpers for the compact binary layouts, these match the protobuf varint/zigzag wire encoding
+
+inline uint64_t ZigZagEncode(int64_t v)
+{
+	return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+inline int64_t ZigZagDecode(uint64_t v)
+{
+	return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+inline void WriteVarint(std::string& out, uint64_t v)
+{
+	while (v >= 0x80)
+	{
+		out.push_back((char)(v | 0x80));
+		v >>= 7;
+	}
+	out.push_back((char)v);
+}
+
+inline void WriteSignedVarint(std::string& out, int64_t v)
+{
+	WriteVarint(out, ZigZagEncode(v));
+}
+
+// returns false if the buffer runs out before the varint terminates
+inline bool ReadVarint(const char*& cursor, const char* end, uint64_t& v)
+{
+	v = 0;
+	for (int shift = 0; shift < 64 && cursor < end; shift += 7)
+	{
+		const uint8_t b = (uint8_t)*cursor++;
+		v |= (uint64_t)(b & 0x7f) << shift;
+		if ((b & 0x80) == 0)
+			return true;
+	}
+	return false;
+}
+
+inline bool ReadSignedVarint(const char*& cursor, const char* end, int64_t& v)
+{
+	uint64_t u;
+	if (!ReadVarint(cursor, end, u))
+		return false;
+	v = ZigZagDecode(u);
+	return true;
+}
+
+#endif
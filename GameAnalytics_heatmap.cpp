@@ -0,0 +1,1136 @@
+#include "GameAnalytics_heatmap.h"
+
+#include <thread>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <mutex>
+#include <memory>
+#include <cstdlib>
+#include <cfloat>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HEATMAP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+// columns the vertical pass accumulates at once, small enough to stay in L1
+static const int ColumnBlock = 256;
+
+static float ReadInt32(const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fdesc) { return (float)msg.GetReflection()->GetInt32(msg, fdesc); }
+static float ReadInt64(const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fdesc) { return (float)msg.GetReflection()->GetInt64(msg, fdesc); }
+static float ReadUInt32(const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fdesc) { return (float)msg.GetReflection()->GetUInt32(msg, fdesc); }
+static float ReadUInt64(const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fdesc) { return (float)msg.GetReflection()->GetUInt64(msg, fdesc); }
+static float ReadFloat(const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fdesc) { return msg.GetReflection()->GetFloat(msg, fdesc); }
+static float ReadDouble(const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fdesc) { return (float)msg.GetReflection()->GetDouble(msg, fdesc); }
+
+HeatmapAnnotationValue::HeatmapAnnotationValue()
+	: mField(NULL)
+	, mRead(NULL)
+	, mConstant(0.0f)
+{
+}
+
+bool HeatmapAnnotationValue::Init(const google::protobuf::Descriptor* desc, const std::string& spec, float defaultValue)
+{
+	mField = NULL;
+	mRead = NULL;
+	mConstant = defaultValue;
+
+	if (spec.empty())
+		return true;
+
+	char* end = NULL;
+	const float constant = strtof(spec.c_str(), &end);
+	if (end != spec.c_str() && *end == 0)
+	{
+		mConstant = constant;
+		return true;
+	}
+
+	const google::protobuf::FieldDescriptor* fdesc = desc->FindFieldByName(spec);
+	if (fdesc == NULL)
+		fdesc = desc->FindFieldByCamelcaseName(spec);
+	if (fdesc == NULL || fdesc->is_repeated())
+		return false;
+
+	switch (fdesc->cpp_type())
+	{
+	case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+		mRead = &ReadInt32;
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+		mRead = &ReadInt64;
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+		mRead = &ReadUInt32;
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+		mRead = &ReadUInt64;
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+		mRead = &ReadFloat;
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+		mRead = &ReadDouble;
+		break;
+	default:
+		return false;
+	}
+
+	mField = fdesc;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+PointEventAccessor::PointEventAccessor()
+	: mPosition(NULL)
+{
+}
+
+bool PointEventAccessor::Init(const google::protobuf::Descriptor* desc, const google::protobuf::FieldDescriptor* pointField)
+{
+	mPosition = NULL;
+
+	for (int i = 0; i < desc->field_count() && pointField == NULL; ++i)
+	{
+		if (desc->field(i)->options().HasExtension(Analytics::point_event))
+			pointField = desc->field(i);
+	}
+
+	if (pointField == NULL || pointField->containing_type() != desc || pointField->is_repeated() ||
+		pointField->message_type() != Analytics::Vec3::descriptor())
+		return false;
+
+	const Analytics::PointEvent& options = pointField->options().GetExtension(Analytics::point_event);
+	if (!mRadius.Init(desc, options.radius(), 0.0f) || !mWeight.Init(desc, options.weight(), 1.0f))
+		return false;
+
+	mPosition = pointField;
+	return true;
+}
+
+bool PointEventAccessor::Read(const google::protobuf::Message& msg, float pos[3], float& radius, float& weight) const
+{
+	if (mPosition == NULL || msg.GetDescriptor() != mPosition->containing_type())
+		return false;
+
+	const google::protobuf::Reflection* refl = msg.GetReflection();
+	if (!refl->HasField(msg, mPosition))
+		return false;
+
+	const Analytics::Vec3& vec = static_cast<const Analytics::Vec3&>(refl->GetMessage(msg, mPosition));
+	pos[0] = vec.x();
+	pos[1] = vec.y();
+	pos[2] = vec.z();
+
+	radius = mRadius.Read(msg);
+	weight = mWeight.Read(msg);
+	return true;
+}
+
+const PointEventAccessor* PointEventAccessor::Find(const google::protobuf::Descriptor* desc)
+{
+	static std::mutex mutex;
+	static std::map<const google::protobuf::Descriptor*, std::unique_ptr<PointEventAccessor> > accessors;
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	std::unique_ptr<PointEventAccessor>& accessor = accessors[desc];
+	if (!accessor)
+	{
+		accessor.reset(new PointEventAccessor());
+		accessor->Init(desc);
+	}
+	return accessor->IsValid() ? accessor.get() : NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+LineEventAccessor::LineEventAccessor()
+	: mLine(NULL)
+	, mGroup(NULL)
+	, mMaxStep(0.0f)
+{
+}
+
+bool LineEventAccessor::Init(const google::protobuf::Descriptor* desc, const google::protobuf::FieldDescriptor* lineField)
+{
+	mLine = NULL;
+	mGroup = NULL;
+
+	for (int i = 0; i < desc->field_count() && lineField == NULL; ++i)
+	{
+		if (desc->field(i)->options().HasExtension(Analytics::line_event))
+			lineField = desc->field(i);
+	}
+
+	if (lineField == NULL || lineField->containing_type() != desc || lineField->is_repeated() ||
+		(lineField->message_type() != Analytics::Line::descriptor() && lineField->message_type() != Analytics::Vec3::descriptor()))
+		return false;
+
+	const Analytics::LineEvent& options = lineField->options().GetExtension(Analytics::line_event);
+	if (!mRadius.Init(desc, options.radius(), 0.0f) || !mWeight.Init(desc, options.weight(), 1.0f))
+		return false;
+
+	// paths are keyed by an integer, entity indices and the like
+	if (!options.group().empty())
+	{
+		mGroup = desc->FindFieldByName(options.group());
+		if (mGroup == NULL)
+			mGroup = desc->FindFieldByCamelcaseName(options.group());
+		if (mGroup == NULL || mGroup->is_repeated())
+			return false;
+
+		switch (mGroup->cpp_type())
+		{
+		case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+		case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+		case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+		case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+		case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+			break;
+		default:
+			return false;
+		}
+	}
+
+	mMaxStep = options.maxstep();
+	mLine = lineField;
+	return true;
+}
+
+bool LineEventAccessor::IsPath() const
+{
+	return mLine != NULL && mLine->message_type() == Analytics::Vec3::descriptor();
+}
+
+bool LineEventAccessor::ReadSegment(const google::protobuf::Message& msg, float p0[3], float p1[3], float& radius, float& weight) const
+{
+	if (mLine == NULL || IsPath() || msg.GetDescriptor() != mLine->containing_type())
+		return false;
+
+	const google::protobuf::Reflection* refl = msg.GetReflection();
+	if (!refl->HasField(msg, mLine))
+		return false;
+
+	const Analytics::Line& line = static_cast<const Analytics::Line&>(refl->GetMessage(msg, mLine));
+	p0[0] = line.p0().x();
+	p0[1] = line.p0().y();
+	p0[2] = line.p0().z();
+	p1[0] = line.p1().x();
+	p1[1] = line.p1().y();
+	p1[2] = line.p1().z();
+
+	radius = mRadius.Read(msg);
+	weight = mWeight.Read(msg);
+	return true;
+}
+
+bool LineEventAccessor::ReadSample(const google::protobuf::Message& msg, float pos[3], int64_t& path, float& radius, float& weight) const
+{
+	if (!IsPath() || msg.GetDescriptor() != mLine->containing_type())
+		return false;
+
+	const google::protobuf::Reflection* refl = msg.GetReflection();
+	if (!refl->HasField(msg, mLine))
+		return false;
+
+	const Analytics::Vec3& vec = static_cast<const Analytics::Vec3&>(refl->GetMessage(msg, mLine));
+	pos[0] = vec.x();
+	pos[1] = vec.y();
+	pos[2] = vec.z();
+
+	path = 0;
+	if (mGroup != NULL)
+	{
+		switch (mGroup->cpp_type())
+		{
+		case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+			path = refl->GetInt32(msg, mGroup);
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+			path = refl->GetInt64(msg, mGroup);
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+			path = refl->GetUInt32(msg, mGroup);
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+			path = (int64_t)refl->GetUInt64(msg, mGroup);
+			break;
+		case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+			path = refl->GetEnumValue(msg, mGroup);
+			break;
+		default:
+			break;
+		}
+	}
+
+	radius = mRadius.Read(msg);
+	weight = mWeight.Read(msg);
+	return true;
+}
+
+const LineEventAccessor* LineEventAccessor::Find(const google::protobuf::Descriptor* desc)
+{
+	static std::mutex mutex;
+	static std::map<const google::protobuf::Descriptor*, std::unique_ptr<LineEventAccessor> > accessors;
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	std::unique_ptr<LineEventAccessor>& accessor = accessors[desc];
+	if (!accessor)
+	{
+		accessor.reset(new LineEventAccessor());
+		accessor->Init(desc);
+	}
+	return accessor->IsValid() ? accessor.get() : NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+HeatmapPathBuilder::HeatmapPathBuilder(HeatmapPointSink& sink, float maxStep)
+	: mSink(sink)
+	, mMaxStep(maxStep)
+{
+	mZRange[0] = -FLT_MAX;
+	mZRange[1] = FLT_MAX;
+}
+
+void HeatmapPathBuilder::SetZRange(float zMin, float zMax)
+{
+	mZRange[0] = zMin;
+	mZRange[1] = zMax;
+}
+
+void HeatmapPathBuilder::AddSample(int64_t path, float x, float y, float weight, float radius)
+{
+	std::pair<std::map<int64_t, Sample>::iterator, bool> it = mLast.insert(std::make_pair(path, Sample()));
+	Sample& last = it.first->second;
+
+	// the first sample of a path has nothing to join
+	if (!it.second)
+	{
+		const float dx = x - last.mX;
+		const float dy = y - last.mY;
+		if (mMaxStep <= 0.0f || dx * dx + dy * dy <= mMaxStep * mMaxStep)
+			mSink.AddLine(last.mX, last.mY, x, y, weight, radius);
+	}
+
+	last.mX = x;
+	last.mY = y;
+}
+
+bool HeatmapPathBuilder::AddEvent(const google::protobuf::Message& msg, const LineEventAccessor& accessor, float radius)
+{
+	float p0[3], p1[3], annotatedRadius, weight;
+	if (!accessor.IsPath())
+	{
+		if (!accessor.ReadSegment(msg, p0, p1, annotatedRadius, weight))
+			return false;
+
+		if (p0[2] < mZRange[0] || p0[2] > mZRange[1] || p1[2] < mZRange[0] || p1[2] > mZRange[1])
+			return false;
+
+		mSink.AddLine(p0[0], p0[1], p1[0], p1[1], weight, radius > 0.0f ? radius : annotatedRadius);
+		return true;
+	}
+
+	int64_t path = 0;
+	if (!accessor.ReadSample(msg, p0, path, annotatedRadius, weight))
+		return false;
+
+	// leaving the floor ends the path, it starts over when it comes back
+	if (p0[2] < mZRange[0] || p0[2] > mZRange[1])
+	{
+		mLast.erase(path);
+		return false;
+	}
+
+	AddSample(path, p0[0], p0[1], weight, radius > 0.0f ? radius : annotatedRadius);
+	return true;
+}
+
+void HeatmapPathBuilder::AddTrajectory(int64_t path, const TrajectoryArrays& samples, float weight, float radius)
+{
+	for (size_t i = 0; i < samples.size(); ++i)
+	{
+		if (samples.mZ[i] < mZRange[0] || samples.mZ[i] > mZRange[1])
+		{
+			mLast.erase(path);
+			continue;
+		}
+		AddSample(path, samples.mX[i], samples.mY[i], weight, radius);
+	}
+}
+
+bool HeatmapPathBuilder::AddTrajectory(const Analytics::GameEntityTrajectory& chunk, const LineEventAccessor& accessor, float radius)
+{
+	if (!accessor.IsPath() || accessor.GetLineField()->containing_type() != Analytics::GameEntityPosition::descriptor())
+		return false;
+
+	mTrajectory.clear();
+	if (!TrajectoryDecoder::Decode(chunk, mTrajectory) || mTrajectory.size() == 0)
+		return false;
+
+	// a sample of the entity for the group and the annotations, only the position differs from one to the next
+	Analytics::GameEntityPosition sample;
+	sample.set_team(chunk.team());
+	sample.set_entityindex(chunk.entityindex());
+	sample.mutable_position()->set_x(mTrajectory.mX[0]);
+	sample.mutable_position()->set_y(mTrajectory.mY[0]);
+	sample.mutable_position()->set_z(mTrajectory.mZ[0]);
+
+	float pos[3], annotatedRadius, weight;
+	int64_t path = 0;
+	if (!accessor.ReadSample(sample, pos, path, annotatedRadius, weight))
+		return false;
+
+	AddTrajectory(path, mTrajectory, weight, radius > 0.0f ? radius : annotatedRadius);
+	return true;
+}
+
+void HeatmapPathBuilder::Clear()
+{
+	mLast.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// whole pixels up to 8, then steps of about 4% of the radius
+static int RadiusBucket(float radiusPixels, float& bucketRadius)
+{
+	if (radiusPixels <= 8.0f)
+	{
+		const int bucket = (int)(radiusPixels + 0.5f);
+		bucketRadius = (float)bucket;
+		return bucket;
+	}
+
+	const int step = (int)(log2f(radiusPixels / 8.0f) * 16.0f + 0.5f);
+	bucketRadius = 8.0f * exp2f((float)step / 16.0f);
+	return 8 + step;
+}
+
+HeatmapRasterizer::HeatmapRasterizer()
+	: mScale(1.0f)
+	, mRadius(0.0f)
+	, mWidth(0)
+	, mHeight(0)
+	, mNumThreads(0)
+	, mLastRadius(0.0f)
+	, mLastLayer(0)
+	, mMaxValue(0.0f)
+{
+	mWorldMins[0] = 0.0f;
+	mWorldMins[1] = 0.0f;
+}
+
+void HeatmapRasterizer::Init(const float worldMins[2], const float worldMaxs[2], int imageSize, float eventRadius)
+{
+	const float worldSizeX = std::max(ceilf(worldMaxs[0] - worldMins[0]), 1.0f);
+	const float worldSizeY = std::max(ceilf(worldMaxs[1] - worldMins[1]), 1.0f);
+
+	imageSize = std::max(imageSize, 1);
+
+	// the same sizing as the old script, the longer axis gets the image size
+	if (worldSizeX > worldSizeY)
+	{
+		mWidth = imageSize;
+		mHeight = std::max((int)ceil((double)imageSize * worldSizeY / worldSizeX), 1);
+		mScale = (float)mWidth / worldSizeX;
+	}
+	else
+	{
+		mWidth = std::max((int)ceil((double)imageSize * worldSizeX / worldSizeY), 1);
+		mHeight = imageSize;
+		mScale = (float)mHeight / worldSizeY;
+	}
+
+	mWorldMins[0] = worldMins[0];
+	mWorldMins[1] = worldMaxs[1];
+	mRadius = eventRadius;
+
+	Clear();
+}
+
+void HeatmapRasterizer::InitRegion(float left, float top, float pixelSize, int width, int height, float eventRadius)
+{
+	mWidth = std::max(width, 1);
+	mHeight = std::max(height, 1);
+	mScale = 1.0f / pixelSize;
+	mWorldMins[0] = left;
+	mWorldMins[1] = top;
+	mRadius = eventRadius;
+
+	Clear();
+}
+
+void HeatmapRasterizer::Clear()
+{
+	mLayers.clear();
+	mLayerIndex.clear();
+	mLastLayer = 0;
+	mImage.clear();
+	mBins.clear();
+	mTemp.clear();
+	mMaxValue = 0.0f;
+}
+
+size_t HeatmapRasterizer::GetLayerIndex(float radiusPixels)
+{
+	float bucketRadius = 0.0f;
+	const int bucket = RadiusBucket(radiusPixels, bucketRadius);
+
+	std::map<int, size_t>::const_iterator it = mLayerIndex.find(bucket);
+	if (it != mLayerIndex.end())
+		return it->second;
+
+	const size_t index = mLayers.size();
+	mLayerIndex[bucket] = index;
+	mLayers.push_back(Layer());
+	Layer& layer = mLayers.back();
+
+	// the radial falloff of an event as a gaussian, which unlike a cone splits into a row and a column pass.
+	// sigma is half the radius and the tail is cut at 3 sigma. both halves peak at 1 so a lone event peaks at its weight
+	if (bucketRadius >= 0.5f)
+	{
+		const int halfWidth = (int)ceilf(bucketRadius * 1.5f);
+		const float sigma = bucketRadius * 0.5f;
+		for (int i = -halfWidth; i <= halfWidth; ++i)
+			layer.mKernel.push_back(expf(-(float)(i * i) / (2.0f * sigma * sigma)));
+	}
+	else
+		layer.mKernel.push_back(1.0f);
+
+	layer.mKernelSum = 0.0f;
+	for (size_t i = 0; i < layer.mKernel.size(); ++i)
+		layer.mKernelSum += layer.mKernel[i];
+
+	return index;
+}
+
+HeatmapRasterizer::Layer& HeatmapRasterizer::GetLastLayer(float radius)
+{
+	// most event types have a constant radius, so the last layer is the likely one
+	const float radiusPixels = (radius > 0.0f ? radius : mRadius) * mScale;
+	if (mLastLayer >= mLayers.size() || radiusPixels != mLastRadius)
+	{
+		mLastRadius = radiusPixels;
+		mLastLayer = GetLayerIndex(radiusPixels);
+	}
+	return mLayers[mLastLayer];
+}
+
+void HeatmapRasterizer::AddPoint(float x, float y, float weight, float radius)
+{
+	Point pt;
+	pt.mX = (x - mWorldMins[0]) * mScale - 0.5f;
+	pt.mY = (mWorldMins[1] - y) * mScale - 0.5f;
+	pt.mWeight = weight;
+
+	GetLastLayer(radius).mPoints.push_back(pt);
+}
+
+void HeatmapRasterizer::AddLine(float x0, float y0, float x1, float y1, float weight, float radius)
+{
+	Segment seg;
+	seg.mX0 = (x0 - mWorldMins[0]) * mScale - 0.5f;
+	seg.mY0 = (mWorldMins[1] - y0) * mScale - 0.5f;
+	seg.mX1 = (x1 - mWorldMins[0]) * mScale - 0.5f;
+	seg.mY1 = (mWorldMins[1] - y1) * mScale - 0.5f;
+	seg.mWeight = weight;
+
+	GetLastLayer(radius).mSegments.push_back(seg);
+}
+
+bool HeatmapRasterizer::AddEvent(const google::protobuf::Message& msg, const PointEventAccessor& accessor)
+{
+	float pos[3], radius, weight;
+	if (!accessor.Read(msg, pos, radius, weight))
+		return false;
+
+	AddPoint(pos[0], pos[1], weight, radius);
+	return true;
+}
+
+size_t HeatmapRasterizer::GetNumPoints() const
+{
+	size_t count = 0;
+	for (size_t i = 0; i < mLayers.size(); ++i)
+		count += mLayers[i].mPoints.size();
+	return count;
+}
+
+size_t HeatmapRasterizer::GetNumSegments() const
+{
+	size_t count = 0;
+	for (size_t i = 0; i < mLayers.size(); ++i)
+		count += mLayers[i].mSegments.size();
+	return count;
+}
+
+bool HeatmapRasterizer::Merge(const HeatmapRasterizer& other)
+{
+	// the points are kept in pixels, so they only carry over to the same grid
+	if (other.mWidth != mWidth || other.mHeight != mHeight || other.mScale != mScale ||
+		other.mWorldMins[0] != mWorldMins[0] || other.mWorldMins[1] != mWorldMins[1])
+		return false;
+
+	for (std::map<int, size_t>::const_iterator it = other.mLayerIndex.begin(); it != other.mLayerIndex.end(); ++it)
+	{
+		const Layer& src = other.mLayers[it->second];
+
+		std::map<int, size_t>::const_iterator mine = mLayerIndex.find(it->first);
+		if (mine == mLayerIndex.end())
+		{
+			// same bucket, same kernel
+			mine = mLayerIndex.insert(std::make_pair(it->first, mLayers.size())).first;
+			mLayers.push_back(Layer());
+			mLayers.back().mKernel = src.mKernel;
+			mLayers.back().mKernelSum = src.mKernelSum;
+		}
+
+		Layer& dst = mLayers[mine->second];
+		dst.mPoints.insert(dst.mPoints.end(), src.mPoints.begin(), src.mPoints.end());
+		dst.mSegments.insert(dst.mSegments.end(), src.mSegments.begin(), src.mSegments.end());
+	}
+
+	mImage.clear();
+	mMaxValue = 0.0f;
+	return true;
+}
+
+void HeatmapRasterizer::Render()
+{
+	mImage.assign((size_t)mWidth * mHeight, 0.0f);
+	mMaxValue = 0.0f;
+
+	if (mWidth <= 0 || mHeight <= 0)
+		return;
+
+	mBins.resize(mImage.size());
+	mTemp.resize(mImage.size());
+
+	for (size_t i = 0; i < mLayers.size(); ++i)
+	{
+		const Layer& layer = mLayers[i];
+		if (layer.mPoints.empty() && layer.mSegments.empty())
+			continue;
+
+		// every band scans all of the points and only writes its own rows, so no locking is needed
+		HeatmapParallelFor(mHeight, mNumThreads, [this, &layer](int begin, int end) { Bin(layer, begin, end); });
+		HeatmapParallelFor(mHeight, mNumThreads, [this, &layer](int begin, int end) { ConvolveRows(layer, begin, end); });
+		HeatmapParallelFor(mHeight, mNumThreads, [this, &layer](int begin, int end) { ConvolveColumns(layer, begin, end); });
+	}
+
+	std::vector<float> rowMax(mHeight, 0.0f);
+	HeatmapParallelFor(mHeight, mNumThreads, [this, &rowMax](int begin, int end)
+	{
+		for (int y = begin; y < end; ++y)
+		{
+			const float* row = &mImage[(size_t)y * mWidth];
+			rowMax[y] = *std::max_element(row, row + mWidth);
+		}
+	});
+	mMaxValue = std::max(*std::max_element(rowMax.begin(), rowMax.end()), 0.0f);
+}
+
+void HeatmapRasterizer::Bin(const Layer& layer, int rowBegin, int rowEnd)
+{
+	memset(&mBins[(size_t)rowBegin * mWidth], 0, (size_t)(rowEnd - rowBegin) * mWidth * sizeof(float));
+
+	for (size_t i = 0; i < layer.mPoints.size(); ++i)
+		BinPoint(layer.mPoints[i], rowBegin, rowEnd);
+
+	// the kernel sums to more than 1 along the segment, so scale it back to peak at the weight
+	const float weightScale = 1.0f / layer.mKernelSum;
+	for (size_t i = 0; i < layer.mSegments.size(); ++i)
+	{
+		const Segment& seg = layer.mSegments[i];
+		if (std::max(seg.mY0, seg.mY1) + 1.0f < (float)rowBegin || std::min(seg.mY0, seg.mY1) >= (float)rowEnd)
+			continue;
+
+		BinSegment(seg, weightScale, rowBegin, rowEnd);
+	}
+}
+
+// bilinear, so positions between pixel centers don't snap
+void HeatmapRasterizer::BinPoint(const Point& pt, int rowBegin, int rowEnd)
+{
+	const float fy = floorf(pt.mY);
+	if (fy + 1.0f < (float)rowBegin || fy >= (float)rowEnd)
+		return;
+
+	const float fx = floorf(pt.mX);
+	if (fx + 1.0f < 0.0f || fx >= (float)mWidth)
+		return;
+
+	const int x = (int)fx;
+	const int y = (int)fy;
+	const float tx = pt.mX - fx;
+	const float ty = pt.mY - fy;
+
+	const float w[2][2] =
+	{
+		{ (1.0f - tx) * (1.0f - ty) * pt.mWeight, tx * (1.0f - ty) * pt.mWeight },
+		{ (1.0f - tx) * ty * pt.mWeight, tx * ty * pt.mWeight },
+	};
+
+	for (int r = 0; r < 2; ++r)
+	{
+		if (y + r < rowBegin || y + r >= rowEnd)
+			continue;
+
+		float* row = &mBins[(size_t)(y + r) * mWidth];
+		if (x >= 0)
+			row[x] += w[r][0];
+		if (x + 1 < mWidth)
+			row[x + 1] += w[r][1];
+	}
+}
+
+void HeatmapRasterizer::BinSegment(const Segment& seg, float weightScale, int rowBegin, int rowEnd)
+{
+	const float dx = seg.mX1 - seg.mX0;
+	const float dy = seg.mY1 - seg.mY0;
+	const float length = sqrtf(dx * dx + dy * dy);
+	if (length <= 0.0f)
+		return;
+
+	// one sample per pixel along the major axis at its whole coordinates, split between the two nearest pixels
+	// across it. each sample stands for length / major of the segment, so diagonals aren't lighter
+	const bool steep = fabsf(dy) > fabsf(dx);
+	const float major0 = steep ? seg.mY0 : seg.mX0;
+	const float major1 = steep ? seg.mY1 : seg.mX1;
+	const float minor0 = steep ? seg.mX0 : seg.mY0;
+	const float slope = steep ? dx / dy : dy / dx;
+	const float sampleWeight = seg.mWeight * weightScale * length / fabsf(major1 - major0);
+
+	// half open, so joined segments of a path don't both sample the shared end
+	float first = ceilf(std::min(major0, major1));
+	float last = ceilf(std::max(major0, major1)) - 1.0f;
+
+	// only the part over the image and, on the minor axis, over the rows of this band
+	if (steep)
+	{
+		first = std::max(first, (float)rowBegin);
+		last = std::min(last, (float)(rowEnd - 1));
+	}
+	else
+	{
+		first = std::max(first, 0.0f);
+		last = std::min(last, (float)(mWidth - 1));
+
+		if (dy != 0.0f)
+		{
+			const float x0 = seg.mX0 + dx * ((float)rowBegin - 1.0f - seg.mY0) / dy;
+			const float x1 = seg.mX0 + dx * ((float)rowEnd - seg.mY0) / dy;
+			first = std::max(first, floorf(std::min(x0, x1)));
+			last = std::min(last, ceilf(std::max(x0, x1)));
+		}
+	}
+
+	if (first > last)
+	{
+		// shorter than a pixel and between whole coordinates, binned as a point at its middle
+		if (ceilf(std::min(major0, major1)) >= ceilf(std::max(major0, major1)))
+		{
+			Point pt;
+			pt.mX = (seg.mX0 + seg.mX1) * 0.5f;
+			pt.mY = (seg.mY0 + seg.mY1) * 0.5f;
+			pt.mWeight = seg.mWeight * weightScale * length;
+			BinPoint(pt, rowBegin, rowEnd);
+		}
+		return;
+	}
+
+	for (int m = (int)first; m <= (int)last; ++m)
+	{
+		const float minor = minor0 + ((float)m - major0) * slope;
+		const float fminor = floorf(minor);
+		const int n = (int)fminor;
+		const float t = minor - fminor;
+
+		if (steep)
+		{
+			float* row = &mBins[(size_t)m * mWidth];
+			if (n >= 0 && n < mWidth)
+				row[n] += sampleWeight * (1.0f - t);
+			if (n + 1 >= 0 && n + 1 < mWidth)
+				row[n + 1] += sampleWeight * t;
+		}
+		else
+		{
+			if (n >= rowBegin && n < rowEnd)
+				mBins[(size_t)n * mWidth + m] += sampleWeight * (1.0f - t);
+			if (n + 1 >= rowBegin && n + 1 < rowEnd)
+				mBins[(size_t)(n + 1) * mWidth + m] += sampleWeight * t;
+		}
+	}
+}
+
+void HeatmapRasterizer::ConvolveRows(const Layer& layer, int rowBegin, int rowEnd)
+{
+	const int taps = (int)layer.mKernel.size();
+	const int halfWidth = taps / 2;
+	const float* kernel = &layer.mKernel[0];
+
+	// zero padded copy of the row so the inner loop needs no bounds checks, plus slack for the last vector
+	std::vector<float> padded(mWidth + taps + 4, 0.0f);
+
+	for (int y = rowBegin; y < rowEnd; ++y)
+	{
+		const float* src = &mBins[(size_t)y * mWidth];
+		float* dst = &mTemp[(size_t)y * mWidth];
+
+		memcpy(&padded[halfWidth], src, mWidth * sizeof(float));
+		const float* pad = &padded[0];
+
+		int x = 0;
+#if(HEATMAP_SSE2)
+		for (; x + 4 <= mWidth; x += 4)
+		{
+			__m128 acc = _mm_setzero_ps();
+			for (int k = 0; k < taps; ++k)
+				acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(kernel[k]), _mm_loadu_ps(pad + x + k)));
+			_mm_storeu_ps(dst + x, acc);
+		}
+#endif
+		for (; x < mWidth; ++x)
+		{
+			float acc = 0.0f;
+			for (int k = 0; k < taps; ++k)
+				acc += kernel[k] * pad[x + k];
+			dst[x] = acc;
+		}
+	}
+}
+
+void HeatmapRasterizer::ConvolveColumns(const Layer& layer, int rowBegin, int rowEnd)
+{
+	const int taps = (int)layer.mKernel.size();
+	const int halfWidth = taps / 2;
+
+	for (int y = rowBegin; y < rowEnd; ++y)
+	{
+		float* dst = &mImage[(size_t)y * mWidth];
+
+		// source rows outside the image are zero
+		const int kBegin = std::max(0, halfWidth - y);
+		const int kEnd = std::min(taps, mHeight - y + halfWidth);
+
+		for (int x0 = 0; x0 < mWidth; x0 += ColumnBlock)
+		{
+			const int count = std::min(ColumnBlock, mWidth - x0);
+
+			// layers add up in the image
+			float acc[ColumnBlock];
+			memcpy(acc, dst + x0, count * sizeof(float));
+
+			for (int k = kBegin; k < kEnd; ++k)
+			{
+				const float weight = layer.mKernel[k];
+				const float* src = &mTemp[(size_t)(y + k - halfWidth) * mWidth + x0];
+
+				int x = 0;
+#if(HEATMAP_SSE2)
+				const __m128 w = _mm_set1_ps(weight);
+				for (; x + 4 <= count; x += 4)
+					_mm_storeu_ps(acc + x, _mm_add_ps(_mm_loadu_ps(acc + x), _mm_mul_ps(w, _mm_loadu_ps(src + x))));
+#endif
+				for (; x < count; ++x)
+					acc[x] += weight * src[x];
+			}
+
+			memcpy(dst + x0, acc, count * sizeof(float));
+		}
+	}
+}
+
+bool HeatmapRasterizer::WritePng(const char* filename, std::string& error) const
+{
+	if (mImage.empty())
+	{
+		error = "heatmap not rendered";
+		return false;
+	}
+
+	std::vector<uint8_t> rgb(mImage.size() * 3);
+
+	// the old script auto-leveled the image before the colour lookup
+	const float scale = mMaxValue > 0.0f ? 1.0f / mMaxValue : 0.0f;
+	HeatmapParallelFor(mHeight, mNumThreads, [this, &rgb, scale](int begin, int end)
+	{
+		for (size_t i = (size_t)begin * mWidth; i < (size_t)end * mWidth; ++i)
+			HeatmapColor(mImage[i] * scale, &rgb[i * 3]);
+	});
+
+	return WriteHeatmapPng(filename, mWidth, mHeight, &rgb[0], error);
+}
+
+bool HeatmapRasterizer::WriteRaw(const char* filename, std::string& error) const
+{
+	FILE* fp = fopen(filename, "wb");
+	if (fp == NULL)
+	{
+		error = std::string("can't open ") + filename;
+		return false;
+	}
+
+	const bool ok = mImage.empty() || fwrite(&mImage[0], sizeof(float), mImage.size(), fp) == mImage.size();
+	if (fclose(fp) != 0 || !ok)
+	{
+		error = std::string("failed writing ") + filename;
+		return false;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void HeatmapParallelFor(int count, int numThreads, const std::function<void(int begin, int end)>& fn)
+{
+	if (numThreads <= 0)
+		numThreads = std::max((int)std::thread::hardware_concurrency(), 1);
+	numThreads = std::min(numThreads, count);
+
+	if (numThreads <= 1)
+	{
+		if (count > 0)
+			fn(0, count);
+		return;
+	}
+
+	std::vector<std::thread> threads;
+	threads.reserve(numThreads - 1);
+	for (int i = 1; i < numThreads; ++i)
+		threads.push_back(std::thread(fn, (int)((int64_t)count * i / numThreads), (int)((int64_t)count * (i + 1) / numThreads)));
+
+	fn(0, count / numThreads);
+
+	for (size_t i = 0; i < threads.size(); ++i)
+		threads[i].join();
+}
+
+void HeatmapColor(float t, uint8_t rgb[3])
+{
+	static const float ramp[6][3] =
+	{
+		{ 0x00, 0x00, 0x44 },
+		{ 0x88, 0x00, 0x44 },
+		{ 0xff, 0x00, 0x00 },
+		{ 0xff, 0x88, 0x00 },
+		{ 0xff, 0xff, 0x00 },
+		{ 0xff, 0xff, 0xaa },
+	};
+
+	t = std::min(std::max(t, 0.0f), 1.0f) * 5.0f;
+	const int i = std::min((int)t, 4);
+	const float f = t - (float)i;
+
+	for (int c = 0; c < 3; ++c)
+		rgb[c] = (uint8_t)(ramp[i][c] + (ramp[i + 1][c] - ramp[i][c]) * f + 0.5f);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// PNG output without a zlib dependency. Rows use the Sub filter so flat areas turn into runs of zeros,
+// which a single fixed Huffman deflate block codes as distance 1 matches.
+
+static uint32_t Crc32(uint32_t crc, const uint8_t* data, size_t size)
+{
+	static const std::vector<uint32_t> table = []()
+	{
+		std::vector<uint32_t> t(256);
+		for (uint32_t n = 0; n < 256; ++n)
+		{
+			uint32_t c = n;
+			for (int k = 0; k < 8; ++k)
+				c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+			t[n] = c;
+		}
+		return t;
+	}();
+
+	crc = ~crc;
+	for (size_t i = 0; i < size; ++i)
+		crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+	return ~crc;
+}
+
+class DeflateWriter
+{
+public:
+	DeflateWriter(std::vector<uint8_t>& out) : mOut(out), mBits(0), mNumBits(0) {}
+
+	void WriteBits(uint32_t value, int count)
+	{
+		mBits |= value << mNumBits;
+		mNumBits += count;
+		while (mNumBits >= 8)
+		{
+			mOut.push_back((uint8_t)mBits);
+			mBits >>= 8;
+			mNumBits -= 8;
+		}
+	}
+
+	// huffman codes go out most significant bit first
+	void WriteCode(uint32_t code, int length)
+	{
+		uint32_t reversed = 0;
+		for (int i = 0; i < length; ++i)
+			reversed |= ((code >> i) & 1) << (length - 1 - i);
+		WriteBits(reversed, length);
+	}
+
+	void WriteLiteral(int value)
+	{
+		if (value < 144)
+			WriteCode(0x30 + value, 8);
+		else if (value < 256)
+			WriteCode(0x190 + value - 144, 9);
+		else if (value < 280)
+			WriteCode(value - 256, 7);
+		else
+			WriteCode(0xc0 + value - 280, 8);
+	}
+
+	void WriteRun(int length)
+	{
+		static const int base[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+		static const int extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+		int code = 28;
+		while (base[code] > length)
+			--code;
+
+		WriteLiteral(257 + code);
+		if (extra[code] > 0)
+			WriteBits(length - base[code], extra[code]);
+
+		// distance 1 is code 0 with no extra bits
+		WriteCode(0, 5);
+	}
+
+	void Flush()
+	{
+		if (mNumBits > 0)
+			mOut.push_back((uint8_t)mBits);
+		mBits = 0;
+		mNumBits = 0;
+	}
+private:
+	std::vector<uint8_t>&	mOut;
+	uint32_t				mBits;
+	int						mNumBits;
+};
+
+static void WriteChunk(std::vector<uint8_t>& png, const char* type, const uint8_t* data, size_t size)
+{
+	const uint8_t header[8] =
+	{
+		(uint8_t)(size >> 24), (uint8_t)(size >> 16), (uint8_t)(size >> 8), (uint8_t)size,
+		(uint8_t)type[0], (uint8_t)type[1], (uint8_t)type[2], (uint8_t)type[3],
+	};
+	png.insert(png.end(), header, header + 8);
+	if (size > 0)
+		png.insert(png.end(), data, data + size);
+
+	const uint32_t crc = Crc32(Crc32(0, header + 4, 4), data, size);
+	const uint8_t footer[4] = { (uint8_t)(crc >> 24), (uint8_t)(crc >> 16), (uint8_t)(crc >> 8), (uint8_t)crc };
+	png.insert(png.end(), footer, footer + 4);
+}
+
+bool WriteHeatmapPng(const char* filename, int width, int height, const uint8_t* rgb, std::string& error)
+{
+	const size_t stride = (size_t)width * 3;
+
+	// filter byte and Sub filtered row
+	std::vector<uint8_t> raw;
+	raw.reserve((stride + 1) * height);
+	for (int y = 0; y < height; ++y)
+	{
+		const uint8_t* row = rgb + stride * y;
+		raw.push_back(1);
+		for (size_t i = 0; i < stride; ++i)
+			raw.push_back(i < 3 ? row[i] : (uint8_t)(row[i] - row[i - 3]));
+	}
+
+	std::vector<uint8_t> zdata;
+	zdata.push_back(0x78);
+	zdata.push_back(0x01);
+
+	DeflateWriter deflate(zdata);
+	deflate.WriteBits(1, 1);	// final block
+	deflate.WriteBits(1, 2);	// fixed huffman codes
+
+	for (size_t i = 0; i < raw.size();)
+	{
+		size_t run = 0;
+		if (i > 0)
+		{
+			while (run < 258 && i + run < raw.size() && raw[i + run] == raw[i - 1])
+				++run;
+		}
+
+		if (run >= 3)
+		{
+			deflate.WriteRun((int)run);
+			i += run;
+		}
+		else
+			deflate.WriteLiteral(raw[i++]);
+	}
+	deflate.WriteLiteral(256);
+	deflate.Flush();
+
+	uint32_t a = 1, b = 0;
+	for (size_t i = 0; i < raw.size(); ++i)
+	{
+		a = (a + raw[i]) % 65521;
+		b = (b + a) % 65521;
+	}
+	const uint32_t adler = (b << 16) | a;
+	zdata.push_back((uint8_t)(adler >> 24));
+	zdata.push_back((uint8_t)(adler >> 16));
+	zdata.push_back((uint8_t)(adler >> 8));
+	zdata.push_back((uint8_t)adler);
+
+	const uint8_t ihdr[13] =
+	{
+		(uint8_t)(width >> 24), (uint8_t)(width >> 16), (uint8_t)(width >> 8), (uint8_t)width,
+		(uint8_t)(height >> 24), (uint8_t)(height >> 16), (uint8_t)(height >> 8), (uint8_t)height,
+		8,	// bit depth
+		2,	// rgb
+		0, 0, 0,
+	};
+
+	static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	std::vector<uint8_t> png(signature, signature + 8);
+	WriteChunk(png, "IHDR", ihdr, sizeof(ihdr));
+	WriteChunk(png, "IDAT", &zdata[0], zdata.size());
+	WriteChunk(png, "IEND", NULL, 0);
+
+	FILE* fp = fopen(filename, "wb");
+	if (fp == NULL)
+	{
+		error = std::string("can't open ") + filename;
+		return false;
+	}
+
+	const bool ok = fwrite(&png[0], 1, png.size(), fp) == png.size();
+	if (fclose(fp) != 0 || !ok)
+	{
+		error = std::string("failed writing ") + filename;
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,245 @@
+#ifndef GAMEANALYTICS_HEATMAP_H
+#define GAMEANALYTICS_HEATMAP_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstdint>
+
+#include "analytics.pb.h"
+#include "GameAnalytics_trajectory.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// A radius or weight annotation, either a number or the name of a numeric field of the message read through the cached field
+class HeatmapAnnotationValue
+{
+public:
+	HeatmapAnnotationValue();
+
+	// an empty spec uses the default
+	bool Init(const google::protobuf::Descriptor* desc, const std::string& spec, float defaultValue);
+
+	float Read(const google::protobuf::Message& msg) const
+	{
+		return mField != NULL ? mRead(msg, mField) : mConstant;
+	}
+private:
+	typedef float (*ReadFn)(const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fdesc);
+
+	const google::protobuf::FieldDescriptor*	mField;
+	ReadFn										mRead;
+	float										mConstant;
+};
+
+// The (point_event) annotation of a Vec3 field resolved once per message type
+class PointEventAccessor
+{
+public:
+	PointEventAccessor();
+
+	// the first (point_event) field of the type when pointField is NULL
+	bool Init(const google::protobuf::Descriptor* desc, const google::protobuf::FieldDescriptor* pointField = NULL);
+	bool IsValid() const { return mPosition != NULL; }
+	const google::protobuf::FieldDescriptor* GetPointField() const { return mPosition; }
+
+	// false when the event has no position
+	bool Read(const google::protobuf::Message& msg, float pos[3], float& radius, float& weight) const;
+
+	// shared accessors for the first point field of a type, built on first use. NULL when the type has none
+	static const PointEventAccessor* Find(const google::protobuf::Descriptor* desc);
+private:
+	const google::protobuf::FieldDescriptor*	mPosition;
+	HeatmapAnnotationValue						mRadius;
+	HeatmapAnnotationValue						mWeight;
+};
+
+// The (line_event) annotation of a field resolved once per message type. A Line field is a segment per event,
+// a Vec3 field is a path through consecutive events, one per value of the group field.
+class LineEventAccessor
+{
+public:
+	LineEventAccessor();
+
+	// the first (line_event) field of the type when lineField is NULL
+	bool Init(const google::protobuf::Descriptor* desc, const google::protobuf::FieldDescriptor* lineField = NULL);
+	bool IsValid() const { return mLine != NULL; }
+	const google::protobuf::FieldDescriptor* GetLineField() const { return mLine; }
+
+	// Vec3 fields, the events are samples of paths
+	bool IsPath() const;
+	float GetMaxStep() const { return mMaxStep; }
+
+	// Line fields, false when the event has no segment
+	bool ReadSegment(const google::protobuf::Message& msg, float p0[3], float p1[3], float& radius, float& weight) const;
+	// Vec3 fields, false when the event has no position
+	bool ReadSample(const google::protobuf::Message& msg, float pos[3], int64_t& path, float& radius, float& weight) const;
+
+	// shared accessors for the first line field of a type, built on first use. NULL when the type has none
+	static const LineEventAccessor* Find(const google::protobuf::Descriptor* desc);
+private:
+	const google::protobuf::FieldDescriptor*	mLine;
+	const google::protobuf::FieldDescriptor*	mGroup;
+	float										mMaxStep;
+	HeatmapAnnotationValue						mRadius;
+	HeatmapAnnotationValue						mWeight;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// anything heatmap points can be fed into, positions and radii in world units
+class HeatmapPointSink
+{
+public:
+	virtual ~HeatmapPointSink() {}
+
+	// a radius of 0 or less uses the default of the sink
+	virtual void AddPoint(float x, float y, float weight = 1.0f, float radius = 0.0f) = 0;
+	// weight is spread along the segment so that away from its ends it peaks at weight, like a point does
+	virtual void AddLine(float x0, float y0, float x1, float y1, float weight = 1.0f, float radius = 0.0f) = 0;
+};
+
+// Joins consecutive samples of each path into segments for a sink. A sample further than the max step
+// from the previous one of its path starts over, so respawns and teleports don't draw a line.
+class HeatmapPathBuilder
+{
+public:
+	HeatmapPathBuilder(HeatmapPointSink& sink, float maxStep = 0.0f);
+
+	// AddEvent drops segments with an end outside of the range, and samples outside break their path, as they do in AddTrajectory
+	void SetZRange(float zMin, float zMax);
+
+	// the segment from the last sample of the path, weighted and sized by this sample
+	void AddSample(int64_t path, float x, float y, float weight = 1.0f, float radius = 0.0f);
+	// line events, Line fields go straight to the sink and Vec3 fields through AddSample. a positive radius overrides the annotation
+	bool AddEvent(const google::protobuf::Message& msg, const LineEventAccessor& accessor, float radius = 0.0f);
+	// the decoded samples of a GameEntityTrajectory chunk, continuing the path of the last chunk
+	void AddTrajectory(int64_t path, const TrajectoryArrays& samples, float weight = 1.0f, float radius = 0.0f);
+	// a chunk as the samples of the accessor's GameEntityPosition paths it replaces in trajectory mode, the path, radius
+	// and weight read like those of a sample of the entity. false when the accessor isn't of GameEntityPosition or the
+	// chunk doesn't decode
+	bool AddTrajectory(const Analytics::GameEntityTrajectory& chunk, const LineEventAccessor& accessor, float radius = 0.0f);
+
+	// forget the last sample of every path
+	void Clear();
+private:
+	struct Sample
+	{
+		float	mX;
+		float	mY;
+	};
+
+	HeatmapPointSink&			mSink;
+	float						mMaxStep;
+	float						mZRange[2];
+	std::map<int64_t, Sample>	mLast;
+	TrajectoryArrays			mTrajectory;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// Accumulates weighted points and segments into a float grid over a world rectangle and spreads each one
+// with a separable kernel the size of its radius. Segments are binned as a one pixel wide line along their
+// major axis, which the kernel then widens. Points and segments are grouped by radius and every group is
+// binned and convolved on its own, the binning and both convolution passes split into row bands across threads.
+// The result can be written as a colour ramped PNG or as raw floats.
+class HeatmapRasterizer : public HeatmapPointSink
+{
+public:
+	HeatmapRasterizer();
+
+	// the longer world axis gets imageSize pixels and the other one keeps the aspect, radii are in world units
+	void Init(const float worldMins[2], const float worldMaxs[2], int imageSize, float eventRadius);
+	// an explicit grid whose top left corner is at left, top in the world, for rendering part of a larger image
+	void InitRegion(float left, float top, float pixelSize, int width, int height, float eventRadius);
+	// 0 uses every hardware thread
+	void SetThreadCount(int numThreads) { mNumThreads = numThreads; }
+
+	void Clear();
+	void AddPoint(float x, float y, float weight = 1.0f, float radius = 0.0f);
+	void AddLine(float x0, float y0, float x1, float y1, float weight = 1.0f, float radius = 0.0f);
+	// the point field, radius and weight of the event from its annotation, returns false for events without a position
+	bool AddEvent(const google::protobuf::Message& msg, const PointEventAccessor& accessor);
+	size_t GetNumPoints() const;
+	size_t GetNumSegments() const;
+	// adds the points and segments of another rasterizer over the same grid, like the partial of a worker. false when the grids differ
+	bool Merge(const HeatmapRasterizer& other);
+
+	// bins the points and convolves the grid, the image stays valid until the next call
+	void Render();
+
+	int GetWidth() const { return mWidth; }
+	int GetHeight() const { return mHeight; }
+	// row 0 is the top of the map, the max y edge
+	const float* GetImage() const { return mImage.empty() ? NULL : &mImage[0]; }
+	float GetMaxValue() const { return mMaxValue; }
+
+	// normalized against the max value and colour ramped
+	bool WritePng(const char* filename, std::string& error) const;
+	// width * height native floats, one row after another
+	bool WriteRaw(const char* filename, std::string& error) const;
+private:
+	struct Point
+	{
+		float	mX;
+		float	mY;
+		float	mWeight;
+	};
+
+	struct Segment
+	{
+		float	mX0;
+		float	mY0;
+		float	mX1;
+		float	mY1;
+		float	mWeight;
+	};
+
+	// points sharing a kernel, radii are bucketed so continuous radius fields don't make a pass per event
+	struct Layer
+	{
+		std::vector<float>		mKernel;
+		float					mKernelSum;
+		std::vector<Point>		mPoints;
+		std::vector<Segment>	mSegments;
+	};
+
+	float					mWorldMins[2];
+	float					mScale;
+	float					mRadius;
+	int						mWidth;
+	int						mHeight;
+	int						mNumThreads;
+
+	std::vector<Layer>		mLayers;
+	std::map<int, size_t>	mLayerIndex;
+	float					mLastRadius;
+	size_t					mLastLayer;
+	std::vector<float>		mImage;
+	std::vector<float>		mBins;
+	std::vector<float>		mTemp;
+	float					mMaxValue;
+
+	// an index rather than a reference, adding a layer moves the others
+	size_t GetLayerIndex(float radiusPixels);
+	Layer& GetLastLayer(float radius);
+	void Bin(const Layer& layer, int rowBegin, int rowEnd);
+	void BinPoint(const Point& pt, int rowBegin, int rowEnd);
+	void BinSegment(const Segment& seg, float weightScale, int rowBegin, int rowEnd);
+	void ConvolveRows(const Layer& layer, int rowBegin, int rowEnd);
+	void ConvolveColumns(const Layer& layer, int rowBegin, int rowEnd);
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// splits [0, count) into one contiguous range per thread and waits for all of them, 0 threads uses every hardware thread
+void HeatmapParallelFor(int count, int numThreads, const std::function<void(int begin, int end)>& fn);
+
+// the ramp of the old ImageMagick script, #004 - #804 - #f00 - #f80 - #ff0 - #ffa over [0,1]
+void HeatmapColor(float t, uint8_t rgb[3]);
+
+// 8 bit RGB, rows top to bottom
+bool WriteHeatmapPng(const char* filename, int width, int height, const uint8_t* rgb, std::string& error);
+
+#endif
@@ -0,0 +1,767 @@
+#include "GameAnalytics_jobs.h"
+#include "GameAnalytics_workpool.h"
+
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+
+#include "google/protobuf/arena.h"
+#include "google/protobuf/util/json_util.h"
+
+#include <cpp_redis/cpp_redis>
+#include <cpp_redis/core/client.hpp>
+
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+static bool ParsePayload(const std::string& payload, google::protobuf::Message& msg)
+{
+	if (msg.GetDescriptor()->options().HasExtension(Analytics::useJsonEncoding))
+		return google::protobuf::util::JsonStringToMessage(payload, &msg).ok();
+	return msg.ParseFromString(payload);
+}
+
+static std::string ReplyError(const cpp_redis::reply& r)
+{
+	return r.is_error() ? r.error() : "unexpected reply";
+}
+
+static double MillisecondsSince(const std::chrono::steady_clock::time_point& start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void SessionEvents::Clear()
+{
+	// the payload lists keep their capacity for the next session of the worker
+	mSession.clear();
+	mGameInfo.clear();
+	mStrings.clear();
+	for (size_t i = 0; i < mPayloads.size(); ++i)
+		mPayloads[i].clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RedisSessionSource::RedisSessionSource(const std::string& host, int port)
+	: mHost(host)
+	, mPort(port)
+	, mClient(nullptr)
+{
+}
+
+RedisSessionSource::~RedisSessionSource()
+{
+	if (mClient != nullptr)
+	{
+		mClient->disconnect(true);
+		delete mClient;
+	}
+}
+
+bool RedisSessionSource::Connect(std::string& error)
+{
+	mClient = new cpp_redis::client();
+	try
+	{
+		mClient->connect(mHost, mPort);
+		return true;
+	}
+	catch (const std::exception& e)
+	{
+		error = e.what();
+		delete mClient;
+		mClient = nullptr;
+		return false;
+	}
+}
+
+std::unique_ptr<SessionSource> RedisSessionSource::Clone(std::string& error) const
+{
+	std::unique_ptr<RedisSessionSource> source(new RedisSessionSource(mHost, mPort));
+	if (!source->Connect(error))
+		return std::unique_ptr<SessionSource>();
+	return source;
+}
+
+bool RedisSessionSource::ListSessions(std::vector<std::string>& sessions, std::string& error)
+{
+	sessions.clear();
+	if (mClient == nullptr)
+	{
+		error = "not connected";
+		return false;
+	}
+
+	std::future<cpp_redis::reply> f = mClient->lrange("event_streams", 0, -1);
+	mClient->sync_commit();
+
+	const cpp_redis::reply r = f.get();
+	if (!r.is_array())
+	{
+		error = ReplyError(r);
+		return false;
+	}
+
+	const std::vector<cpp_redis::reply>& values = r.as_array();
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		if (values[i].is_string())
+			sessions.push_back(values[i].as_string());
+	}
+	return true;
+}
+
+std::string RedisSessionSource::GetKey(const std::string& session, const google::protobuf::Descriptor* desc) const
+{
+	// an empty registry means the session uses named keys
+	if (mTypes.Empty())
+		return session + ":" + desc->name();
+
+	const uint32_t typeId = mTypes.FindId(desc);
+	if (typeId == 0)
+		return std::string();
+	return session + ":" + SessionTypeRegistry::TypeKey(typeId);
+}
+
+bool RedisSessionSource::FetchSession(const std::string& session, const std::vector<const google::protobuf::Descriptor*>& types, SessionEvents& events, std::string& error)
+{
+	events.Clear();
+	events.mSession = session;
+	events.mPayloads.resize(types.size());
+
+	if (mClient == nullptr)
+	{
+		error = "not connected";
+		return false;
+	}
+
+	std::future<cpp_redis::reply> registry = mClient->hgetall(session + ":types");
+	mClient->sync_commit();
+
+	const cpp_redis::reply registryReply = registry.get();
+	if (!registryReply.is_array())
+	{
+		error = ReplyError(registryReply);
+		return false;
+	}
+
+	mTypes.Clear();
+	const std::vector<cpp_redis::reply>& typeValues = registryReply.as_array();
+	for (size_t i = 0; i + 1 < typeValues.size(); i += 2)
+	{
+		if (typeValues[i].is_string() && typeValues[i + 1].is_string())
+			mTypes.Insert((uint32_t)strtoul(typeValues[i].as_string().c_str(), NULL, 10), typeValues[i + 1].as_string());
+	}
+
+	// the keys of each type, a (rediskeysuffix) type has one per suffix value
+	std::vector< std::vector<std::string> > keys(types.size());
+	for (size_t t = 0; t < types.size(); ++t)
+	{
+		const std::string key = GetKey(session, types[t]);
+		if (key.empty())
+			continue;
+
+		if (!types[t]->options().HasExtension(Analytics::rediskeysuffix))
+		{
+			keys[t].push_back(key);
+			continue;
+		}
+
+		size_t cursor = 0;
+		do
+		{
+			std::future<cpp_redis::reply> f = mClient->scan(cursor, key + ":*", 1000);
+			mClient->sync_commit();
+
+			const cpp_redis::reply r = f.get();
+			if (!r.is_array() || r.as_array().size() != 2 || !r.as_array()[0].is_string() || !r.as_array()[1].is_array())
+			{
+				error = ReplyError(r);
+				return false;
+			}
+
+			cursor = (size_t)strtoull(r.as_array()[0].as_string().c_str(), NULL, 10);
+
+			const std::vector<cpp_redis::reply>& found = r.as_array()[1].as_array();
+			for (size_t i = 0; i < found.size(); ++i)
+			{
+				if (found[i].is_string())
+					keys[t].push_back(found[i].as_string());
+			}
+		} while (cursor != 0);
+
+		// scan order is hash order, and a key can come up twice
+		std::sort(keys[t].begin(), keys[t].end());
+		keys[t].erase(std::unique(keys[t].begin(), keys[t].end()), keys[t].end());
+	}
+
+	// the GameInfo, the strings and the size or contents of every key in one round trip
+	const std::string infoKey = GetKey(session, Analytics::GameInfo::descriptor());
+	const std::string stringsKey = GetKey(session, Analytics::GameString::descriptor());
+
+	std::future<cpp_redis::reply> info, strings;
+	if (!infoKey.empty())
+		info = mClient->get(infoKey);
+	if (!stringsKey.empty())
+		strings = mClient->hgetall(stringsKey);
+
+	std::vector< std::vector< std::future<cpp_redis::reply> > > contents(types.size());
+	for (size_t t = 0; t < types.size(); ++t)
+	{
+		const Analytics::RedisKeyType keyType = types[t]->options().GetExtension(Analytics::rediskeytype);
+		for (size_t k = 0; k < keys[t].size(); ++k)
+		{
+			if (keyType == Analytics::RPUSH)
+				contents[t].push_back(mClient->llen(keys[t][k]));
+			else if (keyType == Analytics::HMSET)
+				contents[t].push_back(mClient->hvals(keys[t][k]));
+			else
+				contents[t].push_back(mClient->get(keys[t][k]));
+		}
+	}
+	mClient->sync_commit();
+
+	if (info.valid())
+	{
+		const cpp_redis::reply r = info.get();
+		if (r.is_string())
+			events.mGameInfo = r.as_string();
+	}
+
+	if (strings.valid())
+	{
+		// field/value pairs, the values are serialized GameStrings
+		const cpp_redis::reply r = strings.get();
+		if (r.is_array())
+		{
+			const std::vector<cpp_redis::reply>& values = r.as_array();
+			for (size_t i = 1; i < values.size(); i += 2)
+			{
+				if (values[i].is_string())
+					events.mStrings.push_back(values[i].as_string());
+			}
+		}
+	}
+
+	// the lists in pipelined pages, the rest is already here
+	const int pageSize = 4096;
+
+	std::vector< std::vector< std::future<cpp_redis::reply> > > pages(types.size());
+	for (size_t t = 0; t < types.size(); ++t)
+	{
+		for (size_t k = 0; k < contents[t].size(); ++k)
+		{
+			const cpp_redis::reply r = contents[t][k].get();
+			if (r.is_integer())
+			{
+				for (int64_t start = 0; start < r.as_integer(); start += pageSize)
+					pages[t].push_back(mClient->lrange(keys[t][k], (int)start, (int)(start + pageSize - 1)));
+			}
+			else if (r.is_string())
+			{
+				events.mPayloads[t].push_back(r.as_string());
+			}
+			else if (r.is_array())
+			{
+				const std::vector<cpp_redis::reply>& values = r.as_array();
+				for (size_t i = 0; i < values.size(); ++i)
+				{
+					if (values[i].is_string())
+						events.mPayloads[t].push_back(values[i].as_string());
+				}
+			}
+			else if (r.is_error())
+			{
+				error = r.error();
+				return false;
+			}
+		}
+	}
+	mClient->sync_commit();
+
+	for (size_t t = 0; t < types.size(); ++t)
+	{
+		for (size_t p = 0; p < pages[t].size(); ++p)
+		{
+			const cpp_redis::reply r = pages[t][p].get();
+			if (!r.is_array())
+			{
+				error = ReplyError(r);
+				return false;
+			}
+
+			const std::vector<cpp_redis::reply>& values = r.as_array();
+			for (size_t i = 0; i < values.size(); ++i)
+			{
+				if (values[i].is_string())
+					events.mPayloads[t].push_back(values[i].as_string());
+			}
+		}
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+MemorySessionSource::MemorySessionSource()
+	: mStore(new Store())
+{
+}
+
+void MemorySessionSource::AddEvent(const std::string& session, const google::protobuf::Message& msg)
+{
+	std::string payload;
+	if (msg.GetDescriptor()->options().HasExtension(Analytics::useJsonEncoding))
+		google::protobuf::util::MessageToJsonString(msg, &payload);
+	else
+		payload = msg.SerializeAsString();
+
+	AddPayload(session, msg.GetDescriptor(), payload);
+}
+
+void MemorySessionSource::AddPayload(const std::string& session, const google::protobuf::Descriptor* desc, const std::string& payload)
+{
+	std::pair<std::map<std::string, size_t>::iterator, bool> it = mStore->mIndex.insert(std::make_pair(session, mStore->mSessions.size()));
+	if (it.second)
+	{
+		mStore->mSessions.push_back(Session());
+		mStore->mSessions.back().mName = session;
+	}
+
+	mStore->mSessions[it.first->second].mTypes[desc].push_back(payload);
+}
+
+bool MemorySessionSource::ListSessions(std::vector<std::string>& sessions, std::string&)
+{
+	sessions.clear();
+	for (size_t i = 0; i < mStore->mSessions.size(); ++i)
+		sessions.push_back(mStore->mSessions[i].mName);
+	return true;
+}
+
+bool MemorySessionSource::FetchSession(const std::string& session, const std::vector<const google::protobuf::Descriptor*>& types, SessionEvents& events, std::string& error)
+{
+	events.Clear();
+	events.mSession = session;
+	events.mPayloads.resize(types.size());
+
+	std::map<std::string, size_t>::const_iterator it = mStore->mIndex.find(session);
+	if (it == mStore->mIndex.end())
+	{
+		error = "unknown session";
+		return false;
+	}
+
+	const TypeMap& stored = mStore->mSessions[it->second].mTypes;
+
+	// the GameInfo is a SET key, the last one written is the one kept
+	TypeMap::const_iterator info = stored.find(Analytics::GameInfo::descriptor());
+	if (info != stored.end() && !info->second.empty())
+		events.mGameInfo = info->second.back();
+
+	TypeMap::const_iterator strings = stored.find(Analytics::GameString::descriptor());
+	if (strings != stored.end())
+		events.mStrings = strings->second;
+
+	for (size_t t = 0; t < types.size(); ++t)
+	{
+		TypeMap::const_iterator payloads = stored.find(types[t]);
+		if (payloads != stored.end())
+			events.mPayloads[t] = payloads->second;
+	}
+	return true;
+}
+
+std::unique_ptr<SessionSource> MemorySessionSource::Clone(std::string&) const
+{
+	std::unique_ptr<MemorySessionSource> source(new MemorySessionSource());
+	source->mStore = mStore;
+	return source;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void SessionDecoder::Begin(const SessionEvents& events)
+{
+	mQuantizer.ClearBounds();
+	mStrings.Clear();
+
+	Analytics::GameInfo info;
+	if (!events.mGameInfo.empty() && ParsePayload(events.mGameInfo, info) && info.has_worldmins() && info.has_worldmaxs())
+		mQuantizer.SetBounds(info.worldmins(), info.worldmaxs());
+
+	Analytics::GameString str;
+	for (size_t i = 0; i < events.mStrings.size(); ++i)
+	{
+		if (str.ParseFromString(events.mStrings[i]))
+			mStrings.Insert(str.id(), str.value());
+	}
+}
+
+bool SessionDecoder::Decode(const std::string& payload, google::protobuf::Message& msg)
+{
+	if (!ParsePayload(payload, msg))
+		return false;
+
+	mQuantizer.DequantizeMessage(msg);
+
+	if (mStrings.HasInternedFields(msg.GetDescriptor()))
+		mStrings.ResolveMessage(msg);
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SessionJobRunner::SessionJobRunner()
+	: mNumThreads(0)
+	, mNumSessions(0)
+	, mNumEvents(0)
+	, mNumWorkers(0)
+	, mFetchTime(0.0)
+	, mReduceTime(0.0)
+{
+}
+
+bool SessionJobRunner::Run(SessionSource& source, const std::vector<std::string>& sessions, SessionJob& job, std::string& error)
+{
+	mNumSessions = 0;
+	mNumEvents = 0;
+	mNumWorkers = 0;
+	mFailed.clear();
+	mFetchTime = 0.0;
+	mReduceTime = 0.0;
+
+	std::vector<std::string> listed;
+	if (sessions.empty() && !source.ListSessions(listed, error))
+		return false;
+
+	const std::vector<std::string>& work = sessions.empty() ? listed : sessions;
+	if (work.empty())
+		return true;
+
+	std::vector<const google::protobuf::Descriptor*> types;
+	job.GetEventTypes(types);
+	if (types.empty())
+	{
+		error = "the job reads no event types";
+		return false;
+	}
+
+	struct Worker
+	{
+		std::unique_ptr<SessionSource>	mOwnSource;
+		SessionSource*					mSource;
+		std::unique_ptr<SessionJob>		mPartial;
+		google::protobuf::Arena			mArena;
+		SessionDecoder					mDecoder;
+		SessionEvents					mEvents;
+		size_t							mNumSessions;
+		size_t							mNumEvents;
+		std::vector<std::string>		mFailed;
+		double							mFetchTime;
+		double							mReduceTime;
+
+		Worker() : mSource(NULL), mNumSessions(0), mNumEvents(0), mFetchTime(0.0), mReduceTime(0.0) {}
+	};
+
+	// the calling thread's source serves the first worker, the others read through clones
+	const int numWorkers = WorkStealingThreads(work.size(), mNumThreads);
+	std::vector< std::unique_ptr<Worker> > workers;
+	for (int w = 0; w < numWorkers; ++w)
+	{
+		workers.push_back(std::unique_ptr<Worker>(new Worker()));
+		Worker& worker = *workers.back();
+
+		if (w == 0)
+		{
+			worker.mSource = &source;
+		}
+		else
+		{
+			worker.mOwnSource = source.Clone(error);
+			if (!worker.mOwnSource)
+				return false;
+			worker.mSource = worker.mOwnSource.get();
+		}
+
+		worker.mPartial = job.CreatePartial();
+		if (!worker.mPartial)
+		{
+			error = "the job has no partial results";
+			return false;
+		}
+	}
+	mNumWorkers = workers.size();
+
+	google::protobuf::MessageFactory* factory = google::protobuf::MessageFactory::generated_factory();
+
+	WorkStealingFor(work.size(), mNumThreads, [&](size_t index, int w)
+	{
+		Worker& worker = *workers[w];
+		const std::string& session = work[index];
+
+		const std::chrono::steady_clock::time_point fetchStart = std::chrono::steady_clock::now();
+
+		std::string fetchError;
+		if (!worker.mSource->FetchSession(session, types, worker.mEvents, fetchError))
+		{
+			worker.mFailed.push_back(session + ": " + fetchError);
+			return;
+		}
+
+		const std::chrono::steady_clock::time_point reduceStart = std::chrono::steady_clock::now();
+		worker.mFetchTime += std::chrono::duration<double, std::milli>(reduceStart - fetchStart).count();
+
+		worker.mDecoder.Begin(worker.mEvents);
+		worker.mPartial->BeginSession(session);
+
+		for (size_t t = 0; t < types.size(); ++t)
+		{
+			const google::protobuf::Message* prototype = factory->GetPrototype(types[t]);
+			const std::vector<std::string>& payloads = worker.mEvents.mPayloads[t];
+			for (size_t i = 0; i < payloads.size(); ++i)
+			{
+				google::protobuf::Message* msg = prototype->New(&worker.mArena);
+				if (worker.mDecoder.Decode(payloads[i], *msg))
+				{
+					worker.mPartial->AddEvent(*msg);
+					++worker.mNumEvents;
+				}
+			}
+		}
+
+		worker.mPartial->EndSession(session);
+
+		// the messages of the session all go at once
+		worker.mArena.Reset();
+
+		++worker.mNumSessions;
+		worker.mReduceTime += MillisecondsSince(reduceStart);
+	});
+
+	for (size_t w = 0; w < workers.size(); ++w)
+	{
+		mNumSessions += workers[w]->mNumSessions;
+		mNumEvents += workers[w]->mNumEvents;
+		mFetchTime += workers[w]->mFetchTime;
+		mReduceTime += workers[w]->mReduceTime;
+		mFailed.insert(mFailed.end(), workers[w]->mFailed.begin(), workers[w]->mFailed.end());
+	}
+
+	// the merge stage, pairs of partials fold together in parallel until one is left
+	bool merged = true;
+	for (size_t count = workers.size(); count > 1 && merged;)
+	{
+		const size_t half = (count + 1) / 2;
+		std::vector<char> ok(count - half, 1);
+		WorkStealingFor(count - half, mNumThreads, [&](size_t index, int)
+		{
+			ok[index] = workers[index]->mPartial->Merge(*workers[half + index]->mPartial) ? 1 : 0;
+		});
+
+		merged = std::find(ok.begin(), ok.end(), 0) == ok.end();
+		count = half;
+	}
+
+	if (!merged || !job.Merge(*workers[0]->mPartial))
+	{
+		error = "the partial results don't merge";
+		return false;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+HeatmapJob::HeatmapJob()
+	: mPoints(NULL)
+	, mLines(NULL)
+{
+}
+
+bool HeatmapJob::Init(const GameAnalytics::HeatmapDef& def, std::string& error)
+{
+	mEventId = def.mEventId;
+	mDef = def;
+	mDef.mEventId = mEventId.c_str();
+
+	// event ids are message names, like the heatmaps of GameAnalytics
+	const google::protobuf::DescriptorPool* pool = google::protobuf::DescriptorPool::generated_pool();
+	const google::protobuf::Descriptor* desc = pool->FindMessageTypeByName("Analytics." + mEventId);
+	if (desc == NULL)
+		desc = pool->FindMessageTypeByName(mEventId);
+	if (desc == NULL)
+	{
+		error = "unknown event type " + mEventId;
+		return false;
+	}
+
+	mPoints = NULL;
+	mLines = NULL;
+	if (def.mLines)
+		mLines = LineEventAccessor::Find(desc);
+	else
+		mPoints = PointEventAccessor::Find(desc);
+
+	if (mPoints == NULL && mLines == NULL)
+	{
+		error = mEventId + (def.mLines ? " has no usable (line_event) field" : " has no usable (point_event) field");
+		return false;
+	}
+
+	mHeatmap.Init(def.mWorldMins, def.mWorldMaxs, def.mImageSize, def.mEventRadius);
+
+	mPaths.reset();
+	if (mLines != NULL)
+	{
+		mPaths.reset(new HeatmapPathBuilder(mHeatmap, mLines->GetMaxStep()));
+		mPaths->SetZRange(def.mWorldMins[2], def.mWorldMaxs[2]);
+	}
+	return true;
+}
+
+void HeatmapJob::GetEventTypes(std::vector<const google::protobuf::Descriptor*>& types) const
+{
+	types.clear();
+	if (mLines != NULL)
+	{
+		types.push_back(mLines->GetLineField()->containing_type());
+
+		// trajectory mode sends the positions in chunks instead
+		if (types.back() == Analytics::GameEntityPosition::descriptor())
+			types.push_back(Analytics::GameEntityTrajectory::descriptor());
+	}
+	else if (mPoints != NULL)
+		types.push_back(mPoints->GetPointField()->containing_type());
+}
+
+std::unique_ptr<SessionJob> HeatmapJob::CreatePartial() const
+{
+	std::unique_ptr<HeatmapJob> partial(new HeatmapJob());
+
+	std::string error;
+	if (!partial->Init(mDef, error))
+		return std::unique_ptr<SessionJob>();
+	return partial;
+}
+
+void HeatmapJob::BeginSession(const std::string&)
+{
+	// paths don't continue from one session into the next
+	if (mPaths)
+		mPaths->Clear();
+}
+
+void HeatmapJob::AddEvent(const google::protobuf::Message& msg)
+{
+	if (mPaths)
+	{
+		if (msg.GetDescriptor() == Analytics::GameEntityTrajectory::descriptor())
+			mPaths->AddTrajectory(static_cast<const Analytics::GameEntityTrajectory&>(msg), *mLines, mDef.mEventRadius);
+		else
+			mPaths->AddEvent(msg, *mLines, mDef.mEventRadius);
+		return;
+	}
+
+	float pos[3], radius, weight;
+	if (mPoints->Read(msg, pos, radius, weight) && pos[2] >= mDef.mWorldMins[2] && pos[2] <= mDef.mWorldMaxs[2])
+		mHeatmap.AddPoint(pos[0], pos[1], weight, mDef.mEventRadius > 0.0f ? mDef.mEventRadius : radius);
+}
+
+bool HeatmapJob::Merge(const SessionJob& partial)
+{
+	const HeatmapJob* other = dynamic_cast<const HeatmapJob*>(&partial);
+	return other != NULL && mHeatmap.Merge(other->mHeatmap);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SketchJob::SketchJob(const std::vector<const google::protobuf::Descriptor*>& types)
+	: mTypes(types)
+{
+}
+
+void SketchJob::GetEventTypes(std::vector<const google::protobuf::Descriptor*>& types) const
+{
+	types = mTypes;
+}
+
+std::unique_ptr<SessionJob> SketchJob::CreatePartial() const
+{
+	return std::unique_ptr<SessionJob>(new SketchJob(mTypes));
+}
+
+void SketchJob::AddEvent(const google::protobuf::Message& msg)
+{
+	mSketches.AddEvent(msg);
+}
+
+bool SketchJob::Merge(const SessionJob& partial)
+{
+	const SketchJob* other = dynamic_cast<const SketchJob*>(&partial);
+	return other != NULL && mSketches.Merge(other->mSketches);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RollupJob::RollupJob(const std::vector<const google::protobuf::Descriptor*>& types)
+	: mTypes(types)
+{
+	mRollup.SetBucketSize(1);
+}
+
+void RollupJob::GetTotals(const google::protobuf::Descriptor* type, RollupBucket& bucket) const
+{
+	bucket = RollupBucket();
+
+	// flushing hands the cells out, so a copy does it
+	EventRollup rollup = mRollup;
+	std::vector<EventRollup::Increment> increments;
+	rollup.Flush(increments);
+
+	std::vector< std::pair<std::string, std::string> > hash;
+	for (size_t i = 0; i < increments.size(); ++i)
+	{
+		const EventRollup::Increment& inc = increments[i];
+		if (inc.mType != type)
+			continue;
+
+		for (size_t c = 0; c < inc.mCounts.size(); ++c)
+			hash.push_back(std::make_pair(inc.mCounts[c].first, std::to_string(inc.mCounts[c].second)));
+		for (size_t s = 0; s < inc.mSums.size(); ++s)
+		{
+			// every digit, std::to_string rounds to 6 places
+			char value[32];
+			snprintf(value, sizeof(value), "%.17g", inc.mSums[s].second);
+			hash.push_back(std::make_pair(inc.mSums[s].first, std::string(value)));
+		}
+	}
+
+	EventRollup::ParseBucket(hash, bucket);
+}
+
+void RollupJob::GetEventTypes(std::vector<const google::protobuf::Descriptor*>& types) const
+{
+	types = mTypes;
+}
+
+std::unique_ptr<SessionJob> RollupJob::CreatePartial() const
+{
+	return std::unique_ptr<SessionJob>(new RollupJob(mTypes));
+}
+
+void RollupJob::AddEvent(const google::protobuf::Message& msg)
+{
+	mRollup.AddEvent(msg, 0);
+}
+
+bool RollupJob::Merge(const SessionJob& partial)
+{
+	const RollupJob* other = dynamic_cast<const RollupJob*>(&partial);
+	return other != NULL && mRollup.Merge(other->mRollup);
+}
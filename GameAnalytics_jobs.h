@@ -0,0 +1,235 @@
+#ifndef GAMEANALYTICS_JOBS_H
+#define GAMEANALYTICS_JOBS_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+
+#include "analytics.pb.h"
+#include "GameAnalytics.h"
+
+namespace cpp_redis
+{
+	class client;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Batch jobs over many recorded sessions. The sessions are sharded over a thread pool, each worker reads a session
+// at a time through its own source, decodes it into messages on its own arena and reduces them into a partial
+// result of its own. Once every session is done the partials are merged into the result of the job.
+
+// The stored payloads of a session, as they are in redis
+struct SessionEvents
+{
+	std::string								mSession;
+	// the GameInfo, whose world bounds dequantize positions. empty when the session has none
+	std::string								mGameInfo;
+	// serialized GameStrings, the string table of the session
+	std::vector<std::string>				mStrings;
+	// the payloads of each requested type, in stored order
+	std::vector< std::vector<std::string> >	mPayloads;
+
+	void Clear();
+};
+
+// Where the sessions of a job come from
+class SessionSource
+{
+public:
+	virtual ~SessionSource() {}
+
+	virtual bool ListSessions(std::vector<std::string>& sessions, std::string& error) = 0;
+	// the payloads of the types, one list per type. the GameInfo and the strings of the session come along
+	virtual bool FetchSession(const std::string& session, const std::vector<const google::protobuf::Descriptor*>& types, SessionEvents& events, std::string& error) = 0;
+	// a source of the same sessions for another worker thread, NULL when it can't be made
+	virtual std::unique_ptr<SessionSource> Clone(std::string& error) const = 0;
+};
+
+// Sessions of a redis server, the keys GameAnalytics writes. Each clone has a connection of its own and the reads
+// of a session are pipelined, the type registry first, then the GameInfo, strings and the lengths of the lists,
+// then every page of every list. Per entity keys of a (rediskeysuffix) type are found with SCAN. The jobs mode of
+// TestApplication runs on MemorySessionSource, this one is only exercised against a live server.
+class RedisSessionSource : public SessionSource
+{
+public:
+	RedisSessionSource(const std::string& host, int port = 6379);
+	~RedisSessionSource();
+
+	bool Connect(std::string& error);
+
+	// the event_streams list
+	bool ListSessions(std::vector<std::string>& sessions, std::string& error) override;
+	bool FetchSession(const std::string& session, const std::vector<const google::protobuf::Descriptor*>& types, SessionEvents& events, std::string& error) override;
+	std::unique_ptr<SessionSource> Clone(std::string& error) const override;
+private:
+	std::string				mHost;
+	int						mPort;
+	cpp_redis::client *		mClient;
+	SessionTypeRegistry		mTypes;
+
+	std::string GetKey(const std::string& session, const google::protobuf::Descriptor* desc) const;
+};
+
+// Sessions held in memory, payloads added the way GameAnalytics stores them. For tools that already have the
+// events at hand and as a stand-in for a redis server. Clones share the sessions, which are read only once added.
+class MemorySessionSource : public SessionSource
+{
+public:
+	MemorySessionSource();
+
+	// encodes the event like GameAnalytics does, binary or json by type
+	void AddEvent(const std::string& session, const google::protobuf::Message& msg);
+	void AddPayload(const std::string& session, const google::protobuf::Descriptor* desc, const std::string& payload);
+
+	bool ListSessions(std::vector<std::string>& sessions, std::string& error) override;
+	bool FetchSession(const std::string& session, const std::vector<const google::protobuf::Descriptor*>& types, SessionEvents& events, std::string& error) override;
+	std::unique_ptr<SessionSource> Clone(std::string& error) const override;
+private:
+	typedef std::map<const google::protobuf::Descriptor*, std::vector<std::string> > TypeMap;
+	struct Session
+	{
+		std::string		mName;
+		TypeMap			mTypes;
+	};
+	struct Store
+	{
+		std::vector<Session>			mSessions;
+		std::map<std::string, size_t>	mIndex;
+	};
+
+	std::shared_ptr<Store>	mStore;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// Decodes the payloads of one session the way GameAnalytics::ParseEvent does, positions dequantized against its
+// GameInfo and interned strings resolved from its string table. Ids missing from the table are left alone.
+class SessionDecoder
+{
+public:
+	void Begin(const SessionEvents& events);
+	bool Decode(const std::string& payload, google::protobuf::Message& msg);
+private:
+	Vec3Quantizer		mQuantizer;
+	SessionStringTable	mStrings;
+};
+
+// A reduction over the events of sessions. The runner makes a partial of the job per worker with CreatePartial,
+// feeds each of them the sessions of its worker and merges them all into the job at the end.
+class SessionJob
+{
+public:
+	virtual ~SessionJob() {}
+
+	// the event types the job reads
+	virtual void GetEventTypes(std::vector<const google::protobuf::Descriptor*>& types) const = 0;
+	// an empty result with the settings of this one
+	virtual std::unique_ptr<SessionJob> CreatePartial() const = 0;
+
+	// the events of a session come between these, type by type and each type in stored order. the messages
+	// live on the arena of the worker and stay valid until EndSession
+	virtual void BeginSession(const std::string& /*session*/) {}
+	virtual void AddEvent(const google::protobuf::Message& msg) = 0;
+	virtual void EndSession(const std::string& /*session*/) {}
+
+	// folds a partial of this job in, false when it doesn't fit
+	virtual bool Merge(const SessionJob& partial) = 0;
+};
+
+class SessionJobRunner
+{
+public:
+	SessionJobRunner();
+
+	// 0 uses every hardware thread
+	void SetThreadCount(int numThreads) { mNumThreads = numThreads; }
+
+	// runs the job over the sessions, every session of the source when there are none. sessions that can't be read
+	// are skipped and listed in GetFailed, false means the job couldn't run or its partials didn't merge
+	bool Run(SessionSource& source, const std::vector<std::string>& sessions, SessionJob& job, std::string& error);
+
+	size_t GetNumSessions() const { return mNumSessions; }
+	size_t GetNumEvents() const { return mNumEvents; }
+	size_t GetNumWorkers() const { return mNumWorkers; }
+	// session: error
+	const std::vector<std::string>& GetFailed() const { return mFailed; }
+	// milliseconds, summed over the workers
+	double GetFetchTime() const { return mFetchTime; }
+	double GetReduceTime() const { return mReduceTime; }
+private:
+	int							mNumThreads;
+	size_t						mNumSessions;
+	size_t						mNumEvents;
+	size_t						mNumWorkers;
+	std::vector<std::string>	mFailed;
+	double						mFetchTime;
+	double						mReduceTime;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// The (point_event) or (line_event) events of def.mEventId rasterized the way WriteSessionHeatmap does, the
+// points of the workers add up in one grid. Paths are joined within a session, GameEntityPosition paths also
+// from the GameEntityTrajectory chunks of trajectory mode.
+class HeatmapJob : public SessionJob
+{
+public:
+	HeatmapJob();
+
+	bool Init(const GameAnalytics::HeatmapDef& def, std::string& error);
+
+	HeatmapRasterizer& GetHeatmap() { return mHeatmap; }
+
+	void GetEventTypes(std::vector<const google::protobuf::Descriptor*>& types) const override;
+	std::unique_ptr<SessionJob> CreatePartial() const override;
+	void BeginSession(const std::string& session) override;
+	void AddEvent(const google::protobuf::Message& msg) override;
+	bool Merge(const SessionJob& partial) override;
+private:
+	std::string							mEventId;
+	GameAnalytics::HeatmapDef			mDef;
+	const PointEventAccessor*			mPoints;
+	const LineEventAccessor*			mLines;
+	HeatmapRasterizer					mHeatmap;
+	std::unique_ptr<HeatmapPathBuilder>	mPaths;
+};
+
+// EventSketches over the events of the types
+class SketchJob : public SessionJob
+{
+public:
+	explicit SketchJob(const std::vector<const google::protobuf::Descriptor*>& types);
+
+	const EventSketches& GetSketches() const { return mSketches; }
+
+	void GetEventTypes(std::vector<const google::protobuf::Descriptor*>& types) const override;
+	std::unique_ptr<SessionJob> CreatePartial() const override;
+	void AddEvent(const google::protobuf::Message& msg) override;
+	bool Merge(const SessionJob& partial) override;
+private:
+	std::vector<const google::protobuf::Descriptor*>	mTypes;
+	EventSketches										mSketches;
+};
+
+// The counts and weight sums of each (track_event) combination of the types over all sessions, the cells of
+// EventRollup. Stored events carry no time, so everything lands in one bucket.
+class RollupJob : public SessionJob
+{
+public:
+	explicit RollupJob(const std::vector<const google::protobuf::Descriptor*>& types);
+
+	// the totals of the type, once the job has run
+	void GetTotals(const google::protobuf::Descriptor* type, RollupBucket& bucket) const;
+
+	void GetEventTypes(std::vector<const google::protobuf::Descriptor*>& types) const override;
+	std::unique_ptr<SessionJob> CreatePartial() const override;
+	void AddEvent(const google::protobuf::Message& msg) override;
+	bool Merge(const SessionJob& partial) override;
+private:
+	std::vector<const google::protobuf::Descriptor*>	mTypes;
+	EventRollup											mRollup;
+};
+
+#endif
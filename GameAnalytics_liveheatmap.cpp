@@ -0,0 +1,355 @@
+#include "GameAnalytics_liveheatmap.h"
+
+#include <cmath>
+#include <climits>
+#include <algorithm>
+
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+// stamps are cut off at this radius in cells so the cost of an event stays bounded
+static const int MaxStampRadius = 8;
+
+// rebase the decay scaled values before they get anywhere near the float range
+static const double MaxDecayExponent = 40.0;
+
+static bool TrackValue(const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fdesc, std::string& value)
+{
+	const google::protobuf::Reflection* refl = msg.GetReflection();
+	switch (fdesc->cpp_type())
+	{
+	case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+		value = std::to_string(refl->GetInt32(msg, fdesc));
+		return true;
+	case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+		value = std::to_string(refl->GetInt64(msg, fdesc));
+		return true;
+	case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+		value = std::to_string(refl->GetUInt32(msg, fdesc));
+		return true;
+	case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+		value = std::to_string(refl->GetUInt64(msg, fdesc));
+		return true;
+	case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+		value = refl->GetBool(msg, fdesc) ? "true" : "false";
+		return true;
+	case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+		value = refl->GetEnum(msg, fdesc)->name();
+		return true;
+	case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+		value = refl->GetString(msg, fdesc);
+		return !value.empty();
+	default:
+		return false;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+LiveHeatmap::LiveHeatmap(const PointEventAccessor& accessor, const float worldMins[2], const float worldMaxs[2], int resolution)
+	: mAccessor(accessor)
+	, mDecayRate(0.0)
+	, mDecayOrigin(0)
+	, mSliceLength(0)
+	, mNumSlices(0)
+{
+	const google::protobuf::Descriptor* desc = GetEventType();
+	for (int i = 0; i < desc->field_count(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* fdesc = desc->field(i);
+		if (!fdesc->is_repeated() && fdesc->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE &&
+			fdesc->options().GetExtension(Analytics::track_event))
+			mTrackFields.push_back(fdesc);
+	}
+
+	const float worldSizeX = std::max(worldMaxs[0] - worldMins[0], 1.0f);
+	const float worldSizeY = std::max(worldMaxs[1] - worldMins[1], 1.0f);
+
+	resolution = std::max(resolution, 1);
+	if (worldSizeX > worldSizeY)
+	{
+		mWidth = resolution;
+		mHeight = std::max((int)ceilf(resolution * worldSizeY / worldSizeX), 1);
+		mScale = (float)mWidth / worldSizeX;
+	}
+	else
+	{
+		mWidth = std::max((int)ceilf(resolution * worldSizeX / worldSizeY), 1);
+		mHeight = resolution;
+		mScale = (float)mHeight / worldSizeY;
+	}
+
+	for (int i = 0; i < 2; ++i)
+	{
+		mWorldMins[i] = worldMins[i];
+		mWorldMaxs[i] = worldMaxs[i];
+	}
+}
+
+void LiveHeatmap::SetDecay(int64_t halfLife)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mDecayRate = halfLife > 0 ? log(2.0) / (double)halfLife : 0.0;
+	mDecayOrigin = 0;
+	mSliceLength = 0;
+	mNumSlices = 0;
+	mGrids.clear();
+}
+
+void LiveHeatmap::SetWindow(int64_t window, int numSlices)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	numSlices = std::max(numSlices, 1);
+	mSliceLength = window > 0 ? std::max(window / numSlices, (int64_t)1) : 0;
+	mNumSlices = window > 0 ? numSlices : 0;
+	mDecayRate = 0.0;
+	mGrids.clear();
+}
+
+void LiveHeatmap::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mGrids.clear();
+	mDecayOrigin = 0;
+}
+
+bool LiveHeatmap::AddEvent(const google::protobuf::Message& msg, int64_t timeStamp)
+{
+	float pos[3], radius, weight;
+	if (!mAccessor.Read(msg, pos, radius, weight))
+		return false;
+
+	const float x = (pos[0] - mWorldMins[0]) * mScale - 0.5f;
+	const float y = (mWorldMaxs[1] - pos[1]) * mScale - 0.5f;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	// radii under a cell are splatted bilinearly, larger ones get a stamp of the same falloff as the rasterizer
+	const std::vector<float>* kernel = NULL;
+	const float radiusCells = radius * mScale;
+	if (radiusCells >= 1.0f)
+	{
+		const int bucket = std::min((int)(radiusCells + 0.5f), MaxStampRadius);
+		std::vector<float>& k = mKernels[bucket];
+		if (k.empty())
+		{
+			const int halfWidth = (int)ceilf(bucket * 1.5f);
+			const float sigma = bucket * 0.5f;
+			for (int i = -halfWidth; i <= halfWidth; ++i)
+				k.push_back(expf(-(float)(i * i) / (2.0f * sigma * sigma)));
+		}
+		kernel = &k;
+	}
+
+	int64_t slice = 0;
+	if (mNumSlices > 0)
+	{
+		slice = timeStamp / mSliceLength;
+	}
+	else if (mDecayRate > 0.0)
+	{
+		// stored values grow with time instead of every cell shrinking, so an event touches only its stamp
+		if ((double)(timeStamp - mDecayOrigin) * mDecayRate > MaxDecayExponent)
+			Rebase(timeStamp);
+		weight *= (float)exp((double)(timeStamp - mDecayOrigin) * mDecayRate);
+	}
+
+	std::string key, value;
+	for (size_t i = 0; i <= mTrackFields.size(); ++i)
+	{
+		if (i > 0)
+		{
+			if (!TrackValue(msg, mTrackFields[i - 1], value))
+				continue;
+			key = mTrackFields[i - 1]->name() + "=" + value;
+		}
+
+		Grid& grid = GetGrid(key);
+		if (mNumSlices > 0)
+		{
+			if (!AdvanceWindow(grid, slice))
+				continue;
+			Splat(&grid.mSlices[(size_t)(slice % mNumSlices) * mWidth * mHeight], x, y, kernel, weight);
+		}
+		Splat(&grid.mValues[0], x, y, kernel, weight);
+	}
+	return true;
+}
+
+void LiveHeatmap::GetKeys(std::vector<std::string>& keys) const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	for (std::map<std::string, Grid>::const_iterator it = mGrids.begin(); it != mGrids.end(); ++it)
+		keys.push_back(it->first);
+}
+
+bool LiveHeatmap::GetSnapshot(const std::string& key, int64_t timeStamp, std::vector<float>& values, float& maxValue)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	std::map<std::string, Grid>::iterator it = mGrids.find(key);
+	if (it == mGrids.end())
+		return false;
+
+	Grid& grid = it->second;
+	if (mNumSlices > 0)
+		AdvanceWindow(grid, timeStamp / mSliceLength);
+
+	const float scale = GetScale(timeStamp);
+
+	values.resize(grid.mValues.size());
+	maxValue = 0.0f;
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		values[i] = grid.mValues[i] * scale;
+		maxValue = std::max(maxValue, values[i]);
+	}
+	return true;
+}
+
+bool LiveHeatmap::GetSnapshot(const std::string& key, int64_t timeStamp, Analytics::LiveHeatmap& snapshot)
+{
+	std::vector<float> values;
+	float maxValue = 0.0f;
+	if (!GetSnapshot(key, timeStamp, values, maxValue))
+		return false;
+
+	snapshot.set_eventtype(GetEventType()->name());
+	snapshot.set_key(key);
+	snapshot.set_timestamp(timeStamp);
+	snapshot.set_width(mWidth);
+	snapshot.set_height(mHeight);
+	snapshot.set_maxvalue(maxValue);
+	snapshot.mutable_worldmins()->set_x(mWorldMins[0]);
+	snapshot.mutable_worldmins()->set_y(mWorldMins[1]);
+	snapshot.mutable_worldmaxs()->set_x(mWorldMaxs[0]);
+	snapshot.mutable_worldmaxs()->set_y(mWorldMaxs[1]);
+
+	const float scale = maxValue > 0.0f ? 255.0f / maxValue : 0.0f;
+
+	std::string* bytes = snapshot.mutable_values();
+	bytes->resize(values.size());
+	for (size_t i = 0; i < values.size(); ++i)
+		(*bytes)[i] = (char)(uint8_t)(values[i] * scale + 0.5f);
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+LiveHeatmap::Grid& LiveHeatmap::GetGrid(const std::string& key)
+{
+	std::map<std::string, Grid>::iterator it = mGrids.find(key);
+	if (it != mGrids.end())
+		return it->second;
+
+	Grid& grid = mGrids[key];
+	ResetGrid(grid);
+	return grid;
+}
+
+void LiveHeatmap::ResetGrid(Grid& grid)
+{
+	const size_t cells = (size_t)mWidth * mHeight;
+	grid.mValues.assign(cells, 0.0f);
+	grid.mSlices.assign(mNumSlices > 0 ? cells * mNumSlices : 0, 0.0f);
+	grid.mNewestSlice = LLONG_MIN;
+}
+
+bool LiveHeatmap::AdvanceWindow(Grid& grid, int64_t slice)
+{
+	if (grid.mNewestSlice != LLONG_MIN && slice <= grid.mNewestSlice)
+	{
+		// late events still count while their slice is in the window
+		return slice > grid.mNewestSlice - mNumSlices;
+	}
+
+	const size_t cells = (size_t)mWidth * mHeight;
+	if (grid.mNewestSlice == LLONG_MIN || slice - grid.mNewestSlice >= mNumSlices)
+	{
+		std::fill(grid.mSlices.begin(), grid.mSlices.end(), 0.0f);
+	}
+	else
+	{
+		for (int64_t s = grid.mNewestSlice + 1; s <= slice; ++s)
+			std::fill(grid.mSlices.begin() + (size_t)(s % mNumSlices) * cells, grid.mSlices.begin() + (size_t)(s % mNumSlices + 1) * cells, 0.0f);
+	}
+	grid.mNewestSlice = slice;
+
+	// summed again rather than subtracted so the total doesn't drift
+	std::fill(grid.mValues.begin(), grid.mValues.end(), 0.0f);
+	for (int s = 0; s < mNumSlices; ++s)
+	{
+		const float* src = &grid.mSlices[(size_t)s * cells];
+		for (size_t i = 0; i < cells; ++i)
+			grid.mValues[i] += src[i];
+	}
+	return true;
+}
+
+void LiveHeatmap::Splat(float* cells, float x, float y, const std::vector<float>* kernel, float weight) const
+{
+	if (kernel == NULL)
+	{
+		const float fx = floorf(x);
+		const float fy = floorf(y);
+		const int cx = (int)fx;
+		const int cy = (int)fy;
+		const float tx = x - fx;
+		const float ty = y - fy;
+
+		const float w[2][2] =
+		{
+			{ (1.0f - tx) * (1.0f - ty), tx * (1.0f - ty) },
+			{ (1.0f - tx) * ty, tx * ty },
+		};
+
+		for (int r = 0; r < 2; ++r)
+		{
+			if (cy + r < 0 || cy + r >= mHeight)
+				continue;
+			for (int c = 0; c < 2; ++c)
+			{
+				if (cx + c >= 0 && cx + c < mWidth)
+					cells[(size_t)(cy + r) * mWidth + cx + c] += w[r][c] * weight;
+			}
+		}
+		return;
+	}
+
+	const int halfWidth = (int)kernel->size() / 2;
+	const int cx = (int)floorf(x + 0.5f);
+	const int cy = (int)floorf(y + 0.5f);
+
+	const int x0 = std::max(cx - halfWidth, 0);
+	const int x1 = std::min(cx + halfWidth, mWidth - 1);
+	const int y0 = std::max(cy - halfWidth, 0);
+	const int y1 = std::min(cy + halfWidth, mHeight - 1);
+
+	for (int row = y0; row <= y1; ++row)
+	{
+		const float rowWeight = (*kernel)[row - cy + halfWidth] * weight;
+		float* dst = &cells[(size_t)row * mWidth];
+		for (int col = x0; col <= x1; ++col)
+			dst[col] += (*kernel)[col - cx + halfWidth] * rowWeight;
+	}
+}
+
+void LiveHeatmap::Rebase(int64_t timeStamp)
+{
+	const float scale = GetScale(timeStamp);
+	for (std::map<std::string, Grid>::iterator it = mGrids.begin(); it != mGrids.end(); ++it)
+	{
+		std::vector<float>& values = it->second.mValues;
+		for (size_t i = 0; i < values.size(); ++i)
+			values[i] *= scale;
+	}
+	mDecayOrigin = timeStamp;
+}
+
+float LiveHeatmap::GetScale(int64_t timeStamp) const
+{
+	if (mDecayRate <= 0.0)
+		return 1.0f;
+	return (float)exp(-(double)(timeStamp - mDecayOrigin) * mDecayRate);
+}
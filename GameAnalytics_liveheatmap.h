@@ -0,0 +1,85 @@
+#ifndef GAMEANALYTICS_LIVEHEATMAP_H
+#define GAMEANALYTICS_LIVEHEATMAP_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <cstdint>
+
+#include "analytics.pb.h"
+#include "GameAnalytics_heatmap.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// Fixed resolution grids for one (point_event) type that are updated as events arrive. Every event
+// lands in the grid of all events and in one grid per (track_event) value it carries, keyed as
+// "field=value", with a small stamp sized by its radius, so the cost per event doesn't grow with the
+// session. Grids either keep everything, decay with a half life or only count a sliding time window.
+// All calls lock, so snapshots can be taken from another thread than the one adding events.
+class LiveHeatmap
+{
+public:
+	// the longer world axis gets resolution cells
+	LiveHeatmap(const PointEventAccessor& accessor, const float worldMins[2], const float worldMaxs[2], int resolution);
+
+	// values halve every halfLife milliseconds, 0 keeps them. clears the grids
+	void SetDecay(int64_t halfLife);
+	// only events of the last window milliseconds count, expired in numSlices steps. 0 keeps them. clears the grids
+	void SetWindow(int64_t window, int numSlices = 8);
+
+	const google::protobuf::Descriptor* GetEventType() const { return mAccessor.GetPointField()->containing_type(); }
+	int GetWidth() const { return mWidth; }
+	int GetHeight() const { return mHeight; }
+
+	// false for events of another type or without a position
+	bool AddEvent(const google::protobuf::Message& msg, int64_t timeStamp);
+
+	void GetKeys(std::vector<std::string>& keys) const;
+
+	// the grid as of timeStamp, "" is the grid of all events. rows from the max y edge down
+	bool GetSnapshot(const std::string& key, int64_t timeStamp, std::vector<float>& values, float& maxValue);
+	bool GetSnapshot(const std::string& key, int64_t timeStamp, Analytics::LiveHeatmap& snapshot);
+
+	void Clear();
+private:
+	struct Grid
+	{
+		// the window total or the decay scaled values
+		std::vector<float>	mValues;
+		// window mode, one grid per slice in a ring
+		std::vector<float>	mSlices;
+		int64_t				mNewestSlice;
+	};
+
+	PointEventAccessor		mAccessor;
+	std::vector<const google::protobuf::FieldDescriptor*> mTrackFields;
+
+	float					mWorldMins[2];
+	float					mWorldMaxs[2];
+	float					mScale;
+	int						mWidth;
+	int						mHeight;
+
+	double					mDecayRate;		// per millisecond
+	int64_t					mDecayOrigin;
+
+	int64_t					mSliceLength;
+	int						mNumSlices;
+
+	mutable std::mutex		mMutex;
+	std::map<std::string, Grid> mGrids;
+	std::map<int, std::vector<float> > mKernels;
+
+	LiveHeatmap(const LiveHeatmap& other);
+	LiveHeatmap& operator=(const LiveHeatmap& other);
+
+	Grid& GetGrid(const std::string& key);
+	void ResetGrid(Grid& grid);
+	bool AdvanceWindow(Grid& grid, int64_t slice);
+	void Splat(float* cells, float x, float y, const std::vector<float>* kernel, float weight) const;
+	void Rebase(int64_t timeStamp);
+	float GetScale(int64_t timeStamp) const;
+};
+
+#endif
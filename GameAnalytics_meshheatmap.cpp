@@ -0,0 +1,490 @@
+#include "GameAnalytics_meshheatmap.h"
+
+#include <cmath>
+#include <cfloat>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+//////////////////////////////////////////////////////////////////////////
+
+struct WeldKey
+{
+	uint32_t	mBits[3];
+
+	bool operator==(const WeldKey& other) const
+	{
+		return mBits[0] == other.mBits[0] && mBits[1] == other.mBits[1] && mBits[2] == other.mBits[2];
+	}
+};
+
+struct WeldKeyHash
+{
+	size_t operator()(const WeldKey& key) const
+	{
+		return (size_t)(key.mBits[0] * 73856093u ^ key.mBits[1] * 19349663u ^ key.mBits[2] * 83492791u);
+	}
+};
+
+static inline float Dot(const float a[3], const float b[3])
+{
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static inline uint32_t PackColor(float t)
+{
+	uint8_t rgb[3];
+	HeatmapColor(t, rgb);
+	return 0xff000000u | ((uint32_t)rgb[0] << 16) | ((uint32_t)rgb[1] << 8) | (uint32_t)rgb[2];
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+MeshHeatmap::MeshHeatmap()
+	: mCellSize(1.0f)
+	, mNumThreads(0)
+	, mMaxDistance(0.0f)
+{
+	for (int i = 0; i < 3; ++i)
+	{
+		mBoundsMin[i] = 0.0f;
+		mBoundsMax[i] = 0.0f;
+	}
+}
+
+bool MeshHeatmap::Init(const Analytics::Mesh& mesh)
+{
+	mPositions.clear();
+	mTriangles.clear();
+	mAreas.clear();
+	mMeshVertices.clear();
+	mCellStart.clear();
+	mCellTriangles.clear();
+	mOverflowTriangles.clear();
+	mPending.clear();
+
+	// primitives are triangle soup, shared positions are welded so vertex weights blend across triangles
+	std::unordered_map<WeldKey, uint32_t, WeldKeyHash> welded;
+	for (int p = 0; p < mesh.primitives_size(); ++p)
+	{
+		const Analytics::Primitive& prim = mesh.primitives(p);
+		const size_t base = mMeshVertices.size();
+
+		for (int v = 0; v < prim.vertices_size(); ++v)
+		{
+			const float pos[3] = { prim.vertices(v).x(), prim.vertices(v).y(), prim.vertices(v).z() };
+
+			WeldKey key;
+			memcpy(key.mBits, pos, sizeof(pos));
+
+			std::pair<std::unordered_map<WeldKey, uint32_t, WeldKeyHash>::iterator, bool> it = welded.insert(std::make_pair(key, (uint32_t)(mPositions.size() / 3)));
+			if (it.second)
+				mPositions.insert(mPositions.end(), pos, pos + 3);
+			mMeshVertices.push_back(it.first->second);
+		}
+
+		switch (prim.type())
+		{
+		case Analytics::Triangles:
+			for (int v = 0; v + 3 <= prim.vertices_size(); v += 3)
+			{
+				for (int i = 0; i < 3; ++i)
+					mTriangles.push_back(mMeshVertices[base + v + i]);
+			}
+			break;
+		case Analytics::Quad:
+			for (int v = 0; v + 4 <= prim.vertices_size(); v += 4)
+			{
+				static const int split[6] = { 0, 1, 2, 0, 2, 3 };
+				for (int i = 0; i < 6; ++i)
+					mTriangles.push_back(mMeshVertices[base + v + split[i]]);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	const size_t numTriangles = mTriangles.size() / 3;
+	mTriangleWeights.assign(numTriangles, 0.0f);
+	if (numTriangles == 0)
+		return false;
+
+	// cells about the size of an average triangle
+	double extentSum = 0.0;
+	for (int a = 0; a < 3; ++a)
+	{
+		mBoundsMin[a] = FLT_MAX;
+		mBoundsMax[a] = -FLT_MAX;
+	}
+
+	mAreas.resize(numTriangles);
+	for (size_t t = 0; t < numTriangles; ++t)
+	{
+		const float* v0 = &mPositions[mTriangles[t * 3] * 3];
+		const float* v1 = &mPositions[mTriangles[t * 3 + 1] * 3];
+		const float* v2 = &mPositions[mTriangles[t * 3 + 2] * 3];
+
+		const float e0[3] = { v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2] };
+		const float e1[3] = { v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2] };
+		const float n[3] = { e0[1] * e1[2] - e0[2] * e1[1], e0[2] * e1[0] - e0[0] * e1[2], e0[0] * e1[1] - e0[1] * e1[0] };
+		mAreas[t] = 0.5f * sqrtf(Dot(n, n));
+
+		float extent = 0.0f;
+		for (int a = 0; a < 3; ++a)
+		{
+			const float lo = std::min(v0[a], std::min(v1[a], v2[a]));
+			const float hi = std::max(v0[a], std::max(v1[a], v2[a]));
+			extent = std::max(extent, hi - lo);
+			mBoundsMin[a] = std::min(mBoundsMin[a], lo);
+			mBoundsMax[a] = std::max(mBoundsMax[a], hi);
+		}
+		extentSum += extent;
+	}
+
+	float diagonal = 0.0f;
+	for (int a = 0; a < 3; ++a)
+		diagonal = std::max(diagonal, mBoundsMax[a] - mBoundsMin[a]);
+
+	// a few huge triangles shouldn't make the cells coarse, and slivers shouldn't make millions of them
+	mCellSize = std::max((float)(extentSum / numTriangles), std::max(diagonal / 1024.0f, 1e-3f));
+
+	size_t numBuckets = 1024;
+	while (numBuckets < numTriangles * 2)
+		numBuckets *= 2;
+
+	// counts, offsets, then the triangles of every cell a triangle's bounds overlap
+	float gridMin[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+	float gridMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	mCellStart.assign(numBuckets + 1, 0);
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		std::vector<uint32_t> fill;
+		if (pass == 1)
+		{
+			// the searches only walk the cells of the hashed triangles
+			memcpy(mBoundsMin, gridMin, sizeof(gridMin));
+			memcpy(mBoundsMax, gridMax, sizeof(gridMax));
+
+			for (size_t b = 0; b < numBuckets; ++b)
+				mCellStart[b + 1] += mCellStart[b];
+			mCellTriangles.resize(mCellStart[numBuckets]);
+			fill.assign(mCellStart.begin(), mCellStart.end() - 1);
+		}
+
+		for (size_t t = 0; t < numTriangles; ++t)
+		{
+			float mins[3], maxs[3], lo[3], hi[3];
+			float numCells = 1.0f;
+			for (int a = 0; a < 3; ++a)
+			{
+				const float v0 = mPositions[mTriangles[t * 3] * 3 + a];
+				const float v1 = mPositions[mTriangles[t * 3 + 1] * 3 + a];
+				const float v2 = mPositions[mTriangles[t * 3 + 2] * 3 + a];
+				mins[a] = std::min(v0, std::min(v1, v2));
+				maxs[a] = std::max(v0, std::max(v1, v2));
+				lo[a] = floorf(mins[a] / mCellSize);
+				hi[a] = floorf(maxs[a] / mCellSize);
+				numCells *= hi[a] - lo[a] + 1.0f;
+			}
+
+			// a huge or broken triangle would fill the hash, it goes on the list every search tests instead
+			if (!(numCells <= (float)MaxTriangleCells))
+			{
+				if (pass == 0)
+					mOverflowTriangles.push_back((uint32_t)t);
+				continue;
+			}
+
+			if (pass == 0)
+			{
+				for (int a = 0; a < 3; ++a)
+				{
+					gridMin[a] = std::min(gridMin[a], mins[a]);
+					gridMax[a] = std::max(gridMax[a], maxs[a]);
+				}
+			}
+
+			for (int z = (int)lo[2]; z <= (int)hi[2]; ++z)
+			{
+				for (int y = (int)lo[1]; y <= (int)hi[1]; ++y)
+				{
+					for (int x = (int)lo[0]; x <= (int)hi[0]; ++x)
+					{
+						const size_t bucket = BucketOf(x, y, z);
+						if (pass == 0)
+							++mCellStart[bucket + 1];
+						else
+							mCellTriangles[fill[bucket]++] = (uint32_t)t;
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
+
+size_t MeshHeatmap::BucketOf(int x, int y, int z) const
+{
+	return (size_t)(((uint32_t)x * 73856093u) ^ ((uint32_t)y * 19349663u) ^ ((uint32_t)z * 83492791u)) & (mCellStart.size() - 2);
+}
+
+float MeshHeatmap::DistanceSq(const float pos[3], uint32_t triangle) const
+{
+	// the closest point on the triangle by its voronoi regions, from Real-Time Collision Detection
+	const float* a = &mPositions[mTriangles[triangle * 3] * 3];
+	const float* b = &mPositions[mTriangles[triangle * 3 + 1] * 3];
+	const float* c = &mPositions[mTriangles[triangle * 3 + 2] * 3];
+
+	const float ab[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+	const float ac[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+	const float ap[3] = { pos[0] - a[0], pos[1] - a[1], pos[2] - a[2] };
+
+	float closest[3];
+	const float d1 = Dot(ab, ap);
+	const float d2 = Dot(ac, ap);
+	if (d1 <= 0.0f && d2 <= 0.0f)
+	{
+		memcpy(closest, a, sizeof(closest));
+	}
+	else
+	{
+		const float bp[3] = { pos[0] - b[0], pos[1] - b[1], pos[2] - b[2] };
+		const float d3 = Dot(ab, bp);
+		const float d4 = Dot(ac, bp);
+		const float cp[3] = { pos[0] - c[0], pos[1] - c[1], pos[2] - c[2] };
+		const float d5 = Dot(ab, cp);
+		const float d6 = Dot(ac, cp);
+
+		const float vc = d1 * d4 - d3 * d2;
+		const float vb = d5 * d2 - d1 * d6;
+		const float va = d3 * d6 - d5 * d4;
+
+		if (d3 >= 0.0f && d4 <= d3)
+		{
+			memcpy(closest, b, sizeof(closest));
+		}
+		else if (d6 >= 0.0f && d5 <= d6)
+		{
+			memcpy(closest, c, sizeof(closest));
+		}
+		else if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+		{
+			const float v = d1 / (d1 - d3);
+			for (int i = 0; i < 3; ++i)
+				closest[i] = a[i] + ab[i] * v;
+		}
+		else if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+		{
+			const float w = d2 / (d2 - d6);
+			for (int i = 0; i < 3; ++i)
+				closest[i] = a[i] + ac[i] * w;
+		}
+		else if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+		{
+			const float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+			for (int i = 0; i < 3; ++i)
+				closest[i] = b[i] + (c[i] - b[i]) * w;
+		}
+		else
+		{
+			const float denom = va + vb + vc;
+			const float v = denom != 0.0f ? vb / denom : 0.0f;
+			const float w = denom != 0.0f ? vc / denom : 0.0f;
+			for (int i = 0; i < 3; ++i)
+				closest[i] = a[i] + ab[i] * v + ac[i] * w;
+		}
+	}
+
+	const float d[3] = { pos[0] - closest[0], pos[1] - closest[1], pos[2] - closest[2] };
+	return Dot(d, d);
+}
+
+int MeshHeatmap::FindNearestTriangle(const float pos[3], float& distance) const
+{
+	if (mCellTriangles.empty() && mOverflowTriangles.empty())
+		return -1;
+
+	int cell[3], lo[3], hi[3];
+	int firstRing = 0, lastRing = 0;
+	for (int a = 0; a < 3; ++a)
+	{
+		cell[a] = (int)floorf(pos[a] / mCellSize);
+		lo[a] = (int)floorf(mBoundsMin[a] / mCellSize);
+		hi[a] = (int)floorf(mBoundsMax[a] / mCellSize);
+
+		// rings that don't reach the mesh are skipped
+		firstRing = std::max(firstRing, std::max(lo[a] - cell[a], cell[a] - hi[a]));
+		lastRing = std::max(lastRing, std::max(cell[a] - lo[a], hi[a] - cell[a]));
+	}
+
+	float best = mMaxDistance > 0.0f ? mMaxDistance * mMaxDistance : FLT_MAX;
+	if (mMaxDistance > 0.0f)
+		lastRing = std::min(lastRing, (int)ceilf(mMaxDistance / mCellSize) + 1);
+
+	int bestTriangle = -1;
+	for (size_t i = 0; i < mOverflowTriangles.size(); ++i)
+	{
+		const float d = DistanceSq(pos, mOverflowTriangles[i]);
+		if (d < best)
+		{
+			best = d;
+			bestTriangle = (int)mOverflowTriangles[i];
+		}
+	}
+
+	for (int r = firstRing; r <= lastRing && !mCellTriangles.empty(); ++r)
+	{
+		// the shell of cells r away, clipped to the mesh bounds
+		const int z0 = std::max(cell[2] - r, lo[2]), z1 = std::min(cell[2] + r, hi[2]);
+		const int y0 = std::max(cell[1] - r, lo[1]), y1 = std::min(cell[1] + r, hi[1]);
+		const int x0 = std::max(cell[0] - r, lo[0]), x1 = std::min(cell[0] + r, hi[0]);
+
+		for (int z = z0; z <= z1; ++z)
+		{
+			for (int y = y0; y <= y1; ++y)
+			{
+				const bool face = std::abs(z - cell[2]) == r || std::abs(y - cell[1]) == r;
+				for (int x = x0; x <= x1; x = (face || x >= cell[0] + r) ? x + 1 : std::max(x + 1, cell[0] + r))
+				{
+					if (!face && std::abs(x - cell[0]) != r)
+						continue;
+
+					// cells further away than the best triangle so far can't hold a closer one
+					const int c[3] = { x, y, z };
+					float cellDistance = 0.0f;
+					for (int a = 0; a < 3; ++a)
+					{
+						const float d = std::max(0.0f, std::max(c[a] * mCellSize - pos[a], pos[a] - (c[a] + 1) * mCellSize));
+						cellDistance += d * d;
+					}
+					if (cellDistance >= best)
+						continue;
+
+					const size_t bucket = BucketOf(x, y, z);
+					for (uint32_t i = mCellStart[bucket]; i < mCellStart[bucket + 1]; ++i)
+					{
+						const float d = DistanceSq(pos, mCellTriangles[i]);
+						if (d < best)
+						{
+							best = d;
+							bestTriangle = (int)mCellTriangles[i];
+						}
+					}
+				}
+			}
+		}
+
+		// anything in the next ring is outside the cube of cells searched so far
+		float ringDistance = FLT_MAX;
+		for (int a = 0; a < 3; ++a)
+			ringDistance = std::min(ringDistance, std::min(pos[a] - (cell[a] - r) * mCellSize, (cell[a] + r + 1) * mCellSize - pos[a]));
+		if (bestTriangle >= 0 && best <= ringDistance * ringDistance)
+			break;
+	}
+
+	distance = bestTriangle >= 0 ? sqrtf(best) : 0.0f;
+	return bestTriangle;
+}
+
+void MeshHeatmap::Clear()
+{
+	mPending.clear();
+	std::fill(mTriangleWeights.begin(), mTriangleWeights.end(), 0.0f);
+}
+
+void MeshHeatmap::AddPoint(const float pos[3], float weight)
+{
+	Point pt;
+	memcpy(pt.mPos, pos, sizeof(pt.mPos));
+	pt.mWeight = weight;
+	mPending.push_back(pt);
+}
+
+bool MeshHeatmap::AddEvent(const google::protobuf::Message& msg, const PointEventAccessor& accessor)
+{
+	float pos[3], radius, weight;
+	if (!accessor.Read(msg, pos, radius, weight))
+		return false;
+
+	AddPoint(pos, weight);
+	return true;
+}
+
+void MeshHeatmap::Build()
+{
+	// the searches in parallel, the sums in point order so they don't depend on the thread count
+	std::vector<int> nearest(mPending.size(), -1);
+	HeatmapParallelFor((int)mPending.size(), mNumThreads, [this, &nearest](int begin, int end)
+	{
+		float distance = 0.0f;
+		for (int i = begin; i < end; ++i)
+			nearest[i] = FindNearestTriangle(mPending[i].mPos, distance);
+	});
+
+	for (size_t i = 0; i < mPending.size(); ++i)
+	{
+		if (nearest[i] >= 0)
+			mTriangleWeights[nearest[i]] += mPending[i].mWeight;
+	}
+	mPending.clear();
+}
+
+void MeshHeatmap::GetVertexWeights(std::vector<float>& weights) const
+{
+	const size_t numPositions = mPositions.size() / 3;
+	std::vector<float> weightSum(numPositions, 0.0f), areaSum(numPositions, 0.0f);
+	for (size_t t = 0; t < mTriangleWeights.size(); ++t)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			weightSum[mTriangles[t * 3 + i]] += mTriangleWeights[t];
+			areaSum[mTriangles[t * 3 + i]] += mAreas[t];
+		}
+	}
+
+	weights.resize(mMeshVertices.size());
+	for (size_t v = 0; v < mMeshVertices.size(); ++v)
+	{
+		const uint32_t p = mMeshVertices[v];
+		weights[v] = areaSum[p] > 0.0f ? weightSum[p] / areaSum[p] : 0.0f;
+	}
+}
+
+void MeshHeatmap::GetVertexColors(std::string& bytes) const
+{
+	std::vector<float> weights;
+	GetVertexWeights(weights);
+
+	float maxWeight = 0.0f;
+	for (size_t i = 0; i < weights.size(); ++i)
+		maxWeight = std::max(maxWeight, weights[i]);
+	const float scale = maxWeight > 0.0f ? 1.0f / maxWeight : 0.0f;
+
+	bytes.resize(weights.size() * sizeof(uint32_t));
+	for (size_t i = 0; i < weights.size(); ++i)
+	{
+		const uint32_t color = PackColor(weights[i] * scale);
+		memcpy(&bytes[i * sizeof(uint32_t)], &color, sizeof(color));
+	}
+}
+
+void MeshHeatmap::ColorMesh(const Analytics::Mesh& mesh, Analytics::Mesh& colored) const
+{
+	std::string bytes;
+	GetVertexColors(bytes);
+
+	colored.CopyFrom(mesh);
+
+	size_t index = 0;
+	for (int p = 0; p < colored.primitives_size(); ++p)
+	{
+		Analytics::Primitive* prim = colored.mutable_primitives(p);
+		for (int v = 0; v < prim->vertices_size() && index < mMeshVertices.size(); ++v, ++index)
+		{
+			uint32_t color = 0;
+			memcpy(&color, &bytes[index * sizeof(uint32_t)], sizeof(color));
+			prim->mutable_vertices(v)->set_color(color);
+		}
+	}
+}
@@ -0,0 +1,89 @@
+#ifndef GAMEANALYTICS_MESHHEATMAP_H
+#define GAMEANALYTICS_MESHHEATMAP_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include "analytics.pb.h"
+#include "GameAnalytics_heatmap.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// Heat painted onto the triangles of a Mesh uploaded with SendMesh. The triangles go into a spatial hash
+// once per model, events are assigned to their nearest triangle in parallel and the result comes out per
+// triangle or per vertex, as weights or as packed colours in the vertex order of the mesh. Weights are
+// divided by triangle area, so a large floor triangle doesn't outshine the small ones around it.
+class MeshHeatmap
+{
+public:
+	enum { MaxTriangleCells = 512 };
+
+	MeshHeatmap();
+
+	// Triangles and Quad primitives, lines and points only get a colour. false when the mesh has no triangles
+	bool Init(const Analytics::Mesh& mesh);
+
+	size_t GetNumTriangles() const { return mTriangles.size() / 3; }
+	// every vertex of the mesh, in primitive order
+	size_t GetNumVertices() const { return mMeshVertices.size(); }
+
+	// 0 uses every hardware thread
+	void SetThreadCount(int numThreads) { mNumThreads = numThreads; }
+	// events further than this from every triangle are dropped, 0 keeps them all
+	void SetMaxDistance(float maxDistance) { mMaxDistance = maxDistance; }
+
+	// drops the weights and keeps the triangles and the hash
+	void Clear();
+	void AddPoint(const float pos[3], float weight = 1.0f);
+	// false for events without a position
+	bool AddEvent(const google::protobuf::Message& msg, const PointEventAccessor& accessor);
+
+	// assigns the points added since the last call to their nearest triangle, in parallel
+	void Build();
+
+	// -1 when no triangle is within the max distance
+	int FindNearestTriangle(const float pos[3], float& distance) const;
+
+	// the summed event weight of each triangle
+	const std::vector<float>& GetTriangleWeights() const { return mTriangleWeights; }
+	// per vertex of the mesh, the weight per area of the triangles sharing its position
+	void GetVertexWeights(std::vector<float>& weights) const;
+	// a QRgb, 0xAARRGGBB, per vertex of the mesh, normalized to the hottest vertex. the layout the viewer reads vertex colours in
+	void GetVertexColors(std::string& bytes) const;
+	// a copy of the mesh with the heat in the colour of its vertices
+	void ColorMesh(const Analytics::Mesh& mesh, Analytics::Mesh& colored) const;
+private:
+	struct Point
+	{
+		float	mPos[3];
+		float	mWeight;
+	};
+
+	// welded positions, triangles index into them
+	std::vector<float>		mPositions;
+	std::vector<uint32_t>	mTriangles;
+	std::vector<float>		mAreas;
+	// the welded position of each vertex of the mesh
+	std::vector<uint32_t>	mMeshVertices;
+
+	// cells hashed into buckets, the triangles of bucket i are mCellTriangles[mCellStart[i], mCellStart[i + 1])
+	float					mCellSize;
+	float					mBoundsMin[3];
+	float					mBoundsMax[3];
+	std::vector<uint32_t>	mCellStart;
+	std::vector<uint32_t>	mCellTriangles;
+	// triangles spanning more cells than MaxTriangleCells, tested by every search instead of hashed
+	std::vector<uint32_t>	mOverflowTriangles;
+
+	int						mNumThreads;
+	float					mMaxDistance;
+
+	std::vector<Point>		mPending;
+	std::vector<float>		mTriangleWeights;
+
+	size_t BucketOf(int x, int y, int z) const;
+	float DistanceSq(const float pos[3], uint32_t triangle) const;
+};
+
+#endif
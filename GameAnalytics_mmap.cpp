@@ -0,0 +1,135 @@
+#include "GameAnalytics_mmap.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
+#ifdef _WIN32
+
+MappedFile::MappedFile()
+	: mData(NULL)
+	, mSize(0)
+	, mFile(INVALID_HANDLE_VALUE)
+	, mMapping(NULL)
+{
+}
+
+bool MappedFile::Open(const std::string& filename, std::string& error)
+{
+	Close();
+
+	mFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (mFile == INVALID_HANDLE_VALUE)
+	{
+		error = "failed to open " + filename;
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(mFile, &size) || size.QuadPart == 0)
+	{
+		error = "failed to map empty file " + filename;
+		Close();
+		return false;
+	}
+
+	mMapping = CreateFileMappingA(mFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mMapping != NULL)
+		mData = (const uint8_t*)MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+
+	if (mData == NULL)
+	{
+		error = "failed to map " + filename;
+		Close();
+		return false;
+	}
+
+	mSize = (uint64_t)size.QuadPart;
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (mData != NULL)
+		UnmapViewOfFile(mData);
+	if (mMapping != NULL)
+		CloseHandle(mMapping);
+	if (mFile != INVALID_HANDLE_VALUE)
+		CloseHandle(mFile);
+
+	mData = NULL;
+	mSize = 0;
+	mMapping = NULL;
+	mFile = INVALID_HANDLE_VALUE;
+}
+
+#else
+
+MappedFile::MappedFile()
+	: mData(NULL)
+	, mSize(0)
+	, mFile(-1)
+{
+}
+
+bool MappedFile::Open(const std::string& filename, std::string& error)
+{
+	Close();
+
+	mFile = open(filename.c_str(), O_RDONLY);
+	if (mFile < 0)
+	{
+		error = "failed to open " + filename + ": " + strerror(errno);
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(mFile, &info) != 0 || info.st_size == 0)
+	{
+		error = "failed to map empty file " + filename;
+		Close();
+		return false;
+	}
+
+	void* data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, mFile, 0);
+	if (data == MAP_FAILED)
+	{
+		error = "failed to map " + filename + ": " + strerror(errno);
+		Close();
+		return false;
+	}
+
+	mData = (const uint8_t*)data;
+	mSize = (uint64_t)info.st_size;
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (mData != NULL)
+		munmap((void*)mData, (size_t)mSize);
+	if (mFile >= 0)
+		close(mFile);
+
+	mData = NULL;
+	mSize = 0;
+	mFile = -1;
+}
+
+#endif
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
@@ -0,0 +1,37 @@
+#ifndef GAMEANALYTICS_MMAP_H
+#define GAMEANALYTICS_MMAP_H
+
+#include <string>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////
+
+// A whole file mapped read only, so readers of the archive formats only fault in the pages they touch
+class MappedFile
+{
+public:
+	MappedFile();
+	~MappedFile();
+
+	bool Open(const std::string& filename, std::string& error);
+	void Close();
+
+	bool IsOpen() const { return mData != NULL; }
+	const uint8_t* GetData() const { return mData; }
+	uint64_t GetSize() const { return mSize; }
+private:
+	const uint8_t*	mData;
+	uint64_t		mSize;
+
+#ifdef _WIN32
+	void*			mFile;
+	void*			mMapping;
+#else
+	int				mFile;
+#endif
+
+	MappedFile(const MappedFile& other);
+	MappedFile& operator=(const MappedFile& other);
+};
+
+#endif
@@ -0,0 +1,282 @@
+#include "GameAnalytics_quantize.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define QUANTIZE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+static inline int ClampBits(int bits)
+{
+	if (bits < 1)
+		return 1;
+	if (bits > Vec3Quantizer::MaxBitsPerAxis)
+		return Vec3Quantizer::MaxBitsPerAxis;
+	return bits;
+}
+
+static inline uint32_t QuantizeAxis(float v, float mins, float factor, float maxQ)
+{
+	float t = (v - mins) * factor + 0.5f;
+	if (t < 0.0f)
+		t = 0.0f;
+	if (t > maxQ)
+		t = maxQ;
+	return (uint32_t)t;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+Vec3Quantizer::Vec3Quantizer()
+	: mHasBounds(false)
+{
+	ClearBounds();
+}
+
+void Vec3Quantizer::SetBounds(const Analytics::Vec3& mins, const Analytics::Vec3& maxs)
+{
+	mMins[0] = mins.x();
+	mMins[1] = mins.y();
+	mMins[2] = mins.z();
+	mExtents[0] = maxs.x() - mins.x();
+	mExtents[1] = maxs.y() - mins.y();
+	mExtents[2] = maxs.z() - mins.z();
+
+	// degenerate bounds can't be used as a reference frame
+	mHasBounds = mExtents[0] > 0.0f && mExtents[1] > 0.0f && mExtents[2] > 0.0f;
+}
+
+void Vec3Quantizer::ClearBounds()
+{
+	for (int i = 0; i < 3; ++i)
+	{
+		mMins[i] = 0.0f;
+		mExtents[i] = 1.0f;
+	}
+	mHasBounds = false;
+}
+
+uint64_t Vec3Quantizer::Quantize(float x, float y, float z, int bits) const
+{
+	bits = ClampBits(bits);
+
+	const float maxQ = (float)((1u << bits) - 1);
+	const uint64_t qx = QuantizeAxis(x, mMins[0], maxQ / mExtents[0], maxQ);
+	const uint64_t qy = QuantizeAxis(y, mMins[1], maxQ / mExtents[1], maxQ);
+	const uint64_t qz = QuantizeAxis(z, mMins[2], maxQ / mExtents[2], maxQ);
+	return qx | (qy << bits) | (qz << (bits * 2));
+}
+
+void Vec3Quantizer::Dequantize(uint64_t packed, int bits, float& x, float& y, float& z) const
+{
+	bits = ClampBits(bits);
+
+	const uint64_t mask = (1ull << bits) - 1;
+	const float maxQ = (float)mask;
+	x = mMins[0] + (float)(uint32_t)(packed & mask) * (mExtents[0] / maxQ);
+	y = mMins[1] + (float)(uint32_t)((packed >> bits) & mask) * (mExtents[1] / maxQ);
+	z = mMins[2] + (float)(uint32_t)((packed >> (bits * 2)) & mask) * (mExtents[2] / maxQ);
+}
+
+void Vec3Quantizer::QuantizeArray(const float* xyz, size_t count, int bits, uint64_t* packedOut) const
+{
+	bits = ClampBits(bits);
+
+	size_t i = 0;
+#if(QUANTIZE_SSE2)
+	const float maxQ = (float)((1u << bits) - 1);
+	const __m128 minX = _mm_set1_ps(mMins[0]);
+	const __m128 minY = _mm_set1_ps(mMins[1]);
+	const __m128 minZ = _mm_set1_ps(mMins[2]);
+	const __m128 factorX = _mm_set1_ps(maxQ / mExtents[0]);
+	const __m128 factorY = _mm_set1_ps(maxQ / mExtents[1]);
+	const __m128 factorZ = _mm_set1_ps(maxQ / mExtents[2]);
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 upper = _mm_set1_ps(maxQ);
+	const __m128i shiftY = _mm_cvtsi32_si128(bits);
+	const __m128i shiftZ = _mm_cvtsi32_si128(bits * 2);
+	const __m128i zeroi = _mm_setzero_si128();
+
+	// 4 points per iteration, de-interleave the xyz triplets into one register per axis
+	for (; i + 4 <= count; i += 4)
+	{
+		const float* src = xyz + i * 3;
+		const __m128 a = _mm_loadu_ps(src);		// x0 y0 z0 x1
+		const __m128 b = _mm_loadu_ps(src + 4);	// y1 z1 x2 y2
+		const __m128 c = _mm_loadu_ps(src + 8);	// z2 x3 y3 z3
+
+		const __m128 bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+		const __m128 x = _mm_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0));
+		const __m128 ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+		const __m128 bc2 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+		const __m128 y = _mm_shuffle_ps(ab, bc2, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 ab2 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+		const __m128 cc = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+		const __m128 z = _mm_shuffle_ps(ab2, cc, _MM_SHUFFLE(2, 0, 2, 0));
+
+		const __m128 tx = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(x, minX), factorX), half), zero), upper);
+		const __m128 ty = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(y, minY), factorY), half), zero), upper);
+		const __m128 tz = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(z, minZ), factorZ), half), zero), upper);
+
+		const __m128i qx = _mm_cvttps_epi32(tx);
+		const __m128i qy = _mm_cvttps_epi32(ty);
+		const __m128i qz = _mm_cvttps_epi32(tz);
+
+		// widen to 64 bit lanes and pack the axes together
+		const __m128i lo = _mm_or_si128(_mm_unpacklo_epi32(qx, zeroi),
+			_mm_or_si128(_mm_sll_epi64(_mm_unpacklo_epi32(qy, zeroi), shiftY),
+				_mm_sll_epi64(_mm_unpacklo_epi32(qz, zeroi), shiftZ)));
+		const __m128i hi = _mm_or_si128(_mm_unpackhi_epi32(qx, zeroi),
+			_mm_or_si128(_mm_sll_epi64(_mm_unpackhi_epi32(qy, zeroi), shiftY),
+				_mm_sll_epi64(_mm_unpackhi_epi32(qz, zeroi), shiftZ)));
+
+		_mm_storeu_si128((__m128i*)(packedOut + i), lo);
+		_mm_storeu_si128((__m128i*)(packedOut + i + 2), hi);
+	}
+#endif
+
+	for (; i < count; ++i)
+		packedOut[i] = Quantize(xyz[i * 3 + 0], xyz[i * 3 + 1], xyz[i * 3 + 2], bits);
+}
+
+void Vec3Quantizer::DequantizeArray(const uint64_t* packed, size_t count, int bits, float* xyzOut) const
+{
+	bits = ClampBits(bits);
+
+	size_t i = 0;
+#if(QUANTIZE_SSE2)
+	const uint64_t mask = (1ull << bits) - 1;
+	const float maxQ = (float)mask;
+	const __m128 minX = _mm_set1_ps(mMins[0]);
+	const __m128 minY = _mm_set1_ps(mMins[1]);
+	const __m128 minZ = _mm_set1_ps(mMins[2]);
+	const __m128 factorX = _mm_set1_ps(mExtents[0] / maxQ);
+	const __m128 factorY = _mm_set1_ps(mExtents[1] / maxQ);
+	const __m128 factorZ = _mm_set1_ps(mExtents[2] / maxQ);
+	const __m128i mask64 = _mm_set_epi32(0, (int)mask, 0, (int)mask);
+	const __m128i shiftY = _mm_cvtsi32_si128(bits);
+	const __m128i shiftZ = _mm_cvtsi32_si128(bits * 2);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m128i p01 = _mm_loadu_si128((const __m128i*)(packed + i));
+		const __m128i p23 = _mm_loadu_si128((const __m128i*)(packed + i + 2));
+
+		// each axis fits in the low 32 bits of its 64 bit lane, gather those into 4 lanes
+		const __m128i x01 = _mm_and_si128(p01, mask64);
+		const __m128i x23 = _mm_and_si128(p23, mask64);
+		const __m128i y01 = _mm_and_si128(_mm_srl_epi64(p01, shiftY), mask64);
+		const __m128i y23 = _mm_and_si128(_mm_srl_epi64(p23, shiftY), mask64);
+		const __m128i z01 = _mm_and_si128(_mm_srl_epi64(p01, shiftZ), mask64);
+		const __m128i z23 = _mm_and_si128(_mm_srl_epi64(p23, shiftZ), mask64);
+
+		const __m128i qx = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(x01), _mm_castsi128_ps(x23), _MM_SHUFFLE(2, 0, 2, 0)));
+		const __m128i qy = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(y01), _mm_castsi128_ps(y23), _MM_SHUFFLE(2, 0, 2, 0)));
+		const __m128i qz = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(z01), _mm_castsi128_ps(z23), _MM_SHUFFLE(2, 0, 2, 0)));
+
+		const __m128 x = _mm_add_ps(minX, _mm_mul_ps(_mm_cvtepi32_ps(qx), factorX));
+		const __m128 y = _mm_add_ps(minY, _mm_mul_ps(_mm_cvtepi32_ps(qy), factorY));
+		const __m128 z = _mm_add_ps(minZ, _mm_mul_ps(_mm_cvtepi32_ps(qz), factorZ));
+
+		// re-interleave into xyz triplets
+		const __m128 xyLo = _mm_unpacklo_ps(x, y);	// x0 y0 x1 y1
+		const __m128 xyHi = _mm_unpackhi_ps(x, y);	// x2 y2 x3 y3
+		const __m128 zx = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+		const __m128 a = _mm_shuffle_ps(xyLo, zx, _MM_SHUFFLE(2, 0, 1, 0));
+		const __m128 yz = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 b = _mm_shuffle_ps(yz, xyHi, _MM_SHUFFLE(1, 0, 2, 0));
+		const __m128 zxy = _mm_shuffle_ps(z, xyHi, _MM_SHUFFLE(2, 2, 2, 2));
+		const __m128 yzz = _mm_shuffle_ps(xyHi, z, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 c = _mm_shuffle_ps(zxy, yzz, _MM_SHUFFLE(2, 0, 2, 0));
+
+		float* dst = xyzOut + i * 3;
+		_mm_storeu_ps(dst, a);
+		_mm_storeu_ps(dst + 4, b);
+		_mm_storeu_ps(dst + 8, c);
+	}
+#endif
+
+	for (; i < count; ++i)
+		Dequantize(packed[i], bits, xyzOut[i * 3 + 0], xyzOut[i * 3 + 1], xyzOut[i * 3 + 2]);
+}
+
+const Vec3Quantizer::FieldList& Vec3Quantizer::GetQuantizedFields(const google::protobuf::Descriptor* desc) const
+{
+	FieldCache::iterator it = mFieldCache.find(desc);
+	if (it != mFieldCache.end())
+		return it->second;
+
+	FieldList& fields = mFieldCache[desc];
+	for (int i = 0; i < desc->field_count(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* fdesc = desc->field(i);
+		if (fdesc->is_repeated() || fdesc->message_type() != Analytics::Vec3::descriptor())
+			continue;
+
+		if (fdesc->options().GetExtension(Analytics::quantize) > 0)
+			fields.push_back(fdesc);
+	}
+	return fields;
+}
+
+bool Vec3Quantizer::HasQuantizedFields(const google::protobuf::Descriptor* desc) const
+{
+	return !GetQuantizedFields(desc).empty();
+}
+
+bool Vec3Quantizer::QuantizeMessage(google::protobuf::Message& msg) const
+{
+	if (!mHasBounds)
+		return false;
+
+	const FieldList& fields = GetQuantizedFields(msg.GetDescriptor());
+
+	bool modified = false;
+	for (size_t i = 0; i < fields.size(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* fdesc = fields[i];
+		if (!msg.GetReflection()->HasField(msg, fdesc))
+			continue;
+
+		Analytics::Vec3* vec = static_cast<Analytics::Vec3*>(msg.GetReflection()->MutableMessage(&msg, fdesc));
+		const uint64_t packed = Quantize(vec->x(), vec->y(), vec->z(), fdesc->options().GetExtension(Analytics::quantize));
+		// offset by one so a packed value of zero still reads as quantized
+		vec->Clear();
+		vec->set_quantized(packed + 1);
+		modified = true;
+	}
+	return modified;
+}
+
+bool Vec3Quantizer::DequantizeMessage(google::protobuf::Message& msg) const
+{
+	if (!mHasBounds)
+		return false;
+
+	const FieldList& fields = GetQuantizedFields(msg.GetDescriptor());
+
+	bool modified = false;
+	for (size_t i = 0; i < fields.size(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* fdesc = fields[i];
+		if (!msg.GetReflection()->HasField(msg, fdesc))
+			continue;
+
+		Analytics::Vec3* vec = static_cast<Analytics::Vec3*>(msg.GetReflection()->MutableMessage(&msg, fdesc));
+		if (vec->quantized() == 0)
+			continue;
+
+		float x, y, z;
+		Dequantize(vec->quantized() - 1, fdesc->options().GetExtension(Analytics::quantize), x, y, z);
+		vec->set_x(x);
+		vec->set_y(y);
+		vec->set_z(z);
+		vec->clear_quantized();
+		modified = true;
+	}
+	return modified;
+}
@@ -0,0 +1,49 @@
+#ifndef GAMEANALYTICS_QUANTIZE_H
+#define GAMEANALYTICS_QUANTIZE_H
+
+#include <map>
+#include <vector>
+#include <cstdint>
+
+#include "analytics.pb.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// Packs Vec3 positions into a single fixed point integer relative to the map bounds
+// from GameInfo. Fields opt in with the (quantize) field option, which gives the bits per axis.
+class Vec3Quantizer
+{
+public:
+	enum { MaxBitsPerAxis = 21 };
+
+	Vec3Quantizer();
+
+	void SetBounds(const Analytics::Vec3& mins, const Analytics::Vec3& maxs);
+	void ClearBounds();
+	bool HasBounds() const { return mHasBounds; }
+
+	uint64_t Quantize(float x, float y, float z, int bits) const;
+	void Dequantize(uint64_t packed, int bits, float& x, float& y, float& z) const;
+
+	// batch versions over interleaved xyz, these use SSE2 when available
+	void QuantizeArray(const float* xyz, size_t count, int bits, uint64_t* packedOut) const;
+	void DequantizeArray(const uint64_t* packed, size_t count, int bits, float* xyzOut) const;
+
+	// convert all (quantize) tagged fields of a message in place
+	bool QuantizeMessage(google::protobuf::Message& msg) const;
+	bool DequantizeMessage(google::protobuf::Message& msg) const;
+
+	bool HasQuantizedFields(const google::protobuf::Descriptor* desc) const;
+private:
+	float		mMins[3];
+	float		mExtents[3];
+	bool		mHasBounds;
+
+	typedef std::vector<const google::protobuf::FieldDescriptor*> FieldList;
+	typedef std::map<const google::protobuf::Descriptor*, FieldList> FieldCache;
+	mutable FieldCache	mFieldCache;
+
+	const FieldList& GetQuantizedFields(const google::protobuf::Descriptor* desc) const;
+};
+
+#endif
@@ -0,0 +1,1092 @@
+#include "GameAnalytics_query.h"
+#include "GameAnalytics_workpool.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <unordered_map>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define QUERY_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+void EnumNameTable::Add(const Analytics::GameEnum& msg)
+{
+	for (int i = 0; i < msg.values_size(); ++i)
+		Add(msg.enumname(), msg.values(i).value(), msg.values(i).name());
+}
+
+void EnumNameTable::Add(const std::string& enumKey, int64_t value, const std::string& name)
+{
+	Enum& e = mEnums[enumKey];
+	e.mNames[value] = name;
+	e.mValues[name] = value;
+}
+
+bool EnumNameTable::FindName(const std::string& enumKey, int64_t value, std::string& name) const
+{
+	std::map<std::string, Enum>::const_iterator e = mEnums.find(enumKey);
+	if (e == mEnums.end())
+		return false;
+
+	std::map<int64_t, std::string>::const_iterator it = e->second.mNames.find(value);
+	if (it == e->second.mNames.end())
+		return false;
+
+	name = it->second;
+	return true;
+}
+
+bool EnumNameTable::FindValue(const std::string& enumKey, const std::string& name, int64_t& value) const
+{
+	std::map<std::string, Enum>::const_iterator e = mEnums.find(enumKey);
+	if (e == mEnums.end())
+		return false;
+
+	std::map<std::string, int64_t>::const_iterator it = e->second.mValues.find(name);
+	if (it == e->second.mValues.end())
+		return false;
+
+	value = it->second;
+	return true;
+}
+
+bool EnumNameTable::Load(const std::string& filename, std::string& error)
+{
+	std::ifstream file(filename.c_str());
+	if (!file)
+	{
+		error = "failed to open " + filename;
+		return false;
+	}
+
+	std::string line;
+	while (std::getline(file, line))
+	{
+		std::istringstream str(line);
+		std::string enumKey, name;
+		long long value = 0;
+		if (str >> enumKey >> value >> name)
+			Add(enumKey, value, name);
+	}
+	return true;
+}
+
+bool EnumNameTable::Save(const std::string& filename, std::string& error) const
+{
+	FILE* fp = fopen(filename.c_str(), "w");
+	if (fp == NULL)
+	{
+		error = "failed to open " + filename + " for writing";
+		return false;
+	}
+
+	for (std::map<std::string, Enum>::const_iterator e = mEnums.begin(); e != mEnums.end(); ++e)
+	{
+		for (std::map<int64_t, std::string>::const_iterator it = e->second.mNames.begin(); it != e->second.mNames.end(); ++it)
+			fprintf(fp, "%s %lld %s\n", e->first.c_str(), (long long)it->first, it->second.c_str());
+	}
+
+	if (fclose(fp) != 0)
+	{
+		error = "failed to write " + filename;
+		return false;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ColumnFilter::ColumnFilter()
+	: mMin(-HUGE_VAL)
+	, mMax(HUGE_VAL)
+	, mExclude(false)
+{
+}
+
+ColumnQuery::ColumnQuery()
+	: mStartTime(LLONG_MIN)
+	, mEndTime(LLONG_MAX)
+{
+}
+
+void ColumnQuery::Where(const std::string& column, double value, bool exclude)
+{
+	WhereRange(column, value, value, exclude);
+}
+
+void ColumnQuery::WhereRange(const std::string& column, double minValue, double maxValue, bool exclude)
+{
+	ColumnFilter filter;
+	filter.mColumn = column;
+	filter.mMin = minValue;
+	filter.mMax = maxValue;
+	filter.mExclude = exclude;
+	mFilters.push_back(filter);
+}
+
+void ColumnQuery::WhereValue(const std::string& column, const std::string& value, bool exclude)
+{
+	ColumnFilter filter;
+	filter.mColumn = column;
+	filter.mValues.push_back(value);
+	filter.mExclude = exclude;
+	mFilters.push_back(filter);
+}
+
+void ColumnQuery::WhereAny(const std::string& column, const std::vector<std::string>& values, bool exclude)
+{
+	ColumnFilter filter;
+	filter.mColumn = column;
+	filter.mValues = values;
+	filter.mExclude = exclude;
+	mFilters.push_back(filter);
+}
+
+void ColumnQuery::GroupBy(const std::string& column)
+{
+	mGroupBy.push_back(column);
+}
+
+void ColumnQuery::Measure(ColumnAggregate aggregate, const std::string& column)
+{
+	ColumnMeasure measure;
+	measure.mAggregate = aggregate;
+	measure.mColumn = column;
+	mMeasures.push_back(measure);
+}
+
+ColumnQueryResult::ColumnQueryResult()
+	: mRowsScanned(0)
+	, mRowsMatched(0)
+	, mBlocksScanned(0)
+	, mBlocksSkipped(0)
+	, mBlocksIndexed(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// the values of the group columns of a row, with the file for columns whose values are file specific, like string codes
+struct GroupKey
+{
+	uint32_t	mFile;
+	int64_t		mParts[ColumnQueryEngine::MaxGroupBy];
+
+	bool operator==(const GroupKey& other) const
+	{
+		return mFile == other.mFile && memcmp(mParts, other.mParts, sizeof(mParts)) == 0;
+	}
+};
+
+struct GroupKeyHash
+{
+	size_t operator()(const GroupKey& key) const
+	{
+		uint64_t hash = 1469598103934665603ull ^ key.mFile;
+		for (int i = 0; i < ColumnQueryEngine::MaxGroupBy; ++i)
+			hash = (hash ^ (uint64_t)key.mParts[i]) * 1099511628211ull;
+		return (size_t)(hash ^ (hash >> 29));
+	}
+};
+
+struct ColumnQueryEngine::FilePlan
+{
+	struct Filter
+	{
+		size_t		mColumn;
+		ColumnType	mType;
+		double		mMin;
+		double		mMax;
+		bool		mExclude;
+		// the sorted values of a value filter, matching any of them, mMin and mMax bound them
+		std::vector<double>	mValues;
+		// the values are looked up in the bitmap index instead of the column
+		bool		mIndexed;
+	};
+
+	const ColumnarReader*	mFile;
+	const ColumnIndexReader* mIndex;
+	// a filter value the file doesn't have, nothing can match
+	bool					mEmpty;
+	bool					mKeyByFile;
+	std::vector<Filter>		mFilters;
+	std::vector<size_t>		mGroupColumns;
+	// -1 for counts
+	std::vector<int>		mMeasureColumns;
+};
+
+struct ColumnQueryEngine::WorkerState
+{
+	std::vector<size_t>		mPending;
+	std::vector<uint8_t>	mMask;
+	std::vector<uint8_t>	mAnyMask;
+	RoaringBitmap			mRows;
+	RoaringBitmap			mAny;
+	RoaringBitmap			mValueRows;
+	std::vector<uint32_t>	mSelection;
+	std::vector<int64_t>	mKeyParts;
+	std::vector<uint32_t>	mGroups;
+
+	std::unordered_map<GroupKey, uint32_t, GroupKeyHash> mIndex;
+	std::vector<GroupKey>	mKeys;
+	std::vector<uint64_t>	mCounts;
+	// group major, a measure after another
+	std::vector<double>		mSums;
+	std::vector<double>		mMins;
+	std::vector<double>		mMaxs;
+
+	uint64_t				mRowsScanned;
+	uint64_t				mRowsMatched;
+	size_t					mBlocksScanned;
+	size_t					mBlocksSkipped;
+	size_t					mBlocksIndexed;
+
+	WorkerState() : mRowsScanned(0), mRowsMatched(0), mBlocksScanned(0), mBlocksSkipped(0), mBlocksIndexed(0) {}
+
+	uint32_t AddGroup(const GroupKey& key, size_t numMeasures)
+	{
+		std::pair<std::unordered_map<GroupKey, uint32_t, GroupKeyHash>::iterator, bool> it = mIndex.insert(std::make_pair(key, (uint32_t)mKeys.size()));
+		if (it.second)
+		{
+			mKeys.push_back(key);
+			mCounts.push_back(0);
+			mSums.resize(mSums.size() + numMeasures, 0.0);
+			mMins.resize(mMins.size() + numMeasures, HUGE_VAL);
+			mMaxs.resize(mMaxs.size() + numMeasures, -HUGE_VAL);
+		}
+		return it.first->second;
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////
+// predicate kernels, and each row of the mask with the rows of the range, or outside it to exclude
+
+template<typename T>
+static void FilterRange(const void* data, uint32_t rows, double minValue, double maxValue, bool exclude, uint8_t* mask)
+{
+	const T* values = static_cast<const T*>(data);
+	for (uint32_t i = 0; i < rows; ++i)
+		mask[i] &= (uint8_t)(((double)values[i] >= minValue && (double)values[i] <= maxValue) != exclude);
+}
+
+#if(QUERY_SSE2)
+// 16 lanes of all ones or zeros down to 16 mask bytes of 1 or 0, flipped to exclude
+static inline void StoreMask16(uint8_t* mask, __m128i r0, __m128i r1, __m128i r2, __m128i r3, __m128i flip)
+{
+	const __m128i bytes = _mm_packs_epi16(_mm_packs_epi32(r0, r1), _mm_packs_epi32(r2, r3));
+	const __m128i bits = _mm_xor_si128(_mm_and_si128(bytes, _mm_set1_epi8(1)), flip);
+	_mm_storeu_si128((__m128i*)mask, _mm_and_si128(_mm_loadu_si128((const __m128i*)mask), bits));
+}
+#endif
+
+static void FilterFloat(const float* values, uint32_t rows, double minValue, double maxValue, bool exclude, uint8_t* mask)
+{
+	// the float bounds that keep the same values as the double ones
+	float lo = (float)minValue, hi = (float)maxValue;
+	if ((double)lo < minValue)
+		lo = nextafterf(lo, HUGE_VALF);
+	if ((double)hi > maxValue)
+		hi = nextafterf(hi, -HUGE_VALF);
+
+	uint32_t i = 0;
+#if(QUERY_SSE2)
+	const __m128 vlo = _mm_set1_ps(lo), vhi = _mm_set1_ps(hi);
+	const __m128i flip = _mm_set1_epi8(exclude ? 1 : 0);
+	for (; i + 16 <= rows; i += 16)
+	{
+		__m128i r[4];
+		for (int k = 0; k < 4; ++k)
+		{
+			const __m128 v = _mm_loadu_ps(values + i + k * 4);
+			r[k] = _mm_castps_si128(_mm_and_ps(_mm_cmpge_ps(v, vlo), _mm_cmple_ps(v, vhi)));
+		}
+		StoreMask16(mask + i, r[0], r[1], r[2], r[3], flip);
+	}
+#endif
+	for (; i < rows; ++i)
+		mask[i] &= (uint8_t)((values[i] >= lo && values[i] <= hi) != exclude);
+}
+
+// 32 bit integers, unsigned ones are offset by 2^31 to compare signed
+static void FilterInt32(const void* data, bool isUnsigned, uint32_t rows, double minValue, double maxValue, bool exclude, uint8_t* mask)
+{
+	const double typeMin = isUnsigned ? 0.0 : (double)INT_MIN;
+	const double typeMax = isUnsigned ? (double)UINT_MAX : (double)INT_MAX;
+	const double lo = std::max(ceil(minValue), typeMin);
+	const double hi = std::min(floor(maxValue), typeMax);
+	if (lo > hi)
+	{
+		if (!exclude)
+			memset(mask, 0, rows);
+		return;
+	}
+
+	const uint32_t bias = isUnsigned ? 0x80000000u : 0u;
+	const int32_t ilo = (int32_t)((uint32_t)(int64_t)lo ^ bias);
+	const int32_t ihi = (int32_t)((uint32_t)(int64_t)hi ^ bias);
+	const uint32_t* values = static_cast<const uint32_t*>(data);
+
+	uint32_t i = 0;
+#if(QUERY_SSE2)
+	const __m128i vlo = _mm_set1_epi32(ilo), vhi = _mm_set1_epi32(ihi), vbias = _mm_set1_epi32((int)bias);
+	const __m128i flip = _mm_set1_epi8(exclude ? 1 : 0);
+	for (; i + 16 <= rows; i += 16)
+	{
+		__m128i r[4];
+		for (int k = 0; k < 4; ++k)
+		{
+			const __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(values + i + k * 4)), vbias);
+			r[k] = _mm_andnot_si128(_mm_or_si128(_mm_cmplt_epi32(v, vlo), _mm_cmpgt_epi32(v, vhi)), _mm_set1_epi32(-1));
+		}
+		StoreMask16(mask + i, r[0], r[1], r[2], r[3], flip);
+	}
+#endif
+	for (; i < rows; ++i)
+	{
+		const int32_t v = (int32_t)(values[i] ^ bias);
+		mask[i] &= (uint8_t)((v >= ilo && v <= ihi) != exclude);
+	}
+}
+
+static void ApplyFilter(const void* data, ColumnType type, uint32_t rows, double minValue, double maxValue, bool exclude, uint8_t* mask)
+{
+	switch (type)
+	{
+	case ColumnType_Int32: FilterInt32(data, false, rows, minValue, maxValue, exclude, mask); break;
+	case ColumnType_UInt32:
+	case ColumnType_String: FilterInt32(data, true, rows, minValue, maxValue, exclude, mask); break;
+	case ColumnType_Int64: FilterRange<int64_t>(data, rows, minValue, maxValue, exclude, mask); break;
+	case ColumnType_UInt64: FilterRange<uint64_t>(data, rows, minValue, maxValue, exclude, mask); break;
+	case ColumnType_Float: FilterFloat(static_cast<const float*>(data), rows, minValue, maxValue, exclude, mask); break;
+	case ColumnType_Double: FilterRange<double>(data, rows, minValue, maxValue, exclude, mask); break;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// aggregate kernels
+
+template<typename T>
+static void MaskedAggregate(const void* data, const uint8_t* mask, uint32_t rows, double& sum, double& minValue, double& maxValue)
+{
+	const T* values = static_cast<const T*>(data);
+	double s = 0.0, lo = HUGE_VAL, hi = -HUGE_VAL;
+	for (uint32_t i = 0; i < rows; ++i)
+	{
+		if (mask[i])
+		{
+			const double v = (double)values[i];
+			s += v;
+			lo = std::min(lo, v);
+			hi = std::max(hi, v);
+		}
+	}
+	sum += s;
+	minValue = std::min(minValue, lo);
+	maxValue = std::max(maxValue, hi);
+}
+
+template<>
+void MaskedAggregate<float>(const void* data, const uint8_t* mask, uint32_t rows, double& sum, double& minValue, double& maxValue)
+{
+	const float* values = static_cast<const float*>(data);
+	double s = 0.0;
+	float lo = HUGE_VALF, hi = -HUGE_VALF;
+
+	uint32_t i = 0;
+#if(QUERY_SSE2)
+	// masked out lanes add zero and compare as +-inf. sums are kept in doubles so billions of rows stay exact enough
+	const __m128i zero = _mm_setzero_si128();
+	const __m128 inf = _mm_set1_ps(HUGE_VALF), ninf = _mm_set1_ps(-HUGE_VALF);
+	__m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd();
+	__m128 vlo = inf, vhi = ninf;
+	for (; i + 4 <= rows; i += 4)
+	{
+		int maskBytes;
+		memcpy(&maskBytes, mask + i, sizeof(maskBytes));
+		const __m128i m8 = _mm_cvtsi32_si128(maskBytes);
+		const __m128 m = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_unpacklo_epi16(_mm_unpacklo_epi8(m8, zero), zero), zero));
+
+		const __m128 v = _mm_loadu_ps(values + i);
+		const __m128 kept = _mm_and_ps(m, v);
+		s0 = _mm_add_pd(s0, _mm_cvtps_pd(kept));
+		s1 = _mm_add_pd(s1, _mm_cvtps_pd(_mm_movehl_ps(kept, kept)));
+		vlo = _mm_min_ps(vlo, _mm_or_ps(kept, _mm_andnot_ps(m, inf)));
+		vhi = _mm_max_ps(vhi, _mm_or_ps(kept, _mm_andnot_ps(m, ninf)));
+	}
+
+	double sums[4];
+	float los[4], his[4];
+	_mm_storeu_pd(sums, s0);
+	_mm_storeu_pd(sums + 2, s1);
+	_mm_storeu_ps(los, vlo);
+	_mm_storeu_ps(his, vhi);
+	for (int k = 0; k < 4; ++k)
+	{
+		s += sums[k];
+		lo = std::min(lo, los[k]);
+		hi = std::max(hi, his[k]);
+	}
+#endif
+	for (; i < rows; ++i)
+	{
+		if (mask[i])
+		{
+			s += values[i];
+			lo = std::min(lo, values[i]);
+			hi = std::max(hi, values[i]);
+		}
+	}
+	sum += s;
+	minValue = std::min(minValue, (double)lo);
+	maxValue = std::max(maxValue, (double)hi);
+}
+
+static void MaskedAggregate(const void* data, ColumnType type, const uint8_t* mask, uint32_t rows, double& sum, double& minValue, double& maxValue)
+{
+	switch (type)
+	{
+	case ColumnType_Int32: MaskedAggregate<int32_t>(data, mask, rows, sum, minValue, maxValue); break;
+	case ColumnType_UInt32:
+	case ColumnType_String: MaskedAggregate<uint32_t>(data, mask, rows, sum, minValue, maxValue); break;
+	case ColumnType_Int64: MaskedAggregate<int64_t>(data, mask, rows, sum, minValue, maxValue); break;
+	case ColumnType_UInt64: MaskedAggregate<uint64_t>(data, mask, rows, sum, minValue, maxValue); break;
+	case ColumnType_Float: MaskedAggregate<float>(data, mask, rows, sum, minValue, maxValue); break;
+	case ColumnType_Double: MaskedAggregate<double>(data, mask, rows, sum, minValue, maxValue); break;
+	}
+}
+
+template<typename T>
+static void GroupAggregate(const void* data, const uint32_t* selection, const uint32_t* groups, size_t count, size_t numMeasures, size_t measure, double* sums, double* mins, double* maxs)
+{
+	const T* values = static_cast<const T*>(data);
+	for (size_t k = 0; k < count; ++k)
+	{
+		const double v = (double)values[selection[k]];
+		const size_t slot = groups[k] * numMeasures + measure;
+		sums[slot] += v;
+		mins[slot] = std::min(mins[slot], v);
+		maxs[slot] = std::max(maxs[slot], v);
+	}
+}
+
+static void GroupAggregate(const void* data, ColumnType type, const uint32_t* selection, const uint32_t* groups, size_t count, size_t numMeasures, size_t measure, double* sums, double* mins, double* maxs)
+{
+	switch (type)
+	{
+	case ColumnType_Int32: GroupAggregate<int32_t>(data, selection, groups, count, numMeasures, measure, sums, mins, maxs); break;
+	case ColumnType_UInt32:
+	case ColumnType_String: GroupAggregate<uint32_t>(data, selection, groups, count, numMeasures, measure, sums, mins, maxs); break;
+	case ColumnType_Int64: GroupAggregate<int64_t>(data, selection, groups, count, numMeasures, measure, sums, mins, maxs); break;
+	case ColumnType_UInt64: GroupAggregate<uint64_t>(data, selection, groups, count, numMeasures, measure, sums, mins, maxs); break;
+	case ColumnType_Float: GroupAggregate<float>(data, selection, groups, count, numMeasures, measure, sums, mins, maxs); break;
+	case ColumnType_Double: GroupAggregate<double>(data, selection, groups, count, numMeasures, measure, sums, mins, maxs); break;
+	}
+}
+
+// group values as int64, floating point ones by the bits of their double
+template<typename T>
+static void GatherKeys(const void* data, const uint32_t* selection, size_t count, int64_t* keys)
+{
+	const T* values = static_cast<const T*>(data);
+	for (size_t k = 0; k < count; ++k)
+		keys[k] = (int64_t)values[selection[k]];
+}
+
+template<typename T>
+static void GatherFloatKeys(const void* data, const uint32_t* selection, size_t count, int64_t* keys)
+{
+	const T* values = static_cast<const T*>(data);
+	for (size_t k = 0; k < count; ++k)
+	{
+		const double v = (double)values[selection[k]];
+		memcpy(&keys[k], &v, sizeof(v));
+	}
+}
+
+static void GatherKeys(const void* data, ColumnType type, const uint32_t* selection, size_t count, int64_t* keys)
+{
+	switch (type)
+	{
+	case ColumnType_Int32: GatherKeys<int32_t>(data, selection, count, keys); break;
+	case ColumnType_UInt32:
+	case ColumnType_String: GatherKeys<uint32_t>(data, selection, count, keys); break;
+	case ColumnType_Int64: GatherKeys<int64_t>(data, selection, count, keys); break;
+	case ColumnType_UInt64: GatherKeys<uint64_t>(data, selection, count, keys); break;
+	case ColumnType_Float: GatherFloatKeys<float>(data, selection, count, keys); break;
+	case ColumnType_Double: GatherFloatKeys<double>(data, selection, count, keys); break;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ColumnQueryEngine::ColumnQueryEngine()
+	: mNumThreads(0)
+{
+}
+
+bool ColumnQueryEngine::AddFile(const std::string& filename, std::string& error)
+{
+	std::unique_ptr<ColumnarReader> file(new ColumnarReader());
+	if (!file->Open(filename, error))
+		return false;
+
+	if (!mFiles.empty() && file->GetTypeName() != mFiles[0]->GetTypeName())
+	{
+		error = filename + " holds " + file->GetTypeName() + " events, not " + mFiles[0]->GetTypeName();
+		return false;
+	}
+
+	std::unique_ptr<ColumnIndexReader> index;
+	const std::string indexFilename = ColumnIndexFilename(filename);
+	FILE* fp = fopen(indexFilename.c_str(), "rb");
+	if (fp != NULL)
+	{
+		fclose(fp);
+		index.reset(new ColumnIndexReader());
+		if (!index->Open(indexFilename, *file, error))
+			return false;
+	}
+
+	mFilenames.push_back(filename);
+	mFiles.push_back(std::move(file));
+	mIndexes.push_back(std::move(index));
+	return true;
+}
+
+void ColumnQueryEngine::Clear()
+{
+	mFilenames.clear();
+	mFiles.clear();
+	mIndexes.clear();
+}
+
+size_t ColumnQueryEngine::GetNumIndexedFiles() const
+{
+	size_t count = 0;
+	for (size_t f = 0; f < mIndexes.size(); ++f)
+		count += mIndexes[f] ? 1 : 0;
+	return count;
+}
+
+bool ColumnQueryEngine::BuildIndexes(std::string& error)
+{
+	for (size_t f = 0; f < mFiles.size(); ++f)
+	{
+		if (mIndexes[f])
+			continue;
+
+		const std::string indexFilename = ColumnIndexFilename(mFilenames[f]);
+		std::unique_ptr<ColumnIndexReader> index(new ColumnIndexReader());
+		if (!BuildColumnIndex(*mFiles[f], indexFilename, mNumThreads, error) || !index->Open(indexFilename, *mFiles[f], error))
+			return false;
+		mIndexes[f] = std::move(index);
+	}
+	return true;
+}
+
+static const google::protobuf::FieldDescriptor* ColumnField(const ColumnInfo& column)
+{
+	return column.mPath.empty() ? NULL : column.mPath.back();
+}
+
+bool ColumnQueryEngine::PlanFile(const ColumnQuery& query, size_t fileIndex, FilePlan& plan, std::string& error) const
+{
+	const ColumnarReader& file = *mFiles[fileIndex];
+	plan.mFile = &file;
+	plan.mIndex = mIndexes[fileIndex].get();
+	plan.mEmpty = false;
+	plan.mKeyByFile = false;
+
+	if (query.mStartTime != LLONG_MIN || query.mEndTime != LLONG_MAX)
+	{
+		FilePlan::Filter time = { 0, ColumnType_Int64, (double)query.mStartTime, (double)query.mEndTime, false, std::vector<double>(), false };
+		plan.mFilters.push_back(time);
+	}
+
+	for (size_t i = 0; i < query.mFilters.size(); ++i)
+	{
+		const ColumnFilter& filter = query.mFilters[i];
+		const int column = file.FindColumn(filter.mColumn);
+		if (column < 0)
+		{
+			error = "unknown column " + filter.mColumn;
+			return false;
+		}
+
+		const ColumnInfo& info = file.GetColumn(column);
+		const google::protobuf::FieldDescriptor* fdesc = ColumnField(info);
+		FilePlan::Filter f = { (size_t)column, info.mType, filter.mMin, filter.mMax, filter.mExclude, std::vector<double>(), false };
+
+		for (size_t v = 0; v < filter.mValues.size(); ++v)
+		{
+			const std::string& name = filter.mValues[v];
+
+			bool found = false;
+			int64_t value = 0;
+			if (info.mType == ColumnType_String)
+			{
+				// a string none of the rows of this file have matches nothing
+				uint32_t code = 0;
+				if (file.FindString(name, code))
+					f.mValues.push_back((double)code);
+				continue;
+			}
+			else if (fdesc != NULL && fdesc->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_ENUM)
+			{
+				const google::protobuf::EnumValueDescriptor* evd = fdesc->enum_type()->FindValueByName(name);
+				found = evd != NULL;
+				value = found ? evd->number() : 0;
+			}
+			else if (fdesc != NULL && fdesc->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_BOOL)
+			{
+				found = name == "true" || name == "false";
+				value = name == "true" ? 1 : 0;
+			}
+			else if (fdesc != NULL && fdesc->options().HasExtension(Analytics::enumkey))
+			{
+				found = mEnumNames.FindValue(fdesc->options().GetExtension(Analytics::enumkey), name, value);
+			}
+
+			if (found)
+			{
+				f.mValues.push_back((double)value);
+				continue;
+			}
+
+			// plain numbers are fine for any numeric column
+			char* end = NULL;
+			const double number = strtod(name.c_str(), &end);
+			if (end == name.c_str() || *end != '\0')
+			{
+				error = "unknown value " + name + " for column " + filter.mColumn;
+				return false;
+			}
+			f.mValues.push_back(number);
+		}
+
+		if (!filter.mValues.empty())
+		{
+			if (f.mValues.empty())
+			{
+				// nothing can match, or everything passes the exclusion
+				if (!filter.mExclude)
+					plan.mEmpty = true;
+				continue;
+			}
+
+			std::sort(f.mValues.begin(), f.mValues.end());
+			f.mValues.erase(std::unique(f.mValues.begin(), f.mValues.end()), f.mValues.end());
+			f.mMin = f.mValues.front();
+			f.mMax = f.mValues.back();
+		}
+		else if (f.mMin == f.mMax)
+		{
+			// a single number is a value the index may have
+			f.mValues.push_back(f.mMin);
+		}
+
+		f.mIndexed = plan.mIndex != NULL && plan.mIndex->HasColumn(column) && !f.mValues.empty();
+		for (size_t v = 0; v < f.mValues.size(); ++v)
+			f.mIndexed = f.mIndexed && f.mValues[v] == floor(f.mValues[v]) && fabs(f.mValues[v]) < 9007199254740992.0;
+		plan.mFilters.push_back(f);
+	}
+
+	if (query.mGroupBy.size() > MaxGroupBy)
+	{
+		error = "too many group by columns";
+		return false;
+	}
+
+	for (size_t i = 0; i < query.mGroupBy.size(); ++i)
+	{
+		const int column = file.FindColumn(query.mGroupBy[i]);
+		if (column < 0)
+		{
+			error = "unknown column " + query.mGroupBy[i];
+			return false;
+		}
+		plan.mGroupColumns.push_back((size_t)column);
+		plan.mKeyByFile = plan.mKeyByFile || file.GetColumn(column).mType == ColumnType_String;
+	}
+
+	for (size_t i = 0; i < query.mMeasures.size(); ++i)
+	{
+		const ColumnMeasure& measure = query.mMeasures[i];
+		if (measure.mAggregate == ColumnAggregate_Count)
+		{
+			plan.mMeasureColumns.push_back(-1);
+			continue;
+		}
+
+		const int column = file.FindColumn(measure.mColumn);
+		if (column < 0 || file.GetColumn(column).mType == ColumnType_String)
+		{
+			error = "no numeric column " + measure.mColumn;
+			return false;
+		}
+		plan.mMeasureColumns.push_back(column);
+	}
+	return true;
+}
+
+void ColumnQueryEngine::RunBlock(const FilePlan& plan, size_t fileIndex, size_t block, WorkerState& state) const
+{
+	const ColumnarReader& file = *plan.mFile;
+	const uint32_t rows = file.GetBlockRows(block);
+
+	// the filters the stats don't settle for the whole block
+	state.mPending.clear();
+	for (size_t i = 0; i < plan.mFilters.size(); ++i)
+	{
+		const FilePlan::Filter& f = plan.mFilters[i];
+		const ColumnStats& stats = file.GetStats(block, f.mColumn);
+		const bool overlaps = stats.mMax >= f.mMin && stats.mMin <= f.mMax;
+		// with a few values the rows only all match when they all have one of them
+		const bool inside = f.mValues.size() > 1 ?
+			stats.mMin == stats.mMax && std::binary_search(f.mValues.begin(), f.mValues.end(), stats.mMin) :
+			stats.mMin >= f.mMin && stats.mMax <= f.mMax;
+
+		if (f.mExclude ? inside : !overlaps)
+		{
+			++state.mBlocksSkipped;
+			return;
+		}
+
+		if (f.mExclude ? overlaps : !inside)
+			state.mPending.push_back(i);
+	}
+
+	// the rows of the indexed filters, an OR of the bitmaps of the values of each filter and an AND across filters
+	bool indexed = false;
+	size_t numPending = 0;
+	for (size_t i = 0; i < state.mPending.size(); ++i)
+	{
+		const FilePlan::Filter& f = plan.mFilters[state.mPending[i]];
+		if (!f.mIndexed)
+		{
+			state.mPending[numPending++] = state.mPending[i];
+			continue;
+		}
+
+		state.mAny.Clear();
+		for (size_t v = 0; v < f.mValues.size(); ++v)
+		{
+			plan.mIndex->GetBitmap(block, f.mColumn, (int64_t)f.mValues[v], state.mValueRows);
+			RoaringBitmap::Or(state.mAny, state.mValueRows, state.mAny);
+		}
+
+		if (f.mExclude)
+		{
+			RoaringBitmap::Range(0, rows, state.mValueRows);
+			RoaringBitmap::AndNot(state.mValueRows, state.mAny, state.mAny);
+		}
+
+		if (indexed)
+			RoaringBitmap::And(state.mRows, state.mAny, state.mRows);
+		else
+			std::swap(state.mRows, state.mAny);
+		indexed = true;
+
+		if (state.mRows.Empty())
+		{
+			++state.mBlocksSkipped;
+			return;
+		}
+	}
+	state.mPending.resize(numPending);
+
+	++state.mBlocksScanned;
+	state.mRowsScanned += rows;
+
+	const size_t numMeasures = plan.mMeasureColumns.size();
+
+	if (indexed)
+	{
+		++state.mBlocksIndexed;
+
+		// counts the bitmaps settle alone
+		bool countsOnly = state.mPending.empty() && plan.mGroupColumns.empty();
+		for (size_t m = 0; m < numMeasures; ++m)
+			countsOnly = countsOnly && plan.mMeasureColumns[m] < 0;
+
+		if (countsOnly)
+		{
+			GroupKey key;
+			memset(&key, 0, sizeof(key));
+			const uint64_t count = state.mRows.Cardinality();
+			state.mCounts[state.AddGroup(key, numMeasures)] += count;
+			state.mRowsMatched += count;
+			return;
+		}
+
+		state.mMask.resize(rows);
+		state.mRows.ToMask(state.mMask.data(), rows);
+	}
+	else
+	{
+		state.mMask.assign(rows, 1);
+	}
+
+	uint8_t* mask = state.mMask.data();
+	for (size_t i = 0; i < state.mPending.size(); ++i)
+	{
+		const FilePlan::Filter& f = plan.mFilters[state.mPending[i]];
+		const void* data = file.GetData(block, f.mColumn);
+		if (f.mValues.size() <= 1)
+		{
+			ApplyFilter(data, f.mType, rows, f.mMin, f.mMax, f.mExclude, mask);
+			continue;
+		}
+
+		// the rows matching none of the values, kept or dropped
+		state.mAnyMask.assign(rows, 1);
+		for (size_t v = 0; v < f.mValues.size(); ++v)
+			ApplyFilter(data, f.mType, rows, f.mValues[v], f.mValues[v], true, state.mAnyMask.data());
+		for (uint32_t r = 0; r < rows; ++r)
+			mask[r] &= (uint8_t)(state.mAnyMask[r] == (f.mExclude ? 1 : 0));
+	}
+
+	state.mSelection.clear();
+	for (uint32_t i = 0; i < rows; ++i)
+	{
+		if (mask[i])
+			state.mSelection.push_back(i);
+	}
+
+	const size_t count = state.mSelection.size();
+	state.mRowsMatched += count;
+	if (count == 0)
+		return;
+
+	if (plan.mGroupColumns.empty())
+	{
+		GroupKey key;
+		memset(&key, 0, sizeof(key));
+		const uint32_t group = state.AddGroup(key, numMeasures);
+
+		state.mCounts[group] += count;
+		for (size_t m = 0; m < numMeasures; ++m)
+		{
+			const int column = plan.mMeasureColumns[m];
+			if (column < 0)
+				continue;
+
+			const size_t slot = group * numMeasures + m;
+			MaskedAggregate(file.GetData(block, column), file.GetColumn(column).mType, mask, rows, state.mSums[slot], state.mMins[slot], state.mMaxs[slot]);
+		}
+		return;
+	}
+
+	// the group of each selected row, column at a time and then through the hash for runs of different keys
+	const size_t numGroups = plan.mGroupColumns.size();
+	state.mKeyParts.resize(count * numGroups);
+	for (size_t g = 0; g < numGroups; ++g)
+	{
+		const size_t column = plan.mGroupColumns[g];
+		GatherKeys(file.GetData(block, column), file.GetColumn(column).mType, state.mSelection.data(), count, &state.mKeyParts[g * count]);
+	}
+
+	state.mGroups.resize(count);
+	GroupKey key, last;
+	memset(&key, 0, sizeof(key));
+	key.mFile = plan.mKeyByFile ? (uint32_t)fileIndex : 0;
+	uint32_t lastGroup = 0;
+	for (size_t k = 0; k < count; ++k)
+	{
+		for (size_t g = 0; g < numGroups; ++g)
+			key.mParts[g] = state.mKeyParts[g * count + k];
+
+		if (k == 0 || !(key == last))
+		{
+			lastGroup = state.AddGroup(key, numMeasures);
+			last = key;
+		}
+		state.mGroups[k] = lastGroup;
+		++state.mCounts[lastGroup];
+	}
+
+	for (size_t m = 0; m < numMeasures; ++m)
+	{
+		const int column = plan.mMeasureColumns[m];
+		if (column < 0)
+			continue;
+
+		GroupAggregate(file.GetData(block, column), file.GetColumn(column).mType, state.mSelection.data(), state.mGroups.data(), count,
+			numMeasures, m, state.mSums.data(), state.mMins.data(), state.mMaxs.data());
+	}
+}
+
+std::string ColumnQueryEngine::FormatKey(const ColumnarReader& file, size_t column, int64_t key) const
+{
+	const ColumnInfo& info = file.GetColumn(column);
+	char buffer[64];
+
+	switch (info.mType)
+	{
+	case ColumnType_String:
+		return (uint64_t)key < file.GetNumStrings() ? file.GetString((uint32_t)key) : std::string();
+	case ColumnType_Float:
+	case ColumnType_Double:
+	{
+		double value;
+		memcpy(&value, &key, sizeof(value));
+		snprintf(buffer, sizeof(buffer), "%g", value);
+		return buffer;
+	}
+	case ColumnType_UInt64:
+		snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)key);
+		return buffer;
+	default:
+		break;
+	}
+
+	const google::protobuf::FieldDescriptor* fdesc = ColumnField(info);
+	if (fdesc != NULL)
+	{
+		if (fdesc->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_BOOL)
+			return key != 0 ? "true" : "false";
+
+		if (fdesc->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_ENUM)
+		{
+			const google::protobuf::EnumValueDescriptor* evd = fdesc->enum_type()->FindValueByNumber((int)key);
+			if (evd != NULL)
+				return evd->name();
+		}
+
+		// flags are combinations, a single name would be wrong
+		const google::protobuf::FieldOptions& options = fdesc->options();
+		std::string name;
+		if (options.HasExtension(Analytics::enumkey) && !options.GetExtension(Analytics::enumflags) && !options.GetExtension(Analytics::enumflagsindexed) &&
+			mEnumNames.FindName(options.GetExtension(Analytics::enumkey), key, name))
+			return name;
+	}
+
+	snprintf(buffer, sizeof(buffer), "%lld", (long long)key);
+	return buffer;
+}
+
+bool ColumnQueryEngine::Run(const ColumnQuery& query, ColumnQueryResult& result, std::string& error) const
+{
+	result = ColumnQueryResult();
+	if (mFiles.empty())
+	{
+		error = "no files to query";
+		return false;
+	}
+
+	std::vector<FilePlan> plans(mFiles.size());
+	std::vector< std::pair<uint32_t, uint32_t> > tasks;
+	for (size_t f = 0; f < mFiles.size(); ++f)
+	{
+		if (!PlanFile(query, f, plans[f], error))
+			return false;
+
+		if (plans[f].mEmpty)
+		{
+			result.mBlocksSkipped += mFiles[f]->GetNumBlocks();
+			continue;
+		}
+
+		for (size_t b = 0; b < mFiles[f]->GetNumBlocks(); ++b)
+			tasks.push_back(std::make_pair((uint32_t)f, (uint32_t)b));
+	}
+
+	std::vector<WorkerState> states(WorkStealingThreads(tasks.size(), mNumThreads));
+	WorkStealingFor(tasks.size(), mNumThreads, [this, &plans, &tasks, &states](size_t index, int worker)
+	{
+		RunBlock(plans[tasks[index].first], tasks[index].first, tasks[index].second, states[worker]);
+	});
+
+	// the partial groups of the workers merged by their formatted keys, which also joins string codes of different files
+	const size_t numMeasures = query.mMeasures.size();
+	std::map< std::vector<std::string>, size_t > rowIndex;
+	std::vector<double> mins, maxs;
+
+	for (size_t w = 0; w < states.size(); ++w)
+	{
+		const WorkerState& state = states[w];
+		result.mRowsScanned += state.mRowsScanned;
+		result.mRowsMatched += state.mRowsMatched;
+		result.mBlocksScanned += state.mBlocksScanned;
+		result.mBlocksSkipped += state.mBlocksSkipped;
+		result.mBlocksIndexed += state.mBlocksIndexed;
+
+		for (size_t g = 0; g < state.mKeys.size(); ++g)
+		{
+			const GroupKey& key = state.mKeys[g];
+			const FilePlan& plan = plans[key.mFile];
+
+			std::vector<std::string> keys;
+			for (size_t i = 0; i < plan.mGroupColumns.size(); ++i)
+				keys.push_back(FormatKey(*plan.mFile, plan.mGroupColumns[i], key.mParts[i]));
+
+			std::pair<std::map< std::vector<std::string>, size_t >::iterator, bool> it = rowIndex.insert(std::make_pair(keys, result.mRows.size()));
+			if (it.second)
+			{
+				ColumnQueryRow row;
+				row.mKeys = keys;
+				row.mCount = 0;
+				row.mValues.assign(numMeasures, 0.0);
+				result.mRows.push_back(row);
+				mins.resize(mins.size() + numMeasures, HUGE_VAL);
+				maxs.resize(maxs.size() + numMeasures, -HUGE_VAL);
+			}
+
+			const size_t r = it.first->second;
+			ColumnQueryRow& row = result.mRows[r];
+			row.mCount += state.mCounts[g];
+			for (size_t m = 0; m < numMeasures; ++m)
+			{
+				const size_t from = g * numMeasures + m;
+				row.mValues[m] += state.mSums[from];
+				mins[r * numMeasures + m] = std::min(mins[r * numMeasures + m], state.mMins[from]);
+				maxs[r * numMeasures + m] = std::max(maxs[r * numMeasures + m], state.mMaxs[from]);
+			}
+		}
+	}
+
+	for (size_t r = 0; r < result.mRows.size(); ++r)
+	{
+		ColumnQueryRow& row = result.mRows[r];
+		for (size_t m = 0; m < numMeasures; ++m)
+		{
+			switch (query.mMeasures[m].mAggregate)
+			{
+			case ColumnAggregate_Count: row.mValues[m] = (double)row.mCount; break;
+			case ColumnAggregate_Sum: break;
+			case ColumnAggregate_Min: row.mValues[m] = mins[r * numMeasures + m]; break;
+			case ColumnAggregate_Max: row.mValues[m] = maxs[r * numMeasures + m]; break;
+			case ColumnAggregate_Mean: row.mValues[m] = row.mCount > 0 ? row.mValues[m] / (double)row.mCount : 0.0; break;
+			}
+		}
+	}
+
+	std::sort(result.mRows.begin(), result.mRows.end(), [](const ColumnQueryRow& a, const ColumnQueryRow& b)
+	{
+		return a.mKeys < b.mKeys;
+	});
+
+	for (size_t i = 0; i < query.mGroupBy.size(); ++i)
+		result.mKeyNames.push_back(query.mGroupBy[i]);
+
+	static const char* aggregateNames[] = { "count", "sum", "min", "max", "mean" };
+	for (size_t m = 0; m < numMeasures; ++m)
+	{
+		const ColumnMeasure& measure = query.mMeasures[m];
+		result.mValueNames.push_back(measure.mAggregate == ColumnAggregate_Count ? std::string("count") :
+			std::string(aggregateNames[measure.mAggregate]) + "(" + measure.mColumn + ")");
+	}
+
+	return true;
+}
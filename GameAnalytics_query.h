@@ -0,0 +1,163 @@
+#ifndef GAMEANALYTICS_QUERY_H
+#define GAMEANALYTICS_QUERY_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+
+#include "analytics.pb.h"
+#include "GameAnalytics_columns.h"
+#include "GameAnalytics_bitmap.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// The names of the GameEnum values a game sent, keyed by the enum name the (enumkey) option of a field refers to
+class EnumNameTable
+{
+public:
+	void Add(const Analytics::GameEnum& msg);
+	void Add(const std::string& enumKey, int64_t value, const std::string& name);
+	bool Empty() const { return mEnums.empty(); }
+
+	bool FindName(const std::string& enumKey, int64_t value, std::string& name) const;
+	bool FindValue(const std::string& enumKey, const std::string& name, int64_t& value) const;
+
+	// a line of "ENUMKEY value name" per value
+	bool Load(const std::string& filename, std::string& error);
+	bool Save(const std::string& filename, std::string& error) const;
+private:
+	struct Enum
+	{
+		std::map<int64_t, std::string>	mNames;
+		std::map<std::string, int64_t>	mValues;
+	};
+
+	std::map<std::string, Enum>			mEnums;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// rows of a column inside an inclusive range, or outside of it with mExclude
+struct ColumnFilter
+{
+	std::string					mColumn;
+	double						mMin;
+	double						mMax;
+	// strings of a string column, names of enum values or numbers, rows matching any of them instead of the range when set
+	std::vector<std::string>	mValues;
+	bool						mExclude;
+
+	ColumnFilter();
+};
+
+enum ColumnAggregate
+{
+	ColumnAggregate_Count,
+	ColumnAggregate_Sum,
+	ColumnAggregate_Min,
+	ColumnAggregate_Max,
+	ColumnAggregate_Mean,
+};
+
+struct ColumnMeasure
+{
+	ColumnAggregate	mAggregate;
+	// unused for counts
+	std::string		mColumn;
+};
+
+// the rows of a time range that pass every filter, grouped by the values of up to MaxGroupBy columns
+struct ColumnQuery
+{
+	int64_t						mStartTime;
+	int64_t						mEndTime;
+	std::vector<ColumnFilter>	mFilters;
+	std::vector<std::string>	mGroupBy;
+	// the row count of each group is always there, the measures come after it
+	std::vector<ColumnMeasure>	mMeasures;
+
+	ColumnQuery();
+
+	void Where(const std::string& column, double value, bool exclude = false);
+	void WhereRange(const std::string& column, double minValue, double maxValue, bool exclude = false);
+	void WhereValue(const std::string& column, const std::string& value, bool exclude = false);
+	void WhereAny(const std::string& column, const std::vector<std::string>& values, bool exclude = false);
+	void GroupBy(const std::string& column);
+	void Measure(ColumnAggregate aggregate, const std::string& column = std::string());
+};
+
+struct ColumnQueryRow
+{
+	// strings, enum names where the column has an (enumkey) or enum type, numbers otherwise
+	std::vector<std::string>	mKeys;
+	uint64_t					mCount;
+	std::vector<double>			mValues;
+};
+
+struct ColumnQueryResult
+{
+	std::vector<std::string>	mKeyNames;
+	std::vector<std::string>	mValueNames;
+	// sorted by key
+	std::vector<ColumnQueryRow>	mRows;
+
+	uint64_t					mRowsScanned;
+	uint64_t					mRowsMatched;
+	size_t						mBlocksScanned;
+	size_t						mBlocksSkipped;
+	// scanned blocks whose value filters were answered by the bitmap index
+	size_t						mBlocksIndexed;
+
+	ColumnQueryResult();
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// Filters and group-bys over the column archives of one event type. The blocks of every file are spread over
+// a work stealing pool, blocks the min and max of a filter column rule out are skipped without touching their
+// values, the filters run as SSE2 range kernels over the mapped columns into a byte mask and the measures are
+// summed per group into partial results of each worker that are merged at the end. Value filters on columns of
+// the bitmap index next to a file, see BuildColumnIndex, are ORed and ANDed as bitmaps before any value is read,
+// and counts they settle alone don't read the columns at all.
+class ColumnQueryEngine
+{
+public:
+	enum { MaxGroupBy = 4 };
+
+	ColumnQueryEngine();
+
+	// 0 uses every hardware thread
+	void SetThreadCount(int numThreads) { mNumThreads = numThreads; }
+
+	EnumNameTable& GetEnumNames() { return mEnumNames; }
+	const EnumNameTable& GetEnumNames() const { return mEnumNames; }
+
+	// one file per session or time range, all of the same event type. the index of the file is used when it exists
+	bool AddFile(const std::string& filename, std::string& error);
+	void Clear();
+	size_t GetNumFiles() const { return mFiles.size(); }
+	size_t GetNumIndexedFiles() const;
+
+	// writes and opens the missing indexes of the files
+	bool BuildIndexes(std::string& error);
+
+	bool Run(const ColumnQuery& query, ColumnQueryResult& result, std::string& error) const;
+private:
+	struct FilePlan;
+	struct WorkerState;
+
+	int													mNumThreads;
+	EnumNameTable										mEnumNames;
+	std::vector<std::string>							mFilenames;
+	std::vector< std::unique_ptr<ColumnarReader> >		mFiles;
+	// null for files without an index
+	std::vector< std::unique_ptr<ColumnIndexReader> >	mIndexes;
+
+	bool PlanFile(const ColumnQuery& query, size_t file, FilePlan& plan, std::string& error) const;
+	void RunBlock(const FilePlan& plan, size_t file, size_t block, WorkerState& state) const;
+	std::string FormatKey(const ColumnarReader& file, size_t column, int64_t key) const;
+};
+
+#endif
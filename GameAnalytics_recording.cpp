@@ -0,0 +1,530 @@
+#include "GameAnalytics_recording.h"
+
+#include <cstring>
+#include <algorithm>
+
+#include "fastlz.h"
+
+#include "google/protobuf/message.h"
+
+// f u windows
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+// 'GASR' and the layout version, at the start of the file and again after the footer offset at its end
+static const uint32_t RecordingFileMagic = 0x52534147;
+static const uint32_t RecordingFileVersion = 1;
+
+// FastLZ doesn't expand a block more than about 255 times, a raw size past that is a broken footer
+static const uint64_t RecordingMaxBlockRatio = 256;
+
+static void AppendString(std::string& buffer, const std::string& str)
+{
+	const uint32_t size = (uint32_t)str.size();
+	buffer.append((const char*)&size, sizeof(size));
+	buffer.append(str);
+}
+
+template<typename T>
+static void AppendPod(std::string& buffer, T value)
+{
+	buffer.append((const char*)&value, sizeof(T));
+}
+
+// bounds checked reads over mapped or decompressed bytes
+struct RecordingCursor
+{
+	const uint8_t*	mData;
+	uint64_t		mSize;
+	uint64_t		mPos;
+
+	template<typename T>
+	bool Read(T& value)
+	{
+		if (mSize - mPos < sizeof(T))
+			return false;
+		memcpy(&value, mData + mPos, sizeof(T));
+		mPos += sizeof(T);
+		return true;
+	}
+
+	bool ReadString(std::string& str)
+	{
+		uint32_t size = 0;
+		if (!Read(size) || mSize - mPos < size)
+			return false;
+		str.assign((const char*)mData + mPos, size);
+		mPos += size;
+		return true;
+	}
+};
+
+// the index entry of a block, field by field so the padding of the struct stays out of the file
+template<typename BlockT>
+static void AppendBlock(std::string& buffer, const BlockT& block)
+{
+	AppendPod(buffer, block.mStartTime);
+	AppendPod(buffer, block.mEndTime);
+	AppendPod(buffer, block.mOffset);
+	AppendPod(buffer, block.mSize);
+	AppendPod(buffer, block.mRawSize);
+	AppendPod(buffer, block.mNumEvents);
+}
+
+template<typename BlockT>
+static bool ReadBlockIndex(RecordingCursor& cursor, BlockT& block)
+{
+	return cursor.Read(block.mStartTime) && cursor.Read(block.mEndTime) && cursor.Read(block.mOffset) &&
+		cursor.Read(block.mSize) && cursor.Read(block.mRawSize) && cursor.Read(block.mNumEvents);
+}
+
+// the compressed bytes before the footer and a raw size they can decompress to, which the reader allocates up front
+template<typename BlockT>
+static bool IsBlockInFile(const BlockT& block, uint64_t footerOffset)
+{
+	return block.mOffset <= footerOffset && block.mSize <= footerOffset - block.mOffset && block.mRawSize <= block.mSize * RecordingMaxBlockRatio;
+}
+
+static bool IsStateKeyType(Analytics::RedisKeyType keyType)
+{
+	// GameAnalytics stores types without a key type with SET
+	return keyType == Analytics::SET || keyType == Analytics::UNKNOWN || keyType == Analytics::HMSET;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SessionRecordingEvent::SessionRecordingEvent()
+	: mTime(0)
+	, mType(NULL)
+	, mKeyType(Analytics::UNKNOWN)
+{
+}
+
+google::protobuf::Message* SessionRecordingEvent::ParseMessage() const
+{
+	if (mType == NULL)
+		return NULL;
+
+	const google::protobuf::Message* prototype = google::protobuf::MessageFactory::generated_factory()->GetPrototype(mType);
+	if (prototype == NULL)
+		return NULL;
+
+	google::protobuf::Message* msg = prototype->New();
+	if (!msg->ParseFromString(mPayload))
+	{
+		delete msg;
+		return NULL;
+	}
+	return msg;
+}
+
+void SessionRecordingState::Apply(const SessionRecordingEvent& ev)
+{
+	if (IsStateKeyType(ev.mKeyType))
+		mValues[std::make_pair(ev.mKey, ev.mField)] = ev;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SessionRecordingWriter::SessionRecordingWriter()
+	: mFile(NULL)
+	, mKeyframeInterval(DefaultKeyframeInterval)
+	, mBlockSize(DefaultBlockSize)
+	, mOffset(0)
+	, mFailed(false)
+	, mKeyframeTime(0)
+{
+	memset(&mPending, 0, sizeof(mPending));
+}
+
+SessionRecordingWriter::~SessionRecordingWriter()
+{
+	if (mFile != NULL)
+		fclose(mFile);
+}
+
+bool SessionRecordingWriter::Write(const void* data, size_t size)
+{
+	if (!mFailed && fwrite(data, 1, size, mFile) != size)
+		mFailed = true;
+	mOffset += size;
+	return !mFailed;
+}
+
+bool SessionRecordingWriter::Open(const std::string& filename, const std::string& session, int64_t keyframeInterval, uint32_t blockSize, std::string& error)
+{
+	if (mFile != NULL)
+		fclose(mFile);
+
+	mFile = fopen(filename.c_str(), "wb");
+	if (mFile == NULL)
+	{
+		error = "can't write " + filename;
+		return false;
+	}
+
+	mFilename = filename;
+	mSession = session;
+	mKeyframeInterval = keyframeInterval;
+	mBlockSize = std::max(blockSize, 1024u);
+	mOffset = 0;
+	mFailed = false;
+	mTypeNames.clear();
+	mTypeIndex.clear();
+	mBlocks.clear();
+	mKeyframes.clear();
+	mKeyframeTime = 0;
+	mState.clear();
+	mBlock.clear();
+
+	const uint32_t header[2] = { RecordingFileMagic, RecordingFileVersion };
+	return Write(header, sizeof(header));
+}
+
+void SessionRecordingWriter::AppendRecord(std::string& buffer, int64_t time, uint32_t typeIndex, Analytics::RedisKeyType keyType, const std::string& key, const std::string& field, const std::string& payload)
+{
+	AppendPod(buffer, time);
+	AppendPod(buffer, typeIndex);
+	AppendPod(buffer, (uint8_t)keyType);
+	AppendString(buffer, key);
+	AppendString(buffer, field);
+	AppendString(buffer, payload);
+}
+
+SessionRecordingWriter::Block SessionRecordingWriter::WriteBlock(const std::string& raw, int64_t startTime, int64_t endTime, uint32_t numEvents)
+{
+	// fastlz needs 5% and at least 66 bytes of headroom
+	const int size = (int)raw.size();
+	mCompressed.resize(size + size / 16 + 66);
+
+	Block block;
+	block.mStartTime = startTime;
+	block.mEndTime = endTime;
+	block.mOffset = mOffset;
+	block.mSize = (uint32_t)fastlz_compress(raw.data(), size, &mCompressed[0]);
+	block.mRawSize = (uint32_t)size;
+	block.mNumEvents = numEvents;
+
+	Write(&mCompressed[0], block.mSize);
+	return block;
+}
+
+void SessionRecordingWriter::FlushBlock()
+{
+	if (mBlock.empty())
+		return;
+
+	mBlocks.push_back(WriteBlock(mBlock, mPending.mStartTime, mPending.mEndTime, mPending.mNumEvents));
+	mBlock.clear();
+}
+
+void SessionRecordingWriter::WriteKeyframe(int64_t time)
+{
+	// the keyframe comes after every block it covers, so seeks replay from the block after it
+	FlushBlock();
+
+	std::string raw;
+	for (std::map< std::pair<std::string, std::string>, StateValue >::const_iterator it = mState.begin(); it != mState.end(); ++it)
+		AppendRecord(raw, it->second.mTime, it->second.mTypeIndex, it->second.mKeyType, it->first.first, it->first.second, it->second.mPayload);
+
+	Keyframe keyframe;
+	keyframe.mTime = time;
+	keyframe.mFirstBlock = (uint32_t)mBlocks.size();
+	keyframe.mBlock = WriteBlock(raw, time, time, (uint32_t)mState.size());
+	mKeyframes.push_back(keyframe);
+}
+
+void SessionRecordingWriter::AddEvent(int64_t time, const google::protobuf::Message& msg, Analytics::RedisKeyType keyType, const std::string& key, const std::string& field)
+{
+	if (mFile == NULL)
+		return;
+
+	if (mKeyframeInterval > 0 && time - mKeyframeTime >= mKeyframeInterval)
+	{
+		if (!mState.empty())
+			WriteKeyframe(time);
+		mKeyframeTime = time;
+	}
+
+	const std::pair<std::map<std::string, uint32_t>::iterator, bool> type = mTypeIndex.insert(std::make_pair(msg.GetTypeName(), (uint32_t)mTypeNames.size()));
+	if (type.second)
+		mTypeNames.push_back(msg.GetTypeName());
+	const uint32_t typeIndex = type.first->second;
+
+	msg.SerializeToString(&mPayload);
+
+	if (IsStateKeyType(keyType))
+	{
+		StateValue& value = mState[std::make_pair(key, field)];
+		value.mTime = time;
+		value.mTypeIndex = typeIndex;
+		value.mKeyType = keyType;
+		value.mPayload = mPayload;
+	}
+
+	if (mBlock.empty())
+	{
+		mPending.mStartTime = time;
+		mPending.mNumEvents = 0;
+	}
+
+	AppendRecord(mBlock, time, typeIndex, keyType, key, field, mPayload);
+	mPending.mEndTime = time;
+	++mPending.mNumEvents;
+
+	if (mBlock.size() >= mBlockSize)
+		FlushBlock();
+}
+
+bool SessionRecordingWriter::Close(std::string& error)
+{
+	if (mFile == NULL)
+	{
+		error = "no recording open";
+		return false;
+	}
+
+	FlushBlock();
+
+	std::string footer;
+	AppendString(footer, mSession);
+
+	AppendPod(footer, (uint32_t)mTypeNames.size());
+	for (size_t t = 0; t < mTypeNames.size(); ++t)
+		AppendString(footer, mTypeNames[t]);
+
+	AppendPod(footer, (uint32_t)mBlocks.size());
+	for (size_t b = 0; b < mBlocks.size(); ++b)
+		AppendBlock(footer, mBlocks[b]);
+
+	AppendPod(footer, (uint32_t)mKeyframes.size());
+	for (size_t k = 0; k < mKeyframes.size(); ++k)
+	{
+		AppendPod(footer, mKeyframes[k].mTime);
+		AppendPod(footer, mKeyframes[k].mFirstBlock);
+		AppendBlock(footer, mKeyframes[k].mBlock);
+	}
+
+	const uint64_t footerOffset = mOffset;
+	AppendPod(footer, footerOffset);
+	AppendPod(footer, RecordingFileMagic);
+	AppendPod(footer, RecordingFileVersion);
+	Write(footer.data(), footer.size());
+
+	if (fclose(mFile) != 0)
+		mFailed = true;
+	mFile = NULL;
+	mState.clear();
+
+	if (mFailed)
+	{
+		error = "failed to write " + mFilename;
+		return false;
+	}
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SessionRecordingReader::SessionRecordingReader()
+{
+}
+
+void SessionRecordingReader::Close()
+{
+	mFile.Close();
+	mSession.clear();
+	mTypes.clear();
+	mBlocks.clear();
+	mKeyframes.clear();
+}
+
+bool SessionRecordingReader::Open(const std::string& filename, std::string& error)
+{
+	Close();
+
+	if (!mFile.Open(filename, error))
+		return false;
+
+	mFilename = filename;
+
+	const uint8_t* data = mFile.GetData();
+	const uint64_t size = mFile.GetSize();
+
+	uint32_t header[2] = {};
+	uint64_t footerOffset = 0;
+	uint32_t trailer[2] = {};
+	if (size >= sizeof(header) + sizeof(footerOffset) + sizeof(trailer))
+	{
+		memcpy(header, data, sizeof(header));
+		memcpy(&footerOffset, data + size - sizeof(trailer) - sizeof(footerOffset), sizeof(footerOffset));
+		memcpy(trailer, data + size - sizeof(trailer), sizeof(trailer));
+	}
+
+	if (header[0] != RecordingFileMagic || trailer[0] != RecordingFileMagic || header[1] != RecordingFileVersion || trailer[1] != RecordingFileVersion || footerOffset >= size)
+	{
+		error = filename + " is not a session recording of version " + std::to_string(RecordingFileVersion);
+		Close();
+		return false;
+	}
+
+	RecordingCursor cursor = { data, size - sizeof(trailer) - sizeof(footerOffset), footerOffset };
+
+	bool ok = cursor.ReadString(mSession);
+
+	uint32_t numTypes = 0;
+	ok = ok && cursor.Read(numTypes);
+	for (uint32_t t = 0; ok && t < numTypes; ++t)
+	{
+		TypeInfo type;
+		ok = cursor.ReadString(type.mName);
+		type.mType = google::protobuf::DescriptorPool::generated_pool()->FindMessageTypeByName(type.mName);
+		mTypes.push_back(type);
+	}
+
+	uint32_t numBlocks = 0;
+	ok = ok && cursor.Read(numBlocks);
+	for (uint32_t b = 0; ok && b < numBlocks; ++b)
+	{
+		Block block;
+		ok = ReadBlockIndex(cursor, block) && IsBlockInFile(block, footerOffset);
+		mBlocks.push_back(block);
+	}
+
+	uint32_t numKeyframes = 0;
+	ok = ok && cursor.Read(numKeyframes);
+	for (uint32_t k = 0; ok && k < numKeyframes; ++k)
+	{
+		Keyframe keyframe;
+		ok = cursor.Read(keyframe.mTime) && cursor.Read(keyframe.mFirstBlock) && ReadBlockIndex(cursor, keyframe.mBlock) &&
+			keyframe.mFirstBlock <= numBlocks && IsBlockInFile(keyframe.mBlock, footerOffset);
+		mKeyframes.push_back(keyframe);
+	}
+
+	if (!ok)
+	{
+		error = filename + " has a broken footer";
+		Close();
+		return false;
+	}
+	return true;
+}
+
+int64_t SessionRecordingReader::GetStartTime() const
+{
+	return mBlocks.empty() ? 0 : mBlocks.front().mStartTime;
+}
+
+int64_t SessionRecordingReader::GetEndTime() const
+{
+	return mBlocks.empty() ? 0 : mBlocks.back().mEndTime;
+}
+
+bool SessionRecordingReader::ReadBlock(const Block& block, std::vector<char>& buffer, const EventCallback& fn, std::string& error) const
+{
+	buffer.resize(std::max<uint32_t>(block.mRawSize, 1));
+
+	if (fastlz_decompress(mFile.GetData() + block.mOffset, (int)block.mSize, &buffer[0], (int)block.mRawSize) != (int)block.mRawSize)
+	{
+		error = mFilename + ": the block at " + std::to_string(block.mOffset) + " doesn't decompress";
+		return false;
+	}
+
+	SessionRecordingEvent ev;
+
+	RecordingCursor cursor = { (const uint8_t*)&buffer[0], block.mRawSize, 0 };
+	while (cursor.mPos < cursor.mSize)
+	{
+		uint32_t typeIndex = 0;
+		uint8_t keyType = 0;
+		if (!cursor.Read(ev.mTime) || !cursor.Read(typeIndex) || !cursor.Read(keyType) ||
+			!cursor.ReadString(ev.mKey) || !cursor.ReadString(ev.mField) || !cursor.ReadString(ev.mPayload) || typeIndex >= mTypes.size())
+		{
+			error = mFilename + ": the block at " + std::to_string(block.mOffset) + " has a broken record";
+			return false;
+		}
+
+		ev.mType = mTypes[typeIndex].mType;
+		ev.mTypeName = mTypes[typeIndex].mName;
+		ev.mKeyType = (Analytics::RedisKeyType)keyType;
+		fn(ev);
+	}
+	return true;
+}
+
+size_t SessionRecordingReader::FindBlock(int64_t time) const
+{
+	size_t lo = 0, hi = mBlocks.size();
+	while (lo < hi)
+	{
+		const size_t mid = (lo + hi) / 2;
+		if (mBlocks[mid].mEndTime < time)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+bool SessionRecordingReader::Seek(int64_t time, SessionRecordingState& state, std::string& error) const
+{
+	state.mValues.clear();
+	state.mTime = time;
+
+	// the last keyframe at or before the time
+	size_t keyframe = mKeyframes.size();
+	{
+		size_t lo = 0, hi = mKeyframes.size();
+		while (lo < hi)
+		{
+			const size_t mid = (lo + hi) / 2;
+			if (mKeyframes[mid].mTime <= time)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		if (lo > 0)
+			keyframe = lo - 1;
+	}
+
+	std::vector<char> buffer;
+	size_t firstBlock = 0;
+	if (keyframe < mKeyframes.size())
+	{
+		if (!ReadBlock(mKeyframes[keyframe].mBlock, buffer, [&state](const SessionRecordingEvent& ev) { state.Apply(ev); }, error))
+			return false;
+		firstBlock = mKeyframes[keyframe].mFirstBlock;
+	}
+
+	// the tail, the blocks between the keyframe and the time
+	for (size_t b = firstBlock; b < mBlocks.size() && mBlocks[b].mStartTime <= time; ++b)
+	{
+		const bool ok = ReadBlock(mBlocks[b], buffer, [&state, time](const SessionRecordingEvent& ev)
+		{
+			if (ev.mTime <= time)
+				state.Apply(ev);
+		}, error);
+
+		if (!ok)
+			return false;
+	}
+	return true;
+}
+
+bool SessionRecordingReader::ReadEvents(int64_t startTime, int64_t endTime, const EventCallback& fn, std::string& error) const
+{
+	std::vector<char> buffer;
+	for (size_t b = FindBlock(startTime); b < mBlocks.size() && mBlocks[b].mStartTime < endTime; ++b)
+	{
+		const bool ok = ReadBlock(mBlocks[b], buffer, [&fn, startTime, endTime](const SessionRecordingEvent& ev)
+		{
+			if (ev.mTime >= startTime && ev.mTime < endTime)
+				fn(ev);
+		}, error);
+
+		if (!ok)
+			return false;
+	}
+	return true;
+}
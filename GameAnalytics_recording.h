@@ -0,0 +1,183 @@
+#ifndef GAMEANALYTICS_RECORDING_H
+#define GAMEANALYTICS_RECORDING_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <utility>
+#include <functional>
+
+#include "analytics.pb.h"
+#include "GameAnalytics_mmap.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// an event of a recording, the message serialized as is, without the quantizing or interning of the wire encoding
+struct SessionRecordingEvent
+{
+	// milliseconds since the session started
+	int64_t									mTime;
+	// NULL for a type this build doesn't have
+	const google::protobuf::Descriptor*		mType;
+	std::string								mTypeName;
+	Analytics::RedisKeyType					mKeyType;
+	// the key of the event within the session, <TypeName>:<suffix> like redis has it, and the hash field of a HMSET
+	std::string								mKey;
+	std::string								mField;
+	std::string								mPayload;
+
+	SessionRecordingEvent();
+
+	// a new message of the type parsed from the payload, NULL when the type is unknown or the payload doesn't parse
+	google::protobuf::Message* ParseMessage() const;
+};
+
+// the world state of a recording at a time, the last value of each SET key and HMSET field
+struct SessionRecordingState
+{
+	int64_t		mTime;
+	std::map< std::pair<std::string, std::string>, SessionRecordingEvent > mValues;
+
+	SessionRecordingState() : mTime(0) {}
+
+	void Apply(const SessionRecordingEvent& ev);
+};
+
+// Writes a session to a seekable file as it runs. The events go into blocks in time order, each compressed with
+// FastLZ once it holds about blockSize bytes, and the block index keeps the time range of each. Every keyframe
+// interval the state the HMSET and SET events built up, the entities, nodes and enums of the session, goes into a
+// keyframe of its own, so a reader seeks by loading one keyframe and replaying the blocks after it.
+//
+// file: 'GASR' and version, the event and keyframe blocks, the footer with the session, the type names, the
+// block and keyframe indexes, the footer offset and 'GASR' and version again. a block is records of the time, the
+// type index, the key type, the key, the field and the payload
+class SessionRecordingWriter
+{
+public:
+	enum { DefaultBlockSize = 64 * 1024 };
+	enum { DefaultKeyframeInterval = 10000 };
+
+	SessionRecordingWriter();
+	~SessionRecordingWriter();
+
+	bool Open(const std::string& filename, const std::string& session, int64_t keyframeInterval, uint32_t blockSize, std::string& error);
+	bool IsOpen() const { return mFile != NULL; }
+	// times are expected to never decrease
+	void AddEvent(int64_t time, const google::protobuf::Message& msg, Analytics::RedisKeyType keyType, const std::string& key, const std::string& field);
+	bool Close(std::string& error);
+private:
+	struct Block
+	{
+		int64_t		mStartTime;
+		int64_t		mEndTime;
+		uint64_t	mOffset;
+		uint32_t	mSize;
+		uint32_t	mRawSize;
+		uint32_t	mNumEvents;
+	};
+
+	struct Keyframe
+	{
+		int64_t		mTime;
+		// the first event block after the keyframe
+		uint32_t	mFirstBlock;
+		Block		mBlock;
+	};
+
+	struct StateValue
+	{
+		int64_t					mTime;
+		uint32_t				mTypeIndex;
+		Analytics::RedisKeyType	mKeyType;
+		std::string				mPayload;
+	};
+
+	FILE *							mFile;
+	std::string						mFilename;
+	std::string						mSession;
+	int64_t							mKeyframeInterval;
+	uint32_t						mBlockSize;
+	uint64_t						mOffset;
+	bool							mFailed;
+
+	std::vector<std::string>		mTypeNames;
+	std::map<std::string, uint32_t>	mTypeIndex;
+
+	std::vector<Block>				mBlocks;
+	std::vector<Keyframe>			mKeyframes;
+	int64_t							mKeyframeTime;
+
+	std::map< std::pair<std::string, std::string>, StateValue > mState;
+
+	std::string						mBlock;
+	Block							mPending;
+	std::string						mPayload;
+	std::vector<char>				mCompressed;
+
+	void AppendRecord(std::string& buffer, int64_t time, uint32_t typeIndex, Analytics::RedisKeyType keyType, const std::string& key, const std::string& field, const std::string& payload);
+	void FlushBlock();
+	void WriteKeyframe(int64_t time);
+	Block WriteBlock(const std::string& raw, int64_t startTime, int64_t endTime, uint32_t numEvents);
+	bool Write(const void* data, size_t size);
+};
+
+class SessionRecordingReader
+{
+public:
+	typedef std::function<void(const SessionRecordingEvent&)> EventCallback;
+
+	SessionRecordingReader();
+
+	bool Open(const std::string& filename, std::string& error);
+	void Close();
+
+	bool IsOpen() const { return mFile.IsOpen(); }
+	const std::string& GetSession() const { return mSession; }
+	int64_t GetStartTime() const;
+	int64_t GetEndTime() const;
+	size_t GetNumBlocks() const { return mBlocks.size(); }
+	size_t GetNumKeyframes() const { return mKeyframes.size(); }
+
+	// the state at a time, the nearest keyframe before it with the SET and HMSET events up to the time applied
+	bool Seek(int64_t time, SessionRecordingState& state, std::string& error) const;
+	// the events from startTime up to and not including endTime in order, only the blocks overlapping the range are read
+	bool ReadEvents(int64_t startTime, int64_t endTime, const EventCallback& fn, std::string& error) const;
+private:
+	struct Block
+	{
+		int64_t		mStartTime;
+		int64_t		mEndTime;
+		uint64_t	mOffset;
+		uint32_t	mSize;
+		uint32_t	mRawSize;
+		uint32_t	mNumEvents;
+	};
+
+	struct Keyframe
+	{
+		int64_t		mTime;
+		uint32_t	mFirstBlock;
+		Block		mBlock;
+	};
+
+	struct TypeInfo
+	{
+		std::string							mName;
+		const google::protobuf::Descriptor*	mType;
+	};
+
+	MappedFile				mFile;
+	std::string				mFilename;
+	std::string				mSession;
+	std::vector<TypeInfo>	mTypes;
+	std::vector<Block>		mBlocks;
+	std::vector<Keyframe>	mKeyframes;
+
+	bool ReadBlock(const Block& block, std::vector<char>& buffer, const EventCallback& fn, std::string& error) const;
+	// the first block that ends at or after the time
+	size_t FindBlock(int64_t time) const;
+};
+
+#endif
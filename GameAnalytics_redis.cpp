@@ -23,7 +23,7 @@ Json::Value ConstructJsonFromMessage(const google::protobuf::Message & msg, cons
 	{
 	case google::protobuf::FieldDescriptor::TYPE_DOUBLE:
 	{
-		const double val = msg.GetReflection()->GetBool(msg, fdesc);
+		const double val = msg.GetReflection()->GetDouble(msg, fdesc);
 		return Json::Value(val);
 	}
 	case google::protobuf::FieldDescriptor::TYPE_FLOAT:
@@ -139,10 +139,31 @@ bool GameAnalytics::OpenRedisConnection(const char *ipAddress, int port)
 		mKeySpacePrefix = vaAnalytics("eventStream_%d.%d.%d-%d.%d.%d",
 			utc->tm_mday, utc->tm_mon, utc->tm_year, utc->tm_hour, utc->tm_min, utc->tm_sec);
 
+		if (mCompactKeys)
+		{
+			// a short numeric session id, the dated name is kept in a lookup hash
+			std::future<cpp_redis::reply> sessionId = mClient->incr("event_stream_id");
+			mClient->sync_commit();
+
+			const std::string sessionName = mKeySpacePrefix;
+			mKeySpacePrefix = "s:" + std::to_string(sessionId.get().as_integer());
+			mClient->hset("event_stream_names", mKeySpacePrefix, sessionName);
+		}
+
+		// a recording opened before the connection already has events on the session clock, which must not go back
+		if (!mRecording.IsOpen())
+			mSessionStart = std::chrono::steady_clock::now();
+		mSendStrings.Clear();
+		mParseStrings.Clear();
+		mSendTypes.Clear();
+		mParseTypes.Clear();
+		mParseSessionPrefix = mKeySpacePrefix;
+
 		// start the new stream
 		std::vector<std::string> values;
 		values.push_back(mKeySpacePrefix);
 		mClient->rpush("event_streams", values);
+		StartSessionCatalog();
 
 		const char* cachedSET = "local l = redis.call('SET', KEYS[1], ARGV[1]) \
 		local pubresult = redis.call('PUBLISH', KEYS[1], ARGV[1]) \
@@ -156,6 +177,12 @@ bool GameAnalytics::OpenRedisConnection(const char *ipAddress, int port)
 		local pubresult = redis.call('PUBLISH', KEYS[1] .. '~' .. ARGV[1], ARGV[2]) \
 		return l";
 
+		// ARGV[1] counts the field/count pairs that follow, the field/sum pairs come after them
+		const char* cachedROLLUP = "local n = tonumber(ARGV[1]) \
+		for i = 2, n * 2, 2 do redis.call('HINCRBY', KEYS[1], ARGV[i], ARGV[i + 1]) end \
+		for i = n * 2 + 2, #ARGV, 2 do redis.call('HINCRBYFLOAT', KEYS[1], ARGV[i], ARGV[i + 1]) end \
+		return n";
+
 		mClient->script_load(cachedSET, [&](cpp_redis::reply& reply) {
 			std::cout << reply << std::endl;
 			mScriptSHA_SET = reply.as_string();
@@ -171,6 +198,11 @@ bool GameAnalytics::OpenRedisConnection(const char *ipAddress, int port)
 			mScriptSHA_HMSET = reply.as_string();
 		});
 
+		mClient->script_load(cachedROLLUP, [&](cpp_redis::reply& reply) {
+			std::cout << reply << std::endl;
+			mScriptSHA_ROLLUP = reply.as_string();
+		});
+
 		// we want to wait until we have hashes for all the script snippets
 		// because that's what we are going to use for sending data to redis
 		// so that it will both cache that data and also publish it out
@@ -0,0 +1,194 @@
+#include "GameAnalytics_rollup.h"
+
+#include <cstdlib>
+#include <algorithm>
+
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+bool StringFromField(std::string & strOut, const google::protobuf::Message & msg, const google::protobuf::FieldDescriptor* fdesc);
+
+//////////////////////////////////////////////////////////////////////////
+
+EventRollup::EventRollup()
+	: mBucketSize(0)
+{
+}
+
+void EventRollup::SetBucketSize(int64_t bucketSize)
+{
+	// pending increments belong to buckets of the old size
+	mPending.clear();
+	mBucketSize = std::max<int64_t>(bucketSize, 0);
+}
+
+const EventRollup::Layout& EventRollup::GetLayout(const google::protobuf::Descriptor* desc) const
+{
+	LayoutCache::iterator it = mLayoutCache.find(desc);
+	if (it != mLayoutCache.end())
+		return it->second;
+
+	Layout& layout = mLayoutCache[desc];
+	for (int i = 0; i < desc->field_count(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* fdesc = desc->field(i);
+		if (fdesc->is_repeated())
+			continue;
+
+		if (fdesc->options().GetExtension(Analytics::track_event) && fdesc->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
+			layout.mDimensions.push_back(fdesc);
+
+		// weights naming a field are summed, constant ones only scale the count
+		std::string weight;
+		if (fdesc->options().HasExtension(Analytics::point_event))
+			weight = fdesc->options().GetExtension(Analytics::point_event).weight();
+		else if (fdesc->options().HasExtension(Analytics::line_event))
+			weight = fdesc->options().GetExtension(Analytics::line_event).weight();
+
+		const google::protobuf::FieldDescriptor* weightField = weight.empty() ? NULL : desc->FindFieldByName(weight);
+		if (weightField == NULL || std::find(layout.mWeightFields.begin(), layout.mWeightFields.end(), weightField) != layout.mWeightFields.end())
+			continue;
+
+		HeatmapAnnotationValue value;
+		if (value.Init(desc, weight, 0.0f))
+		{
+			layout.mWeightFields.push_back(weightField);
+			layout.mWeights.push_back(value);
+		}
+	}
+	return layout;
+}
+
+bool EventRollup::HasDimensions(const google::protobuf::Descriptor* desc) const
+{
+	return !GetLayout(desc).mDimensions.empty();
+}
+
+void EventRollup::AddEvent(const google::protobuf::Message& msg, int64_t timeStamp)
+{
+	if (mBucketSize <= 0)
+		return;
+
+	const Layout& layout = GetLayout(msg.GetDescriptor());
+	if (layout.mDimensions.empty())
+		return;
+
+	mCellKey.clear();
+	std::string value;
+	for (size_t i = 0; i < layout.mDimensions.size(); ++i)
+	{
+		value.clear();
+		StringFromField(value, msg, layout.mDimensions[i]);
+		std::replace(value.begin(), value.end(), '|', '/');
+
+		mCellKey += '|';
+		mCellKey += value;
+	}
+
+	const int64_t startTime = timeStamp - ((timeStamp % mBucketSize) + mBucketSize) % mBucketSize;
+	CellMap& cells = mPending[std::make_pair(msg.GetDescriptor(), startTime)];
+
+	std::pair<CellMap::iterator, bool> it = cells.insert(std::make_pair(mCellKey, Pending()));
+	Pending& cell = it.first->second;
+	if (it.second)
+	{
+		cell.mCount = 0;
+		cell.mSums.assign(layout.mWeights.size(), 0.0);
+	}
+
+	++cell.mCount;
+	for (size_t w = 0; w < layout.mWeights.size(); ++w)
+		cell.mSums[w] += layout.mWeights[w].Read(msg);
+}
+
+void EventRollup::Flush(std::vector<Increment>& increments)
+{
+	increments.clear();
+	for (BucketMap::const_iterator bucket = mPending.begin(); bucket != mPending.end(); ++bucket)
+	{
+		const Layout& layout = GetLayout(bucket->first.first);
+
+		Increment inc;
+		inc.mType = bucket->first.first;
+		inc.mStartTime = bucket->first.second;
+		for (CellMap::const_iterator cell = bucket->second.begin(); cell != bucket->second.end(); ++cell)
+		{
+			inc.mCounts.push_back(std::make_pair("c" + cell->first, cell->second.mCount));
+			for (size_t w = 0; w < layout.mWeightFields.size(); ++w)
+			{
+				if (cell->second.mSums[w] != 0.0)
+					inc.mSums.push_back(std::make_pair("s:" + layout.mWeightFields[w]->name() + cell->first, cell->second.mSums[w]));
+			}
+		}
+		increments.push_back(inc);
+	}
+	mPending.clear();
+}
+
+bool EventRollup::Merge(const EventRollup& other)
+{
+	if (other.mBucketSize != mBucketSize)
+		return false;
+
+	for (BucketMap::const_iterator bucket = other.mPending.begin(); bucket != other.mPending.end(); ++bucket)
+	{
+		CellMap& cells = mPending[bucket->first];
+		for (CellMap::const_iterator cell = bucket->second.begin(); cell != bucket->second.end(); ++cell)
+		{
+			std::pair<CellMap::iterator, bool> it = cells.insert(*cell);
+			if (it.second)
+				continue;
+
+			// the layout is per type, so the sums line up
+			Pending& dst = it.first->second;
+			dst.mCount += cell->second.mCount;
+			for (size_t w = 0; w < dst.mSums.size() && w < cell->second.mSums.size(); ++w)
+				dst.mSums[w] += cell->second.mSums[w];
+		}
+	}
+	return true;
+}
+
+void EventRollup::ParseBucket(const std::vector< std::pair<std::string, std::string> >& hash, RollupBucket& bucket)
+{
+	bucket.mCells.clear();
+
+	std::map<std::string, size_t> cellIndex;
+	for (size_t i = 0; i < hash.size(); ++i)
+	{
+		const std::string& field = hash[i].first;
+		const size_t split = field.find('|');
+		if (split == std::string::npos)
+			continue;
+
+		const std::string header = field.substr(0, split);
+		const std::string cellKey = field.substr(split);
+
+		std::pair<std::map<std::string, size_t>::iterator, bool> it = cellIndex.insert(std::make_pair(cellKey, bucket.mCells.size()));
+		if (it.second)
+		{
+			RollupCell cell;
+			for (size_t start = 1; start <= cellKey.size();)
+			{
+				size_t end = cellKey.find('|', start);
+				if (end == std::string::npos)
+					end = cellKey.size();
+				cell.mDimensions.push_back(cellKey.substr(start, end - start));
+				start = end + 1;
+			}
+			bucket.mCells.push_back(cell);
+		}
+
+		RollupCell& cell = bucket.mCells[it.first->second];
+		if (header == "c")
+			cell.mCount += strtoll(hash[i].second.c_str(), NULL, 10);
+		else if (header.compare(0, 2, "s:") == 0)
+			cell.mSums[header.substr(2)] += strtod(hash[i].second.c_str(), NULL);
+	}
+
+	std::sort(bucket.mCells.begin(), bucket.mCells.end(), [](const RollupCell& a, const RollupCell& b)
+	{
+		return a.mDimensions < b.mDimensions;
+	});
+}
@@ -0,0 +1,102 @@
+#ifndef GAMEANALYTICS_ROLLUP_H
+#define GAMEANALYTICS_ROLLUP_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+
+#include "analytics.pb.h"
+#include "GameAnalytics_heatmap.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// the events of a type in a bucket with one combination of (track_event) values
+struct RollupCell
+{
+	// the values in field order, as text
+	std::vector<std::string>		mDimensions;
+	int64_t							mCount;
+	// the sums of the weight fields, by field name
+	std::map<std::string, double>	mSums;
+
+	RollupCell() : mCount(0) {}
+};
+
+struct RollupBucket
+{
+	int64_t					mStartTime;
+	std::vector<RollupCell>	mCells;
+
+	RollupBucket() : mStartTime(0) {}
+};
+
+// Counts of the events of each type per combination of its (track_event) field values in fixed time buckets,
+// with the sums of the fields its (point_event) or (line_event) annotations weight it by. The events between
+// flushes are accumulated here and go out as one increment per field and bucket, so the rollups of a session
+// cost a script call per bucket and flush however many events there are. Types without (track_event) fields
+// aren't rolled up.
+//
+// Each bucket is a hash of fields "c|<dim>|<dim>..." holding counts and "s:<weight field>|<dim>|<dim>..." holding sums,
+// '|' inside string values is replaced by '/'.
+class EventRollup
+{
+public:
+	// the increments of a bucket since the last flush, HINCRBY for counts and HINCRBYFLOAT for sums
+	struct Increment
+	{
+		const google::protobuf::Descriptor*	mType;
+		int64_t								mStartTime;
+		std::vector< std::pair<std::string, int64_t> >	mCounts;
+		std::vector< std::pair<std::string, double> >	mSums;
+	};
+
+	EventRollup();
+
+	// milliseconds, 0 disables
+	void SetBucketSize(int64_t bucketSize);
+	int64_t GetBucketSize() const { return mBucketSize; }
+	bool IsEnabled() const { return mBucketSize > 0; }
+
+	bool HasDimensions(const google::protobuf::Descriptor* desc) const;
+
+	void AddEvent(const google::protobuf::Message& msg, int64_t timeStamp);
+
+	bool HasPending() const { return !mPending.empty(); }
+	// hands out the increments since the last flush, in type and time order
+	void Flush(std::vector<Increment>& increments);
+
+	// adds the pending cells of another rollup, like the partial of a worker. false when the bucket sizes differ
+	bool Merge(const EventRollup& other);
+
+	// the cells of a bucket hash read back as field, value pairs
+	static void ParseBucket(const std::vector< std::pair<std::string, std::string> >& hash, RollupBucket& bucket);
+private:
+	struct Layout
+	{
+		std::vector<const google::protobuf::FieldDescriptor*>	mDimensions;
+		std::vector<const google::protobuf::FieldDescriptor*>	mWeightFields;
+		std::vector<HeatmapAnnotationValue>						mWeights;
+	};
+
+	struct Pending
+	{
+		int64_t				mCount;
+		std::vector<double>	mSums;
+	};
+
+	typedef std::map<std::string, Pending> CellMap;
+	typedef std::map< std::pair<const google::protobuf::Descriptor*, int64_t>, CellMap > BucketMap;
+
+	int64_t				mBucketSize;
+	BucketMap			mPending;
+	std::string			mCellKey;
+
+	typedef std::map<const google::protobuf::Descriptor*, Layout> LayoutCache;
+	mutable LayoutCache	mLayoutCache;
+
+	const Layout& GetLayout(const google::protobuf::Descriptor* desc) const;
+};
+
+#endif
@@ -0,0 +1,830 @@
+#include "GameAnalytics_sketch.h"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+bool StringFromField(std::string & strOut, const google::protobuf::Message & msg, const google::protobuf::FieldDescriptor* fdesc);
+
+// the tag byte of each serialized sketch and their layout version
+enum SketchTag
+{
+	SketchTag_HyperLogLog = 'H',
+	SketchTag_CountMinTopK = 'K',
+	SketchTag_TDigest = 'T',
+};
+
+static const uint8_t SketchVersion = 1;
+
+template<typename T>
+static void AppendPod(std::string& out, const T& value)
+{
+	out.append((const char*)&value, sizeof(value));
+}
+
+template<typename T>
+static bool ReadPod(const std::string& data, size_t& pos, T& value)
+{
+	if (pos > data.size() || data.size() - pos < sizeof(value))
+		return false;
+	memcpy(&value, data.data() + pos, sizeof(value));
+	pos += sizeof(value);
+	return true;
+}
+
+static bool ReadHeader(const std::string& data, size_t& pos, SketchTag tag)
+{
+	uint8_t header[2];
+	return ReadPod(data, pos, header) && header[0] == (uint8_t)tag && header[1] == SketchVersion;
+}
+
+static void AppendHeader(std::string& out, SketchTag tag)
+{
+	const uint8_t header[2] = { (uint8_t)tag, SketchVersion };
+	AppendPod(out, header);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+uint64_t SketchHash(uint64_t value)
+{
+	// the murmur3 finalizer
+	value ^= value >> 33;
+	value *= 0xff51afd7ed558ccdull;
+	value ^= value >> 33;
+	value *= 0xc4ceb9fe1a85ec53ull;
+	value ^= value >> 33;
+	return value;
+}
+
+uint64_t SketchHash(const std::string& value)
+{
+	uint64_t hash = 1469598103934665603ull;
+	for (size_t i = 0; i < value.size(); ++i)
+		hash = (hash ^ (uint8_t)value[i]) * 1099511628211ull;
+	return SketchHash(hash);
+}
+
+static inline int CountLeadingZeros64(uint64_t v)
+{
+#if defined(__GNUC__)
+	return v != 0 ? __builtin_clzll(v) : 64;
+#else
+	int n = 0;
+	for (uint64_t bit = 1ull << 63; bit != 0 && (v & bit) == 0; bit >>= 1)
+		++n;
+	return n;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+HyperLogLog::HyperLogLog(int precision)
+	: mPrecision(std::min(std::max(precision, (int)MinPrecision), (int)MaxPrecision))
+	, mRegisters((size_t)1 << mPrecision, 0)
+{
+}
+
+void HyperLogLog::Clear()
+{
+	std::fill(mRegisters.begin(), mRegisters.end(), 0);
+}
+
+void HyperLogLog::Add(uint64_t hash)
+{
+	// the top bits pick the register, the rank of the first set bit of the rest goes into it
+	const size_t index = (size_t)(hash >> (64 - mPrecision));
+	const uint64_t rest = (hash << mPrecision) | ((uint64_t)1 << (mPrecision - 1));
+	const uint8_t rank = (uint8_t)(CountLeadingZeros64(rest) + 1);
+	if (rank > mRegisters[index])
+		mRegisters[index] = rank;
+}
+
+double HyperLogLog::Estimate() const
+{
+	const double m = (double)mRegisters.size();
+
+	double sum = 0.0;
+	size_t zeros = 0;
+	for (size_t i = 0; i < mRegisters.size(); ++i)
+	{
+		sum += ldexp(1.0, -mRegisters[i]);
+		zeros += mRegisters[i] == 0 ? 1 : 0;
+	}
+
+	double alpha = 0.7213 / (1.0 + 1.079 / m);
+	if (mRegisters.size() == 16)
+		alpha = 0.673;
+	else if (mRegisters.size() == 32)
+		alpha = 0.697;
+	else if (mRegisters.size() == 64)
+		alpha = 0.709;
+
+	// linear counting while many registers are empty
+	const double estimate = alpha * m * m / sum;
+	if (estimate <= 2.5 * m && zeros > 0)
+		return m * log(m / (double)zeros);
+	return estimate;
+}
+
+bool HyperLogLog::Merge(const HyperLogLog& other)
+{
+	if (other.mPrecision != mPrecision)
+		return false;
+
+	for (size_t i = 0; i < mRegisters.size(); ++i)
+		mRegisters[i] = std::max(mRegisters[i], other.mRegisters[i]);
+	return true;
+}
+
+void HyperLogLog::Serialize(std::string& out) const
+{
+	AppendHeader(out, SketchTag_HyperLogLog);
+	AppendPod(out, (uint8_t)mPrecision);
+	out.append((const char*)mRegisters.data(), mRegisters.size());
+}
+
+bool HyperLogLog::Deserialize(const std::string& data)
+{
+	size_t pos = 0;
+	uint8_t precision = 0;
+	if (!ReadHeader(data, pos, SketchTag_HyperLogLog) || !ReadPod(data, pos, precision) ||
+		precision < MinPrecision || precision > MaxPrecision || data.size() - pos != ((size_t)1 << precision))
+		return false;
+
+	mPrecision = precision;
+	mRegisters.assign((const uint8_t*)data.data() + pos, (const uint8_t*)data.data() + data.size());
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+CountMinTopK::CountMinTopK(int width, int depth, int k)
+	: mWidth(std::max(width, 1))
+	, mDepth(std::max(depth, 1))
+	, mK(std::max(k, 1))
+	, mTotal(0)
+	, mCounts((size_t)mWidth * mDepth, 0)
+{
+}
+
+void CountMinTopK::Clear()
+{
+	mTotal = 0;
+	std::fill(mCounts.begin(), mCounts.end(), 0);
+	mHeap.clear();
+	mHeapIndex.clear();
+}
+
+uint64_t CountMinTopK::AddCounts(uint64_t hash, uint64_t count)
+{
+	// the rows index by h1 + i * h2 of the two halves of the hash
+	const uint32_t h1 = (uint32_t)hash, h2 = (uint32_t)(hash >> 32) | 1;
+	uint64_t estimate = UINT64_MAX;
+	for (int row = 0; row < mDepth; ++row)
+	{
+		uint64_t& counter = mCounts[(size_t)row * mWidth + (h1 + (uint32_t)row * h2) % (uint32_t)mWidth];
+		counter += count;
+		estimate = std::min(estimate, counter);
+	}
+	return estimate;
+}
+
+uint64_t CountMinTopK::EstimateHash(uint64_t hash) const
+{
+	const uint32_t h1 = (uint32_t)hash, h2 = (uint32_t)(hash >> 32) | 1;
+	uint64_t estimate = UINT64_MAX;
+	for (int row = 0; row < mDepth; ++row)
+		estimate = std::min(estimate, mCounts[(size_t)row * mWidth + (h1 + (uint32_t)row * h2) % (uint32_t)mWidth]);
+	return estimate;
+}
+
+void CountMinTopK::Add(const std::string& key, uint64_t count)
+{
+	mTotal += count;
+	Offer(key, AddCounts(SketchHash(key), count));
+}
+
+uint64_t CountMinTopK::Estimate(const std::string& key) const
+{
+	return EstimateHash(SketchHash(key));
+}
+
+void CountMinTopK::SwapHeap(size_t a, size_t b)
+{
+	std::swap(mHeap[a], mHeap[b]);
+	mHeapIndex[mHeap[a].second] = a;
+	mHeapIndex[mHeap[b].second] = b;
+}
+
+void CountMinTopK::SiftUp(size_t slot)
+{
+	while (slot > 0 && mHeap[slot].first < mHeap[(slot - 1) / 2].first)
+	{
+		SwapHeap(slot, (slot - 1) / 2);
+		slot = (slot - 1) / 2;
+	}
+}
+
+void CountMinTopK::SiftDown(size_t slot)
+{
+	for (;;)
+	{
+		size_t smallest = slot;
+		const size_t left = slot * 2 + 1, right = slot * 2 + 2;
+		if (left < mHeap.size() && mHeap[left].first < mHeap[smallest].first)
+			smallest = left;
+		if (right < mHeap.size() && mHeap[right].first < mHeap[smallest].first)
+			smallest = right;
+		if (smallest == slot)
+			return;
+		SwapHeap(slot, smallest);
+		slot = smallest;
+	}
+}
+
+void CountMinTopK::Offer(const std::string& key, uint64_t estimate)
+{
+	// estimates only grow, so a candidate only moves down the min heap
+	std::unordered_map<std::string, size_t>::iterator it = mHeapIndex.find(key);
+	if (it != mHeapIndex.end())
+	{
+		mHeap[it->second].first = estimate;
+		SiftDown(it->second);
+		return;
+	}
+
+	if (mHeap.size() < (size_t)mK)
+	{
+		mHeap.push_back(std::make_pair(estimate, key));
+		mHeapIndex[key] = mHeap.size() - 1;
+		SiftUp(mHeap.size() - 1);
+	}
+	else if (estimate > mHeap[0].first)
+	{
+		mHeapIndex.erase(mHeap[0].second);
+		mHeap[0] = std::make_pair(estimate, key);
+		mHeapIndex[key] = 0;
+		SiftDown(0);
+	}
+}
+
+void CountMinTopK::GetTopK(std::vector< std::pair<std::string, uint64_t> >& keys) const
+{
+	keys.clear();
+	for (size_t i = 0; i < mHeap.size(); ++i)
+		keys.push_back(std::make_pair(mHeap[i].second, mHeap[i].first));
+
+	std::sort(keys.begin(), keys.end(), [](const std::pair<std::string, uint64_t>& a, const std::pair<std::string, uint64_t>& b)
+	{
+		return a.second != b.second ? a.second > b.second : a.first < b.first;
+	});
+}
+
+bool CountMinTopK::Merge(const CountMinTopK& other)
+{
+	if (other.mWidth != mWidth || other.mDepth != mDepth)
+		return false;
+
+	for (size_t i = 0; i < mCounts.size(); ++i)
+		mCounts[i] += other.mCounts[i];
+	mTotal += other.mTotal;
+
+	std::vector<std::string> candidates;
+	for (size_t i = 0; i < mHeap.size(); ++i)
+		candidates.push_back(mHeap[i].second);
+	for (size_t i = 0; i < other.mHeap.size(); ++i)
+	{
+		if (mHeapIndex.find(other.mHeap[i].second) == mHeapIndex.end())
+			candidates.push_back(other.mHeap[i].second);
+	}
+
+	mHeap.clear();
+	mHeapIndex.clear();
+	for (size_t i = 0; i < candidates.size(); ++i)
+		Offer(candidates[i], Estimate(candidates[i]));
+	return true;
+}
+
+void CountMinTopK::Serialize(std::string& out) const
+{
+	AppendHeader(out, SketchTag_CountMinTopK);
+	AppendPod(out, (uint32_t)mWidth);
+	AppendPod(out, (uint32_t)mDepth);
+	AppendPod(out, (uint32_t)mK);
+	AppendPod(out, mTotal);
+	out.append((const char*)mCounts.data(), mCounts.size() * sizeof(uint64_t));
+
+	AppendPod(out, (uint32_t)mHeap.size());
+	for (size_t i = 0; i < mHeap.size(); ++i)
+	{
+		AppendPod(out, (uint32_t)mHeap[i].second.size());
+		out.append(mHeap[i].second);
+	}
+}
+
+bool CountMinTopK::Deserialize(const std::string& data)
+{
+	size_t pos = 0;
+	uint32_t width = 0, depth = 0, k = 0, numKeys = 0;
+	uint64_t total = 0;
+	if (!ReadHeader(data, pos, SketchTag_CountMinTopK) || !ReadPod(data, pos, width) || !ReadPod(data, pos, depth) || !ReadPod(data, pos, k) ||
+		!ReadPod(data, pos, total) || width == 0 || depth == 0 || k == 0 || (data.size() - pos) / sizeof(uint64_t) / width < depth)
+		return false;
+
+	CountMinTopK sketch(width, depth, k);
+	sketch.mTotal = total;
+	memcpy(sketch.mCounts.data(), data.data() + pos, sketch.mCounts.size() * sizeof(uint64_t));
+	pos += sketch.mCounts.size() * sizeof(uint64_t);
+
+	// the candidates are ranked again from the counts
+	if (!ReadPod(data, pos, numKeys))
+		return false;
+	for (uint32_t i = 0; i < numKeys; ++i)
+	{
+		uint32_t length = 0;
+		if (!ReadPod(data, pos, length) || data.size() - pos < length)
+			return false;
+		const std::string key = data.substr(pos, length);
+		pos += length;
+		sketch.Offer(key, sketch.Estimate(key));
+	}
+
+	*this = sketch;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+TDigest::TDigest(double compression)
+	: mCompression(std::max(compression, 10.0))
+	, mMin(HUGE_VAL)
+	, mMax(-HUGE_VAL)
+	, mTotal(0.0)
+	, mBufferTotal(0.0)
+{
+}
+
+void TDigest::Clear()
+{
+	mMin = HUGE_VAL;
+	mMax = -HUGE_VAL;
+	mCentroids.clear();
+	mBuffer.clear();
+	mTotal = 0.0;
+	mBufferTotal = 0.0;
+}
+
+void TDigest::Add(double value, double weight)
+{
+	if (!(weight > 0.0) || value != value)
+		return;
+
+	Centroid c = { value, weight };
+	mBuffer.push_back(c);
+	mBufferTotal += weight;
+	mMin = std::min(mMin, value);
+	mMax = std::max(mMax, value);
+
+	if (mBuffer.size() >= (size_t)(mCompression * 5.0))
+		Compress();
+}
+
+void TDigest::Compress() const
+{
+	if (mBuffer.empty())
+		return;
+
+	const double pi = 3.14159265358979323846;
+	const double total = mTotal + mBufferTotal;
+
+	// the arcsine scale, k(q) = compression / 2pi * asin(2q - 1), a centroid spans at most one unit of k
+	const double scale = mCompression / (2.0 * pi);
+	auto kFromQ = [scale](double q) { return scale * asin(std::min(std::max(2.0 * q - 1.0, -1.0), 1.0)); };
+	auto qFromK = [scale, pi](double k) { return (sin(std::min(k / scale, pi / 2.0)) + 1.0) / 2.0; };
+
+	std::vector<Centroid> all;
+	all.reserve(mCentroids.size() + mBuffer.size());
+	all.insert(all.end(), mCentroids.begin(), mCentroids.end());
+	all.insert(all.end(), mBuffer.begin(), mBuffer.end());
+	std::sort(all.begin(), all.end(), [](const Centroid& a, const Centroid& b) { return a.mMean < b.mMean; });
+
+	mCentroids.clear();
+	Centroid current = all[0];
+	double soFar = 0.0;
+	double limit = total * qFromK(kFromQ(0.0) + 1.0);
+	for (size_t i = 1; i < all.size(); ++i)
+	{
+		if (soFar + current.mWeight + all[i].mWeight <= limit)
+		{
+			current.mWeight += all[i].mWeight;
+			current.mMean += (all[i].mMean - current.mMean) * all[i].mWeight / current.mWeight;
+		}
+		else
+		{
+			soFar += current.mWeight;
+			mCentroids.push_back(current);
+			limit = total * qFromK(kFromQ(soFar / total) + 1.0);
+			current = all[i];
+		}
+	}
+	mCentroids.push_back(current);
+
+	mBuffer.clear();
+	mTotal = total;
+	mBufferTotal = 0.0;
+}
+
+double TDigest::Quantile(double q) const
+{
+	Compress();
+	if (mCentroids.empty())
+		return NAN;
+
+	q = std::min(std::max(q, 0.0), 1.0);
+	if (mCentroids.size() == 1)
+		return mCentroids[0].mMean;
+
+	// linear between the centers of neighbouring centroids, and to the extremes from the half weights at the ends
+	const double index = q * mTotal;
+	const Centroid& first = mCentroids.front();
+	if (index < first.mWeight / 2.0)
+		return mMin + (first.mMean - mMin) * index / (first.mWeight / 2.0);
+
+	double cumulative = 0.0;
+	for (size_t i = 0; i + 1 < mCentroids.size(); ++i)
+	{
+		const double left = cumulative + mCentroids[i].mWeight / 2.0;
+		const double right = cumulative + mCentroids[i].mWeight + mCentroids[i + 1].mWeight / 2.0;
+		if (index < right)
+			return mCentroids[i].mMean + (mCentroids[i + 1].mMean - mCentroids[i].mMean) * (index - left) / (right - left);
+		cumulative += mCentroids[i].mWeight;
+	}
+
+	const Centroid& last = mCentroids.back();
+	const double lastCenter = mTotal - last.mWeight / 2.0;
+	return last.mMean + (mMax - last.mMean) * std::min((index - lastCenter) / (last.mWeight / 2.0), 1.0);
+}
+
+double TDigest::Cdf(double x) const
+{
+	Compress();
+	if (mCentroids.empty())
+		return NAN;
+	if (x < mMin)
+		return 0.0;
+	if (x >= mMax)
+		return 1.0;
+
+	const Centroid& first = mCentroids.front();
+	if (x < first.mMean)
+		return first.mMean > mMin ? (first.mWeight / 2.0) * (x - mMin) / (first.mMean - mMin) / mTotal : 0.0;
+
+	double cumulative = 0.0;
+	for (size_t i = 0; i + 1 < mCentroids.size(); ++i)
+	{
+		const double left = cumulative + mCentroids[i].mWeight / 2.0;
+		const double right = cumulative + mCentroids[i].mWeight + mCentroids[i + 1].mWeight / 2.0;
+		if (x < mCentroids[i + 1].mMean)
+		{
+			const double span = mCentroids[i + 1].mMean - mCentroids[i].mMean;
+			return (left + (right - left) * (span > 0.0 ? (x - mCentroids[i].mMean) / span : 0.0)) / mTotal;
+		}
+		cumulative += mCentroids[i].mWeight;
+	}
+
+	const Centroid& last = mCentroids.back();
+	const double lastCenter = mTotal - last.mWeight / 2.0;
+	return (lastCenter + (last.mWeight / 2.0) * (x - last.mMean) / (mMax - last.mMean)) / mTotal;
+}
+
+void TDigest::Merge(const TDigest& other)
+{
+	other.Compress();
+	if (other.mCentroids.empty())
+		return;
+
+	mBuffer.insert(mBuffer.end(), other.mCentroids.begin(), other.mCentroids.end());
+	mBufferTotal += other.mTotal;
+	mMin = std::min(mMin, other.mMin);
+	mMax = std::max(mMax, other.mMax);
+	Compress();
+}
+
+void TDigest::Serialize(std::string& out) const
+{
+	Compress();
+	AppendHeader(out, SketchTag_TDigest);
+	AppendPod(out, mCompression);
+	AppendPod(out, mMin);
+	AppendPod(out, mMax);
+	AppendPod(out, (uint32_t)mCentroids.size());
+	for (size_t i = 0; i < mCentroids.size(); ++i)
+	{
+		AppendPod(out, mCentroids[i].mMean);
+		AppendPod(out, mCentroids[i].mWeight);
+	}
+}
+
+bool TDigest::Deserialize(const std::string& data)
+{
+	size_t pos = 0;
+	double compression = 0.0, minValue = 0.0, maxValue = 0.0;
+	uint32_t count = 0;
+	if (!ReadHeader(data, pos, SketchTag_TDigest) || !ReadPod(data, pos, compression) || !ReadPod(data, pos, minValue) ||
+		!ReadPod(data, pos, maxValue) || !ReadPod(data, pos, count) || (data.size() - pos) / (2 * sizeof(double)) < count)
+		return false;
+
+	TDigest digest(compression);
+	digest.mMin = minValue;
+	digest.mMax = maxValue;
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		Centroid c;
+		ReadPod(data, pos, c.mMean);
+		ReadPod(data, pos, c.mWeight);
+		if (!(c.mWeight > 0.0))
+			return false;
+		digest.mCentroids.push_back(c);
+		digest.mTotal += c.mWeight;
+	}
+
+	*this = digest;
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+// distinct values hashed straight from the field, strings through their bytes
+static uint64_t HashField(const google::protobuf::Message& msg, const google::protobuf::FieldDescriptor* fdesc)
+{
+	const google::protobuf::Reflection* refl = msg.GetReflection();
+	switch (fdesc->cpp_type())
+	{
+	case google::protobuf::FieldDescriptor::CPPTYPE_INT32: return SketchHash((uint64_t)(int64_t)refl->GetInt32(msg, fdesc));
+	case google::protobuf::FieldDescriptor::CPPTYPE_INT64: return SketchHash((uint64_t)refl->GetInt64(msg, fdesc));
+	case google::protobuf::FieldDescriptor::CPPTYPE_UINT32: return SketchHash((uint64_t)refl->GetUInt32(msg, fdesc));
+	case google::protobuf::FieldDescriptor::CPPTYPE_UINT64: return SketchHash((uint64_t)refl->GetUInt64(msg, fdesc));
+	case google::protobuf::FieldDescriptor::CPPTYPE_BOOL: return SketchHash((uint64_t)refl->GetBool(msg, fdesc));
+	case google::protobuf::FieldDescriptor::CPPTYPE_ENUM: return SketchHash((uint64_t)(int64_t)refl->GetEnumValue(msg, fdesc));
+	case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+	{
+		const double value = refl->GetFloat(msg, fdesc);
+		uint64_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		return SketchHash(bits);
+	}
+	case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+	{
+		const double value = refl->GetDouble(msg, fdesc);
+		uint64_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		return SketchHash(bits);
+	}
+	case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+	{
+		std::string scratch;
+		return SketchHash(refl->GetStringReference(msg, fdesc, &scratch));
+	}
+	default:
+		return 0;
+	}
+}
+
+EventSketches::EventSketches()
+{
+}
+
+EventSketches::EventSketches(const EventSketches& other)
+	: mDistinct(other.mDistinct)
+	, mTopK(other.mTopK)
+	, mQuantiles(other.mQuantiles)
+{
+}
+
+EventSketches& EventSketches::operator=(const EventSketches& other)
+{
+	if (this != &other)
+	{
+		mLayouts.clear();
+		mDistinct = other.mDistinct;
+		mTopK = other.mTopK;
+		mQuantiles = other.mQuantiles;
+	}
+	return *this;
+}
+
+void EventSketches::Clear()
+{
+	mLayouts.clear();
+	mDistinct.clear();
+	mTopK.clear();
+	mQuantiles.clear();
+}
+
+bool EventSketches::Empty() const
+{
+	return mDistinct.empty() && mTopK.empty() && mQuantiles.empty();
+}
+
+const EventSketches::Layout& EventSketches::GetLayout(const google::protobuf::Descriptor* desc)
+{
+	std::map<const google::protobuf::Descriptor*, Layout>::iterator it = mLayouts.find(desc);
+	if (it != mLayouts.end())
+		return it->second;
+
+	Layout& layout = mLayouts[desc];
+	std::vector<const google::protobuf::FieldDescriptor*> quantileFields;
+
+	// the field the hash of the type is keyed by identifies its objects, like the entity of GameEntityInfo
+	if (desc->options().HasExtension(Analytics::redishmsetkey))
+	{
+		const google::protobuf::FieldDescriptor* fdesc = desc->FindFieldByName(desc->options().GetExtension(Analytics::redishmsetkey));
+		if (fdesc != NULL && !fdesc->is_repeated() && fdesc->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
+			layout.mDistinct.push_back(std::make_pair(fdesc, &mDistinct[desc->name() + "." + fdesc->name()]));
+	}
+
+	for (int i = 0; i < desc->field_count(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* fdesc = desc->field(i);
+		if (fdesc->is_repeated())
+			continue;
+
+		const google::protobuf::FieldOptions& options = fdesc->options();
+		if (options.GetExtension(Analytics::track_event) && fdesc->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
+			layout.mTopK.push_back(std::make_pair(fdesc, &mTopK[desc->name() + "." + fdesc->name()]));
+
+		std::vector<std::string> weights;
+		if (options.HasExtension(Analytics::point_event))
+			weights.push_back(options.GetExtension(Analytics::point_event).weight());
+		if (options.HasExtension(Analytics::line_event))
+		{
+			weights.push_back(options.GetExtension(Analytics::line_event).weight());
+
+			const google::protobuf::FieldDescriptor* group = desc->FindFieldByName(options.GetExtension(Analytics::line_event).group());
+			const bool added = std::find_if(layout.mDistinct.begin(), layout.mDistinct.end(),
+				[group](const std::pair<const google::protobuf::FieldDescriptor*, HyperLogLog*>& d) { return d.first == group; }) != layout.mDistinct.end();
+			if (group != NULL && !added && !group->is_repeated() && group->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
+				layout.mDistinct.push_back(std::make_pair(group, &mDistinct[desc->name() + "." + group->name()]));
+		}
+
+		// weights naming a field, a constant one says nothing about the distribution
+		for (size_t w = 0; w < weights.size(); ++w)
+		{
+			const google::protobuf::FieldDescriptor* weightField = weights[w].empty() ? NULL : desc->FindFieldByName(weights[w]);
+			if (weightField == NULL || std::find(quantileFields.begin(), quantileFields.end(), weightField) != quantileFields.end())
+				continue;
+
+			HeatmapAnnotationValue value;
+			if (value.Init(desc, weights[w], 0.0f))
+			{
+				quantileFields.push_back(weightField);
+				layout.mQuantiles.push_back(std::make_pair(value, &mQuantiles[desc->name() + "." + weightField->name()]));
+			}
+		}
+	}
+	return layout;
+}
+
+void EventSketches::AddEvent(const google::protobuf::Message& msg)
+{
+	const Layout& layout = GetLayout(msg.GetDescriptor());
+
+	for (size_t i = 0; i < layout.mDistinct.size(); ++i)
+		layout.mDistinct[i].second->Add(HashField(msg, layout.mDistinct[i].first));
+
+	for (size_t i = 0; i < layout.mTopK.size(); ++i)
+	{
+		mValue.clear();
+		StringFromField(mValue, msg, layout.mTopK[i].first);
+		layout.mTopK[i].second->Add(mValue);
+	}
+
+	for (size_t i = 0; i < layout.mQuantiles.size(); ++i)
+		layout.mQuantiles[i].second->Add(layout.mQuantiles[i].first.Read(msg));
+}
+
+const HyperLogLog* EventSketches::FindDistinct(const std::string& name) const
+{
+	std::map<std::string, HyperLogLog>::const_iterator it = mDistinct.find(name);
+	return it != mDistinct.end() ? &it->second : NULL;
+}
+
+const CountMinTopK* EventSketches::FindTopK(const std::string& name) const
+{
+	std::map<std::string, CountMinTopK>::const_iterator it = mTopK.find(name);
+	return it != mTopK.end() ? &it->second : NULL;
+}
+
+const TDigest* EventSketches::FindQuantiles(const std::string& name) const
+{
+	std::map<std::string, TDigest>::const_iterator it = mQuantiles.find(name);
+	return it != mQuantiles.end() ? &it->second : NULL;
+}
+
+void EventSketches::GetNames(std::vector<std::string>& distinct, std::vector<std::string>& topK, std::vector<std::string>& quantiles) const
+{
+	distinct.clear();
+	topK.clear();
+	quantiles.clear();
+	for (std::map<std::string, HyperLogLog>::const_iterator it = mDistinct.begin(); it != mDistinct.end(); ++it)
+		distinct.push_back(it->first);
+	for (std::map<std::string, CountMinTopK>::const_iterator it = mTopK.begin(); it != mTopK.end(); ++it)
+		topK.push_back(it->first);
+	for (std::map<std::string, TDigest>::const_iterator it = mQuantiles.begin(); it != mQuantiles.end(); ++it)
+		quantiles.push_back(it->first);
+}
+
+bool EventSketches::Merge(const EventSketches& other)
+{
+	bool ok = true;
+	for (std::map<std::string, HyperLogLog>::const_iterator it = other.mDistinct.begin(); it != other.mDistinct.end(); ++it)
+	{
+		std::map<std::string, HyperLogLog>::iterator mine = mDistinct.find(it->first);
+		if (mine == mDistinct.end())
+			mDistinct.insert(*it);
+		else
+			ok = mine->second.Merge(it->second) && ok;
+	}
+	for (std::map<std::string, CountMinTopK>::const_iterator it = other.mTopK.begin(); it != other.mTopK.end(); ++it)
+	{
+		std::map<std::string, CountMinTopK>::iterator mine = mTopK.find(it->first);
+		if (mine == mTopK.end())
+			mTopK.insert(*it);
+		else
+			ok = mine->second.Merge(it->second) && ok;
+	}
+	for (std::map<std::string, TDigest>::const_iterator it = other.mQuantiles.begin(); it != other.mQuantiles.end(); ++it)
+		mQuantiles[it->first].Merge(it->second);
+	return ok;
+}
+
+void EventSketches::Serialize(std::vector< std::pair<std::string, std::string> >& fields) const
+{
+	fields.clear();
+	for (std::map<std::string, HyperLogLog>::const_iterator it = mDistinct.begin(); it != mDistinct.end(); ++it)
+	{
+		fields.push_back(std::make_pair("d:" + it->first, std::string()));
+		it->second.Serialize(fields.back().second);
+	}
+	for (std::map<std::string, CountMinTopK>::const_iterator it = mTopK.begin(); it != mTopK.end(); ++it)
+	{
+		fields.push_back(std::make_pair("k:" + it->first, std::string()));
+		it->second.Serialize(fields.back().second);
+	}
+	for (std::map<std::string, TDigest>::const_iterator it = mQuantiles.begin(); it != mQuantiles.end(); ++it)
+	{
+		fields.push_back(std::make_pair("q:" + it->first, std::string()));
+		it->second.Serialize(fields.back().second);
+	}
+}
+
+bool EventSketches::MergeSerialized(const std::string& field, const std::string& data)
+{
+	if (field.size() < 3 || field[1] != ':')
+		return false;
+
+	const std::string name = field.substr(2);
+	switch (field[0])
+	{
+	case 'd':
+	{
+		HyperLogLog sketch;
+		if (!sketch.Deserialize(data))
+			return false;
+		std::map<std::string, HyperLogLog>::iterator mine = mDistinct.find(name);
+		if (mine == mDistinct.end())
+		{
+			mDistinct.insert(std::make_pair(name, sketch));
+			return true;
+		}
+		return mine->second.Merge(sketch);
+	}
+	case 'k':
+	{
+		CountMinTopK sketch;
+		if (!sketch.Deserialize(data))
+			return false;
+		std::map<std::string, CountMinTopK>::iterator mine = mTopK.find(name);
+		if (mine == mTopK.end())
+		{
+			mTopK.insert(std::make_pair(name, sketch));
+			return true;
+		}
+		return mine->second.Merge(sketch);
+	}
+	case 'q':
+	{
+		TDigest sketch;
+		if (!sketch.Deserialize(data))
+			return false;
+		mQuantiles[name].Merge(sketch);
+		return true;
+	}
+	}
+	return false;
+}
@@ -0,0 +1,182 @@
+#ifndef GAMEANALYTICS_SKETCH_H
+#define GAMEANALYTICS_SKETCH_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <utility>
+#include <unordered_map>
+#include <cstdint>
+
+#include "analytics.pb.h"
+#include "GameAnalytics_heatmap.h"
+
+//////////////////////////////////////////////////////////////////////////
+// Approximate aggregates in fixed memory. Every sketch merges with another of the same parameters, so the
+// sketches of sessions and servers add up to the sketch of all of their events, and serializes to a
+// little endian blob for the database.
+
+// 64 bit hashes of values, mixed well enough for the register and row selection of the sketches
+uint64_t SketchHash(uint64_t value);
+uint64_t SketchHash(const std::string& value);
+
+// Distinct counts, with a standard error of about 1.04 / sqrt(2^precision)
+class HyperLogLog
+{
+public:
+	enum { MinPrecision = 4, MaxPrecision = 18 };
+
+	explicit HyperLogLog(int precision = 12);
+
+	void Clear();
+	void Add(uint64_t hash);
+	void AddValue(const std::string& value) { Add(SketchHash(value)); }
+
+	double Estimate() const;
+	int GetPrecision() const { return mPrecision; }
+
+	// false when the precisions differ
+	bool Merge(const HyperLogLog& other);
+
+	void Serialize(std::string& out) const;
+	bool Deserialize(const std::string& data);
+private:
+	int						mPrecision;
+	std::vector<uint8_t>	mRegisters;
+};
+
+// The heaviest keys of a stream, counted in a count-min sketch of depth rows of width counters, with the k
+// keys of the largest estimates kept in a min heap. Estimates never undercount and overcount by at most
+// about e / width of the total with probability 1 - e^-depth.
+class CountMinTopK
+{
+public:
+	explicit CountMinTopK(int width = 1024, int depth = 4, int k = 16);
+
+	void Clear();
+	void Add(const std::string& key, uint64_t count = 1);
+
+	uint64_t Estimate(const std::string& key) const;
+	uint64_t GetTotal() const { return mTotal; }
+
+	// the top keys by estimate, largest first
+	void GetTopK(std::vector< std::pair<std::string, uint64_t> >& keys) const;
+
+	// false when the widths or depths differ. the candidates of both are ranked by the merged counts
+	bool Merge(const CountMinTopK& other);
+
+	void Serialize(std::string& out) const;
+	bool Deserialize(const std::string& data);
+private:
+	int						mWidth;
+	int						mDepth;
+	int						mK;
+	uint64_t				mTotal;
+	// depth rows of width counters
+	std::vector<uint64_t>	mCounts;
+
+	// a min heap of estimates with the heap slot of each key
+	std::vector< std::pair<uint64_t, std::string> >	mHeap;
+	std::unordered_map<std::string, size_t>			mHeapIndex;
+
+	uint64_t AddCounts(uint64_t hash, uint64_t count);
+	uint64_t EstimateHash(uint64_t hash) const;
+	void Offer(const std::string& key, uint64_t estimate);
+	void SwapHeap(size_t a, size_t b);
+	void SiftUp(size_t slot);
+	void SiftDown(size_t slot);
+};
+
+// Quantiles of a numeric stream as a merging t-digest, centroids sized by the arcsine scale function so the
+// tails stay accurate. compression bounds the centroid count, to about twice of it
+class TDigest
+{
+public:
+	explicit TDigest(double compression = 100.0);
+
+	void Clear();
+	void Add(double value, double weight = 1.0);
+
+	// q in [0, 1], NaN when empty
+	double Quantile(double q) const;
+	// the fraction of the weight below x
+	double Cdf(double x) const;
+
+	double GetCount() const { return mTotal + mBufferTotal; }
+	double GetMin() const { return mMin; }
+	double GetMax() const { return mMax; }
+
+	void Merge(const TDigest& other);
+
+	void Serialize(std::string& out) const;
+	bool Deserialize(const std::string& data);
+private:
+	struct Centroid
+	{
+		double	mMean;
+		double	mWeight;
+	};
+
+	double							mCompression;
+	double							mMin;
+	double							mMax;
+	// the compressed centroids, and values added since in the buffer, merged in when it fills or is read
+	mutable std::vector<Centroid>	mCentroids;
+	mutable std::vector<Centroid>	mBuffer;
+	mutable double					mTotal;
+	mutable double					mBufferTotal;
+
+	void Compress() const;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// The sketches of a stream of events, named "<Type>.<field>": the top values of each (track_event) field,
+// quantiles of each field a (point_event) or (line_event) weight names, like damageAmount, and distinct
+// counts of each (line_event) group field, the entities of position samples.
+class EventSketches
+{
+public:
+	EventSketches();
+	// the layouts point into the maps they were built for, a copy builds its own on first use
+	EventSketches(const EventSketches& other);
+	EventSketches& operator=(const EventSketches& other);
+
+	void Clear();
+	bool Empty() const;
+
+	void AddEvent(const google::protobuf::Message& msg);
+
+	const HyperLogLog* FindDistinct(const std::string& name) const;
+	const CountMinTopK* FindTopK(const std::string& name) const;
+	const TDigest* FindQuantiles(const std::string& name) const;
+
+	void GetNames(std::vector<std::string>& distinct, std::vector<std::string>& topK, std::vector<std::string>& quantiles) const;
+
+	// adds the sketches of another session or server
+	bool Merge(const EventSketches& other);
+
+	// hash fields "d:<name>", "k:<name>" and "q:<name>" with the serialized sketches
+	void Serialize(std::vector< std::pair<std::string, std::string> >& fields) const;
+	// merges a serialized field into the sketch of its name
+	bool MergeSerialized(const std::string& field, const std::string& data);
+private:
+	struct Layout
+	{
+		std::vector< std::pair<const google::protobuf::FieldDescriptor*, HyperLogLog*> >	mDistinct;
+		std::vector< std::pair<const google::protobuf::FieldDescriptor*, CountMinTopK*> >	mTopK;
+		std::vector< std::pair<HeatmapAnnotationValue, TDigest*> >							mQuantiles;
+	};
+
+	// std::map keeps the sketches where the layouts point at them
+	std::map<std::string, HyperLogLog>		mDistinct;
+	std::map<std::string, CountMinTopK>		mTopK;
+	std::map<std::string, TDigest>			mQuantiles;
+
+	std::map<const google::protobuf::Descriptor*, Layout>	mLayouts;
+	std::string								mValue;
+
+	const Layout& GetLayout(const google::protobuf::Descriptor* desc);
+};
+
+#endif
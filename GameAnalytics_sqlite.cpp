@@ -0,0 +1,858 @@
+#include "GameAnalytics_sqlite.h"
+
+#include <set>
+#include <algorithm>
+#include <cstring>
+#include <cfloat>
+#include <climits>
+#include <cstdlib>
+
+#include "sqlite3.h"
+
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+// nested messages deeper than this are only kept in the data blob
+static const size_t MaxFlattenDepth = 4;
+
+static bool IsPointField(const google::protobuf::FieldDescriptor* fdesc)
+{
+	return !fdesc->is_repeated()
+		&& fdesc->message_type() == Analytics::Vec3::descriptor()
+		&& fdesc->options().HasExtension(Analytics::point_event);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+RegionQuery::RegionQuery(const google::protobuf::Descriptor* eventType)
+	: mEventType(eventType)
+	, mPointField(NULL)
+	, mStartTime(LLONG_MIN)
+	, mEndTime(LLONG_MAX)
+{
+	for (int i = 0; i < 3; ++i)
+	{
+		mMins[i] = -FLT_MAX;
+		mMaxs[i] = FLT_MAX;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SqliteEventSink::Table::Table()
+	: mStoreData(false)
+	, mInsert(NULL)
+	, mCount(0)
+	, mFirstTime(0)
+	, mLastTime(0)
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+SqliteEventSink::SqliteEventSink()
+	: mDatabase(NULL)
+	, mCatalogInsert(NULL)
+	, mCatalogUpdate(NULL)
+	, mWriting(false)
+	, mQuit(false)
+{
+}
+
+SqliteEventSink::~SqliteEventSink()
+{
+	Close();
+}
+
+bool SqliteEventSink::Open(const char* filename, std::string& error)
+{
+	Close();
+
+	std::string filepath = "file:";
+	filepath += filename;
+
+	// the connection is only ever used from the writer thread
+	if (sqlite3_open_v2(filepath.c_str(), &mDatabase, SQLITE_OPEN_CREATE | SQLITE_OPEN_READWRITE | SQLITE_OPEN_URI | SQLITE_OPEN_NOMUTEX, NULL) != SQLITE_OK)
+	{
+		error = mDatabase != NULL ? sqlite3_errmsg(mDatabase) : "out of memory";
+		sqlite3_close_v2(mDatabase);
+		mDatabase = NULL;
+		return false;
+	}
+
+	// WAL lets readers such as the viewer query the file while events are being written
+	if (!Exec("PRAGMA journal_mode=WAL") || !Exec("PRAGMA synchronous=NORMAL") || !Exec("PRAGMA temp_store=MEMORY") ||
+		!Exec("CREATE TABLE IF NOT EXISTS _catalog ( name TEXT PRIMARY KEY, count INTEGER, firstTime INTEGER, lastTime INTEGER )") ||
+		CheckError(sqlite3_prepare_v2(mDatabase, "INSERT OR IGNORE INTO _catalog VALUES ( ?1, 0, ?2, ?3 )", -1, &mCatalogInsert, NULL)) != SQLITE_OK ||
+		CheckError(sqlite3_prepare_v2(mDatabase, "UPDATE _catalog SET count = count + ?2, firstTime = min( firstTime, ?3 ), lastTime = max( lastTime, ?4 ) WHERE name = ?1", -1, &mCatalogUpdate, NULL)) != SQLITE_OK)
+	{
+		error = sqlite3_errmsg(mDatabase);
+		Close();
+		return false;
+	}
+
+	mQuit = false;
+	mThread = std::thread(&SqliteEventSink::WriterThread, this);
+	return true;
+}
+
+void SqliteEventSink::Close()
+{
+	if (mThread.joinable())
+	{
+		EndOfFrame();
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mQuit = true;
+		}
+		mWake.notify_all();
+		mThread.join();
+	}
+
+	for (std::map<const google::protobuf::Descriptor*, Table>::iterator it = mTables.begin(); it != mTables.end(); ++it)
+	{
+		sqlite3_finalize(it->second.mInsert);
+		for (size_t i = 0; i < it->second.mSpatial.size(); ++i)
+			sqlite3_finalize(it->second.mSpatial[i].mInsert);
+	}
+	mTables.clear();
+
+	sqlite3_finalize(mCatalogInsert);
+	sqlite3_finalize(mCatalogUpdate);
+	mCatalogInsert = NULL;
+	mCatalogUpdate = NULL;
+
+	sqlite3_close_v2(mDatabase);
+	mDatabase = NULL;
+
+	mFrame.clear();
+	mPending.clear();
+	mFreeBatches.clear();
+}
+
+void SqliteEventSink::AddEvent(const google::protobuf::Message& msg, int64_t timeStamp)
+{
+	if (!IsOpen())
+		return;
+
+	EventHeader header;
+	header.mDescriptor = msg.GetDescriptor();
+	header.mTimeStamp = timeStamp;
+	header.mSize = (uint32_t)msg.ByteSizeLong();
+
+	const size_t offset = mFrame.size();
+	mFrame.resize(offset + sizeof(header) + header.mSize);
+	memcpy(&mFrame[offset], &header, sizeof(header));
+	msg.SerializeWithCachedSizesToArray((google::protobuf::uint8*)&mFrame[offset + sizeof(header)]);
+}
+
+void SqliteEventSink::EndOfFrame()
+{
+	if (mFrame.empty())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mPending.push_back(Batch());
+		mPending.back().swap(mFrame);
+
+		// reuse the capacity of a batch the writer is done with
+		if (!mFreeBatches.empty())
+		{
+			mFrame.swap(mFreeBatches.back());
+			mFreeBatches.pop_back();
+		}
+	}
+	mWake.notify_one();
+}
+
+void SqliteEventSink::Flush()
+{
+	if (!IsOpen())
+		return;
+
+	EndOfFrame();
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	mIdle.wait(lock, [this] { return mPending.empty() && !mWriting; });
+}
+
+void SqliteEventSink::GetErrors(std::vector<std::string>& errors)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	errors.insert(errors.end(), mErrors.begin(), mErrors.end());
+	mErrors.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void SqliteEventSink::WriterThread()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	for (;;)
+	{
+		mWake.wait(lock, [this] { return mQuit || !mPending.empty(); });
+		if (mPending.empty())
+			break;
+
+		std::vector<Batch> batches;
+		batches.swap(mPending);
+		mWriting = true;
+		lock.unlock();
+
+		// frames that queued up while the last commit was running go out in a single transaction
+		Exec("BEGIN");
+		for (size_t i = 0; i < batches.size(); ++i)
+			WriteBatch(batches[i]);
+		UpdateCatalog();
+		Exec("COMMIT");
+
+		lock.lock();
+		for (size_t i = 0; i < batches.size(); ++i)
+		{
+			batches[i].clear();
+			mFreeBatches.push_back(Batch());
+			mFreeBatches.back().swap(batches[i]);
+		}
+		mWriting = false;
+		mIdle.notify_all();
+	}
+}
+
+void SqliteEventSink::WriteBatch(const Batch& batch)
+{
+	size_t offset = 0;
+	while (offset + sizeof(EventHeader) <= batch.size())
+	{
+		EventHeader header;
+		memcpy(&header, &batch[offset], sizeof(header));
+
+		const char* payload = &batch[offset + sizeof(header)];
+		offset += sizeof(header) + header.mSize;
+
+		Table* table = GetTable(header.mDescriptor);
+		if (table == NULL)
+			continue;
+
+		if (!table->mScratch->ParseFromArray(payload, (int)header.mSize))
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mErrors.push_back("sqlite sink: failed to parse " + header.mDescriptor->full_name());
+			continue;
+		}
+
+		sqlite3_stmt* statement = table->mInsert;
+		sqlite3_bind_int64(statement, 1, header.mTimeStamp);
+		for (size_t c = 0; c < table->mColumns.size(); ++c)
+			BindColumn(statement, (int)c + 2, *table->mScratch, table->mColumns[c]);
+		if (table->mStoreData)
+			sqlite3_bind_blob(statement, (int)table->mColumns.size() + 2, payload, (int)header.mSize, SQLITE_STATIC);
+
+		if (CheckError(sqlite3_step(statement)) != SQLITE_DONE)
+		{
+			sqlite3_reset(statement);
+			continue;
+		}
+
+		if (table->mCount++ == 0)
+		{
+			table->mFirstTime = header.mTimeStamp;
+			table->mLastTime = header.mTimeStamp;
+		}
+		else
+		{
+			table->mFirstTime = std::min(table->mFirstTime, header.mTimeStamp);
+			table->mLastTime = std::max(table->mLastTime, header.mTimeStamp);
+		}
+
+		if (!table->mSpatial.empty())
+		{
+			const sqlite3_int64 rowId = sqlite3_last_insert_rowid(mDatabase);
+
+			for (size_t i = 0; i < table->mSpatial.size(); ++i)
+			{
+				const SpatialIndex& index = table->mSpatial[i];
+				const google::protobuf::Reflection* refl = table->mScratch->GetReflection();
+				if (!refl->HasField(*table->mScratch, index.mField))
+					continue;
+
+				const Analytics::Vec3& pos = static_cast<const Analytics::Vec3&>(refl->GetMessage(*table->mScratch, index.mField));
+				sqlite3_bind_int64(index.mInsert, 1, rowId);
+				sqlite3_bind_double(index.mInsert, 2, pos.x());
+				sqlite3_bind_double(index.mInsert, 3, pos.y());
+				sqlite3_bind_double(index.mInsert, 4, pos.z());
+				sqlite3_bind_int64(index.mInsert, 5, header.mTimeStamp);
+				CheckError(sqlite3_step(index.mInsert));
+				sqlite3_reset(index.mInsert);
+			}
+		}
+		sqlite3_reset(statement);
+	}
+}
+
+void SqliteEventSink::UpdateCatalog()
+{
+	for (std::map<const google::protobuf::Descriptor*, Table>::iterator it = mTables.begin(); it != mTables.end(); ++it)
+	{
+		Table& table = it->second;
+		if (table.mCount == 0)
+			continue;
+
+		const std::string name = TableName(it->first);
+
+		sqlite3_bind_text(mCatalogInsert, 1, name.c_str(), (int)name.size(), SQLITE_STATIC);
+		sqlite3_bind_int64(mCatalogInsert, 2, table.mFirstTime);
+		sqlite3_bind_int64(mCatalogInsert, 3, table.mLastTime);
+		CheckError(sqlite3_step(mCatalogInsert));
+		sqlite3_reset(mCatalogInsert);
+
+		sqlite3_bind_text(mCatalogUpdate, 1, name.c_str(), (int)name.size(), SQLITE_STATIC);
+		sqlite3_bind_int64(mCatalogUpdate, 2, table.mCount);
+		sqlite3_bind_int64(mCatalogUpdate, 3, table.mFirstTime);
+		sqlite3_bind_int64(mCatalogUpdate, 4, table.mLastTime);
+		CheckError(sqlite3_step(mCatalogUpdate));
+		sqlite3_reset(mCatalogUpdate);
+
+		table.mCount = 0;
+	}
+}
+
+bool SqliteEventSink::ReadCatalog(sqlite3* database, std::vector<EventCatalogEntry>& entries, std::string& error)
+{
+	sqlite3_stmt* statement = NULL;
+	if (sqlite3_prepare_v2(database, "SELECT name, count, firstTime, lastTime FROM _catalog ORDER BY name", -1, &statement, NULL) != SQLITE_OK)
+	{
+		error = sqlite3_errmsg(database);
+		sqlite3_finalize(statement);
+		return false;
+	}
+
+	int errcode = SQLITE_OK;
+	while ((errcode = sqlite3_step(statement)) == SQLITE_ROW)
+	{
+		EventCatalogEntry entry;
+		entry.mName = (const char*)sqlite3_column_text(statement, 0);
+		entry.mCount = sqlite3_column_int64(statement, 1);
+		entry.mFirstTime = sqlite3_column_int64(statement, 2);
+		entry.mLastTime = sqlite3_column_int64(statement, 3);
+		entries.push_back(entry);
+	}
+
+	if (errcode != SQLITE_DONE)
+		error = sqlite3_errmsg(database);
+
+	sqlite3_finalize(statement);
+	return errcode == SQLITE_DONE;
+}
+
+void SqliteEventSink::BindColumn(sqlite3_stmt* statement, int index, const google::protobuf::Message& msg, const Column& column)
+{
+	const google::protobuf::Message* parent = &msg;
+	for (size_t i = 0; i + 1 < column.mPath.size(); ++i)
+	{
+		if (!parent->GetReflection()->HasField(*parent, column.mPath[i]))
+		{
+			sqlite3_bind_null(statement, index);
+			return;
+		}
+		parent = &parent->GetReflection()->GetMessage(*parent, column.mPath[i]);
+	}
+
+	const google::protobuf::Reflection* refl = parent->GetReflection();
+	const google::protobuf::FieldDescriptor* fdesc = column.mPath.back();
+	switch (fdesc->cpp_type())
+	{
+	case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+		sqlite3_bind_int(statement, index, refl->GetInt32(*parent, fdesc));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+		sqlite3_bind_int64(statement, index, refl->GetInt64(*parent, fdesc));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+		sqlite3_bind_int64(statement, index, refl->GetUInt32(*parent, fdesc));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+		sqlite3_bind_int64(statement, index, (sqlite3_int64)refl->GetUInt64(*parent, fdesc));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+		sqlite3_bind_double(statement, index, refl->GetFloat(*parent, fdesc));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+		sqlite3_bind_double(statement, index, refl->GetDouble(*parent, fdesc));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+		sqlite3_bind_int(statement, index, refl->GetBool(*parent, fdesc) ? 1 : 0);
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+		sqlite3_bind_int(statement, index, refl->GetEnumValue(*parent, fdesc));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+	{
+		// the reference stays valid until the scratch message is parsed into again, after the step
+		std::string scratch;
+		const std::string& str = refl->GetStringReference(*parent, fdesc, &scratch);
+		const sqlite3_destructor_type lifetime = &str == &scratch ? SQLITE_TRANSIENT : SQLITE_STATIC;
+
+		if (fdesc->type() == google::protobuf::FieldDescriptor::TYPE_BYTES)
+			sqlite3_bind_blob(statement, index, str.data(), (int)str.size(), lifetime);
+		else
+			sqlite3_bind_text(statement, index, str.data(), (int)str.size(), lifetime);
+		break;
+	}
+	default:
+		sqlite3_bind_null(statement, index);
+		break;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void SqliteEventSink::ReadColumn(sqlite3_stmt* statement, int index, google::protobuf::Message& msg, const Column& column)
+{
+	if (sqlite3_column_type(statement, index) == SQLITE_NULL)
+		return;
+
+	google::protobuf::Message* parent = &msg;
+	for (size_t i = 0; i + 1 < column.mPath.size(); ++i)
+		parent = parent->GetReflection()->MutableMessage(parent, column.mPath[i]);
+
+	const google::protobuf::Reflection* refl = parent->GetReflection();
+	const google::protobuf::FieldDescriptor* fdesc = column.mPath.back();
+	switch (fdesc->cpp_type())
+	{
+	case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+		refl->SetInt32(parent, fdesc, sqlite3_column_int(statement, index));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+		refl->SetInt64(parent, fdesc, sqlite3_column_int64(statement, index));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+		refl->SetUInt32(parent, fdesc, (uint32_t)sqlite3_column_int64(statement, index));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+		refl->SetUInt64(parent, fdesc, (uint64_t)sqlite3_column_int64(statement, index));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+		refl->SetFloat(parent, fdesc, (float)sqlite3_column_double(statement, index));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+		refl->SetDouble(parent, fdesc, sqlite3_column_double(statement, index));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+		refl->SetBool(parent, fdesc, sqlite3_column_int(statement, index) != 0);
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+		refl->SetEnumValue(parent, fdesc, sqlite3_column_int(statement, index));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+	{
+		const char* data = (const char*)(fdesc->type() == google::protobuf::FieldDescriptor::TYPE_BYTES ?
+			sqlite3_column_blob(statement, index) : sqlite3_column_text(statement, index));
+		refl->SetString(parent, fdesc, std::string(data ? data : "", sqlite3_column_bytes(statement, index)));
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+// binds the value of a track_event filter as the column type of the field
+static bool BindFilter(sqlite3_stmt* statement, int index, const google::protobuf::FieldDescriptor* fdesc, const std::string& value, std::string& error)
+{
+	const char* str = value.c_str();
+	char* end = NULL;
+
+	switch (fdesc->cpp_type())
+	{
+	case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+	{
+		const google::protobuf::EnumValueDescriptor* edesc = fdesc->enum_type()->FindValueByName(value);
+		if (edesc != NULL)
+		{
+			sqlite3_bind_int(statement, index, edesc->number());
+			return true;
+		}
+		sqlite3_bind_int64(statement, index, strtoll(str, &end, 10));
+		break;
+	}
+	case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+		if (value == "true" || value == "false")
+		{
+			sqlite3_bind_int(statement, index, value == "true" ? 1 : 0);
+			return true;
+		}
+		sqlite3_bind_int64(statement, index, strtoll(str, &end, 10));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+	case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+		sqlite3_bind_double(statement, index, strtod(str, &end));
+		break;
+	case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+		sqlite3_bind_text(statement, index, value.data(), (int)value.size(), SQLITE_TRANSIENT);
+		return true;
+	default:
+		sqlite3_bind_int64(statement, index, strtoll(str, &end, 10));
+		break;
+	}
+
+	if (end == str || *end != 0)
+	{
+		error = "invalid value '" + value + "' for " + fdesc->full_name();
+		return false;
+	}
+	return true;
+}
+
+bool SqliteEventSink::QueryRegion(sqlite3* database, const RegionQuery& query, RegionQueryCallback callback, std::string& error)
+{
+	const google::protobuf::Descriptor* desc = query.mEventType;
+	if (desc == NULL || database == NULL)
+	{
+		error = "invalid region query";
+		return false;
+	}
+
+	const google::protobuf::FieldDescriptor* pointField = query.mPointField;
+	for (int i = 0; pointField == NULL && i < desc->field_count(); ++i)
+	{
+		if (IsPointField(desc->field(i)))
+			pointField = desc->field(i);
+	}
+
+	if (pointField != NULL && (pointField->containing_type() != desc || !IsPointField(pointField)))
+	{
+		error = pointField->full_name() + " is not a (point_event) Vec3 field of " + desc->full_name();
+		return false;
+	}
+
+	std::vector<Column> columns;
+	std::vector<const google::protobuf::FieldDescriptor*> path;
+	bool storeData = false;
+	CollectColumns(desc, "", path, columns, storeData);
+
+	std::string sql = "SELECT e._time";
+	if (storeData)
+		sql += ", e._data";
+	else
+	{
+		for (size_t i = 0; i < columns.size(); ++i)
+			sql += ", e.\"" + columns[i].mName + "\"";
+	}
+
+	// events without the position set aren't in the tree, so without a box to narrow down by the table is scanned
+	bool unbounded = true;
+	for (int i = 0; i < 3; ++i)
+		unbounded = unbounded && query.mMins[i] == -FLT_MAX && query.mMaxs[i] == FLT_MAX;
+
+	if (pointField != NULL && !unbounded)
+	{
+		// the tree narrows it down, the exact values are checked against the event table
+		const std::string col = "e.\"" + pointField->name() + "_";
+
+		sql += " FROM \"" + SpatialIndexName(pointField) + "\" r CROSS JOIN \"" + TableName(desc) + "\" e ON e._id = r.id";
+		sql += " WHERE r.maxX >= ?1 AND r.minX <= ?4 AND r.maxY >= ?2 AND r.minY <= ?5 AND r.maxZ >= ?3 AND r.minZ <= ?6 AND r.maxT >= ?7 AND r.minT <= ?8";
+		sql += " AND " + col + "x\" BETWEEN ?1 AND ?4 AND " + col + "y\" BETWEEN ?2 AND ?5 AND " + col + "z\" BETWEEN ?3 AND ?6";
+		sql += " AND e._time BETWEEN ?7 AND ?8";
+	}
+	else
+	{
+		// nothing to index the box by, types without a position are only narrowed down by time and track values
+		sql += " FROM \"" + TableName(desc) + "\" e WHERE e._time BETWEEN ?7 AND ?8";
+	}
+
+	std::vector<const google::protobuf::FieldDescriptor*> filterFields;
+	for (size_t i = 0; i < query.mTrackFilters.size(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* fdesc = desc->FindFieldByName(query.mTrackFilters[i].first);
+		if (fdesc == NULL || fdesc->is_repeated() ||
+			fdesc->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE ||
+			!fdesc->options().GetExtension(Analytics::track_event))
+		{
+			error = "'" + query.mTrackFilters[i].first + "' is not a (track_event) field of " + desc->full_name();
+			return false;
+		}
+
+		filterFields.push_back(fdesc);
+		sql += " AND e.\"" + fdesc->name() + "\" = ?";
+	}
+	sql += " ORDER BY e._time";
+
+	sqlite3_stmt* statement = NULL;
+	if (sqlite3_prepare_v2(database, sql.c_str(), -1, &statement, NULL) != SQLITE_OK)
+	{
+		error = sqlite3_errmsg(database);
+		sqlite3_finalize(statement);
+		return false;
+	}
+
+	for (int i = 0; i < 3; ++i)
+	{
+		sqlite3_bind_double(statement, 1 + i, query.mMins[i]);
+		sqlite3_bind_double(statement, 4 + i, query.mMaxs[i]);
+	}
+	sqlite3_bind_int64(statement, 7, query.mStartTime);
+	sqlite3_bind_int64(statement, 8, query.mEndTime);
+
+	for (size_t i = 0; i < filterFields.size(); ++i)
+	{
+		if (!BindFilter(statement, 9 + (int)i, filterFields[i], query.mTrackFilters[i].second, error))
+		{
+			sqlite3_finalize(statement);
+			return false;
+		}
+	}
+
+	const google::protobuf::Message* prototype = google::protobuf::MessageFactory::generated_factory()->GetPrototype(desc);
+	std::unique_ptr<google::protobuf::Message> msg(prototype->New());
+
+	int errcode = SQLITE_OK;
+	while ((errcode = sqlite3_step(statement)) == SQLITE_ROW)
+	{
+		msg->Clear();
+
+		if (storeData)
+		{
+			if (!msg->ParseFromArray(sqlite3_column_blob(statement, 1), sqlite3_column_bytes(statement, 1)))
+				continue;
+		}
+		else
+		{
+			for (size_t c = 0; c < columns.size(); ++c)
+				ReadColumn(statement, (int)c + 1, *msg, columns[c]);
+		}
+
+		if (!callback(*msg, sqlite3_column_int64(statement, 0)))
+		{
+			errcode = SQLITE_DONE;
+			break;
+		}
+	}
+
+	if (errcode != SQLITE_DONE)
+		error = sqlite3_errmsg(database);
+
+	sqlite3_finalize(statement);
+	return errcode == SQLITE_DONE;
+}
+
+SqliteEventSink::Table* SqliteEventSink::GetTable(const google::protobuf::Descriptor* desc)
+{
+	std::map<const google::protobuf::Descriptor*, Table>::iterator it = mTables.find(desc);
+	if (it != mTables.end())
+		return it->second.mInsert != NULL ? &it->second : NULL;
+
+	// failed tables stay in the map without a statement so they aren't retried every event
+	Table& table = mTables[desc];
+	if (!CreateTable(desc, table))
+		return NULL;
+
+	table.mScratch.reset(google::protobuf::MessageFactory::generated_factory()->GetPrototype(desc)->New());
+	return &table;
+}
+
+bool SqliteEventSink::CreateTable(const google::protobuf::Descriptor* desc, Table& table)
+{
+	std::vector<const google::protobuf::FieldDescriptor*> path;
+	CollectColumns(desc, "", path, table.mColumns, table.mStoreData);
+
+	const std::string tableName = TableName(desc);
+
+	// tables written before the catalog existed are counted once
+	bool cataloged = false;
+	sqlite3_stmt* statement = NULL;
+	if (CheckError(sqlite3_prepare_v2(mDatabase, "SELECT 1 FROM _catalog WHERE name=?", -1, &statement, NULL)) == SQLITE_OK)
+	{
+		sqlite3_bind_text(statement, 1, tableName.c_str(), (int)tableName.size(), SQLITE_TRANSIENT);
+		cataloged = sqlite3_step(statement) == SQLITE_ROW;
+	}
+	sqlite3_finalize(statement);
+	statement = NULL;
+
+	std::string sql = "CREATE TABLE IF NOT EXISTS \"" + tableName + "\" ( _id INTEGER PRIMARY KEY, _time INTEGER";
+	for (size_t i = 0; i < table.mColumns.size(); ++i)
+		sql += ", \"" + table.mColumns[i].mName + "\" " + table.mColumns[i].mType;
+	if (table.mStoreData)
+		sql += ", _data BLOB";
+	sql += " )";
+
+	if (!Exec(sql.c_str()))
+		return false;
+
+	if (!cataloged)
+	{
+		Exec(("INSERT OR IGNORE INTO _catalog SELECT '" + tableName + "', count(*), min(_time), max(_time) FROM \""
+			+ tableName + "\" HAVING count(*) > 0").c_str());
+	}
+
+	// a table from an older build of the messages gets the columns it is missing
+	std::set<std::string> existing;
+	if (CheckError(sqlite3_prepare_v2(mDatabase, ("PRAGMA table_info(\"" + tableName + "\")").c_str(), -1, &statement, NULL)) == SQLITE_OK)
+	{
+		while (sqlite3_step(statement) == SQLITE_ROW)
+			existing.insert((const char*)sqlite3_column_text(statement, 1));
+	}
+	sqlite3_finalize(statement);
+
+	for (size_t i = 0; i < table.mColumns.size(); ++i)
+	{
+		if (existing.find(table.mColumns[i].mName) == existing.end())
+			Exec(("ALTER TABLE \"" + tableName + "\" ADD COLUMN \"" + table.mColumns[i].mName + "\" " + table.mColumns[i].mType).c_str());
+	}
+	if (table.mStoreData && existing.find("_data") == existing.end())
+		Exec(("ALTER TABLE \"" + tableName + "\" ADD COLUMN _data BLOB").c_str());
+
+	std::string columns = "_time";
+	std::string values = "?";
+	for (size_t i = 0; i < table.mColumns.size(); ++i)
+	{
+		columns += ", \"" + table.mColumns[i].mName + "\"";
+		values += ", ?";
+	}
+	if (table.mStoreData)
+	{
+		columns += ", _data";
+		values += ", ?";
+	}
+
+	sql = "INSERT INTO \"" + tableName + "\" ( " + columns + " ) VALUES ( " + values + " )";
+	if (CheckError(sqlite3_prepare_v2(mDatabase, sql.c_str(), -1, &table.mInsert, NULL)) != SQLITE_OK)
+		return false;
+
+	for (int i = 0; i < desc->field_count(); ++i)
+	{
+		if (IsPointField(desc->field(i)))
+			CreateSpatialIndex(desc, desc->field(i), table);
+	}
+	return true;
+}
+
+bool SqliteEventSink::CreateSpatialIndex(const google::protobuf::Descriptor* desc, const google::protobuf::FieldDescriptor* fdesc, Table& table)
+{
+	const std::string indexName = SpatialIndexName(fdesc);
+
+	bool exists = false;
+	sqlite3_stmt* statement = NULL;
+	if (CheckError(sqlite3_prepare_v2(mDatabase, "SELECT 1 FROM sqlite_master WHERE name=?", -1, &statement, NULL)) == SQLITE_OK)
+	{
+		sqlite3_bind_text(statement, 1, indexName.c_str(), (int)indexName.size(), SQLITE_TRANSIENT);
+		exists = sqlite3_step(statement) == SQLITE_ROW;
+	}
+	sqlite3_finalize(statement);
+
+	// time is the 4th dimension so time ranges prune too. the tree stores 32 bit floats rounded
+	// outwards, queries check the exact values on the event table
+	if (!exists)
+	{
+		if (!Exec(("CREATE VIRTUAL TABLE \"" + indexName + "\" USING rtree( id, minX, maxX, minY, maxY, minZ, maxZ, minT, maxT )").c_str()))
+			return false;
+
+		// rows written before the index existed
+		const std::string col = fdesc->name() + "_";
+		Exec(("INSERT INTO \"" + indexName + "\" SELECT _id, \"" + col + "x\", \"" + col + "x\", \"" + col + "y\", \"" + col + "y\", \"" + col + "z\", \"" + col + "z\", _time, _time FROM \""
+			+ TableName(desc) + "\" WHERE \"" + col + "x\" NOT NULL").c_str());
+	}
+
+	SpatialIndex index;
+	index.mField = fdesc;
+	index.mInsert = NULL;
+
+	const std::string sql = "INSERT INTO \"" + indexName + "\" VALUES ( ?1, ?2, ?2, ?3, ?3, ?4, ?4, ?5, ?5 )";
+	if (CheckError(sqlite3_prepare_v2(mDatabase, sql.c_str(), -1, &index.mInsert, NULL)) != SQLITE_OK)
+		return false;
+
+	table.mSpatial.push_back(index);
+	return true;
+}
+
+void SqliteEventSink::CollectColumns(const google::protobuf::Descriptor* desc, const std::string& prefix, std::vector<const google::protobuf::FieldDescriptor*>& path, std::vector<Column>& columns, bool& hasRepeated)
+{
+	for (int i = 0; i < desc->field_count(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* fdesc = desc->field(i);
+		if (fdesc->is_repeated())
+		{
+			hasRepeated = true;
+			continue;
+		}
+
+		path.push_back(fdesc);
+
+		if (fdesc->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
+		{
+			if (path.size() < MaxFlattenDepth)
+				CollectColumns(fdesc->message_type(), prefix + fdesc->name() + "_", path, columns, hasRepeated);
+			else
+				hasRepeated = true;
+		}
+		else
+		{
+			Column column;
+			column.mName = prefix + fdesc->name();
+			column.mPath = path;
+
+			switch (fdesc->cpp_type())
+			{
+			case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+			case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+				column.mType = "REAL";
+				break;
+			case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+				column.mType = fdesc->type() == google::protobuf::FieldDescriptor::TYPE_BYTES ? "BLOB" : "TEXT";
+				break;
+			default:
+				column.mType = "INTEGER";
+				break;
+			}
+			columns.push_back(column);
+		}
+
+		path.pop_back();
+	}
+}
+
+std::string SqliteEventSink::TableName(const google::protobuf::Descriptor* desc)
+{
+	return desc->name();
+}
+
+std::string SqliteEventSink::SpatialIndexName(const google::protobuf::FieldDescriptor* pointField)
+{
+	return TableName(pointField->containing_type()) + "_" + pointField->name() + "_rtree";
+}
+
+void SqliteEventSink::ColumnNames(const google::protobuf::Descriptor* desc, std::vector<std::string>& columns)
+{
+	std::vector<Column> cols;
+	std::vector<const google::protobuf::FieldDescriptor*> path;
+	bool hasRepeated = false;
+	CollectColumns(desc, "", path, cols, hasRepeated);
+
+	for (size_t i = 0; i < cols.size(); ++i)
+		columns.push_back(cols[i].mName);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+bool SqliteEventSink::Exec(const char* sql)
+{
+	return CheckError(sqlite3_exec(mDatabase, sql, NULL, NULL, NULL)) == SQLITE_OK;
+}
+
+int SqliteEventSink::CheckError(int errcode)
+{
+	switch (errcode)
+	{
+	case SQLITE_OK:
+	case SQLITE_ROW:
+	case SQLITE_DONE:
+		break;
+	default:
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mErrors.push_back(std::string("sqlite3 error: ") + sqlite3_errmsg(mDatabase));
+	}
+	}
+	return errcode;
+}
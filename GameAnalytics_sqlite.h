@@ -0,0 +1,168 @@
+#ifndef GAMEANALYTICS_SQLITE_H
+#define GAMEANALYTICS_SQLITE_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <memory>
+#include <thread>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+#include "analytics.pb.h"
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+//////////////////////////////////////////////////////////////////////////
+
+// A box and time range query over the positions of a point_event field, narrowed down by track_event values.
+// Types without a point_event field ignore the box and return every event in the time range, as does a query
+// that leaves the box unbounded, including the events whose position isn't set
+struct RegionQuery
+{
+	const google::protobuf::Descriptor*			mEventType;
+	// the Vec3 field tagged (point_event), NULL for the first one of the event type
+	const google::protobuf::FieldDescriptor*	mPointField;
+
+	float										mMins[3];
+	float										mMaxs[3];
+	int64_t										mStartTime;
+	int64_t										mEndTime;
+
+	// (track_event) field name and value pairs that all have to match, enums by name or number
+	std::vector< std::pair<std::string, std::string> > mTrackFilters;
+
+	RegionQuery(const google::protobuf::Descriptor* eventType);
+};
+
+// return false to stop the query
+typedef std::function<bool(const google::protobuf::Message& event, int64_t timeStamp)> RegionQueryCallback;
+
+// one row of the event catalog the sink keeps up to date as it writes
+struct EventCatalogEntry
+{
+	std::string		mName;
+	int64_t			mCount;
+	int64_t			mFirstTime;
+	int64_t			mLastTime;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// Writes events to a sqlite file with one table per message type, created from the descriptor.
+// Scalar fields become columns, singular message fields are flattened into parent_child columns
+// and types with repeated fields also keep the whole message in a data blob. Events are serialized
+// into a frame buffer on the calling thread and inserted by a writer thread that owns the connection,
+// one transaction per frame, through a prepared statement cached per type.
+// Every (point_event) Vec3 field also gets an R*Tree over x, y, z and time, keyed by the row id.
+// The _catalog table holds the count and time range of each table, updated in the frame transaction.
+class SqliteEventSink
+{
+public:
+	SqliteEventSink();
+	~SqliteEventSink();
+
+	bool Open(const char* filename, std::string& error);
+	void Close();
+	bool IsOpen() const { return mThread.joinable(); }
+
+	void AddEvent(const google::protobuf::Message& msg, int64_t timeStamp);
+
+	// hands the events since the last call to the writer thread
+	void EndOfFrame();
+	// blocks until the writer thread has committed everything handed to it
+	void Flush();
+
+	// errors raised on the writer thread since the last call, so they can be reported from the main thread
+	void GetErrors(std::vector<std::string>& errors);
+
+	// the table and column names used for a message type
+	static std::string TableName(const google::protobuf::Descriptor* desc);
+	static std::string SpatialIndexName(const google::protobuf::FieldDescriptor* pointField);
+	static void ColumnNames(const google::protobuf::Descriptor* desc, std::vector<std::string>& columns);
+
+	// runs a region query against any connection to a file written by the sink
+	static bool QueryRegion(sqlite3* database, const RegionQuery& query, RegionQueryCallback callback, std::string& error);
+	// lists the event types in a file written by the sink without touching the event tables
+	static bool ReadCatalog(sqlite3* database, std::vector<EventCatalogEntry>& entries, std::string& error);
+private:
+	struct Column
+	{
+		std::string										mName;
+		const char*										mType;
+		std::vector<const google::protobuf::FieldDescriptor*>	mPath;
+	};
+
+	struct SpatialIndex
+	{
+		const google::protobuf::FieldDescriptor*	mField;
+		sqlite3_stmt*								mInsert;
+	};
+
+	struct Table
+	{
+		std::vector<Column>							mColumns;
+		std::vector<SpatialIndex>					mSpatial;
+		bool										mStoreData;
+		sqlite3_stmt*								mInsert;
+		std::unique_ptr<google::protobuf::Message>	mScratch;
+
+		// rows written since the catalog was last updated
+		int64_t										mCount;
+		int64_t										mFirstTime;
+		int64_t										mLastTime;
+
+		Table();
+	};
+
+	struct EventHeader
+	{
+		const google::protobuf::Descriptor*	mDescriptor;
+		int64_t								mTimeStamp;
+		uint32_t							mSize;
+	};
+
+	typedef std::vector<char> Batch;
+
+	sqlite3*						mDatabase;
+	sqlite3_stmt*					mCatalogInsert;
+	sqlite3_stmt*					mCatalogUpdate;
+
+	// writer thread only
+	std::map<const google::protobuf::Descriptor*, Table> mTables;
+
+	Batch							mFrame;
+
+	std::thread						mThread;
+	std::mutex						mMutex;
+	std::condition_variable			mWake;
+	std::condition_variable			mIdle;
+	std::vector<Batch>				mPending;
+	std::vector<Batch>				mFreeBatches;
+	bool							mWriting;
+	bool							mQuit;
+
+	std::vector<std::string>		mErrors;
+
+	SqliteEventSink(const SqliteEventSink& other);
+	SqliteEventSink& operator=(const SqliteEventSink& other);
+
+	void WriterThread();
+	void WriteBatch(const Batch& batch);
+	Table* GetTable(const google::protobuf::Descriptor* desc);
+	bool CreateTable(const google::protobuf::Descriptor* desc, Table& table);
+	void UpdateCatalog();
+	bool CreateSpatialIndex(const google::protobuf::Descriptor* desc, const google::protobuf::FieldDescriptor* fdesc, Table& table);
+	void BindColumn(sqlite3_stmt* statement, int index, const google::protobuf::Message& msg, const Column& column);
+
+	bool Exec(const char* sql);
+	int CheckError(int errcode);
+
+	static void ReadColumn(sqlite3_stmt* statement, int index, google::protobuf::Message& msg, const Column& column);
+	static void CollectColumns(const google::protobuf::Descriptor* desc, const std::string& prefix, std::vector<const google::protobuf::FieldDescriptor*>& path, std::vector<Column>& columns, bool& hasRepeated);
+};
+
+#endif
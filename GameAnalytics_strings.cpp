@@ -0,0 +1,144 @@
+#include "GameAnalytics_strings.h"
+
+#undef GetMessage
+
+//////////////////////////////////////////////////////////////////////////
+
+uint32_t SessionStringTable::Intern(const std::string& str, bool& isNew)
+{
+	IdMap::const_iterator it = mIds.find(str);
+	if (it != mIds.end())
+	{
+		isNew = false;
+		return it->second;
+	}
+
+	mStrings.push_back(str);
+	mKnown.push_back(true);
+
+	const uint32_t id = (uint32_t)mStrings.size();
+	mIds[str] = id;
+	isNew = true;
+	return id;
+}
+
+void SessionStringTable::Insert(uint32_t id, const std::string& str)
+{
+	if (id == 0)
+		return;
+
+	if (mStrings.size() < id)
+	{
+		mStrings.resize(id);
+		mKnown.resize(id, false);
+	}
+
+	mStrings[id - 1] = str;
+	mKnown[id - 1] = true;
+	mIds[str] = id;
+}
+
+const std::string* SessionStringTable::Find(uint32_t id) const
+{
+	if (id == 0 || id > mStrings.size() || !mKnown[id - 1])
+		return NULL;
+	return &mStrings[id - 1];
+}
+
+void SessionStringTable::Clear()
+{
+	mIds.clear();
+	mStrings.clear();
+	mKnown.clear();
+}
+
+const SessionStringTable::FieldList& SessionStringTable::GetInternedFields(const google::protobuf::Descriptor* desc) const
+{
+	FieldCache::iterator it = mFieldCache.find(desc);
+	if (it != mFieldCache.end())
+		return it->second;
+
+	FieldList& fields = mFieldCache[desc];
+	for (int i = 0; i < desc->field_count(); ++i)
+	{
+		const google::protobuf::FieldDescriptor* fdesc = desc->field(i);
+		if (fdesc->is_repeated() || fdesc->type() != google::protobuf::FieldDescriptor::TYPE_STRING)
+			continue;
+
+		const std::string& idFieldName = fdesc->options().GetExtension(Analytics::intern);
+		if (idFieldName.empty())
+			continue;
+
+		const google::protobuf::FieldDescriptor* idDesc = desc->FindFieldByCamelcaseName(idFieldName);
+		if (idDesc == NULL || idDesc->is_repeated() || idDesc->type() != google::protobuf::FieldDescriptor::TYPE_UINT32)
+			continue;
+
+		InternField field;
+		field.mString = fdesc;
+		field.mId = idDesc;
+		fields.push_back(field);
+	}
+	return fields;
+}
+
+bool SessionStringTable::HasInternedFields(const google::protobuf::Descriptor* desc) const
+{
+	return !GetInternedFields(desc).empty();
+}
+
+bool SessionStringTable::InternMessage(google::protobuf::Message& msg, std::vector<Analytics::GameString>& newStrings)
+{
+	const FieldList& fields = GetInternedFields(msg.GetDescriptor());
+	const google::protobuf::Reflection* refl = msg.GetReflection();
+
+	std::string scratch;
+
+	bool modified = false;
+	for (size_t i = 0; i < fields.size(); ++i)
+	{
+		const std::string& str = refl->GetStringReference(msg, fields[i].mString, &scratch);
+		if (str.empty())
+			continue;
+
+		bool isNew = false;
+		const uint32_t id = Intern(str, isNew);
+		if (isNew)
+		{
+			newStrings.push_back(Analytics::GameString());
+			newStrings.back().set_id(id);
+			newStrings.back().set_value(str);
+		}
+
+		refl->SetUInt32(&msg, fields[i].mId, id);
+		refl->ClearField(&msg, fields[i].mString);
+		modified = true;
+	}
+	return modified;
+}
+
+bool SessionStringTable::ResolveMessage(google::protobuf::Message& msg, std::vector<uint32_t>* missingIds) const
+{
+	const FieldList& fields = GetInternedFields(msg.GetDescriptor());
+	const google::protobuf::Reflection* refl = msg.GetReflection();
+
+	bool resolved = true;
+	for (size_t i = 0; i < fields.size(); ++i)
+	{
+		const uint32_t id = refl->GetUInt32(msg, fields[i].mId);
+		if (id == 0)
+			continue;
+
+		const std::string* str = Find(id);
+		if (str == NULL)
+		{
+			if (missingIds != NULL)
+				missingIds->push_back(id);
+			resolved = false;
+			continue;
+		}
+
+		refl->SetString(&msg, fields[i].mString, *str);
+		refl->ClearField(&msg, fields[i].mId);
+	}
+	return resolved;
+}
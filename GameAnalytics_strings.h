@@ -0,0 +1,55 @@
+#ifndef GAMEANALYTICS_STRINGS_H
+#define GAMEANALYTICS_STRINGS_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+
+#include "analytics.pb.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// Per session string table for string fields tagged with the (intern) field option. The option names
+// a uint32 sibling field that carries the id instead of the string. Each string is published once as a
+// GameString, which also lands in the session hash so late joining readers can load the whole table.
+class SessionStringTable
+{
+public:
+	// writer side, returns the id of the string and whether this is the first time it was seen
+	uint32_t Intern(const std::string& str, bool& isNew);
+
+	// reader side
+	void Insert(uint32_t id, const std::string& str);
+	const std::string* Find(uint32_t id) const;
+
+	void Clear();
+	size_t Size() const { return mStrings.size(); }
+
+	bool HasInternedFields(const google::protobuf::Descriptor* desc) const;
+
+	// swap the tagged strings for their ids, strings seen for the first time are added to newStrings
+	bool InternMessage(google::protobuf::Message& msg, std::vector<Analytics::GameString>& newStrings);
+
+	// swap ids back to strings, ids not in the table are added to missingIds and left alone
+	bool ResolveMessage(google::protobuf::Message& msg, std::vector<uint32_t>* missingIds = NULL) const;
+private:
+	typedef std::unordered_map<std::string, uint32_t> IdMap;
+	IdMap						mIds;
+	std::vector<std::string>	mStrings;	// indexed by id - 1, 0 is reserved for unset
+	std::vector<bool>			mKnown;
+
+	struct InternField
+	{
+		const google::protobuf::FieldDescriptor*	mString;
+		const google::protobuf::FieldDescriptor*	mId;
+	};
+	typedef std::vector<InternField> FieldList;
+	typedef std::map<const google::protobuf::Descriptor*, FieldList> FieldCache;
+	mutable FieldCache	mFieldCache;
+
+	const FieldList& GetInternedFields(const google::protobuf::Descriptor* desc) const;
+};
+
+#endif
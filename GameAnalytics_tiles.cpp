@@ -0,0 +1,505 @@
+#include "GameAnalytics_tiles.h"
+
+#include <set>
+#include <cmath>
+#include <cstdio>
+#include <cctype>
+#include <cstring>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "fastlz.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+static const uint32_t TileFileMagic = 0x54484147; // GAHT
+
+static void MakeDirectory(const std::string& path)
+{
+#ifdef _WIN32
+	_mkdir(path.c_str());
+#else
+	mkdir(path.c_str(), 0755);
+#endif
+}
+
+static void RemoveDirectory(const std::string& path)
+{
+#ifdef _WIN32
+	_rmdir(path.c_str());
+#else
+	rmdir(path.c_str());
+#endif
+}
+
+static uint64_t HashString(const std::string& str)
+{
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ull;
+	for (size_t i = 0; i < str.size(); ++i)
+	{
+		hash ^= (uint8_t)str[i];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+bool HeatmapTilePyramid::TileId::operator<(const TileId& other) const
+{
+	if (mLevel != other.mLevel)
+		return mLevel < other.mLevel;
+	if (mY != other.mY)
+		return mY < other.mY;
+	return mX < other.mX;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+HeatmapTilePyramid::HeatmapTilePyramid(const float worldMins[2], const float worldMaxs[2], int imageSize, float eventRadius, const std::string& cacheDirectory)
+	: mRadius(eventRadius)
+	, mImageSize(std::max(imageSize, 1))
+	, mNumThreads(0)
+	, mCacheDirectory(cacheDirectory)
+{
+	for (int i = 0; i < 2; ++i)
+	{
+		mWorldMins[i] = worldMins[i];
+		mWorldMaxs[i] = worldMaxs[i];
+	}
+
+	// sized like HeatmapRasterizer::Init so a level matches the single image of the same size
+	const float worldSizeX = std::max(ceilf(worldMaxs[0] - worldMins[0]), 1.0f);
+	const float worldSizeY = std::max(ceilf(worldMaxs[1] - worldMins[1]), 1.0f);
+	mPixelSize = std::max(worldSizeX, worldSizeY) / (float)mImageSize;
+
+	const int width = std::max((int)ceilf(worldSizeX / mPixelSize), 1);
+	const int height = std::max((int)ceilf(worldSizeY / mPixelSize), 1);
+	mTilesX = (width + TileSize - 1) / TileSize;
+	mTilesY = (height + TileSize - 1) / TileSize;
+
+	mNumLevels = 1;
+	while ((1 << (mNumLevels - 1)) < std::max(mTilesX, mTilesY))
+		++mNumLevels;
+}
+
+void HeatmapTilePyramid::GetLevelSize(int level, int& tilesX, int& tilesY) const
+{
+	const int shift = mNumLevels - 1 - level;
+	tilesX = (mTilesX + (1 << shift) - 1) >> shift;
+	tilesY = (mTilesY + (1 << shift) - 1) >> shift;
+}
+
+std::string HeatmapTilePyramid::LayerKey(const std::string& session, const std::string& source,
+	const std::vector< std::pair<std::string, std::string> >& filters) const
+{
+	std::vector< std::pair<std::string, std::string> > sorted = filters;
+	std::sort(sorted.begin(), sorted.end());
+
+	// anything that changes the pixels of a tile goes into the hash
+	std::string settings;
+	for (size_t i = 0; i < sorted.size(); ++i)
+		settings += sorted[i].first + "=" + sorted[i].second + ";";
+
+	char buffer[256];
+	snprintf(buffer, sizeof(buffer), "%.9g %.9g %.9g %.9g %d %.9g %d", mWorldMins[0], mWorldMins[1], mWorldMaxs[0], mWorldMaxs[1], mImageSize, mRadius, (int)TileSize);
+	settings += buffer;
+
+	// session names like s:12 need to be safe in a path
+	std::string key = session + "_" + source;
+	for (size_t i = 0; i < key.size(); ++i)
+	{
+		if (!isalnum((unsigned char)key[i]) && key[i] != '_' && key[i] != '-')
+			key[i] = '-';
+	}
+
+	snprintf(buffer, sizeof(buffer), "_%016llx", (unsigned long long)HashString(settings));
+	return key + buffer;
+}
+
+void HeatmapTilePyramid::AddPoint(float x, float y, float weight, float radius)
+{
+	Point pt;
+	pt.mX = x;
+	pt.mY = y;
+	pt.mWeight = weight;
+	pt.mRadius = radius > 0.0f ? radius : mRadius;
+	mPoints.push_back(pt);
+}
+
+void HeatmapTilePyramid::AddLine(float x0, float y0, float x1, float y1, float weight, float radius)
+{
+	Segment seg;
+	seg.mX0 = x0;
+	seg.mY0 = y0;
+	seg.mX1 = x1;
+	seg.mY1 = y1;
+	seg.mWeight = weight;
+	seg.mRadius = radius > 0.0f ? radius : mRadius;
+	mSegments.push_back(seg);
+}
+
+bool HeatmapTilePyramid::BuildLayer(const std::string& layerKey, bool append, std::string& error)
+{
+	std::vector<float> levelMax;
+	std::vector<TileId> tiles;
+	if (!append || !LoadLayer(layerKey, levelMax, tiles))
+	{
+		RemoveLayer(layerKey);
+		levelMax.assign(mNumLevels, 0.0f);
+		tiles.clear();
+	}
+
+	MakeDirectory(mCacheDirectory);
+	MakeDirectory(LayerPath(layerKey));
+
+	// tiles are rendered with a border wide enough for the largest kernel, so points spread across tile edges
+	float maxRadius = 0.0f;
+	for (size_t i = 0; i < mPoints.size(); ++i)
+		maxRadius = std::max(maxRadius, mPoints[i].mRadius);
+	for (size_t i = 0; i < mSegments.size(); ++i)
+		maxRadius = std::max(maxRadius, mSegments[i].mRadius);
+
+	const int margin = (int)ceilf(maxRadius / mPixelSize * 1.5f) + 2;
+	const float marginWorld = margin * mPixelSize;
+	const float tileWorld = TileSize * mPixelSize;
+
+	// points and segments by the tiles their bounds overlap
+	std::vector< std::vector<uint32_t> > buckets((size_t)mTilesX * mTilesY);
+	std::vector< std::vector<uint32_t> > segmentBuckets((size_t)mTilesX * mTilesY);
+	const auto addToTiles = [&](std::vector< std::vector<uint32_t> >& tileBuckets, uint32_t index, float minX, float minY, float maxX, float maxY)
+	{
+		const int x0 = std::max((int)floorf((minX - marginWorld - mWorldMins[0]) / tileWorld), 0);
+		const int x1 = std::min((int)floorf((maxX + marginWorld - mWorldMins[0]) / tileWorld), mTilesX - 1);
+		const int y0 = std::max((int)floorf((mWorldMaxs[1] - maxY - marginWorld) / tileWorld), 0);
+		const int y1 = std::min((int)floorf((mWorldMaxs[1] - minY + marginWorld) / tileWorld), mTilesY - 1);
+
+		for (int y = y0; y <= y1; ++y)
+		{
+			for (int x = x0; x <= x1; ++x)
+				tileBuckets[(size_t)y * mTilesX + x].push_back(index);
+		}
+	};
+
+	for (size_t i = 0; i < mPoints.size(); ++i)
+		addToTiles(buckets, (uint32_t)i, mPoints[i].mX, mPoints[i].mY, mPoints[i].mX, mPoints[i].mY);
+
+	for (size_t i = 0; i < mSegments.size(); ++i)
+	{
+		const Segment& seg = mSegments[i];
+		addToTiles(segmentBuckets, (uint32_t)i, std::min(seg.mX0, seg.mX1), std::min(seg.mY0, seg.mY1), std::max(seg.mX0, seg.mX1), std::max(seg.mY0, seg.mY1));
+	}
+
+	std::vector<TileId> touched;
+	for (size_t i = 0; i < buckets.size(); ++i)
+	{
+		if (buckets[i].empty() && segmentBuckets[i].empty())
+			continue;
+
+		TileId tile;
+		tile.mLevel = mNumLevels - 1;
+		tile.mX = (int)(i % mTilesX);
+		tile.mY = (int)(i / mTilesX);
+		touched.push_back(tile);
+	}
+
+	// the last level straight from the points, one single threaded rasterizer per tile
+	std::vector<float> tileMax(touched.size(), 0.0f);
+	std::vector<char> tileFailed(touched.size(), 0);
+	HeatmapParallelFor((int)touched.size(), mNumThreads, [&](int begin, int end)
+	{
+		HeatmapRasterizer heatmap;
+		heatmap.SetThreadCount(1);
+
+		std::vector<float> values;
+		for (int t = begin; t < end; ++t)
+		{
+			const TileId& tile = touched[t];
+			const float left = mWorldMins[0] + tile.mX * tileWorld - marginWorld;
+			const float top = mWorldMaxs[1] - tile.mY * tileWorld + marginWorld;
+			heatmap.InitRegion(left, top, mPixelSize, TileSize + margin * 2, TileSize + margin * 2, mRadius);
+
+			const std::vector<uint32_t>& bucket = buckets[(size_t)tile.mY * mTilesX + tile.mX];
+			for (size_t i = 0; i < bucket.size(); ++i)
+			{
+				const Point& pt = mPoints[bucket[i]];
+				heatmap.AddPoint(pt.mX, pt.mY, pt.mWeight, pt.mRadius);
+			}
+
+			const std::vector<uint32_t>& segmentBucket = segmentBuckets[(size_t)tile.mY * mTilesX + tile.mX];
+			for (size_t i = 0; i < segmentBucket.size(); ++i)
+			{
+				const Segment& seg = mSegments[segmentBucket[i]];
+				heatmap.AddLine(seg.mX0, seg.mY0, seg.mX1, seg.mY1, seg.mWeight, seg.mRadius);
+			}
+			heatmap.Render();
+
+			const std::string path = TilePath(layerKey, tile);
+			if (!append || !ReadTileFile(path, values))
+				values.assign(TileSize * TileSize, 0.0f);
+
+			const float* image = heatmap.GetImage();
+			const int stride = heatmap.GetWidth();
+			for (int y = 0; y < TileSize; ++y)
+			{
+				const float* src = image + (size_t)(y + margin) * stride + margin;
+				float* dst = &values[(size_t)y * TileSize];
+				for (int x = 0; x < TileSize; ++x)
+				{
+					dst[x] += src[x];
+					tileMax[t] = std::max(tileMax[t], dst[x]);
+				}
+			}
+
+			tileFailed[t] = !WriteTileFile(path, values);
+		}
+	});
+	mPoints.clear();
+	mSegments.clear();
+
+	// each level above from the 2x2 children of the tiles touched below it
+	std::vector<TileId> level = touched;
+	for (int l = mNumLevels - 1; l >= 0; --l)
+	{
+		for (size_t t = 0; t < level.size(); ++t)
+		{
+			if (tileFailed[t])
+			{
+				error = "failed writing " + TilePath(layerKey, level[t]);
+				return false;
+			}
+			levelMax[l] = std::max(levelMax[l], tileMax[t]);
+			tiles.push_back(level[t]);
+		}
+
+		if (l == 0)
+			break;
+
+		std::set<TileId> parentSet;
+		for (size_t t = 0; t < level.size(); ++t)
+		{
+			TileId parent;
+			parent.mLevel = l - 1;
+			parent.mX = level[t].mX / 2;
+			parent.mY = level[t].mY / 2;
+			parentSet.insert(parent);
+		}
+
+		std::vector<TileId> parents(parentSet.begin(), parentSet.end());
+		tileMax.assign(parents.size(), 0.0f);
+		tileFailed.assign(parents.size(), 0);
+
+		HeatmapParallelFor((int)parents.size(), mNumThreads, [&](int begin, int end)
+		{
+			std::vector<float> child, values;
+			for (int t = begin; t < end; ++t)
+			{
+				const TileId& parent = parents[t];
+				values.assign(TileSize * TileSize, 0.0f);
+
+				for (int q = 0; q < 4; ++q)
+				{
+					TileId childId;
+					childId.mLevel = l;
+					childId.mX = parent.mX * 2 + (q & 1);
+					childId.mY = parent.mY * 2 + (q >> 1);
+					if (!ReadTileFile(TilePath(layerKey, childId), child))
+						continue;
+
+					const int offsetX = (q & 1) * TileSize / 2;
+					const int offsetY = (q >> 1) * TileSize / 2;
+					for (int y = 0; y < TileSize / 2; ++y)
+					{
+						const float* src0 = &child[(size_t)(y * 2) * TileSize];
+						const float* src1 = src0 + TileSize;
+						float* dst = &values[(size_t)(y + offsetY) * TileSize + offsetX];
+						for (int x = 0; x < TileSize / 2; ++x)
+							dst[x] = (src0[x * 2] + src0[x * 2 + 1] + src1[x * 2] + src1[x * 2 + 1]) * 0.25f;
+					}
+				}
+
+				tileMax[t] = *std::max_element(values.begin(), values.end());
+				tileFailed[t] = !WriteTileFile(TilePath(layerKey, parent), values);
+			}
+		});
+		level.swap(parents);
+	}
+
+	std::sort(tiles.begin(), tiles.end());
+	tiles.erase(std::unique(tiles.begin(), tiles.end(), [](const TileId& a, const TileId& b) { return !(a < b) && !(b < a); }), tiles.end());
+
+	if (!SaveLayer(layerKey, levelMax, tiles))
+	{
+		error = "failed writing the manifest of " + layerKey;
+		return false;
+	}
+	return true;
+}
+
+bool HeatmapTilePyramid::HasLayer(const std::string& layerKey) const
+{
+	FILE* fp = fopen((LayerPath(layerKey) + "/layer.txt").c_str(), "r");
+	if (fp == NULL)
+		return false;
+	fclose(fp);
+	return true;
+}
+
+void HeatmapTilePyramid::RemoveLayer(const std::string& layerKey)
+{
+	std::vector<float> levelMax;
+	std::vector<TileId> tiles;
+	if (!LoadLayer(layerKey, levelMax, tiles))
+		return;
+
+	for (size_t i = 0; i < tiles.size(); ++i)
+		remove(TilePath(layerKey, tiles[i]).c_str());
+	remove((LayerPath(layerKey) + "/layer.txt").c_str());
+	RemoveDirectory(LayerPath(layerKey));
+}
+
+bool HeatmapTilePyramid::ReadTile(const std::vector<std::string>& layerKeys, int level, int x, int y, std::vector<float>& values) const
+{
+	TileId tile;
+	tile.mLevel = level;
+	tile.mX = x;
+	tile.mY = y;
+
+	bool found = false;
+	std::vector<float> layer;
+	for (size_t i = 0; i < layerKeys.size(); ++i)
+	{
+		if (!ReadTileFile(TilePath(layerKeys[i], tile), layer))
+			continue;
+
+		if (!found)
+			values.swap(layer);
+		else
+		{
+			for (size_t p = 0; p < values.size(); ++p)
+				values[p] += layer[p];
+		}
+		found = true;
+	}
+	return found;
+}
+
+bool HeatmapTilePyramid::WriteTilePng(const std::vector<std::string>& layerKeys, int level, int x, int y, const char* filename, std::string& error) const
+{
+	std::vector<float> values;
+	if (!ReadTile(layerKeys, level, x, y, values))
+		values.assign(TileSize * TileSize, 0.0f);
+
+	// sessions overlapping in the same hot spot can go over this and saturate
+	float maxValue = 0.0f;
+	for (size_t i = 0; i < layerKeys.size(); ++i)
+	{
+		std::vector<float> levelMax;
+		std::vector<TileId> tiles;
+		if (LoadLayer(layerKeys[i], levelMax, tiles) && level < (int)levelMax.size())
+			maxValue = std::max(maxValue, levelMax[level]);
+	}
+
+	const float scale = maxValue > 0.0f ? 1.0f / maxValue : 0.0f;
+
+	std::vector<uint8_t> rgb(values.size() * 3);
+	for (size_t i = 0; i < values.size(); ++i)
+		HeatmapColor(values[i] * scale, &rgb[i * 3]);
+
+	return WriteHeatmapPng(filename, TileSize, TileSize, &rgb[0], error);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+std::string HeatmapTilePyramid::LayerPath(const std::string& layerKey) const
+{
+	return mCacheDirectory + "/" + layerKey;
+}
+
+std::string HeatmapTilePyramid::TilePath(const std::string& layerKey, const TileId& tile) const
+{
+	char name[64];
+	snprintf(name, sizeof(name), "/%d_%d_%d.tile", tile.mLevel, tile.mX, tile.mY);
+	return LayerPath(layerKey) + name;
+}
+
+bool HeatmapTilePyramid::LoadLayer(const std::string& layerKey, std::vector<float>& levelMax, std::vector<TileId>& tiles) const
+{
+	FILE* fp = fopen((LayerPath(layerKey) + "/layer.txt").c_str(), "r");
+	if (fp == NULL)
+		return false;
+
+	int numLevels = 0;
+	bool ok = fscanf(fp, " levels %d", &numLevels) == 1 && numLevels == mNumLevels;
+
+	levelMax.assign(mNumLevels, 0.0f);
+	for (int i = 0; ok && i < numLevels; ++i)
+		ok = fscanf(fp, " %f", &levelMax[i]) == 1;
+
+	TileId tile;
+	while (ok && fscanf(fp, " tile %d %d %d", &tile.mLevel, &tile.mX, &tile.mY) == 3)
+		tiles.push_back(tile);
+
+	fclose(fp);
+	return ok;
+}
+
+bool HeatmapTilePyramid::SaveLayer(const std::string& layerKey, const std::vector<float>& levelMax, const std::vector<TileId>& tiles) const
+{
+	FILE* fp = fopen((LayerPath(layerKey) + "/layer.txt").c_str(), "w");
+	if (fp == NULL)
+		return false;
+
+	fprintf(fp, "levels %d\n", (int)levelMax.size());
+	for (size_t i = 0; i < levelMax.size(); ++i)
+		fprintf(fp, "%.9g\n", levelMax[i]);
+	for (size_t i = 0; i < tiles.size(); ++i)
+		fprintf(fp, "tile %d %d %d\n", tiles[i].mLevel, tiles[i].mX, tiles[i].mY);
+
+	return fclose(fp) == 0;
+}
+
+bool HeatmapTilePyramid::ReadTileFile(const std::string& path, std::vector<float>& values)
+{
+	FILE* fp = fopen(path.c_str(), "rb");
+	if (fp == NULL)
+		return false;
+
+	uint32_t header[2] = { 0, 0 };
+	std::vector<char> compressed;
+	bool ok = fread(header, sizeof(header), 1, fp) == 1 && header[0] == TileFileMagic;
+	if (ok)
+	{
+		compressed.resize(header[1]);
+		ok = header[1] > 0 && fread(&compressed[0], 1, compressed.size(), fp) == compressed.size();
+	}
+	fclose(fp);
+
+	if (!ok)
+		return false;
+
+	const int size = TileSize * TileSize * sizeof(float);
+	values.resize(TileSize * TileSize);
+	return fastlz_decompress(&compressed[0], (int)compressed.size(), &values[0], size) == size;
+}
+
+bool HeatmapTilePyramid::WriteTileFile(const std::string& path, const std::vector<float>& values)
+{
+	// empty areas of a tile are long runs of zero, which fastlz squeezes well
+	const int size = (int)(values.size() * sizeof(float));
+	std::vector<char> compressed(size + size / 16 + 66);
+	const uint32_t header[2] = { TileFileMagic, (uint32_t)fastlz_compress(&values[0], size, &compressed[0]) };
+
+	FILE* fp = fopen(path.c_str(), "wb");
+	if (fp == NULL)
+		return false;
+
+	bool ok = fwrite(header, sizeof(header), 1, fp) == 1 && fwrite(&compressed[0], 1, header[1], fp) == header[1];
+	ok = fclose(fp) == 0 && ok;
+	return ok;
+}
@@ -0,0 +1,104 @@
+#ifndef GAMEANALYTICS_TILES_H
+#define GAMEANALYTICS_TILES_H
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+
+#include "analytics.pb.h"
+#include "GameAnalytics_heatmap.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// Heatmap output as a quadtree of fixed size tiles, cached on disk. The last level is the full resolution
+// image and every level above it is a 2x2 box downsample of the one below, down to a single tile at level 0.
+// Each session, event type and filter combination is a layer of its own under the cache directory, and
+// since binning, convolution and downsampling are all linear a view over several sessions is the sum of
+// their layers. Adding a session only renders its layer, appending events to a layer only re-renders the
+// tiles they touch and the parents of those tiles.
+class HeatmapTilePyramid : public HeatmapPointSink
+{
+public:
+	enum { TileSize = 256 };
+
+	// imageSize pixels along the longer world axis at the last level, like HeatmapDef
+	HeatmapTilePyramid(const float worldMins[2], const float worldMaxs[2], int imageSize, float eventRadius, const std::string& cacheDirectory);
+
+	int GetNumLevels() const { return mNumLevels; }
+	void GetLevelSize(int level, int& tilesX, int& tilesY) const;
+
+	// the cache name of a layer, the session and source plus a hash of the filters and the pyramid settings.
+	// the source names what was rendered, like the event type
+	std::string LayerKey(const std::string& session, const std::string& source,
+		const std::vector< std::pair<std::string, std::string> >& filters = std::vector< std::pair<std::string, std::string> >()) const;
+
+	// points and segments for the next BuildLayer
+	void AddPoint(float x, float y, float weight = 1.0f, float radius = 0.0f);
+	void AddLine(float x0, float y0, float x1, float y1, float weight = 1.0f, float radius = 0.0f);
+
+	// renders the pending points into the tiles of the layer, in parallel, and rebuilds the parents of the tiles touched.
+	// append adds to the tiles already cached, otherwise the layer is replaced
+	bool BuildLayer(const std::string& layerKey, bool append, std::string& error);
+	bool HasLayer(const std::string& layerKey) const;
+	void RemoveLayer(const std::string& layerKey);
+
+	// the sum of a tile over the layers, false when none of them has it
+	bool ReadTile(const std::vector<std::string>& layerKeys, int level, int x, int y, std::vector<float>& values) const;
+	// colour ramped against the largest value of the level over the layers, so tiles of a level match
+	bool WriteTilePng(const std::vector<std::string>& layerKeys, int level, int x, int y, const char* filename, std::string& error) const;
+
+	void SetThreadCount(int numThreads) { mNumThreads = numThreads; }
+private:
+	struct Point
+	{
+		float	mX;
+		float	mY;
+		float	mWeight;
+		float	mRadius;
+	};
+
+	struct Segment
+	{
+		float	mX0;
+		float	mY0;
+		float	mX1;
+		float	mY1;
+		float	mWeight;
+		float	mRadius;
+	};
+
+	struct TileId
+	{
+		int		mLevel;
+		int		mX;
+		int		mY;
+
+		bool operator<(const TileId& other) const;
+	};
+
+	float					mWorldMins[2];
+	float					mWorldMaxs[2];
+	float					mPixelSize;
+	float					mRadius;
+	int						mImageSize;
+	int						mTilesX;
+	int						mTilesY;
+	int						mNumLevels;
+	int						mNumThreads;
+	std::string				mCacheDirectory;
+
+	std::vector<Point>		mPoints;
+	std::vector<Segment>	mSegments;
+
+	std::string LayerPath(const std::string& layerKey) const;
+	std::string TilePath(const std::string& layerKey, const TileId& tile) const;
+
+	bool LoadLayer(const std::string& layerKey, std::vector<float>& levelMax, std::vector<TileId>& tiles) const;
+	bool SaveLayer(const std::string& layerKey, const std::vector<float>& levelMax, const std::vector<TileId>& tiles) const;
+
+	static bool ReadTileFile(const std::string& path, std::vector<float>& values);
+	static bool WriteTileFile(const std::string& path, const std::vector<float>& values);
+};
+
+#endif
@@ -0,0 +1,197 @@
+#include "GameAnalytics_trajectory.h"
+#include "GameAnalytics_encoding.h"
+
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////
+
+TrajectoryEncoder::TrajectoryEncoder(int samplesPerChunk, float precision)
+	: mSamplesPerChunk(1)
+	, mPrecision(0.0625f)
+{
+	SetChunkSize(samplesPerChunk);
+	SetPrecision(precision);
+}
+
+void TrajectoryEncoder::SetChunkSize(int samplesPerChunk)
+{
+	mSamplesPerChunk = samplesPerChunk > 1 ? samplesPerChunk : 1;
+}
+
+void TrajectoryEncoder::SetPrecision(float precision)
+{
+	if (precision > 0.0f)
+		mPrecision = precision;
+}
+
+bool TrajectoryEncoder::AddSample(int entityIndex, int team, int64_t timeStamp, const Analytics::Vec3& position, Analytics::GameEntityTrajectory& chunkOut)
+{
+	EntityBuffer& buffer = mEntities[entityIndex];
+
+	// a chunk carries a single team, so a team change closes the current one
+	bool chunkReady = false;
+	if (!buffer.mSamples.empty() && buffer.mTeam != team)
+	{
+		EncodeChunk(entityIndex, buffer, chunkOut);
+		chunkReady = true;
+	}
+
+	Sample sample;
+	sample.mTime = timeStamp;
+	sample.mPos[0] = (int64_t)llround(position.x() / mPrecision);
+	sample.mPos[1] = (int64_t)llround(position.y() / mPrecision);
+	sample.mPos[2] = (int64_t)llround(position.z() / mPrecision);
+
+	buffer.mTeam = team;
+	buffer.mSamples.push_back(sample);
+
+	if (!chunkReady && (int)buffer.mSamples.size() >= mSamplesPerChunk)
+	{
+		EncodeChunk(entityIndex, buffer, chunkOut);
+		chunkReady = true;
+	}
+	return chunkReady;
+}
+
+bool TrajectoryEncoder::Flush(int entityIndex, Analytics::GameEntityTrajectory& chunkOut)
+{
+	EntityMap::iterator it = mEntities.find(entityIndex);
+	if (it == mEntities.end() || it->second.mSamples.empty())
+		return false;
+
+	EncodeChunk(entityIndex, it->second, chunkOut);
+	return true;
+}
+
+void TrajectoryEncoder::FlushAll(std::vector<Analytics::GameEntityTrajectory>& chunksOut)
+{
+	for (EntityMap::iterator it = mEntities.begin(); it != mEntities.end(); ++it)
+	{
+		if (it->second.mSamples.empty())
+			continue;
+
+		chunksOut.push_back(Analytics::GameEntityTrajectory());
+		EncodeChunk(it->first, it->second, chunksOut.back());
+	}
+}
+
+void TrajectoryEncoder::EncodeChunk(int entityIndex, EntityBuffer& buffer, Analytics::GameEntityTrajectory& chunkOut) const
+{
+	const std::vector<Sample>& samples = buffer.mSamples;
+
+	chunkOut.Clear();
+	chunkOut.set_entityindex(entityIndex);
+	chunkOut.set_team(buffer.mTeam);
+	chunkOut.set_samplecount((uint32_t)samples.size());
+	chunkOut.set_precision(mPrecision);
+
+	std::string& data = *chunkOut.mutable_samples();
+	data.reserve(samples.size() * 5);
+
+	// time column, delta-of-delta so a steady sample rate costs a byte per sample
+	int64_t prevTime = 0;
+	int64_t prevDelta = 0;
+	for (size_t i = 0; i < samples.size(); ++i)
+	{
+		const int64_t t = samples[i].mTime;
+		if (i == 0)
+		{
+			WriteSignedVarint(data, t);
+		}
+		else
+		{
+			const int64_t delta = t - prevTime;
+			WriteSignedVarint(data, i == 1 ? delta : delta - prevDelta);
+			prevDelta = delta;
+		}
+		prevTime = t;
+	}
+
+	// position columns, one axis at a time
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		int64_t prev = 0;
+		for (size_t i = 0; i < samples.size(); ++i)
+		{
+			WriteSignedVarint(data, samples[i].mPos[axis] - prev);
+			prev = samples[i].mPos[axis];
+		}
+	}
+
+	buffer.mSamples.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void TrajectoryArrays::clear()
+{
+	mTime.clear();
+	mX.clear();
+	mY.clear();
+	mZ.clear();
+}
+
+bool TrajectoryDecoder::Decode(const Analytics::GameEntityTrajectory& chunk, TrajectoryArrays& arraysOut)
+{
+	const size_t count = chunk.samplecount();
+	const float precision = chunk.precision() > 0.0f ? chunk.precision() : 1.0f;
+
+	// every sample takes at least a byte in each of the 4 columns, a larger count is a corrupt chunk and
+	// resizing for it could allocate gigabytes
+	if (count > chunk.samples().size() / 4)
+		return false;
+
+	const char* cursor = chunk.samples().data();
+	const char* end = cursor + chunk.samples().size();
+
+	const size_t base = arraysOut.mTime.size();
+	arraysOut.mTime.resize(base + count);
+	arraysOut.mX.resize(base + count);
+	arraysOut.mY.resize(base + count);
+	arraysOut.mZ.resize(base + count);
+
+	bool ok = true;
+
+	int64_t prevTime = 0;
+	int64_t prevDelta = 0;
+	for (size_t i = 0; i < count && ok; ++i)
+	{
+		int64_t v = 0;
+		ok = ReadSignedVarint(cursor, end, v);
+
+		if (i == 0)
+		{
+			prevTime = v;
+		}
+		else
+		{
+			prevDelta = (i == 1) ? v : prevDelta + v;
+			prevTime += prevDelta;
+		}
+		arraysOut.mTime[base + i] = prevTime;
+	}
+
+	float* columns[3] = { arraysOut.mX.data() + base, arraysOut.mY.data() + base, arraysOut.mZ.data() + base };
+	for (int axis = 0; axis < 3 && ok; ++axis)
+	{
+		int64_t pos = 0;
+		for (size_t i = 0; i < count && ok; ++i)
+		{
+			int64_t delta = 0;
+			ok = ReadSignedVarint(cursor, end, delta);
+
+			pos += delta;
+			columns[axis][i] = (float)pos * precision;
+		}
+	}
+
+	// drop everything from a truncated chunk
+	if (!ok)
+	{
+		arraysOut.mTime.resize(base);
+		arraysOut.mX.resize(base);
+		arraysOut.mY.resize(base);
+		arraysOut.mZ.resize(base);
+	}
+	return ok;
+}
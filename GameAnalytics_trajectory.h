@@ -0,0 +1,75 @@
+#ifndef GAMEANALYTICS_TRAJECTORY_H
+#define GAMEANALYTICS_TRAJECTORY_H
+
+#include <map>
+#include <vector>
+#include <cstdint>
+
+#include "analytics.pb.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// Buffers GameEntityPosition samples per entity and packs them into GameEntityTrajectory chunks.
+// The samples field of a chunk is columnar, all values are zigzag varints:
+//		time:	first timestamp, first delta, then delta-of-delta for the remaining samples
+//		x/y/z:	first position, then deltas. positions are quantized to the chunk precision
+class TrajectoryEncoder
+{
+public:
+	TrajectoryEncoder(int samplesPerChunk = 64, float precision = 0.0625f);
+
+	void SetChunkSize(int samplesPerChunk);
+	void SetPrecision(float precision);
+
+	// returns true when the sample completed a chunk for this entity, which is written to chunkOut
+	bool AddSample(int entityIndex, int team, int64_t timeStamp, const Analytics::Vec3& position, Analytics::GameEntityTrajectory& chunkOut);
+
+	// write out partial chunks, for example at the end of the session
+	bool Flush(int entityIndex, Analytics::GameEntityTrajectory& chunkOut);
+	void FlushAll(std::vector<Analytics::GameEntityTrajectory>& chunksOut);
+private:
+	struct Sample
+	{
+		int64_t		mTime;
+		int64_t		mPos[3];
+	};
+
+	struct EntityBuffer
+	{
+		int					mTeam;
+		std::vector<Sample>	mSamples;
+
+		EntityBuffer() : mTeam(0) {}
+	};
+
+	typedef std::map<int, EntityBuffer> EntityMap;
+	EntityMap		mEntities;
+
+	int				mSamplesPerChunk;
+	float			mPrecision;
+
+	void EncodeChunk(int entityIndex, EntityBuffer& buffer, Analytics::GameEntityTrajectory& chunkOut) const;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// decoded trajectory samples, one array per column
+struct TrajectoryArrays
+{
+	std::vector<int64_t>	mTime;
+	std::vector<float>		mX;
+	std::vector<float>		mY;
+	std::vector<float>		mZ;
+
+	size_t size() const { return mTime.size(); }
+	void clear();
+};
+
+class TrajectoryDecoder
+{
+public:
+	// appends the chunk samples to the arrays
+	static bool Decode(const Analytics::GameEntityTrajectory& chunk, TrajectoryArrays& arraysOut);
+};
+
+#endif
@@ -0,0 +1,63 @@
+#include "GameAnalytics_types.h"
+
+#include "google/protobuf/descriptor.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+uint32_t SessionTypeRegistry::Register(const google::protobuf::Descriptor* desc, bool& isNew)
+{
+	IdMap::const_iterator it = mIds.find(desc);
+	if (it != mIds.end())
+	{
+		isNew = false;
+		return it->second;
+	}
+
+	mTypes.push_back(desc);
+
+	const uint32_t id = (uint32_t)mTypes.size();
+	mIds[desc] = id;
+	isNew = true;
+	return id;
+}
+
+bool SessionTypeRegistry::Insert(uint32_t id, const std::string& fullName)
+{
+	if (id == 0)
+		return false;
+
+	const google::protobuf::Descriptor* desc = google::protobuf::DescriptorPool::generated_pool()->FindMessageTypeByName(fullName);
+	if (desc == NULL)
+		return false;
+
+	if (mTypes.size() < id)
+		mTypes.resize(id, NULL);
+
+	mTypes[id - 1] = desc;
+	mIds[desc] = id;
+	return true;
+}
+
+const google::protobuf::Descriptor* SessionTypeRegistry::Find(uint32_t id) const
+{
+	if (id == 0 || id > mTypes.size())
+		return NULL;
+	return mTypes[id - 1];
+}
+
+uint32_t SessionTypeRegistry::FindId(const google::protobuf::Descriptor* desc) const
+{
+	IdMap::const_iterator it = mIds.find(desc);
+	return it != mIds.end() ? it->second : 0;
+}
+
+void SessionTypeRegistry::Clear()
+{
+	mIds.clear();
+	mTypes.clear();
+}
+
+std::string SessionTypeRegistry::TypeKey(uint32_t id)
+{
+	return "t:" + std::to_string(id);
+}
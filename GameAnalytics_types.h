@@ -0,0 +1,41 @@
+#ifndef GAMEANALYTICS_TYPES_H
+#define GAMEANALYTICS_TYPES_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include "analytics.pb.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// Per session mapping of message types to small integers, used to build short redis keys and channels
+// such as s:{session}:t:{type} instead of the descriptor name. Each type is published once to the
+// session types hash as id -> full type name, so readers can map keys back to descriptors.
+class SessionTypeRegistry
+{
+public:
+	// writer side, returns the id of the type and whether this is the first time it was seen
+	uint32_t Register(const google::protobuf::Descriptor* desc, bool& isNew);
+
+	// reader side, resolves the name against the generated pool
+	bool Insert(uint32_t id, const std::string& fullName);
+
+	const google::protobuf::Descriptor* Find(uint32_t id) const;
+	// 0 if the type has not been registered
+	uint32_t FindId(const google::protobuf::Descriptor* desc) const;
+
+	void Clear();
+	bool Empty() const { return mIds.empty(); }
+	size_t Size() const { return mIds.size(); }
+
+	// the key fragment for a type id, t:{id}
+	static std::string TypeKey(uint32_t id);
+private:
+	typedef std::map<const google::protobuf::Descriptor*, uint32_t> IdMap;
+	IdMap											mIds;
+	std::vector<const google::protobuf::Descriptor*>	mTypes;	// indexed by id - 1, 0 is reserved for unset
+};
+
+#endif
@@ -0,0 +1,332 @@
+#include "GameAnalytics_voxels.h"
+
+#include <cmath>
+#include <climits>
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////
+
+// point ranges binned per task in Build, fixed so the sums don't depend on the thread count
+static const int BuildChunks = 64;
+
+static int FloorDiv(int value, int divisor)
+{
+	return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+uint64_t HeatmapVoxelGrid::BlockKey(int x, int y, int z)
+{
+	// 21 bits per axis around the origin
+	return ((uint64_t)(x + (1 << 20)) & 0x1fffff) | (((uint64_t)(y + (1 << 20)) & 0x1fffff) << 21) | (((uint64_t)(z + (1 << 20)) & 0x1fffff) << 42);
+}
+
+void HeatmapVoxelGrid::BlockCoords(uint64_t key, int coords[3])
+{
+	for (int i = 0; i < 3; ++i)
+		coords[i] = (int)((key >> (21 * i)) & 0x1fffff) - (1 << 20);
+}
+
+size_t HeatmapVoxelGrid::ShardOf(uint64_t key)
+{
+	key ^= key >> 29;
+	key *= 0xbf58476d1ce4e5b9ull;
+	key ^= key >> 32;
+	return (size_t)(key & (NumShards - 1));
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+HeatmapVoxelGrid::HeatmapVoxelGrid(float voxelSize, float eventRadius)
+	: mVoxelSize(std::max(voxelSize, 1e-3f))
+	, mRadius(eventRadius)
+	, mNumThreads(0)
+	, mLastBucket(INT_MIN)
+	, mLastLayer(0)
+{
+}
+
+void HeatmapVoxelGrid::Clear()
+{
+	mLayers.clear();
+	mLayerIndex.clear();
+	mLastBucket = INT_MIN;
+	mLastLayer = 0;
+}
+
+HeatmapVoxelGrid::Layer& HeatmapVoxelGrid::GetLayer(float radius)
+{
+	if (radius <= 0.0f)
+		radius = mRadius;
+
+	// steps of about 9% of the radius, field driven radii don't make a layer per event
+	const int bucket = radius > 0.0f ? (int)lroundf(log2f(radius) * 8.0f) : INT_MIN + 1;
+	if (bucket == mLastBucket && mLastLayer < mLayers.size())
+		return mLayers[mLastLayer];
+
+	mLastBucket = bucket;
+
+	std::unordered_map<int, size_t>::const_iterator it = mLayerIndex.find(bucket);
+	if (it != mLayerIndex.end())
+	{
+		mLastLayer = it->second;
+		return mLayers[mLastLayer];
+	}
+
+	mLastLayer = mLayers.size();
+	mLayerIndex[bucket] = mLastLayer;
+	mLayers.push_back(Layer());
+
+	Layer& layer = mLayers.back();
+	layer.mRadius = radius > 0.0f ? exp2f((float)bucket / 8.0f) : 0.0f;
+	layer.mShards.resize(NumShards);
+	return layer;
+}
+
+void HeatmapVoxelGrid::AddPoint(const float pos[3], float weight, float radius)
+{
+	Point pt;
+	pt.mPos[0] = pos[0];
+	pt.mPos[1] = pos[1];
+	pt.mPos[2] = pos[2];
+	pt.mWeight = weight;
+	GetLayer(radius).mPending.push_back(pt);
+}
+
+bool HeatmapVoxelGrid::AddEvent(const google::protobuf::Message& msg, const PointEventAccessor& accessor)
+{
+	float pos[3], radius, weight;
+	if (!accessor.Read(msg, pos, radius, weight))
+		return false;
+
+	AddPoint(pos, weight, radius);
+	return true;
+}
+
+void HeatmapVoxelGrid::Build()
+{
+	for (size_t i = 0; i < mLayers.size(); ++i)
+	{
+		if (!mLayers[i].mPending.empty())
+			BuildLayer(mLayers[i]);
+	}
+}
+
+void HeatmapVoxelGrid::BuildLayer(Layer& layer)
+{
+	const size_t numPoints = layer.mPending.size();
+	const float scale = 1.0f / mVoxelSize;
+
+	// first the voxel of every point, sorted by the shard of its block
+	std::vector< std::vector< std::vector<Voxel> > > binned(BuildChunks, std::vector< std::vector<Voxel> >(NumShards));
+	HeatmapParallelFor(BuildChunks, mNumThreads, [&](int begin, int end)
+	{
+		for (int c = begin; c < end; ++c)
+		{
+			const size_t first = numPoints * c / BuildChunks;
+			const size_t last = numPoints * (c + 1) / BuildChunks;
+			for (size_t i = first; i < last; ++i)
+			{
+				const Point& pt = layer.mPending[i];
+
+				int voxel[3], block[3];
+				for (int a = 0; a < 3; ++a)
+				{
+					voxel[a] = (int)floorf(pt.mPos[a] * scale);
+					block[a] = FloorDiv(voxel[a], BlockSize);
+				}
+
+				Voxel v;
+				v.mBlock = BlockKey(block[0], block[1], block[2]);
+				v.mIndex = (uint32_t)(((voxel[2] - block[2] * BlockSize) * BlockSize + (voxel[1] - block[1] * BlockSize)) * BlockSize + (voxel[0] - block[0] * BlockSize));
+				v.mWeight = pt.mWeight;
+				binned[c][ShardOf(v.mBlock)].push_back(v);
+			}
+		}
+	});
+
+	// then every shard adds its voxels in point order
+	HeatmapParallelFor(NumShards, mNumThreads, [&](int begin, int end)
+	{
+		for (int s = begin; s < end; ++s)
+		{
+			Shard& shard = layer.mShards[s];
+			for (int c = 0; c < BuildChunks; ++c)
+			{
+				const std::vector<Voxel>& voxels = binned[c][s];
+				for (size_t i = 0; i < voxels.size(); ++i)
+				{
+					std::pair<std::unordered_map<uint64_t, uint32_t>::iterator, bool> it = shard.mIndex.insert(std::make_pair(voxels[i].mBlock, (uint32_t)shard.mKeys.size()));
+					if (it.second)
+					{
+						shard.mKeys.push_back(voxels[i].mBlock);
+						shard.mValues.resize(shard.mValues.size() + BlockVoxels, 0.0f);
+					}
+					shard.mValues[(size_t)it.first->second * BlockVoxels + voxels[i].mIndex] += voxels[i].mWeight;
+				}
+			}
+		}
+	});
+
+	layer.mPending.clear();
+	layer.mPending.shrink_to_fit();
+}
+
+size_t HeatmapVoxelGrid::GetNumBlocks() const
+{
+	size_t count = 0;
+	for (size_t i = 0; i < mLayers.size(); ++i)
+	{
+		for (size_t s = 0; s < mLayers[i].mShards.size(); ++s)
+			count += mLayers[i].mShards[s].mKeys.size();
+	}
+	return count;
+}
+
+bool HeatmapVoxelGrid::GetBounds(float mins[3], float maxs[3]) const
+{
+	int lo[3] = { INT_MAX, INT_MAX, INT_MAX };
+	int hi[3] = { INT_MIN, INT_MIN, INT_MIN };
+	for (size_t i = 0; i < mLayers.size(); ++i)
+	{
+		for (size_t s = 0; s < mLayers[i].mShards.size(); ++s)
+		{
+			const std::vector<uint64_t>& keys = mLayers[i].mShards[s].mKeys;
+			for (size_t b = 0; b < keys.size(); ++b)
+			{
+				int coords[3];
+				BlockCoords(keys[b], coords);
+				for (int a = 0; a < 3; ++a)
+				{
+					lo[a] = std::min(lo[a], coords[a]);
+					hi[a] = std::max(hi[a], coords[a]);
+				}
+			}
+		}
+	}
+
+	if (lo[0] > hi[0])
+		return false;
+
+	const float blockSize = mVoxelSize * BlockSize;
+	for (int a = 0; a < 3; ++a)
+	{
+		mins[a] = lo[a] * blockSize;
+		maxs[a] = (hi[a] + 1) * blockSize;
+	}
+	return true;
+}
+
+void HeatmapVoxelGrid::ProjectSlice(float zMin, float zMax, HeatmapPointSink& sink) const
+{
+	const float blockSize = mVoxelSize * BlockSize;
+
+	for (size_t i = 0; i < mLayers.size(); ++i)
+	{
+		const Layer& layer = mLayers[i];
+		for (size_t s = 0; s < layer.mShards.size(); ++s)
+		{
+			const Shard& shard = layer.mShards[s];
+			for (size_t b = 0; b < shard.mKeys.size(); ++b)
+			{
+				int coords[3];
+				BlockCoords(shard.mKeys[b], coords);
+
+				// the voxels of the block with their center in the slice
+				const float blockZ = coords[2] * blockSize;
+				const int zBegin = std::max((int)ceilf((zMin - blockZ) / mVoxelSize - 0.5f), 0);
+				const int zEnd = std::min((int)ceilf((zMax - blockZ) / mVoxelSize - 0.5f), (int)BlockSize);
+				if (zBegin >= zEnd)
+					continue;
+
+				float columns[BlockSize * BlockSize] = {};
+				const float* values = &shard.mValues[b * BlockVoxels];
+				for (int z = zBegin; z < zEnd; ++z)
+				{
+					for (int c = 0; c < BlockSize * BlockSize; ++c)
+						columns[c] += values[z * BlockSize * BlockSize + c];
+				}
+
+				for (int c = 0; c < BlockSize * BlockSize; ++c)
+				{
+					if (columns[c] == 0.0f)
+						continue;
+
+					const float x = (coords[0] * BlockSize + (c % BlockSize) + 0.5f) * mVoxelSize;
+					const float y = (coords[1] * BlockSize + (c / BlockSize) + 0.5f) * mVoxelSize;
+					sink.AddPoint(x, y, columns[c], layer.mRadius);
+				}
+			}
+		}
+	}
+}
+
+void HeatmapVoxelGrid::SampleSurface(const float* positions, size_t count, std::vector<float>& values) const
+{
+	values.assign(count, 0.0f);
+
+	for (size_t i = 0; i < mLayers.size(); ++i)
+	{
+		const Layer& layer = mLayers[i];
+
+		// the same gaussian as the 2D kernel, sigma half the radius and cut at 1.5 radius. a voxel is the least it spreads
+		const float radius = std::max(layer.mRadius, mVoxelSize);
+		const float reach = radius * 1.5f;
+		const float falloff = -1.0f / (2.0f * radius * 0.5f * radius * 0.5f);
+
+		HeatmapParallelFor((int)count, mNumThreads, [&](int begin, int end)
+		{
+			std::vector<float> weights[3];
+			for (int p = begin; p < end; ++p)
+			{
+				const float* pos = positions + (size_t)p * 3;
+
+				// separable, the 3D weight of a voxel is the product of the axis weights
+				int lo[3], hi[3];
+				for (int a = 0; a < 3; ++a)
+				{
+					lo[a] = (int)floorf((pos[a] - reach) / mVoxelSize);
+					hi[a] = (int)floorf((pos[a] + reach) / mVoxelSize);
+					weights[a].resize(hi[a] - lo[a] + 1);
+					for (int v = lo[a]; v <= hi[a]; ++v)
+					{
+						const float d = (v + 0.5f) * mVoxelSize - pos[a];
+						weights[a][v - lo[a]] = expf(d * d * falloff);
+					}
+				}
+
+				float sum = 0.0f;
+				for (int bz = FloorDiv(lo[2], BlockSize); bz <= FloorDiv(hi[2], BlockSize); ++bz)
+				{
+					for (int by = FloorDiv(lo[1], BlockSize); by <= FloorDiv(hi[1], BlockSize); ++by)
+					{
+						for (int bx = FloorDiv(lo[0], BlockSize); bx <= FloorDiv(hi[0], BlockSize); ++bx)
+						{
+							const uint64_t key = BlockKey(bx, by, bz);
+							const Shard& shard = layer.mShards[ShardOf(key)];
+							std::unordered_map<uint64_t, uint32_t>::const_iterator it = shard.mIndex.find(key);
+							if (it == shard.mIndex.end())
+								continue;
+
+							const float* block = &shard.mValues[(size_t)it->second * BlockVoxels];
+							const int x0 = std::max(lo[0], bx * BlockSize), x1 = std::min(hi[0], bx * BlockSize + BlockSize - 1);
+							const int y0 = std::max(lo[1], by * BlockSize), y1 = std::min(hi[1], by * BlockSize + BlockSize - 1);
+							const int z0 = std::max(lo[2], bz * BlockSize), z1 = std::min(hi[2], bz * BlockSize + BlockSize - 1);
+
+							for (int z = z0; z <= z1; ++z)
+							{
+								for (int y = y0; y <= y1; ++y)
+								{
+									const float wyz = weights[2][z - lo[2]] * weights[1][y - lo[1]];
+									const float* row = block + ((z - bz * BlockSize) * BlockSize + (y - by * BlockSize)) * BlockSize - bx * BlockSize;
+									for (int x = x0; x <= x1; ++x)
+										sum += row[x] * weights[0][x - lo[0]] * wyz;
+								}
+							}
+						}
+					}
+				}
+				values[p] += sum;
+			}
+		});
+	}
+}
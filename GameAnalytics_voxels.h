@@ -0,0 +1,96 @@
+#ifndef GAMEANALYTICS_VOXELS_H
+#define GAMEANALYTICS_VOXELS_H
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+#include "analytics.pb.h"
+#include "GameAnalytics_heatmap.h"
+
+//////////////////////////////////////////////////////////////////////////
+
+// Heatmap accumulation in 3D, for maps with floors stacked over each other. Events are binned into voxels
+// kept in sparse blocks of 8x8x8, so memory follows the occupied space instead of the bounds of the map.
+// Events are grouped by radius like in the rasterizer and the kernel is applied when the grid is read,
+// either by projecting a Z range onto the XY plane through a 2D sink or by sampling the 3D density at
+// points on a surface.
+class HeatmapVoxelGrid
+{
+public:
+	enum { BlockSize = 8 };
+
+	HeatmapVoxelGrid(float voxelSize, float eventRadius);
+
+	// 0 uses every hardware thread
+	void SetThreadCount(int numThreads) { mNumThreads = numThreads; }
+
+	void Clear();
+	// a radius of 0 or less uses the event radius of the grid
+	void AddPoint(const float pos[3], float weight = 1.0f, float radius = 0.0f);
+	// false for events without a position
+	bool AddEvent(const google::protobuf::Message& msg, const PointEventAccessor& accessor);
+
+	// bins the points added since the last call into the blocks, in parallel
+	void Build();
+
+	size_t GetNumBlocks() const;
+	// the extent of the occupied blocks, false when the grid is empty
+	bool GetBounds(float mins[3], float maxs[3]) const;
+
+	// sums the voxels with their center in [zMin, zMax) down each column and adds the columns to the sink
+	// as points with the radius of their events, so a floor renders like a 2D heatmap of just that floor
+	void ProjectSlice(float zMin, float zMax, HeatmapPointSink& sink) const;
+
+	// the density at count positions, x y z one after another, with the events spread by their radius in 3D.
+	// a lone event peaks at its weight, like in the 2D heatmaps
+	void SampleSurface(const float* positions, size_t count, std::vector<float>& values) const;
+private:
+	enum { NumShards = 64, BlockVoxels = BlockSize * BlockSize * BlockSize };
+
+	struct Point
+	{
+		float	mPos[3];
+		float	mWeight;
+	};
+
+	struct Voxel
+	{
+		uint64_t	mBlock;
+		uint32_t	mIndex;
+		float		mWeight;
+	};
+
+	// blocks are spread over shards by key so Build can fill them from several threads without locking
+	struct Shard
+	{
+		std::unordered_map<uint64_t, uint32_t>	mIndex;
+		std::vector<uint64_t>					mKeys;
+		std::vector<float>						mValues;
+	};
+
+	struct Layer
+	{
+		float					mRadius;
+		std::vector<Point>		mPending;
+		std::vector<Shard>		mShards;
+	};
+
+	float					mVoxelSize;
+	float					mRadius;
+	int						mNumThreads;
+
+	std::vector<Layer>		mLayers;
+	int						mLastBucket;
+	size_t					mLastLayer;
+	std::unordered_map<int, size_t> mLayerIndex;
+
+	Layer& GetLayer(float radius);
+	void BuildLayer(Layer& layer);
+
+	static uint64_t BlockKey(int x, int y, int z);
+	static void BlockCoords(uint64_t key, int coords[3]);
+	static size_t ShardOf(uint64_t key);
+};
+
+#endif
@@ -0,0 +1,121 @@
+#include "GameAnalytics_workpool.h"
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////////
+
+struct WorkRange
+{
+	std::mutex	mMutex;
+	size_t		mBegin;
+	size_t		mEnd;
+	// keeps the ranges of different workers off each other's cache lines
+	char		mPadding[64];
+};
+
+int WorkStealingThreads(size_t count, int numThreads)
+{
+	if (numThreads <= 0)
+		numThreads = std::max((int)std::thread::hardware_concurrency(), 1);
+	return (int)std::max<size_t>(std::min<size_t>((size_t)numThreads, count), 1);
+}
+
+static bool TakeItem(WorkRange& range, size_t& index)
+{
+	std::lock_guard<std::mutex> lock(range.mMutex);
+	if (range.mBegin >= range.mEnd)
+		return false;
+
+	index = range.mBegin++;
+	return true;
+}
+
+static bool Steal(std::vector< std::unique_ptr<WorkRange> >& ranges, int worker)
+{
+	for (;;)
+	{
+		// the victim with the most left, which may have run dry by the time it is stolen from
+		int victim = -1;
+		size_t most = 0;
+		for (size_t i = 0; i < ranges.size(); ++i)
+		{
+			std::lock_guard<std::mutex> lock(ranges[i]->mMutex);
+			const size_t left = ranges[i]->mEnd - std::min(ranges[i]->mBegin, ranges[i]->mEnd);
+			if ((int)i != worker && left > most)
+			{
+				most = left;
+				victim = (int)i;
+			}
+		}
+
+		if (victim < 0)
+			return false;
+
+		size_t begin = 0, end = 0;
+		{
+			WorkRange& range = *ranges[victim];
+			std::lock_guard<std::mutex> lock(range.mMutex);
+			if (range.mBegin >= range.mEnd)
+				continue;
+
+			// a single item left goes to the thief, the owner is busy with the one before it
+			end = range.mEnd;
+			begin = range.mBegin + (range.mEnd - range.mBegin) / 2;
+			range.mEnd = begin;
+		}
+
+		WorkRange& own = *ranges[worker];
+		std::lock_guard<std::mutex> lock(own.mMutex);
+		own.mBegin = begin;
+		own.mEnd = end;
+		return true;
+	}
+}
+
+void WorkStealingFor(size_t count, int numThreads, const std::function<void(size_t index, int worker)>& fn)
+{
+	if (count == 0)
+		return;
+
+	const int numWorkers = WorkStealingThreads(count, numThreads);
+	if (numWorkers <= 1)
+	{
+		for (size_t i = 0; i < count; ++i)
+			fn(i, 0);
+		return;
+	}
+
+	std::vector< std::unique_ptr<WorkRange> > ranges(numWorkers);
+	for (int i = 0; i < numWorkers; ++i)
+	{
+		ranges[i].reset(new WorkRange());
+		ranges[i]->mBegin = (size_t)((unsigned long long)count * i / numWorkers);
+		ranges[i]->mEnd = (size_t)((unsigned long long)count * (i + 1) / numWorkers);
+	}
+
+	auto work = [&ranges, &fn](int worker)
+	{
+		size_t index = 0;
+		for (;;)
+		{
+			if (TakeItem(*ranges[worker], index))
+				fn(index, worker);
+			else if (!Steal(ranges, worker))
+				break;
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(numWorkers - 1);
+	for (int i = 1; i < numWorkers; ++i)
+		threads.push_back(std::thread(work, i));
+
+	work(0);
+
+	for (size_t i = 0; i < threads.size(); ++i)
+		threads[i].join();
+}
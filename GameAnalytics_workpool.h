@@ -0,0 +1,18 @@
+#ifndef GAMEANALYTICS_WORKPOOL_H
+#define GAMEANALYTICS_WORKPOOL_H
+
+#include <functional>
+#include <cstddef>
+
+//////////////////////////////////////////////////////////////////////////
+
+// the number of workers WorkStealingFor runs count items on, 0 threads uses every hardware thread
+int WorkStealingThreads(size_t count, int numThreads);
+
+// Calls fn for every index in [0, count) over WorkStealingThreads workers and waits for all of them. Each worker
+// starts on a contiguous range of its own and steals the back half of the largest remaining range when it runs
+// out, so items of uneven cost, like blocks that are mostly skipped, don't leave threads idle. worker is in
+// [0, WorkStealingThreads(count, numThreads)) for per worker partial results
+void WorkStealingFor(size_t count, int numThreads, const std::function<void(size_t index, int worker)>& fn);
+
+#endif
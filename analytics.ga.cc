@@ -0,0 +1,491 @@
+// Generated by protoc-gen-analytics.  DO NOT EDIT!
+// source: analytics.proto
+
+#include "analytics.ga.h"
+
+namespace Analytics {
+
+void AppendJson(const ::Analytics::Vec3& msg, std::string& out)
+{
+	bool first = true;
+	out += '{';
+
+	if (msg.x() != 0)
+	{
+		JsonBeginField(out, first, "\"x\":");
+		JsonAppendFloat(out, msg.x());
+	}
+	if (msg.y() != 0)
+	{
+		JsonBeginField(out, first, "\"y\":");
+		JsonAppendFloat(out, msg.y());
+	}
+	if (msg.z() != 0)
+	{
+		JsonBeginField(out, first, "\"z\":");
+		JsonAppendFloat(out, msg.z());
+	}
+	if (msg.quantized() != 0)
+	{
+		JsonBeginField(out, first, "\"quantized\":");
+		JsonAppendUInt64(out, msg.quantized());
+	}
+
+	out += '}';
+}
+
+void AppendJson(const ::Analytics::Line& msg, std::string& out)
+{
+	bool first = true;
+	out += '{';
+
+	if (msg.has_p0())
+	{
+		JsonBeginField(out, first, "\"p0\":");
+		AppendJson(msg.p0(), out);
+	}
+	if (msg.has_p1())
+	{
+		JsonBeginField(out, first, "\"p1\":");
+		AppendJson(msg.p1(), out);
+	}
+
+	out += '}';
+}
+
+void AppendJson(const ::Analytics::UTCTime& msg, std::string& out)
+{
+	bool first = true;
+	out += '{';
+
+	if (msg.hour() != 0)
+	{
+		JsonBeginField(out, first, "\"hour\":");
+		JsonAppendInt(out, msg.hour());
+	}
+	if (msg.minute() != 0)
+	{
+		JsonBeginField(out, first, "\"minute\":");
+		JsonAppendInt(out, msg.minute());
+	}
+	if (msg.second() != 0)
+	{
+		JsonBeginField(out, first, "\"second\":");
+		JsonAppendInt(out, msg.second());
+	}
+	if (msg.day() != 0)
+	{
+		JsonBeginField(out, first, "\"day\":");
+		JsonAppendInt(out, msg.day());
+	}
+	if (msg.month() != 0)
+	{
+		JsonBeginField(out, first, "\"month\":");
+		JsonAppendInt(out, msg.month());
+	}
+	if (msg.year() != 0)
+	{
+		JsonBeginField(out, first, "\"year\":");
+		JsonAppendInt(out, msg.year());
+	}
+
+	out += '}';
+}
+
+void AppendJson(const ::Analytics::GameInfo& msg, std::string& out)
+{
+	bool first = true;
+	out += '{';
+
+	if (msg.has_timestamp())
+	{
+		JsonBeginField(out, first, "\"timeStamp\":");
+		AppendJson(msg.timestamp(), out);
+	}
+	if (!msg.mapname().empty())
+	{
+		JsonBeginField(out, first, "\"mapName\":");
+		JsonAppendString(out, msg.mapname());
+	}
+	if (!msg.gamename().empty())
+	{
+		JsonBeginField(out, first, "\"gameName\":");
+		JsonAppendString(out, msg.gamename());
+	}
+	if (!msg.gameversion().empty())
+	{
+		JsonBeginField(out, first, "\"gameVersion\":");
+		JsonAppendString(out, msg.gameversion());
+	}
+	if (msg.has_worldmins())
+	{
+		JsonBeginField(out, first, "\"worldMins\":");
+		AppendJson(msg.worldmins(), out);
+	}
+	if (msg.has_worldmaxs())
+	{
+		JsonBeginField(out, first, "\"worldMaxs\":");
+		AppendJson(msg.worldmaxs(), out);
+	}
+
+	out += '}';
+}
+
+void AppendJson(const ::Analytics::GameWeaponFired& msg, std::string& out)
+{
+	bool first = true;
+	out += '{';
+
+	if (msg.has_position())
+	{
+		JsonBeginField(out, first, "\"position\":");
+		AppendJson(msg.position(), out);
+	}
+	if (msg.attackteam() != 0)
+	{
+		JsonBeginField(out, first, "\"attackTeam\":");
+		JsonAppendInt(out, msg.attackteam());
+	}
+	if (msg.weaponid() != 0)
+	{
+		JsonBeginField(out, first, "\"weaponId\":");
+		JsonAppendInt(out, msg.weaponid());
+	}
+	if (msg.firedbyclass() != 0)
+	{
+		JsonBeginField(out, first, "\"firedByClass\":");
+		JsonAppendInt(out, msg.firedbyclass());
+	}
+	if (msg.has_trace())
+	{
+		JsonBeginField(out, first, "\"trace\":");
+		AppendJson(msg.trace(), out);
+	}
+
+	out += '}';
+}
+
+void AppendJson(const ::Analytics::GameRadiusDamage& msg, std::string& out)
+{
+	bool first = true;
+	out += '{';
+
+	if (msg.has_position())
+	{
+		JsonBeginField(out, first, "\"position\":");
+		AppendJson(msg.position(), out);
+	}
+	if (!msg.damagetype().empty())
+	{
+		JsonBeginField(out, first, "\"damageType\":");
+		JsonAppendString(out, msg.damagetype());
+	}
+	if (msg.damageamount() != 0)
+	{
+		JsonBeginField(out, first, "\"damageAmount\":");
+		JsonAppendFloat(out, msg.damageamount());
+	}
+	if (msg.damageradius() != 0)
+	{
+		JsonBeginField(out, first, "\"damageRadius\":");
+		JsonAppendFloat(out, msg.damageradius());
+	}
+	if (msg.damagetypeid() != 0)
+	{
+		JsonBeginField(out, first, "\"damageTypeId\":");
+		JsonAppendUInt(out, msg.damagetypeid());
+	}
+
+	out += '}';
+}
+
+namespace {
+
+void Encode_Analytics_PointEvent(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::PointEvent&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_LineEvent(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::LineEvent&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_EditorChangeValue(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::EditorChangeValue&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_EditorChanges(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::EditorChanges&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_RangeF(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::RangeF&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_RangeI(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::RangeI&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_Vec3(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::Vec3&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_Vec3Color(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::Vec3Color&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_Vec4(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::Vec4&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_Line(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::Line&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_Euler(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::Euler&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_Material(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::Material&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_PrimitiveOptions(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::PrimitiveOptions&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_Primitive(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::Primitive&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_Mesh(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::Mesh&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_UTCTime(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::UTCTime&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameInfo(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	payload.clear();
+	AppendJson(static_cast<const ::Analytics::GameInfo&>(msg), payload);
+}
+
+void Encode_Analytics_GameEnum(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameEnum&>(msg).SerializeToString(&payload);
+}
+
+bool HashKey_Analytics_GameEnum(const ::google::protobuf::Message& base, std::string& key)
+{
+	const ::Analytics::GameEnum& msg = static_cast<const ::Analytics::GameEnum&>(base);
+	key = msg.enumname();
+	return true;
+}
+
+void Encode_Analytics_GameString(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameString&>(msg).SerializeToString(&payload);
+}
+
+bool HashKey_Analytics_GameString(const ::google::protobuf::Message& base, std::string& key)
+{
+	const ::Analytics::GameString& msg = static_cast<const ::Analytics::GameString&>(base);
+	KeyFormatUInt(key, msg.id());
+	return true;
+}
+
+void Encode_Analytics_LiveHeatmap(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::LiveHeatmap&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameNavNotFound(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameNavNotFound&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameNavAutoDownloaded(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameNavAutoDownloaded&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameAssert(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameAssert&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameCrash(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameCrash&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameMeshData(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameMeshData&>(msg).SerializeToString(&payload);
+}
+
+bool HashKey_Analytics_GameMeshData(const ::google::protobuf::Message& base, std::string& key)
+{
+	const ::Analytics::GameMeshData& msg = static_cast<const ::Analytics::GameMeshData&>(base);
+	key = msg.modelname();
+	return true;
+}
+
+void Encode_Analytics_GameEntityInfo(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameEntityInfo&>(msg).SerializeToString(&payload);
+}
+
+bool HashKey_Analytics_GameEntityInfo(const ::google::protobuf::Message& base, std::string& key)
+{
+	const ::Analytics::GameEntityInfo& msg = static_cast<const ::Analytics::GameEntityInfo&>(base);
+	KeyFormatInt(key, msg.entityindex());
+	return true;
+}
+
+void Encode_Analytics_GameEntityPosition(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameEntityPosition&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameEntityTrajectory(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameEntityTrajectory&>(msg).SerializeToString(&payload);
+}
+
+bool KeySuffix_Analytics_GameEntityTrajectory(const ::google::protobuf::Message& base, std::string& key)
+{
+	const ::Analytics::GameEntityTrajectory& msg = static_cast<const ::Analytics::GameEntityTrajectory&>(base);
+	KeyFormatInt(key, msg.entityindex());
+	return true;
+}
+
+void Encode_Analytics_GameNode(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameNode&>(msg).SerializeToString(&payload);
+}
+
+bool HashKey_Analytics_GameNode(const ::google::protobuf::Message& base, std::string& key)
+{
+	const ::Analytics::GameNode& msg = static_cast<const ::Analytics::GameNode&>(base);
+	key = msg.nodepath();
+	return true;
+}
+
+void Encode_Analytics_GameWeaponFired(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	payload.clear();
+	AppendJson(static_cast<const ::Analytics::GameWeaponFired&>(msg), payload);
+}
+
+void Encode_Analytics_GameDeath(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameDeath&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameKilledSomeone(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameKilledSomeone&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameRecieveDamage(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameRecieveDamage&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameInflictDamage(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameInflictDamage&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameRadiusDamage(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	payload.clear();
+	AppendJson(static_cast<const ::Analytics::GameRadiusDamage&>(msg), payload);
+}
+
+void Encode_Analytics_GameNavigationStuck(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameNavigationStuck&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameVoiceMacro(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameVoiceMacro&>(msg).SerializeToString(&payload);
+}
+
+void Encode_Analytics_GameLogMessage(const ::google::protobuf::Message& msg, std::string& payload)
+{
+	static_cast<const ::Analytics::GameLogMessage&>(msg).SerializeToString(&payload);
+}
+
+// indexed by Descriptor::index()
+const ::EventEncoder kEncoders[] =
+{
+	{ "PointEvent", ::Analytics::UNKNOWN, false, &Encode_Analytics_PointEvent, NULL, NULL },
+	{ "LineEvent", ::Analytics::UNKNOWN, false, &Encode_Analytics_LineEvent, NULL, NULL },
+	{ "EditorChangeValue", ::Analytics::UNKNOWN, false, &Encode_Analytics_EditorChangeValue, NULL, NULL },
+	{ "EditorChanges", ::Analytics::UNKNOWN, false, &Encode_Analytics_EditorChanges, NULL, NULL },
+	{ "RangeF", ::Analytics::UNKNOWN, false, &Encode_Analytics_RangeF, NULL, NULL },
+	{ "RangeI", ::Analytics::UNKNOWN, false, &Encode_Analytics_RangeI, NULL, NULL },
+	{ "Vec3", ::Analytics::UNKNOWN, false, &Encode_Analytics_Vec3, NULL, NULL },
+	{ "Vec3Color", ::Analytics::UNKNOWN, false, &Encode_Analytics_Vec3Color, NULL, NULL },
+	{ "Vec4", ::Analytics::UNKNOWN, false, &Encode_Analytics_Vec4, NULL, NULL },
+	{ "Line", ::Analytics::UNKNOWN, false, &Encode_Analytics_Line, NULL, NULL },
+	{ "Euler", ::Analytics::UNKNOWN, false, &Encode_Analytics_Euler, NULL, NULL },
+	{ "Material", ::Analytics::UNKNOWN, false, &Encode_Analytics_Material, NULL, NULL },
+	{ "PrimitiveOptions", ::Analytics::UNKNOWN, false, &Encode_Analytics_PrimitiveOptions, NULL, NULL },
+	{ "Primitive", ::Analytics::UNKNOWN, false, &Encode_Analytics_Primitive, NULL, NULL },
+	{ "Mesh", ::Analytics::UNKNOWN, false, &Encode_Analytics_Mesh, NULL, NULL },
+	{ "UTCTime", ::Analytics::UNKNOWN, false, &Encode_Analytics_UTCTime, NULL, NULL },
+	{ "GameInfo", ::Analytics::SET, true, &Encode_Analytics_GameInfo, NULL, NULL },
+	{ "GameEnum", ::Analytics::HMSET, false, &Encode_Analytics_GameEnum, NULL, &HashKey_Analytics_GameEnum },
+	{ "GameString", ::Analytics::HMSET, false, &Encode_Analytics_GameString, NULL, &HashKey_Analytics_GameString },
+	{ "LiveHeatmap", ::Analytics::UNKNOWN, false, &Encode_Analytics_LiveHeatmap, NULL, NULL },
+	{ "GameNavNotFound", ::Analytics::RPUSH, false, &Encode_Analytics_GameNavNotFound, NULL, NULL },
+	{ "GameNavAutoDownloaded", ::Analytics::RPUSH, false, &Encode_Analytics_GameNavAutoDownloaded, NULL, NULL },
+	{ "GameAssert", ::Analytics::RPUSH, false, &Encode_Analytics_GameAssert, NULL, NULL },
+	{ "GameCrash", ::Analytics::RPUSH, false, &Encode_Analytics_GameCrash, NULL, NULL },
+	{ "GameMeshData", ::Analytics::HMSET, false, &Encode_Analytics_GameMeshData, NULL, &HashKey_Analytics_GameMeshData },
+	{ "GameEntityInfo", ::Analytics::HMSET, false, &Encode_Analytics_GameEntityInfo, NULL, &HashKey_Analytics_GameEntityInfo },
+	{ "GameEntityPosition", ::Analytics::RPUSH, false, &Encode_Analytics_GameEntityPosition, NULL, NULL },
+	{ "GameEntityTrajectory", ::Analytics::RPUSH, false, &Encode_Analytics_GameEntityTrajectory, &KeySuffix_Analytics_GameEntityTrajectory, NULL },
+	{ "GameNode", ::Analytics::HMSET, false, &Encode_Analytics_GameNode, NULL, &HashKey_Analytics_GameNode },
+	{ "GameWeaponFired", ::Analytics::RPUSH, true, &Encode_Analytics_GameWeaponFired, NULL, NULL },
+	{ "GameDeath", ::Analytics::RPUSH, false, &Encode_Analytics_GameDeath, NULL, NULL },
+	{ "GameKilledSomeone", ::Analytics::RPUSH, false, &Encode_Analytics_GameKilledSomeone, NULL, NULL },
+	{ "GameRecieveDamage", ::Analytics::RPUSH, false, &Encode_Analytics_GameRecieveDamage, NULL, NULL },
+	{ "GameInflictDamage", ::Analytics::RPUSH, false, &Encode_Analytics_GameInflictDamage, NULL, NULL },
+	{ "GameRadiusDamage", ::Analytics::RPUSH, true, &Encode_Analytics_GameRadiusDamage, NULL, NULL },
+	{ "GameNavigationStuck", ::Analytics::RPUSH, false, &Encode_Analytics_GameNavigationStuck, NULL, NULL },
+	{ "GameVoiceMacro", ::Analytics::RPUSH, false, &Encode_Analytics_GameVoiceMacro, NULL, NULL },
+	{ "GameLogMessage", ::Analytics::RPUSH, false, &Encode_Analytics_GameLogMessage, NULL, NULL },
+};
+
+}
+
+const ::EventEncoder* FindEventEncoder(const ::google::protobuf::Descriptor* desc)
+{
+	if (desc == NULL || desc->containing_type() != NULL || desc->file() != ::Analytics::PointEvent::descriptor()->file())
+		return NULL;
+	return &kEncoders[desc->index()];
+}
+
+}
@@ -0,0 +1,26 @@
+// Generated by protoc-gen-analytics.  DO NOT EDIT!
+// source: analytics.proto
+
+#ifndef PROTOC_GEN_ANALYTICS_analytics_2eproto
+#define PROTOC_GEN_ANALYTICS_analytics_2eproto
+
+#include <string>
+
+#include "analytics.pb.h"
+#include "GameAnalytics_codegen.h"
+
+namespace Analytics {
+
+// the encoder of a message type declared in analytics.proto, NULL for any other type
+const ::EventEncoder* FindEventEncoder(const ::google::protobuf::Descriptor* desc);
+
+void AppendJson(const ::Analytics::Vec3& msg, std::string& out);
+void AppendJson(const ::Analytics::Line& msg, std::string& out);
+void AppendJson(const ::Analytics::UTCTime& msg, std::string& out);
+void AppendJson(const ::Analytics::GameInfo& msg, std::string& out);
+void AppendJson(const ::Analytics::GameWeaponFired& msg, std::string& out);
+void AppendJson(const ::Analytics::GameRadiusDamage& msg, std::string& out);
+
+}
+
+#endif
@@ -14,1317 +14,1369 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_EditorChangeValue_analytics_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GameEntityInfo_Ammo_analytics_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GameEnum_EnumPair_analytics_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_LineEvent_analytics_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Material_analytics_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PointEvent_analytics_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_Primitive_analytics_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PrimitiveOptions_analytics_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RangeI_analytics_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UTCTime_analytics_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Vec3_analytics_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_analytics_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Vec3Color_analytics_2eproto;
-namespace Analytics {
-class PointEventDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PointEvent> _instance;
-} _PointEvent_default_instance_;
-class LineEventDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<LineEvent> _instance;
-} _LineEvent_default_instance_;
-class EditorChangeValueDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<EditorChangeValue> _instance;
-} _EditorChangeValue_default_instance_;
-class EditorChangesDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<EditorChanges> _instance;
-} _EditorChanges_default_instance_;
-class RangeFDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RangeF> _instance;
-} _RangeF_default_instance_;
-class RangeIDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RangeI> _instance;
-} _RangeI_default_instance_;
-class Vec3DefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Vec3> _instance;
-} _Vec3_default_instance_;
-class Vec3ColorDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Vec3Color> _instance;
-} _Vec3Color_default_instance_;
-class Vec4DefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Vec4> _instance;
-} _Vec4_default_instance_;
-class LineDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Line> _instance;
-} _Line_default_instance_;
-class EulerDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Euler> _instance;
-} _Euler_default_instance_;
-class MaterialDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Material> _instance;
-} _Material_default_instance_;
-class PrimitiveOptionsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PrimitiveOptions> _instance;
-} _PrimitiveOptions_default_instance_;
-class PrimitiveDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Primitive> _instance;
-} _Primitive_default_instance_;
-class MeshDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Mesh> _instance;
-} _Mesh_default_instance_;
-class UTCTimeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UTCTime> _instance;
-} _UTCTime_default_instance_;
-class GameInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameInfo> _instance;
-} _GameInfo_default_instance_;
-class GameEnum_EnumPairDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameEnum_EnumPair> _instance;
-} _GameEnum_EnumPair_default_instance_;
-class GameEnumDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameEnum> _instance;
-} _GameEnum_default_instance_;
-class GameNavNotFoundDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameNavNotFound> _instance;
-} _GameNavNotFound_default_instance_;
-class GameNavAutoDownloadedDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameNavAutoDownloaded> _instance;
-} _GameNavAutoDownloaded_default_instance_;
-class GameAssertDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameAssert> _instance;
-} _GameAssert_default_instance_;
-class GameCrashDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameCrash> _instance;
-} _GameCrash_default_instance_;
-class GameMeshDataDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameMeshData> _instance;
-} _GameMeshData_default_instance_;
-class GameEntityInfo_AmmoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameEntityInfo_Ammo> _instance;
-} _GameEntityInfo_Ammo_default_instance_;
-class GameEntityInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameEntityInfo> _instance;
-} _GameEntityInfo_default_instance_;
-class GameEntityPositionDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameEntityPosition> _instance;
-} _GameEntityPosition_default_instance_;
-class GameNodeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameNode> _instance;
-} _GameNode_default_instance_;
-class GameWeaponFiredDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameWeaponFired> _instance;
-} _GameWeaponFired_default_instance_;
-class GameDeathDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameDeath> _instance;
-} _GameDeath_default_instance_;
-class GameKilledSomeoneDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameKilledSomeone> _instance;
-} _GameKilledSomeone_default_instance_;
-class GameRecieveDamageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameRecieveDamage> _instance;
-} _GameRecieveDamage_default_instance_;
-class GameInflictDamageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameInflictDamage> _instance;
-} _GameInflictDamage_default_instance_;
-class GameRadiusDamageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameRadiusDamage> _instance;
-} _GameRadiusDamage_default_instance_;
-class GameNavigationStuckDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameNavigationStuck> _instance;
-} _GameNavigationStuck_default_instance_;
-class GameVoiceMacroDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameVoiceMacro> _instance;
-} _GameVoiceMacro_default_instance_;
-class GameLogMessageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameLogMessage> _instance;
-} _GameLogMessage_default_instance_;
-}  // namespace Analytics
-static void InitDefaultsscc_info_EditorChangeValue_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_EditorChangeValue_default_instance_;
-    new (ptr) ::Analytics::EditorChangeValue();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::EditorChangeValue::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_EditorChangeValue_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_EditorChangeValue_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_EditorChanges_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_EditorChanges_default_instance_;
-    new (ptr) ::Analytics::EditorChanges();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::EditorChanges::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_EditorChanges_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_EditorChanges_analytics_2eproto}, {
-      &scc_info_EditorChangeValue_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_Euler_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_Euler_default_instance_;
-    new (ptr) ::Analytics::Euler();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::Euler::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Euler_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Euler_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_GameAssert_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameAssert_default_instance_;
-    new (ptr) ::Analytics::GameAssert();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameAssert::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GameAssert_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GameAssert_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_GameCrash_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameCrash_default_instance_;
-    new (ptr) ::Analytics::GameCrash();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameCrash::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GameCrash_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GameCrash_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_GameDeath_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameDeath_default_instance_;
-    new (ptr) ::Analytics::GameDeath();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameDeath::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameDeath_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameDeath_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameEntityInfo_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameEntityInfo_default_instance_;
-    new (ptr) ::Analytics::GameEntityInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameEntityInfo::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_GameEntityInfo_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 3, 0, InitDefaultsscc_info_GameEntityInfo_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,
-      &scc_info_RangeI_analytics_2eproto.base,
-      &scc_info_GameEntityInfo_Ammo_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameEntityInfo_Ammo_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameEntityInfo_Ammo_default_instance_;
-    new (ptr) ::Analytics::GameEntityInfo_Ammo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameEntityInfo_Ammo::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GameEntityInfo_Ammo_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GameEntityInfo_Ammo_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_GameEntityPosition_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameEntityPosition_default_instance_;
-    new (ptr) ::Analytics::GameEntityPosition();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameEntityPosition::InitAsDefaultInstance();
-}
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameEntityPosition_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameEntityPosition_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,}};
+PROTOBUF_PRAGMA_INIT_SEG
 
-static void InitDefaultsscc_info_GameEnum_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-  {
-    void* ptr = &::Analytics::_GameEnum_default_instance_;
-    new (ptr) ::Analytics::GameEnum();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameEnum::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameEnum_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameEnum_analytics_2eproto}, {
-      &scc_info_GameEnum_EnumPair_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameEnum_EnumPair_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameEnum_EnumPair_default_instance_;
-    new (ptr) ::Analytics::GameEnum_EnumPair();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameEnum_EnumPair::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GameEnum_EnumPair_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GameEnum_EnumPair_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_GameInflictDamage_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameInflictDamage_default_instance_;
-    new (ptr) ::Analytics::GameInflictDamage();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameInflictDamage::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameInflictDamage_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameInflictDamage_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameInfo_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameInfo_default_instance_;
-    new (ptr) ::Analytics::GameInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameInfo::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameInfo_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameInfo_analytics_2eproto}, {
-      &scc_info_UTCTime_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameKilledSomeone_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameKilledSomeone_default_instance_;
-    new (ptr) ::Analytics::GameKilledSomeone();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameKilledSomeone::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameKilledSomeone_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameKilledSomeone_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameLogMessage_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameLogMessage_default_instance_;
-    new (ptr) ::Analytics::GameLogMessage();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameLogMessage::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GameLogMessage_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GameLogMessage_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_GameMeshData_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameMeshData_default_instance_;
-    new (ptr) ::Analytics::GameMeshData();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameMeshData::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GameMeshData_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GameMeshData_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_GameNavAutoDownloaded_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameNavAutoDownloaded_default_instance_;
-    new (ptr) ::Analytics::GameNavAutoDownloaded();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameNavAutoDownloaded::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GameNavAutoDownloaded_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GameNavAutoDownloaded_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_GameNavNotFound_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameNavNotFound_default_instance_;
-    new (ptr) ::Analytics::GameNavNotFound();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameNavNotFound::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GameNavNotFound_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GameNavNotFound_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_GameNavigationStuck_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameNavigationStuck_default_instance_;
-    new (ptr) ::Analytics::GameNavigationStuck();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameNavigationStuck::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameNavigationStuck_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameNavigationStuck_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameNode_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameNode_default_instance_;
-    new (ptr) ::Analytics::GameNode();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameNode::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameNode_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameNode_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameRadiusDamage_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameRadiusDamage_default_instance_;
-    new (ptr) ::Analytics::GameRadiusDamage();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameRadiusDamage::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameRadiusDamage_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameRadiusDamage_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameRecieveDamage_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameRecieveDamage_default_instance_;
-    new (ptr) ::Analytics::GameRecieveDamage();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameRecieveDamage::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameRecieveDamage_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameRecieveDamage_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameVoiceMacro_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameVoiceMacro_default_instance_;
-    new (ptr) ::Analytics::GameVoiceMacro();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameVoiceMacro::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameVoiceMacro_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameVoiceMacro_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameWeaponFired_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_GameWeaponFired_default_instance_;
-    new (ptr) ::Analytics::GameWeaponFired();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::GameWeaponFired::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameWeaponFired_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameWeaponFired_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_Line_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_Line_default_instance_;
-    new (ptr) ::Analytics::Line();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::Line::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Line_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Line_analytics_2eproto}, {
-      &scc_info_Vec3_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_LineEvent_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_LineEvent_default_instance_;
-    new (ptr) ::Analytics::LineEvent();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::LineEvent::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_LineEvent_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_LineEvent_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_Material_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_Material_default_instance_;
-    new (ptr) ::Analytics::Material();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::Material::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Material_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Material_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_Mesh_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_Mesh_default_instance_;
-    new (ptr) ::Analytics::Mesh();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::Mesh::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_Mesh_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_Mesh_analytics_2eproto}, {
-      &scc_info_Primitive_analytics_2eproto.base,
-      &scc_info_Material_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_PointEvent_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_PointEvent_default_instance_;
-    new (ptr) ::Analytics::PointEvent();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::PointEvent::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PointEvent_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PointEvent_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_Primitive_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_Primitive_default_instance_;
-    new (ptr) ::Analytics::Primitive();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::Primitive::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_Primitive_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_Primitive_analytics_2eproto}, {
-      &scc_info_PrimitiveOptions_analytics_2eproto.base,
-      &scc_info_Vec3Color_analytics_2eproto.base,}};
-
-static void InitDefaultsscc_info_PrimitiveOptions_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_PrimitiveOptions_default_instance_;
-    new (ptr) ::Analytics::PrimitiveOptions();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::PrimitiveOptions::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PrimitiveOptions_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PrimitiveOptions_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_RangeF_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_RangeF_default_instance_;
-    new (ptr) ::Analytics::RangeF();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::RangeF::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RangeF_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RangeF_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_RangeI_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_RangeI_default_instance_;
-    new (ptr) ::Analytics::RangeI();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::RangeI::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RangeI_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RangeI_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_UTCTime_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_UTCTime_default_instance_;
-    new (ptr) ::Analytics::UTCTime();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::UTCTime::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UTCTime_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_UTCTime_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_Vec3_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_Vec3_default_instance_;
-    new (ptr) ::Analytics::Vec3();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::Vec3::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Vec3_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Vec3_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_Vec3Color_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_Vec3Color_default_instance_;
-    new (ptr) ::Analytics::Vec3Color();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::Vec3Color::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Vec3Color_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Vec3Color_analytics_2eproto}, {}};
-
-static void InitDefaultsscc_info_Vec4_analytics_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Analytics::_Vec4_default_instance_;
-    new (ptr) ::Analytics::Vec4();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Analytics::Vec4::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Vec4_analytics_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Vec4_analytics_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_analytics_2eproto[37];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_analytics_2eproto[4];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_analytics_2eproto = nullptr;
+namespace Analytics {
+PROTOBUF_CONSTEXPR PointEvent::PointEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.radius_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.weight_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PointEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PointEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PointEventDefaultTypeInternal() {}
+  union {
+    PointEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PointEventDefaultTypeInternal _PointEvent_default_instance_;
+PROTOBUF_CONSTEXPR LineEvent::LineEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.radius_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.weight_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.group_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.maxstep_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LineEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LineEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LineEventDefaultTypeInternal() {}
+  union {
+    LineEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LineEventDefaultTypeInternal _LineEvent_default_instance_;
+PROTOBUF_CONSTEXPR EditorChangeValue::EditorChangeValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messagetype_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.fieldname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.payload_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EditorChangeValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EditorChangeValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EditorChangeValueDefaultTypeInternal() {}
+  union {
+    EditorChangeValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EditorChangeValueDefaultTypeInternal _EditorChangeValue_default_instance_;
+PROTOBUF_CONSTEXPR EditorChanges::EditorChanges(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.changes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EditorChangesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EditorChangesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EditorChangesDefaultTypeInternal() {}
+  union {
+    EditorChanges _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EditorChangesDefaultTypeInternal _EditorChanges_default_instance_;
+PROTOBUF_CONSTEXPR RangeF::RangeF(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.min_)*/0
+  , /*decltype(_impl_.max_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RangeFDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RangeFDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RangeFDefaultTypeInternal() {}
+  union {
+    RangeF _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RangeFDefaultTypeInternal _RangeF_default_instance_;
+PROTOBUF_CONSTEXPR RangeI::RangeI(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.min_)*/0
+  , /*decltype(_impl_.max_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RangeIDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RangeIDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RangeIDefaultTypeInternal() {}
+  union {
+    RangeI _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RangeIDefaultTypeInternal _RangeI_default_instance_;
+PROTOBUF_CONSTEXPR Vec3::Vec3(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.quantized_)*/uint64_t{0u}
+  , /*decltype(_impl_.z_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct Vec3DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Vec3DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Vec3DefaultTypeInternal() {}
+  union {
+    Vec3 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Vec3DefaultTypeInternal _Vec3_default_instance_;
+PROTOBUF_CONSTEXPR Vec3Color::Vec3Color(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.z_)*/0
+  , /*decltype(_impl_.color_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct Vec3ColorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Vec3ColorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Vec3ColorDefaultTypeInternal() {}
+  union {
+    Vec3Color _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Vec3ColorDefaultTypeInternal _Vec3Color_default_instance_;
+PROTOBUF_CONSTEXPR Vec4::Vec4(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.z_)*/0
+  , /*decltype(_impl_.w_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct Vec4DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Vec4DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Vec4DefaultTypeInternal() {}
+  union {
+    Vec4 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Vec4DefaultTypeInternal _Vec4_default_instance_;
+PROTOBUF_CONSTEXPR Line::Line(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.p0_)*/nullptr
+  , /*decltype(_impl_.p1_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LineDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LineDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LineDefaultTypeInternal() {}
+  union {
+    Line _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LineDefaultTypeInternal _Line_default_instance_;
+PROTOBUF_CONSTEXPR Euler::Euler(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.heading_)*/0
+  , /*decltype(_impl_.pitch_)*/0
+  , /*decltype(_impl_.roll_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EulerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EulerDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EulerDefaultTypeInternal() {}
+  union {
+    Euler _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EulerDefaultTypeInternal _Euler_default_instance_;
+PROTOBUF_CONSTEXPR Material::Material(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.contents_)*/0u
+  , /*decltype(_impl_.surfaceflags_)*/0u
+  , /*decltype(_impl_.renderevents_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MaterialDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MaterialDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MaterialDefaultTypeInternal() {}
+  union {
+    Material _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MaterialDefaultTypeInternal _Material_default_instance_;
+PROTOBUF_CONSTEXPR PrimitiveOptions::PrimitiveOptions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.partindex_)*/0u
+  , /*decltype(_impl_.overridesurfaceflags_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PrimitiveOptionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrimitiveOptionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrimitiveOptionsDefaultTypeInternal() {}
+  union {
+    PrimitiveOptions _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrimitiveOptionsDefaultTypeInternal _PrimitiveOptions_default_instance_;
+PROTOBUF_CONSTEXPR Primitive::Primitive(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.vertices_)*/{}
+  , /*decltype(_impl_.options_)*/nullptr
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.materialindex_)*/0u
+  , /*decltype(_impl_.size_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PrimitiveDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrimitiveDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrimitiveDefaultTypeInternal() {}
+  union {
+    Primitive _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrimitiveDefaultTypeInternal _Primitive_default_instance_;
+PROTOBUF_CONSTEXPR Mesh::Mesh(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.primitives_)*/{}
+  , /*decltype(_impl_.materials_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MeshDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MeshDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MeshDefaultTypeInternal() {}
+  union {
+    Mesh _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MeshDefaultTypeInternal _Mesh_default_instance_;
+PROTOBUF_CONSTEXPR UTCTime::UTCTime(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hour_)*/0
+  , /*decltype(_impl_.minute_)*/0
+  , /*decltype(_impl_.second_)*/0
+  , /*decltype(_impl_.day_)*/0
+  , /*decltype(_impl_.month_)*/0
+  , /*decltype(_impl_.year_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UTCTimeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UTCTimeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UTCTimeDefaultTypeInternal() {}
+  union {
+    UTCTime _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UTCTimeDefaultTypeInternal _UTCTime_default_instance_;
+PROTOBUF_CONSTEXPR GameInfo::GameInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mapname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.gamename_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.gameversion_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/nullptr
+  , /*decltype(_impl_.worldmins_)*/nullptr
+  , /*decltype(_impl_.worldmaxs_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameInfoDefaultTypeInternal() {}
+  union {
+    GameInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameInfoDefaultTypeInternal _GameInfo_default_instance_;
+PROTOBUF_CONSTEXPR GameEnum_EnumPair::GameEnum_EnumPair(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameEnum_EnumPairDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameEnum_EnumPairDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameEnum_EnumPairDefaultTypeInternal() {}
+  union {
+    GameEnum_EnumPair _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameEnum_EnumPairDefaultTypeInternal _GameEnum_EnumPair_default_instance_;
+PROTOBUF_CONSTEXPR GameEnum::GameEnum(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.values_)*/{}
+  , /*decltype(_impl_.enumname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.isbitfield_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameEnumDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameEnumDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameEnumDefaultTypeInternal() {}
+  union {
+    GameEnum _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameEnumDefaultTypeInternal _GameEnum_default_instance_;
+PROTOBUF_CONSTEXPR GameString::GameString(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameStringDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameStringDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameStringDefaultTypeInternal() {}
+  union {
+    GameString _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameStringDefaultTypeInternal _GameString_default_instance_;
+PROTOBUF_CONSTEXPR LiveHeatmap::LiveHeatmap(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.eventtype_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.values_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.worldmins_)*/nullptr
+  , /*decltype(_impl_.worldmaxs_)*/nullptr
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.width_)*/0
+  , /*decltype(_impl_.height_)*/0
+  , /*decltype(_impl_.maxvalue_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LiveHeatmapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LiveHeatmapDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LiveHeatmapDefaultTypeInternal() {}
+  union {
+    LiveHeatmap _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LiveHeatmapDefaultTypeInternal _LiveHeatmap_default_instance_;
+PROTOBUF_CONSTEXPR GameNavNotFound::GameNavNotFound(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mapname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mapnameid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameNavNotFoundDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameNavNotFoundDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameNavNotFoundDefaultTypeInternal() {}
+  union {
+    GameNavNotFound _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameNavNotFoundDefaultTypeInternal _GameNavNotFound_default_instance_;
+PROTOBUF_CONSTEXPR GameNavAutoDownloaded::GameNavAutoDownloaded(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mapname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mapnameid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameNavAutoDownloadedDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameNavAutoDownloadedDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameNavAutoDownloadedDefaultTypeInternal() {}
+  union {
+    GameNavAutoDownloaded _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameNavAutoDownloadedDefaultTypeInternal _GameNavAutoDownloaded_default_instance_;
+PROTOBUF_CONSTEXPR GameAssert::GameAssert(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.condition_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.file_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.line_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameAssertDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameAssertDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameAssertDefaultTypeInternal() {}
+  union {
+    GameAssert _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameAssertDefaultTypeInternal _GameAssert_default_instance_;
+PROTOBUF_CONSTEXPR GameCrash::GameCrash(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.info_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameCrashDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameCrashDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameCrashDefaultTypeInternal() {}
+  union {
+    GameCrash _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameCrashDefaultTypeInternal _GameCrash_default_instance_;
+PROTOBUF_CONSTEXPR GameMeshData::GameMeshData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.modelname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.modelbytes_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.compressiontype_)*/0
+  , /*decltype(_impl_.modelbytesuncompressed_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameMeshDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameMeshDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameMeshDataDefaultTypeInternal() {}
+  union {
+    GameMeshData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameMeshDataDefaultTypeInternal _GameMeshData_default_instance_;
+PROTOBUF_CONSTEXPR GameEntityInfo_Ammo::GameEntityInfo_Ammo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ammotype_)*/0u
+  , /*decltype(_impl_.ammocount_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameEntityInfo_AmmoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameEntityInfo_AmmoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameEntityInfo_AmmoDefaultTypeInternal() {}
+  union {
+    GameEntityInfo_Ammo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameEntityInfo_AmmoDefaultTypeInternal _GameEntityInfo_Ammo_default_instance_;
+PROTOBUF_CONSTEXPR GameEntityInfo::GameEntityInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ammo_)*/{}
+  , /*decltype(_impl_.entityname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.eulerrotation_)*/nullptr
+  , /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.eyeoffset_)*/nullptr
+  , /*decltype(_impl_.eyedir_)*/nullptr
+  , /*decltype(_impl_.health_)*/nullptr
+  , /*decltype(_impl_.armor_)*/nullptr
+  , /*decltype(_impl_.boundsmin_)*/nullptr
+  , /*decltype(_impl_.boundsmax_)*/nullptr
+  , /*decltype(_impl_.entityindex_)*/0
+  , /*decltype(_impl_.entityserial_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_.classid_)*/0
+  , /*decltype(_impl_.entityflags_)*/int64_t{0}
+  , /*decltype(_impl_.team_)*/0
+  , /*decltype(_impl_.category_)*/0
+  , /*decltype(_impl_.navflags_)*/int64_t{0}
+  , /*decltype(_impl_.powerups_)*/0
+  , /*decltype(_impl_.entitynameid_)*/0u
+  , /*decltype(_impl_.deleted_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameEntityInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameEntityInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameEntityInfoDefaultTypeInternal() {}
+  union {
+    GameEntityInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameEntityInfoDefaultTypeInternal _GameEntityInfo_default_instance_;
+PROTOBUF_CONSTEXPR GameEntityPosition::GameEntityPosition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.velocity_)*/nullptr
+  , /*decltype(_impl_.team_)*/0
+  , /*decltype(_impl_.entityindex_)*/0
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameEntityPositionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameEntityPositionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameEntityPositionDefaultTypeInternal() {}
+  union {
+    GameEntityPosition _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameEntityPositionDefaultTypeInternal _GameEntityPosition_default_instance_;
+PROTOBUF_CONSTEXPR GameEntityTrajectory::GameEntityTrajectory(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.samples_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.entityindex_)*/0
+  , /*decltype(_impl_.team_)*/0
+  , /*decltype(_impl_.samplecount_)*/0u
+  , /*decltype(_impl_.precision_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameEntityTrajectoryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameEntityTrajectoryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameEntityTrajectoryDefaultTypeInternal() {}
+  union {
+    GameEntityTrajectory _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameEntityTrajectoryDefaultTypeInternal _GameEntityTrajectory_default_instance_;
+PROTOBUF_CONSTEXPR GameNode::GameNode(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.nodepath_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.meshname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.entityname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.eulerrotation_)*/nullptr
+  , /*decltype(_impl_.translation_)*/nullptr
+  , /*decltype(_impl_.entityid_)*/0
+  , /*decltype(_impl_.activestate_)*/0
+  , /*decltype(_impl_.navflagsactive_)*/int64_t{0}
+  , /*decltype(_impl_.navflagsoverride_)*/int64_t{0}
+  , /*decltype(_impl_.shapemode_)*/0
+  , /*decltype(_impl_.entitynameid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameNodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameNodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameNodeDefaultTypeInternal() {}
+  union {
+    GameNode _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameNodeDefaultTypeInternal _GameNode_default_instance_;
+PROTOBUF_CONSTEXPR GameWeaponFired::GameWeaponFired(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.trace_)*/nullptr
+  , /*decltype(_impl_.attackteam_)*/0
+  , /*decltype(_impl_.weaponid_)*/0
+  , /*decltype(_impl_.firedbyclass_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameWeaponFiredDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameWeaponFiredDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameWeaponFiredDefaultTypeInternal() {}
+  union {
+    GameWeaponFired _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameWeaponFiredDefaultTypeInternal _GameWeaponFired_default_instance_;
+PROTOBUF_CONSTEXPR GameDeath::GameDeath(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.meansofdeath_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.victimteam_)*/0
+  , /*decltype(_impl_.attackteam_)*/0
+  , /*decltype(_impl_.meansofdeathid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameDeathDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameDeathDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameDeathDefaultTypeInternal() {}
+  union {
+    GameDeath _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameDeathDefaultTypeInternal _GameDeath_default_instance_;
+PROTOBUF_CONSTEXPR GameKilledSomeone::GameKilledSomeone(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.meansofdeath_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.victimteam_)*/0
+  , /*decltype(_impl_.attackteam_)*/0
+  , /*decltype(_impl_.meansofdeathid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameKilledSomeoneDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameKilledSomeoneDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameKilledSomeoneDefaultTypeInternal() {}
+  union {
+    GameKilledSomeone _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameKilledSomeoneDefaultTypeInternal _GameKilledSomeone_default_instance_;
+PROTOBUF_CONSTEXPR GameRecieveDamage::GameRecieveDamage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.damagetype_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.victimteam_)*/0
+  , /*decltype(_impl_.attackteam_)*/0
+  , /*decltype(_impl_.weaponid_)*/0
+  , /*decltype(_impl_.damageamount_)*/0
+  , /*decltype(_impl_.damagetypeid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameRecieveDamageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameRecieveDamageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameRecieveDamageDefaultTypeInternal() {}
+  union {
+    GameRecieveDamage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameRecieveDamageDefaultTypeInternal _GameRecieveDamage_default_instance_;
+PROTOBUF_CONSTEXPR GameInflictDamage::GameInflictDamage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.damagetype_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.victimteam_)*/0
+  , /*decltype(_impl_.attackteam_)*/0
+  , /*decltype(_impl_.weaponid_)*/0
+  , /*decltype(_impl_.damageamount_)*/0
+  , /*decltype(_impl_.damagetypeid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameInflictDamageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameInflictDamageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameInflictDamageDefaultTypeInternal() {}
+  union {
+    GameInflictDamage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameInflictDamageDefaultTypeInternal _GameInflictDamage_default_instance_;
+PROTOBUF_CONSTEXPR GameRadiusDamage::GameRadiusDamage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.damagetype_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.damageamount_)*/0
+  , /*decltype(_impl_.damageradius_)*/0
+  , /*decltype(_impl_.damagetypeid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameRadiusDamageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameRadiusDamageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameRadiusDamageDefaultTypeInternal() {}
+  union {
+    GameRadiusDamage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameRadiusDamageDefaultTypeInternal _GameRadiusDamage_default_instance_;
+PROTOBUF_CONSTEXPR GameNavigationStuck::GameNavigationStuck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.entityid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameNavigationStuckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameNavigationStuckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameNavigationStuckDefaultTypeInternal() {}
+  union {
+    GameNavigationStuck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameNavigationStuckDefaultTypeInternal _GameNavigationStuck_default_instance_;
+PROTOBUF_CONSTEXPR GameVoiceMacro::GameVoiceMacro(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.entityid_)*/0
+  , /*decltype(_impl_.voicemacro_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameVoiceMacroDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameVoiceMacroDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameVoiceMacroDefaultTypeInternal() {}
+  union {
+    GameVoiceMacro _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameVoiceMacroDefaultTypeInternal _GameVoiceMacro_default_instance_;
+PROTOBUF_CONSTEXPR GameLogMessage::GameLogMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.logmessage_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.logextrainfo_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.logtype_)*/0
+  , /*decltype(_impl_.logmessageid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameLogMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameLogMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameLogMessageDefaultTypeInternal() {}
+  union {
+    GameLogMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameLogMessageDefaultTypeInternal _GameLogMessage_default_instance_;
+}  // namespace Analytics
+static ::_pb::Metadata file_level_metadata_analytics_2eproto[40];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_analytics_2eproto[4];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_analytics_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_analytics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_analytics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::PointEvent, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::PointEvent, radius_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::PointEvent, weight_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::PointEvent, _impl_.radius_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::PointEvent, _impl_.weight_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::LineEvent, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::LineEvent, radius_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::LineEvent, weight_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::LineEvent, _impl_.radius_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::LineEvent, _impl_.weight_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::LineEvent, _impl_.group_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::LineEvent, _impl_.maxstep_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::EditorChangeValue, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::EditorChangeValue, messagetype_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::EditorChangeValue, fieldname_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::EditorChangeValue, payload_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::EditorChangeValue, _impl_.messagetype_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::EditorChangeValue, _impl_.fieldname_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::EditorChangeValue, _impl_.payload_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::EditorChanges, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::EditorChanges, changes_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::EditorChanges, _impl_.changes_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::RangeF, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::RangeF, min_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::RangeF, max_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::RangeF, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::RangeF, _impl_.max_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::RangeI, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::RangeI, min_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::RangeI, max_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::RangeI, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::RangeI, _impl_.max_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::Vec3, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3, x_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3, y_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3, z_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3, _impl_.z_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3, _impl_.quantized_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::Vec3Color, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3Color, x_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3Color, y_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3Color, z_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3Color, color_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3Color, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3Color, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3Color, _impl_.z_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec3Color, _impl_.color_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::Vec4, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::Vec4, x_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Vec4, y_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Vec4, z_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Vec4, w_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec4, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec4, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec4, _impl_.z_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Vec4, _impl_.w_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::Line, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::Line, p0_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Line, p1_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::Line, _impl_.p0_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Line, _impl_.p1_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::Euler, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::Euler, heading_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Euler, pitch_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Euler, roll_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::Euler, _impl_.heading_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Euler, _impl_.pitch_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Euler, _impl_.roll_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::Material, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::Material, name_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Material, contents_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Material, surfaceflags_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Material, renderevents_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::Material, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Material, _impl_.contents_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Material, _impl_.surfaceflags_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Material, _impl_.renderevents_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::PrimitiveOptions, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::PrimitiveOptions, partindex_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::PrimitiveOptions, overridesurfaceflags_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::PrimitiveOptions, _impl_.partindex_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::PrimitiveOptions, _impl_.overridesurfaceflags_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::Primitive, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::Primitive, type_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Primitive, materialindex_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Primitive, options_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Primitive, size_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Primitive, vertices_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::Primitive, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Primitive, _impl_.materialindex_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Primitive, _impl_.options_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Primitive, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Primitive, _impl_.vertices_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::Mesh, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::Mesh, primitives_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Mesh, materials_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::Mesh, name_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::Mesh, _impl_.primitives_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Mesh, _impl_.materials_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::Mesh, _impl_.name_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, hour_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, minute_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, second_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, day_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, month_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, year_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, _impl_.hour_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, _impl_.minute_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, _impl_.second_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, _impl_.day_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, _impl_.month_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::UTCTime, _impl_.year_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameInfo, timestamp_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameInfo, mapname_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameInfo, gamename_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameInfo, gameversion_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInfo, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInfo, _impl_.mapname_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInfo, _impl_.gamename_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInfo, _impl_.gameversion_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInfo, _impl_.worldmins_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInfo, _impl_.worldmaxs_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum_EnumPair, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum_EnumPair, name_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum_EnumPair, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum_EnumPair, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum_EnumPair, _impl_.value_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum, values_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum, enumname_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum, isbitfield_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum, _impl_.values_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum, _impl_.enumname_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEnum, _impl_.isbitfield_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameString, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameString, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameString, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Analytics::LiveHeatmap, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::LiveHeatmap, _impl_.eventtype_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::LiveHeatmap, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::LiveHeatmap, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::LiveHeatmap, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::LiveHeatmap, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::LiveHeatmap, _impl_.maxvalue_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::LiveHeatmap, _impl_.worldmins_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::LiveHeatmap, _impl_.worldmaxs_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::LiveHeatmap, _impl_.values_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameNavNotFound, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNavNotFound, mapname_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNavNotFound, _impl_.mapname_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNavNotFound, _impl_.mapnameid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameNavAutoDownloaded, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNavAutoDownloaded, mapname_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNavAutoDownloaded, _impl_.mapname_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNavAutoDownloaded, _impl_.mapnameid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameAssert, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameAssert, condition_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameAssert, file_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameAssert, line_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameAssert, _impl_.condition_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameAssert, _impl_.file_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameAssert, _impl_.line_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameCrash, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameCrash, info_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameCrash, _impl_.info_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameMeshData, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameMeshData, compressiontype_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameMeshData, modelname_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameMeshData, modelbytes_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameMeshData, modelbytesuncompressed_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameMeshData, _impl_.compressiontype_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameMeshData, _impl_.modelname_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameMeshData, _impl_.modelbytes_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameMeshData, _impl_.modelbytesuncompressed_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo_Ammo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo_Ammo, ammotype_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo_Ammo, ammocount_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo_Ammo, _impl_.ammotype_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo_Ammo, _impl_.ammocount_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, entityname_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, entityindex_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, entityserial_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, groupid_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, classid_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, team_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, entityflags_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, category_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, powerups_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, navflags_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, eulerrotation_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, position_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, eyeoffset_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, eyedir_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, health_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, armor_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, boundsmin_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, boundsmax_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, ammo_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, deleted_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.entityname_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.entityindex_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.entityserial_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.groupid_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.classid_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.team_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.entityflags_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.category_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.powerups_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.navflags_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.eulerrotation_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.eyeoffset_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.eyedir_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.health_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.armor_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.boundsmin_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.boundsmax_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.ammo_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.entitynameid_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityInfo, _impl_.deleted_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityPosition, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityPosition, position_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityPosition, team_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityPosition, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityPosition, _impl_.team_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityPosition, _impl_.entityindex_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityPosition, _impl_.velocity_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityPosition, _impl_.timestamp_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityTrajectory, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityTrajectory, _impl_.entityindex_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityTrajectory, _impl_.team_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityTrajectory, _impl_.samplecount_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityTrajectory, _impl_.precision_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameEntityTrajectory, _impl_.samples_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, nodepath_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, eulerrotation_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, translation_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, meshname_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, entityid_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, entityname_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, activestate_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, navflagsactive_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, navflagsoverride_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, shapemode_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _impl_.nodepath_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _impl_.eulerrotation_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _impl_.translation_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _impl_.meshname_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _impl_.entityid_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _impl_.entityname_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _impl_.activestate_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _impl_.navflagsactive_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _impl_.navflagsoverride_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _impl_.shapemode_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNode, _impl_.entitynameid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameWeaponFired, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameWeaponFired, position_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameWeaponFired, attackteam_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameWeaponFired, weaponid_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameWeaponFired, firedbyclass_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameWeaponFired, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameWeaponFired, _impl_.attackteam_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameWeaponFired, _impl_.weaponid_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameWeaponFired, _impl_.firedbyclass_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameWeaponFired, _impl_.trace_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameDeath, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameDeath, position_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameDeath, victimteam_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameDeath, attackteam_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameDeath, meansofdeath_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameDeath, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameDeath, _impl_.victimteam_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameDeath, _impl_.attackteam_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameDeath, _impl_.meansofdeath_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameDeath, _impl_.meansofdeathid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameKilledSomeone, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameKilledSomeone, position_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameKilledSomeone, victimteam_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameKilledSomeone, attackteam_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameKilledSomeone, meansofdeath_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameKilledSomeone, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameKilledSomeone, _impl_.victimteam_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameKilledSomeone, _impl_.attackteam_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameKilledSomeone, _impl_.meansofdeath_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameKilledSomeone, _impl_.meansofdeathid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, position_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, victimteam_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, attackteam_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, weaponid_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, damagetype_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, damageamount_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, _impl_.victimteam_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, _impl_.attackteam_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, _impl_.weaponid_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, _impl_.damagetype_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, _impl_.damageamount_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRecieveDamage, _impl_.damagetypeid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, position_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, victimteam_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, attackteam_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, weaponid_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, damagetype_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, damageamount_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, _impl_.victimteam_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, _impl_.attackteam_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, _impl_.weaponid_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, _impl_.damagetype_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, _impl_.damageamount_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameInflictDamage, _impl_.damagetypeid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameRadiusDamage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameRadiusDamage, position_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameRadiusDamage, damagetype_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameRadiusDamage, damageamount_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameRadiusDamage, damageradius_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRadiusDamage, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRadiusDamage, _impl_.damagetype_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRadiusDamage, _impl_.damageamount_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRadiusDamage, _impl_.damageradius_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameRadiusDamage, _impl_.damagetypeid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameNavigationStuck, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNavigationStuck, entityid_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameNavigationStuck, position_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNavigationStuck, _impl_.entityid_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameNavigationStuck, _impl_.position_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameVoiceMacro, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameVoiceMacro, entityid_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameVoiceMacro, voicemacro_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameVoiceMacro, position_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameVoiceMacro, _impl_.entityid_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameVoiceMacro, _impl_.voicemacro_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameVoiceMacro, _impl_.position_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Analytics::GameLogMessage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameLogMessage, logtype_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameLogMessage, logmessage_),
-  PROTOBUF_FIELD_OFFSET(::Analytics::GameLogMessage, logextrainfo_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameLogMessage, _impl_.logtype_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameLogMessage, _impl_.logmessage_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameLogMessage, _impl_.logextrainfo_),
+  PROTOBUF_FIELD_OFFSET(::Analytics::GameLogMessage, _impl_.logmessageid_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::Analytics::PointEvent)},
-  { 7, -1, sizeof(::Analytics::LineEvent)},
-  { 14, -1, sizeof(::Analytics::EditorChangeValue)},
-  { 22, -1, sizeof(::Analytics::EditorChanges)},
-  { 28, -1, sizeof(::Analytics::RangeF)},
-  { 35, -1, sizeof(::Analytics::RangeI)},
-  { 42, -1, sizeof(::Analytics::Vec3)},
-  { 50, -1, sizeof(::Analytics::Vec3Color)},
-  { 59, -1, sizeof(::Analytics::Vec4)},
-  { 68, -1, sizeof(::Analytics::Line)},
-  { 75, -1, sizeof(::Analytics::Euler)},
-  { 83, -1, sizeof(::Analytics::Material)},
-  { 92, -1, sizeof(::Analytics::PrimitiveOptions)},
-  { 99, -1, sizeof(::Analytics::Primitive)},
-  { 109, -1, sizeof(::Analytics::Mesh)},
-  { 117, -1, sizeof(::Analytics::UTCTime)},
-  { 128, -1, sizeof(::Analytics::GameInfo)},
-  { 137, -1, sizeof(::Analytics::GameEnum_EnumPair)},
-  { 144, -1, sizeof(::Analytics::GameEnum)},
-  { 152, -1, sizeof(::Analytics::GameNavNotFound)},
-  { 158, -1, sizeof(::Analytics::GameNavAutoDownloaded)},
-  { 164, -1, sizeof(::Analytics::GameAssert)},
-  { 172, -1, sizeof(::Analytics::GameCrash)},
-  { 178, -1, sizeof(::Analytics::GameMeshData)},
-  { 187, -1, sizeof(::Analytics::GameEntityInfo_Ammo)},
-  { 194, -1, sizeof(::Analytics::GameEntityInfo)},
-  { 219, -1, sizeof(::Analytics::GameEntityPosition)},
-  { 226, -1, sizeof(::Analytics::GameNode)},
-  { 241, -1, sizeof(::Analytics::GameWeaponFired)},
-  { 250, -1, sizeof(::Analytics::GameDeath)},
-  { 259, -1, sizeof(::Analytics::GameKilledSomeone)},
-  { 268, -1, sizeof(::Analytics::GameRecieveDamage)},
-  { 279, -1, sizeof(::Analytics::GameInflictDamage)},
-  { 290, -1, sizeof(::Analytics::GameRadiusDamage)},
-  { 299, -1, sizeof(::Analytics::GameNavigationStuck)},
-  { 306, -1, sizeof(::Analytics::GameVoiceMacro)},
-  { 314, -1, sizeof(::Analytics::GameLogMessage)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::Analytics::PointEvent)},
+  { 8, -1, -1, sizeof(::Analytics::LineEvent)},
+  { 18, -1, -1, sizeof(::Analytics::EditorChangeValue)},
+  { 27, -1, -1, sizeof(::Analytics::EditorChanges)},
+  { 34, -1, -1, sizeof(::Analytics::RangeF)},
+  { 42, -1, -1, sizeof(::Analytics::RangeI)},
+  { 50, -1, -1, sizeof(::Analytics::Vec3)},
+  { 60, -1, -1, sizeof(::Analytics::Vec3Color)},
+  { 70, -1, -1, sizeof(::Analytics::Vec4)},
+  { 80, -1, -1, sizeof(::Analytics::Line)},
+  { 88, -1, -1, sizeof(::Analytics::Euler)},
+  { 97, -1, -1, sizeof(::Analytics::Material)},
+  { 107, -1, -1, sizeof(::Analytics::PrimitiveOptions)},
+  { 115, -1, -1, sizeof(::Analytics::Primitive)},
+  { 126, -1, -1, sizeof(::Analytics::Mesh)},
+  { 135, -1, -1, sizeof(::Analytics::UTCTime)},
+  { 147, -1, -1, sizeof(::Analytics::GameInfo)},
+  { 159, -1, -1, sizeof(::Analytics::GameEnum_EnumPair)},
+  { 167, -1, -1, sizeof(::Analytics::GameEnum)},
+  { 176, -1, -1, sizeof(::Analytics::GameString)},
+  { 184, -1, -1, sizeof(::Analytics::LiveHeatmap)},
+  { 199, -1, -1, sizeof(::Analytics::GameNavNotFound)},
+  { 207, -1, -1, sizeof(::Analytics::GameNavAutoDownloaded)},
+  { 215, -1, -1, sizeof(::Analytics::GameAssert)},
+  { 224, -1, -1, sizeof(::Analytics::GameCrash)},
+  { 231, -1, -1, sizeof(::Analytics::GameMeshData)},
+  { 241, -1, -1, sizeof(::Analytics::GameEntityInfo_Ammo)},
+  { 249, -1, -1, sizeof(::Analytics::GameEntityInfo)},
+  { 276, -1, -1, sizeof(::Analytics::GameEntityPosition)},
+  { 287, -1, -1, sizeof(::Analytics::GameEntityTrajectory)},
+  { 298, -1, -1, sizeof(::Analytics::GameNode)},
+  { 315, -1, -1, sizeof(::Analytics::GameWeaponFired)},
+  { 326, -1, -1, sizeof(::Analytics::GameDeath)},
+  { 337, -1, -1, sizeof(::Analytics::GameKilledSomeone)},
+  { 348, -1, -1, sizeof(::Analytics::GameRecieveDamage)},
+  { 361, -1, -1, sizeof(::Analytics::GameInflictDamage)},
+  { 374, -1, -1, sizeof(::Analytics::GameRadiusDamage)},
+  { 385, -1, -1, sizeof(::Analytics::GameNavigationStuck)},
+  { 393, -1, -1, sizeof(::Analytics::GameVoiceMacro)},
+  { 402, -1, -1, sizeof(::Analytics::GameLogMessage)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_PointEvent_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_LineEvent_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_EditorChangeValue_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_EditorChanges_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_RangeF_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_RangeI_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_Vec3_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_Vec3Color_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_Vec4_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_Line_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_Euler_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_Material_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_PrimitiveOptions_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_Primitive_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_Mesh_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_UTCTime_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameEnum_EnumPair_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameEnum_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameNavNotFound_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameNavAutoDownloaded_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameAssert_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameCrash_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameMeshData_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameEntityInfo_Ammo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameEntityInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameEntityPosition_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameNode_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameWeaponFired_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameDeath_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameKilledSomeone_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameRecieveDamage_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameInflictDamage_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameRadiusDamage_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameNavigationStuck_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameVoiceMacro_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::Analytics::_GameLogMessage_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Analytics::_PointEvent_default_instance_._instance,
+  &::Analytics::_LineEvent_default_instance_._instance,
+  &::Analytics::_EditorChangeValue_default_instance_._instance,
+  &::Analytics::_EditorChanges_default_instance_._instance,
+  &::Analytics::_RangeF_default_instance_._instance,
+  &::Analytics::_RangeI_default_instance_._instance,
+  &::Analytics::_Vec3_default_instance_._instance,
+  &::Analytics::_Vec3Color_default_instance_._instance,
+  &::Analytics::_Vec4_default_instance_._instance,
+  &::Analytics::_Line_default_instance_._instance,
+  &::Analytics::_Euler_default_instance_._instance,
+  &::Analytics::_Material_default_instance_._instance,
+  &::Analytics::_PrimitiveOptions_default_instance_._instance,
+  &::Analytics::_Primitive_default_instance_._instance,
+  &::Analytics::_Mesh_default_instance_._instance,
+  &::Analytics::_UTCTime_default_instance_._instance,
+  &::Analytics::_GameInfo_default_instance_._instance,
+  &::Analytics::_GameEnum_EnumPair_default_instance_._instance,
+  &::Analytics::_GameEnum_default_instance_._instance,
+  &::Analytics::_GameString_default_instance_._instance,
+  &::Analytics::_LiveHeatmap_default_instance_._instance,
+  &::Analytics::_GameNavNotFound_default_instance_._instance,
+  &::Analytics::_GameNavAutoDownloaded_default_instance_._instance,
+  &::Analytics::_GameAssert_default_instance_._instance,
+  &::Analytics::_GameCrash_default_instance_._instance,
+  &::Analytics::_GameMeshData_default_instance_._instance,
+  &::Analytics::_GameEntityInfo_Ammo_default_instance_._instance,
+  &::Analytics::_GameEntityInfo_default_instance_._instance,
+  &::Analytics::_GameEntityPosition_default_instance_._instance,
+  &::Analytics::_GameEntityTrajectory_default_instance_._instance,
+  &::Analytics::_GameNode_default_instance_._instance,
+  &::Analytics::_GameWeaponFired_default_instance_._instance,
+  &::Analytics::_GameDeath_default_instance_._instance,
+  &::Analytics::_GameKilledSomeone_default_instance_._instance,
+  &::Analytics::_GameRecieveDamage_default_instance_._instance,
+  &::Analytics::_GameInflictDamage_default_instance_._instance,
+  &::Analytics::_GameRadiusDamage_default_instance_._instance,
+  &::Analytics::_GameNavigationStuck_default_instance_._instance,
+  &::Analytics::_GameVoiceMacro_default_instance_._instance,
+  &::Analytics::_GameLogMessage_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_analytics_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\017analytics.proto\022\tAnalytics\032 google/pro"
   "tobuf/descriptor.proto\",\n\nPointEvent\022\016\n\006"
-  "radius\030\001 \001(\t\022\016\n\006weight\030\002 \001(\t\"+\n\tLineEven"
-  "t\022\016\n\006radius\030\001 \001(\t\022\016\n\006weight\030\002 \001(\t\"L\n\021Edi"
-  "torChangeValue\022\023\n\013messageType\030\001 \001(\t\022\021\n\tf"
-  "ieldName\030\002 \001(\t\022\017\n\007payload\030\003 \001(\t\">\n\rEdito"
-  "rChanges\022-\n\007changes\030\001 \003(\0132\034.Analytics.Ed"
-  "itorChangeValue\"\"\n\006RangeF\022\013\n\003min\030\001 \001(\002\022\013"
-  "\n\003max\030\002 \001(\002\"\"\n\006RangeI\022\013\n\003min\030\001 \001(\005\022\013\n\003ma"
-  "x\030\002 \001(\005\"\'\n\004Vec3\022\t\n\001x\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\022\t\n"
-  "\001z\030\003 \001(\002\";\n\tVec3Color\022\t\n\001x\030\001 \001(\002\022\t\n\001y\030\002 "
-  "\001(\002\022\t\n\001z\030\003 \001(\002\022\r\n\005color\030\004 \001(\r\"2\n\004Vec4\022\t\n"
-  "\001x\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001(\002\022\t\n\001w\030\004 \001("
-  "\002\"@\n\004Line\022\033\n\002p0\030\001 \001(\0132\017.Analytics.Vec3\022\033"
-  "\n\002p1\030\002 \001(\0132\017.Analytics.Vec3\"5\n\005Euler\022\017\n\007"
-  "heading\030\001 \001(\002\022\r\n\005pitch\030\002 \001(\002\022\014\n\004roll\030\003 \001"
-  "(\002\"\204\001\n\010Material\022\014\n\004name\030\001 \001(\t\022\'\n\010content"
-  "s\030\002 \001(\rB\025\212\372\001\rCONTENT_FLAGS\240\372\001\001\022+\n\014surfac"
-  "eFlags\030\003 \001(\rB\025\212\372\001\rSURFACE_FLAGS\240\372\001\001\022\024\n\014r"
-  "enderEvents\030\004 \001(\010\"d\n\020PrimitiveOptions\022\027\n"
-  "\tpartIndex\030\001 \001(\rB\004\300\372\001\001\0227\n\024overrideSurfac"
-  "eFlags\030\002 \001(\rB\031\220\372\001\001\212\372\001\rSURFACE_FLAGS\240\372\001\001\""
-  "\256\001\n\tPrimitive\022&\n\004type\030\001 \001(\0162\030.Analytics."
-  "PrimitiveType\022\025\n\rmaterialIndex\030\002 \001(\r\022,\n\007"
-  "options\030\003 \001(\0132\033.Analytics.PrimitiveOptio"
-  "ns\022\014\n\004size\030\004 \001(\002\022&\n\010vertices\030\005 \003(\0132\024.Ana"
-  "lytics.Vec3Color\"f\n\004Mesh\022(\n\nprimitives\030\001"
-  " \003(\0132\024.Analytics.Primitive\022&\n\tmaterials\030"
-  "\002 \003(\0132\023.Analytics.Material\022\014\n\004name\030\003 \001(\t"
-  "\"a\n\007UTCTime\022\014\n\004hour\030\001 \001(\005\022\016\n\006minute\030\002 \001("
-  "\005\022\016\n\006second\030\003 \001(\005\022\013\n\003day\030\004 \001(\005\022\r\n\005month\030"
-  "\005 \001(\005\022\014\n\004year\030\006 \001(\005\"s\n\010GameInfo\022%\n\ttimeS"
-  "tamp\030\001 \001(\0132\022.Analytics.UTCTime\022\017\n\007mapNam"
-  "e\030\002 \001(\t\022\020\n\010gameName\030\003 \001(\t\022\023\n\013gameVersion"
-  "\030\004 \001(\t:\010\300\270\002\001\330\270\002\001\"\231\001\n\010GameEnum\022,\n\006values\030"
-  "\001 \003(\0132\034.Analytics.GameEnum.EnumPair\022\020\n\010e"
-  "numname\030\002 \001(\t\022\022\n\nisbitfield\030\003 \001(\010\032\'\n\010Enu"
-  "mPair\022\014\n\004name\030\001 \001(\t\022\r\n\005value\030\002 \001(\003:\020\300\270\002\003"
-  "\312\270\002\010enumname\"(\n\017GameNavNotFound\022\017\n\007mapNa"
-  "me\030\001 \001(\t:\004\300\270\002\002\".\n\025GameNavAutoDownloaded\022"
-  "\017\n\007mapName\030\001 \001(\t:\004\300\270\002\002\"A\n\nGameAssert\022\021\n\t"
-  "condition\030\001 \001(\t\022\014\n\004file\030\002 \001(\t\022\014\n\004line\030\003 "
-  "\001(\005:\004\300\270\002\002\"\037\n\tGameCrash\022\014\n\004info\030\001 \001(\t:\004\300\270"
-  "\002\002\"\231\001\n\014GameMeshData\022/\n\017compressionType\030\001"
-  " \001(\0162\026.Analytics.Compression\022\021\n\tmodelNam"
-  "e\030\002 \001(\t\022\022\n\nmodelBytes\030\003 \001(\014\022\036\n\026modelByte"
-  "sUncompressed\030\004 \001(\r:\021\300\270\002\003\312\270\002\tmodelName\"\265"
-  "\006\n\016GameEntityInfo\022\022\n\nentityName\030\001 \001(\t\022\023\n"
-  "\013entityIndex\030\002 \001(\005\022\024\n\014entitySerial\030\003 \001(\005"
-  "\022\035\n\007groupId\030\004 \001(\005B\014\212\372\001\010GROUP_ID\022\035\n\007class"
-  "Id\030\005 \001(\005B\014\212\372\001\010CLASS_ID\022\031\n\004team\030\006 \001(\005B\013\212\372"
-  "\001\007TEAM_ID\022)\n\013entityFlags\030\007 \001(\003B\024\212\372\001\014ENTI"
-  "TY_FLAGS\270\372\001\001\022%\n\010category\030\010 \001(\005B\023\212\372\001\013CATE"
-  "GORY_ID\270\372\001\001\022$\n\010powerUps\030\t \001(\005B\022\212\372\001\nPOWER"
-  "UP_ID\270\372\001\001\022\037\n\010navFlags\030\n \001(\003B\r\212\372\001\tNAV_FLA"
-  "GS\022,\n\reulerRotation\030\013 \001(\0132\017.Analytics.Ve"
-  "c3B\004\260\372\001\001\022\'\n\010position\030\014 \001(\0132\017.Analytics.V"
-  "ec3B\004\260\372\001\001\022(\n\teyeOffset\030\r \001(\0132\017.Analytics"
-  ".Vec3B\004\260\372\001\001\022%\n\006eyeDir\030\016 \001(\0132\017.Analytics."
-  "Vec3B\004\260\372\001\001\022!\n\006health\030\017 \001(\0132\021.Analytics.R"
-  "angeI\022 \n\005armor\030\020 \001(\0132\021.Analytics.RangeI\022"
-  "\"\n\tboundsMin\030\021 \001(\0132\017.Analytics.Vec3\022\"\n\tb"
-  "oundsMax\030\022 \001(\0132\017.Analytics.Vec3\022,\n\004ammo\030"
-  "\023 \003(\0132\036.Analytics.GameEntityInfo.Ammo\022\026\n"
-  "\007deleted\030\350\007 \001(\010B\004\260\372\001\001\032:\n\004Ammo\022\037\n\010ammoTyp"
-  "e\030\001 \001(\rB\r\212\372\001\tAMMO_TYPE\022\021\n\tammoCount\030\002 \001("
-  "\r:;\300\270\002\003\312\270\002\013entityIndex\352\270\002$Entity(%entity"
-  "Index% - %entityName%)\"m\n\022GameEntityPosi"
-  "tion\0222\n\010position\030\001 \001(\0132\017.Analytics.Vec3B"
-  "\017\342\372\001\004\n\00232\342\372\001\003\022\0011\022\035\n\004team\030\002 \001(\005B\017\212\372\001\007TEAM"
-  "_ID\310\372\001\001:\004\300\270\002\002\"\332\002\n\010GameNode\022\026\n\010nodePath\030\001"
-  " \001(\tB\004\300\372\001\001\022&\n\reulerRotation\030\002 \001(\0132\017.Anal"
-  "ytics.Vec3\022$\n\013translation\030\003 \001(\0132\017.Analyt"
-  "ics.Vec3\022\020\n\010meshName\030\004 \001(\t\022\020\n\010entityId\030\n"
-  " \001(\005\022\022\n\nentityName\030\013 \001(\t\022$\n\013activeState\030"
-  "\014 \001(\005B\017\212\372\001\013MODEL_STATE\022%\n\016navFlagsActive"
-  "\030\r \001(\003B\r\212\372\001\tNAV_FLAGS\022+\n\020navFlagsOverrid"
-  "e\030\016 \001(\003B\021\212\372\001\tNAV_FLAGS\220\372\001\001\022$\n\tshapeMode\030"
-  "\017 \001(\005B\021\212\372\001\tSHAPEMODE\220\372\001\001:\020\300\270\002\003\312\270\002\010nodePa"
-  "th\"\301\001\n\017GameWeaponFired\0222\n\010position\030\001 \001(\013"
-  "2\017.Analytics.Vec3B\017\342\372\001\004\n\00264\342\372\001\003\022\0011\022#\n\nat"
-  "tackTeam\030\002 \001(\005B\017\212\372\001\007TEAM_ID\310\372\001\001\022#\n\010weapo"
-  "nId\030\003 \001(\005B\021\212\372\001\tWEAPON_ID\310\372\001\001\022&\n\014firedByC"
-  "lass\030\004 \001(\005B\020\212\372\001\010CLASS_ID\310\372\001\001:\010\300\270\002\002\330\270\002\001\"\253"
-  "\001\n\tGameDeath\0222\n\010position\030\001 \001(\0132\017.Analyti"
-  "cs.Vec3B\017\342\372\001\004\n\00232\342\372\001\003\022\0011\022#\n\nvictimTeam\030\002"
-  " \001(\005B\017\212\372\001\007TEAM_ID\310\372\001\001\022#\n\nattackTeam\030\003 \001("
-  "\005B\017\212\372\001\007TEAM_ID\310\372\001\001\022\032\n\014meansOfDeath\030\004 \001(\t"
-  "B\004\310\372\001\001:\004\300\270\002\002\"\263\001\n\021GameKilledSomeone\0222\n\010po"
-  "sition\030\001 \001(\0132\017.Analytics.Vec3B\017\342\372\001\004\n\00232\342"
-  "\372\001\003\022\0011\022#\n\nvictimTeam\030\002 \001(\005B\017\212\372\001\007TEAM_ID\310"
-  "\372\001\001\022#\n\nattackTeam\030\003 \001(\005B\017\212\372\001\007TEAM_ID\310\372\001\001"
-  "\022\032\n\014meansOfDeath\030\004 \001(\tB\004\310\372\001\001:\004\300\270\002\002\"\367\001\n\021G"
-  "ameRecieveDamage\022=\n\010position\030\001 \001(\0132\017.Ana"
-  "lytics.Vec3B\032\342\372\001\004\n\00232\342\372\001\016\022\014damageAmount\022"
-  "#\n\nvictimTeam\030\002 \001(\005B\017\212\372\001\007TEAM_ID\310\372\001\001\022#\n\n"
-  "attackTeam\030\003 \001(\005B\017\212\372\001\007TEAM_ID\310\372\001\001\022#\n\010wea"
-  "ponId\030\004 \001(\005B\021\212\372\001\tWEAPON_ID\310\372\001\001\022\030\n\ndamage"
-  "Type\030\005 \001(\tB\004\310\372\001\001\022\024\n\014damageAmount\030\006 \001(\002:\004"
-  "\300\270\002\002\"\367\001\n\021GameInflictDamage\022=\n\010position\030\001"
-  " \001(\0132\017.Analytics.Vec3B\032\342\372\001\004\n\00232\342\372\001\016\022\014dam"
-  "ageAmount\022#\n\nvictimTeam\030\002 \001(\005B\017\212\372\001\007TEAM_"
+  "radius\030\001 \001(\t\022\016\n\006weight\030\002 \001(\t\"K\n\tLineEven"
+  "t\022\016\n\006radius\030\001 \001(\t\022\016\n\006weight\030\002 \001(\t\022\r\n\005gro"
+  "up\030\003 \001(\t\022\017\n\007maxStep\030\004 \001(\002\"L\n\021EditorChang"
+  "eValue\022\023\n\013messageType\030\001 \001(\t\022\021\n\tfieldName"
+  "\030\002 \001(\t\022\017\n\007payload\030\003 \001(\t\">\n\rEditorChanges"
+  "\022-\n\007changes\030\001 \003(\0132\034.Analytics.EditorChan"
+  "geValue\"\"\n\006RangeF\022\013\n\003min\030\001 \001(\002\022\013\n\003max\030\002 "
+  "\001(\002\"\"\n\006RangeI\022\013\n\003min\030\001 \001(\005\022\013\n\003max\030\002 \001(\005\""
+  ":\n\004Vec3\022\t\n\001x\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001(\002"
+  "\022\021\n\tquantized\030\004 \001(\004\";\n\tVec3Color\022\t\n\001x\030\001 "
+  "\001(\002\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001(\002\022\r\n\005color\030\004 \001(\r"
+  "\"2\n\004Vec4\022\t\n\001x\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001("
+  "\002\022\t\n\001w\030\004 \001(\002\"@\n\004Line\022\033\n\002p0\030\001 \001(\0132\017.Analy"
+  "tics.Vec3\022\033\n\002p1\030\002 \001(\0132\017.Analytics.Vec3\"5"
+  "\n\005Euler\022\017\n\007heading\030\001 \001(\002\022\r\n\005pitch\030\002 \001(\002\022"
+  "\014\n\004roll\030\003 \001(\002\"\204\001\n\010Material\022\014\n\004name\030\001 \001(\t"
+  "\022\'\n\010contents\030\002 \001(\rB\025\212\372\001\rCONTENT_FLAGS\240\372\001"
+  "\001\022+\n\014surfaceFlags\030\003 \001(\rB\025\212\372\001\rSURFACE_FLA"
+  "GS\240\372\001\001\022\024\n\014renderEvents\030\004 \001(\010\"d\n\020Primitiv"
+  "eOptions\022\027\n\tpartIndex\030\001 \001(\rB\004\300\372\001\001\0227\n\024ove"
+  "rrideSurfaceFlags\030\002 \001(\rB\031\220\372\001\001\212\372\001\rSURFACE"
+  "_FLAGS\240\372\001\001\"\256\001\n\tPrimitive\022&\n\004type\030\001 \001(\0162\030"
+  ".Analytics.PrimitiveType\022\025\n\rmaterialInde"
+  "x\030\002 \001(\r\022,\n\007options\030\003 \001(\0132\033.Analytics.Pri"
+  "mitiveOptions\022\014\n\004size\030\004 \001(\002\022&\n\010vertices\030"
+  "\005 \003(\0132\024.Analytics.Vec3Color\"f\n\004Mesh\022(\n\np"
+  "rimitives\030\001 \003(\0132\024.Analytics.Primitive\022&\n"
+  "\tmaterials\030\002 \003(\0132\023.Analytics.Material\022\014\n"
+  "\004name\030\003 \001(\t\"a\n\007UTCTime\022\014\n\004hour\030\001 \001(\005\022\016\n\006"
+  "minute\030\002 \001(\005\022\016\n\006second\030\003 \001(\005\022\013\n\003day\030\004 \001("
+  "\005\022\r\n\005month\030\005 \001(\005\022\014\n\004year\030\006 \001(\005\"\273\001\n\010GameI"
+  "nfo\022%\n\ttimeStamp\030\001 \001(\0132\022.Analytics.UTCTi"
+  "me\022\017\n\007mapName\030\002 \001(\t\022\020\n\010gameName\030\003 \001(\t\022\023\n"
+  "\013gameVersion\030\004 \001(\t\022\"\n\tworldMins\030\005 \001(\0132\017."
+  "Analytics.Vec3\022\"\n\tworldMaxs\030\006 \001(\0132\017.Anal"
+  "ytics.Vec3:\010\300\270\002\001\330\270\002\001\"\231\001\n\010GameEnum\022,\n\006val"
+  "ues\030\001 \003(\0132\034.Analytics.GameEnum.EnumPair\022"
+  "\020\n\010enumname\030\002 \001(\t\022\022\n\nisbitfield\030\003 \001(\010\032\'\n"
+  "\010EnumPair\022\014\n\004name\030\001 \001(\t\022\r\n\005value\030\002 \001(\003:\020"
+  "\300\270\002\003\312\270\002\010enumname\"3\n\nGameString\022\n\n\002id\030\001 \001"
+  "(\r\022\r\n\005value\030\002 \001(\t:\n\300\270\002\003\312\270\002\002id\"\311\001\n\013LiveHe"
+  "atmap\022\021\n\teventType\030\001 \001(\t\022\013\n\003key\030\002 \001(\t\022\021\n"
+  "\ttimeStamp\030\003 \001(\003\022\r\n\005width\030\004 \001(\005\022\016\n\006heigh"
+  "t\030\005 \001(\005\022\020\n\010maxValue\030\006 \001(\002\022\"\n\tworldMins\030\007"
+  " \001(\0132\017.Analytics.Vec3\022\"\n\tworldMaxs\030\010 \001(\013"
+  "2\017.Analytics.Vec3\022\016\n\006values\030\t \001(\014\"P\n\017Gam"
+  "eNavNotFound\022\036\n\007mapName\030\001 \001(\tB\r\372\372\001\tmapNa"
+  "meId\022\027\n\tmapNameId\030\002 \001(\rB\004\260\372\001\001:\004\300\270\002\002\"V\n\025G"
+  "ameNavAutoDownloaded\022\036\n\007mapName\030\001 \001(\tB\r\372"
+  "\372\001\tmapNameId\022\027\n\tmapNameId\030\002 \001(\rB\004\260\372\001\001:\004\300"
+  "\270\002\002\"A\n\nGameAssert\022\021\n\tcondition\030\001 \001(\t\022\014\n\004"
+  "file\030\002 \001(\t\022\014\n\004line\030\003 \001(\005:\004\300\270\002\002\"\037\n\tGameCr"
+  "ash\022\014\n\004info\030\001 \001(\t:\004\300\270\002\002\"\231\001\n\014GameMeshData"
+  "\022/\n\017compressionType\030\001 \001(\0162\026.Analytics.Co"
+  "mpression\022\021\n\tmodelName\030\002 \001(\t\022\022\n\nmodelByt"
+  "es\030\003 \001(\014\022\036\n\026modelBytesUncompressed\030\004 \001(\r"
+  ":\021\300\270\002\003\312\270\002\tmodelName\"\343\006\n\016GameEntityInfo\022$"
+  "\n\nentityName\030\001 \001(\tB\020\372\372\001\014entityNameId\022\023\n\013"
+  "entityIndex\030\002 \001(\005\022\024\n\014entitySerial\030\003 \001(\005\022"
+  "\035\n\007groupId\030\004 \001(\005B\014\212\372\001\010GROUP_ID\022\035\n\007classI"
+  "d\030\005 \001(\005B\014\212\372\001\010CLASS_ID\022\031\n\004team\030\006 \001(\005B\013\212\372\001"
+  "\007TEAM_ID\022)\n\013entityFlags\030\007 \001(\003B\024\212\372\001\014ENTIT"
+  "Y_FLAGS\270\372\001\001\022%\n\010category\030\010 \001(\005B\023\212\372\001\013CATEG"
+  "ORY_ID\270\372\001\001\022$\n\010powerUps\030\t \001(\005B\022\212\372\001\nPOWERU"
+  "P_ID\270\372\001\001\022\037\n\010navFlags\030\n \001(\003B\r\212\372\001\tNAV_FLAG"
+  "S\022,\n\reulerRotation\030\013 \001(\0132\017.Analytics.Vec"
+  "3B\004\260\372\001\001\022\'\n\010position\030\014 \001(\0132\017.Analytics.Ve"
+  "c3B\004\260\372\001\001\022(\n\teyeOffset\030\r \001(\0132\017.Analytics."
+  "Vec3B\004\260\372\001\001\022%\n\006eyeDir\030\016 \001(\0132\017.Analytics.V"
+  "ec3B\004\260\372\001\001\022!\n\006health\030\017 \001(\0132\021.Analytics.Ra"
+  "ngeI\022 \n\005armor\030\020 \001(\0132\021.Analytics.RangeI\022\""
+  "\n\tboundsMin\030\021 \001(\0132\017.Analytics.Vec3\022\"\n\tbo"
+  "undsMax\030\022 \001(\0132\017.Analytics.Vec3\022,\n\004ammo\030\023"
+  " \003(\0132\036.Analytics.GameEntityInfo.Ammo\022\032\n\014"
+  "entityNameId\030\024 \001(\rB\004\260\372\001\001\022\026\n\007deleted\030\350\007 \001"
+  "(\010B\004\260\372\001\001\032:\n\004Ammo\022\037\n\010ammoType\030\001 \001(\rB\r\212\372\001\t"
+  "AMMO_TYPE\022\021\n\tammoCount\030\002 \001(\r:;\300\270\002\003\312\270\002\013en"
+  "tityIndex\352\270\002$Entity(%entityIndex% - %ent"
+  "ityName%)\"\346\001\n\022GameEntityPosition\022T\n\010posi"
+  "tion\030\001 \001(\0132\017.Analytics.Vec3B1\342\372\001\004\n\00232\342\372\001"
+  "\003\022\0011\352\372\001\004\n\00232\352\372\001\r\032\013entityIndex\352\372\001\005%\000\000\000D\022\035"
+  "\n\004team\030\002 \001(\005B\017\212\372\001\007TEAM_ID\310\372\001\001\022\023\n\013entityI"
+  "ndex\030\003 \001(\005\022\'\n\010velocity\030\004 \001(\0132\017.Analytics"
+  ".Vec3B\004\260\372\001\001\022\027\n\ttimeStamp\030\005 \001(\003B\004\260\372\001\001:\004\300\270"
+  "\002\002\"\224\001\n\024GameEntityTrajectory\022\023\n\013entityInd"
+  "ex\030\001 \001(\005\022\031\n\004team\030\002 \001(\005B\013\212\372\001\007TEAM_ID\022\023\n\013s"
+  "ampleCount\030\003 \001(\r\022\021\n\tprecision\030\004 \001(\002\022\017\n\007s"
+  "amples\030\005 \001(\014:\023\300\270\002\002\322\270\002\013entityIndex\"\210\003\n\010Ga"
+  "meNode\022\026\n\010nodePath\030\001 \001(\tB\004\300\372\001\001\022&\n\reulerR"
+  "otation\030\002 \001(\0132\017.Analytics.Vec3\022$\n\013transl"
+  "ation\030\003 \001(\0132\017.Analytics.Vec3\022\020\n\010meshName"
+  "\030\004 \001(\t\022\020\n\010entityId\030\n \001(\005\022$\n\nentityName\030\013"
+  " \001(\tB\020\372\372\001\014entityNameId\022$\n\013activeState\030\014 "
+  "\001(\005B\017\212\372\001\013MODEL_STATE\022%\n\016navFlagsActive\030\r"
+  " \001(\003B\r\212\372\001\tNAV_FLAGS\022+\n\020navFlagsOverride\030"
+  "\016 \001(\003B\021\212\372\001\tNAV_FLAGS\220\372\001\001\022$\n\tshapeMode\030\017 "
+  "\001(\005B\021\212\372\001\tSHAPEMODE\220\372\001\001\022\032\n\014entityNameId\030\020"
+  " \001(\rB\004\260\372\001\001:\020\300\270\002\003\312\270\002\010nodePath\"\362\001\n\017GameWea"
+  "ponFired\0222\n\010position\030\001 \001(\0132\017.Analytics.V"
+  "ec3B\017\342\372\001\004\n\00264\342\372\001\003\022\0011\022#\n\nattackTeam\030\002 \001(\005"
+  "B\017\212\372\001\007TEAM_ID\310\372\001\001\022#\n\010weaponId\030\003 \001(\005B\021\212\372\001"
+  "\tWEAPON_ID\310\372\001\001\022&\n\014firedByClass\030\004 \001(\005B\020\212\372"
+  "\001\010CLASS_ID\310\372\001\001\022/\n\005trace\030\005 \001(\0132\017.Analytic"
+  "s.LineB\017\352\372\001\004\n\00216\352\372\001\003\022\0011:\010\300\270\002\002\330\270\002\001\"\333\001\n\tGa"
+  "meDeath\0222\n\010position\030\001 \001(\0132\017.Analytics.Ve"
+  "c3B\017\342\372\001\004\n\00232\342\372\001\003\022\0011\022#\n\nvictimTeam\030\002 \001(\005B"
+  "\017\212\372\001\007TEAM_ID\310\372\001\001\022#\n\nattackTeam\030\003 \001(\005B\017\212\372"
+  "\001\007TEAM_ID\310\372\001\001\022,\n\014meansOfDeath\030\004 \001(\tB\026\310\372\001"
+  "\001\372\372\001\016meansOfDeathId\022\034\n\016meansOfDeathId\030\005 "
+  "\001(\rB\004\260\372\001\001:\004\300\270\002\002\"\343\001\n\021GameKilledSomeone\0222\n"
+  "\010position\030\001 \001(\0132\017.Analytics.Vec3B\017\342\372\001\004\n\002"
+  "32\342\372\001\003\022\0011\022#\n\nvictimTeam\030\002 \001(\005B\017\212\372\001\007TEAM_"
   "ID\310\372\001\001\022#\n\nattackTeam\030\003 \001(\005B\017\212\372\001\007TEAM_ID\310"
-  "\372\001\001\022#\n\010weaponId\030\004 \001(\005B\021\212\372\001\tWEAPON_ID\310\372\001\001"
-  "\022\030\n\ndamageType\030\005 \001(\tB\004\310\372\001\001\022\024\n\014damageAmou"
-  "nt\030\006 \001(\002:\004\300\270\002\002\"\245\001\n\020GameRadiusDamage\022G\n\010p"
-  "osition\030\001 \001(\0132\017.Analytics.Vec3B$\342\372\001\016\n\014da"
-  "mageRadius\342\372\001\016\022\014damageAmount\022\022\n\ndamageTy"
-  "pe\030\002 \001(\t\022\024\n\014damageAmount\030\003 \001(\002\022\024\n\014damage"
-  "Radius\030\004 \001(\002:\010\300\270\002\002\330\270\002\001\"a\n\023GameNavigation"
-  "Stuck\022\020\n\010entityId\030\001 \001(\005\0222\n\010position\030\002 \001("
-  "\0132\017.Analytics.Vec3B\017\342\372\001\004\n\00232\342\372\001\003\022\0011:\004\300\270\002"
-  "\002\"\205\001\n\016GameVoiceMacro\022\020\n\010entityId\030\001 \001(\005\022\'"
-  "\n\nvoiceMacro\030\002 \001(\005B\023\212\372\001\013VOICE_MACRO\310\372\001\001\022"
-  "2\n\010position\030\003 \001(\0132\017.Analytics.Vec3B\017\342\372\001\004"
-  "\n\00232\342\372\001\003\022\0011:\004\300\270\002\002\"e\n\016GameLogMessage\022#\n\007l"
-  "ogType\030\001 \001(\0162\022.Analytics.LogType\022\022\n\nlogM"
-  "essage\030\002 \001(\t\022\024\n\014logExtraInfo\030\003 \001(\t:\004\300\270\002\002"
-  "*:\n\014RedisKeyType\022\013\n\007UNKNOWN\020\000\022\007\n\003SET\020\001\022\t"
-  "\n\005RPUSH\020\002\022\t\n\005HMSET\020\003*\?\n\rPrimitiveType\022\r\n"
-  "\tTriangles\020\000\022\t\n\005Lines\020\001\022\n\n\006Points\020\002\022\010\n\004Q"
-  "uad\020\003*;\n\013Compression\022\024\n\020Compression_None"
-  "\020\000\022\026\n\022Compression_FastLZ\020\001**\n\007LogType\022\007\n"
-  "\003Log\020\000\022\013\n\007Warning\020\001\022\t\n\005Error\020\003:O\n\014redisk"
-  "eytype\022\037.google.protobuf.MessageOptions\030"
-  "\210\' \001(\0162\027.Analytics.RedisKeyType:7\n\rredis"
-  "hmsetkey\022\037.google.protobuf.MessageOption"
-  "s\030\211\' \001(\t:8\n\016rediskeysuffix\022\037.google.prot"
-  "obuf.MessageOptions\030\212\' \001(\t:9\n\017useJsonEnc"
-  "oding\022\037.google.protobuf.MessageOptions\030\213"
-  "\' \001(\010:4\n\nobjectname\022\037.google.protobuf.Me"
-  "ssageOptions\030\215\' \001(\t:/\n\007enumkey\022\035.google."
-  "protobuf.FieldOptions\030\241\037 \001(\t:0\n\010editable"
-  "\022\035.google.protobuf.FieldOptions\030\242\037 \001(\010:/"
-  "\n\007expires\022\035.google.protobuf.FieldOptions"
-  "\030\243\037 \001(\005:1\n\tenumflags\022\035.google.protobuf.F"
-  "ieldOptions\030\244\037 \001(\010:/\n\007tooltip\022\035.google.p"
-  "rotobuf.FieldOptions\030\245\037 \001(\010:.\n\006hidden\022\035."
-  "google.protobuf.FieldOptions\030\246\037 \001(\010:8\n\020e"
-  "numflagsindexed\022\035.google.protobuf.FieldO"
-  "ptions\030\247\037 \001(\010:4\n\014editable_key\022\035.google.p"
-  "rotobuf.FieldOptions\030\250\037 \001(\010:3\n\013track_eve"
-  "nt\022\035.google.protobuf.FieldOptions\030\251\037 \001(\010"
-  ":J\n\013point_event\022\035.google.protobuf.FieldO"
-  "ptions\030\254\037 \001(\0132\025.Analytics.PointEvent:H\n\n"
-  "line_event\022\035.google.protobuf.FieldOption"
-  "s\030\255\037 \001(\0132\024.Analytics.LineEventb\006proto3"
+  "\372\001\001\022,\n\014meansOfDeath\030\004 \001(\tB\026\310\372\001\001\372\372\001\016means"
+  "OfDeathId\022\034\n\016meansOfDeathId\030\005 \001(\rB\004\260\372\001\001:"
+  "\004\300\270\002\002\"\243\002\n\021GameRecieveDamage\022=\n\010position\030"
+  "\001 \001(\0132\017.Analytics.Vec3B\032\342\372\001\004\n\00232\342\372\001\016\022\014da"
+  "mageAmount\022#\n\nvictimTeam\030\002 \001(\005B\017\212\372\001\007TEAM"
+  "_ID\310\372\001\001\022#\n\nattackTeam\030\003 \001(\005B\017\212\372\001\007TEAM_ID"
+  "\310\372\001\001\022#\n\010weaponId\030\004 \001(\005B\021\212\372\001\tWEAPON_ID\310\372\001"
+  "\001\022(\n\ndamageType\030\005 \001(\tB\024\310\372\001\001\372\372\001\014damageTyp"
+  "eId\022\024\n\014damageAmount\030\006 \001(\002\022\032\n\014damageTypeI"
+  "d\030\007 \001(\rB\004\260\372\001\001:\004\300\270\002\002\"\243\002\n\021GameInflictDamag"
+  "e\022=\n\010position\030\001 \001(\0132\017.Analytics.Vec3B\032\342\372"
+  "\001\004\n\00232\342\372\001\016\022\014damageAmount\022#\n\nvictimTeam\030\002"
+  " \001(\005B\017\212\372\001\007TEAM_ID\310\372\001\001\022#\n\nattackTeam\030\003 \001("
+  "\005B\017\212\372\001\007TEAM_ID\310\372\001\001\022#\n\010weaponId\030\004 \001(\005B\021\212\372"
+  "\001\tWEAPON_ID\310\372\001\001\022(\n\ndamageType\030\005 \001(\tB\024\310\372\001"
+  "\001\372\372\001\014damageTypeId\022\024\n\014damageAmount\030\006 \001(\002\022"
+  "\032\n\014damageTypeId\030\007 \001(\rB\004\260\372\001\001:\004\300\270\002\002\"\323\001\n\020Ga"
+  "meRadiusDamage\022G\n\010position\030\001 \001(\0132\017.Analy"
+  "tics.Vec3B$\342\372\001\016\n\014damageRadius\342\372\001\016\022\014damag"
+  "eAmount\022$\n\ndamageType\030\002 \001(\tB\020\372\372\001\014damageT"
+  "ypeId\022\024\n\014damageAmount\030\003 \001(\002\022\024\n\014damageRad"
+  "ius\030\004 \001(\002\022\032\n\014damageTypeId\030\005 \001(\rB\004\260\372\001\001:\010\300"
+  "\270\002\002\330\270\002\001\"a\n\023GameNavigationStuck\022\020\n\010entity"
+  "Id\030\001 \001(\005\0222\n\010position\030\002 \001(\0132\017.Analytics.V"
+  "ec3B\017\342\372\001\004\n\00232\342\372\001\003\022\0011:\004\300\270\002\002\"\205\001\n\016GameVoice"
+  "Macro\022\020\n\010entityId\030\001 \001(\005\022\'\n\nvoiceMacro\030\002 "
+  "\001(\005B\023\212\372\001\013VOICE_MACRO\310\372\001\001\0222\n\010position\030\003 \001"
+  "(\0132\017.Analytics.Vec3B\017\342\372\001\004\n\00232\342\372\001\003\022\0011:\004\300\270"
+  "\002\002\"\223\001\n\016GameLogMessage\022#\n\007logType\030\001 \001(\0162\022"
+  ".Analytics.LogType\022$\n\nlogMessage\030\002 \001(\tB\020"
+  "\372\372\001\014logMessageId\022\024\n\014logExtraInfo\030\003 \001(\t\022\032"
+  "\n\014logMessageId\030\004 \001(\rB\004\260\372\001\001:\004\300\270\002\002*:\n\014Redi"
+  "sKeyType\022\013\n\007UNKNOWN\020\000\022\007\n\003SET\020\001\022\t\n\005RPUSH\020"
+  "\002\022\t\n\005HMSET\020\003*\?\n\rPrimitiveType\022\r\n\tTriangl"
+  "es\020\000\022\t\n\005Lines\020\001\022\n\n\006Points\020\002\022\010\n\004Quad\020\003*;\n"
+  "\013Compression\022\024\n\020Compression_None\020\000\022\026\n\022Co"
+  "mpression_FastLZ\020\001**\n\007LogType\022\007\n\003Log\020\000\022\013"
+  "\n\007Warning\020\001\022\t\n\005Error\020\003:O\n\014rediskeytype\022\037"
+  ".google.protobuf.MessageOptions\030\210\' \001(\0162\027"
+  ".Analytics.RedisKeyType:7\n\rredishmsetkey"
+  "\022\037.google.protobuf.MessageOptions\030\211\' \001(\t"
+  ":8\n\016rediskeysuffix\022\037.google.protobuf.Mes"
+  "sageOptions\030\212\' \001(\t:9\n\017useJsonEncoding\022\037."
+  "google.protobuf.MessageOptions\030\213\' \001(\010:4\n"
+  "\nobjectname\022\037.google.protobuf.MessageOpt"
+  "ions\030\215\' \001(\t:/\n\007enumkey\022\035.google.protobuf"
+  ".FieldOptions\030\241\037 \001(\t:0\n\010editable\022\035.googl"
+  "e.protobuf.FieldOptions\030\242\037 \001(\010:/\n\007expire"
+  "s\022\035.google.protobuf.FieldOptions\030\243\037 \001(\005:"
+  "1\n\tenumflags\022\035.google.protobuf.FieldOpti"
+  "ons\030\244\037 \001(\010:/\n\007tooltip\022\035.google.protobuf."
+  "FieldOptions\030\245\037 \001(\010:.\n\006hidden\022\035.google.p"
+  "rotobuf.FieldOptions\030\246\037 \001(\010:8\n\020enumflags"
+  "indexed\022\035.google.protobuf.FieldOptions\030\247"
+  "\037 \001(\010:4\n\014editable_key\022\035.google.protobuf."
+  "FieldOptions\030\250\037 \001(\010:3\n\013track_event\022\035.goo"
+  "gle.protobuf.FieldOptions\030\251\037 \001(\010:J\n\013poin"
+  "t_event\022\035.google.protobuf.FieldOptions\030\254"
+  "\037 \001(\0132\025.Analytics.PointEvent:H\n\nline_eve"
+  "nt\022\035.google.protobuf.FieldOptions\030\255\037 \001(\013"
+  "2\024.Analytics.LineEvent:0\n\010quantize\022\035.goo"
+  "gle.protobuf.FieldOptions\030\256\037 \001(\005:.\n\006inte"
+  "rn\022\035.google.protobuf.FieldOptions\030\257\037 \001(\t"
+  "b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_analytics_2eproto_deps[1] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_analytics_2eproto_deps[1] = {
   &::descriptor_table_google_2fprotobuf_2fdescriptor_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_analytics_2eproto_sccs[37] = {
-  &scc_info_EditorChangeValue_analytics_2eproto.base,
-  &scc_info_EditorChanges_analytics_2eproto.base,
-  &scc_info_Euler_analytics_2eproto.base,
-  &scc_info_GameAssert_analytics_2eproto.base,
-  &scc_info_GameCrash_analytics_2eproto.base,
-  &scc_info_GameDeath_analytics_2eproto.base,
-  &scc_info_GameEntityInfo_analytics_2eproto.base,
-  &scc_info_GameEntityInfo_Ammo_analytics_2eproto.base,
-  &scc_info_GameEntityPosition_analytics_2eproto.base,
-  &scc_info_GameEnum_analytics_2eproto.base,
-  &scc_info_GameEnum_EnumPair_analytics_2eproto.base,
-  &scc_info_GameInflictDamage_analytics_2eproto.base,
-  &scc_info_GameInfo_analytics_2eproto.base,
-  &scc_info_GameKilledSomeone_analytics_2eproto.base,
-  &scc_info_GameLogMessage_analytics_2eproto.base,
-  &scc_info_GameMeshData_analytics_2eproto.base,
-  &scc_info_GameNavAutoDownloaded_analytics_2eproto.base,
-  &scc_info_GameNavNotFound_analytics_2eproto.base,
-  &scc_info_GameNavigationStuck_analytics_2eproto.base,
-  &scc_info_GameNode_analytics_2eproto.base,
-  &scc_info_GameRadiusDamage_analytics_2eproto.base,
-  &scc_info_GameRecieveDamage_analytics_2eproto.base,
-  &scc_info_GameVoiceMacro_analytics_2eproto.base,
-  &scc_info_GameWeaponFired_analytics_2eproto.base,
-  &scc_info_Line_analytics_2eproto.base,
-  &scc_info_LineEvent_analytics_2eproto.base,
-  &scc_info_Material_analytics_2eproto.base,
-  &scc_info_Mesh_analytics_2eproto.base,
-  &scc_info_PointEvent_analytics_2eproto.base,
-  &scc_info_Primitive_analytics_2eproto.base,
-  &scc_info_PrimitiveOptions_analytics_2eproto.base,
-  &scc_info_RangeF_analytics_2eproto.base,
-  &scc_info_RangeI_analytics_2eproto.base,
-  &scc_info_UTCTime_analytics_2eproto.base,
-  &scc_info_Vec3_analytics_2eproto.base,
-  &scc_info_Vec3Color_analytics_2eproto.base,
-  &scc_info_Vec4_analytics_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_analytics_2eproto_once;
-static bool descriptor_table_analytics_2eproto_initialized = false;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_analytics_2eproto = {
-  &descriptor_table_analytics_2eproto_initialized, descriptor_table_protodef_analytics_2eproto, "analytics.proto", 5878,
-  &descriptor_table_analytics_2eproto_once, descriptor_table_analytics_2eproto_sccs, descriptor_table_analytics_2eproto_deps, 37, 1,
-  schemas, file_default_instances, TableStruct_analytics_2eproto::offsets,
-  file_level_metadata_analytics_2eproto, 37, file_level_enum_descriptors_analytics_2eproto, file_level_service_descriptors_analytics_2eproto,
+static ::_pbi::once_flag descriptor_table_analytics_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_analytics_2eproto = {
+    false, false, 7128, descriptor_table_protodef_analytics_2eproto,
+    "analytics.proto",
+    &descriptor_table_analytics_2eproto_once, descriptor_table_analytics_2eproto_deps, 1, 40,
+    schemas, file_default_instances, TableStruct_analytics_2eproto::offsets,
+    file_level_metadata_analytics_2eproto, file_level_enum_descriptors_analytics_2eproto,
+    file_level_service_descriptors_analytics_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_analytics_2eproto_getter() {
+  return &descriptor_table_analytics_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_analytics_2eproto = (  ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_analytics_2eproto), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_analytics_2eproto(&descriptor_table_analytics_2eproto);
 namespace Analytics {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RedisKeyType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_analytics_2eproto);
@@ -1390,121 +1442,150 @@ bool LogType_IsValid(int value) {
 
 // ===================================================================
 
-void PointEvent::InitAsDefaultInstance() {
-}
 class PointEvent::_Internal {
  public:
 };
 
-PointEvent::PointEvent()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.PointEvent)
+PointEvent::PointEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.PointEvent)
 }
 PointEvent::PointEvent(const PointEvent& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  radius_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PointEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.radius_){}
+    , decltype(_impl_.weight_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.radius_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.radius_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_radius().empty()) {
-    radius_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.radius_);
+    _this->_impl_.radius_.Set(from._internal_radius(), 
+      _this->GetArenaForAllocation());
   }
-  weight_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.weight_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.weight_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_weight().empty()) {
-    weight_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.weight_);
+    _this->_impl_.weight_.Set(from._internal_weight(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:Analytics.PointEvent)
 }
 
-void PointEvent::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_PointEvent_analytics_2eproto.base);
-  radius_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  weight_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void PointEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.radius_){}
+    , decltype(_impl_.weight_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.radius_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.radius_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.weight_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.weight_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PointEvent::~PointEvent() {
   // @@protoc_insertion_point(destructor:Analytics.PointEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PointEvent::SharedDtor() {
-  radius_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  weight_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void PointEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.radius_.Destroy();
+  _impl_.weight_.Destroy();
 }
 
 void PointEvent::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const PointEvent& PointEvent::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PointEvent_analytics_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void PointEvent::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.PointEvent)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  radius_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  weight_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.radius_.ClearToEmpty();
+  _impl_.weight_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* PointEvent::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* PointEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string radius = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_radius();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.PointEvent.radius"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.PointEvent.radius"));
+        } else
+          goto handle_unusual;
         continue;
       // string weight = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_weight();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.PointEvent.weight"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.PointEvent.weight"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* PointEvent::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* PointEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.PointEvent)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string radius = 1;
-  if (this->radius().size() > 0) {
+  if (!this->_internal_radius().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_radius().data(), static_cast<int>(this->_internal_radius().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1514,7 +1595,7 @@ failure:
   }
 
   // string weight = 2;
-  if (this->weight().size() > 0) {
+  if (!this->_internal_weight().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_weight().data(), static_cast<int>(this->_internal_weight().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1524,8 +1605,8 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.PointEvent)
   return target;
@@ -1535,70 +1616,49 @@ size_t PointEvent::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.PointEvent)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string radius = 1;
-  if (this->radius().size() > 0) {
+  if (!this->_internal_radius().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_radius());
   }
 
   // string weight = 2;
-  if (this->weight().size() > 0) {
+  if (!this->_internal_weight().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_weight());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PointEvent::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.PointEvent)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PointEvent* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PointEvent>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.PointEvent)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.PointEvent)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PointEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PointEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PointEvent::GetClassData() const { return &_class_data_; }
 
-void PointEvent::MergeFrom(const PointEvent& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.PointEvent)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.radius().size() > 0) {
+void PointEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PointEvent*>(&to_msg);
+  auto& from = static_cast<const PointEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.PointEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    radius_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.radius_);
+  if (!from._internal_radius().empty()) {
+    _this->_internal_set_radius(from._internal_radius());
   }
-  if (from.weight().size() > 0) {
-
-    weight_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.weight_);
+  if (!from._internal_weight().empty()) {
+    _this->_internal_set_weight(from._internal_weight());
   }
-}
-
-void PointEvent::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.PointEvent)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PointEvent::CopyFrom(const PointEvent& from) {
@@ -1614,135 +1674,209 @@ bool PointEvent::IsInitialized() const {
 
 void PointEvent::InternalSwap(PointEvent* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  radius_.Swap(&other->radius_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  weight_.Swap(&other->weight_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.radius_, lhs_arena,
+      &other->_impl_.radius_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.weight_, lhs_arena,
+      &other->_impl_.weight_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata PointEvent::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void LineEvent::InitAsDefaultInstance() {
-}
 class LineEvent::_Internal {
  public:
 };
 
-LineEvent::LineEvent()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.LineEvent)
+LineEvent::LineEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.LineEvent)
 }
 LineEvent::LineEvent(const LineEvent& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  radius_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LineEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.radius_){}
+    , decltype(_impl_.weight_){}
+    , decltype(_impl_.group_){}
+    , decltype(_impl_.maxstep_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.radius_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.radius_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_radius().empty()) {
-    radius_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.radius_);
+    _this->_impl_.radius_.Set(from._internal_radius(), 
+      _this->GetArenaForAllocation());
   }
-  weight_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.weight_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.weight_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_weight().empty()) {
-    weight_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.weight_);
-  }
+    _this->_impl_.weight_.Set(from._internal_weight(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.group_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.group_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_group().empty()) {
+    _this->_impl_.group_.Set(from._internal_group(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.maxstep_ = from._impl_.maxstep_;
   // @@protoc_insertion_point(copy_constructor:Analytics.LineEvent)
 }
 
-void LineEvent::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_LineEvent_analytics_2eproto.base);
-  radius_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  weight_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void LineEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.radius_){}
+    , decltype(_impl_.weight_){}
+    , decltype(_impl_.group_){}
+    , decltype(_impl_.maxstep_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.radius_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.radius_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.weight_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.weight_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.group_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.group_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 LineEvent::~LineEvent() {
   // @@protoc_insertion_point(destructor:Analytics.LineEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void LineEvent::SharedDtor() {
-  radius_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  weight_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void LineEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.radius_.Destroy();
+  _impl_.weight_.Destroy();
+  _impl_.group_.Destroy();
 }
 
 void LineEvent::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const LineEvent& LineEvent::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_LineEvent_analytics_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void LineEvent::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.LineEvent)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  radius_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  weight_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.radius_.ClearToEmpty();
+  _impl_.weight_.ClearToEmpty();
+  _impl_.group_.ClearToEmpty();
+  _impl_.maxstep_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* LineEvent::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* LineEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string radius = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_radius();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.LineEvent.radius"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.LineEvent.radius"));
+        } else
+          goto handle_unusual;
         continue;
       // string weight = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_weight();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.LineEvent.weight"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.LineEvent.weight"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string group = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_group();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.LineEvent.group"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // float maxStep = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.maxstep_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* LineEvent::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* LineEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.LineEvent)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string radius = 1;
-  if (this->radius().size() > 0) {
+  if (!this->_internal_radius().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_radius().data(), static_cast<int>(this->_internal_radius().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1752,7 +1886,7 @@ failure:
   }
 
   // string weight = 2;
-  if (this->weight().size() > 0) {
+  if (!this->_internal_weight().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_weight().data(), static_cast<int>(this->_internal_weight().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1761,9 +1895,29 @@ failure:
         2, this->_internal_weight(), target);
   }
 
+  // string group = 3;
+  if (!this->_internal_group().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_group().data(), static_cast<int>(this->_internal_group().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Analytics.LineEvent.group");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_group(), target);
+  }
+
+  // float maxStep = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_maxstep = this->_internal_maxstep();
+  uint32_t raw_maxstep;
+  memcpy(&raw_maxstep, &tmp_maxstep, sizeof(tmp_maxstep));
+  if (raw_maxstep != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_maxstep(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.LineEvent)
   return target;
@@ -1773,70 +1927,75 @@ size_t LineEvent::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.LineEvent)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string radius = 1;
-  if (this->radius().size() > 0) {
+  if (!this->_internal_radius().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_radius());
   }
 
   // string weight = 2;
-  if (this->weight().size() > 0) {
+  if (!this->_internal_weight().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_weight());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // string group = 3;
+  if (!this->_internal_group().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_group());
+  }
+
+  // float maxStep = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_maxstep = this->_internal_maxstep();
+  uint32_t raw_maxstep;
+  memcpy(&raw_maxstep, &tmp_maxstep, sizeof(tmp_maxstep));
+  if (raw_maxstep != 0) {
+    total_size += 1 + 4;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LineEvent::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.LineEvent)
-  GOOGLE_DCHECK_NE(&from, this);
-  const LineEvent* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<LineEvent>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.LineEvent)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.LineEvent)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LineEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LineEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LineEvent::GetClassData() const { return &_class_data_; }
+
 
-void LineEvent::MergeFrom(const LineEvent& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.LineEvent)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void LineEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LineEvent*>(&to_msg);
+  auto& from = static_cast<const LineEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.LineEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.radius().size() > 0) {
-
-    radius_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.radius_);
+  if (!from._internal_radius().empty()) {
+    _this->_internal_set_radius(from._internal_radius());
   }
-  if (from.weight().size() > 0) {
-
-    weight_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.weight_);
+  if (!from._internal_weight().empty()) {
+    _this->_internal_set_weight(from._internal_weight());
   }
-}
-
-void LineEvent::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.LineEvent)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_group().empty()) {
+    _this->_internal_set_group(from._internal_group());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_maxstep = from._internal_maxstep();
+  uint32_t raw_maxstep;
+  memcpy(&raw_maxstep, &tmp_maxstep, sizeof(tmp_maxstep));
+  if (raw_maxstep != 0) {
+    _this->_internal_set_maxstep(from._internal_maxstep());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void LineEvent::CopyFrom(const LineEvent& from) {
@@ -1852,151 +2011,202 @@ bool LineEvent::IsInitialized() const {
 
 void LineEvent::InternalSwap(LineEvent* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  radius_.Swap(&other->radius_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  weight_.Swap(&other->weight_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.radius_, lhs_arena,
+      &other->_impl_.radius_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.weight_, lhs_arena,
+      &other->_impl_.weight_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.group_, lhs_arena,
+      &other->_impl_.group_, rhs_arena
+  );
+  swap(_impl_.maxstep_, other->_impl_.maxstep_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata LineEvent::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void EditorChangeValue::InitAsDefaultInstance() {
-}
 class EditorChangeValue::_Internal {
  public:
 };
 
-EditorChangeValue::EditorChangeValue()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.EditorChangeValue)
+EditorChangeValue::EditorChangeValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.EditorChangeValue)
 }
 EditorChangeValue::EditorChangeValue(const EditorChangeValue& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  messagetype_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EditorChangeValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messagetype_){}
+    , decltype(_impl_.fieldname_){}
+    , decltype(_impl_.payload_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.messagetype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.messagetype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_messagetype().empty()) {
-    messagetype_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.messagetype_);
+    _this->_impl_.messagetype_.Set(from._internal_messagetype(), 
+      _this->GetArenaForAllocation());
   }
-  fieldname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.fieldname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.fieldname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_fieldname().empty()) {
-    fieldname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.fieldname_);
+    _this->_impl_.fieldname_.Set(from._internal_fieldname(), 
+      _this->GetArenaForAllocation());
   }
-  payload_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_payload().empty()) {
-    payload_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.payload_);
+    _this->_impl_.payload_.Set(from._internal_payload(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:Analytics.EditorChangeValue)
 }
 
-void EditorChangeValue::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_EditorChangeValue_analytics_2eproto.base);
-  messagetype_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  fieldname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  payload_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void EditorChangeValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messagetype_){}
+    , decltype(_impl_.fieldname_){}
+    , decltype(_impl_.payload_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.messagetype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.messagetype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.fieldname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.fieldname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 EditorChangeValue::~EditorChangeValue() {
   // @@protoc_insertion_point(destructor:Analytics.EditorChangeValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void EditorChangeValue::SharedDtor() {
-  messagetype_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  fieldname_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  payload_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void EditorChangeValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messagetype_.Destroy();
+  _impl_.fieldname_.Destroy();
+  _impl_.payload_.Destroy();
 }
 
 void EditorChangeValue::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const EditorChangeValue& EditorChangeValue::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_EditorChangeValue_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void EditorChangeValue::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.EditorChangeValue)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  messagetype_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  fieldname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  payload_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.messagetype_.ClearToEmpty();
+  _impl_.fieldname_.ClearToEmpty();
+  _impl_.payload_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* EditorChangeValue::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* EditorChangeValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string messageType = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_messagetype();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.EditorChangeValue.messageType"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.EditorChangeValue.messageType"));
+        } else
+          goto handle_unusual;
         continue;
       // string fieldName = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_fieldname();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.EditorChangeValue.fieldName"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.EditorChangeValue.fieldName"));
+        } else
+          goto handle_unusual;
         continue;
       // string payload = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_payload();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.EditorChangeValue.payload"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.EditorChangeValue.payload"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* EditorChangeValue::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* EditorChangeValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.EditorChangeValue)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string messageType = 1;
-  if (this->messagetype().size() > 0) {
+  if (!this->_internal_messagetype().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_messagetype().data(), static_cast<int>(this->_internal_messagetype().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -2006,7 +2216,7 @@ failure:
   }
 
   // string fieldName = 2;
-  if (this->fieldname().size() > 0) {
+  if (!this->_internal_fieldname().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_fieldname().data(), static_cast<int>(this->_internal_fieldname().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -2016,7 +2226,7 @@ failure:
   }
 
   // string payload = 3;
-  if (this->payload().size() > 0) {
+  if (!this->_internal_payload().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_payload().data(), static_cast<int>(this->_internal_payload().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -2026,8 +2236,8 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.EditorChangeValue)
   return target;
@@ -2037,81 +2247,59 @@ size_t EditorChangeValue::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.EditorChangeValue)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string messageType = 1;
-  if (this->messagetype().size() > 0) {
+  if (!this->_internal_messagetype().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_messagetype());
   }
 
   // string fieldName = 2;
-  if (this->fieldname().size() > 0) {
+  if (!this->_internal_fieldname().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_fieldname());
   }
 
   // string payload = 3;
-  if (this->payload().size() > 0) {
+  if (!this->_internal_payload().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_payload());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void EditorChangeValue::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.EditorChangeValue)
-  GOOGLE_DCHECK_NE(&from, this);
-  const EditorChangeValue* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<EditorChangeValue>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.EditorChangeValue)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.EditorChangeValue)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EditorChangeValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EditorChangeValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EditorChangeValue::GetClassData() const { return &_class_data_; }
 
-void EditorChangeValue::MergeFrom(const EditorChangeValue& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.EditorChangeValue)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.messagetype().size() > 0) {
+void EditorChangeValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EditorChangeValue*>(&to_msg);
+  auto& from = static_cast<const EditorChangeValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.EditorChangeValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    messagetype_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.messagetype_);
+  if (!from._internal_messagetype().empty()) {
+    _this->_internal_set_messagetype(from._internal_messagetype());
   }
-  if (from.fieldname().size() > 0) {
-
-    fieldname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.fieldname_);
+  if (!from._internal_fieldname().empty()) {
+    _this->_internal_set_fieldname(from._internal_fieldname());
   }
-  if (from.payload().size() > 0) {
-
-    payload_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.payload_);
+  if (!from._internal_payload().empty()) {
+    _this->_internal_set_payload(from._internal_payload());
   }
-}
-
-void EditorChangeValue::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.EditorChangeValue)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void EditorChangeValue::CopyFrom(const EditorChangeValue& from) {
@@ -2127,82 +2315,99 @@ bool EditorChangeValue::IsInitialized() const {
 
 void EditorChangeValue::InternalSwap(EditorChangeValue* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  messagetype_.Swap(&other->messagetype_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  fieldname_.Swap(&other->fieldname_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  payload_.Swap(&other->payload_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.messagetype_, lhs_arena,
+      &other->_impl_.messagetype_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.fieldname_, lhs_arena,
+      &other->_impl_.fieldname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.payload_, lhs_arena,
+      &other->_impl_.payload_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata EditorChangeValue::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void EditorChanges::InitAsDefaultInstance() {
-}
 class EditorChanges::_Internal {
  public:
 };
 
-EditorChanges::EditorChanges()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.EditorChanges)
+EditorChanges::EditorChanges(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.EditorChanges)
 }
 EditorChanges::EditorChanges(const EditorChanges& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      changes_(from.changes_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EditorChanges* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.changes_){from._impl_.changes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:Analytics.EditorChanges)
 }
 
-void EditorChanges::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_EditorChanges_analytics_2eproto.base);
+inline void EditorChanges::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.changes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 EditorChanges::~EditorChanges() {
   // @@protoc_insertion_point(destructor:Analytics.EditorChanges)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void EditorChanges::SharedDtor() {
+inline void EditorChanges::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.changes_.~RepeatedPtrField();
 }
 
 void EditorChanges::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const EditorChanges& EditorChanges::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_EditorChanges_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void EditorChanges::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.EditorChanges)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  changes_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.changes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* EditorChanges::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* EditorChanges::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .Analytics.EditorChangeValue changes = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -2210,45 +2415,49 @@ const char* EditorChanges::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* EditorChanges::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* EditorChanges::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.EditorChanges)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .Analytics.EditorChangeValue changes = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_changes_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_changes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_changes(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_changes(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.EditorChanges)
   return target;
@@ -2258,4023 +2467,5104 @@ size_t EditorChanges::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.EditorChanges)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .Analytics.EditorChangeValue changes = 1;
   total_size += 1UL * this->_internal_changes_size();
-  for (const auto& msg : this->changes_) {
+  for (const auto& msg : this->_impl_.changes_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EditorChanges::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EditorChanges::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EditorChanges::GetClassData() const { return &_class_data_; }
+
+
+void EditorChanges::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EditorChanges*>(&to_msg);
+  auto& from = static_cast<const EditorChanges&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.EditorChanges)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.changes_.MergeFrom(from._impl_.changes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EditorChanges::CopyFrom(const EditorChanges& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.EditorChanges)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EditorChanges::IsInitialized() const {
+  return true;
+}
+
+void EditorChanges::InternalSwap(EditorChanges* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.changes_.InternalSwap(&other->_impl_.changes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EditorChanges::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[3]);
+}
+
+// ===================================================================
+
+class RangeF::_Internal {
+ public:
+};
+
+RangeF::RangeF(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.RangeF)
+}
+RangeF::RangeF(const RangeF& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RangeF* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.min_){}
+    , decltype(_impl_.max_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_, &from._impl_.min_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_) -
+    reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.max_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.RangeF)
+}
+
+inline void RangeF::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.min_){0}
+    , decltype(_impl_.max_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RangeF::~RangeF() {
+  // @@protoc_insertion_point(destructor:Analytics.RangeF)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RangeF::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RangeF::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RangeF::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.RangeF)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.min_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_) -
+      reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.max_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RangeF::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float min = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float max = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RangeF::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.RangeF)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float min = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_min = this->_internal_min();
+  uint32_t raw_min;
+  memcpy(&raw_min, &tmp_min, sizeof(tmp_min));
+  if (raw_min != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_min(), target);
+  }
+
+  // float max = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max = this->_internal_max();
+  uint32_t raw_max;
+  memcpy(&raw_max, &tmp_max, sizeof(tmp_max));
+  if (raw_max != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_max(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.RangeF)
+  return target;
+}
+
+size_t RangeF::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.RangeF)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // float min = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_min = this->_internal_min();
+  uint32_t raw_min;
+  memcpy(&raw_min, &tmp_min, sizeof(tmp_min));
+  if (raw_min != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float max = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max = this->_internal_max();
+  uint32_t raw_max;
+  memcpy(&raw_max, &tmp_max, sizeof(tmp_max));
+  if (raw_max != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RangeF::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RangeF::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RangeF::GetClassData() const { return &_class_data_; }
+
+
+void RangeF::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RangeF*>(&to_msg);
+  auto& from = static_cast<const RangeF&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.RangeF)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_min = from._internal_min();
+  uint32_t raw_min;
+  memcpy(&raw_min, &tmp_min, sizeof(tmp_min));
+  if (raw_min != 0) {
+    _this->_internal_set_min(from._internal_min());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max = from._internal_max();
+  uint32_t raw_max;
+  memcpy(&raw_max, &tmp_max, sizeof(tmp_max));
+  if (raw_max != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RangeF::CopyFrom(const RangeF& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.RangeF)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RangeF::IsInitialized() const {
+  return true;
+}
+
+void RangeF::InternalSwap(RangeF* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RangeF, _impl_.max_)
+      + sizeof(RangeF::_impl_.max_)
+      - PROTOBUF_FIELD_OFFSET(RangeF, _impl_.min_)>(
+          reinterpret_cast<char*>(&_impl_.min_),
+          reinterpret_cast<char*>(&other->_impl_.min_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RangeF::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[4]);
+}
+
+// ===================================================================
+
+class RangeI::_Internal {
+ public:
+};
+
+RangeI::RangeI(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.RangeI)
+}
+RangeI::RangeI(const RangeI& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RangeI* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.min_){}
+    , decltype(_impl_.max_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_, &from._impl_.min_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_) -
+    reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.max_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.RangeI)
+}
+
+inline void RangeI::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.min_){0}
+    , decltype(_impl_.max_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RangeI::~RangeI() {
+  // @@protoc_insertion_point(destructor:Analytics.RangeI)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RangeI::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RangeI::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RangeI::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.RangeI)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.min_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_) -
+      reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.max_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RangeI::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 min = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RangeI::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.RangeI)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 min = 1;
+  if (this->_internal_min() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_min(), target);
+  }
+
+  // int32 max = 2;
+  if (this->_internal_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_max(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.RangeI)
+  return target;
+}
+
+size_t RangeI::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.RangeI)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 min = 1;
+  if (this->_internal_min() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_min());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void EditorChanges::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.EditorChanges)
-  GOOGLE_DCHECK_NE(&from, this);
-  const EditorChanges* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<EditorChanges>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.EditorChanges)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.EditorChanges)
-    MergeFrom(*source);
+  // int32 max = 2;
+  if (this->_internal_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void EditorChanges::MergeFrom(const EditorChanges& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.EditorChanges)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RangeI::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RangeI::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RangeI::GetClassData() const { return &_class_data_; }
 
-  changes_.MergeFrom(from.changes_);
-}
 
-void EditorChanges::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.EditorChanges)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void RangeI::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RangeI*>(&to_msg);
+  auto& from = static_cast<const RangeI&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.RangeI)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_min() != 0) {
+    _this->_internal_set_min(from._internal_min());
+  }
+  if (from._internal_max() != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void EditorChanges::CopyFrom(const EditorChanges& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.EditorChanges)
+void RangeI::CopyFrom(const RangeI& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.RangeI)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool EditorChanges::IsInitialized() const {
+bool RangeI::IsInitialized() const {
   return true;
 }
 
-void EditorChanges::InternalSwap(EditorChanges* other) {
+void RangeI::InternalSwap(RangeI* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  changes_.InternalSwap(&other->changes_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RangeI, _impl_.max_)
+      + sizeof(RangeI::_impl_.max_)
+      - PROTOBUF_FIELD_OFFSET(RangeI, _impl_.min_)>(
+          reinterpret_cast<char*>(&_impl_.min_),
+          reinterpret_cast<char*>(&other->_impl_.min_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata EditorChanges::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata RangeI::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[5]);
 }
 
-
 // ===================================================================
 
-void RangeF::InitAsDefaultInstance() {
-}
-class RangeF::_Internal {
+class Vec3::_Internal {
  public:
 };
 
-RangeF::RangeF()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.RangeF)
+Vec3::Vec3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.Vec3)
 }
-RangeF::RangeF(const RangeF& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&min_, &from.min_,
-    static_cast<size_t>(reinterpret_cast<char*>(&max_) -
-    reinterpret_cast<char*>(&min_)) + sizeof(max_));
-  // @@protoc_insertion_point(copy_constructor:Analytics.RangeF)
+Vec3::Vec3(const Vec3& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Vec3* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.quantized_){}
+    , decltype(_impl_.z_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.z_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.Vec3)
 }
 
-void RangeF::SharedCtor() {
-  ::memset(&min_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&max_) -
-      reinterpret_cast<char*>(&min_)) + sizeof(max_));
+inline void Vec3::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.quantized_){uint64_t{0u}}
+    , decltype(_impl_.z_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-RangeF::~RangeF() {
-  // @@protoc_insertion_point(destructor:Analytics.RangeF)
+Vec3::~Vec3() {
+  // @@protoc_insertion_point(destructor:Analytics.Vec3)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RangeF::SharedDtor() {
+inline void Vec3::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RangeF::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RangeF& RangeF::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RangeF_analytics_2eproto.base);
-  return *internal_default_instance();
+void Vec3::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void RangeF::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.RangeF)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Vec3::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.Vec3)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&min_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&max_) -
-      reinterpret_cast<char*>(&min_)) + sizeof(max_));
-  _internal_metadata_.Clear();
+  ::memset(&_impl_.x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.z_) -
+      reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RangeF::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Vec3::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // float min = 1;
+      // float x = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 13)) {
-          min_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // float max = 2;
+      // float y = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
-          max_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      // float z = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 quantized = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.quantized_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RangeF::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.RangeF)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Vec3::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Vec3)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float min = 1;
-  if (!(this->min() <= 0 && this->min() >= 0)) {
+  // float x = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(1, this->_internal_min(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
   }
 
-  // float max = 2;
-  if (!(this->max() <= 0 && this->max() >= 0)) {
+  // float y = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
+  }
+
+  // float z = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
+  }
+
+  // uint64 quantized = 4;
+  if (this->_internal_quantized() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(2, this->_internal_max(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_quantized(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.RangeF)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Vec3)
   return target;
 }
 
-size_t RangeF::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.RangeF)
+size_t Vec3::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.Vec3)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // float min = 1;
-  if (!(this->min() <= 0 && this->min() >= 0)) {
+  // float x = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
     total_size += 1 + 4;
   }
 
-  // float max = 2;
-  if (!(this->max() <= 0 && this->max() >= 0)) {
+  // float y = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
     total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint64 quantized = 4;
+  if (this->_internal_quantized() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_quantized());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void RangeF::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.RangeF)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RangeF* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RangeF>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.RangeF)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.RangeF)
-    MergeFrom(*source);
+  // float z = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    total_size += 1 + 4;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RangeF::MergeFrom(const RangeF& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.RangeF)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Vec3::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Vec3::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Vec3::GetClassData() const { return &_class_data_; }
+
+
+void Vec3::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Vec3*>(&to_msg);
+  auto& from = static_cast<const Vec3&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Vec3)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!(from.min() <= 0 && from.min() >= 0)) {
-    _internal_set_min(from._internal_min());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = from._internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    _this->_internal_set_x(from._internal_x());
   }
-  if (!(from.max() <= 0 && from.max() >= 0)) {
-    _internal_set_max(from._internal_max());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = from._internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    _this->_internal_set_y(from._internal_y());
   }
+  if (from._internal_quantized() != 0) {
+    _this->_internal_set_quantized(from._internal_quantized());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = from._internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    _this->_internal_set_z(from._internal_z());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RangeF::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.RangeF)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void RangeF::CopyFrom(const RangeF& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.RangeF)
+void Vec3::CopyFrom(const Vec3& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Vec3)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RangeF::IsInitialized() const {
+bool Vec3::IsInitialized() const {
   return true;
 }
 
-void RangeF::InternalSwap(RangeF* other) {
+void Vec3::InternalSwap(Vec3* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(min_, other->min_);
-  swap(max_, other->max_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Vec3, _impl_.z_)
+      + sizeof(Vec3::_impl_.z_)
+      - PROTOBUF_FIELD_OFFSET(Vec3, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RangeF::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Vec3::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[6]);
 }
 
-
 // ===================================================================
 
-void RangeI::InitAsDefaultInstance() {
-}
-class RangeI::_Internal {
+class Vec3Color::_Internal {
  public:
 };
 
-RangeI::RangeI()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.RangeI)
+Vec3Color::Vec3Color(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.Vec3Color)
 }
-RangeI::RangeI(const RangeI& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&min_, &from.min_,
-    static_cast<size_t>(reinterpret_cast<char*>(&max_) -
-    reinterpret_cast<char*>(&min_)) + sizeof(max_));
-  // @@protoc_insertion_point(copy_constructor:Analytics.RangeI)
+Vec3Color::Vec3Color(const Vec3Color& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Vec3Color* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.z_){}
+    , decltype(_impl_.color_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.color_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.color_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.Vec3Color)
 }
 
-void RangeI::SharedCtor() {
-  ::memset(&min_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&max_) -
-      reinterpret_cast<char*>(&min_)) + sizeof(max_));
+inline void Vec3Color::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.z_){0}
+    , decltype(_impl_.color_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-RangeI::~RangeI() {
-  // @@protoc_insertion_point(destructor:Analytics.RangeI)
+Vec3Color::~Vec3Color() {
+  // @@protoc_insertion_point(destructor:Analytics.Vec3Color)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RangeI::SharedDtor() {
+inline void Vec3Color::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RangeI::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RangeI& RangeI::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RangeI_analytics_2eproto.base);
-  return *internal_default_instance();
+void Vec3Color::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void RangeI::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.RangeI)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Vec3Color::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.Vec3Color)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&min_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&max_) -
-      reinterpret_cast<char*>(&min_)) + sizeof(max_));
-  _internal_metadata_.Clear();
+  ::memset(&_impl_.x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.color_) -
+      reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.color_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RangeI::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Vec3Color::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 min = 1;
+      // float x = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
         continue;
-      // int32 max = 2;
+      // float y = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float z = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 color = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.color_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RangeI::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.RangeI)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Vec3Color::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Vec3Color)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 min = 1;
-  if (this->min() != 0) {
+  // float x = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_min(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
   }
 
-  // int32 max = 2;
-  if (this->max() != 0) {
+  // float y = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
+  }
+
+  // float z = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
+  }
+
+  // uint32 color = 4;
+  if (this->_internal_color() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_max(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_color(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.RangeI)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Vec3Color)
   return target;
 }
 
-size_t RangeI::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.RangeI)
+size_t Vec3Color::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.Vec3Color)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 min = 1;
-  if (this->min() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_min());
+  // float x = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    total_size += 1 + 4;
   }
 
-  // int32 max = 2;
-  if (this->max() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_max());
+  // float y = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // float z = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    total_size += 1 + 4;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void RangeI::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.RangeI)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RangeI* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RangeI>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.RangeI)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.RangeI)
-    MergeFrom(*source);
+  // uint32 color = 4;
+  if (this->_internal_color() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_color());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RangeI::MergeFrom(const RangeI& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.RangeI)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Vec3Color::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Vec3Color::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Vec3Color::GetClassData() const { return &_class_data_; }
+
+
+void Vec3Color::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Vec3Color*>(&to_msg);
+  auto& from = static_cast<const Vec3Color&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Vec3Color)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.min() != 0) {
-    _internal_set_min(from._internal_min());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = from._internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    _this->_internal_set_x(from._internal_x());
   }
-  if (from.max() != 0) {
-    _internal_set_max(from._internal_max());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = from._internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    _this->_internal_set_y(from._internal_y());
   }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = from._internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    _this->_internal_set_z(from._internal_z());
+  }
+  if (from._internal_color() != 0) {
+    _this->_internal_set_color(from._internal_color());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RangeI::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.RangeI)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void RangeI::CopyFrom(const RangeI& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.RangeI)
+void Vec3Color::CopyFrom(const Vec3Color& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Vec3Color)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RangeI::IsInitialized() const {
+bool Vec3Color::IsInitialized() const {
   return true;
 }
 
-void RangeI::InternalSwap(RangeI* other) {
+void Vec3Color::InternalSwap(Vec3Color* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(min_, other->min_);
-  swap(max_, other->max_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Vec3Color, _impl_.color_)
+      + sizeof(Vec3Color::_impl_.color_)
+      - PROTOBUF_FIELD_OFFSET(Vec3Color, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RangeI::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Vec3Color::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[7]);
 }
 
-
 // ===================================================================
 
-void Vec3::InitAsDefaultInstance() {
-}
-class Vec3::_Internal {
+class Vec4::_Internal {
  public:
 };
 
-Vec3::Vec3()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.Vec3)
+Vec4::Vec4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.Vec4)
 }
-Vec3::Vec3(const Vec3& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&x_, &from.x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&z_) -
-    reinterpret_cast<char*>(&x_)) + sizeof(z_));
-  // @@protoc_insertion_point(copy_constructor:Analytics.Vec3)
+Vec4::Vec4(const Vec4& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Vec4* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.z_){}
+    , decltype(_impl_.w_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.w_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.w_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.Vec4)
 }
 
-void Vec3::SharedCtor() {
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&z_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(z_));
+inline void Vec4::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.z_){0}
+    , decltype(_impl_.w_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-Vec3::~Vec3() {
-  // @@protoc_insertion_point(destructor:Analytics.Vec3)
+Vec4::~Vec4() {
+  // @@protoc_insertion_point(destructor:Analytics.Vec4)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Vec3::SharedDtor() {
+inline void Vec4::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Vec3::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Vec3& Vec3::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Vec3_analytics_2eproto.base);
-  return *internal_default_instance();
+void Vec4::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Vec3::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.Vec3)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Vec4::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.Vec4)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&z_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(z_));
-  _internal_metadata_.Clear();
+  ::memset(&_impl_.x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.w_) -
+      reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.w_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Vec3::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Vec4::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // float x = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 13)) {
-          x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // float y = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
-          y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // float z = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
-          z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float w = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.w_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Vec3::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Vec3)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Vec4::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Vec4)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // float x = 1;
-  if (!(this->x() <= 0 && this->x() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
   }
 
   // float y = 2;
-  if (!(this->y() <= 0 && this->y() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
   }
 
   // float z = 3;
-  if (!(this->z() <= 0 && this->z() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
+  }
+
+  // float w = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_w = this->_internal_w();
+  uint32_t raw_w;
+  memcpy(&raw_w, &tmp_w, sizeof(tmp_w));
+  if (raw_w != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_w(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Vec3)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Vec4)
   return target;
 }
 
-size_t Vec3::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.Vec3)
+size_t Vec4::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.Vec4)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // float x = 1;
-  if (!(this->x() <= 0 && this->x() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
     total_size += 1 + 4;
   }
 
   // float y = 2;
-  if (!(this->y() <= 0 && this->y() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
     total_size += 1 + 4;
   }
 
   // float z = 3;
-  if (!(this->z() <= 0 && this->z() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
     total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // float w = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_w = this->_internal_w();
+  uint32_t raw_w;
+  memcpy(&raw_w, &tmp_w, sizeof(tmp_w));
+  if (raw_w != 0) {
+    total_size += 1 + 4;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void Vec3::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.Vec3)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Vec3* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Vec3>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.Vec3)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.Vec3)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Vec3::MergeFrom(const Vec3& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Vec3)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Vec4::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Vec4::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Vec4::GetClassData() const { return &_class_data_; }
+
+
+void Vec4::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Vec4*>(&to_msg);
+  auto& from = static_cast<const Vec4&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Vec4)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!(from.x() <= 0 && from.x() >= 0)) {
-    _internal_set_x(from._internal_x());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = from._internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    _this->_internal_set_x(from._internal_x());
   }
-  if (!(from.y() <= 0 && from.y() >= 0)) {
-    _internal_set_y(from._internal_y());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = from._internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    _this->_internal_set_y(from._internal_y());
   }
-  if (!(from.z() <= 0 && from.z() >= 0)) {
-    _internal_set_z(from._internal_z());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = from._internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    _this->_internal_set_z(from._internal_z());
   }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_w = from._internal_w();
+  uint32_t raw_w;
+  memcpy(&raw_w, &tmp_w, sizeof(tmp_w));
+  if (raw_w != 0) {
+    _this->_internal_set_w(from._internal_w());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Vec3::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.Vec3)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Vec3::CopyFrom(const Vec3& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Vec3)
+void Vec4::CopyFrom(const Vec4& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Vec4)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Vec3::IsInitialized() const {
+bool Vec4::IsInitialized() const {
   return true;
 }
 
-void Vec3::InternalSwap(Vec3* other) {
+void Vec4::InternalSwap(Vec4* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(x_, other->x_);
-  swap(y_, other->y_);
-  swap(z_, other->z_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Vec4, _impl_.w_)
+      + sizeof(Vec4::_impl_.w_)
+      - PROTOBUF_FIELD_OFFSET(Vec4, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Vec3::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Vec4::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[8]);
 }
 
-
 // ===================================================================
 
-void Vec3Color::InitAsDefaultInstance() {
-}
-class Vec3Color::_Internal {
+class Line::_Internal {
  public:
+  static const ::Analytics::Vec3& p0(const Line* msg);
+  static const ::Analytics::Vec3& p1(const Line* msg);
 };
 
-Vec3Color::Vec3Color()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.Vec3Color)
+const ::Analytics::Vec3&
+Line::_Internal::p0(const Line* msg) {
+  return *msg->_impl_.p0_;
 }
-Vec3Color::Vec3Color(const Vec3Color& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&x_, &from.x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&color_) -
-    reinterpret_cast<char*>(&x_)) + sizeof(color_));
-  // @@protoc_insertion_point(copy_constructor:Analytics.Vec3Color)
+const ::Analytics::Vec3&
+Line::_Internal::p1(const Line* msg) {
+  return *msg->_impl_.p1_;
+}
+Line::Line(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.Line)
+}
+Line::Line(const Line& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Line* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.p0_){nullptr}
+    , decltype(_impl_.p1_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_p0()) {
+    _this->_impl_.p0_ = new ::Analytics::Vec3(*from._impl_.p0_);
+  }
+  if (from._internal_has_p1()) {
+    _this->_impl_.p1_ = new ::Analytics::Vec3(*from._impl_.p1_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Analytics.Line)
 }
 
-void Vec3Color::SharedCtor() {
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&color_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(color_));
+inline void Line::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.p0_){nullptr}
+    , decltype(_impl_.p1_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-Vec3Color::~Vec3Color() {
-  // @@protoc_insertion_point(destructor:Analytics.Vec3Color)
+Line::~Line() {
+  // @@protoc_insertion_point(destructor:Analytics.Line)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Vec3Color::SharedDtor() {
+inline void Line::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.p0_;
+  if (this != internal_default_instance()) delete _impl_.p1_;
 }
 
-void Vec3Color::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Vec3Color& Vec3Color::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Vec3Color_analytics_2eproto.base);
-  return *internal_default_instance();
+void Line::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Vec3Color::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.Vec3Color)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Line::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.Line)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&color_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(color_));
-  _internal_metadata_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.p0_ != nullptr) {
+    delete _impl_.p0_;
+  }
+  _impl_.p0_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.p1_ != nullptr) {
+    delete _impl_.p1_;
+  }
+  _impl_.p1_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Vec3Color::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Line::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // float x = 1;
+      // .Analytics.Vec3 p0 = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 13)) {
-          x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_p0(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      // float y = 2;
+      // .Analytics.Vec3 p1 = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
-          y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
-        } else goto handle_unusual;
-        continue;
-      // float z = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
-          z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
-        } else goto handle_unusual;
-        continue;
-      // uint32 color = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          color_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_p1(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Vec3Color::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Vec3Color)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Line::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Line)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float x = 1;
-  if (!(this->x() <= 0 && this->x() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
-  }
-
-  // float y = 2;
-  if (!(this->y() <= 0 && this->y() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
-  }
-
-  // float z = 3;
-  if (!(this->z() <= 0 && this->z() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
+  // .Analytics.Vec3 p0 = 1;
+  if (this->_internal_has_p0()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::p0(this),
+        _Internal::p0(this).GetCachedSize(), target, stream);
   }
 
-  // uint32 color = 4;
-  if (this->color() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_color(), target);
+  // .Analytics.Vec3 p1 = 2;
+  if (this->_internal_has_p1()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::p1(this),
+        _Internal::p1(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Vec3Color)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Line)
   return target;
 }
 
-size_t Vec3Color::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.Vec3Color)
+size_t Line::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.Line)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // float x = 1;
-  if (!(this->x() <= 0 && this->x() >= 0)) {
-    total_size += 1 + 4;
-  }
-
-  // float y = 2;
-  if (!(this->y() <= 0 && this->y() >= 0)) {
-    total_size += 1 + 4;
-  }
-
-  // float z = 3;
-  if (!(this->z() <= 0 && this->z() >= 0)) {
-    total_size += 1 + 4;
+  // .Analytics.Vec3 p0 = 1;
+  if (this->_internal_has_p0()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.p0_);
   }
 
-  // uint32 color = 4;
-  if (this->color() != 0) {
+  // .Analytics.Vec3 p1 = 2;
+  if (this->_internal_has_p1()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_color());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.p1_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Vec3Color::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.Vec3Color)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Vec3Color* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Vec3Color>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.Vec3Color)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.Vec3Color)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Line::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Line::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Line::GetClassData() const { return &_class_data_; }
+
 
-void Vec3Color::MergeFrom(const Vec3Color& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Vec3Color)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Line::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Line*>(&to_msg);
+  auto& from = static_cast<const Line&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Line)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!(from.x() <= 0 && from.x() >= 0)) {
-    _internal_set_x(from._internal_x());
-  }
-  if (!(from.y() <= 0 && from.y() >= 0)) {
-    _internal_set_y(from._internal_y());
-  }
-  if (!(from.z() <= 0 && from.z() >= 0)) {
-    _internal_set_z(from._internal_z());
+  if (from._internal_has_p0()) {
+    _this->_internal_mutable_p0()->::Analytics::Vec3::MergeFrom(
+        from._internal_p0());
   }
-  if (from.color() != 0) {
-    _internal_set_color(from._internal_color());
+  if (from._internal_has_p1()) {
+    _this->_internal_mutable_p1()->::Analytics::Vec3::MergeFrom(
+        from._internal_p1());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Vec3Color::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.Vec3Color)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Vec3Color::CopyFrom(const Vec3Color& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Vec3Color)
+void Line::CopyFrom(const Line& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Line)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Vec3Color::IsInitialized() const {
+bool Line::IsInitialized() const {
   return true;
 }
 
-void Vec3Color::InternalSwap(Vec3Color* other) {
+void Line::InternalSwap(Line* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(x_, other->x_);
-  swap(y_, other->y_);
-  swap(z_, other->z_);
-  swap(color_, other->color_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Line, _impl_.p1_)
+      + sizeof(Line::_impl_.p1_)
+      - PROTOBUF_FIELD_OFFSET(Line, _impl_.p0_)>(
+          reinterpret_cast<char*>(&_impl_.p0_),
+          reinterpret_cast<char*>(&other->_impl_.p0_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Vec3Color::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Line::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void Vec4::InitAsDefaultInstance() {
-}
-class Vec4::_Internal {
+class Euler::_Internal {
  public:
 };
 
-Vec4::Vec4()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.Vec4)
+Euler::Euler(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.Euler)
 }
-Vec4::Vec4(const Vec4& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&x_, &from.x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&w_) -
-    reinterpret_cast<char*>(&x_)) + sizeof(w_));
-  // @@protoc_insertion_point(copy_constructor:Analytics.Vec4)
+Euler::Euler(const Euler& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Euler* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.heading_){}
+    , decltype(_impl_.pitch_){}
+    , decltype(_impl_.roll_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.heading_, &from._impl_.heading_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.roll_) -
+    reinterpret_cast<char*>(&_impl_.heading_)) + sizeof(_impl_.roll_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.Euler)
 }
 
-void Vec4::SharedCtor() {
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&w_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(w_));
+inline void Euler::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.heading_){0}
+    , decltype(_impl_.pitch_){0}
+    , decltype(_impl_.roll_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-Vec4::~Vec4() {
-  // @@protoc_insertion_point(destructor:Analytics.Vec4)
+Euler::~Euler() {
+  // @@protoc_insertion_point(destructor:Analytics.Euler)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Vec4::SharedDtor() {
+inline void Euler::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Vec4::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Vec4& Vec4::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Vec4_analytics_2eproto.base);
-  return *internal_default_instance();
+void Euler::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Vec4::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.Vec4)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Euler::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.Euler)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&w_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(w_));
-  _internal_metadata_.Clear();
+  ::memset(&_impl_.heading_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.roll_) -
+      reinterpret_cast<char*>(&_impl_.heading_)) + sizeof(_impl_.roll_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Vec4::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Euler::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // float x = 1;
+      // float heading = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 13)) {
-          x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.heading_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // float y = 2;
+      // float pitch = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
-          y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.pitch_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // float z = 3;
+      // float roll = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
-          z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.roll_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // float w = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 37)) {
-          w_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Vec4::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Vec4)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Euler::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Euler)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float x = 1;
-  if (!(this->x() <= 0 && this->x() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
-  }
-
-  // float y = 2;
-  if (!(this->y() <= 0 && this->y() >= 0)) {
+  // float heading = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_heading = this->_internal_heading();
+  uint32_t raw_heading;
+  memcpy(&raw_heading, &tmp_heading, sizeof(tmp_heading));
+  if (raw_heading != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_heading(), target);
   }
 
-  // float z = 3;
-  if (!(this->z() <= 0 && this->z() >= 0)) {
+  // float pitch = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch = this->_internal_pitch();
+  uint32_t raw_pitch;
+  memcpy(&raw_pitch, &tmp_pitch, sizeof(tmp_pitch));
+  if (raw_pitch != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_pitch(), target);
   }
 
-  // float w = 4;
-  if (!(this->w() <= 0 && this->w() >= 0)) {
+  // float roll = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_roll = this->_internal_roll();
+  uint32_t raw_roll;
+  memcpy(&raw_roll, &tmp_roll, sizeof(tmp_roll));
+  if (raw_roll != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(4, this->_internal_w(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_roll(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Vec4)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Euler)
   return target;
 }
 
-size_t Vec4::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.Vec4)
+size_t Euler::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.Euler)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // float x = 1;
-  if (!(this->x() <= 0 && this->x() >= 0)) {
-    total_size += 1 + 4;
-  }
-
-  // float y = 2;
-  if (!(this->y() <= 0 && this->y() >= 0)) {
+  // float heading = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_heading = this->_internal_heading();
+  uint32_t raw_heading;
+  memcpy(&raw_heading, &tmp_heading, sizeof(tmp_heading));
+  if (raw_heading != 0) {
     total_size += 1 + 4;
   }
 
-  // float z = 3;
-  if (!(this->z() <= 0 && this->z() >= 0)) {
+  // float pitch = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch = this->_internal_pitch();
+  uint32_t raw_pitch;
+  memcpy(&raw_pitch, &tmp_pitch, sizeof(tmp_pitch));
+  if (raw_pitch != 0) {
     total_size += 1 + 4;
   }
 
-  // float w = 4;
-  if (!(this->w() <= 0 && this->w() >= 0)) {
+  // float roll = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_roll = this->_internal_roll();
+  uint32_t raw_roll;
+  memcpy(&raw_roll, &tmp_roll, sizeof(tmp_roll));
+  if (raw_roll != 0) {
     total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Vec4::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.Vec4)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Vec4* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Vec4>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.Vec4)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.Vec4)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Euler::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Euler::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Euler::GetClassData() const { return &_class_data_; }
 
-void Vec4::MergeFrom(const Vec4& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Vec4)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Euler::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Euler*>(&to_msg);
+  auto& from = static_cast<const Euler&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Euler)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!(from.x() <= 0 && from.x() >= 0)) {
-    _internal_set_x(from._internal_x());
-  }
-  if (!(from.y() <= 0 && from.y() >= 0)) {
-    _internal_set_y(from._internal_y());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_heading = from._internal_heading();
+  uint32_t raw_heading;
+  memcpy(&raw_heading, &tmp_heading, sizeof(tmp_heading));
+  if (raw_heading != 0) {
+    _this->_internal_set_heading(from._internal_heading());
   }
-  if (!(from.z() <= 0 && from.z() >= 0)) {
-    _internal_set_z(from._internal_z());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch = from._internal_pitch();
+  uint32_t raw_pitch;
+  memcpy(&raw_pitch, &tmp_pitch, sizeof(tmp_pitch));
+  if (raw_pitch != 0) {
+    _this->_internal_set_pitch(from._internal_pitch());
   }
-  if (!(from.w() <= 0 && from.w() >= 0)) {
-    _internal_set_w(from._internal_w());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_roll = from._internal_roll();
+  uint32_t raw_roll;
+  memcpy(&raw_roll, &tmp_roll, sizeof(tmp_roll));
+  if (raw_roll != 0) {
+    _this->_internal_set_roll(from._internal_roll());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Vec4::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.Vec4)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Vec4::CopyFrom(const Vec4& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Vec4)
+void Euler::CopyFrom(const Euler& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Euler)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Vec4::IsInitialized() const {
+bool Euler::IsInitialized() const {
   return true;
 }
 
-void Vec4::InternalSwap(Vec4* other) {
+void Euler::InternalSwap(Euler* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(x_, other->x_);
-  swap(y_, other->y_);
-  swap(z_, other->z_);
-  swap(w_, other->w_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Euler, _impl_.roll_)
+      + sizeof(Euler::_impl_.roll_)
+      - PROTOBUF_FIELD_OFFSET(Euler, _impl_.heading_)>(
+          reinterpret_cast<char*>(&_impl_.heading_),
+          reinterpret_cast<char*>(&other->_impl_.heading_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Vec4::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Euler::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[10]);
 }
 
-
 // ===================================================================
 
-void Line::InitAsDefaultInstance() {
-  ::Analytics::_Line_default_instance_._instance.get_mutable()->p0_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-  ::Analytics::_Line_default_instance_._instance.get_mutable()->p1_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-}
-class Line::_Internal {
+class Material::_Internal {
  public:
-  static const ::Analytics::Vec3& p0(const Line* msg);
-  static const ::Analytics::Vec3& p1(const Line* msg);
 };
 
-const ::Analytics::Vec3&
-Line::_Internal::p0(const Line* msg) {
-  return *msg->p0_;
-}
-const ::Analytics::Vec3&
-Line::_Internal::p1(const Line* msg) {
-  return *msg->p1_;
+Material::Material(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.Material)
 }
-Line::Line()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.Line)
-}
-Line::Line(const Line& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from._internal_has_p0()) {
-    p0_ = new ::Analytics::Vec3(*from.p0_);
-  } else {
-    p0_ = nullptr;
-  }
-  if (from._internal_has_p1()) {
-    p1_ = new ::Analytics::Vec3(*from.p1_);
-  } else {
-    p1_ = nullptr;
+Material::Material(const Material& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Material* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.contents_){}
+    , decltype(_impl_.surfaceflags_){}
+    , decltype(_impl_.renderevents_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:Analytics.Line)
+  ::memcpy(&_impl_.contents_, &from._impl_.contents_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.renderevents_) -
+    reinterpret_cast<char*>(&_impl_.contents_)) + sizeof(_impl_.renderevents_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.Material)
 }
 
-void Line::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Line_analytics_2eproto.base);
-  ::memset(&p0_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&p1_) -
-      reinterpret_cast<char*>(&p0_)) + sizeof(p1_));
+inline void Material::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.contents_){0u}
+    , decltype(_impl_.surfaceflags_){0u}
+    , decltype(_impl_.renderevents_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Line::~Line() {
-  // @@protoc_insertion_point(destructor:Analytics.Line)
+Material::~Material() {
+  // @@protoc_insertion_point(destructor:Analytics.Material)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Line::SharedDtor() {
-  if (this != internal_default_instance()) delete p0_;
-  if (this != internal_default_instance()) delete p1_;
+inline void Material::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-void Line::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Line& Line::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Line_analytics_2eproto.base);
-  return *internal_default_instance();
+void Material::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Line::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.Line)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Material::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.Material)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == nullptr && p0_ != nullptr) {
-    delete p0_;
-  }
-  p0_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && p1_ != nullptr) {
-    delete p1_;
-  }
-  p1_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.contents_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.renderevents_) -
+      reinterpret_cast<char*>(&_impl_.contents_)) + sizeof(_impl_.renderevents_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Line::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Material::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .Analytics.Vec3 p0 = 1;
+      // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_p0(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.Material.name"));
+        } else
+          goto handle_unusual;
         continue;
-      // .Analytics.Vec3 p1 = 2;
+      // uint32 contents = 2 [(.Analytics.enumkey) = "CONTENT_FLAGS", (.Analytics.enumflags) = true];
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_p1(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.contents_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 surfaceFlags = 3 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.enumflags) = true];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.surfaceflags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // bool renderEvents = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.renderevents_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Line::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Line)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+uint8_t* Material::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Material)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Analytics.Material.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // uint32 contents = 2 [(.Analytics.enumkey) = "CONTENT_FLAGS", (.Analytics.enumflags) = true];
+  if (this->_internal_contents() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_contents(), target);
+  }
 
-  // .Analytics.Vec3 p0 = 1;
-  if (this->has_p0()) {
+  // uint32 surfaceFlags = 3 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.enumflags) = true];
+  if (this->_internal_surfaceflags() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::p0(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_surfaceflags(), target);
   }
 
-  // .Analytics.Vec3 p1 = 2;
-  if (this->has_p1()) {
+  // bool renderEvents = 4;
+  if (this->_internal_renderevents() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::p1(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_renderevents(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Line)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Material)
   return target;
 }
 
-size_t Line::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.Line)
+size_t Material::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.Material)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .Analytics.Vec3 p0 = 1;
-  if (this->has_p0()) {
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *p0_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  // .Analytics.Vec3 p1 = 2;
-  if (this->has_p1()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *p1_);
+  // uint32 contents = 2 [(.Analytics.enumkey) = "CONTENT_FLAGS", (.Analytics.enumflags) = true];
+  if (this->_internal_contents() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_contents());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 surfaceFlags = 3 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.enumflags) = true];
+  if (this->_internal_surfaceflags() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_surfaceflags());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void Line::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.Line)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Line* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Line>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.Line)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.Line)
-    MergeFrom(*source);
+  // bool renderEvents = 4;
+  if (this->_internal_renderevents() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Line::MergeFrom(const Line& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Line)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Material::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Material::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Material::GetClassData() const { return &_class_data_; }
+
+
+void Material::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Material*>(&to_msg);
+  auto& from = static_cast<const Material&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Material)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_p0()) {
-    _internal_mutable_p0()->::Analytics::Vec3::MergeFrom(from._internal_p0());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.has_p1()) {
-    _internal_mutable_p1()->::Analytics::Vec3::MergeFrom(from._internal_p1());
+  if (from._internal_contents() != 0) {
+    _this->_internal_set_contents(from._internal_contents());
   }
+  if (from._internal_surfaceflags() != 0) {
+    _this->_internal_set_surfaceflags(from._internal_surfaceflags());
+  }
+  if (from._internal_renderevents() != 0) {
+    _this->_internal_set_renderevents(from._internal_renderevents());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Line::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.Line)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Line::CopyFrom(const Line& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Line)
+void Material::CopyFrom(const Material& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Material)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Line::IsInitialized() const {
+bool Material::IsInitialized() const {
   return true;
 }
 
-void Line::InternalSwap(Line* other) {
+void Material::InternalSwap(Material* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(p0_, other->p0_);
-  swap(p1_, other->p1_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Material, _impl_.renderevents_)
+      + sizeof(Material::_impl_.renderevents_)
+      - PROTOBUF_FIELD_OFFSET(Material, _impl_.contents_)>(
+          reinterpret_cast<char*>(&_impl_.contents_),
+          reinterpret_cast<char*>(&other->_impl_.contents_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Line::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Material::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[11]);
 }
 
-
 // ===================================================================
 
-void Euler::InitAsDefaultInstance() {
-}
-class Euler::_Internal {
+class PrimitiveOptions::_Internal {
  public:
 };
 
-Euler::Euler()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.Euler)
+PrimitiveOptions::PrimitiveOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.PrimitiveOptions)
 }
-Euler::Euler(const Euler& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&heading_, &from.heading_,
-    static_cast<size_t>(reinterpret_cast<char*>(&roll_) -
-    reinterpret_cast<char*>(&heading_)) + sizeof(roll_));
-  // @@protoc_insertion_point(copy_constructor:Analytics.Euler)
+PrimitiveOptions::PrimitiveOptions(const PrimitiveOptions& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrimitiveOptions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.partindex_){}
+    , decltype(_impl_.overridesurfaceflags_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.partindex_, &from._impl_.partindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.overridesurfaceflags_) -
+    reinterpret_cast<char*>(&_impl_.partindex_)) + sizeof(_impl_.overridesurfaceflags_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.PrimitiveOptions)
 }
 
-void Euler::SharedCtor() {
-  ::memset(&heading_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&roll_) -
-      reinterpret_cast<char*>(&heading_)) + sizeof(roll_));
+inline void PrimitiveOptions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.partindex_){0u}
+    , decltype(_impl_.overridesurfaceflags_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-Euler::~Euler() {
-  // @@protoc_insertion_point(destructor:Analytics.Euler)
+PrimitiveOptions::~PrimitiveOptions() {
+  // @@protoc_insertion_point(destructor:Analytics.PrimitiveOptions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Euler::SharedDtor() {
+inline void PrimitiveOptions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Euler::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Euler& Euler::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Euler_analytics_2eproto.base);
-  return *internal_default_instance();
+void PrimitiveOptions::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Euler::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.Euler)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void PrimitiveOptions::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.PrimitiveOptions)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&heading_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&roll_) -
-      reinterpret_cast<char*>(&heading_)) + sizeof(roll_));
-  _internal_metadata_.Clear();
+  ::memset(&_impl_.partindex_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.overridesurfaceflags_) -
+      reinterpret_cast<char*>(&_impl_.partindex_)) + sizeof(_impl_.overridesurfaceflags_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Euler::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* PrimitiveOptions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // float heading = 1;
+      // uint32 partIndex = 1 [(.Analytics.editable_key) = true];
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 13)) {
-          heading_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.partindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      // float pitch = 2;
+      // uint32 overrideSurfaceFlags = 2 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.editable) = true, (.Analytics.enumflags) = true];
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
-          pitch_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.overridesurfaceflags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      // float roll = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
-          roll_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Euler::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Euler)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* PrimitiveOptions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.PrimitiveOptions)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float heading = 1;
-  if (!(this->heading() <= 0 && this->heading() >= 0)) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(1, this->_internal_heading(), target);
-  }
-
-  // float pitch = 2;
-  if (!(this->pitch() <= 0 && this->pitch() >= 0)) {
+  // uint32 partIndex = 1 [(.Analytics.editable_key) = true];
+  if (this->_internal_partindex() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(2, this->_internal_pitch(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_partindex(), target);
   }
 
-  // float roll = 3;
-  if (!(this->roll() <= 0 && this->roll() >= 0)) {
+  // uint32 overrideSurfaceFlags = 2 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.editable) = true, (.Analytics.enumflags) = true];
+  if (this->_internal_overridesurfaceflags() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(3, this->_internal_roll(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_overridesurfaceflags(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Euler)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.PrimitiveOptions)
   return target;
 }
 
-size_t Euler::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.Euler)
+size_t PrimitiveOptions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.PrimitiveOptions)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // float heading = 1;
-  if (!(this->heading() <= 0 && this->heading() >= 0)) {
-    total_size += 1 + 4;
-  }
-
-  // float pitch = 2;
-  if (!(this->pitch() <= 0 && this->pitch() >= 0)) {
-    total_size += 1 + 4;
+  // uint32 partIndex = 1 [(.Analytics.editable_key) = true];
+  if (this->_internal_partindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_partindex());
   }
 
-  // float roll = 3;
-  if (!(this->roll() <= 0 && this->roll() >= 0)) {
-    total_size += 1 + 4;
+  // uint32 overrideSurfaceFlags = 2 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.editable) = true, (.Analytics.enumflags) = true];
+  if (this->_internal_overridesurfaceflags() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_overridesurfaceflags());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Euler::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.Euler)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Euler* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Euler>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.Euler)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.Euler)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrimitiveOptions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrimitiveOptions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrimitiveOptions::GetClassData() const { return &_class_data_; }
 
-void Euler::MergeFrom(const Euler& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Euler)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void PrimitiveOptions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrimitiveOptions*>(&to_msg);
+  auto& from = static_cast<const PrimitiveOptions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.PrimitiveOptions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!(from.heading() <= 0 && from.heading() >= 0)) {
-    _internal_set_heading(from._internal_heading());
-  }
-  if (!(from.pitch() <= 0 && from.pitch() >= 0)) {
-    _internal_set_pitch(from._internal_pitch());
+  if (from._internal_partindex() != 0) {
+    _this->_internal_set_partindex(from._internal_partindex());
   }
-  if (!(from.roll() <= 0 && from.roll() >= 0)) {
-    _internal_set_roll(from._internal_roll());
+  if (from._internal_overridesurfaceflags() != 0) {
+    _this->_internal_set_overridesurfaceflags(from._internal_overridesurfaceflags());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Euler::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.Euler)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Euler::CopyFrom(const Euler& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Euler)
+void PrimitiveOptions::CopyFrom(const PrimitiveOptions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.PrimitiveOptions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Euler::IsInitialized() const {
+bool PrimitiveOptions::IsInitialized() const {
   return true;
 }
 
-void Euler::InternalSwap(Euler* other) {
+void PrimitiveOptions::InternalSwap(PrimitiveOptions* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(heading_, other->heading_);
-  swap(pitch_, other->pitch_);
-  swap(roll_, other->roll_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrimitiveOptions, _impl_.overridesurfaceflags_)
+      + sizeof(PrimitiveOptions::_impl_.overridesurfaceflags_)
+      - PROTOBUF_FIELD_OFFSET(PrimitiveOptions, _impl_.partindex_)>(
+          reinterpret_cast<char*>(&_impl_.partindex_),
+          reinterpret_cast<char*>(&other->_impl_.partindex_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Euler::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata PrimitiveOptions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[12]);
 }
 
-
 // ===================================================================
 
-void Material::InitAsDefaultInstance() {
-}
-class Material::_Internal {
+class Primitive::_Internal {
  public:
+  static const ::Analytics::PrimitiveOptions& options(const Primitive* msg);
 };
 
-Material::Material()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.Material)
+const ::Analytics::PrimitiveOptions&
+Primitive::_Internal::options(const Primitive* msg) {
+  return *msg->_impl_.options_;
 }
-Material::Material(const Material& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_name().empty()) {
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
+Primitive::Primitive(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.Primitive)
+}
+Primitive::Primitive(const Primitive& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Primitive* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertices_){from._impl_.vertices_}
+    , decltype(_impl_.options_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.materialindex_){}
+    , decltype(_impl_.size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_options()) {
+    _this->_impl_.options_ = new ::Analytics::PrimitiveOptions(*from._impl_.options_);
   }
-  ::memcpy(&contents_, &from.contents_,
-    static_cast<size_t>(reinterpret_cast<char*>(&renderevents_) -
-    reinterpret_cast<char*>(&contents_)) + sizeof(renderevents_));
-  // @@protoc_insertion_point(copy_constructor:Analytics.Material)
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.size_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.size_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.Primitive)
 }
 
-void Material::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Material_analytics_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&contents_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&renderevents_) -
-      reinterpret_cast<char*>(&contents_)) + sizeof(renderevents_));
+inline void Primitive::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertices_){arena}
+    , decltype(_impl_.options_){nullptr}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.materialindex_){0u}
+    , decltype(_impl_.size_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-Material::~Material() {
-  // @@protoc_insertion_point(destructor:Analytics.Material)
+Primitive::~Primitive() {
+  // @@protoc_insertion_point(destructor:Analytics.Primitive)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Material::SharedDtor() {
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Primitive::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.vertices_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.options_;
 }
 
-void Material::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Material& Material::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Material_analytics_2eproto.base);
-  return *internal_default_instance();
+void Primitive::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Material::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.Material)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Primitive::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.Primitive)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&contents_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&renderevents_) -
-      reinterpret_cast<char*>(&contents_)) + sizeof(renderevents_));
-  _internal_metadata_.Clear();
+  _impl_.vertices_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.options_ != nullptr) {
+    delete _impl_.options_;
+  }
+  _impl_.options_ = nullptr;
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.size_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Material::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Primitive::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string name = 1;
+      // .Analytics.PrimitiveType type = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.Material.name"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+          _internal_set_type(static_cast<::Analytics::PrimitiveType>(val));
+        } else
+          goto handle_unusual;
         continue;
-      // uint32 contents = 2 [(.Analytics.enumkey) = "CONTENT_FLAGS", (.Analytics.enumflags) = true];
+      // uint32 materialIndex = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          contents_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.materialindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // uint32 surfaceFlags = 3 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.enumflags) = true];
+      // .Analytics.PrimitiveOptions options = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          surfaceflags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_options(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // bool renderEvents = 4;
+      // float size = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          renderevents_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // repeated .Analytics.Vec3Color vertices = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_vertices(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Material::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Material)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Primitive::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Primitive)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Analytics.Material.name");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_name(), target);
+  // .Analytics.PrimitiveType type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
-  // uint32 contents = 2 [(.Analytics.enumkey) = "CONTENT_FLAGS", (.Analytics.enumflags) = true];
-  if (this->contents() != 0) {
+  // uint32 materialIndex = 2;
+  if (this->_internal_materialindex() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_contents(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_materialindex(), target);
   }
 
-  // uint32 surfaceFlags = 3 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.enumflags) = true];
-  if (this->surfaceflags() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_surfaceflags(), target);
+  // .Analytics.PrimitiveOptions options = 3;
+  if (this->_internal_has_options()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::options(this),
+        _Internal::options(this).GetCachedSize(), target, stream);
   }
 
-  // bool renderEvents = 4;
-  if (this->renderevents() != 0) {
+  // float size = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_size = this->_internal_size();
+  uint32_t raw_size;
+  memcpy(&raw_size, &tmp_size, sizeof(tmp_size));
+  if (raw_size != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(4, this->_internal_renderevents(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_size(), target);
+  }
+
+  // repeated .Analytics.Vec3Color vertices = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_vertices_size()); i < n; i++) {
+    const auto& repfield = this->_internal_vertices(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Material)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Primitive)
   return target;
 }
 
-size_t Material::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.Material)
+size_t Primitive::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.Primitive)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name());
+  // repeated .Analytics.Vec3Color vertices = 5;
+  total_size += 1UL * this->_internal_vertices_size();
+  for (const auto& msg : this->_impl_.vertices_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // uint32 contents = 2 [(.Analytics.enumkey) = "CONTENT_FLAGS", (.Analytics.enumflags) = true];
-  if (this->contents() != 0) {
+  // .Analytics.PrimitiveOptions options = 3;
+  if (this->_internal_has_options()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_contents());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.options_);
   }
 
-  // uint32 surfaceFlags = 3 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.enumflags) = true];
-  if (this->surfaceflags() != 0) {
+  // .Analytics.PrimitiveType type = 1;
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_surfaceflags());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  // bool renderEvents = 4;
-  if (this->renderevents() != 0) {
-    total_size += 1 + 1;
+  // uint32 materialIndex = 2;
+  if (this->_internal_materialindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_materialindex());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // float size = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_size = this->_internal_size();
+  uint32_t raw_size;
+  memcpy(&raw_size, &tmp_size, sizeof(tmp_size));
+  if (raw_size != 0) {
+    total_size += 1 + 4;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void Material::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.Material)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Material* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Material>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.Material)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.Material)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Material::MergeFrom(const Material& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Material)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Primitive::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Primitive::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Primitive::GetClassData() const { return &_class_data_; }
 
-  if (from.name().size() > 0) {
 
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
+void Primitive::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Primitive*>(&to_msg);
+  auto& from = static_cast<const Primitive&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Primitive)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.vertices_.MergeFrom(from._impl_.vertices_);
+  if (from._internal_has_options()) {
+    _this->_internal_mutable_options()->::Analytics::PrimitiveOptions::MergeFrom(
+        from._internal_options());
   }
-  if (from.contents() != 0) {
-    _internal_set_contents(from._internal_contents());
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
-  if (from.surfaceflags() != 0) {
-    _internal_set_surfaceflags(from._internal_surfaceflags());
+  if (from._internal_materialindex() != 0) {
+    _this->_internal_set_materialindex(from._internal_materialindex());
   }
-  if (from.renderevents() != 0) {
-    _internal_set_renderevents(from._internal_renderevents());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_size = from._internal_size();
+  uint32_t raw_size;
+  memcpy(&raw_size, &tmp_size, sizeof(tmp_size));
+  if (raw_size != 0) {
+    _this->_internal_set_size(from._internal_size());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Material::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.Material)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Material::CopyFrom(const Material& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Material)
+void Primitive::CopyFrom(const Primitive& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Primitive)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Material::IsInitialized() const {
+bool Primitive::IsInitialized() const {
   return true;
 }
 
-void Material::InternalSwap(Material* other) {
+void Primitive::InternalSwap(Primitive* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(contents_, other->contents_);
-  swap(surfaceflags_, other->surfaceflags_);
-  swap(renderevents_, other->renderevents_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.vertices_.InternalSwap(&other->_impl_.vertices_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Primitive, _impl_.size_)
+      + sizeof(Primitive::_impl_.size_)
+      - PROTOBUF_FIELD_OFFSET(Primitive, _impl_.options_)>(
+          reinterpret_cast<char*>(&_impl_.options_),
+          reinterpret_cast<char*>(&other->_impl_.options_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Material::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Primitive::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[13]);
 }
 
-
 // ===================================================================
 
-void PrimitiveOptions::InitAsDefaultInstance() {
-}
-class PrimitiveOptions::_Internal {
+class Mesh::_Internal {
  public:
 };
 
-PrimitiveOptions::PrimitiveOptions()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.PrimitiveOptions)
+Mesh::Mesh(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.Mesh)
 }
-PrimitiveOptions::PrimitiveOptions(const PrimitiveOptions& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&partindex_, &from.partindex_,
-    static_cast<size_t>(reinterpret_cast<char*>(&overridesurfaceflags_) -
-    reinterpret_cast<char*>(&partindex_)) + sizeof(overridesurfaceflags_));
-  // @@protoc_insertion_point(copy_constructor:Analytics.PrimitiveOptions)
+Mesh::Mesh(const Mesh& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Mesh* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.primitives_){from._impl_.primitives_}
+    , decltype(_impl_.materials_){from._impl_.materials_}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:Analytics.Mesh)
 }
 
-void PrimitiveOptions::SharedCtor() {
-  ::memset(&partindex_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&overridesurfaceflags_) -
-      reinterpret_cast<char*>(&partindex_)) + sizeof(overridesurfaceflags_));
+inline void Mesh::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.primitives_){arena}
+    , decltype(_impl_.materials_){arena}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-PrimitiveOptions::~PrimitiveOptions() {
-  // @@protoc_insertion_point(destructor:Analytics.PrimitiveOptions)
+Mesh::~Mesh() {
+  // @@protoc_insertion_point(destructor:Analytics.Mesh)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PrimitiveOptions::SharedDtor() {
+inline void Mesh::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.primitives_.~RepeatedPtrField();
+  _impl_.materials_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
 }
 
-void PrimitiveOptions::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const PrimitiveOptions& PrimitiveOptions::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PrimitiveOptions_analytics_2eproto.base);
-  return *internal_default_instance();
+void Mesh::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void PrimitiveOptions::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.PrimitiveOptions)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Mesh::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.Mesh)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&partindex_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&overridesurfaceflags_) -
-      reinterpret_cast<char*>(&partindex_)) + sizeof(overridesurfaceflags_));
-  _internal_metadata_.Clear();
+  _impl_.primitives_.Clear();
+  _impl_.materials_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* PrimitiveOptions::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Mesh::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // uint32 partIndex = 1 [(.Analytics.editable_key) = true];
+      // repeated .Analytics.Primitive primitives = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          partindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_primitives(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      // uint32 overrideSurfaceFlags = 2 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.editable) = true, (.Analytics.enumflags) = true];
+      // repeated .Analytics.Material materials = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          overridesurfaceflags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_materials(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // string name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.Mesh.name"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* PrimitiveOptions::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.PrimitiveOptions)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Mesh::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Mesh)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 partIndex = 1 [(.Analytics.editable_key) = true];
-  if (this->partindex() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_partindex(), target);
+  // repeated .Analytics.Primitive primitives = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_primitives_size()); i < n; i++) {
+    const auto& repfield = this->_internal_primitives(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // uint32 overrideSurfaceFlags = 2 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.editable) = true, (.Analytics.enumflags) = true];
-  if (this->overridesurfaceflags() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_overridesurfaceflags(), target);
+  // repeated .Analytics.Material materials = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_materials_size()); i < n; i++) {
+    const auto& repfield = this->_internal_materials(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Analytics.Mesh.name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_name(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.PrimitiveOptions)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Mesh)
   return target;
 }
 
-size_t PrimitiveOptions::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.PrimitiveOptions)
+size_t Mesh::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.Mesh)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // uint32 partIndex = 1 [(.Analytics.editable_key) = true];
-  if (this->partindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_partindex());
+  // repeated .Analytics.Primitive primitives = 1;
+  total_size += 1UL * this->_internal_primitives_size();
+  for (const auto& msg : this->_impl_.primitives_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // uint32 overrideSurfaceFlags = 2 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.editable) = true, (.Analytics.enumflags) = true];
-  if (this->overridesurfaceflags() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_overridesurfaceflags());
+  // repeated .Analytics.Material materials = 2;
+  total_size += 1UL * this->_internal_materials_size();
+  for (const auto& msg : this->_impl_.materials_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void PrimitiveOptions::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.PrimitiveOptions)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PrimitiveOptions* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PrimitiveOptions>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.PrimitiveOptions)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.PrimitiveOptions)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PrimitiveOptions::MergeFrom(const PrimitiveOptions& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.PrimitiveOptions)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Mesh::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Mesh::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Mesh::GetClassData() const { return &_class_data_; }
+
+
+void Mesh::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Mesh*>(&to_msg);
+  auto& from = static_cast<const Mesh&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Mesh)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.partindex() != 0) {
-    _internal_set_partindex(from._internal_partindex());
-  }
-  if (from.overridesurfaceflags() != 0) {
-    _internal_set_overridesurfaceflags(from._internal_overridesurfaceflags());
+  _this->_impl_.primitives_.MergeFrom(from._impl_.primitives_);
+  _this->_impl_.materials_.MergeFrom(from._impl_.materials_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void PrimitiveOptions::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.PrimitiveOptions)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void PrimitiveOptions::CopyFrom(const PrimitiveOptions& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.PrimitiveOptions)
+void Mesh::CopyFrom(const Mesh& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Mesh)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PrimitiveOptions::IsInitialized() const {
+bool Mesh::IsInitialized() const {
   return true;
 }
 
-void PrimitiveOptions::InternalSwap(PrimitiveOptions* other) {
+void Mesh::InternalSwap(Mesh* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(partindex_, other->partindex_);
-  swap(overridesurfaceflags_, other->overridesurfaceflags_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.primitives_.InternalSwap(&other->_impl_.primitives_);
+  _impl_.materials_.InternalSwap(&other->_impl_.materials_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata PrimitiveOptions::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Mesh::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[14]);
 }
 
-
 // ===================================================================
 
-void Primitive::InitAsDefaultInstance() {
-  ::Analytics::_Primitive_default_instance_._instance.get_mutable()->options_ = const_cast< ::Analytics::PrimitiveOptions*>(
-      ::Analytics::PrimitiveOptions::internal_default_instance());
-}
-class Primitive::_Internal {
+class UTCTime::_Internal {
  public:
-  static const ::Analytics::PrimitiveOptions& options(const Primitive* msg);
 };
 
-const ::Analytics::PrimitiveOptions&
-Primitive::_Internal::options(const Primitive* msg) {
-  return *msg->options_;
+UTCTime::UTCTime(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.UTCTime)
 }
-Primitive::Primitive()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.Primitive)
-}
-Primitive::Primitive(const Primitive& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      vertices_(from.vertices_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from._internal_has_options()) {
-    options_ = new ::Analytics::PrimitiveOptions(*from.options_);
-  } else {
-    options_ = nullptr;
-  }
-  ::memcpy(&type_, &from.type_,
-    static_cast<size_t>(reinterpret_cast<char*>(&size_) -
-    reinterpret_cast<char*>(&type_)) + sizeof(size_));
-  // @@protoc_insertion_point(copy_constructor:Analytics.Primitive)
+UTCTime::UTCTime(const UTCTime& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UTCTime* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hour_){}
+    , decltype(_impl_.minute_){}
+    , decltype(_impl_.second_){}
+    , decltype(_impl_.day_){}
+    , decltype(_impl_.month_){}
+    , decltype(_impl_.year_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.hour_, &from._impl_.hour_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.year_) -
+    reinterpret_cast<char*>(&_impl_.hour_)) + sizeof(_impl_.year_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.UTCTime)
 }
 
-void Primitive::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Primitive_analytics_2eproto.base);
-  ::memset(&options_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&size_) -
-      reinterpret_cast<char*>(&options_)) + sizeof(size_));
+inline void UTCTime::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hour_){0}
+    , decltype(_impl_.minute_){0}
+    , decltype(_impl_.second_){0}
+    , decltype(_impl_.day_){0}
+    , decltype(_impl_.month_){0}
+    , decltype(_impl_.year_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-Primitive::~Primitive() {
-  // @@protoc_insertion_point(destructor:Analytics.Primitive)
+UTCTime::~UTCTime() {
+  // @@protoc_insertion_point(destructor:Analytics.UTCTime)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Primitive::SharedDtor() {
-  if (this != internal_default_instance()) delete options_;
+inline void UTCTime::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Primitive::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Primitive& Primitive::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Primitive_analytics_2eproto.base);
-  return *internal_default_instance();
+void UTCTime::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Primitive::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.Primitive)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void UTCTime::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.UTCTime)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  vertices_.Clear();
-  if (GetArenaNoVirtual() == nullptr && options_ != nullptr) {
-    delete options_;
-  }
-  options_ = nullptr;
-  ::memset(&type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&size_) -
-      reinterpret_cast<char*>(&type_)) + sizeof(size_));
-  _internal_metadata_.Clear();
+  ::memset(&_impl_.hour_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.year_) -
+      reinterpret_cast<char*>(&_impl_.hour_)) + sizeof(_impl_.year_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Primitive::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* UTCTime::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .Analytics.PrimitiveType type = 1;
+      // int32 hour = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.hour_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          _internal_set_type(static_cast<::Analytics::PrimitiveType>(val));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // uint32 materialIndex = 2;
+      // int32 minute = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          materialindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.minute_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .Analytics.PrimitiveOptions options = 3;
+      // int32 second = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_options(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.second_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // float size = 4;
+      // int32 day = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 37)) {
-          size_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.day_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      // repeated .Analytics.Vec3Color vertices = 5;
+      // int32 month = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_vertices(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.month_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 year = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.year_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Primitive::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Primitive)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* UTCTime::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.UTCTime)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .Analytics.PrimitiveType type = 1;
-  if (this->type() != 0) {
+  // int32 hour = 1;
+  if (this->_internal_hour() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_type(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_hour(), target);
   }
 
-  // uint32 materialIndex = 2;
-  if (this->materialindex() != 0) {
+  // int32 minute = 2;
+  if (this->_internal_minute() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_materialindex(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_minute(), target);
   }
 
-  // .Analytics.PrimitiveOptions options = 3;
-  if (this->has_options()) {
+  // int32 second = 3;
+  if (this->_internal_second() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::options(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_second(), target);
   }
 
-  // float size = 4;
-  if (!(this->size() <= 0 && this->size() >= 0)) {
+  // int32 day = 4;
+  if (this->_internal_day() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(4, this->_internal_size(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_day(), target);
   }
 
-  // repeated .Analytics.Vec3Color vertices = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_vertices_size()); i < n; i++) {
+  // int32 month = 5;
+  if (this->_internal_month() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, this->_internal_vertices(i), target, stream);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_month(), target);
+  }
+
+  // int32 year = 6;
+  if (this->_internal_year() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_year(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Primitive)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.UTCTime)
   return target;
 }
 
-size_t Primitive::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.Primitive)
+size_t UTCTime::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.UTCTime)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .Analytics.Vec3Color vertices = 5;
-  total_size += 1UL * this->_internal_vertices_size();
-  for (const auto& msg : this->vertices_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // int32 hour = 1;
+  if (this->_internal_hour() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hour());
   }
 
-  // .Analytics.PrimitiveOptions options = 3;
-  if (this->has_options()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *options_);
+  // int32 minute = 2;
+  if (this->_internal_minute() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_minute());
   }
 
-  // .Analytics.PrimitiveType type = 1;
-  if (this->type() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_type());
+  // int32 second = 3;
+  if (this->_internal_second() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_second());
   }
 
-  // uint32 materialIndex = 2;
-  if (this->materialindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_materialindex());
+  // int32 day = 4;
+  if (this->_internal_day() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_day());
   }
 
-  // float size = 4;
-  if (!(this->size() <= 0 && this->size() >= 0)) {
-    total_size += 1 + 4;
+  // int32 month = 5;
+  if (this->_internal_month() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_month());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 year = 6;
+  if (this->_internal_year() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_year());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void Primitive::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.Primitive)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Primitive* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Primitive>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.Primitive)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.Primitive)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Primitive::MergeFrom(const Primitive& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Primitive)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UTCTime::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UTCTime::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UTCTime::GetClassData() const { return &_class_data_; }
+
+
+void UTCTime::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UTCTime*>(&to_msg);
+  auto& from = static_cast<const UTCTime&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.UTCTime)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  vertices_.MergeFrom(from.vertices_);
-  if (from.has_options()) {
-    _internal_mutable_options()->::Analytics::PrimitiveOptions::MergeFrom(from._internal_options());
+  if (from._internal_hour() != 0) {
+    _this->_internal_set_hour(from._internal_hour());
   }
-  if (from.type() != 0) {
-    _internal_set_type(from._internal_type());
+  if (from._internal_minute() != 0) {
+    _this->_internal_set_minute(from._internal_minute());
   }
-  if (from.materialindex() != 0) {
-    _internal_set_materialindex(from._internal_materialindex());
+  if (from._internal_second() != 0) {
+    _this->_internal_set_second(from._internal_second());
   }
-  if (!(from.size() <= 0 && from.size() >= 0)) {
-    _internal_set_size(from._internal_size());
+  if (from._internal_day() != 0) {
+    _this->_internal_set_day(from._internal_day());
   }
+  if (from._internal_month() != 0) {
+    _this->_internal_set_month(from._internal_month());
+  }
+  if (from._internal_year() != 0) {
+    _this->_internal_set_year(from._internal_year());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Primitive::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.Primitive)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Primitive::CopyFrom(const Primitive& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Primitive)
+void UTCTime::CopyFrom(const UTCTime& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.UTCTime)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Primitive::IsInitialized() const {
+bool UTCTime::IsInitialized() const {
   return true;
 }
 
-void Primitive::InternalSwap(Primitive* other) {
+void UTCTime::InternalSwap(UTCTime* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  vertices_.InternalSwap(&other->vertices_);
-  swap(options_, other->options_);
-  swap(type_, other->type_);
-  swap(materialindex_, other->materialindex_);
-  swap(size_, other->size_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UTCTime, _impl_.year_)
+      + sizeof(UTCTime::_impl_.year_)
+      - PROTOBUF_FIELD_OFFSET(UTCTime, _impl_.hour_)>(
+          reinterpret_cast<char*>(&_impl_.hour_),
+          reinterpret_cast<char*>(&other->_impl_.hour_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Primitive::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata UTCTime::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[15]);
 }
 
-
 // ===================================================================
 
-void Mesh::InitAsDefaultInstance() {
-}
-class Mesh::_Internal {
+class GameInfo::_Internal {
  public:
+  static const ::Analytics::UTCTime& timestamp(const GameInfo* msg);
+  static const ::Analytics::Vec3& worldmins(const GameInfo* msg);
+  static const ::Analytics::Vec3& worldmaxs(const GameInfo* msg);
 };
 
-Mesh::Mesh()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.Mesh)
+const ::Analytics::UTCTime&
+GameInfo::_Internal::timestamp(const GameInfo* msg) {
+  return *msg->_impl_.timestamp_;
 }
-Mesh::Mesh(const Mesh& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      primitives_(from.primitives_),
-      materials_(from.materials_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_name().empty()) {
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
+const ::Analytics::Vec3&
+GameInfo::_Internal::worldmins(const GameInfo* msg) {
+  return *msg->_impl_.worldmins_;
+}
+const ::Analytics::Vec3&
+GameInfo::_Internal::worldmaxs(const GameInfo* msg) {
+  return *msg->_impl_.worldmaxs_;
+}
+GameInfo::GameInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameInfo)
+}
+GameInfo::GameInfo(const GameInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mapname_){}
+    , decltype(_impl_.gamename_){}
+    , decltype(_impl_.gameversion_){}
+    , decltype(_impl_.timestamp_){nullptr}
+    , decltype(_impl_.worldmins_){nullptr}
+    , decltype(_impl_.worldmaxs_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.mapname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mapname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_mapname().empty()) {
+    _this->_impl_.mapname_.Set(from._internal_mapname(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.gamename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.gamename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_gamename().empty()) {
+    _this->_impl_.gamename_.Set(from._internal_gamename(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.gameversion_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.gameversion_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_gameversion().empty()) {
+    _this->_impl_.gameversion_.Set(from._internal_gameversion(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_timestamp()) {
+    _this->_impl_.timestamp_ = new ::Analytics::UTCTime(*from._impl_.timestamp_);
+  }
+  if (from._internal_has_worldmins()) {
+    _this->_impl_.worldmins_ = new ::Analytics::Vec3(*from._impl_.worldmins_);
   }
-  // @@protoc_insertion_point(copy_constructor:Analytics.Mesh)
+  if (from._internal_has_worldmaxs()) {
+    _this->_impl_.worldmaxs_ = new ::Analytics::Vec3(*from._impl_.worldmaxs_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Analytics.GameInfo)
 }
 
-void Mesh::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Mesh_analytics_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mapname_){}
+    , decltype(_impl_.gamename_){}
+    , decltype(_impl_.gameversion_){}
+    , decltype(_impl_.timestamp_){nullptr}
+    , decltype(_impl_.worldmins_){nullptr}
+    , decltype(_impl_.worldmaxs_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.mapname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mapname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.gamename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.gamename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.gameversion_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.gameversion_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Mesh::~Mesh() {
-  // @@protoc_insertion_point(destructor:Analytics.Mesh)
+GameInfo::~GameInfo() {
+  // @@protoc_insertion_point(destructor:Analytics.GameInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Mesh::SharedDtor() {
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.mapname_.Destroy();
+  _impl_.gamename_.Destroy();
+  _impl_.gameversion_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.timestamp_;
+  if (this != internal_default_instance()) delete _impl_.worldmins_;
+  if (this != internal_default_instance()) delete _impl_.worldmaxs_;
 }
 
-void Mesh::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Mesh& Mesh::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Mesh_analytics_2eproto.base);
-  return *internal_default_instance();
+void GameInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void Mesh::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.Mesh)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void GameInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.GameInfo)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  primitives_.Clear();
-  materials_.Clear();
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.mapname_.ClearToEmpty();
+  _impl_.gamename_.ClearToEmpty();
+  _impl_.gameversion_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.timestamp_ != nullptr) {
+    delete _impl_.timestamp_;
+  }
+  _impl_.timestamp_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.worldmins_ != nullptr) {
+    delete _impl_.worldmins_;
+  }
+  _impl_.worldmins_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.worldmaxs_ != nullptr) {
+    delete _impl_.worldmaxs_;
+  }
+  _impl_.worldmaxs_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Mesh::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .Analytics.Primitive primitives = 1;
+      // .Analytics.UTCTime timeStamp = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_primitives(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_timestamp(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      // repeated .Analytics.Material materials = 2;
+      // string mapName = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_materials(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_mapname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameInfo.mapName"));
+        } else
+          goto handle_unusual;
         continue;
-      // string name = 3;
+      // string gameName = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.Mesh.name"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_gamename();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameInfo.gameName"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string gameVersion = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_gameversion();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameInfo.gameVersion"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .Analytics.Vec3 worldMins = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_worldmins(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .Analytics.Vec3 worldMaxs = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_worldmaxs(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Mesh::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.Mesh)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* GameInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameInfo)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .Analytics.Primitive primitives = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_primitives_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  // .Analytics.UTCTime timeStamp = 1;
+  if (this->_internal_has_timestamp()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_primitives(i), target, stream);
+      InternalWriteMessage(1, _Internal::timestamp(this),
+        _Internal::timestamp(this).GetCachedSize(), target, stream);
   }
 
-  // repeated .Analytics.Material materials = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_materials_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_materials(i), target, stream);
+  // string mapName = 2;
+  if (!this->_internal_mapname().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_mapname().data(), static_cast<int>(this->_internal_mapname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Analytics.GameInfo.mapName");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_mapname(), target);
   }
 
-  // string name = 3;
-  if (this->name().size() > 0) {
+  // string gameName = 3;
+  if (!this->_internal_gamename().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      this->_internal_gamename().data(), static_cast<int>(this->_internal_gamename().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Analytics.Mesh.name");
+      "Analytics.GameInfo.gameName");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_name(), target);
+        3, this->_internal_gamename(), target);
+  }
+
+  // string gameVersion = 4;
+  if (!this->_internal_gameversion().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_gameversion().data(), static_cast<int>(this->_internal_gameversion().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Analytics.GameInfo.gameVersion");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_gameversion(), target);
+  }
+
+  // .Analytics.Vec3 worldMins = 5;
+  if (this->_internal_has_worldmins()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::worldmins(this),
+        _Internal::worldmins(this).GetCachedSize(), target, stream);
+  }
+
+  // .Analytics.Vec3 worldMaxs = 6;
+  if (this->_internal_has_worldmaxs()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::worldmaxs(this),
+        _Internal::worldmaxs(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.Mesh)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameInfo)
   return target;
 }
 
-size_t Mesh::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.Mesh)
+size_t GameInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.GameInfo)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .Analytics.Primitive primitives = 1;
-  total_size += 1UL * this->_internal_primitives_size();
-  for (const auto& msg : this->primitives_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // string mapName = 2;
+  if (!this->_internal_mapname().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_mapname());
   }
 
-  // repeated .Analytics.Material materials = 2;
-  total_size += 1UL * this->_internal_materials_size();
-  for (const auto& msg : this->materials_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // string gameName = 3;
+  if (!this->_internal_gamename().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_gamename());
   }
 
-  // string name = 3;
-  if (this->name().size() > 0) {
+  // string gameVersion = 4;
+  if (!this->_internal_gameversion().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name());
+        this->_internal_gameversion());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // .Analytics.UTCTime timeStamp = 1;
+  if (this->_internal_has_timestamp()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.timestamp_);
+  }
+
+  // .Analytics.Vec3 worldMins = 5;
+  if (this->_internal_has_worldmins()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.worldmins_);
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void Mesh::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.Mesh)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Mesh* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Mesh>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.Mesh)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.Mesh)
-    MergeFrom(*source);
+  // .Analytics.Vec3 worldMaxs = 6;
+  if (this->_internal_has_worldmaxs()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.worldmaxs_);
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Mesh::MergeFrom(const Mesh& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.Mesh)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameInfo::GetClassData() const { return &_class_data_; }
 
-  primitives_.MergeFrom(from.primitives_);
-  materials_.MergeFrom(from.materials_);
-  if (from.name().size() > 0) {
 
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-}
+void GameInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameInfo*>(&to_msg);
+  auto& from = static_cast<const GameInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void Mesh::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.Mesh)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_mapname().empty()) {
+    _this->_internal_set_mapname(from._internal_mapname());
+  }
+  if (!from._internal_gamename().empty()) {
+    _this->_internal_set_gamename(from._internal_gamename());
+  }
+  if (!from._internal_gameversion().empty()) {
+    _this->_internal_set_gameversion(from._internal_gameversion());
+  }
+  if (from._internal_has_timestamp()) {
+    _this->_internal_mutable_timestamp()->::Analytics::UTCTime::MergeFrom(
+        from._internal_timestamp());
+  }
+  if (from._internal_has_worldmins()) {
+    _this->_internal_mutable_worldmins()->::Analytics::Vec3::MergeFrom(
+        from._internal_worldmins());
+  }
+  if (from._internal_has_worldmaxs()) {
+    _this->_internal_mutable_worldmaxs()->::Analytics::Vec3::MergeFrom(
+        from._internal_worldmaxs());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Mesh::CopyFrom(const Mesh& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.Mesh)
+void GameInfo::CopyFrom(const GameInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.GameInfo)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Mesh::IsInitialized() const {
+bool GameInfo::IsInitialized() const {
   return true;
 }
 
-void Mesh::InternalSwap(Mesh* other) {
+void GameInfo::InternalSwap(GameInfo* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  primitives_.InternalSwap(&other->primitives_);
-  materials_.InternalSwap(&other->materials_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mapname_, lhs_arena,
+      &other->_impl_.mapname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.gamename_, lhs_arena,
+      &other->_impl_.gamename_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.gameversion_, lhs_arena,
+      &other->_impl_.gameversion_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameInfo, _impl_.worldmaxs_)
+      + sizeof(GameInfo::_impl_.worldmaxs_)
+      - PROTOBUF_FIELD_OFFSET(GameInfo, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Mesh::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata GameInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[16]);
 }
 
-
 // ===================================================================
 
-void UTCTime::InitAsDefaultInstance() {
-}
-class UTCTime::_Internal {
+class GameEnum_EnumPair::_Internal {
  public:
 };
 
-UTCTime::UTCTime()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.UTCTime)
+GameEnum_EnumPair::GameEnum_EnumPair(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameEnum.EnumPair)
 }
-UTCTime::UTCTime(const UTCTime& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&hour_, &from.hour_,
-    static_cast<size_t>(reinterpret_cast<char*>(&year_) -
-    reinterpret_cast<char*>(&hour_)) + sizeof(year_));
-  // @@protoc_insertion_point(copy_constructor:Analytics.UTCTime)
+GameEnum_EnumPair::GameEnum_EnumPair(const GameEnum_EnumPair& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameEnum_EnumPair* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.value_ = from._impl_.value_;
+  // @@protoc_insertion_point(copy_constructor:Analytics.GameEnum.EnumPair)
 }
 
-void UTCTime::SharedCtor() {
-  ::memset(&hour_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&year_) -
-      reinterpret_cast<char*>(&hour_)) + sizeof(year_));
+inline void GameEnum_EnumPair::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-UTCTime::~UTCTime() {
-  // @@protoc_insertion_point(destructor:Analytics.UTCTime)
+GameEnum_EnumPair::~GameEnum_EnumPair() {
+  // @@protoc_insertion_point(destructor:Analytics.GameEnum.EnumPair)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void UTCTime::SharedDtor() {
+inline void GameEnum_EnumPair::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-void UTCTime::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const UTCTime& UTCTime::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UTCTime_analytics_2eproto.base);
-  return *internal_default_instance();
+void GameEnum_EnumPair::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void UTCTime::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.UTCTime)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void GameEnum_EnumPair::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.GameEnum.EnumPair)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&hour_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&year_) -
-      reinterpret_cast<char*>(&hour_)) + sizeof(year_));
-  _internal_metadata_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.value_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* UTCTime::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameEnum_EnumPair::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 hour = 1;
+      // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          hour_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameEnum.EnumPair.name"));
+        } else
+          goto handle_unusual;
         continue;
-      // int32 minute = 2;
+      // int64 value = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          minute_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 second = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          second_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 day = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          day_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 month = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          month_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 year = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          year_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* UTCTime::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.UTCTime)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 hour = 1;
-  if (this->hour() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_hour(), target);
-  }
-
-  // int32 minute = 2;
-  if (this->minute() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_minute(), target);
-  }
-
-  // int32 second = 3;
-  if (this->second() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_second(), target);
-  }
-
-  // int32 day = 4;
-  if (this->day() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_day(), target);
-  }
-
-  // int32 month = 5;
-  if (this->month() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_month(), target);
-  }
-
-  // int32 year = 6;
-  if (this->year() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(6, this->_internal_year(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.UTCTime)
-  return target;
-}
-
-size_t UTCTime::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.UTCTime)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
+uint8_t* GameEnum_EnumPair::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameEnum.EnumPair)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 hour = 1;
-  if (this->hour() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_hour());
-  }
-
-  // int32 minute = 2;
-  if (this->minute() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_minute());
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Analytics.GameEnum.EnumPair.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
-  // int32 second = 3;
-  if (this->second() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_second());
+  // int64 value = 2;
+  if (this->_internal_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_value(), target);
   }
 
-  // int32 day = 4;
-  if (this->day() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_day());
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameEnum.EnumPair)
+  return target;
+}
 
-  // int32 month = 5;
-  if (this->month() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_month());
-  }
+size_t GameEnum_EnumPair::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.GameEnum.EnumPair)
+  size_t total_size = 0;
 
-  // int32 year = 6;
-  if (this->year() != 0) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_year());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int64 value = 2;
+  if (this->_internal_value() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_value());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void UTCTime::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.UTCTime)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UTCTime* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UTCTime>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.UTCTime)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.UTCTime)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UTCTime::MergeFrom(const UTCTime& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.UTCTime)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameEnum_EnumPair::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameEnum_EnumPair::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameEnum_EnumPair::GetClassData() const { return &_class_data_; }
+
+
+void GameEnum_EnumPair::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameEnum_EnumPair*>(&to_msg);
+  auto& from = static_cast<const GameEnum_EnumPair&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameEnum.EnumPair)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.hour() != 0) {
-    _internal_set_hour(from._internal_hour());
-  }
-  if (from.minute() != 0) {
-    _internal_set_minute(from._internal_minute());
-  }
-  if (from.second() != 0) {
-    _internal_set_second(from._internal_second());
-  }
-  if (from.day() != 0) {
-    _internal_set_day(from._internal_day());
-  }
-  if (from.month() != 0) {
-    _internal_set_month(from._internal_month());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.year() != 0) {
-    _internal_set_year(from._internal_year());
+  if (from._internal_value() != 0) {
+    _this->_internal_set_value(from._internal_value());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void UTCTime::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.UTCTime)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void UTCTime::CopyFrom(const UTCTime& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.UTCTime)
+void GameEnum_EnumPair::CopyFrom(const GameEnum_EnumPair& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.GameEnum.EnumPair)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool UTCTime::IsInitialized() const {
+bool GameEnum_EnumPair::IsInitialized() const {
   return true;
 }
 
-void UTCTime::InternalSwap(UTCTime* other) {
+void GameEnum_EnumPair::InternalSwap(GameEnum_EnumPair* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(hour_, other->hour_);
-  swap(minute_, other->minute_);
-  swap(second_, other->second_);
-  swap(day_, other->day_);
-  swap(month_, other->month_);
-  swap(year_, other->year_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.value_, other->_impl_.value_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata UTCTime::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata GameEnum_EnumPair::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[17]);
 }
 
-
 // ===================================================================
 
-void GameInfo::InitAsDefaultInstance() {
-  ::Analytics::_GameInfo_default_instance_._instance.get_mutable()->timestamp_ = const_cast< ::Analytics::UTCTime*>(
-      ::Analytics::UTCTime::internal_default_instance());
-}
-class GameInfo::_Internal {
+class GameEnum::_Internal {
  public:
-  static const ::Analytics::UTCTime& timestamp(const GameInfo* msg);
 };
 
-const ::Analytics::UTCTime&
-GameInfo::_Internal::timestamp(const GameInfo* msg) {
-  return *msg->timestamp_;
-}
-GameInfo::GameInfo()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameInfo)
+GameEnum::GameEnum(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameEnum)
 }
-GameInfo::GameInfo(const GameInfo& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  mapname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_mapname().empty()) {
-    mapname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.mapname_);
-  }
-  gamename_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_gamename().empty()) {
-    gamename_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.gamename_);
-  }
-  gameversion_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_gameversion().empty()) {
-    gameversion_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.gameversion_);
-  }
-  if (from._internal_has_timestamp()) {
-    timestamp_ = new ::Analytics::UTCTime(*from.timestamp_);
-  } else {
-    timestamp_ = nullptr;
+GameEnum::GameEnum(const GameEnum& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameEnum* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.values_){from._impl_.values_}
+    , decltype(_impl_.enumname_){}
+    , decltype(_impl_.isbitfield_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.enumname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.enumname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_enumname().empty()) {
+    _this->_impl_.enumname_.Set(from._internal_enumname(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:Analytics.GameInfo)
+  _this->_impl_.isbitfield_ = from._impl_.isbitfield_;
+  // @@protoc_insertion_point(copy_constructor:Analytics.GameEnum)
 }
 
-void GameInfo::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameInfo_analytics_2eproto.base);
-  mapname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  gamename_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  gameversion_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  timestamp_ = nullptr;
+inline void GameEnum::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.values_){arena}
+    , decltype(_impl_.enumname_){}
+    , decltype(_impl_.isbitfield_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.enumname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.enumname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-GameInfo::~GameInfo() {
-  // @@protoc_insertion_point(destructor:Analytics.GameInfo)
+GameEnum::~GameEnum() {
+  // @@protoc_insertion_point(destructor:Analytics.GameEnum)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameInfo::SharedDtor() {
-  mapname_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  gamename_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  gameversion_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete timestamp_;
+inline void GameEnum::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.values_.~RepeatedPtrField();
+  _impl_.enumname_.Destroy();
 }
 
-void GameInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const GameInfo& GameInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameInfo_analytics_2eproto.base);
-  return *internal_default_instance();
+void GameEnum::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void GameInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.GameInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void GameEnum::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.GameEnum)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  mapname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  gamename_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  gameversion_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && timestamp_ != nullptr) {
-    delete timestamp_;
-  }
-  timestamp_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.values_.Clear();
+  _impl_.enumname_.ClearToEmpty();
+  _impl_.isbitfield_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameEnum::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .Analytics.UTCTime timeStamp = 1;
+      // repeated .Analytics.GameEnum.EnumPair values = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_timestamp(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_values(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      // string mapName = 2;
+      // string enumname = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_mapname();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameInfo.mapName"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_enumname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameEnum.enumname"));
+        } else
+          goto handle_unusual;
         continue;
-      // string gameName = 3;
+      // bool isbitfield = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          auto str = _internal_mutable_gamename();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameInfo.gameName"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string gameVersion = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          auto str = _internal_mutable_gameversion();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameInfo.gameVersion"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.isbitfield_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameInfo::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* GameEnum::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameEnum)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .Analytics.UTCTime timeStamp = 1;
-  if (this->has_timestamp()) {
-    target = stream->EnsureSpace(target);
+  // repeated .Analytics.GameEnum.EnumPair values = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_values_size()); i < n; i++) {
+    const auto& repfield = this->_internal_values(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::timestamp(this), target, stream);
-  }
-
-  // string mapName = 2;
-  if (this->mapname().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_mapname().data(), static_cast<int>(this->_internal_mapname().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Analytics.GameInfo.mapName");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_mapname(), target);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // string gameName = 3;
-  if (this->gamename().size() > 0) {
+  // string enumname = 2;
+  if (!this->_internal_enumname().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_gamename().data(), static_cast<int>(this->_internal_gamename().length()),
+      this->_internal_enumname().data(), static_cast<int>(this->_internal_enumname().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Analytics.GameInfo.gameName");
+      "Analytics.GameEnum.enumname");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_gamename(), target);
+        2, this->_internal_enumname(), target);
   }
 
-  // string gameVersion = 4;
-  if (this->gameversion().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_gameversion().data(), static_cast<int>(this->_internal_gameversion().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Analytics.GameInfo.gameVersion");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_gameversion(), target);
+  // bool isbitfield = 3;
+  if (this->_internal_isbitfield() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_isbitfield(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameEnum)
   return target;
 }
 
-size_t GameInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.GameInfo)
+size_t GameEnum::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.GameEnum)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string mapName = 2;
-  if (this->mapname().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_mapname());
-  }
-
-  // string gameName = 3;
-  if (this->gamename().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_gamename());
+  // repeated .Analytics.GameEnum.EnumPair values = 1;
+  total_size += 1UL * this->_internal_values_size();
+  for (const auto& msg : this->_impl_.values_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // string gameVersion = 4;
-  if (this->gameversion().size() > 0) {
+  // string enumname = 2;
+  if (!this->_internal_enumname().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_gameversion());
-  }
-
-  // .Analytics.UTCTime timeStamp = 1;
-  if (this->has_timestamp()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *timestamp_);
+        this->_internal_enumname());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // bool isbitfield = 3;
+  if (this->_internal_isbitfield() != 0) {
+    total_size += 1 + 1;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameInfo)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameInfo::MergeFrom(const GameInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.mapname().size() > 0) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameEnum::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameEnum::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameEnum::GetClassData() const { return &_class_data_; }
 
-    mapname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.mapname_);
-  }
-  if (from.gamename().size() > 0) {
 
-    gamename_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.gamename_);
-  }
-  if (from.gameversion().size() > 0) {
+void GameEnum::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameEnum*>(&to_msg);
+  auto& from = static_cast<const GameEnum&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameEnum)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    gameversion_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.gameversion_);
+  _this->_impl_.values_.MergeFrom(from._impl_.values_);
+  if (!from._internal_enumname().empty()) {
+    _this->_internal_set_enumname(from._internal_enumname());
   }
-  if (from.has_timestamp()) {
-    _internal_mutable_timestamp()->::Analytics::UTCTime::MergeFrom(from._internal_timestamp());
+  if (from._internal_isbitfield() != 0) {
+    _this->_internal_set_isbitfield(from._internal_isbitfield());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GameInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void GameInfo::CopyFrom(const GameInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.GameInfo)
+void GameEnum::CopyFrom(const GameEnum& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.GameEnum)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GameInfo::IsInitialized() const {
+bool GameEnum::IsInitialized() const {
   return true;
 }
 
-void GameInfo::InternalSwap(GameInfo* other) {
+void GameEnum::InternalSwap(GameEnum* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  mapname_.Swap(&other->mapname_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  gamename_.Swap(&other->gamename_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  gameversion_.Swap(&other->gameversion_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(timestamp_, other->timestamp_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.values_.InternalSwap(&other->_impl_.values_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.enumname_, lhs_arena,
+      &other->_impl_.enumname_, rhs_arena
+  );
+  swap(_impl_.isbitfield_, other->_impl_.isbitfield_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GameInfo::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata GameEnum::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[18]);
 }
 
-
 // ===================================================================
 
-void GameEnum_EnumPair::InitAsDefaultInstance() {
-}
-class GameEnum_EnumPair::_Internal {
+class GameString::_Internal {
  public:
 };
 
-GameEnum_EnumPair::GameEnum_EnumPair()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameEnum.EnumPair)
-}
-GameEnum_EnumPair::GameEnum_EnumPair(const GameEnum_EnumPair& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_name().empty()) {
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
+GameString::GameString(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameString)
+}
+GameString::GameString(const GameString& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameString* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:Analytics.GameString)
+}
+
+inline void GameString::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GameString::~GameString() {
+  // @@protoc_insertion_point(destructor:Analytics.GameString)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  value_ = from.value_;
-  // @@protoc_insertion_point(copy_constructor:Analytics.GameEnum.EnumPair)
-}
-
-void GameEnum_EnumPair::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameEnum_EnumPair_analytics_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_ = PROTOBUF_LONGLONG(0);
-}
-
-GameEnum_EnumPair::~GameEnum_EnumPair() {
-  // @@protoc_insertion_point(destructor:Analytics.GameEnum.EnumPair)
   SharedDtor();
 }
 
-void GameEnum_EnumPair::SharedDtor() {
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameString::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
 }
 
-void GameEnum_EnumPair::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const GameEnum_EnumPair& GameEnum_EnumPair::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameEnum_EnumPair_analytics_2eproto.base);
-  return *internal_default_instance();
+void GameString::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void GameEnum_EnumPair::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.GameEnum.EnumPair)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void GameString::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.GameString)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_ = PROTOBUF_LONGLONG(0);
-  _internal_metadata_.Clear();
+  _impl_.value_.ClearToEmpty();
+  _impl_.id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameEnum_EnumPair::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameString::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string name = 1;
+      // uint32 id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameEnum.EnumPair.name"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int64 value = 2;
+      // string value = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameString.value"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameEnum_EnumPair::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameEnum.EnumPair)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* GameString::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameString)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Analytics.GameEnum.EnumPair.name");
+      "Analytics.GameString.value");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_name(), target);
-  }
-
-  // int64 value = 2;
-  if (this->value() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(2, this->_internal_value(), target);
+        2, this->_internal_value(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameEnum.EnumPair)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameString)
   return target;
 }
 
-size_t GameEnum_EnumPair::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.GameEnum.EnumPair)
+size_t GameString::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.GameString)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name());
-  }
-
-  // int64 value = 2;
-  if (this->value() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
         this->_internal_value());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameEnum_EnumPair::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameEnum.EnumPair)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameEnum_EnumPair* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameEnum_EnumPair>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameEnum.EnumPair)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameEnum.EnumPair)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameEnum_EnumPair::MergeFrom(const GameEnum_EnumPair& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameEnum.EnumPair)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameString::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameString::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameString::GetClassData() const { return &_class_data_; }
+
 
-  if (from.name().size() > 0) {
+void GameString::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameString*>(&to_msg);
+  auto& from = static_cast<const GameString&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameString)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
   }
-  if (from.value() != 0) {
-    _internal_set_value(from._internal_value());
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GameEnum_EnumPair::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameEnum.EnumPair)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void GameEnum_EnumPair::CopyFrom(const GameEnum_EnumPair& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.GameEnum.EnumPair)
+void GameString::CopyFrom(const GameString& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.GameString)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GameEnum_EnumPair::IsInitialized() const {
+bool GameString::IsInitialized() const {
   return true;
 }
 
-void GameEnum_EnumPair::InternalSwap(GameEnum_EnumPair* other) {
+void GameString::InternalSwap(GameString* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(value_, other->value_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.id_, other->_impl_.id_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GameEnum_EnumPair::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata GameString::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[19]);
 }
 
-
 // ===================================================================
 
-void GameEnum::InitAsDefaultInstance() {
-}
-class GameEnum::_Internal {
+class LiveHeatmap::_Internal {
  public:
+  static const ::Analytics::Vec3& worldmins(const LiveHeatmap* msg);
+  static const ::Analytics::Vec3& worldmaxs(const LiveHeatmap* msg);
 };
 
-GameEnum::GameEnum()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameEnum)
+const ::Analytics::Vec3&
+LiveHeatmap::_Internal::worldmins(const LiveHeatmap* msg) {
+  return *msg->_impl_.worldmins_;
 }
-GameEnum::GameEnum(const GameEnum& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      values_(from.values_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  enumname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_enumname().empty()) {
-    enumname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.enumname_);
+const ::Analytics::Vec3&
+LiveHeatmap::_Internal::worldmaxs(const LiveHeatmap* msg) {
+  return *msg->_impl_.worldmaxs_;
+}
+LiveHeatmap::LiveHeatmap(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.LiveHeatmap)
+}
+LiveHeatmap::LiveHeatmap(const LiveHeatmap& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LiveHeatmap* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.eventtype_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.values_){}
+    , decltype(_impl_.worldmins_){nullptr}
+    , decltype(_impl_.worldmaxs_){nullptr}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.maxvalue_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.eventtype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.eventtype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_eventtype().empty()) {
+    _this->_impl_.eventtype_.Set(from._internal_eventtype(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.values_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.values_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_values().empty()) {
+    _this->_impl_.values_.Set(from._internal_values(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_worldmins()) {
+    _this->_impl_.worldmins_ = new ::Analytics::Vec3(*from._impl_.worldmins_);
+  }
+  if (from._internal_has_worldmaxs()) {
+    _this->_impl_.worldmaxs_ = new ::Analytics::Vec3(*from._impl_.worldmaxs_);
+  }
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.maxvalue_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.maxvalue_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.LiveHeatmap)
+}
+
+inline void LiveHeatmap::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.eventtype_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.values_){}
+    , decltype(_impl_.worldmins_){nullptr}
+    , decltype(_impl_.worldmaxs_){nullptr}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.width_){0}
+    , decltype(_impl_.height_){0}
+    , decltype(_impl_.maxvalue_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.eventtype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.eventtype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.values_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.values_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LiveHeatmap::~LiveHeatmap() {
+  // @@protoc_insertion_point(destructor:Analytics.LiveHeatmap)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  isbitfield_ = from.isbitfield_;
-  // @@protoc_insertion_point(copy_constructor:Analytics.GameEnum)
-}
-
-void GameEnum::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameEnum_analytics_2eproto.base);
-  enumname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  isbitfield_ = false;
-}
-
-GameEnum::~GameEnum() {
-  // @@protoc_insertion_point(destructor:Analytics.GameEnum)
   SharedDtor();
 }
 
-void GameEnum::SharedDtor() {
-  enumname_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void LiveHeatmap::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.eventtype_.Destroy();
+  _impl_.key_.Destroy();
+  _impl_.values_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.worldmins_;
+  if (this != internal_default_instance()) delete _impl_.worldmaxs_;
 }
 
-void GameEnum::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void LiveHeatmap::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const GameEnum& GameEnum::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameEnum_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void GameEnum::Clear() {
-// @@protoc_insertion_point(message_clear_start:Analytics.GameEnum)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void LiveHeatmap::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.LiveHeatmap)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  values_.Clear();
-  enumname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  isbitfield_ = false;
-  _internal_metadata_.Clear();
+  _impl_.eventtype_.ClearToEmpty();
+  _impl_.key_.ClearToEmpty();
+  _impl_.values_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.worldmins_ != nullptr) {
+    delete _impl_.worldmins_;
+  }
+  _impl_.worldmins_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.worldmaxs_ != nullptr) {
+    delete _impl_.worldmaxs_;
+  }
+  _impl_.worldmaxs_ = nullptr;
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.maxvalue_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.maxvalue_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameEnum::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* LiveHeatmap::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .Analytics.GameEnum.EnumPair values = 1;
+      // string eventType = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_values(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_eventtype();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.LiveHeatmap.eventType"));
+        } else
+          goto handle_unusual;
         continue;
-      // string enumname = 2;
+      // string key = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_enumname();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameEnum.enumname"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.LiveHeatmap.key"));
+        } else
+          goto handle_unusual;
         continue;
-      // bool isbitfield = 3;
+      // int64 timeStamp = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          isbitfield_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // int32 width = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 height = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float maxValue = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _impl_.maxvalue_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Analytics.Vec3 worldMins = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_worldmins(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Analytics.Vec3 worldMaxs = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_worldmaxs(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes values = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_values();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameEnum::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameEnum)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* LiveHeatmap::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.LiveHeatmap)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .Analytics.GameEnum.EnumPair values = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_values_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_values(i), target, stream);
+  // string eventType = 1;
+  if (!this->_internal_eventtype().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_eventtype().data(), static_cast<int>(this->_internal_eventtype().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Analytics.LiveHeatmap.eventType");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_eventtype(), target);
   }
 
-  // string enumname = 2;
-  if (this->enumname().size() > 0) {
+  // string key = 2;
+  if (!this->_internal_key().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_enumname().data(), static_cast<int>(this->_internal_enumname().length()),
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Analytics.GameEnum.enumname");
+      "Analytics.LiveHeatmap.key");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_enumname(), target);
+        2, this->_internal_key(), target);
   }
 
-  // bool isbitfield = 3;
-  if (this->isbitfield() != 0) {
+  // int64 timeStamp = 3;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_timestamp(), target);
+  }
+
+  // int32 width = 4;
+  if (this->_internal_width() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->_internal_isbitfield(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_width(), target);
+  }
+
+  // int32 height = 5;
+  if (this->_internal_height() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_height(), target);
+  }
+
+  // float maxValue = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_maxvalue = this->_internal_maxvalue();
+  uint32_t raw_maxvalue;
+  memcpy(&raw_maxvalue, &tmp_maxvalue, sizeof(tmp_maxvalue));
+  if (raw_maxvalue != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_maxvalue(), target);
+  }
+
+  // .Analytics.Vec3 worldMins = 7;
+  if (this->_internal_has_worldmins()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::worldmins(this),
+        _Internal::worldmins(this).GetCachedSize(), target, stream);
+  }
+
+  // .Analytics.Vec3 worldMaxs = 8;
+  if (this->_internal_has_worldmaxs()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::worldmaxs(this),
+        _Internal::worldmaxs(this).GetCachedSize(), target, stream);
+  }
+
+  // bytes values = 9;
+  if (!this->_internal_values().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        9, this->_internal_values(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameEnum)
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.LiveHeatmap)
   return target;
 }
 
-size_t GameEnum::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Analytics.GameEnum)
+size_t LiveHeatmap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.LiveHeatmap)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .Analytics.GameEnum.EnumPair values = 1;
-  total_size += 1UL * this->_internal_values_size();
-  for (const auto& msg : this->values_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // string eventType = 1;
+  if (!this->_internal_eventtype().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_eventtype());
   }
 
-  // string enumname = 2;
-  if (this->enumname().size() > 0) {
+  // string key = 2;
+  if (!this->_internal_key().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_enumname());
+        this->_internal_key());
   }
 
-  // bool isbitfield = 3;
-  if (this->isbitfield() != 0) {
-    total_size += 1 + 1;
+  // bytes values = 9;
+  if (!this->_internal_values().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_values());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // .Analytics.Vec3 worldMins = 7;
+  if (this->_internal_has_worldmins()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.worldmins_);
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameEnum::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameEnum)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameEnum* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameEnum>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameEnum)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameEnum)
-    MergeFrom(*source);
+  // .Analytics.Vec3 worldMaxs = 8;
+  if (this->_internal_has_worldmaxs()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.worldmaxs_);
   }
-}
 
-void GameEnum::MergeFrom(const GameEnum& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameEnum)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // int64 timeStamp = 3;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  }
 
-  values_.MergeFrom(from.values_);
-  if (from.enumname().size() > 0) {
+  // int32 width = 4;
+  if (this->_internal_width() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_width());
+  }
 
-    enumname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.enumname_);
+  // int32 height = 5;
+  if (this->_internal_height() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_height());
   }
-  if (from.isbitfield() != 0) {
-    _internal_set_isbitfield(from._internal_isbitfield());
+
+  // float maxValue = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_maxvalue = this->_internal_maxvalue();
+  uint32_t raw_maxvalue;
+  memcpy(&raw_maxvalue, &tmp_maxvalue, sizeof(tmp_maxvalue));
+  if (raw_maxvalue != 0) {
+    total_size += 1 + 4;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameEnum::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameEnum)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LiveHeatmap::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LiveHeatmap::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LiveHeatmap::GetClassData() const { return &_class_data_; }
+
+
+void LiveHeatmap::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LiveHeatmap*>(&to_msg);
+  auto& from = static_cast<const LiveHeatmap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.LiveHeatmap)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_eventtype().empty()) {
+    _this->_internal_set_eventtype(from._internal_eventtype());
+  }
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_values().empty()) {
+    _this->_internal_set_values(from._internal_values());
+  }
+  if (from._internal_has_worldmins()) {
+    _this->_internal_mutable_worldmins()->::Analytics::Vec3::MergeFrom(
+        from._internal_worldmins());
+  }
+  if (from._internal_has_worldmaxs()) {
+    _this->_internal_mutable_worldmaxs()->::Analytics::Vec3::MergeFrom(
+        from._internal_worldmaxs());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_width() != 0) {
+    _this->_internal_set_width(from._internal_width());
+  }
+  if (from._internal_height() != 0) {
+    _this->_internal_set_height(from._internal_height());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_maxvalue = from._internal_maxvalue();
+  uint32_t raw_maxvalue;
+  memcpy(&raw_maxvalue, &tmp_maxvalue, sizeof(tmp_maxvalue));
+  if (raw_maxvalue != 0) {
+    _this->_internal_set_maxvalue(from._internal_maxvalue());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GameEnum::CopyFrom(const GameEnum& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.GameEnum)
+void LiveHeatmap::CopyFrom(const LiveHeatmap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.LiveHeatmap)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GameEnum::IsInitialized() const {
+bool LiveHeatmap::IsInitialized() const {
   return true;
 }
 
-void GameEnum::InternalSwap(GameEnum* other) {
+void LiveHeatmap::InternalSwap(LiveHeatmap* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  values_.InternalSwap(&other->values_);
-  enumname_.Swap(&other->enumname_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(isbitfield_, other->isbitfield_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.eventtype_, lhs_arena,
+      &other->_impl_.eventtype_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.values_, lhs_arena,
+      &other->_impl_.values_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LiveHeatmap, _impl_.maxvalue_)
+      + sizeof(LiveHeatmap::_impl_.maxvalue_)
+      - PROTOBUF_FIELD_OFFSET(LiveHeatmap, _impl_.worldmins_)>(
+          reinterpret_cast<char*>(&_impl_.worldmins_),
+          reinterpret_cast<char*>(&other->_impl_.worldmins_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LiveHeatmap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[20]);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GameEnum::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
 // ===================================================================
 
-void GameNavNotFound::InitAsDefaultInstance() {
-}
 class GameNavNotFound::_Internal {
  public:
 };
 
-GameNavNotFound::GameNavNotFound()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameNavNotFound)
+GameNavNotFound::GameNavNotFound(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameNavNotFound)
 }
 GameNavNotFound::GameNavNotFound(const GameNavNotFound& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  mapname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameNavNotFound* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mapname_){}
+    , decltype(_impl_.mapnameid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.mapname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mapname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_mapname().empty()) {
-    mapname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.mapname_);
+    _this->_impl_.mapname_.Set(from._internal_mapname(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.mapnameid_ = from._impl_.mapnameid_;
   // @@protoc_insertion_point(copy_constructor:Analytics.GameNavNotFound)
 }
 
-void GameNavNotFound::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameNavNotFound_analytics_2eproto.base);
-  mapname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameNavNotFound::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mapname_){}
+    , decltype(_impl_.mapnameid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.mapname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mapname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameNavNotFound::~GameNavNotFound() {
   // @@protoc_insertion_point(destructor:Analytics.GameNavNotFound)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameNavNotFound::SharedDtor() {
-  mapname_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameNavNotFound::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.mapname_.Destroy();
 }
 
 void GameNavNotFound::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameNavNotFound& GameNavNotFound::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameNavNotFound_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameNavNotFound::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameNavNotFound)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  mapname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.mapname_.ClearToEmpty();
+  _impl_.mapnameid_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameNavNotFound::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameNavNotFound::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string mapName = 1;
+      // string mapName = 1 [(.Analytics.intern) = "mapNameId"];
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_mapname();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameNavNotFound.mapName"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameNavNotFound.mapName"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 mapNameId = 2 [(.Analytics.hidden) = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.mapnameid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameNavNotFound::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameNavNotFound::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameNavNotFound)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string mapName = 1;
-  if (this->mapname().size() > 0) {
+  // string mapName = 1 [(.Analytics.intern) = "mapNameId"];
+  if (!this->_internal_mapname().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_mapname().data(), static_cast<int>(this->_internal_mapname().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -6283,9 +7573,15 @@ failure:
         1, this->_internal_mapname(), target);
   }
 
+  // uint32 mapNameId = 2 [(.Analytics.hidden) = true];
+  if (this->_internal_mapnameid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_mapnameid(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameNavNotFound)
   return target;
@@ -6295,59 +7591,47 @@ size_t GameNavNotFound::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameNavNotFound)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string mapName = 1;
-  if (this->mapname().size() > 0) {
+  // string mapName = 1 [(.Analytics.intern) = "mapNameId"];
+  if (!this->_internal_mapname().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_mapname());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 mapNameId = 2 [(.Analytics.hidden) = true];
+  if (this->_internal_mapnameid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_mapnameid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameNavNotFound::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameNavNotFound)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameNavNotFound* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameNavNotFound>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameNavNotFound)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameNavNotFound)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameNavNotFound::MergeFrom(const GameNavNotFound& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameNavNotFound)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameNavNotFound::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameNavNotFound::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameNavNotFound::GetClassData() const { return &_class_data_; }
 
-  if (from.mapname().size() > 0) {
 
-    mapname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.mapname_);
-  }
-}
+void GameNavNotFound::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameNavNotFound*>(&to_msg);
+  auto& from = static_cast<const GameNavNotFound&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameNavNotFound)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void GameNavNotFound::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameNavNotFound)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_mapname().empty()) {
+    _this->_internal_set_mapname(from._internal_mapname());
+  }
+  if (from._internal_mapnameid() != 0) {
+    _this->_internal_set_mapnameid(from._internal_mapnameid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameNavNotFound::CopyFrom(const GameNavNotFound& from) {
@@ -6363,117 +7647,154 @@ bool GameNavNotFound::IsInitialized() const {
 
 void GameNavNotFound::InternalSwap(GameNavNotFound* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  mapname_.Swap(&other->mapname_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mapname_, lhs_arena,
+      &other->_impl_.mapname_, rhs_arena
+  );
+  swap(_impl_.mapnameid_, other->_impl_.mapnameid_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameNavNotFound::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[21]);
 }
 
-
 // ===================================================================
 
-void GameNavAutoDownloaded::InitAsDefaultInstance() {
-}
 class GameNavAutoDownloaded::_Internal {
  public:
 };
 
-GameNavAutoDownloaded::GameNavAutoDownloaded()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameNavAutoDownloaded)
+GameNavAutoDownloaded::GameNavAutoDownloaded(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameNavAutoDownloaded)
 }
 GameNavAutoDownloaded::GameNavAutoDownloaded(const GameNavAutoDownloaded& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  mapname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameNavAutoDownloaded* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mapname_){}
+    , decltype(_impl_.mapnameid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.mapname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mapname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_mapname().empty()) {
-    mapname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.mapname_);
+    _this->_impl_.mapname_.Set(from._internal_mapname(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.mapnameid_ = from._impl_.mapnameid_;
   // @@protoc_insertion_point(copy_constructor:Analytics.GameNavAutoDownloaded)
 }
 
-void GameNavAutoDownloaded::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameNavAutoDownloaded_analytics_2eproto.base);
-  mapname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameNavAutoDownloaded::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mapname_){}
+    , decltype(_impl_.mapnameid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.mapname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mapname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameNavAutoDownloaded::~GameNavAutoDownloaded() {
   // @@protoc_insertion_point(destructor:Analytics.GameNavAutoDownloaded)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameNavAutoDownloaded::SharedDtor() {
-  mapname_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameNavAutoDownloaded::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.mapname_.Destroy();
 }
 
 void GameNavAutoDownloaded::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameNavAutoDownloaded& GameNavAutoDownloaded::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameNavAutoDownloaded_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameNavAutoDownloaded::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameNavAutoDownloaded)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  mapname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.mapname_.ClearToEmpty();
+  _impl_.mapnameid_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameNavAutoDownloaded::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameNavAutoDownloaded::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string mapName = 1;
+      // string mapName = 1 [(.Analytics.intern) = "mapNameId"];
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_mapname();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameNavAutoDownloaded.mapName"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameNavAutoDownloaded.mapName"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 mapNameId = 2 [(.Analytics.hidden) = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.mapnameid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameNavAutoDownloaded::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameNavAutoDownloaded::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameNavAutoDownloaded)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string mapName = 1;
-  if (this->mapname().size() > 0) {
+  // string mapName = 1 [(.Analytics.intern) = "mapNameId"];
+  if (!this->_internal_mapname().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_mapname().data(), static_cast<int>(this->_internal_mapname().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -6482,9 +7803,15 @@ failure:
         1, this->_internal_mapname(), target);
   }
 
+  // uint32 mapNameId = 2 [(.Analytics.hidden) = true];
+  if (this->_internal_mapnameid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_mapnameid(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameNavAutoDownloaded)
   return target;
@@ -6494,59 +7821,47 @@ size_t GameNavAutoDownloaded::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameNavAutoDownloaded)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string mapName = 1;
-  if (this->mapname().size() > 0) {
+  // string mapName = 1 [(.Analytics.intern) = "mapNameId"];
+  if (!this->_internal_mapname().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_mapname());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 mapNameId = 2 [(.Analytics.hidden) = true];
+  if (this->_internal_mapnameid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_mapnameid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameNavAutoDownloaded::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameNavAutoDownloaded)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameNavAutoDownloaded* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameNavAutoDownloaded>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameNavAutoDownloaded)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameNavAutoDownloaded)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameNavAutoDownloaded::MergeFrom(const GameNavAutoDownloaded& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameNavAutoDownloaded)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameNavAutoDownloaded::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameNavAutoDownloaded::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameNavAutoDownloaded::GetClassData() const { return &_class_data_; }
 
-  if (from.mapname().size() > 0) {
 
-    mapname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.mapname_);
-  }
-}
+void GameNavAutoDownloaded::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameNavAutoDownloaded*>(&to_msg);
+  auto& from = static_cast<const GameNavAutoDownloaded&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameNavAutoDownloaded)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void GameNavAutoDownloaded::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameNavAutoDownloaded)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_mapname().empty()) {
+    _this->_internal_set_mapname(from._internal_mapname());
+  }
+  if (from._internal_mapnameid() != 0) {
+    _this->_internal_set_mapnameid(from._internal_mapnameid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameNavAutoDownloaded::CopyFrom(const GameNavAutoDownloaded& from) {
@@ -6562,143 +7877,180 @@ bool GameNavAutoDownloaded::IsInitialized() const {
 
 void GameNavAutoDownloaded::InternalSwap(GameNavAutoDownloaded* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  mapname_.Swap(&other->mapname_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mapname_, lhs_arena,
+      &other->_impl_.mapname_, rhs_arena
+  );
+  swap(_impl_.mapnameid_, other->_impl_.mapnameid_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameNavAutoDownloaded::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[22]);
 }
 
-
 // ===================================================================
 
-void GameAssert::InitAsDefaultInstance() {
-}
 class GameAssert::_Internal {
  public:
 };
 
-GameAssert::GameAssert()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameAssert)
+GameAssert::GameAssert(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameAssert)
 }
 GameAssert::GameAssert(const GameAssert& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  condition_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameAssert* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.condition_){}
+    , decltype(_impl_.file_){}
+    , decltype(_impl_.line_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.condition_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.condition_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_condition().empty()) {
-    condition_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.condition_);
+    _this->_impl_.condition_.Set(from._internal_condition(), 
+      _this->GetArenaForAllocation());
   }
-  file_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_file().empty()) {
-    file_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.file_);
+    _this->_impl_.file_.Set(from._internal_file(), 
+      _this->GetArenaForAllocation());
   }
-  line_ = from.line_;
+  _this->_impl_.line_ = from._impl_.line_;
   // @@protoc_insertion_point(copy_constructor:Analytics.GameAssert)
 }
 
-void GameAssert::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameAssert_analytics_2eproto.base);
-  condition_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  file_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  line_ = 0;
+inline void GameAssert::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.condition_){}
+    , decltype(_impl_.file_){}
+    , decltype(_impl_.line_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.condition_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.condition_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameAssert::~GameAssert() {
   // @@protoc_insertion_point(destructor:Analytics.GameAssert)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameAssert::SharedDtor() {
-  condition_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  file_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameAssert::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.condition_.Destroy();
+  _impl_.file_.Destroy();
 }
 
 void GameAssert::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameAssert& GameAssert::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameAssert_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameAssert::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameAssert)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  condition_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  file_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  line_ = 0;
-  _internal_metadata_.Clear();
+  _impl_.condition_.ClearToEmpty();
+  _impl_.file_.ClearToEmpty();
+  _impl_.line_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameAssert::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameAssert::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string condition = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_condition();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameAssert.condition"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameAssert.condition"));
+        } else
+          goto handle_unusual;
         continue;
       // string file = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_file();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameAssert.file"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameAssert.file"));
+        } else
+          goto handle_unusual;
         continue;
       // int32 line = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          line_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.line_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameAssert::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameAssert::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameAssert)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string condition = 1;
-  if (this->condition().size() > 0) {
+  if (!this->_internal_condition().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_condition().data(), static_cast<int>(this->_internal_condition().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -6708,7 +8060,7 @@ failure:
   }
 
   // string file = 2;
-  if (this->file().size() > 0) {
+  if (!this->_internal_file().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_file().data(), static_cast<int>(this->_internal_file().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -6718,14 +8070,14 @@ failure:
   }
 
   // int32 line = 3;
-  if (this->line() != 0) {
+  if (this->_internal_line() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_line(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_line(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameAssert)
   return target;
@@ -6735,80 +8087,57 @@ size_t GameAssert::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameAssert)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string condition = 1;
-  if (this->condition().size() > 0) {
+  if (!this->_internal_condition().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_condition());
   }
 
   // string file = 2;
-  if (this->file().size() > 0) {
+  if (!this->_internal_file().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_file());
   }
 
   // int32 line = 3;
-  if (this->line() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_line());
+  if (this->_internal_line() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_line());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameAssert::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameAssert)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameAssert* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameAssert>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameAssert)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameAssert)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameAssert::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameAssert::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameAssert::GetClassData() const { return &_class_data_; }
 
-void GameAssert::MergeFrom(const GameAssert& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameAssert)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.condition().size() > 0) {
+void GameAssert::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameAssert*>(&to_msg);
+  auto& from = static_cast<const GameAssert&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameAssert)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    condition_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.condition_);
+  if (!from._internal_condition().empty()) {
+    _this->_internal_set_condition(from._internal_condition());
   }
-  if (from.file().size() > 0) {
-
-    file_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.file_);
+  if (!from._internal_file().empty()) {
+    _this->_internal_set_file(from._internal_file());
   }
-  if (from.line() != 0) {
-    _internal_set_line(from._internal_line());
+  if (from._internal_line() != 0) {
+    _this->_internal_set_line(from._internal_line());
   }
-}
-
-void GameAssert::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameAssert)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameAssert::CopyFrom(const GameAssert& from) {
@@ -6824,120 +8153,146 @@ bool GameAssert::IsInitialized() const {
 
 void GameAssert::InternalSwap(GameAssert* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  condition_.Swap(&other->condition_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  file_.Swap(&other->file_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(line_, other->line_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.condition_, lhs_arena,
+      &other->_impl_.condition_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_, lhs_arena,
+      &other->_impl_.file_, rhs_arena
+  );
+  swap(_impl_.line_, other->_impl_.line_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameAssert::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[23]);
 }
 
-
 // ===================================================================
 
-void GameCrash::InitAsDefaultInstance() {
-}
 class GameCrash::_Internal {
  public:
 };
 
-GameCrash::GameCrash()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameCrash)
+GameCrash::GameCrash(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameCrash)
 }
 GameCrash::GameCrash(const GameCrash& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  info_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameCrash* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.info_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.info_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.info_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_info().empty()) {
-    info_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.info_);
+    _this->_impl_.info_.Set(from._internal_info(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:Analytics.GameCrash)
 }
 
-void GameCrash::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameCrash_analytics_2eproto.base);
-  info_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameCrash::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.info_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.info_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.info_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameCrash::~GameCrash() {
   // @@protoc_insertion_point(destructor:Analytics.GameCrash)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameCrash::SharedDtor() {
-  info_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameCrash::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.info_.Destroy();
 }
 
 void GameCrash::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameCrash& GameCrash::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameCrash_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameCrash::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameCrash)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  info_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.info_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameCrash::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameCrash::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string info = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_info();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameCrash.info"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameCrash.info"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameCrash::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameCrash::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameCrash)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string info = 1;
-  if (this->info().size() > 0) {
+  if (!this->_internal_info().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_info().data(), static_cast<int>(this->_internal_info().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -6947,8 +8302,8 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameCrash)
   return target;
@@ -6958,59 +8313,39 @@ size_t GameCrash::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameCrash)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string info = 1;
-  if (this->info().size() > 0) {
+  if (!this->_internal_info().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_info());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameCrash::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameCrash)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameCrash* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameCrash>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameCrash)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameCrash)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameCrash::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameCrash::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameCrash::GetClassData() const { return &_class_data_; }
 
-void GameCrash::MergeFrom(const GameCrash& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameCrash)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.info().size() > 0) {
+void GameCrash::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameCrash*>(&to_msg);
+  auto& from = static_cast<const GameCrash&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameCrash)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    info_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.info_);
+  if (!from._internal_info().empty()) {
+    _this->_internal_set_info(from._internal_info());
   }
-}
-
-void GameCrash::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameCrash)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameCrash::CopyFrom(const GameCrash& from) {
@@ -7026,163 +8361,200 @@ bool GameCrash::IsInitialized() const {
 
 void GameCrash::InternalSwap(GameCrash* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  info_.Swap(&other->info_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.info_, lhs_arena,
+      &other->_impl_.info_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameCrash::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[24]);
 }
 
-
 // ===================================================================
 
-void GameMeshData::InitAsDefaultInstance() {
-}
 class GameMeshData::_Internal {
  public:
 };
 
-GameMeshData::GameMeshData()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameMeshData)
+GameMeshData::GameMeshData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameMeshData)
 }
 GameMeshData::GameMeshData(const GameMeshData& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  modelname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameMeshData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.modelname_){}
+    , decltype(_impl_.modelbytes_){}
+    , decltype(_impl_.compressiontype_){}
+    , decltype(_impl_.modelbytesuncompressed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.modelname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.modelname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_modelname().empty()) {
-    modelname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.modelname_);
+    _this->_impl_.modelname_.Set(from._internal_modelname(), 
+      _this->GetArenaForAllocation());
   }
-  modelbytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.modelbytes_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.modelbytes_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_modelbytes().empty()) {
-    modelbytes_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.modelbytes_);
+    _this->_impl_.modelbytes_.Set(from._internal_modelbytes(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&compressiontype_, &from.compressiontype_,
-    static_cast<size_t>(reinterpret_cast<char*>(&modelbytesuncompressed_) -
-    reinterpret_cast<char*>(&compressiontype_)) + sizeof(modelbytesuncompressed_));
+  ::memcpy(&_impl_.compressiontype_, &from._impl_.compressiontype_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.modelbytesuncompressed_) -
+    reinterpret_cast<char*>(&_impl_.compressiontype_)) + sizeof(_impl_.modelbytesuncompressed_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameMeshData)
 }
 
-void GameMeshData::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameMeshData_analytics_2eproto.base);
-  modelname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  modelbytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&compressiontype_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&modelbytesuncompressed_) -
-      reinterpret_cast<char*>(&compressiontype_)) + sizeof(modelbytesuncompressed_));
+inline void GameMeshData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.modelname_){}
+    , decltype(_impl_.modelbytes_){}
+    , decltype(_impl_.compressiontype_){0}
+    , decltype(_impl_.modelbytesuncompressed_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.modelname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.modelname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.modelbytes_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.modelbytes_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameMeshData::~GameMeshData() {
   // @@protoc_insertion_point(destructor:Analytics.GameMeshData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameMeshData::SharedDtor() {
-  modelname_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  modelbytes_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameMeshData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.modelname_.Destroy();
+  _impl_.modelbytes_.Destroy();
 }
 
 void GameMeshData::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const GameMeshData& GameMeshData::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameMeshData_analytics_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void GameMeshData::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameMeshData)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  modelname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  modelbytes_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&compressiontype_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&modelbytesuncompressed_) -
-      reinterpret_cast<char*>(&compressiontype_)) + sizeof(modelbytesuncompressed_));
-  _internal_metadata_.Clear();
+  _impl_.modelname_.ClearToEmpty();
+  _impl_.modelbytes_.ClearToEmpty();
+  ::memset(&_impl_.compressiontype_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.modelbytesuncompressed_) -
+      reinterpret_cast<char*>(&_impl_.compressiontype_)) + sizeof(_impl_.modelbytesuncompressed_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameMeshData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameMeshData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .Analytics.Compression compressionType = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_compressiontype(static_cast<::Analytics::Compression>(val));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string modelName = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_modelname();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameMeshData.modelName"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameMeshData.modelName"));
+        } else
+          goto handle_unusual;
         continue;
       // bytes modelBytes = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_modelbytes();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 modelBytesUncompressed = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          modelbytesuncompressed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.modelbytesuncompressed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameMeshData::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameMeshData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameMeshData)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .Analytics.Compression compressionType = 1;
-  if (this->compressiontype() != 0) {
+  if (this->_internal_compressiontype() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_compressiontype(), target);
   }
 
   // string modelName = 2;
-  if (this->modelname().size() > 0) {
+  if (!this->_internal_modelname().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_modelname().data(), static_cast<int>(this->_internal_modelname().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -7192,20 +8564,20 @@ failure:
   }
 
   // bytes modelBytes = 3;
-  if (this->modelbytes().size() > 0) {
+  if (!this->_internal_modelbytes().empty()) {
     target = stream->WriteBytesMaybeAliased(
         3, this->_internal_modelbytes(), target);
   }
 
   // uint32 modelBytesUncompressed = 4;
-  if (this->modelbytesuncompressed() != 0) {
+  if (this->_internal_modelbytesuncompressed() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_modelbytesuncompressed(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_modelbytesuncompressed(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameMeshData)
   return target;
@@ -7215,89 +8587,66 @@ size_t GameMeshData::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameMeshData)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string modelName = 2;
-  if (this->modelname().size() > 0) {
+  if (!this->_internal_modelname().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_modelname());
   }
 
   // bytes modelBytes = 3;
-  if (this->modelbytes().size() > 0) {
+  if (!this->_internal_modelbytes().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_modelbytes());
   }
 
   // .Analytics.Compression compressionType = 1;
-  if (this->compressiontype() != 0) {
+  if (this->_internal_compressiontype() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_compressiontype());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compressiontype());
   }
 
   // uint32 modelBytesUncompressed = 4;
-  if (this->modelbytesuncompressed() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_modelbytesuncompressed());
+  if (this->_internal_modelbytesuncompressed() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_modelbytesuncompressed());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameMeshData::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameMeshData)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameMeshData* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameMeshData>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameMeshData)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameMeshData)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameMeshData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameMeshData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameMeshData::GetClassData() const { return &_class_data_; }
 
-void GameMeshData::MergeFrom(const GameMeshData& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameMeshData)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.modelname().size() > 0) {
+void GameMeshData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameMeshData*>(&to_msg);
+  auto& from = static_cast<const GameMeshData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameMeshData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    modelname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.modelname_);
+  if (!from._internal_modelname().empty()) {
+    _this->_internal_set_modelname(from._internal_modelname());
   }
-  if (from.modelbytes().size() > 0) {
-
-    modelbytes_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.modelbytes_);
+  if (!from._internal_modelbytes().empty()) {
+    _this->_internal_set_modelbytes(from._internal_modelbytes());
   }
-  if (from.compressiontype() != 0) {
-    _internal_set_compressiontype(from._internal_compressiontype());
+  if (from._internal_compressiontype() != 0) {
+    _this->_internal_set_compressiontype(from._internal_compressiontype());
   }
-  if (from.modelbytesuncompressed() != 0) {
-    _internal_set_modelbytesuncompressed(from._internal_modelbytesuncompressed());
+  if (from._internal_modelbytesuncompressed() != 0) {
+    _this->_internal_set_modelbytesuncompressed(from._internal_modelbytesuncompressed());
   }
-}
-
-void GameMeshData::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameMeshData)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameMeshData::CopyFrom(const GameMeshData& from) {
@@ -7313,140 +8662,164 @@ bool GameMeshData::IsInitialized() const {
 
 void GameMeshData::InternalSwap(GameMeshData* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  modelname_.Swap(&other->modelname_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  modelbytes_.Swap(&other->modelbytes_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(compressiontype_, other->compressiontype_);
-  swap(modelbytesuncompressed_, other->modelbytesuncompressed_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.modelname_, lhs_arena,
+      &other->_impl_.modelname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.modelbytes_, lhs_arena,
+      &other->_impl_.modelbytes_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameMeshData, _impl_.modelbytesuncompressed_)
+      + sizeof(GameMeshData::_impl_.modelbytesuncompressed_)
+      - PROTOBUF_FIELD_OFFSET(GameMeshData, _impl_.compressiontype_)>(
+          reinterpret_cast<char*>(&_impl_.compressiontype_),
+          reinterpret_cast<char*>(&other->_impl_.compressiontype_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameMeshData::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[25]);
 }
 
-
 // ===================================================================
 
-void GameEntityInfo_Ammo::InitAsDefaultInstance() {
-}
 class GameEntityInfo_Ammo::_Internal {
  public:
 };
 
-GameEntityInfo_Ammo::GameEntityInfo_Ammo()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameEntityInfo.Ammo)
+GameEntityInfo_Ammo::GameEntityInfo_Ammo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameEntityInfo.Ammo)
 }
 GameEntityInfo_Ammo::GameEntityInfo_Ammo(const GameEntityInfo_Ammo& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&ammotype_, &from.ammotype_,
-    static_cast<size_t>(reinterpret_cast<char*>(&ammocount_) -
-    reinterpret_cast<char*>(&ammotype_)) + sizeof(ammocount_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameEntityInfo_Ammo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ammotype_){}
+    , decltype(_impl_.ammocount_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ammotype_, &from._impl_.ammotype_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ammocount_) -
+    reinterpret_cast<char*>(&_impl_.ammotype_)) + sizeof(_impl_.ammocount_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameEntityInfo.Ammo)
 }
 
-void GameEntityInfo_Ammo::SharedCtor() {
-  ::memset(&ammotype_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&ammocount_) -
-      reinterpret_cast<char*>(&ammotype_)) + sizeof(ammocount_));
+inline void GameEntityInfo_Ammo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ammotype_){0u}
+    , decltype(_impl_.ammocount_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 GameEntityInfo_Ammo::~GameEntityInfo_Ammo() {
   // @@protoc_insertion_point(destructor:Analytics.GameEntityInfo.Ammo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameEntityInfo_Ammo::SharedDtor() {
+inline void GameEntityInfo_Ammo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void GameEntityInfo_Ammo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const GameEntityInfo_Ammo& GameEntityInfo_Ammo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameEntityInfo_Ammo_analytics_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void GameEntityInfo_Ammo::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameEntityInfo.Ammo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&ammotype_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&ammocount_) -
-      reinterpret_cast<char*>(&ammotype_)) + sizeof(ammocount_));
-  _internal_metadata_.Clear();
+  ::memset(&_impl_.ammotype_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ammocount_) -
+      reinterpret_cast<char*>(&_impl_.ammotype_)) + sizeof(_impl_.ammocount_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameEntityInfo_Ammo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameEntityInfo_Ammo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // uint32 ammoType = 1 [(.Analytics.enumkey) = "AMMO_TYPE"];
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ammotype_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ammotype_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 ammoCount = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ammocount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.ammocount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameEntityInfo_Ammo::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameEntityInfo_Ammo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameEntityInfo.Ammo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 ammoType = 1 [(.Analytics.enumkey) = "AMMO_TYPE"];
-  if (this->ammotype() != 0) {
+  if (this->_internal_ammotype() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_ammotype(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_ammotype(), target);
   }
 
   // uint32 ammoCount = 2;
-  if (this->ammocount() != 0) {
+  if (this->_internal_ammocount() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_ammocount(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_ammocount(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameEntityInfo.Ammo)
   return target;
@@ -7456,68 +8829,45 @@ size_t GameEntityInfo_Ammo::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameEntityInfo.Ammo)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // uint32 ammoType = 1 [(.Analytics.enumkey) = "AMMO_TYPE"];
-  if (this->ammotype() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_ammotype());
-  }
-
-  // uint32 ammoCount = 2;
-  if (this->ammocount() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_ammocount());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  if (this->_internal_ammotype() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ammotype());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameEntityInfo_Ammo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameEntityInfo.Ammo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameEntityInfo_Ammo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameEntityInfo_Ammo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameEntityInfo.Ammo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameEntityInfo.Ammo)
-    MergeFrom(*source);
+  // uint32 ammoCount = 2;
+  if (this->_internal_ammocount() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ammocount());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameEntityInfo_Ammo::MergeFrom(const GameEntityInfo_Ammo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameEntityInfo.Ammo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameEntityInfo_Ammo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameEntityInfo_Ammo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameEntityInfo_Ammo::GetClassData() const { return &_class_data_; }
+
+
+void GameEntityInfo_Ammo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameEntityInfo_Ammo*>(&to_msg);
+  auto& from = static_cast<const GameEntityInfo_Ammo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameEntityInfo.Ammo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.ammotype() != 0) {
-    _internal_set_ammotype(from._internal_ammotype());
+  if (from._internal_ammotype() != 0) {
+    _this->_internal_set_ammotype(from._internal_ammotype());
   }
-  if (from.ammocount() != 0) {
-    _internal_set_ammocount(from._internal_ammocount());
+  if (from._internal_ammocount() != 0) {
+    _this->_internal_set_ammocount(from._internal_ammocount());
   }
-}
-
-void GameEntityInfo_Ammo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameEntityInfo.Ammo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameEntityInfo_Ammo::CopyFrom(const GameEntityInfo_Ammo& from) {
@@ -7533,36 +8883,23 @@ bool GameEntityInfo_Ammo::IsInitialized() const {
 
 void GameEntityInfo_Ammo::InternalSwap(GameEntityInfo_Ammo* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(ammotype_, other->ammotype_);
-  swap(ammocount_, other->ammocount_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameEntityInfo_Ammo, _impl_.ammocount_)
+      + sizeof(GameEntityInfo_Ammo::_impl_.ammocount_)
+      - PROTOBUF_FIELD_OFFSET(GameEntityInfo_Ammo, _impl_.ammotype_)>(
+          reinterpret_cast<char*>(&_impl_.ammotype_),
+          reinterpret_cast<char*>(&other->_impl_.ammotype_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameEntityInfo_Ammo::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[26]);
 }
 
-
 // ===================================================================
 
-void GameEntityInfo::InitAsDefaultInstance() {
-  ::Analytics::_GameEntityInfo_default_instance_._instance.get_mutable()->eulerrotation_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-  ::Analytics::_GameEntityInfo_default_instance_._instance.get_mutable()->position_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-  ::Analytics::_GameEntityInfo_default_instance_._instance.get_mutable()->eyeoffset_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-  ::Analytics::_GameEntityInfo_default_instance_._instance.get_mutable()->eyedir_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-  ::Analytics::_GameEntityInfo_default_instance_._instance.get_mutable()->health_ = const_cast< ::Analytics::RangeI*>(
-      ::Analytics::RangeI::internal_default_instance());
-  ::Analytics::_GameEntityInfo_default_instance_._instance.get_mutable()->armor_ = const_cast< ::Analytics::RangeI*>(
-      ::Analytics::RangeI::internal_default_instance());
-  ::Analytics::_GameEntityInfo_default_instance_._instance.get_mutable()->boundsmin_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-  ::Analytics::_GameEntityInfo_default_instance_._instance.get_mutable()->boundsmax_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-}
 class GameEntityInfo::_Internal {
  public:
   static const ::Analytics::Vec3& eulerrotation(const GameEntityInfo* msg);
@@ -7577,314 +8914,370 @@ class GameEntityInfo::_Internal {
 
 const ::Analytics::Vec3&
 GameEntityInfo::_Internal::eulerrotation(const GameEntityInfo* msg) {
-  return *msg->eulerrotation_;
+  return *msg->_impl_.eulerrotation_;
 }
 const ::Analytics::Vec3&
 GameEntityInfo::_Internal::position(const GameEntityInfo* msg) {
-  return *msg->position_;
+  return *msg->_impl_.position_;
 }
 const ::Analytics::Vec3&
 GameEntityInfo::_Internal::eyeoffset(const GameEntityInfo* msg) {
-  return *msg->eyeoffset_;
+  return *msg->_impl_.eyeoffset_;
 }
 const ::Analytics::Vec3&
 GameEntityInfo::_Internal::eyedir(const GameEntityInfo* msg) {
-  return *msg->eyedir_;
+  return *msg->_impl_.eyedir_;
 }
 const ::Analytics::RangeI&
 GameEntityInfo::_Internal::health(const GameEntityInfo* msg) {
-  return *msg->health_;
+  return *msg->_impl_.health_;
 }
 const ::Analytics::RangeI&
 GameEntityInfo::_Internal::armor(const GameEntityInfo* msg) {
-  return *msg->armor_;
+  return *msg->_impl_.armor_;
 }
 const ::Analytics::Vec3&
 GameEntityInfo::_Internal::boundsmin(const GameEntityInfo* msg) {
-  return *msg->boundsmin_;
+  return *msg->_impl_.boundsmin_;
 }
 const ::Analytics::Vec3&
 GameEntityInfo::_Internal::boundsmax(const GameEntityInfo* msg) {
-  return *msg->boundsmax_;
+  return *msg->_impl_.boundsmax_;
 }
-GameEntityInfo::GameEntityInfo()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameEntityInfo)
+GameEntityInfo::GameEntityInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameEntityInfo)
 }
 GameEntityInfo::GameEntityInfo(const GameEntityInfo& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      ammo_(from.ammo_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  entityname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameEntityInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ammo_){from._impl_.ammo_}
+    , decltype(_impl_.entityname_){}
+    , decltype(_impl_.eulerrotation_){nullptr}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.eyeoffset_){nullptr}
+    , decltype(_impl_.eyedir_){nullptr}
+    , decltype(_impl_.health_){nullptr}
+    , decltype(_impl_.armor_){nullptr}
+    , decltype(_impl_.boundsmin_){nullptr}
+    , decltype(_impl_.boundsmax_){nullptr}
+    , decltype(_impl_.entityindex_){}
+    , decltype(_impl_.entityserial_){}
+    , decltype(_impl_.groupid_){}
+    , decltype(_impl_.classid_){}
+    , decltype(_impl_.entityflags_){}
+    , decltype(_impl_.team_){}
+    , decltype(_impl_.category_){}
+    , decltype(_impl_.navflags_){}
+    , decltype(_impl_.powerups_){}
+    , decltype(_impl_.entitynameid_){}
+    , decltype(_impl_.deleted_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.entityname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entityname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_entityname().empty()) {
-    entityname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.entityname_);
+    _this->_impl_.entityname_.Set(from._internal_entityname(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_eulerrotation()) {
-    eulerrotation_ = new ::Analytics::Vec3(*from.eulerrotation_);
-  } else {
-    eulerrotation_ = nullptr;
+    _this->_impl_.eulerrotation_ = new ::Analytics::Vec3(*from._impl_.eulerrotation_);
   }
   if (from._internal_has_position()) {
-    position_ = new ::Analytics::Vec3(*from.position_);
-  } else {
-    position_ = nullptr;
+    _this->_impl_.position_ = new ::Analytics::Vec3(*from._impl_.position_);
   }
   if (from._internal_has_eyeoffset()) {
-    eyeoffset_ = new ::Analytics::Vec3(*from.eyeoffset_);
-  } else {
-    eyeoffset_ = nullptr;
+    _this->_impl_.eyeoffset_ = new ::Analytics::Vec3(*from._impl_.eyeoffset_);
   }
   if (from._internal_has_eyedir()) {
-    eyedir_ = new ::Analytics::Vec3(*from.eyedir_);
-  } else {
-    eyedir_ = nullptr;
+    _this->_impl_.eyedir_ = new ::Analytics::Vec3(*from._impl_.eyedir_);
   }
   if (from._internal_has_health()) {
-    health_ = new ::Analytics::RangeI(*from.health_);
-  } else {
-    health_ = nullptr;
+    _this->_impl_.health_ = new ::Analytics::RangeI(*from._impl_.health_);
   }
   if (from._internal_has_armor()) {
-    armor_ = new ::Analytics::RangeI(*from.armor_);
-  } else {
-    armor_ = nullptr;
+    _this->_impl_.armor_ = new ::Analytics::RangeI(*from._impl_.armor_);
   }
   if (from._internal_has_boundsmin()) {
-    boundsmin_ = new ::Analytics::Vec3(*from.boundsmin_);
-  } else {
-    boundsmin_ = nullptr;
+    _this->_impl_.boundsmin_ = new ::Analytics::Vec3(*from._impl_.boundsmin_);
   }
   if (from._internal_has_boundsmax()) {
-    boundsmax_ = new ::Analytics::Vec3(*from.boundsmax_);
-  } else {
-    boundsmax_ = nullptr;
+    _this->_impl_.boundsmax_ = new ::Analytics::Vec3(*from._impl_.boundsmax_);
   }
-  ::memcpy(&entityindex_, &from.entityindex_,
-    static_cast<size_t>(reinterpret_cast<char*>(&deleted_) -
-    reinterpret_cast<char*>(&entityindex_)) + sizeof(deleted_));
+  ::memcpy(&_impl_.entityindex_, &from._impl_.entityindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.deleted_) -
+    reinterpret_cast<char*>(&_impl_.entityindex_)) + sizeof(_impl_.deleted_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameEntityInfo)
 }
 
-void GameEntityInfo::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameEntityInfo_analytics_2eproto.base);
-  entityname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&eulerrotation_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&deleted_) -
-      reinterpret_cast<char*>(&eulerrotation_)) + sizeof(deleted_));
+inline void GameEntityInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ammo_){arena}
+    , decltype(_impl_.entityname_){}
+    , decltype(_impl_.eulerrotation_){nullptr}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.eyeoffset_){nullptr}
+    , decltype(_impl_.eyedir_){nullptr}
+    , decltype(_impl_.health_){nullptr}
+    , decltype(_impl_.armor_){nullptr}
+    , decltype(_impl_.boundsmin_){nullptr}
+    , decltype(_impl_.boundsmax_){nullptr}
+    , decltype(_impl_.entityindex_){0}
+    , decltype(_impl_.entityserial_){0}
+    , decltype(_impl_.groupid_){0}
+    , decltype(_impl_.classid_){0}
+    , decltype(_impl_.entityflags_){int64_t{0}}
+    , decltype(_impl_.team_){0}
+    , decltype(_impl_.category_){0}
+    , decltype(_impl_.navflags_){int64_t{0}}
+    , decltype(_impl_.powerups_){0}
+    , decltype(_impl_.entitynameid_){0u}
+    , decltype(_impl_.deleted_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.entityname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entityname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameEntityInfo::~GameEntityInfo() {
   // @@protoc_insertion_point(destructor:Analytics.GameEntityInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameEntityInfo::SharedDtor() {
-  entityname_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete eulerrotation_;
-  if (this != internal_default_instance()) delete position_;
-  if (this != internal_default_instance()) delete eyeoffset_;
-  if (this != internal_default_instance()) delete eyedir_;
-  if (this != internal_default_instance()) delete health_;
-  if (this != internal_default_instance()) delete armor_;
-  if (this != internal_default_instance()) delete boundsmin_;
-  if (this != internal_default_instance()) delete boundsmax_;
+inline void GameEntityInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ammo_.~RepeatedPtrField();
+  _impl_.entityname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.eulerrotation_;
+  if (this != internal_default_instance()) delete _impl_.position_;
+  if (this != internal_default_instance()) delete _impl_.eyeoffset_;
+  if (this != internal_default_instance()) delete _impl_.eyedir_;
+  if (this != internal_default_instance()) delete _impl_.health_;
+  if (this != internal_default_instance()) delete _impl_.armor_;
+  if (this != internal_default_instance()) delete _impl_.boundsmin_;
+  if (this != internal_default_instance()) delete _impl_.boundsmax_;
 }
 
 void GameEntityInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameEntityInfo& GameEntityInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameEntityInfo_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameEntityInfo::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameEntityInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ammo_.Clear();
-  entityname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && eulerrotation_ != nullptr) {
-    delete eulerrotation_;
+  _impl_.ammo_.Clear();
+  _impl_.entityname_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.eulerrotation_ != nullptr) {
+    delete _impl_.eulerrotation_;
   }
-  eulerrotation_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  _impl_.eulerrotation_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && eyeoffset_ != nullptr) {
-    delete eyeoffset_;
+  _impl_.position_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.eyeoffset_ != nullptr) {
+    delete _impl_.eyeoffset_;
   }
-  eyeoffset_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && eyedir_ != nullptr) {
-    delete eyedir_;
+  _impl_.eyeoffset_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.eyedir_ != nullptr) {
+    delete _impl_.eyedir_;
   }
-  eyedir_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && health_ != nullptr) {
-    delete health_;
+  _impl_.eyedir_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.health_ != nullptr) {
+    delete _impl_.health_;
   }
-  health_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && armor_ != nullptr) {
-    delete armor_;
+  _impl_.health_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.armor_ != nullptr) {
+    delete _impl_.armor_;
   }
-  armor_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && boundsmin_ != nullptr) {
-    delete boundsmin_;
+  _impl_.armor_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.boundsmin_ != nullptr) {
+    delete _impl_.boundsmin_;
   }
-  boundsmin_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && boundsmax_ != nullptr) {
-    delete boundsmax_;
+  _impl_.boundsmin_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.boundsmax_ != nullptr) {
+    delete _impl_.boundsmax_;
   }
-  boundsmax_ = nullptr;
-  ::memset(&entityindex_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&deleted_) -
-      reinterpret_cast<char*>(&entityindex_)) + sizeof(deleted_));
-  _internal_metadata_.Clear();
+  _impl_.boundsmax_ = nullptr;
+  ::memset(&_impl_.entityindex_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.deleted_) -
+      reinterpret_cast<char*>(&_impl_.entityindex_)) + sizeof(_impl_.deleted_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameEntityInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameEntityInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string entityName = 1;
+      // string entityName = 1 [(.Analytics.intern) = "entityNameId"];
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_entityname();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameEntityInfo.entityName"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameEntityInfo.entityName"));
+        } else
+          goto handle_unusual;
         continue;
       // int32 entityIndex = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          entityindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.entityindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 entitySerial = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          entityserial_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.entityserial_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 groupId = 4 [(.Analytics.enumkey) = "GROUP_ID"];
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 classId = 5 [(.Analytics.enumkey) = "CLASS_ID"];
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          classid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.classid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 team = 6 [(.Analytics.enumkey) = "TEAM_ID"];
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          team_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.team_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int64 entityFlags = 7 [(.Analytics.enumkey) = "ENTITY_FLAGS", (.Analytics.enumflagsindexed) = true];
       case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
-          entityflags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.entityflags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 category = 8 [(.Analytics.enumkey) = "CATEGORY_ID", (.Analytics.enumflagsindexed) = true];
       case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
-          category_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.category_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 powerUps = 9 [(.Analytics.enumkey) = "POWERUP_ID", (.Analytics.enumflagsindexed) = true];
       case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
-          powerups_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.powerups_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int64 navFlags = 10 [(.Analytics.enumkey) = "NAV_FLAGS"];
       case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 80)) {
-          navflags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.navflags_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.Vec3 eulerRotation = 11 [(.Analytics.hidden) = true];
       case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
           ptr = ctx->ParseMessage(_internal_mutable_eulerrotation(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.Vec3 position = 12 [(.Analytics.hidden) = true];
       case 12:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
           ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.Vec3 eyeOffset = 13 [(.Analytics.hidden) = true];
       case 13:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
           ptr = ctx->ParseMessage(_internal_mutable_eyeoffset(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.Vec3 eyeDir = 14 [(.Analytics.hidden) = true];
       case 14:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
           ptr = ctx->ParseMessage(_internal_mutable_eyedir(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.RangeI health = 15;
       case 15:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
           ptr = ctx->ParseMessage(_internal_mutable_health(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.RangeI armor = 16;
       case 16:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 130)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
           ptr = ctx->ParseMessage(_internal_mutable_armor(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.Vec3 boundsMin = 17;
       case 17:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 138)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
           ptr = ctx->ParseMessage(_internal_mutable_boundsmin(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.Vec3 boundsMax = 18;
       case 18:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 146)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
           ptr = ctx->ParseMessage(_internal_mutable_boundsmax(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .Analytics.GameEntityInfo.Ammo ammo = 19;
       case 19:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 154)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
           ptr -= 2;
           do {
             ptr += 2;
@@ -7892,43 +9285,56 @@ const char* GameEntityInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<154>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 entityNameId = 20 [(.Analytics.hidden) = true];
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _impl_.entitynameid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
       // bool deleted = 1000 [(.Analytics.hidden) = true];
       case 1000:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
-          deleted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.deleted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameEntityInfo::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameEntityInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameEntityInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string entityName = 1;
-  if (this->entityname().size() > 0) {
+  // string entityName = 1 [(.Analytics.intern) = "entityNameId"];
+  if (!this->_internal_entityname().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_entityname().data(), static_cast<int>(this->_internal_entityname().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -7938,140 +9344,138 @@ failure:
   }
 
   // int32 entityIndex = 2;
-  if (this->entityindex() != 0) {
+  if (this->_internal_entityindex() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_entityindex(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_entityindex(), target);
   }
 
   // int32 entitySerial = 3;
-  if (this->entityserial() != 0) {
+  if (this->_internal_entityserial() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_entityserial(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_entityserial(), target);
   }
 
   // int32 groupId = 4 [(.Analytics.enumkey) = "GROUP_ID"];
-  if (this->groupid() != 0) {
+  if (this->_internal_groupid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_groupid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_groupid(), target);
   }
 
   // int32 classId = 5 [(.Analytics.enumkey) = "CLASS_ID"];
-  if (this->classid() != 0) {
+  if (this->_internal_classid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_classid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_classid(), target);
   }
 
   // int32 team = 6 [(.Analytics.enumkey) = "TEAM_ID"];
-  if (this->team() != 0) {
+  if (this->_internal_team() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(6, this->_internal_team(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_team(), target);
   }
 
   // int64 entityFlags = 7 [(.Analytics.enumkey) = "ENTITY_FLAGS", (.Analytics.enumflagsindexed) = true];
-  if (this->entityflags() != 0) {
+  if (this->_internal_entityflags() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(7, this->_internal_entityflags(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_entityflags(), target);
   }
 
   // int32 category = 8 [(.Analytics.enumkey) = "CATEGORY_ID", (.Analytics.enumflagsindexed) = true];
-  if (this->category() != 0) {
+  if (this->_internal_category() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(8, this->_internal_category(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_category(), target);
   }
 
   // int32 powerUps = 9 [(.Analytics.enumkey) = "POWERUP_ID", (.Analytics.enumflagsindexed) = true];
-  if (this->powerups() != 0) {
+  if (this->_internal_powerups() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(9, this->_internal_powerups(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_powerups(), target);
   }
 
   // int64 navFlags = 10 [(.Analytics.enumkey) = "NAV_FLAGS"];
-  if (this->navflags() != 0) {
+  if (this->_internal_navflags() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(10, this->_internal_navflags(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_navflags(), target);
   }
 
   // .Analytics.Vec3 eulerRotation = 11 [(.Analytics.hidden) = true];
-  if (this->has_eulerrotation()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_eulerrotation()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        11, _Internal::eulerrotation(this), target, stream);
+      InternalWriteMessage(11, _Internal::eulerrotation(this),
+        _Internal::eulerrotation(this).GetCachedSize(), target, stream);
   }
 
   // .Analytics.Vec3 position = 12 [(.Analytics.hidden) = true];
-  if (this->has_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        12, _Internal::position(this), target, stream);
+      InternalWriteMessage(12, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   // .Analytics.Vec3 eyeOffset = 13 [(.Analytics.hidden) = true];
-  if (this->has_eyeoffset()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_eyeoffset()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        13, _Internal::eyeoffset(this), target, stream);
+      InternalWriteMessage(13, _Internal::eyeoffset(this),
+        _Internal::eyeoffset(this).GetCachedSize(), target, stream);
   }
 
   // .Analytics.Vec3 eyeDir = 14 [(.Analytics.hidden) = true];
-  if (this->has_eyedir()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_eyedir()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        14, _Internal::eyedir(this), target, stream);
+      InternalWriteMessage(14, _Internal::eyedir(this),
+        _Internal::eyedir(this).GetCachedSize(), target, stream);
   }
 
   // .Analytics.RangeI health = 15;
-  if (this->has_health()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_health()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        15, _Internal::health(this), target, stream);
+      InternalWriteMessage(15, _Internal::health(this),
+        _Internal::health(this).GetCachedSize(), target, stream);
   }
 
   // .Analytics.RangeI armor = 16;
-  if (this->has_armor()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_armor()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        16, _Internal::armor(this), target, stream);
+      InternalWriteMessage(16, _Internal::armor(this),
+        _Internal::armor(this).GetCachedSize(), target, stream);
   }
 
   // .Analytics.Vec3 boundsMin = 17;
-  if (this->has_boundsmin()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_boundsmin()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        17, _Internal::boundsmin(this), target, stream);
+      InternalWriteMessage(17, _Internal::boundsmin(this),
+        _Internal::boundsmin(this).GetCachedSize(), target, stream);
   }
 
   // .Analytics.Vec3 boundsMax = 18;
-  if (this->has_boundsmax()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_boundsmax()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        18, _Internal::boundsmax(this), target, stream);
+      InternalWriteMessage(18, _Internal::boundsmax(this),
+        _Internal::boundsmax(this).GetCachedSize(), target, stream);
   }
 
   // repeated .Analytics.GameEntityInfo.Ammo ammo = 19;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_ammo_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ammo_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ammo(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(19, this->_internal_ammo(i), target, stream);
+        InternalWriteMessage(19, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint32 entityNameId = 20 [(.Analytics.hidden) = true];
+  if (this->_internal_entitynameid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(20, this->_internal_entitynameid(), target);
   }
 
   // bool deleted = 1000 [(.Analytics.hidden) = true];
-  if (this->deleted() != 0) {
+  if (this->_internal_deleted() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(1000, this->_internal_deleted(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1000, this->_internal_deleted(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameEntityInfo)
   return target;
@@ -8081,245 +9485,225 @@ size_t GameEntityInfo::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameEntityInfo)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .Analytics.GameEntityInfo.Ammo ammo = 19;
   total_size += 2UL * this->_internal_ammo_size();
-  for (const auto& msg : this->ammo_) {
+  for (const auto& msg : this->_impl_.ammo_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // string entityName = 1;
-  if (this->entityname().size() > 0) {
+  // string entityName = 1 [(.Analytics.intern) = "entityNameId"];
+  if (!this->_internal_entityname().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_entityname());
   }
 
   // .Analytics.Vec3 eulerRotation = 11 [(.Analytics.hidden) = true];
-  if (this->has_eulerrotation()) {
+  if (this->_internal_has_eulerrotation()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *eulerrotation_);
+        *_impl_.eulerrotation_);
   }
 
   // .Analytics.Vec3 position = 12 [(.Analytics.hidden) = true];
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *position_);
+        *_impl_.position_);
   }
 
   // .Analytics.Vec3 eyeOffset = 13 [(.Analytics.hidden) = true];
-  if (this->has_eyeoffset()) {
+  if (this->_internal_has_eyeoffset()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *eyeoffset_);
+        *_impl_.eyeoffset_);
   }
 
   // .Analytics.Vec3 eyeDir = 14 [(.Analytics.hidden) = true];
-  if (this->has_eyedir()) {
+  if (this->_internal_has_eyedir()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *eyedir_);
+        *_impl_.eyedir_);
   }
 
   // .Analytics.RangeI health = 15;
-  if (this->has_health()) {
+  if (this->_internal_has_health()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *health_);
+        *_impl_.health_);
   }
 
   // .Analytics.RangeI armor = 16;
-  if (this->has_armor()) {
+  if (this->_internal_has_armor()) {
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *armor_);
+        *_impl_.armor_);
   }
 
   // .Analytics.Vec3 boundsMin = 17;
-  if (this->has_boundsmin()) {
+  if (this->_internal_has_boundsmin()) {
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *boundsmin_);
+        *_impl_.boundsmin_);
   }
 
   // .Analytics.Vec3 boundsMax = 18;
-  if (this->has_boundsmax()) {
+  if (this->_internal_has_boundsmax()) {
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *boundsmax_);
+        *_impl_.boundsmax_);
   }
 
   // int32 entityIndex = 2;
-  if (this->entityindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_entityindex());
+  if (this->_internal_entityindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entityindex());
   }
 
   // int32 entitySerial = 3;
-  if (this->entityserial() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_entityserial());
+  if (this->_internal_entityserial() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entityserial());
   }
 
   // int32 groupId = 4 [(.Analytics.enumkey) = "GROUP_ID"];
-  if (this->groupid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_groupid());
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
   }
 
   // int32 classId = 5 [(.Analytics.enumkey) = "CLASS_ID"];
-  if (this->classid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_classid());
+  if (this->_internal_classid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_classid());
   }
 
   // int64 entityFlags = 7 [(.Analytics.enumkey) = "ENTITY_FLAGS", (.Analytics.enumflagsindexed) = true];
-  if (this->entityflags() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
-        this->_internal_entityflags());
+  if (this->_internal_entityflags() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_entityflags());
   }
 
   // int32 team = 6 [(.Analytics.enumkey) = "TEAM_ID"];
-  if (this->team() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_team());
+  if (this->_internal_team() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_team());
   }
 
   // int32 category = 8 [(.Analytics.enumkey) = "CATEGORY_ID", (.Analytics.enumflagsindexed) = true];
-  if (this->category() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_category());
+  if (this->_internal_category() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_category());
   }
 
   // int64 navFlags = 10 [(.Analytics.enumkey) = "NAV_FLAGS"];
-  if (this->navflags() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
-        this->_internal_navflags());
+  if (this->_internal_navflags() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_navflags());
   }
 
   // int32 powerUps = 9 [(.Analytics.enumkey) = "POWERUP_ID", (.Analytics.enumflagsindexed) = true];
-  if (this->powerups() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_powerups());
+  if (this->_internal_powerups() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_powerups());
+  }
+
+  // uint32 entityNameId = 20 [(.Analytics.hidden) = true];
+  if (this->_internal_entitynameid() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_entitynameid());
   }
 
   // bool deleted = 1000 [(.Analytics.hidden) = true];
-  if (this->deleted() != 0) {
+  if (this->_internal_deleted() != 0) {
     total_size += 2 + 1;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameEntityInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameEntityInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameEntityInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameEntityInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameEntityInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameEntityInfo)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameEntityInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameEntityInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameEntityInfo::GetClassData() const { return &_class_data_; }
 
-void GameEntityInfo::MergeFrom(const GameEntityInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameEntityInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  ammo_.MergeFrom(from.ammo_);
-  if (from.entityname().size() > 0) {
+void GameEntityInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameEntityInfo*>(&to_msg);
+  auto& from = static_cast<const GameEntityInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameEntityInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    entityname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.entityname_);
+  _this->_impl_.ammo_.MergeFrom(from._impl_.ammo_);
+  if (!from._internal_entityname().empty()) {
+    _this->_internal_set_entityname(from._internal_entityname());
   }
-  if (from.has_eulerrotation()) {
-    _internal_mutable_eulerrotation()->::Analytics::Vec3::MergeFrom(from._internal_eulerrotation());
+  if (from._internal_has_eulerrotation()) {
+    _this->_internal_mutable_eulerrotation()->::Analytics::Vec3::MergeFrom(
+        from._internal_eulerrotation());
   }
-  if (from.has_position()) {
-    _internal_mutable_position()->::Analytics::Vec3::MergeFrom(from._internal_position());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::Analytics::Vec3::MergeFrom(
+        from._internal_position());
   }
-  if (from.has_eyeoffset()) {
-    _internal_mutable_eyeoffset()->::Analytics::Vec3::MergeFrom(from._internal_eyeoffset());
+  if (from._internal_has_eyeoffset()) {
+    _this->_internal_mutable_eyeoffset()->::Analytics::Vec3::MergeFrom(
+        from._internal_eyeoffset());
   }
-  if (from.has_eyedir()) {
-    _internal_mutable_eyedir()->::Analytics::Vec3::MergeFrom(from._internal_eyedir());
+  if (from._internal_has_eyedir()) {
+    _this->_internal_mutable_eyedir()->::Analytics::Vec3::MergeFrom(
+        from._internal_eyedir());
   }
-  if (from.has_health()) {
-    _internal_mutable_health()->::Analytics::RangeI::MergeFrom(from._internal_health());
+  if (from._internal_has_health()) {
+    _this->_internal_mutable_health()->::Analytics::RangeI::MergeFrom(
+        from._internal_health());
   }
-  if (from.has_armor()) {
-    _internal_mutable_armor()->::Analytics::RangeI::MergeFrom(from._internal_armor());
+  if (from._internal_has_armor()) {
+    _this->_internal_mutable_armor()->::Analytics::RangeI::MergeFrom(
+        from._internal_armor());
   }
-  if (from.has_boundsmin()) {
-    _internal_mutable_boundsmin()->::Analytics::Vec3::MergeFrom(from._internal_boundsmin());
+  if (from._internal_has_boundsmin()) {
+    _this->_internal_mutable_boundsmin()->::Analytics::Vec3::MergeFrom(
+        from._internal_boundsmin());
   }
-  if (from.has_boundsmax()) {
-    _internal_mutable_boundsmax()->::Analytics::Vec3::MergeFrom(from._internal_boundsmax());
+  if (from._internal_has_boundsmax()) {
+    _this->_internal_mutable_boundsmax()->::Analytics::Vec3::MergeFrom(
+        from._internal_boundsmax());
   }
-  if (from.entityindex() != 0) {
-    _internal_set_entityindex(from._internal_entityindex());
+  if (from._internal_entityindex() != 0) {
+    _this->_internal_set_entityindex(from._internal_entityindex());
   }
-  if (from.entityserial() != 0) {
-    _internal_set_entityserial(from._internal_entityserial());
+  if (from._internal_entityserial() != 0) {
+    _this->_internal_set_entityserial(from._internal_entityserial());
   }
-  if (from.groupid() != 0) {
-    _internal_set_groupid(from._internal_groupid());
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
   }
-  if (from.classid() != 0) {
-    _internal_set_classid(from._internal_classid());
+  if (from._internal_classid() != 0) {
+    _this->_internal_set_classid(from._internal_classid());
   }
-  if (from.entityflags() != 0) {
-    _internal_set_entityflags(from._internal_entityflags());
+  if (from._internal_entityflags() != 0) {
+    _this->_internal_set_entityflags(from._internal_entityflags());
   }
-  if (from.team() != 0) {
-    _internal_set_team(from._internal_team());
+  if (from._internal_team() != 0) {
+    _this->_internal_set_team(from._internal_team());
   }
-  if (from.category() != 0) {
-    _internal_set_category(from._internal_category());
+  if (from._internal_category() != 0) {
+    _this->_internal_set_category(from._internal_category());
   }
-  if (from.navflags() != 0) {
-    _internal_set_navflags(from._internal_navflags());
+  if (from._internal_navflags() != 0) {
+    _this->_internal_set_navflags(from._internal_navflags());
   }
-  if (from.powerups() != 0) {
-    _internal_set_powerups(from._internal_powerups());
+  if (from._internal_powerups() != 0) {
+    _this->_internal_set_powerups(from._internal_powerups());
   }
-  if (from.deleted() != 0) {
-    _internal_set_deleted(from._internal_deleted());
+  if (from._internal_entitynameid() != 0) {
+    _this->_internal_set_entitynameid(from._internal_entitynameid());
   }
-}
-
-void GameEntityInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameEntityInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_deleted() != 0) {
+    _this->_internal_set_deleted(from._internal_deleted());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameEntityInfo::CopyFrom(const GameEntityInfo& from) {
@@ -8335,171 +9719,237 @@ bool GameEntityInfo::IsInitialized() const {
 
 void GameEntityInfo::InternalSwap(GameEntityInfo* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  ammo_.InternalSwap(&other->ammo_);
-  entityname_.Swap(&other->entityname_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(eulerrotation_, other->eulerrotation_);
-  swap(position_, other->position_);
-  swap(eyeoffset_, other->eyeoffset_);
-  swap(eyedir_, other->eyedir_);
-  swap(health_, other->health_);
-  swap(armor_, other->armor_);
-  swap(boundsmin_, other->boundsmin_);
-  swap(boundsmax_, other->boundsmax_);
-  swap(entityindex_, other->entityindex_);
-  swap(entityserial_, other->entityserial_);
-  swap(groupid_, other->groupid_);
-  swap(classid_, other->classid_);
-  swap(entityflags_, other->entityflags_);
-  swap(team_, other->team_);
-  swap(category_, other->category_);
-  swap(navflags_, other->navflags_);
-  swap(powerups_, other->powerups_);
-  swap(deleted_, other->deleted_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ammo_.InternalSwap(&other->_impl_.ammo_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.entityname_, lhs_arena,
+      &other->_impl_.entityname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameEntityInfo, _impl_.deleted_)
+      + sizeof(GameEntityInfo::_impl_.deleted_)
+      - PROTOBUF_FIELD_OFFSET(GameEntityInfo, _impl_.eulerrotation_)>(
+          reinterpret_cast<char*>(&_impl_.eulerrotation_),
+          reinterpret_cast<char*>(&other->_impl_.eulerrotation_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameEntityInfo::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[27]);
 }
 
-
 // ===================================================================
 
-void GameEntityPosition::InitAsDefaultInstance() {
-  ::Analytics::_GameEntityPosition_default_instance_._instance.get_mutable()->position_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-}
 class GameEntityPosition::_Internal {
  public:
   static const ::Analytics::Vec3& position(const GameEntityPosition* msg);
+  static const ::Analytics::Vec3& velocity(const GameEntityPosition* msg);
 };
 
 const ::Analytics::Vec3&
 GameEntityPosition::_Internal::position(const GameEntityPosition* msg) {
-  return *msg->position_;
+  return *msg->_impl_.position_;
+}
+const ::Analytics::Vec3&
+GameEntityPosition::_Internal::velocity(const GameEntityPosition* msg) {
+  return *msg->_impl_.velocity_;
 }
-GameEntityPosition::GameEntityPosition()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameEntityPosition)
+GameEntityPosition::GameEntityPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameEntityPosition)
 }
 GameEntityPosition::GameEntityPosition(const GameEntityPosition& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameEntityPosition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.velocity_){nullptr}
+    , decltype(_impl_.team_){}
+    , decltype(_impl_.entityindex_){}
+    , decltype(_impl_.timestamp_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_position()) {
-    position_ = new ::Analytics::Vec3(*from.position_);
-  } else {
-    position_ = nullptr;
+    _this->_impl_.position_ = new ::Analytics::Vec3(*from._impl_.position_);
+  }
+  if (from._internal_has_velocity()) {
+    _this->_impl_.velocity_ = new ::Analytics::Vec3(*from._impl_.velocity_);
   }
-  team_ = from.team_;
+  ::memcpy(&_impl_.team_, &from._impl_.team_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timestamp_) -
+    reinterpret_cast<char*>(&_impl_.team_)) + sizeof(_impl_.timestamp_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameEntityPosition)
 }
 
-void GameEntityPosition::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameEntityPosition_analytics_2eproto.base);
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&team_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(team_));
+inline void GameEntityPosition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.velocity_){nullptr}
+    , decltype(_impl_.team_){0}
+    , decltype(_impl_.entityindex_){0}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 GameEntityPosition::~GameEntityPosition() {
   // @@protoc_insertion_point(destructor:Analytics.GameEntityPosition)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameEntityPosition::SharedDtor() {
-  if (this != internal_default_instance()) delete position_;
+inline void GameEntityPosition::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.position_;
+  if (this != internal_default_instance()) delete _impl_.velocity_;
 }
 
 void GameEntityPosition::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const GameEntityPosition& GameEntityPosition::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameEntityPosition_analytics_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void GameEntityPosition::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameEntityPosition)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
+  }
+  _impl_.position_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.velocity_ != nullptr) {
+    delete _impl_.velocity_;
   }
-  position_ = nullptr;
-  team_ = 0;
-  _internal_metadata_.Clear();
+  _impl_.velocity_ = nullptr;
+  ::memset(&_impl_.team_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.timestamp_) -
+      reinterpret_cast<char*>(&_impl_.team_)) + sizeof(_impl_.timestamp_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameEntityPosition::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameEntityPosition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          team_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.team_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 entityIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.entityindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Analytics.Vec3 velocity = 4 [(.Analytics.hidden) = true];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_velocity(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // int64 timeStamp = 5 [(.Analytics.hidden) = true];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameEntityPosition::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameEntityPosition::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameEntityPosition)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::position(this), target, stream);
+      InternalWriteMessage(1, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   // int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->team() != 0) {
+  if (this->_internal_team() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_team(), target);
+  }
+
+  // int32 entityIndex = 3;
+  if (this->_internal_entityindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_entityindex(), target);
+  }
+
+  // .Analytics.Vec3 velocity = 4 [(.Analytics.hidden) = true];
+  if (this->_internal_has_velocity()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::velocity(this),
+        _Internal::velocity(this).GetCachedSize(), target, stream);
+  }
+
+  // int64 timeStamp = 5 [(.Analytics.hidden) = true];
+  if (this->_internal_timestamp() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_team(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_timestamp(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameEntityPosition)
   return target;
@@ -8509,68 +9959,75 @@ size_t GameEntityPosition::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameEntityPosition)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *position_);
+        *_impl_.position_);
   }
 
-  // int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->team() != 0) {
+  // .Analytics.Vec3 velocity = 4 [(.Analytics.hidden) = true];
+  if (this->_internal_has_velocity()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_team());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.velocity_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
+  if (this->_internal_team() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_team());
+  }
+
+  // int32 entityIndex = 3;
+  if (this->_internal_entityindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entityindex());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameEntityPosition::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameEntityPosition)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameEntityPosition* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameEntityPosition>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameEntityPosition)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameEntityPosition)
-    MergeFrom(*source);
+  // int64 timeStamp = 5 [(.Analytics.hidden) = true];
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameEntityPosition::MergeFrom(const GameEntityPosition& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameEntityPosition)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameEntityPosition::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameEntityPosition::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameEntityPosition::GetClassData() const { return &_class_data_; }
+
+
+void GameEntityPosition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameEntityPosition*>(&to_msg);
+  auto& from = static_cast<const GameEntityPosition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameEntityPosition)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_position()) {
-    _internal_mutable_position()->::Analytics::Vec3::MergeFrom(from._internal_position());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::Analytics::Vec3::MergeFrom(
+        from._internal_position());
   }
-  if (from.team() != 0) {
-    _internal_set_team(from._internal_team());
+  if (from._internal_has_velocity()) {
+    _this->_internal_mutable_velocity()->::Analytics::Vec3::MergeFrom(
+        from._internal_velocity());
   }
-}
-
-void GameEntityPosition::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameEntityPosition)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_team() != 0) {
+    _this->_internal_set_team(from._internal_team());
+  }
+  if (from._internal_entityindex() != 0) {
+    _this->_internal_set_entityindex(from._internal_entityindex());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameEntityPosition::CopyFrom(const GameEntityPosition& from) {
@@ -8586,24 +10043,341 @@ bool GameEntityPosition::IsInitialized() const {
 
 void GameEntityPosition::InternalSwap(GameEntityPosition* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(position_, other->position_);
-  swap(team_, other->team_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameEntityPosition, _impl_.timestamp_)
+      + sizeof(GameEntityPosition::_impl_.timestamp_)
+      - PROTOBUF_FIELD_OFFSET(GameEntityPosition, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameEntityPosition::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[28]);
 }
 
-
 // ===================================================================
 
-void GameNode::InitAsDefaultInstance() {
-  ::Analytics::_GameNode_default_instance_._instance.get_mutable()->eulerrotation_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-  ::Analytics::_GameNode_default_instance_._instance.get_mutable()->translation_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
+class GameEntityTrajectory::_Internal {
+ public:
+};
+
+GameEntityTrajectory::GameEntityTrajectory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameEntityTrajectory)
+}
+GameEntityTrajectory::GameEntityTrajectory(const GameEntityTrajectory& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameEntityTrajectory* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.samples_){}
+    , decltype(_impl_.entityindex_){}
+    , decltype(_impl_.team_){}
+    , decltype(_impl_.samplecount_){}
+    , decltype(_impl_.precision_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.samples_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.samples_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_samples().empty()) {
+    _this->_impl_.samples_.Set(from._internal_samples(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.entityindex_, &from._impl_.entityindex_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.precision_) -
+    reinterpret_cast<char*>(&_impl_.entityindex_)) + sizeof(_impl_.precision_));
+  // @@protoc_insertion_point(copy_constructor:Analytics.GameEntityTrajectory)
+}
+
+inline void GameEntityTrajectory::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.samples_){}
+    , decltype(_impl_.entityindex_){0}
+    , decltype(_impl_.team_){0}
+    , decltype(_impl_.samplecount_){0u}
+    , decltype(_impl_.precision_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.samples_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.samples_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GameEntityTrajectory::~GameEntityTrajectory() {
+  // @@protoc_insertion_point(destructor:Analytics.GameEntityTrajectory)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GameEntityTrajectory::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.samples_.Destroy();
+}
+
+void GameEntityTrajectory::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GameEntityTrajectory::Clear() {
+// @@protoc_insertion_point(message_clear_start:Analytics.GameEntityTrajectory)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.samples_.ClearToEmpty();
+  ::memset(&_impl_.entityindex_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.precision_) -
+      reinterpret_cast<char*>(&_impl_.entityindex_)) + sizeof(_impl_.precision_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameEntityTrajectory::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 entityIndex = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.entityindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID"];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.team_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 sampleCount = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.samplecount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float precision = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.precision_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes samples = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_samples();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GameEntityTrajectory::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameEntityTrajectory)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 entityIndex = 1;
+  if (this->_internal_entityindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_entityindex(), target);
+  }
+
+  // int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID"];
+  if (this->_internal_team() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_team(), target);
+  }
+
+  // uint32 sampleCount = 3;
+  if (this->_internal_samplecount() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_samplecount(), target);
+  }
+
+  // float precision = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_precision = this->_internal_precision();
+  uint32_t raw_precision;
+  memcpy(&raw_precision, &tmp_precision, sizeof(tmp_precision));
+  if (raw_precision != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_precision(), target);
+  }
+
+  // bytes samples = 5;
+  if (!this->_internal_samples().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_samples(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameEntityTrajectory)
+  return target;
+}
+
+size_t GameEntityTrajectory::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Analytics.GameEntityTrajectory)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes samples = 5;
+  if (!this->_internal_samples().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_samples());
+  }
+
+  // int32 entityIndex = 1;
+  if (this->_internal_entityindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entityindex());
+  }
+
+  // int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID"];
+  if (this->_internal_team() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_team());
+  }
+
+  // uint32 sampleCount = 3;
+  if (this->_internal_samplecount() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_samplecount());
+  }
+
+  // float precision = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_precision = this->_internal_precision();
+  uint32_t raw_precision;
+  memcpy(&raw_precision, &tmp_precision, sizeof(tmp_precision));
+  if (raw_precision != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameEntityTrajectory::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameEntityTrajectory::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameEntityTrajectory::GetClassData() const { return &_class_data_; }
+
+
+void GameEntityTrajectory::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameEntityTrajectory*>(&to_msg);
+  auto& from = static_cast<const GameEntityTrajectory&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameEntityTrajectory)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_samples().empty()) {
+    _this->_internal_set_samples(from._internal_samples());
+  }
+  if (from._internal_entityindex() != 0) {
+    _this->_internal_set_entityindex(from._internal_entityindex());
+  }
+  if (from._internal_team() != 0) {
+    _this->_internal_set_team(from._internal_team());
+  }
+  if (from._internal_samplecount() != 0) {
+    _this->_internal_set_samplecount(from._internal_samplecount());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_precision = from._internal_precision();
+  uint32_t raw_precision;
+  memcpy(&raw_precision, &tmp_precision, sizeof(tmp_precision));
+  if (raw_precision != 0) {
+    _this->_internal_set_precision(from._internal_precision());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GameEntityTrajectory::CopyFrom(const GameEntityTrajectory& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Analytics.GameEntityTrajectory)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GameEntityTrajectory::IsInitialized() const {
+  return true;
+}
+
+void GameEntityTrajectory::InternalSwap(GameEntityTrajectory* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.samples_, lhs_arena,
+      &other->_impl_.samples_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameEntityTrajectory, _impl_.precision_)
+      + sizeof(GameEntityTrajectory::_impl_.precision_)
+      - PROTOBUF_FIELD_OFFSET(GameEntityTrajectory, _impl_.entityindex_)>(
+          reinterpret_cast<char*>(&_impl_.entityindex_),
+          reinterpret_cast<char*>(&other->_impl_.entityindex_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GameEntityTrajectory::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[29]);
 }
+
+// ===================================================================
+
 class GameNode::_Internal {
  public:
   static const ::Analytics::Vec3& eulerrotation(const GameNode* msg);
@@ -8612,215 +10386,280 @@ class GameNode::_Internal {
 
 const ::Analytics::Vec3&
 GameNode::_Internal::eulerrotation(const GameNode* msg) {
-  return *msg->eulerrotation_;
+  return *msg->_impl_.eulerrotation_;
 }
 const ::Analytics::Vec3&
 GameNode::_Internal::translation(const GameNode* msg) {
-  return *msg->translation_;
+  return *msg->_impl_.translation_;
 }
-GameNode::GameNode()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameNode)
+GameNode::GameNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameNode)
 }
 GameNode::GameNode(const GameNode& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  nodepath_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameNode* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodepath_){}
+    , decltype(_impl_.meshname_){}
+    , decltype(_impl_.entityname_){}
+    , decltype(_impl_.eulerrotation_){nullptr}
+    , decltype(_impl_.translation_){nullptr}
+    , decltype(_impl_.entityid_){}
+    , decltype(_impl_.activestate_){}
+    , decltype(_impl_.navflagsactive_){}
+    , decltype(_impl_.navflagsoverride_){}
+    , decltype(_impl_.shapemode_){}
+    , decltype(_impl_.entitynameid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.nodepath_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nodepath_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_nodepath().empty()) {
-    nodepath_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.nodepath_);
+    _this->_impl_.nodepath_.Set(from._internal_nodepath(), 
+      _this->GetArenaForAllocation());
   }
-  meshname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.meshname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.meshname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_meshname().empty()) {
-    meshname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.meshname_);
+    _this->_impl_.meshname_.Set(from._internal_meshname(), 
+      _this->GetArenaForAllocation());
   }
-  entityname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.entityname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entityname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_entityname().empty()) {
-    entityname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.entityname_);
+    _this->_impl_.entityname_.Set(from._internal_entityname(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_eulerrotation()) {
-    eulerrotation_ = new ::Analytics::Vec3(*from.eulerrotation_);
-  } else {
-    eulerrotation_ = nullptr;
+    _this->_impl_.eulerrotation_ = new ::Analytics::Vec3(*from._impl_.eulerrotation_);
   }
   if (from._internal_has_translation()) {
-    translation_ = new ::Analytics::Vec3(*from.translation_);
-  } else {
-    translation_ = nullptr;
+    _this->_impl_.translation_ = new ::Analytics::Vec3(*from._impl_.translation_);
   }
-  ::memcpy(&entityid_, &from.entityid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&navflagsoverride_) -
-    reinterpret_cast<char*>(&entityid_)) + sizeof(navflagsoverride_));
+  ::memcpy(&_impl_.entityid_, &from._impl_.entityid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.entitynameid_) -
+    reinterpret_cast<char*>(&_impl_.entityid_)) + sizeof(_impl_.entitynameid_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameNode)
 }
 
-void GameNode::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameNode_analytics_2eproto.base);
-  nodepath_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  meshname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  entityname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&eulerrotation_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&navflagsoverride_) -
-      reinterpret_cast<char*>(&eulerrotation_)) + sizeof(navflagsoverride_));
+inline void GameNode::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodepath_){}
+    , decltype(_impl_.meshname_){}
+    , decltype(_impl_.entityname_){}
+    , decltype(_impl_.eulerrotation_){nullptr}
+    , decltype(_impl_.translation_){nullptr}
+    , decltype(_impl_.entityid_){0}
+    , decltype(_impl_.activestate_){0}
+    , decltype(_impl_.navflagsactive_){int64_t{0}}
+    , decltype(_impl_.navflagsoverride_){int64_t{0}}
+    , decltype(_impl_.shapemode_){0}
+    , decltype(_impl_.entitynameid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.nodepath_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nodepath_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.meshname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.meshname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.entityname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.entityname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameNode::~GameNode() {
   // @@protoc_insertion_point(destructor:Analytics.GameNode)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameNode::SharedDtor() {
-  nodepath_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  meshname_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  entityname_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete eulerrotation_;
-  if (this != internal_default_instance()) delete translation_;
+inline void GameNode::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nodepath_.Destroy();
+  _impl_.meshname_.Destroy();
+  _impl_.entityname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.eulerrotation_;
+  if (this != internal_default_instance()) delete _impl_.translation_;
 }
 
 void GameNode::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameNode& GameNode::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameNode_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameNode::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameNode)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  nodepath_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  meshname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  entityname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && eulerrotation_ != nullptr) {
-    delete eulerrotation_;
+  _impl_.nodepath_.ClearToEmpty();
+  _impl_.meshname_.ClearToEmpty();
+  _impl_.entityname_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.eulerrotation_ != nullptr) {
+    delete _impl_.eulerrotation_;
   }
-  eulerrotation_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && translation_ != nullptr) {
-    delete translation_;
+  _impl_.eulerrotation_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.translation_ != nullptr) {
+    delete _impl_.translation_;
   }
-  translation_ = nullptr;
-  ::memset(&entityid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&navflagsoverride_) -
-      reinterpret_cast<char*>(&entityid_)) + sizeof(navflagsoverride_));
-  _internal_metadata_.Clear();
+  _impl_.translation_ = nullptr;
+  ::memset(&_impl_.entityid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.entitynameid_) -
+      reinterpret_cast<char*>(&_impl_.entityid_)) + sizeof(_impl_.entitynameid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameNode::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameNode::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string nodePath = 1 [(.Analytics.editable_key) = true];
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_nodepath();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameNode.nodePath"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameNode.nodePath"));
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.Vec3 eulerRotation = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_eulerrotation(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.Vec3 translation = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr = ctx->ParseMessage(_internal_mutable_translation(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string meshName = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           auto str = _internal_mutable_meshname();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameNode.meshName"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameNode.meshName"));
+        } else
+          goto handle_unusual;
         continue;
       // int32 entityId = 10;
       case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 80)) {
-          entityid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.entityid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string entityName = 11;
+      // string entityName = 11 [(.Analytics.intern) = "entityNameId"];
       case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
           auto str = _internal_mutable_entityname();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameNode.entityName"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameNode.entityName"));
+        } else
+          goto handle_unusual;
         continue;
       // int32 activeState = 12 [(.Analytics.enumkey) = "MODEL_STATE"];
       case 12:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 96)) {
-          activestate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.activestate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int64 navFlagsActive = 13 [(.Analytics.enumkey) = "NAV_FLAGS"];
       case 13:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 104)) {
-          navflagsactive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.navflagsactive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int64 navFlagsOverride = 14 [(.Analytics.enumkey) = "NAV_FLAGS", (.Analytics.editable) = true];
       case 14:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 112)) {
-          navflagsoverride_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.navflagsoverride_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 shapeMode = 15 [(.Analytics.enumkey) = "SHAPEMODE", (.Analytics.editable) = true];
       case 15:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 120)) {
-          shapemode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.shapemode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 entityNameId = 16 [(.Analytics.hidden) = true];
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _impl_.entitynameid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameNode::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameNode::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameNode)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string nodePath = 1 [(.Analytics.editable_key) = true];
-  if (this->nodepath().size() > 0) {
+  if (!this->_internal_nodepath().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_nodepath().data(), static_cast<int>(this->_internal_nodepath().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -8830,23 +10669,21 @@ failure:
   }
 
   // .Analytics.Vec3 eulerRotation = 2;
-  if (this->has_eulerrotation()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_eulerrotation()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::eulerrotation(this), target, stream);
+      InternalWriteMessage(2, _Internal::eulerrotation(this),
+        _Internal::eulerrotation(this).GetCachedSize(), target, stream);
   }
 
   // .Analytics.Vec3 translation = 3;
-  if (this->has_translation()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_translation()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::translation(this), target, stream);
+      InternalWriteMessage(3, _Internal::translation(this),
+        _Internal::translation(this).GetCachedSize(), target, stream);
   }
 
   // string meshName = 4;
-  if (this->meshname().size() > 0) {
+  if (!this->_internal_meshname().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_meshname().data(), static_cast<int>(this->_internal_meshname().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -8856,13 +10693,13 @@ failure:
   }
 
   // int32 entityId = 10;
-  if (this->entityid() != 0) {
+  if (this->_internal_entityid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(10, this->_internal_entityid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_entityid(), target);
   }
 
-  // string entityName = 11;
-  if (this->entityname().size() > 0) {
+  // string entityName = 11 [(.Analytics.intern) = "entityNameId"];
+  if (!this->_internal_entityname().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_entityname().data(), static_cast<int>(this->_internal_entityname().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -8872,32 +10709,38 @@ failure:
   }
 
   // int32 activeState = 12 [(.Analytics.enumkey) = "MODEL_STATE"];
-  if (this->activestate() != 0) {
+  if (this->_internal_activestate() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(12, this->_internal_activestate(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_activestate(), target);
   }
 
   // int64 navFlagsActive = 13 [(.Analytics.enumkey) = "NAV_FLAGS"];
-  if (this->navflagsactive() != 0) {
+  if (this->_internal_navflagsactive() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(13, this->_internal_navflagsactive(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(13, this->_internal_navflagsactive(), target);
   }
 
   // int64 navFlagsOverride = 14 [(.Analytics.enumkey) = "NAV_FLAGS", (.Analytics.editable) = true];
-  if (this->navflagsoverride() != 0) {
+  if (this->_internal_navflagsoverride() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(14, this->_internal_navflagsoverride(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(14, this->_internal_navflagsoverride(), target);
   }
 
   // int32 shapeMode = 15 [(.Analytics.enumkey) = "SHAPEMODE", (.Analytics.editable) = true];
-  if (this->shapemode() != 0) {
+  if (this->_internal_shapemode() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(15, this->_internal_shapemode(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(15, this->_internal_shapemode(), target);
+  }
+
+  // uint32 entityNameId = 16 [(.Analytics.hidden) = true];
+  if (this->_internal_entitynameid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(16, this->_internal_entitynameid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameNode)
   return target;
@@ -8907,151 +10750,131 @@ size_t GameNode::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameNode)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string nodePath = 1 [(.Analytics.editable_key) = true];
-  if (this->nodepath().size() > 0) {
+  if (!this->_internal_nodepath().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_nodepath());
   }
 
   // string meshName = 4;
-  if (this->meshname().size() > 0) {
+  if (!this->_internal_meshname().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_meshname());
   }
 
-  // string entityName = 11;
-  if (this->entityname().size() > 0) {
+  // string entityName = 11 [(.Analytics.intern) = "entityNameId"];
+  if (!this->_internal_entityname().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_entityname());
   }
 
   // .Analytics.Vec3 eulerRotation = 2;
-  if (this->has_eulerrotation()) {
+  if (this->_internal_has_eulerrotation()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *eulerrotation_);
+        *_impl_.eulerrotation_);
   }
 
   // .Analytics.Vec3 translation = 3;
-  if (this->has_translation()) {
+  if (this->_internal_has_translation()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *translation_);
+        *_impl_.translation_);
   }
 
   // int32 entityId = 10;
-  if (this->entityid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_entityid());
+  if (this->_internal_entityid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entityid());
   }
 
   // int32 activeState = 12 [(.Analytics.enumkey) = "MODEL_STATE"];
-  if (this->activestate() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_activestate());
-  }
-
-  // int32 shapeMode = 15 [(.Analytics.enumkey) = "SHAPEMODE", (.Analytics.editable) = true];
-  if (this->shapemode() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_shapemode());
+  if (this->_internal_activestate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_activestate());
   }
 
   // int64 navFlagsActive = 13 [(.Analytics.enumkey) = "NAV_FLAGS"];
-  if (this->navflagsactive() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
-        this->_internal_navflagsactive());
+  if (this->_internal_navflagsactive() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_navflagsactive());
   }
 
   // int64 navFlagsOverride = 14 [(.Analytics.enumkey) = "NAV_FLAGS", (.Analytics.editable) = true];
-  if (this->navflagsoverride() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
-        this->_internal_navflagsoverride());
+  if (this->_internal_navflagsoverride() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_navflagsoverride());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 shapeMode = 15 [(.Analytics.enumkey) = "SHAPEMODE", (.Analytics.editable) = true];
+  if (this->_internal_shapemode() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_shapemode());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameNode::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameNode)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameNode* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameNode>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameNode)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameNode)
-    MergeFrom(*source);
+  // uint32 entityNameId = 16 [(.Analytics.hidden) = true];
+  if (this->_internal_entitynameid() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_entitynameid());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameNode::MergeFrom(const GameNode& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameNode)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameNode::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameNode::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameNode::GetClassData() const { return &_class_data_; }
 
-  if (from.nodepath().size() > 0) {
 
-    nodepath_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.nodepath_);
-  }
-  if (from.meshname().size() > 0) {
+void GameNode::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameNode*>(&to_msg);
+  auto& from = static_cast<const GameNode&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameNode)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    meshname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.meshname_);
+  if (!from._internal_nodepath().empty()) {
+    _this->_internal_set_nodepath(from._internal_nodepath());
   }
-  if (from.entityname().size() > 0) {
-
-    entityname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.entityname_);
+  if (!from._internal_meshname().empty()) {
+    _this->_internal_set_meshname(from._internal_meshname());
+  }
+  if (!from._internal_entityname().empty()) {
+    _this->_internal_set_entityname(from._internal_entityname());
+  }
+  if (from._internal_has_eulerrotation()) {
+    _this->_internal_mutable_eulerrotation()->::Analytics::Vec3::MergeFrom(
+        from._internal_eulerrotation());
   }
-  if (from.has_eulerrotation()) {
-    _internal_mutable_eulerrotation()->::Analytics::Vec3::MergeFrom(from._internal_eulerrotation());
+  if (from._internal_has_translation()) {
+    _this->_internal_mutable_translation()->::Analytics::Vec3::MergeFrom(
+        from._internal_translation());
   }
-  if (from.has_translation()) {
-    _internal_mutable_translation()->::Analytics::Vec3::MergeFrom(from._internal_translation());
+  if (from._internal_entityid() != 0) {
+    _this->_internal_set_entityid(from._internal_entityid());
   }
-  if (from.entityid() != 0) {
-    _internal_set_entityid(from._internal_entityid());
+  if (from._internal_activestate() != 0) {
+    _this->_internal_set_activestate(from._internal_activestate());
   }
-  if (from.activestate() != 0) {
-    _internal_set_activestate(from._internal_activestate());
+  if (from._internal_navflagsactive() != 0) {
+    _this->_internal_set_navflagsactive(from._internal_navflagsactive());
   }
-  if (from.shapemode() != 0) {
-    _internal_set_shapemode(from._internal_shapemode());
+  if (from._internal_navflagsoverride() != 0) {
+    _this->_internal_set_navflagsoverride(from._internal_navflagsoverride());
   }
-  if (from.navflagsactive() != 0) {
-    _internal_set_navflagsactive(from._internal_navflagsactive());
+  if (from._internal_shapemode() != 0) {
+    _this->_internal_set_shapemode(from._internal_shapemode());
   }
-  if (from.navflagsoverride() != 0) {
-    _internal_set_navflagsoverride(from._internal_navflagsoverride());
+  if (from._internal_entitynameid() != 0) {
+    _this->_internal_set_entitynameid(from._internal_entitynameid());
   }
-}
-
-void GameNode::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameNode)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameNode::CopyFrom(const GameNode& from) {
@@ -9067,193 +10890,244 @@ bool GameNode::IsInitialized() const {
 
 void GameNode::InternalSwap(GameNode* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  nodepath_.Swap(&other->nodepath_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  meshname_.Swap(&other->meshname_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  entityname_.Swap(&other->entityname_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(eulerrotation_, other->eulerrotation_);
-  swap(translation_, other->translation_);
-  swap(entityid_, other->entityid_);
-  swap(activestate_, other->activestate_);
-  swap(shapemode_, other->shapemode_);
-  swap(navflagsactive_, other->navflagsactive_);
-  swap(navflagsoverride_, other->navflagsoverride_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.nodepath_, lhs_arena,
+      &other->_impl_.nodepath_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.meshname_, lhs_arena,
+      &other->_impl_.meshname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.entityname_, lhs_arena,
+      &other->_impl_.entityname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameNode, _impl_.entitynameid_)
+      + sizeof(GameNode::_impl_.entitynameid_)
+      - PROTOBUF_FIELD_OFFSET(GameNode, _impl_.eulerrotation_)>(
+          reinterpret_cast<char*>(&_impl_.eulerrotation_),
+          reinterpret_cast<char*>(&other->_impl_.eulerrotation_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameNode::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[30]);
 }
 
-
 // ===================================================================
 
-void GameWeaponFired::InitAsDefaultInstance() {
-  ::Analytics::_GameWeaponFired_default_instance_._instance.get_mutable()->position_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-}
 class GameWeaponFired::_Internal {
  public:
   static const ::Analytics::Vec3& position(const GameWeaponFired* msg);
+  static const ::Analytics::Line& trace(const GameWeaponFired* msg);
 };
 
 const ::Analytics::Vec3&
 GameWeaponFired::_Internal::position(const GameWeaponFired* msg) {
-  return *msg->position_;
+  return *msg->_impl_.position_;
+}
+const ::Analytics::Line&
+GameWeaponFired::_Internal::trace(const GameWeaponFired* msg) {
+  return *msg->_impl_.trace_;
 }
-GameWeaponFired::GameWeaponFired()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameWeaponFired)
+GameWeaponFired::GameWeaponFired(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameWeaponFired)
 }
 GameWeaponFired::GameWeaponFired(const GameWeaponFired& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameWeaponFired* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.trace_){nullptr}
+    , decltype(_impl_.attackteam_){}
+    , decltype(_impl_.weaponid_){}
+    , decltype(_impl_.firedbyclass_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_position()) {
-    position_ = new ::Analytics::Vec3(*from.position_);
-  } else {
-    position_ = nullptr;
+    _this->_impl_.position_ = new ::Analytics::Vec3(*from._impl_.position_);
   }
-  ::memcpy(&attackteam_, &from.attackteam_,
-    static_cast<size_t>(reinterpret_cast<char*>(&firedbyclass_) -
-    reinterpret_cast<char*>(&attackteam_)) + sizeof(firedbyclass_));
+  if (from._internal_has_trace()) {
+    _this->_impl_.trace_ = new ::Analytics::Line(*from._impl_.trace_);
+  }
+  ::memcpy(&_impl_.attackteam_, &from._impl_.attackteam_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.firedbyclass_) -
+    reinterpret_cast<char*>(&_impl_.attackteam_)) + sizeof(_impl_.firedbyclass_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameWeaponFired)
 }
 
-void GameWeaponFired::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameWeaponFired_analytics_2eproto.base);
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&firedbyclass_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(firedbyclass_));
+inline void GameWeaponFired::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.trace_){nullptr}
+    , decltype(_impl_.attackteam_){0}
+    , decltype(_impl_.weaponid_){0}
+    , decltype(_impl_.firedbyclass_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 GameWeaponFired::~GameWeaponFired() {
   // @@protoc_insertion_point(destructor:Analytics.GameWeaponFired)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameWeaponFired::SharedDtor() {
-  if (this != internal_default_instance()) delete position_;
+inline void GameWeaponFired::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.position_;
+  if (this != internal_default_instance()) delete _impl_.trace_;
 }
 
 void GameWeaponFired::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameWeaponFired& GameWeaponFired::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameWeaponFired_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameWeaponFired::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameWeaponFired)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
-  ::memset(&attackteam_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&firedbyclass_) -
-      reinterpret_cast<char*>(&attackteam_)) + sizeof(firedbyclass_));
-  _internal_metadata_.Clear();
+  _impl_.position_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.trace_ != nullptr) {
+    delete _impl_.trace_;
+  }
+  _impl_.trace_ = nullptr;
+  ::memset(&_impl_.attackteam_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.firedbyclass_) -
+      reinterpret_cast<char*>(&_impl_.attackteam_)) + sizeof(_impl_.firedbyclass_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameWeaponFired::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameWeaponFired::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 attackTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          attackteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.attackteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 weaponId = 3 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          weaponid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.weaponid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 firedByClass = 4 [(.Analytics.enumkey) = "CLASS_ID", (.Analytics.track_event) = true];
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          firedbyclass_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.firedbyclass_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .Analytics.Line trace = 5 [(.Analytics.line_event) = {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_trace(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameWeaponFired::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameWeaponFired::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameWeaponFired)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::position(this), target, stream);
+      InternalWriteMessage(1, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   // int32 attackTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->attackteam() != 0) {
+  if (this->_internal_attackteam() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_attackteam(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_attackteam(), target);
   }
 
   // int32 weaponId = 3 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
-  if (this->weaponid() != 0) {
+  if (this->_internal_weaponid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_weaponid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_weaponid(), target);
   }
 
   // int32 firedByClass = 4 [(.Analytics.enumkey) = "CLASS_ID", (.Analytics.track_event) = true];
-  if (this->firedbyclass() != 0) {
+  if (this->_internal_firedbyclass() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_firedbyclass(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_firedbyclass(), target);
+  }
+
+  // .Analytics.Line trace = 5 [(.Analytics.line_event) = {
+  if (this->_internal_has_trace()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::trace(this),
+        _Internal::trace(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameWeaponFired)
   return target;
@@ -9263,88 +11137,75 @@ size_t GameWeaponFired::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameWeaponFired)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *position_);
+        *_impl_.position_);
   }
 
-  // int32 attackTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->attackteam() != 0) {
+  // .Analytics.Line trace = 5 [(.Analytics.line_event) = {
+  if (this->_internal_has_trace()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_attackteam());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.trace_);
+  }
+
+  // int32 attackTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
+  if (this->_internal_attackteam() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_attackteam());
   }
 
   // int32 weaponId = 3 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
-  if (this->weaponid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_weaponid());
+  if (this->_internal_weaponid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_weaponid());
   }
 
   // int32 firedByClass = 4 [(.Analytics.enumkey) = "CLASS_ID", (.Analytics.track_event) = true];
-  if (this->firedbyclass() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_firedbyclass());
+  if (this->_internal_firedbyclass() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_firedbyclass());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameWeaponFired::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameWeaponFired)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameWeaponFired* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameWeaponFired>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameWeaponFired)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameWeaponFired)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameWeaponFired::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameWeaponFired::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameWeaponFired::GetClassData() const { return &_class_data_; }
+
 
-void GameWeaponFired::MergeFrom(const GameWeaponFired& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameWeaponFired)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void GameWeaponFired::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameWeaponFired*>(&to_msg);
+  auto& from = static_cast<const GameWeaponFired&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameWeaponFired)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_position()) {
-    _internal_mutable_position()->::Analytics::Vec3::MergeFrom(from._internal_position());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::Analytics::Vec3::MergeFrom(
+        from._internal_position());
   }
-  if (from.attackteam() != 0) {
-    _internal_set_attackteam(from._internal_attackteam());
+  if (from._internal_has_trace()) {
+    _this->_internal_mutable_trace()->::Analytics::Line::MergeFrom(
+        from._internal_trace());
   }
-  if (from.weaponid() != 0) {
-    _internal_set_weaponid(from._internal_weaponid());
+  if (from._internal_attackteam() != 0) {
+    _this->_internal_set_attackteam(from._internal_attackteam());
   }
-  if (from.firedbyclass() != 0) {
-    _internal_set_firedbyclass(from._internal_firedbyclass());
+  if (from._internal_weaponid() != 0) {
+    _this->_internal_set_weaponid(from._internal_weaponid());
   }
-}
-
-void GameWeaponFired::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameWeaponFired)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_firedbyclass() != 0) {
+    _this->_internal_set_firedbyclass(from._internal_firedbyclass());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameWeaponFired::CopyFrom(const GameWeaponFired& from) {
@@ -9360,24 +11221,23 @@ bool GameWeaponFired::IsInitialized() const {
 
 void GameWeaponFired::InternalSwap(GameWeaponFired* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(position_, other->position_);
-  swap(attackteam_, other->attackteam_);
-  swap(weaponid_, other->weaponid_);
-  swap(firedbyclass_, other->firedbyclass_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameWeaponFired, _impl_.firedbyclass_)
+      + sizeof(GameWeaponFired::_impl_.firedbyclass_)
+      - PROTOBUF_FIELD_OFFSET(GameWeaponFired, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameWeaponFired::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[31]);
 }
 
-
 // ===================================================================
 
-void GameDeath::InitAsDefaultInstance() {
-  ::Analytics::_GameDeath_default_instance_._instance.get_mutable()->position_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-}
 class GameDeath::_Internal {
  public:
   static const ::Analytics::Vec3& position(const GameDeath* msg);
@@ -9385,161 +11245,195 @@ class GameDeath::_Internal {
 
 const ::Analytics::Vec3&
 GameDeath::_Internal::position(const GameDeath* msg) {
-  return *msg->position_;
+  return *msg->_impl_.position_;
 }
-GameDeath::GameDeath()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameDeath)
+GameDeath::GameDeath(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameDeath)
 }
 GameDeath::GameDeath(const GameDeath& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  meansofdeath_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameDeath* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.meansofdeath_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.victimteam_){}
+    , decltype(_impl_.attackteam_){}
+    , decltype(_impl_.meansofdeathid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.meansofdeath_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.meansofdeath_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_meansofdeath().empty()) {
-    meansofdeath_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.meansofdeath_);
+    _this->_impl_.meansofdeath_.Set(from._internal_meansofdeath(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_position()) {
-    position_ = new ::Analytics::Vec3(*from.position_);
-  } else {
-    position_ = nullptr;
+    _this->_impl_.position_ = new ::Analytics::Vec3(*from._impl_.position_);
   }
-  ::memcpy(&victimteam_, &from.victimteam_,
-    static_cast<size_t>(reinterpret_cast<char*>(&attackteam_) -
-    reinterpret_cast<char*>(&victimteam_)) + sizeof(attackteam_));
+  ::memcpy(&_impl_.victimteam_, &from._impl_.victimteam_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.meansofdeathid_) -
+    reinterpret_cast<char*>(&_impl_.victimteam_)) + sizeof(_impl_.meansofdeathid_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameDeath)
 }
 
-void GameDeath::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameDeath_analytics_2eproto.base);
-  meansofdeath_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&attackteam_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(attackteam_));
+inline void GameDeath::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.meansofdeath_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.victimteam_){0}
+    , decltype(_impl_.attackteam_){0}
+    , decltype(_impl_.meansofdeathid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.meansofdeath_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.meansofdeath_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameDeath::~GameDeath() {
   // @@protoc_insertion_point(destructor:Analytics.GameDeath)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameDeath::SharedDtor() {
-  meansofdeath_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete position_;
+inline void GameDeath::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.meansofdeath_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.position_;
 }
 
 void GameDeath::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameDeath& GameDeath::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameDeath_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameDeath::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameDeath)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  meansofdeath_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  _impl_.meansofdeath_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
-  ::memset(&victimteam_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&attackteam_) -
-      reinterpret_cast<char*>(&victimteam_)) + sizeof(attackteam_));
-  _internal_metadata_.Clear();
+  _impl_.position_ = nullptr;
+  ::memset(&_impl_.victimteam_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.meansofdeathid_) -
+      reinterpret_cast<char*>(&_impl_.victimteam_)) + sizeof(_impl_.meansofdeathid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameDeath::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameDeath::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          victimteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.victimteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          attackteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.attackteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string meansOfDeath = 4 [(.Analytics.track_event) = true];
+      // string meansOfDeath = 4 [(.Analytics.track_event) = true, (.Analytics.intern) = "meansOfDeathId"];
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           auto str = _internal_mutable_meansofdeath();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameDeath.meansOfDeath"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameDeath.meansOfDeath"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 meansOfDeathId = 5 [(.Analytics.hidden) = true];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.meansofdeathid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameDeath::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameDeath::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameDeath)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::position(this), target, stream);
+      InternalWriteMessage(1, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->victimteam() != 0) {
+  if (this->_internal_victimteam() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_victimteam(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_victimteam(), target);
   }
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->attackteam() != 0) {
+  if (this->_internal_attackteam() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_attackteam(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_attackteam(), target);
   }
 
-  // string meansOfDeath = 4 [(.Analytics.track_event) = true];
-  if (this->meansofdeath().size() > 0) {
+  // string meansOfDeath = 4 [(.Analytics.track_event) = true, (.Analytics.intern) = "meansOfDeathId"];
+  if (!this->_internal_meansofdeath().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_meansofdeath().data(), static_cast<int>(this->_internal_meansofdeath().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -9548,9 +11442,15 @@ failure:
         4, this->_internal_meansofdeath(), target);
   }
 
+  // uint32 meansOfDeathId = 5 [(.Analytics.hidden) = true];
+  if (this->_internal_meansofdeathid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_meansofdeathid(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameDeath)
   return target;
@@ -9560,89 +11460,74 @@ size_t GameDeath::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameDeath)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string meansOfDeath = 4 [(.Analytics.track_event) = true];
-  if (this->meansofdeath().size() > 0) {
+  // string meansOfDeath = 4 [(.Analytics.track_event) = true, (.Analytics.intern) = "meansOfDeathId"];
+  if (!this->_internal_meansofdeath().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_meansofdeath());
   }
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *position_);
+        *_impl_.position_);
   }
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->victimteam() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_victimteam());
+  if (this->_internal_victimteam() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_victimteam());
   }
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->attackteam() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_attackteam());
+  if (this->_internal_attackteam() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_attackteam());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 meansOfDeathId = 5 [(.Analytics.hidden) = true];
+  if (this->_internal_meansofdeathid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_meansofdeathid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameDeath::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameDeath)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameDeath* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameDeath>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameDeath)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameDeath)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameDeath::MergeFrom(const GameDeath& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameDeath)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameDeath::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameDeath::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameDeath::GetClassData() const { return &_class_data_; }
+
 
-  if (from.meansofdeath().size() > 0) {
+void GameDeath::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameDeath*>(&to_msg);
+  auto& from = static_cast<const GameDeath&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameDeath)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    meansofdeath_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.meansofdeath_);
+  if (!from._internal_meansofdeath().empty()) {
+    _this->_internal_set_meansofdeath(from._internal_meansofdeath());
   }
-  if (from.has_position()) {
-    _internal_mutable_position()->::Analytics::Vec3::MergeFrom(from._internal_position());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::Analytics::Vec3::MergeFrom(
+        from._internal_position());
   }
-  if (from.victimteam() != 0) {
-    _internal_set_victimteam(from._internal_victimteam());
+  if (from._internal_victimteam() != 0) {
+    _this->_internal_set_victimteam(from._internal_victimteam());
   }
-  if (from.attackteam() != 0) {
-    _internal_set_attackteam(from._internal_attackteam());
+  if (from._internal_attackteam() != 0) {
+    _this->_internal_set_attackteam(from._internal_attackteam());
   }
-}
-
-void GameDeath::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameDeath)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_meansofdeathid() != 0) {
+    _this->_internal_set_meansofdeathid(from._internal_meansofdeathid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameDeath::CopyFrom(const GameDeath& from) {
@@ -9658,25 +11543,29 @@ bool GameDeath::IsInitialized() const {
 
 void GameDeath::InternalSwap(GameDeath* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  meansofdeath_.Swap(&other->meansofdeath_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(position_, other->position_);
-  swap(victimteam_, other->victimteam_);
-  swap(attackteam_, other->attackteam_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.meansofdeath_, lhs_arena,
+      &other->_impl_.meansofdeath_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameDeath, _impl_.meansofdeathid_)
+      + sizeof(GameDeath::_impl_.meansofdeathid_)
+      - PROTOBUF_FIELD_OFFSET(GameDeath, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameDeath::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[32]);
 }
 
-
 // ===================================================================
 
-void GameKilledSomeone::InitAsDefaultInstance() {
-  ::Analytics::_GameKilledSomeone_default_instance_._instance.get_mutable()->position_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-}
 class GameKilledSomeone::_Internal {
  public:
   static const ::Analytics::Vec3& position(const GameKilledSomeone* msg);
@@ -9684,161 +11573,195 @@ class GameKilledSomeone::_Internal {
 
 const ::Analytics::Vec3&
 GameKilledSomeone::_Internal::position(const GameKilledSomeone* msg) {
-  return *msg->position_;
+  return *msg->_impl_.position_;
 }
-GameKilledSomeone::GameKilledSomeone()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameKilledSomeone)
+GameKilledSomeone::GameKilledSomeone(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameKilledSomeone)
 }
 GameKilledSomeone::GameKilledSomeone(const GameKilledSomeone& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  meansofdeath_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameKilledSomeone* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.meansofdeath_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.victimteam_){}
+    , decltype(_impl_.attackteam_){}
+    , decltype(_impl_.meansofdeathid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.meansofdeath_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.meansofdeath_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_meansofdeath().empty()) {
-    meansofdeath_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.meansofdeath_);
+    _this->_impl_.meansofdeath_.Set(from._internal_meansofdeath(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_position()) {
-    position_ = new ::Analytics::Vec3(*from.position_);
-  } else {
-    position_ = nullptr;
+    _this->_impl_.position_ = new ::Analytics::Vec3(*from._impl_.position_);
   }
-  ::memcpy(&victimteam_, &from.victimteam_,
-    static_cast<size_t>(reinterpret_cast<char*>(&attackteam_) -
-    reinterpret_cast<char*>(&victimteam_)) + sizeof(attackteam_));
+  ::memcpy(&_impl_.victimteam_, &from._impl_.victimteam_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.meansofdeathid_) -
+    reinterpret_cast<char*>(&_impl_.victimteam_)) + sizeof(_impl_.meansofdeathid_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameKilledSomeone)
 }
 
-void GameKilledSomeone::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameKilledSomeone_analytics_2eproto.base);
-  meansofdeath_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&attackteam_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(attackteam_));
+inline void GameKilledSomeone::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.meansofdeath_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.victimteam_){0}
+    , decltype(_impl_.attackteam_){0}
+    , decltype(_impl_.meansofdeathid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.meansofdeath_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.meansofdeath_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameKilledSomeone::~GameKilledSomeone() {
   // @@protoc_insertion_point(destructor:Analytics.GameKilledSomeone)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameKilledSomeone::SharedDtor() {
-  meansofdeath_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete position_;
+inline void GameKilledSomeone::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.meansofdeath_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.position_;
 }
 
 void GameKilledSomeone::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameKilledSomeone& GameKilledSomeone::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameKilledSomeone_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameKilledSomeone::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameKilledSomeone)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  meansofdeath_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  _impl_.meansofdeath_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
-  ::memset(&victimteam_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&attackteam_) -
-      reinterpret_cast<char*>(&victimteam_)) + sizeof(attackteam_));
-  _internal_metadata_.Clear();
+  _impl_.position_ = nullptr;
+  ::memset(&_impl_.victimteam_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.meansofdeathid_) -
+      reinterpret_cast<char*>(&_impl_.victimteam_)) + sizeof(_impl_.meansofdeathid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameKilledSomeone::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameKilledSomeone::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          victimteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.victimteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          attackteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.attackteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string meansOfDeath = 4 [(.Analytics.track_event) = true];
+      // string meansOfDeath = 4 [(.Analytics.track_event) = true, (.Analytics.intern) = "meansOfDeathId"];
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           auto str = _internal_mutable_meansofdeath();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameKilledSomeone.meansOfDeath"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameKilledSomeone.meansOfDeath"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 meansOfDeathId = 5 [(.Analytics.hidden) = true];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.meansofdeathid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameKilledSomeone::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameKilledSomeone::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameKilledSomeone)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::position(this), target, stream);
+      InternalWriteMessage(1, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->victimteam() != 0) {
+  if (this->_internal_victimteam() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_victimteam(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_victimteam(), target);
   }
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->attackteam() != 0) {
+  if (this->_internal_attackteam() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_attackteam(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_attackteam(), target);
   }
 
-  // string meansOfDeath = 4 [(.Analytics.track_event) = true];
-  if (this->meansofdeath().size() > 0) {
+  // string meansOfDeath = 4 [(.Analytics.track_event) = true, (.Analytics.intern) = "meansOfDeathId"];
+  if (!this->_internal_meansofdeath().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_meansofdeath().data(), static_cast<int>(this->_internal_meansofdeath().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -9847,9 +11770,15 @@ failure:
         4, this->_internal_meansofdeath(), target);
   }
 
+  // uint32 meansOfDeathId = 5 [(.Analytics.hidden) = true];
+  if (this->_internal_meansofdeathid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_meansofdeathid(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameKilledSomeone)
   return target;
@@ -9859,89 +11788,74 @@ size_t GameKilledSomeone::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameKilledSomeone)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string meansOfDeath = 4 [(.Analytics.track_event) = true];
-  if (this->meansofdeath().size() > 0) {
+  // string meansOfDeath = 4 [(.Analytics.track_event) = true, (.Analytics.intern) = "meansOfDeathId"];
+  if (!this->_internal_meansofdeath().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_meansofdeath());
   }
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *position_);
+        *_impl_.position_);
   }
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->victimteam() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_victimteam());
+  if (this->_internal_victimteam() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_victimteam());
   }
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->attackteam() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_attackteam());
+  if (this->_internal_attackteam() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_attackteam());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 meansOfDeathId = 5 [(.Analytics.hidden) = true];
+  if (this->_internal_meansofdeathid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_meansofdeathid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameKilledSomeone::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameKilledSomeone)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameKilledSomeone* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameKilledSomeone>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameKilledSomeone)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameKilledSomeone)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameKilledSomeone::MergeFrom(const GameKilledSomeone& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameKilledSomeone)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameKilledSomeone::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameKilledSomeone::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameKilledSomeone::GetClassData() const { return &_class_data_; }
+
 
-  if (from.meansofdeath().size() > 0) {
+void GameKilledSomeone::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameKilledSomeone*>(&to_msg);
+  auto& from = static_cast<const GameKilledSomeone&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameKilledSomeone)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    meansofdeath_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.meansofdeath_);
+  if (!from._internal_meansofdeath().empty()) {
+    _this->_internal_set_meansofdeath(from._internal_meansofdeath());
   }
-  if (from.has_position()) {
-    _internal_mutable_position()->::Analytics::Vec3::MergeFrom(from._internal_position());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::Analytics::Vec3::MergeFrom(
+        from._internal_position());
   }
-  if (from.victimteam() != 0) {
-    _internal_set_victimteam(from._internal_victimteam());
+  if (from._internal_victimteam() != 0) {
+    _this->_internal_set_victimteam(from._internal_victimteam());
   }
-  if (from.attackteam() != 0) {
-    _internal_set_attackteam(from._internal_attackteam());
+  if (from._internal_attackteam() != 0) {
+    _this->_internal_set_attackteam(from._internal_attackteam());
   }
-}
-
-void GameKilledSomeone::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameKilledSomeone)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_meansofdeathid() != 0) {
+    _this->_internal_set_meansofdeathid(from._internal_meansofdeathid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameKilledSomeone::CopyFrom(const GameKilledSomeone& from) {
@@ -9957,25 +11871,29 @@ bool GameKilledSomeone::IsInitialized() const {
 
 void GameKilledSomeone::InternalSwap(GameKilledSomeone* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  meansofdeath_.Swap(&other->meansofdeath_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(position_, other->position_);
-  swap(victimteam_, other->victimteam_);
-  swap(attackteam_, other->attackteam_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.meansofdeath_, lhs_arena,
+      &other->_impl_.meansofdeath_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameKilledSomeone, _impl_.meansofdeathid_)
+      + sizeof(GameKilledSomeone::_impl_.meansofdeathid_)
+      - PROTOBUF_FIELD_OFFSET(GameKilledSomeone, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameKilledSomeone::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[33]);
 }
 
-
 // ===================================================================
 
-void GameRecieveDamage::InitAsDefaultInstance() {
-  ::Analytics::_GameRecieveDamage_default_instance_._instance.get_mutable()->position_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-}
 class GameRecieveDamage::_Internal {
  public:
   static const ::Analytics::Vec3& position(const GameRecieveDamage* msg);
@@ -9983,181 +11901,221 @@ class GameRecieveDamage::_Internal {
 
 const ::Analytics::Vec3&
 GameRecieveDamage::_Internal::position(const GameRecieveDamage* msg) {
-  return *msg->position_;
+  return *msg->_impl_.position_;
 }
-GameRecieveDamage::GameRecieveDamage()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameRecieveDamage)
+GameRecieveDamage::GameRecieveDamage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameRecieveDamage)
 }
 GameRecieveDamage::GameRecieveDamage(const GameRecieveDamage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  damagetype_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameRecieveDamage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.damagetype_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.victimteam_){}
+    , decltype(_impl_.attackteam_){}
+    , decltype(_impl_.weaponid_){}
+    , decltype(_impl_.damageamount_){}
+    , decltype(_impl_.damagetypeid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.damagetype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.damagetype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_damagetype().empty()) {
-    damagetype_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.damagetype_);
+    _this->_impl_.damagetype_.Set(from._internal_damagetype(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_position()) {
-    position_ = new ::Analytics::Vec3(*from.position_);
-  } else {
-    position_ = nullptr;
+    _this->_impl_.position_ = new ::Analytics::Vec3(*from._impl_.position_);
   }
-  ::memcpy(&victimteam_, &from.victimteam_,
-    static_cast<size_t>(reinterpret_cast<char*>(&damageamount_) -
-    reinterpret_cast<char*>(&victimteam_)) + sizeof(damageamount_));
+  ::memcpy(&_impl_.victimteam_, &from._impl_.victimteam_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.damagetypeid_) -
+    reinterpret_cast<char*>(&_impl_.victimteam_)) + sizeof(_impl_.damagetypeid_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameRecieveDamage)
 }
 
-void GameRecieveDamage::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameRecieveDamage_analytics_2eproto.base);
-  damagetype_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&damageamount_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(damageamount_));
+inline void GameRecieveDamage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.damagetype_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.victimteam_){0}
+    , decltype(_impl_.attackteam_){0}
+    , decltype(_impl_.weaponid_){0}
+    , decltype(_impl_.damageamount_){0}
+    , decltype(_impl_.damagetypeid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.damagetype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.damagetype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameRecieveDamage::~GameRecieveDamage() {
   // @@protoc_insertion_point(destructor:Analytics.GameRecieveDamage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameRecieveDamage::SharedDtor() {
-  damagetype_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete position_;
+inline void GameRecieveDamage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.damagetype_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.position_;
 }
 
 void GameRecieveDamage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameRecieveDamage& GameRecieveDamage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameRecieveDamage_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameRecieveDamage::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameRecieveDamage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  damagetype_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  _impl_.damagetype_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
-  ::memset(&victimteam_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&damageamount_) -
-      reinterpret_cast<char*>(&victimteam_)) + sizeof(damageamount_));
-  _internal_metadata_.Clear();
+  _impl_.position_ = nullptr;
+  ::memset(&_impl_.victimteam_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.damagetypeid_) -
+      reinterpret_cast<char*>(&_impl_.victimteam_)) + sizeof(_impl_.damagetypeid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameRecieveDamage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameRecieveDamage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          victimteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.victimteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          attackteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.attackteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 weaponId = 4 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          weaponid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.weaponid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string damageType = 5 [(.Analytics.track_event) = true];
+      // string damageType = 5 [(.Analytics.track_event) = true, (.Analytics.intern) = "damageTypeId"];
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           auto str = _internal_mutable_damagetype();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameRecieveDamage.damageType"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameRecieveDamage.damageType"));
+        } else
+          goto handle_unusual;
         continue;
       // float damageAmount = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 53)) {
-          damageamount_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _impl_.damageamount_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 damageTypeId = 7 [(.Analytics.hidden) = true];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.damagetypeid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameRecieveDamage::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameRecieveDamage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameRecieveDamage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::position(this), target, stream);
+      InternalWriteMessage(1, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->victimteam() != 0) {
+  if (this->_internal_victimteam() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_victimteam(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_victimteam(), target);
   }
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->attackteam() != 0) {
+  if (this->_internal_attackteam() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_attackteam(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_attackteam(), target);
   }
 
   // int32 weaponId = 4 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
-  if (this->weaponid() != 0) {
+  if (this->_internal_weaponid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_weaponid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_weaponid(), target);
   }
 
-  // string damageType = 5 [(.Analytics.track_event) = true];
-  if (this->damagetype().size() > 0) {
+  // string damageType = 5 [(.Analytics.track_event) = true, (.Analytics.intern) = "damageTypeId"];
+  if (!this->_internal_damagetype().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_damagetype().data(), static_cast<int>(this->_internal_damagetype().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -10167,14 +12125,24 @@ failure:
   }
 
   // float damageAmount = 6;
-  if (!(this->damageamount() <= 0 && this->damageamount() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageamount = this->_internal_damageamount();
+  uint32_t raw_damageamount;
+  memcpy(&raw_damageamount, &tmp_damageamount, sizeof(tmp_damageamount));
+  if (raw_damageamount != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_damageamount(), target);
+  }
+
+  // uint32 damageTypeId = 7 [(.Analytics.hidden) = true];
+  if (this->_internal_damagetypeid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(6, this->_internal_damageamount(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_damagetypeid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameRecieveDamage)
   return target;
@@ -10184,107 +12152,98 @@ size_t GameRecieveDamage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameRecieveDamage)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string damageType = 5 [(.Analytics.track_event) = true];
-  if (this->damagetype().size() > 0) {
+  // string damageType = 5 [(.Analytics.track_event) = true, (.Analytics.intern) = "damageTypeId"];
+  if (!this->_internal_damagetype().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_damagetype());
   }
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *position_);
+        *_impl_.position_);
   }
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->victimteam() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_victimteam());
+  if (this->_internal_victimteam() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_victimteam());
   }
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->attackteam() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_attackteam());
+  if (this->_internal_attackteam() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_attackteam());
   }
 
   // int32 weaponId = 4 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
-  if (this->weaponid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_weaponid());
+  if (this->_internal_weaponid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_weaponid());
   }
 
   // float damageAmount = 6;
-  if (!(this->damageamount() <= 0 && this->damageamount() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageamount = this->_internal_damageamount();
+  uint32_t raw_damageamount;
+  memcpy(&raw_damageamount, &tmp_damageamount, sizeof(tmp_damageamount));
+  if (raw_damageamount != 0) {
     total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 damageTypeId = 7 [(.Analytics.hidden) = true];
+  if (this->_internal_damagetypeid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_damagetypeid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameRecieveDamage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameRecieveDamage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameRecieveDamage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameRecieveDamage>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameRecieveDamage)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameRecieveDamage)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameRecieveDamage::MergeFrom(const GameRecieveDamage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameRecieveDamage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameRecieveDamage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameRecieveDamage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameRecieveDamage::GetClassData() const { return &_class_data_; }
 
-  if (from.damagetype().size() > 0) {
 
-    damagetype_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.damagetype_);
+void GameRecieveDamage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameRecieveDamage*>(&to_msg);
+  auto& from = static_cast<const GameRecieveDamage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameRecieveDamage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_damagetype().empty()) {
+    _this->_internal_set_damagetype(from._internal_damagetype());
+  }
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::Analytics::Vec3::MergeFrom(
+        from._internal_position());
   }
-  if (from.has_position()) {
-    _internal_mutable_position()->::Analytics::Vec3::MergeFrom(from._internal_position());
+  if (from._internal_victimteam() != 0) {
+    _this->_internal_set_victimteam(from._internal_victimteam());
   }
-  if (from.victimteam() != 0) {
-    _internal_set_victimteam(from._internal_victimteam());
+  if (from._internal_attackteam() != 0) {
+    _this->_internal_set_attackteam(from._internal_attackteam());
   }
-  if (from.attackteam() != 0) {
-    _internal_set_attackteam(from._internal_attackteam());
+  if (from._internal_weaponid() != 0) {
+    _this->_internal_set_weaponid(from._internal_weaponid());
   }
-  if (from.weaponid() != 0) {
-    _internal_set_weaponid(from._internal_weaponid());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageamount = from._internal_damageamount();
+  uint32_t raw_damageamount;
+  memcpy(&raw_damageamount, &tmp_damageamount, sizeof(tmp_damageamount));
+  if (raw_damageamount != 0) {
+    _this->_internal_set_damageamount(from._internal_damageamount());
   }
-  if (!(from.damageamount() <= 0 && from.damageamount() >= 0)) {
-    _internal_set_damageamount(from._internal_damageamount());
+  if (from._internal_damagetypeid() != 0) {
+    _this->_internal_set_damagetypeid(from._internal_damagetypeid());
   }
-}
-
-void GameRecieveDamage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameRecieveDamage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameRecieveDamage::CopyFrom(const GameRecieveDamage& from) {
@@ -10300,27 +12259,29 @@ bool GameRecieveDamage::IsInitialized() const {
 
 void GameRecieveDamage::InternalSwap(GameRecieveDamage* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  damagetype_.Swap(&other->damagetype_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(position_, other->position_);
-  swap(victimteam_, other->victimteam_);
-  swap(attackteam_, other->attackteam_);
-  swap(weaponid_, other->weaponid_);
-  swap(damageamount_, other->damageamount_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.damagetype_, lhs_arena,
+      &other->_impl_.damagetype_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameRecieveDamage, _impl_.damagetypeid_)
+      + sizeof(GameRecieveDamage::_impl_.damagetypeid_)
+      - PROTOBUF_FIELD_OFFSET(GameRecieveDamage, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameRecieveDamage::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[34]);
 }
 
-
 // ===================================================================
 
-void GameInflictDamage::InitAsDefaultInstance() {
-  ::Analytics::_GameInflictDamage_default_instance_._instance.get_mutable()->position_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-}
 class GameInflictDamage::_Internal {
  public:
   static const ::Analytics::Vec3& position(const GameInflictDamage* msg);
@@ -10328,181 +12289,221 @@ class GameInflictDamage::_Internal {
 
 const ::Analytics::Vec3&
 GameInflictDamage::_Internal::position(const GameInflictDamage* msg) {
-  return *msg->position_;
+  return *msg->_impl_.position_;
 }
-GameInflictDamage::GameInflictDamage()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameInflictDamage)
+GameInflictDamage::GameInflictDamage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameInflictDamage)
 }
 GameInflictDamage::GameInflictDamage(const GameInflictDamage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  damagetype_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameInflictDamage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.damagetype_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.victimteam_){}
+    , decltype(_impl_.attackteam_){}
+    , decltype(_impl_.weaponid_){}
+    , decltype(_impl_.damageamount_){}
+    , decltype(_impl_.damagetypeid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.damagetype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.damagetype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_damagetype().empty()) {
-    damagetype_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.damagetype_);
+    _this->_impl_.damagetype_.Set(from._internal_damagetype(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_position()) {
-    position_ = new ::Analytics::Vec3(*from.position_);
-  } else {
-    position_ = nullptr;
+    _this->_impl_.position_ = new ::Analytics::Vec3(*from._impl_.position_);
   }
-  ::memcpy(&victimteam_, &from.victimteam_,
-    static_cast<size_t>(reinterpret_cast<char*>(&damageamount_) -
-    reinterpret_cast<char*>(&victimteam_)) + sizeof(damageamount_));
+  ::memcpy(&_impl_.victimteam_, &from._impl_.victimteam_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.damagetypeid_) -
+    reinterpret_cast<char*>(&_impl_.victimteam_)) + sizeof(_impl_.damagetypeid_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameInflictDamage)
 }
 
-void GameInflictDamage::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameInflictDamage_analytics_2eproto.base);
-  damagetype_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&damageamount_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(damageamount_));
+inline void GameInflictDamage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.damagetype_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.victimteam_){0}
+    , decltype(_impl_.attackteam_){0}
+    , decltype(_impl_.weaponid_){0}
+    , decltype(_impl_.damageamount_){0}
+    , decltype(_impl_.damagetypeid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.damagetype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.damagetype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameInflictDamage::~GameInflictDamage() {
   // @@protoc_insertion_point(destructor:Analytics.GameInflictDamage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameInflictDamage::SharedDtor() {
-  damagetype_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete position_;
+inline void GameInflictDamage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.damagetype_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.position_;
 }
 
 void GameInflictDamage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const GameInflictDamage& GameInflictDamage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameInflictDamage_analytics_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void GameInflictDamage::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameInflictDamage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  damagetype_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  _impl_.damagetype_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
-  ::memset(&victimteam_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&damageamount_) -
-      reinterpret_cast<char*>(&victimteam_)) + sizeof(damageamount_));
-  _internal_metadata_.Clear();
+  _impl_.position_ = nullptr;
+  ::memset(&_impl_.victimteam_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.damagetypeid_) -
+      reinterpret_cast<char*>(&_impl_.victimteam_)) + sizeof(_impl_.damagetypeid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameInflictDamage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameInflictDamage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          victimteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.victimteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          attackteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.attackteam_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 weaponId = 4 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          weaponid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.weaponid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string damageType = 5 [(.Analytics.track_event) = true];
+      // string damageType = 5 [(.Analytics.track_event) = true, (.Analytics.intern) = "damageTypeId"];
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           auto str = _internal_mutable_damagetype();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameInflictDamage.damageType"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameInflictDamage.damageType"));
+        } else
+          goto handle_unusual;
         continue;
       // float damageAmount = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 53)) {
-          damageamount_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _impl_.damageamount_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 damageTypeId = 7 [(.Analytics.hidden) = true];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.damagetypeid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameInflictDamage::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameInflictDamage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameInflictDamage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::position(this), target, stream);
+      InternalWriteMessage(1, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->victimteam() != 0) {
+  if (this->_internal_victimteam() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_victimteam(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_victimteam(), target);
   }
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->attackteam() != 0) {
+  if (this->_internal_attackteam() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_attackteam(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_attackteam(), target);
   }
 
   // int32 weaponId = 4 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
-  if (this->weaponid() != 0) {
+  if (this->_internal_weaponid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_weaponid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_weaponid(), target);
   }
 
-  // string damageType = 5 [(.Analytics.track_event) = true];
-  if (this->damagetype().size() > 0) {
+  // string damageType = 5 [(.Analytics.track_event) = true, (.Analytics.intern) = "damageTypeId"];
+  if (!this->_internal_damagetype().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_damagetype().data(), static_cast<int>(this->_internal_damagetype().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -10512,14 +12513,24 @@ failure:
   }
 
   // float damageAmount = 6;
-  if (!(this->damageamount() <= 0 && this->damageamount() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageamount = this->_internal_damageamount();
+  uint32_t raw_damageamount;
+  memcpy(&raw_damageamount, &tmp_damageamount, sizeof(tmp_damageamount));
+  if (raw_damageamount != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(6, this->_internal_damageamount(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_damageamount(), target);
+  }
+
+  // uint32 damageTypeId = 7 [(.Analytics.hidden) = true];
+  if (this->_internal_damagetypeid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_damagetypeid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameInflictDamage)
   return target;
@@ -10529,107 +12540,98 @@ size_t GameInflictDamage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameInflictDamage)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string damageType = 5 [(.Analytics.track_event) = true];
-  if (this->damagetype().size() > 0) {
+  // string damageType = 5 [(.Analytics.track_event) = true, (.Analytics.intern) = "damageTypeId"];
+  if (!this->_internal_damagetype().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_damagetype());
   }
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *position_);
+        *_impl_.position_);
   }
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->victimteam() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_victimteam());
+  if (this->_internal_victimteam() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_victimteam());
   }
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
-  if (this->attackteam() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_attackteam());
+  if (this->_internal_attackteam() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_attackteam());
   }
 
   // int32 weaponId = 4 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
-  if (this->weaponid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_weaponid());
+  if (this->_internal_weaponid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_weaponid());
   }
 
   // float damageAmount = 6;
-  if (!(this->damageamount() <= 0 && this->damageamount() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageamount = this->_internal_damageamount();
+  uint32_t raw_damageamount;
+  memcpy(&raw_damageamount, &tmp_damageamount, sizeof(tmp_damageamount));
+  if (raw_damageamount != 0) {
     total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 damageTypeId = 7 [(.Analytics.hidden) = true];
+  if (this->_internal_damagetypeid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_damagetypeid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameInflictDamage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameInflictDamage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameInflictDamage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameInflictDamage>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameInflictDamage)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameInflictDamage)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameInflictDamage::MergeFrom(const GameInflictDamage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameInflictDamage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameInflictDamage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameInflictDamage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameInflictDamage::GetClassData() const { return &_class_data_; }
+
 
-  if (from.damagetype().size() > 0) {
+void GameInflictDamage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameInflictDamage*>(&to_msg);
+  auto& from = static_cast<const GameInflictDamage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameInflictDamage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    damagetype_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.damagetype_);
+  if (!from._internal_damagetype().empty()) {
+    _this->_internal_set_damagetype(from._internal_damagetype());
   }
-  if (from.has_position()) {
-    _internal_mutable_position()->::Analytics::Vec3::MergeFrom(from._internal_position());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::Analytics::Vec3::MergeFrom(
+        from._internal_position());
   }
-  if (from.victimteam() != 0) {
-    _internal_set_victimteam(from._internal_victimteam());
+  if (from._internal_victimteam() != 0) {
+    _this->_internal_set_victimteam(from._internal_victimteam());
   }
-  if (from.attackteam() != 0) {
-    _internal_set_attackteam(from._internal_attackteam());
+  if (from._internal_attackteam() != 0) {
+    _this->_internal_set_attackteam(from._internal_attackteam());
   }
-  if (from.weaponid() != 0) {
-    _internal_set_weaponid(from._internal_weaponid());
+  if (from._internal_weaponid() != 0) {
+    _this->_internal_set_weaponid(from._internal_weaponid());
   }
-  if (!(from.damageamount() <= 0 && from.damageamount() >= 0)) {
-    _internal_set_damageamount(from._internal_damageamount());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageamount = from._internal_damageamount();
+  uint32_t raw_damageamount;
+  memcpy(&raw_damageamount, &tmp_damageamount, sizeof(tmp_damageamount));
+  if (raw_damageamount != 0) {
+    _this->_internal_set_damageamount(from._internal_damageamount());
   }
-}
-
-void GameInflictDamage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameInflictDamage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_damagetypeid() != 0) {
+    _this->_internal_set_damagetypeid(from._internal_damagetypeid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameInflictDamage::CopyFrom(const GameInflictDamage& from) {
@@ -10645,27 +12647,29 @@ bool GameInflictDamage::IsInitialized() const {
 
 void GameInflictDamage::InternalSwap(GameInflictDamage* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  damagetype_.Swap(&other->damagetype_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(position_, other->position_);
-  swap(victimteam_, other->victimteam_);
-  swap(attackteam_, other->attackteam_);
-  swap(weaponid_, other->weaponid_);
-  swap(damageamount_, other->damageamount_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.damagetype_, lhs_arena,
+      &other->_impl_.damagetype_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameInflictDamage, _impl_.damagetypeid_)
+      + sizeof(GameInflictDamage::_impl_.damagetypeid_)
+      - PROTOBUF_FIELD_OFFSET(GameInflictDamage, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameInflictDamage::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[35]);
 }
 
-
 // ===================================================================
 
-void GameRadiusDamage::InitAsDefaultInstance() {
-  ::Analytics::_GameRadiusDamage_default_instance_._instance.get_mutable()->position_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-}
 class GameRadiusDamage::_Internal {
  public:
   static const ::Analytics::Vec3& position(const GameRadiusDamage* msg);
@@ -10673,149 +12677,183 @@ class GameRadiusDamage::_Internal {
 
 const ::Analytics::Vec3&
 GameRadiusDamage::_Internal::position(const GameRadiusDamage* msg) {
-  return *msg->position_;
+  return *msg->_impl_.position_;
 }
-GameRadiusDamage::GameRadiusDamage()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameRadiusDamage)
+GameRadiusDamage::GameRadiusDamage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameRadiusDamage)
 }
 GameRadiusDamage::GameRadiusDamage(const GameRadiusDamage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  damagetype_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameRadiusDamage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.damagetype_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.damageamount_){}
+    , decltype(_impl_.damageradius_){}
+    , decltype(_impl_.damagetypeid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.damagetype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.damagetype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_damagetype().empty()) {
-    damagetype_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.damagetype_);
+    _this->_impl_.damagetype_.Set(from._internal_damagetype(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_position()) {
-    position_ = new ::Analytics::Vec3(*from.position_);
-  } else {
-    position_ = nullptr;
+    _this->_impl_.position_ = new ::Analytics::Vec3(*from._impl_.position_);
   }
-  ::memcpy(&damageamount_, &from.damageamount_,
-    static_cast<size_t>(reinterpret_cast<char*>(&damageradius_) -
-    reinterpret_cast<char*>(&damageamount_)) + sizeof(damageradius_));
+  ::memcpy(&_impl_.damageamount_, &from._impl_.damageamount_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.damagetypeid_) -
+    reinterpret_cast<char*>(&_impl_.damageamount_)) + sizeof(_impl_.damagetypeid_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameRadiusDamage)
 }
 
-void GameRadiusDamage::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameRadiusDamage_analytics_2eproto.base);
-  damagetype_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&damageradius_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(damageradius_));
+inline void GameRadiusDamage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.damagetype_){}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.damageamount_){0}
+    , decltype(_impl_.damageradius_){0}
+    , decltype(_impl_.damagetypeid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.damagetype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.damagetype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameRadiusDamage::~GameRadiusDamage() {
   // @@protoc_insertion_point(destructor:Analytics.GameRadiusDamage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameRadiusDamage::SharedDtor() {
-  damagetype_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete position_;
+inline void GameRadiusDamage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.damagetype_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.position_;
 }
 
 void GameRadiusDamage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameRadiusDamage& GameRadiusDamage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameRadiusDamage_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameRadiusDamage::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameRadiusDamage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  damagetype_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  _impl_.damagetype_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
-  ::memset(&damageamount_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&damageradius_) -
-      reinterpret_cast<char*>(&damageamount_)) + sizeof(damageradius_));
-  _internal_metadata_.Clear();
+  _impl_.position_ = nullptr;
+  ::memset(&_impl_.damageamount_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.damagetypeid_) -
+      reinterpret_cast<char*>(&_impl_.damageamount_)) + sizeof(_impl_.damagetypeid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameRadiusDamage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameRadiusDamage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string damageType = 2;
+      // string damageType = 2 [(.Analytics.intern) = "damageTypeId"];
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_damagetype();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameRadiusDamage.damageType"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameRadiusDamage.damageType"));
+        } else
+          goto handle_unusual;
         continue;
       // float damageAmount = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
-          damageamount_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.damageamount_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // float damageRadius = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 37)) {
-          damageradius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.damageradius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 damageTypeId = 5 [(.Analytics.hidden) = true];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.damagetypeid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameRadiusDamage::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameRadiusDamage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameRadiusDamage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::position(this), target, stream);
+      InternalWriteMessage(1, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
-  // string damageType = 2;
-  if (this->damagetype().size() > 0) {
+  // string damageType = 2 [(.Analytics.intern) = "damageTypeId"];
+  if (!this->_internal_damagetype().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_damagetype().data(), static_cast<int>(this->_internal_damagetype().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -10825,20 +12863,34 @@ failure:
   }
 
   // float damageAmount = 3;
-  if (!(this->damageamount() <= 0 && this->damageamount() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageamount = this->_internal_damageamount();
+  uint32_t raw_damageamount;
+  memcpy(&raw_damageamount, &tmp_damageamount, sizeof(tmp_damageamount));
+  if (raw_damageamount != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(3, this->_internal_damageamount(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_damageamount(), target);
   }
 
   // float damageRadius = 4;
-  if (!(this->damageradius() <= 0 && this->damageradius() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageradius = this->_internal_damageradius();
+  uint32_t raw_damageradius;
+  memcpy(&raw_damageradius, &tmp_damageradius, sizeof(tmp_damageradius));
+  if (raw_damageradius != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_damageradius(), target);
+  }
+
+  // uint32 damageTypeId = 5 [(.Analytics.hidden) = true];
+  if (this->_internal_damagetypeid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(4, this->_internal_damageradius(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_damagetypeid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameRadiusDamage)
   return target;
@@ -10848,85 +12900,90 @@ size_t GameRadiusDamage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameRadiusDamage)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string damageType = 2;
-  if (this->damagetype().size() > 0) {
+  // string damageType = 2 [(.Analytics.intern) = "damageTypeId"];
+  if (!this->_internal_damagetype().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_damagetype());
   }
 
   // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *position_);
+        *_impl_.position_);
   }
 
   // float damageAmount = 3;
-  if (!(this->damageamount() <= 0 && this->damageamount() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageamount = this->_internal_damageamount();
+  uint32_t raw_damageamount;
+  memcpy(&raw_damageamount, &tmp_damageamount, sizeof(tmp_damageamount));
+  if (raw_damageamount != 0) {
     total_size += 1 + 4;
   }
 
   // float damageRadius = 4;
-  if (!(this->damageradius() <= 0 && this->damageradius() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageradius = this->_internal_damageradius();
+  uint32_t raw_damageradius;
+  memcpy(&raw_damageradius, &tmp_damageradius, sizeof(tmp_damageradius));
+  if (raw_damageradius != 0) {
     total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 damageTypeId = 5 [(.Analytics.hidden) = true];
+  if (this->_internal_damagetypeid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_damagetypeid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameRadiusDamage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameRadiusDamage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameRadiusDamage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameRadiusDamage>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameRadiusDamage)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameRadiusDamage)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameRadiusDamage::MergeFrom(const GameRadiusDamage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameRadiusDamage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameRadiusDamage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameRadiusDamage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameRadiusDamage::GetClassData() const { return &_class_data_; }
+
 
-  if (from.damagetype().size() > 0) {
+void GameRadiusDamage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameRadiusDamage*>(&to_msg);
+  auto& from = static_cast<const GameRadiusDamage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameRadiusDamage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    damagetype_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.damagetype_);
+  if (!from._internal_damagetype().empty()) {
+    _this->_internal_set_damagetype(from._internal_damagetype());
   }
-  if (from.has_position()) {
-    _internal_mutable_position()->::Analytics::Vec3::MergeFrom(from._internal_position());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::Analytics::Vec3::MergeFrom(
+        from._internal_position());
   }
-  if (!(from.damageamount() <= 0 && from.damageamount() >= 0)) {
-    _internal_set_damageamount(from._internal_damageamount());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageamount = from._internal_damageamount();
+  uint32_t raw_damageamount;
+  memcpy(&raw_damageamount, &tmp_damageamount, sizeof(tmp_damageamount));
+  if (raw_damageamount != 0) {
+    _this->_internal_set_damageamount(from._internal_damageamount());
   }
-  if (!(from.damageradius() <= 0 && from.damageradius() >= 0)) {
-    _internal_set_damageradius(from._internal_damageradius());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_damageradius = from._internal_damageradius();
+  uint32_t raw_damageradius;
+  memcpy(&raw_damageradius, &tmp_damageradius, sizeof(tmp_damageradius));
+  if (raw_damageradius != 0) {
+    _this->_internal_set_damageradius(from._internal_damageradius());
   }
-}
-
-void GameRadiusDamage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameRadiusDamage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_damagetypeid() != 0) {
+    _this->_internal_set_damagetypeid(from._internal_damagetypeid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameRadiusDamage::CopyFrom(const GameRadiusDamage& from) {
@@ -10942,25 +12999,29 @@ bool GameRadiusDamage::IsInitialized() const {
 
 void GameRadiusDamage::InternalSwap(GameRadiusDamage* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  damagetype_.Swap(&other->damagetype_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(position_, other->position_);
-  swap(damageamount_, other->damageamount_);
-  swap(damageradius_, other->damageradius_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.damagetype_, lhs_arena,
+      &other->_impl_.damagetype_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameRadiusDamage, _impl_.damagetypeid_)
+      + sizeof(GameRadiusDamage::_impl_.damagetypeid_)
+      - PROTOBUF_FIELD_OFFSET(GameRadiusDamage, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameRadiusDamage::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[36]);
 }
 
-
 // ===================================================================
 
-void GameNavigationStuck::InitAsDefaultInstance() {
-  ::Analytics::_GameNavigationStuck_default_instance_._instance.get_mutable()->position_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-}
 class GameNavigationStuck::_Internal {
  public:
   static const ::Analytics::Vec3& position(const GameNavigationStuck* msg);
@@ -10968,129 +13029,140 @@ class GameNavigationStuck::_Internal {
 
 const ::Analytics::Vec3&
 GameNavigationStuck::_Internal::position(const GameNavigationStuck* msg) {
-  return *msg->position_;
+  return *msg->_impl_.position_;
 }
-GameNavigationStuck::GameNavigationStuck()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameNavigationStuck)
+GameNavigationStuck::GameNavigationStuck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameNavigationStuck)
 }
 GameNavigationStuck::GameNavigationStuck(const GameNavigationStuck& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameNavigationStuck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.entityid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_position()) {
-    position_ = new ::Analytics::Vec3(*from.position_);
-  } else {
-    position_ = nullptr;
+    _this->_impl_.position_ = new ::Analytics::Vec3(*from._impl_.position_);
   }
-  entityid_ = from.entityid_;
+  _this->_impl_.entityid_ = from._impl_.entityid_;
   // @@protoc_insertion_point(copy_constructor:Analytics.GameNavigationStuck)
 }
 
-void GameNavigationStuck::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameNavigationStuck_analytics_2eproto.base);
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&entityid_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(entityid_));
+inline void GameNavigationStuck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.entityid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 GameNavigationStuck::~GameNavigationStuck() {
   // @@protoc_insertion_point(destructor:Analytics.GameNavigationStuck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameNavigationStuck::SharedDtor() {
-  if (this != internal_default_instance()) delete position_;
+inline void GameNavigationStuck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.position_;
 }
 
 void GameNavigationStuck::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameNavigationStuck& GameNavigationStuck::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameNavigationStuck_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameNavigationStuck::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameNavigationStuck)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
-  entityid_ = 0;
-  _internal_metadata_.Clear();
+  _impl_.position_ = nullptr;
+  _impl_.entityid_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameNavigationStuck::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameNavigationStuck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 entityId = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          entityid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.entityid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.Vec3 position = 2 [(.Analytics.point_event) = {
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameNavigationStuck::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameNavigationStuck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameNavigationStuck)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 entityId = 1;
-  if (this->entityid() != 0) {
+  if (this->_internal_entityid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_entityid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_entityid(), target);
   }
 
   // .Analytics.Vec3 position = 2 [(.Analytics.point_event) = {
-  if (this->has_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::position(this), target, stream);
+      InternalWriteMessage(2, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameNavigationStuck)
   return target;
@@ -11100,68 +13172,48 @@ size_t GameNavigationStuck::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameNavigationStuck)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // .Analytics.Vec3 position = 2 [(.Analytics.point_event) = {
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *position_);
+        *_impl_.position_);
   }
 
   // int32 entityId = 1;
-  if (this->entityid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_entityid());
+  if (this->_internal_entityid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entityid());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameNavigationStuck::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameNavigationStuck)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameNavigationStuck* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameNavigationStuck>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameNavigationStuck)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameNavigationStuck)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameNavigationStuck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameNavigationStuck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameNavigationStuck::GetClassData() const { return &_class_data_; }
 
-void GameNavigationStuck::MergeFrom(const GameNavigationStuck& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameNavigationStuck)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void GameNavigationStuck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameNavigationStuck*>(&to_msg);
+  auto& from = static_cast<const GameNavigationStuck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameNavigationStuck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_position()) {
-    _internal_mutable_position()->::Analytics::Vec3::MergeFrom(from._internal_position());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::Analytics::Vec3::MergeFrom(
+        from._internal_position());
   }
-  if (from.entityid() != 0) {
-    _internal_set_entityid(from._internal_entityid());
+  if (from._internal_entityid() != 0) {
+    _this->_internal_set_entityid(from._internal_entityid());
   }
-}
-
-void GameNavigationStuck::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameNavigationStuck)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameNavigationStuck::CopyFrom(const GameNavigationStuck& from) {
@@ -11177,22 +13229,23 @@ bool GameNavigationStuck::IsInitialized() const {
 
 void GameNavigationStuck::InternalSwap(GameNavigationStuck* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(position_, other->position_);
-  swap(entityid_, other->entityid_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameNavigationStuck, _impl_.entityid_)
+      + sizeof(GameNavigationStuck::_impl_.entityid_)
+      - PROTOBUF_FIELD_OFFSET(GameNavigationStuck, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameNavigationStuck::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[37]);
 }
 
-
 // ===================================================================
 
-void GameVoiceMacro::InitAsDefaultInstance() {
-  ::Analytics::_GameVoiceMacro_default_instance_._instance.get_mutable()->position_ = const_cast< ::Analytics::Vec3*>(
-      ::Analytics::Vec3::internal_default_instance());
-}
 class GameVoiceMacro::_Internal {
  public:
   static const ::Analytics::Vec3& position(const GameVoiceMacro* msg);
@@ -11200,146 +13253,160 @@ class GameVoiceMacro::_Internal {
 
 const ::Analytics::Vec3&
 GameVoiceMacro::_Internal::position(const GameVoiceMacro* msg) {
-  return *msg->position_;
+  return *msg->_impl_.position_;
 }
-GameVoiceMacro::GameVoiceMacro()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameVoiceMacro)
+GameVoiceMacro::GameVoiceMacro(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameVoiceMacro)
 }
 GameVoiceMacro::GameVoiceMacro(const GameVoiceMacro& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameVoiceMacro* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.entityid_){}
+    , decltype(_impl_.voicemacro_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_position()) {
-    position_ = new ::Analytics::Vec3(*from.position_);
-  } else {
-    position_ = nullptr;
+    _this->_impl_.position_ = new ::Analytics::Vec3(*from._impl_.position_);
   }
-  ::memcpy(&entityid_, &from.entityid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&voicemacro_) -
-    reinterpret_cast<char*>(&entityid_)) + sizeof(voicemacro_));
+  ::memcpy(&_impl_.entityid_, &from._impl_.entityid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.voicemacro_) -
+    reinterpret_cast<char*>(&_impl_.entityid_)) + sizeof(_impl_.voicemacro_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameVoiceMacro)
 }
 
-void GameVoiceMacro::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameVoiceMacro_analytics_2eproto.base);
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&voicemacro_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(voicemacro_));
+inline void GameVoiceMacro::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.entityid_){0}
+    , decltype(_impl_.voicemacro_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 GameVoiceMacro::~GameVoiceMacro() {
   // @@protoc_insertion_point(destructor:Analytics.GameVoiceMacro)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameVoiceMacro::SharedDtor() {
-  if (this != internal_default_instance()) delete position_;
+inline void GameVoiceMacro::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.position_;
 }
 
 void GameVoiceMacro::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameVoiceMacro& GameVoiceMacro::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameVoiceMacro_analytics_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameVoiceMacro::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameVoiceMacro)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
-  ::memset(&entityid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&voicemacro_) -
-      reinterpret_cast<char*>(&entityid_)) + sizeof(voicemacro_));
-  _internal_metadata_.Clear();
+  _impl_.position_ = nullptr;
+  ::memset(&_impl_.entityid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.voicemacro_) -
+      reinterpret_cast<char*>(&_impl_.entityid_)) + sizeof(_impl_.voicemacro_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameVoiceMacro::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameVoiceMacro::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 entityId = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          entityid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.entityid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 voiceMacro = 2 [(.Analytics.enumkey) = "VOICE_MACRO", (.Analytics.track_event) = true];
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          voicemacro_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.voicemacro_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .Analytics.Vec3 position = 3 [(.Analytics.point_event) = {
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameVoiceMacro::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameVoiceMacro::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameVoiceMacro)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 entityId = 1;
-  if (this->entityid() != 0) {
+  if (this->_internal_entityid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_entityid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_entityid(), target);
   }
 
   // int32 voiceMacro = 2 [(.Analytics.enumkey) = "VOICE_MACRO", (.Analytics.track_event) = true];
-  if (this->voicemacro() != 0) {
+  if (this->_internal_voicemacro() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_voicemacro(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_voicemacro(), target);
   }
 
   // .Analytics.Vec3 position = 3 [(.Analytics.point_event) = {
-  if (this->has_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::position(this), target, stream);
+      InternalWriteMessage(3, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameVoiceMacro)
   return target;
@@ -11349,78 +13416,56 @@ size_t GameVoiceMacro::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameVoiceMacro)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // .Analytics.Vec3 position = 3 [(.Analytics.point_event) = {
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *position_);
+        *_impl_.position_);
   }
 
   // int32 entityId = 1;
-  if (this->entityid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_entityid());
+  if (this->_internal_entityid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entityid());
   }
 
   // int32 voiceMacro = 2 [(.Analytics.enumkey) = "VOICE_MACRO", (.Analytics.track_event) = true];
-  if (this->voicemacro() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_voicemacro());
+  if (this->_internal_voicemacro() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_voicemacro());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameVoiceMacro::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameVoiceMacro)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameVoiceMacro* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameVoiceMacro>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameVoiceMacro)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameVoiceMacro)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameVoiceMacro::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameVoiceMacro::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameVoiceMacro::GetClassData() const { return &_class_data_; }
+
 
-void GameVoiceMacro::MergeFrom(const GameVoiceMacro& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameVoiceMacro)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void GameVoiceMacro::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameVoiceMacro*>(&to_msg);
+  auto& from = static_cast<const GameVoiceMacro&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameVoiceMacro)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_position()) {
-    _internal_mutable_position()->::Analytics::Vec3::MergeFrom(from._internal_position());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::Analytics::Vec3::MergeFrom(
+        from._internal_position());
   }
-  if (from.entityid() != 0) {
-    _internal_set_entityid(from._internal_entityid());
+  if (from._internal_entityid() != 0) {
+    _this->_internal_set_entityid(from._internal_entityid());
   }
-  if (from.voicemacro() != 0) {
-    _internal_set_voicemacro(from._internal_voicemacro());
+  if (from._internal_voicemacro() != 0) {
+    _this->_internal_set_voicemacro(from._internal_voicemacro());
   }
-}
-
-void GameVoiceMacro::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameVoiceMacro)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameVoiceMacro::CopyFrom(const GameVoiceMacro& from) {
@@ -11436,152 +13481,201 @@ bool GameVoiceMacro::IsInitialized() const {
 
 void GameVoiceMacro::InternalSwap(GameVoiceMacro* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(position_, other->position_);
-  swap(entityid_, other->entityid_);
-  swap(voicemacro_, other->voicemacro_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameVoiceMacro, _impl_.voicemacro_)
+      + sizeof(GameVoiceMacro::_impl_.voicemacro_)
+      - PROTOBUF_FIELD_OFFSET(GameVoiceMacro, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameVoiceMacro::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[38]);
 }
 
-
 // ===================================================================
 
-void GameLogMessage::InitAsDefaultInstance() {
-}
 class GameLogMessage::_Internal {
  public:
 };
 
-GameLogMessage::GameLogMessage()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Analytics.GameLogMessage)
+GameLogMessage::GameLogMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Analytics.GameLogMessage)
 }
 GameLogMessage::GameLogMessage(const GameLogMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  logmessage_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameLogMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.logmessage_){}
+    , decltype(_impl_.logextrainfo_){}
+    , decltype(_impl_.logtype_){}
+    , decltype(_impl_.logmessageid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.logmessage_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.logmessage_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_logmessage().empty()) {
-    logmessage_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.logmessage_);
+    _this->_impl_.logmessage_.Set(from._internal_logmessage(), 
+      _this->GetArenaForAllocation());
   }
-  logextrainfo_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.logextrainfo_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.logextrainfo_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_logextrainfo().empty()) {
-    logextrainfo_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.logextrainfo_);
+    _this->_impl_.logextrainfo_.Set(from._internal_logextrainfo(), 
+      _this->GetArenaForAllocation());
   }
-  logtype_ = from.logtype_;
+  ::memcpy(&_impl_.logtype_, &from._impl_.logtype_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.logmessageid_) -
+    reinterpret_cast<char*>(&_impl_.logtype_)) + sizeof(_impl_.logmessageid_));
   // @@protoc_insertion_point(copy_constructor:Analytics.GameLogMessage)
 }
 
-void GameLogMessage::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameLogMessage_analytics_2eproto.base);
-  logmessage_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  logextrainfo_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  logtype_ = 0;
+inline void GameLogMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.logmessage_){}
+    , decltype(_impl_.logextrainfo_){}
+    , decltype(_impl_.logtype_){0}
+    , decltype(_impl_.logmessageid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.logmessage_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.logmessage_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.logextrainfo_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.logextrainfo_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameLogMessage::~GameLogMessage() {
   // @@protoc_insertion_point(destructor:Analytics.GameLogMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameLogMessage::SharedDtor() {
-  logmessage_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  logextrainfo_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void GameLogMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.logmessage_.Destroy();
+  _impl_.logextrainfo_.Destroy();
 }
 
 void GameLogMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const GameLogMessage& GameLogMessage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameLogMessage_analytics_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void GameLogMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:Analytics.GameLogMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  logmessage_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  logextrainfo_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  logtype_ = 0;
-  _internal_metadata_.Clear();
+  _impl_.logmessage_.ClearToEmpty();
+  _impl_.logextrainfo_.ClearToEmpty();
+  ::memset(&_impl_.logtype_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.logmessageid_) -
+      reinterpret_cast<char*>(&_impl_.logtype_)) + sizeof(_impl_.logmessageid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameLogMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameLogMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .Analytics.LogType logType = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_logtype(static_cast<::Analytics::LogType>(val));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string logMessage = 2;
+      // string logMessage = 2 [(.Analytics.intern) = "logMessageId"];
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_logmessage();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameLogMessage.logMessage"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameLogMessage.logMessage"));
+        } else
+          goto handle_unusual;
         continue;
       // string logExtraInfo = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_logextrainfo();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Analytics.GameLogMessage.logExtraInfo"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Analytics.GameLogMessage.logExtraInfo"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 logMessageId = 4 [(.Analytics.hidden) = true];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.logmessageid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameLogMessage::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameLogMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Analytics.GameLogMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .Analytics.LogType logType = 1;
-  if (this->logtype() != 0) {
+  if (this->_internal_logtype() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_logtype(), target);
   }
 
-  // string logMessage = 2;
-  if (this->logmessage().size() > 0) {
+  // string logMessage = 2 [(.Analytics.intern) = "logMessageId"];
+  if (!this->_internal_logmessage().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_logmessage().data(), static_cast<int>(this->_internal_logmessage().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -11591,7 +13685,7 @@ failure:
   }
 
   // string logExtraInfo = 3;
-  if (this->logextrainfo().size() > 0) {
+  if (!this->_internal_logextrainfo().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_logextrainfo().data(), static_cast<int>(this->_internal_logextrainfo().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -11600,9 +13694,15 @@ failure:
         3, this->_internal_logextrainfo(), target);
   }
 
+  // uint32 logMessageId = 4 [(.Analytics.hidden) = true];
+  if (this->_internal_logmessageid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_logmessageid(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Analytics.GameLogMessage)
   return target;
@@ -11612,79 +13712,66 @@ size_t GameLogMessage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Analytics.GameLogMessage)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string logMessage = 2;
-  if (this->logmessage().size() > 0) {
+  // string logMessage = 2 [(.Analytics.intern) = "logMessageId"];
+  if (!this->_internal_logmessage().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_logmessage());
   }
 
   // string logExtraInfo = 3;
-  if (this->logextrainfo().size() > 0) {
+  if (!this->_internal_logextrainfo().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_logextrainfo());
   }
 
   // .Analytics.LogType logType = 1;
-  if (this->logtype() != 0) {
+  if (this->_internal_logtype() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_logtype());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_logtype());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 logMessageId = 4 [(.Analytics.hidden) = true];
+  if (this->_internal_logmessageid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_logmessageid());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameLogMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Analytics.GameLogMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameLogMessage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameLogMessage>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Analytics.GameLogMessage)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Analytics.GameLogMessage)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameLogMessage::MergeFrom(const GameLogMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameLogMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameLogMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameLogMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameLogMessage::GetClassData() const { return &_class_data_; }
 
-  if (from.logmessage().size() > 0) {
 
-    logmessage_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.logmessage_);
-  }
-  if (from.logextrainfo().size() > 0) {
+void GameLogMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameLogMessage*>(&to_msg);
+  auto& from = static_cast<const GameLogMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Analytics.GameLogMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    logextrainfo_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.logextrainfo_);
+  if (!from._internal_logmessage().empty()) {
+    _this->_internal_set_logmessage(from._internal_logmessage());
   }
-  if (from.logtype() != 0) {
-    _internal_set_logtype(from._internal_logtype());
+  if (!from._internal_logextrainfo().empty()) {
+    _this->_internal_set_logextrainfo(from._internal_logextrainfo());
   }
-}
-
-void GameLogMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Analytics.GameLogMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_logtype() != 0) {
+    _this->_internal_set_logtype(from._internal_logtype());
+  }
+  if (from._internal_logmessageid() != 0) {
+    _this->_internal_set_logmessageid(from._internal_logmessageid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameLogMessage::CopyFrom(const GameLogMessage& from) {
@@ -11700,184 +13787,252 @@ bool GameLogMessage::IsInitialized() const {
 
 void GameLogMessage::InternalSwap(GameLogMessage* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  logmessage_.Swap(&other->logmessage_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  logextrainfo_.Swap(&other->logextrainfo_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(logtype_, other->logtype_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.logmessage_, lhs_arena,
+      &other->_impl_.logmessage_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.logextrainfo_, lhs_arena,
+      &other->_impl_.logextrainfo_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameLogMessage, _impl_.logmessageid_)
+      + sizeof(GameLogMessage::_impl_.logmessageid_)
+      - PROTOBUF_FIELD_OFFSET(GameLogMessage, _impl_.logtype_)>(
+          reinterpret_cast<char*>(&_impl_.logtype_),
+          reinterpret_cast<char*>(&other->_impl_.logtype_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameLogMessage::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_analytics_2eproto_getter, &descriptor_table_analytics_2eproto_once,
+      file_level_metadata_analytics_2eproto[39]);
 }
-
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::Analytics::RedisKeyType, ::Analytics::RedisKeyType_IsValid>, 14, false >
-  rediskeytype(kRediskeytypeFieldNumber, static_cast< ::Analytics::RedisKeyType >(0));
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MessageOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::Analytics::RedisKeyType, ::Analytics::RedisKeyType_IsValid>, 14, false>
+  rediskeytype(kRediskeytypeFieldNumber, static_cast< ::Analytics::RedisKeyType >(0), nullptr);
 const std::string redishmsetkey_default("");
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
-  redishmsetkey(kRedishmsetkeyFieldNumber, redishmsetkey_default);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MessageOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false>
+  redishmsetkey(kRedishmsetkeyFieldNumber, redishmsetkey_default, nullptr);
 const std::string rediskeysuffix_default("");
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
-  rediskeysuffix(kRediskeysuffixFieldNumber, rediskeysuffix_default);
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
-  useJsonEncoding(kUseJsonEncodingFieldNumber, false);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MessageOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false>
+  rediskeysuffix(kRediskeysuffixFieldNumber, rediskeysuffix_default, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MessageOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  useJsonEncoding(kUseJsonEncodingFieldNumber, false, nullptr);
 const std::string objectname_default("");
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
-  objectname(kObjectnameFieldNumber, objectname_default);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MessageOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false>
+  objectname(kObjectnameFieldNumber, objectname_default, nullptr);
 const std::string enumkey_default("");
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
-  enumkey(kEnumkeyFieldNumber, enumkey_default);
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
-  editable(kEditableFieldNumber, false);
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 5, false >
-  expires(kExpiresFieldNumber, 0);
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
-  enumflags(kEnumflagsFieldNumber, false);
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
-  tooltip(kTooltipFieldNumber, false);
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
-  hidden(kHiddenFieldNumber, false);
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
-  enumflagsindexed(kEnumflagsindexedFieldNumber, false);
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
-  editable_key(kEditableKeyFieldNumber, false);
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
-  track_event(kTrackEventFieldNumber, false);
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::Analytics::PointEvent >, 11, false >
-  point_event(kPointEventFieldNumber, *::Analytics::PointEvent::internal_default_instance());
-::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::Analytics::LineEvent >, 11, false >
-  line_event(kLineEventFieldNumber, *::Analytics::LineEvent::internal_default_instance());
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false>
+  enumkey(kEnumkeyFieldNumber, enumkey_default, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  editable(kEditableFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< int32_t >, 5, false>
+  expires(kExpiresFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  enumflags(kEnumflagsFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  tooltip(kTooltipFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  hidden(kHiddenFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  enumflagsindexed(kEnumflagsindexedFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  editable_key(kEditableKeyFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  track_event(kTrackEventFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::Analytics::PointEvent >, 11, false>
+  point_event(kPointEventFieldNumber, ::Analytics::PointEvent::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::Analytics::LineEvent >, 11, false>
+  line_event(kLineEventFieldNumber, ::Analytics::LineEvent::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< int32_t >, 5, false>
+  quantize(kQuantizeFieldNumber, 0, nullptr);
+const std::string intern_default("");
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false>
+  intern(kInternFieldNumber, intern_default, nullptr);
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace Analytics
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::Analytics::PointEvent* Arena::CreateMaybeMessage< ::Analytics::PointEvent >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::PointEvent >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::PointEvent*
+Arena::CreateMaybeMessage< ::Analytics::PointEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::PointEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Analytics::LineEvent*
+Arena::CreateMaybeMessage< ::Analytics::LineEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::LineEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Analytics::EditorChangeValue*
+Arena::CreateMaybeMessage< ::Analytics::EditorChangeValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::EditorChangeValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Analytics::EditorChanges*
+Arena::CreateMaybeMessage< ::Analytics::EditorChanges >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::EditorChanges >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::LineEvent* Arena::CreateMaybeMessage< ::Analytics::LineEvent >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::LineEvent >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::RangeF*
+Arena::CreateMaybeMessage< ::Analytics::RangeF >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::RangeF >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::EditorChangeValue* Arena::CreateMaybeMessage< ::Analytics::EditorChangeValue >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::EditorChangeValue >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::RangeI*
+Arena::CreateMaybeMessage< ::Analytics::RangeI >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::RangeI >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::EditorChanges* Arena::CreateMaybeMessage< ::Analytics::EditorChanges >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::EditorChanges >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::Vec3*
+Arena::CreateMaybeMessage< ::Analytics::Vec3 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::Vec3 >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::RangeF* Arena::CreateMaybeMessage< ::Analytics::RangeF >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::RangeF >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::Vec3Color*
+Arena::CreateMaybeMessage< ::Analytics::Vec3Color >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::Vec3Color >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::RangeI* Arena::CreateMaybeMessage< ::Analytics::RangeI >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::RangeI >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::Vec4*
+Arena::CreateMaybeMessage< ::Analytics::Vec4 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::Vec4 >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::Vec3* Arena::CreateMaybeMessage< ::Analytics::Vec3 >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::Vec3 >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::Line*
+Arena::CreateMaybeMessage< ::Analytics::Line >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::Line >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::Vec3Color* Arena::CreateMaybeMessage< ::Analytics::Vec3Color >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::Vec3Color >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::Euler*
+Arena::CreateMaybeMessage< ::Analytics::Euler >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::Euler >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::Vec4* Arena::CreateMaybeMessage< ::Analytics::Vec4 >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::Vec4 >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::Material*
+Arena::CreateMaybeMessage< ::Analytics::Material >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::Material >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::Line* Arena::CreateMaybeMessage< ::Analytics::Line >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::Line >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::PrimitiveOptions*
+Arena::CreateMaybeMessage< ::Analytics::PrimitiveOptions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::PrimitiveOptions >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::Euler* Arena::CreateMaybeMessage< ::Analytics::Euler >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::Euler >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::Primitive*
+Arena::CreateMaybeMessage< ::Analytics::Primitive >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::Primitive >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::Material* Arena::CreateMaybeMessage< ::Analytics::Material >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::Material >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::Mesh*
+Arena::CreateMaybeMessage< ::Analytics::Mesh >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::Mesh >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::PrimitiveOptions* Arena::CreateMaybeMessage< ::Analytics::PrimitiveOptions >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::PrimitiveOptions >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::UTCTime*
+Arena::CreateMaybeMessage< ::Analytics::UTCTime >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::UTCTime >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::Primitive* Arena::CreateMaybeMessage< ::Analytics::Primitive >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::Primitive >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameInfo*
+Arena::CreateMaybeMessage< ::Analytics::GameInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameInfo >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::Mesh* Arena::CreateMaybeMessage< ::Analytics::Mesh >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::Mesh >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameEnum_EnumPair*
+Arena::CreateMaybeMessage< ::Analytics::GameEnum_EnumPair >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameEnum_EnumPair >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::UTCTime* Arena::CreateMaybeMessage< ::Analytics::UTCTime >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::UTCTime >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameEnum*
+Arena::CreateMaybeMessage< ::Analytics::GameEnum >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameEnum >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameInfo* Arena::CreateMaybeMessage< ::Analytics::GameInfo >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameInfo >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameString*
+Arena::CreateMaybeMessage< ::Analytics::GameString >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameString >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameEnum_EnumPair* Arena::CreateMaybeMessage< ::Analytics::GameEnum_EnumPair >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameEnum_EnumPair >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::LiveHeatmap*
+Arena::CreateMaybeMessage< ::Analytics::LiveHeatmap >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::LiveHeatmap >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameEnum* Arena::CreateMaybeMessage< ::Analytics::GameEnum >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameEnum >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameNavNotFound*
+Arena::CreateMaybeMessage< ::Analytics::GameNavNotFound >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameNavNotFound >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameNavNotFound* Arena::CreateMaybeMessage< ::Analytics::GameNavNotFound >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameNavNotFound >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameNavAutoDownloaded*
+Arena::CreateMaybeMessage< ::Analytics::GameNavAutoDownloaded >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameNavAutoDownloaded >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameNavAutoDownloaded* Arena::CreateMaybeMessage< ::Analytics::GameNavAutoDownloaded >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameNavAutoDownloaded >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameAssert*
+Arena::CreateMaybeMessage< ::Analytics::GameAssert >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameAssert >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameAssert* Arena::CreateMaybeMessage< ::Analytics::GameAssert >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameAssert >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameCrash*
+Arena::CreateMaybeMessage< ::Analytics::GameCrash >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameCrash >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameCrash* Arena::CreateMaybeMessage< ::Analytics::GameCrash >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameCrash >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameMeshData*
+Arena::CreateMaybeMessage< ::Analytics::GameMeshData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameMeshData >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameMeshData* Arena::CreateMaybeMessage< ::Analytics::GameMeshData >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameMeshData >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameEntityInfo_Ammo*
+Arena::CreateMaybeMessage< ::Analytics::GameEntityInfo_Ammo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameEntityInfo_Ammo >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameEntityInfo_Ammo* Arena::CreateMaybeMessage< ::Analytics::GameEntityInfo_Ammo >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameEntityInfo_Ammo >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameEntityInfo*
+Arena::CreateMaybeMessage< ::Analytics::GameEntityInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameEntityInfo >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameEntityInfo* Arena::CreateMaybeMessage< ::Analytics::GameEntityInfo >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameEntityInfo >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameEntityPosition*
+Arena::CreateMaybeMessage< ::Analytics::GameEntityPosition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameEntityPosition >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameEntityPosition* Arena::CreateMaybeMessage< ::Analytics::GameEntityPosition >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameEntityPosition >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameEntityTrajectory*
+Arena::CreateMaybeMessage< ::Analytics::GameEntityTrajectory >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameEntityTrajectory >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameNode* Arena::CreateMaybeMessage< ::Analytics::GameNode >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameNode >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameNode*
+Arena::CreateMaybeMessage< ::Analytics::GameNode >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameNode >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameWeaponFired* Arena::CreateMaybeMessage< ::Analytics::GameWeaponFired >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameWeaponFired >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameWeaponFired*
+Arena::CreateMaybeMessage< ::Analytics::GameWeaponFired >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameWeaponFired >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameDeath* Arena::CreateMaybeMessage< ::Analytics::GameDeath >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameDeath >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameDeath*
+Arena::CreateMaybeMessage< ::Analytics::GameDeath >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameDeath >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameKilledSomeone* Arena::CreateMaybeMessage< ::Analytics::GameKilledSomeone >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameKilledSomeone >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameKilledSomeone*
+Arena::CreateMaybeMessage< ::Analytics::GameKilledSomeone >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameKilledSomeone >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameRecieveDamage* Arena::CreateMaybeMessage< ::Analytics::GameRecieveDamage >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameRecieveDamage >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameRecieveDamage*
+Arena::CreateMaybeMessage< ::Analytics::GameRecieveDamage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameRecieveDamage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameInflictDamage* Arena::CreateMaybeMessage< ::Analytics::GameInflictDamage >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameInflictDamage >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameInflictDamage*
+Arena::CreateMaybeMessage< ::Analytics::GameInflictDamage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameInflictDamage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameRadiusDamage* Arena::CreateMaybeMessage< ::Analytics::GameRadiusDamage >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameRadiusDamage >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameRadiusDamage*
+Arena::CreateMaybeMessage< ::Analytics::GameRadiusDamage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameRadiusDamage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameNavigationStuck* Arena::CreateMaybeMessage< ::Analytics::GameNavigationStuck >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameNavigationStuck >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameNavigationStuck*
+Arena::CreateMaybeMessage< ::Analytics::GameNavigationStuck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameNavigationStuck >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameVoiceMacro* Arena::CreateMaybeMessage< ::Analytics::GameVoiceMacro >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameVoiceMacro >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameVoiceMacro*
+Arena::CreateMaybeMessage< ::Analytics::GameVoiceMacro >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameVoiceMacro >(arena);
 }
-template<> PROTOBUF_NOINLINE ::Analytics::GameLogMessage* Arena::CreateMaybeMessage< ::Analytics::GameLogMessage >(Arena* arena) {
-  return Arena::CreateInternal< ::Analytics::GameLogMessage >(arena);
+template<> PROTOBUF_NOINLINE ::Analytics::GameLogMessage*
+Arena::CreateMaybeMessage< ::Analytics::GameLogMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Analytics::GameLogMessage >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
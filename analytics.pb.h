@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3011000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3011002 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,10 +23,8 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
@@ -45,128 +43,129 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_analytics_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[37]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_analytics_2eproto;
 namespace Analytics {
 class EditorChangeValue;
-class EditorChangeValueDefaultTypeInternal;
+struct EditorChangeValueDefaultTypeInternal;
 extern EditorChangeValueDefaultTypeInternal _EditorChangeValue_default_instance_;
 class EditorChanges;
-class EditorChangesDefaultTypeInternal;
+struct EditorChangesDefaultTypeInternal;
 extern EditorChangesDefaultTypeInternal _EditorChanges_default_instance_;
 class Euler;
-class EulerDefaultTypeInternal;
+struct EulerDefaultTypeInternal;
 extern EulerDefaultTypeInternal _Euler_default_instance_;
 class GameAssert;
-class GameAssertDefaultTypeInternal;
+struct GameAssertDefaultTypeInternal;
 extern GameAssertDefaultTypeInternal _GameAssert_default_instance_;
 class GameCrash;
-class GameCrashDefaultTypeInternal;
+struct GameCrashDefaultTypeInternal;
 extern GameCrashDefaultTypeInternal _GameCrash_default_instance_;
 class GameDeath;
-class GameDeathDefaultTypeInternal;
+struct GameDeathDefaultTypeInternal;
 extern GameDeathDefaultTypeInternal _GameDeath_default_instance_;
 class GameEntityInfo;
-class GameEntityInfoDefaultTypeInternal;
+struct GameEntityInfoDefaultTypeInternal;
 extern GameEntityInfoDefaultTypeInternal _GameEntityInfo_default_instance_;
 class GameEntityInfo_Ammo;
-class GameEntityInfo_AmmoDefaultTypeInternal;
+struct GameEntityInfo_AmmoDefaultTypeInternal;
 extern GameEntityInfo_AmmoDefaultTypeInternal _GameEntityInfo_Ammo_default_instance_;
 class GameEntityPosition;
-class GameEntityPositionDefaultTypeInternal;
+struct GameEntityPositionDefaultTypeInternal;
 extern GameEntityPositionDefaultTypeInternal _GameEntityPosition_default_instance_;
+class GameEntityTrajectory;
+struct GameEntityTrajectoryDefaultTypeInternal;
+extern GameEntityTrajectoryDefaultTypeInternal _GameEntityTrajectory_default_instance_;
 class GameEnum;
-class GameEnumDefaultTypeInternal;
+struct GameEnumDefaultTypeInternal;
 extern GameEnumDefaultTypeInternal _GameEnum_default_instance_;
 class GameEnum_EnumPair;
-class GameEnum_EnumPairDefaultTypeInternal;
+struct GameEnum_EnumPairDefaultTypeInternal;
 extern GameEnum_EnumPairDefaultTypeInternal _GameEnum_EnumPair_default_instance_;
 class GameInflictDamage;
-class GameInflictDamageDefaultTypeInternal;
+struct GameInflictDamageDefaultTypeInternal;
 extern GameInflictDamageDefaultTypeInternal _GameInflictDamage_default_instance_;
 class GameInfo;
-class GameInfoDefaultTypeInternal;
+struct GameInfoDefaultTypeInternal;
 extern GameInfoDefaultTypeInternal _GameInfo_default_instance_;
 class GameKilledSomeone;
-class GameKilledSomeoneDefaultTypeInternal;
+struct GameKilledSomeoneDefaultTypeInternal;
 extern GameKilledSomeoneDefaultTypeInternal _GameKilledSomeone_default_instance_;
 class GameLogMessage;
-class GameLogMessageDefaultTypeInternal;
+struct GameLogMessageDefaultTypeInternal;
 extern GameLogMessageDefaultTypeInternal _GameLogMessage_default_instance_;
 class GameMeshData;
-class GameMeshDataDefaultTypeInternal;
+struct GameMeshDataDefaultTypeInternal;
 extern GameMeshDataDefaultTypeInternal _GameMeshData_default_instance_;
 class GameNavAutoDownloaded;
-class GameNavAutoDownloadedDefaultTypeInternal;
+struct GameNavAutoDownloadedDefaultTypeInternal;
 extern GameNavAutoDownloadedDefaultTypeInternal _GameNavAutoDownloaded_default_instance_;
 class GameNavNotFound;
-class GameNavNotFoundDefaultTypeInternal;
+struct GameNavNotFoundDefaultTypeInternal;
 extern GameNavNotFoundDefaultTypeInternal _GameNavNotFound_default_instance_;
 class GameNavigationStuck;
-class GameNavigationStuckDefaultTypeInternal;
+struct GameNavigationStuckDefaultTypeInternal;
 extern GameNavigationStuckDefaultTypeInternal _GameNavigationStuck_default_instance_;
 class GameNode;
-class GameNodeDefaultTypeInternal;
+struct GameNodeDefaultTypeInternal;
 extern GameNodeDefaultTypeInternal _GameNode_default_instance_;
 class GameRadiusDamage;
-class GameRadiusDamageDefaultTypeInternal;
+struct GameRadiusDamageDefaultTypeInternal;
 extern GameRadiusDamageDefaultTypeInternal _GameRadiusDamage_default_instance_;
 class GameRecieveDamage;
-class GameRecieveDamageDefaultTypeInternal;
+struct GameRecieveDamageDefaultTypeInternal;
 extern GameRecieveDamageDefaultTypeInternal _GameRecieveDamage_default_instance_;
+class GameString;
+struct GameStringDefaultTypeInternal;
+extern GameStringDefaultTypeInternal _GameString_default_instance_;
 class GameVoiceMacro;
-class GameVoiceMacroDefaultTypeInternal;
+struct GameVoiceMacroDefaultTypeInternal;
 extern GameVoiceMacroDefaultTypeInternal _GameVoiceMacro_default_instance_;
 class GameWeaponFired;
-class GameWeaponFiredDefaultTypeInternal;
+struct GameWeaponFiredDefaultTypeInternal;
 extern GameWeaponFiredDefaultTypeInternal _GameWeaponFired_default_instance_;
 class Line;
-class LineDefaultTypeInternal;
+struct LineDefaultTypeInternal;
 extern LineDefaultTypeInternal _Line_default_instance_;
 class LineEvent;
-class LineEventDefaultTypeInternal;
+struct LineEventDefaultTypeInternal;
 extern LineEventDefaultTypeInternal _LineEvent_default_instance_;
+class LiveHeatmap;
+struct LiveHeatmapDefaultTypeInternal;
+extern LiveHeatmapDefaultTypeInternal _LiveHeatmap_default_instance_;
 class Material;
-class MaterialDefaultTypeInternal;
+struct MaterialDefaultTypeInternal;
 extern MaterialDefaultTypeInternal _Material_default_instance_;
 class Mesh;
-class MeshDefaultTypeInternal;
+struct MeshDefaultTypeInternal;
 extern MeshDefaultTypeInternal _Mesh_default_instance_;
 class PointEvent;
-class PointEventDefaultTypeInternal;
+struct PointEventDefaultTypeInternal;
 extern PointEventDefaultTypeInternal _PointEvent_default_instance_;
 class Primitive;
-class PrimitiveDefaultTypeInternal;
+struct PrimitiveDefaultTypeInternal;
 extern PrimitiveDefaultTypeInternal _Primitive_default_instance_;
 class PrimitiveOptions;
-class PrimitiveOptionsDefaultTypeInternal;
+struct PrimitiveOptionsDefaultTypeInternal;
 extern PrimitiveOptionsDefaultTypeInternal _PrimitiveOptions_default_instance_;
 class RangeF;
-class RangeFDefaultTypeInternal;
+struct RangeFDefaultTypeInternal;
 extern RangeFDefaultTypeInternal _RangeF_default_instance_;
 class RangeI;
-class RangeIDefaultTypeInternal;
+struct RangeIDefaultTypeInternal;
 extern RangeIDefaultTypeInternal _RangeI_default_instance_;
 class UTCTime;
-class UTCTimeDefaultTypeInternal;
+struct UTCTimeDefaultTypeInternal;
 extern UTCTimeDefaultTypeInternal _UTCTime_default_instance_;
 class Vec3;
-class Vec3DefaultTypeInternal;
+struct Vec3DefaultTypeInternal;
 extern Vec3DefaultTypeInternal _Vec3_default_instance_;
 class Vec3Color;
-class Vec3ColorDefaultTypeInternal;
+struct Vec3ColorDefaultTypeInternal;
 extern Vec3ColorDefaultTypeInternal _Vec3Color_default_instance_;
 class Vec4;
-class Vec4DefaultTypeInternal;
+struct Vec4DefaultTypeInternal;
 extern Vec4DefaultTypeInternal _Vec4_default_instance_;
 }  // namespace Analytics
 PROTOBUF_NAMESPACE_OPEN
@@ -179,6 +178,7 @@ template<> ::Analytics::GameDeath* Arena::CreateMaybeMessage<::Analytics::GameDe
 template<> ::Analytics::GameEntityInfo* Arena::CreateMaybeMessage<::Analytics::GameEntityInfo>(Arena*);
 template<> ::Analytics::GameEntityInfo_Ammo* Arena::CreateMaybeMessage<::Analytics::GameEntityInfo_Ammo>(Arena*);
 template<> ::Analytics::GameEntityPosition* Arena::CreateMaybeMessage<::Analytics::GameEntityPosition>(Arena*);
+template<> ::Analytics::GameEntityTrajectory* Arena::CreateMaybeMessage<::Analytics::GameEntityTrajectory>(Arena*);
 template<> ::Analytics::GameEnum* Arena::CreateMaybeMessage<::Analytics::GameEnum>(Arena*);
 template<> ::Analytics::GameEnum_EnumPair* Arena::CreateMaybeMessage<::Analytics::GameEnum_EnumPair>(Arena*);
 template<> ::Analytics::GameInflictDamage* Arena::CreateMaybeMessage<::Analytics::GameInflictDamage>(Arena*);
@@ -192,10 +192,12 @@ template<> ::Analytics::GameNavigationStuck* Arena::CreateMaybeMessage<::Analyti
 template<> ::Analytics::GameNode* Arena::CreateMaybeMessage<::Analytics::GameNode>(Arena*);
 template<> ::Analytics::GameRadiusDamage* Arena::CreateMaybeMessage<::Analytics::GameRadiusDamage>(Arena*);
 template<> ::Analytics::GameRecieveDamage* Arena::CreateMaybeMessage<::Analytics::GameRecieveDamage>(Arena*);
+template<> ::Analytics::GameString* Arena::CreateMaybeMessage<::Analytics::GameString>(Arena*);
 template<> ::Analytics::GameVoiceMacro* Arena::CreateMaybeMessage<::Analytics::GameVoiceMacro>(Arena*);
 template<> ::Analytics::GameWeaponFired* Arena::CreateMaybeMessage<::Analytics::GameWeaponFired>(Arena*);
 template<> ::Analytics::Line* Arena::CreateMaybeMessage<::Analytics::Line>(Arena*);
 template<> ::Analytics::LineEvent* Arena::CreateMaybeMessage<::Analytics::LineEvent>(Arena*);
+template<> ::Analytics::LiveHeatmap* Arena::CreateMaybeMessage<::Analytics::LiveHeatmap>(Arena*);
 template<> ::Analytics::Material* Arena::CreateMaybeMessage<::Analytics::Material>(Arena*);
 template<> ::Analytics::Mesh* Arena::CreateMaybeMessage<::Analytics::Mesh>(Arena*);
 template<> ::Analytics::PointEvent* Arena::CreateMaybeMessage<::Analytics::PointEvent>(Arena*);
@@ -215,8 +217,8 @@ enum RedisKeyType : int {
   SET = 1,
   RPUSH = 2,
   HMSET = 3,
-  RedisKeyType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  RedisKeyType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  RedisKeyType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RedisKeyType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool RedisKeyType_IsValid(int value);
 constexpr RedisKeyType RedisKeyType_MIN = UNKNOWN;
@@ -233,7 +235,7 @@ inline const std::string& RedisKeyType_Name(T enum_t_value) {
     RedisKeyType_descriptor(), enum_t_value);
 }
 inline bool RedisKeyType_Parse(
-    const std::string& name, RedisKeyType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RedisKeyType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RedisKeyType>(
     RedisKeyType_descriptor(), name, value);
 }
@@ -242,8 +244,8 @@ enum PrimitiveType : int {
   Lines = 1,
   Points = 2,
   Quad = 3,
-  PrimitiveType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  PrimitiveType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  PrimitiveType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PrimitiveType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool PrimitiveType_IsValid(int value);
 constexpr PrimitiveType PrimitiveType_MIN = Triangles;
@@ -260,15 +262,15 @@ inline const std::string& PrimitiveType_Name(T enum_t_value) {
     PrimitiveType_descriptor(), enum_t_value);
 }
 inline bool PrimitiveType_Parse(
-    const std::string& name, PrimitiveType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PrimitiveType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PrimitiveType>(
     PrimitiveType_descriptor(), name, value);
 }
 enum Compression : int {
   Compression_None = 0,
   Compression_FastLZ = 1,
-  Compression_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  Compression_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  Compression_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Compression_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Compression_IsValid(int value);
 constexpr Compression Compression_MIN = Compression_None;
@@ -285,7 +287,7 @@ inline const std::string& Compression_Name(T enum_t_value) {
     Compression_descriptor(), enum_t_value);
 }
 inline bool Compression_Parse(
-    const std::string& name, Compression* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Compression* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Compression>(
     Compression_descriptor(), name, value);
 }
@@ -293,8 +295,8 @@ enum LogType : int {
   Log = 0,
   Warning = 1,
   Error = 3,
-  LogType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  LogType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  LogType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  LogType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool LogType_IsValid(int value);
 constexpr LogType LogType_MIN = Log;
@@ -311,17 +313,18 @@ inline const std::string& LogType_Name(T enum_t_value) {
     LogType_descriptor(), enum_t_value);
 }
 inline bool LogType_Parse(
-    const std::string& name, LogType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, LogType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<LogType>(
     LogType_descriptor(), name, value);
 }
 // ===================================================================
 
-class PointEvent :
+class PointEvent final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.PointEvent) */ {
  public:
-  PointEvent();
-  virtual ~PointEvent();
+  inline PointEvent() : PointEvent(nullptr) {}
+  ~PointEvent() override;
+  explicit PROTOBUF_CONSTEXPR PointEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PointEvent(const PointEvent& from);
   PointEvent(PointEvent&& from) noexcept
@@ -334,8 +337,13 @@ class PointEvent :
     return *this;
   }
   inline PointEvent& operator=(PointEvent&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -346,14 +354,14 @@ class PointEvent :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PointEvent& default_instance() {
+    return *internal_default_instance();
   }
-  static const PointEvent& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PointEvent* internal_default_instance() {
     return reinterpret_cast<const PointEvent*>(
                &_PointEvent_default_instance_);
@@ -366,57 +374,66 @@ class PointEvent :
   }
   inline void Swap(PointEvent* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PointEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PointEvent* New() const final {
-    return CreateMaybeMessage<PointEvent>(nullptr);
-  }
-
-  PointEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PointEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PointEvent>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PointEvent& from);
-  void MergeFrom(const PointEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PointEvent& from) {
+    PointEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PointEvent* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.PointEvent";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit PointEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -429,32 +446,28 @@ class PointEvent :
   // string radius = 1;
   void clear_radius();
   const std::string& radius() const;
-  void set_radius(const std::string& value);
-  void set_radius(std::string&& value);
-  void set_radius(const char* value);
-  void set_radius(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_radius(ArgT0&& arg0, ArgT... args);
   std::string* mutable_radius();
-  std::string* release_radius();
+  PROTOBUF_NODISCARD std::string* release_radius();
   void set_allocated_radius(std::string* radius);
   private:
   const std::string& _internal_radius() const;
-  void _internal_set_radius(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_radius(const std::string& value);
   std::string* _internal_mutable_radius();
   public:
 
   // string weight = 2;
   void clear_weight();
   const std::string& weight() const;
-  void set_weight(const std::string& value);
-  void set_weight(std::string&& value);
-  void set_weight(const char* value);
-  void set_weight(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_weight(ArgT0&& arg0, ArgT... args);
   std::string* mutable_weight();
-  std::string* release_weight();
+  PROTOBUF_NODISCARD std::string* release_weight();
   void set_allocated_weight(std::string* weight);
   private:
   const std::string& _internal_weight() const;
-  void _internal_set_weight(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_weight(const std::string& value);
   std::string* _internal_mutable_weight();
   public:
 
@@ -462,19 +475,25 @@ class PointEvent :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr radius_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr weight_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr radius_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr weight_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LineEvent :
+class LineEvent final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.LineEvent) */ {
  public:
-  LineEvent();
-  virtual ~LineEvent();
+  inline LineEvent() : LineEvent(nullptr) {}
+  ~LineEvent() override;
+  explicit PROTOBUF_CONSTEXPR LineEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LineEvent(const LineEvent& from);
   LineEvent(LineEvent&& from) noexcept
@@ -487,8 +506,13 @@ class LineEvent :
     return *this;
   }
   inline LineEvent& operator=(LineEvent&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -499,14 +523,14 @@ class LineEvent :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LineEvent& default_instance() {
+    return *internal_default_instance();
   }
-  static const LineEvent& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const LineEvent* internal_default_instance() {
     return reinterpret_cast<const LineEvent*>(
                &_LineEvent_default_instance_);
@@ -519,57 +543,66 @@ class LineEvent :
   }
   inline void Swap(LineEvent* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LineEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LineEvent* New() const final {
-    return CreateMaybeMessage<LineEvent>(nullptr);
-  }
-
-  LineEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  LineEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LineEvent>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LineEvent& from);
-  void MergeFrom(const LineEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LineEvent& from) {
+    LineEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LineEvent* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.LineEvent";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit LineEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -578,56 +611,85 @@ class LineEvent :
   enum : int {
     kRadiusFieldNumber = 1,
     kWeightFieldNumber = 2,
+    kGroupFieldNumber = 3,
+    kMaxStepFieldNumber = 4,
   };
   // string radius = 1;
   void clear_radius();
   const std::string& radius() const;
-  void set_radius(const std::string& value);
-  void set_radius(std::string&& value);
-  void set_radius(const char* value);
-  void set_radius(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_radius(ArgT0&& arg0, ArgT... args);
   std::string* mutable_radius();
-  std::string* release_radius();
+  PROTOBUF_NODISCARD std::string* release_radius();
   void set_allocated_radius(std::string* radius);
   private:
   const std::string& _internal_radius() const;
-  void _internal_set_radius(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_radius(const std::string& value);
   std::string* _internal_mutable_radius();
   public:
 
   // string weight = 2;
   void clear_weight();
   const std::string& weight() const;
-  void set_weight(const std::string& value);
-  void set_weight(std::string&& value);
-  void set_weight(const char* value);
-  void set_weight(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_weight(ArgT0&& arg0, ArgT... args);
   std::string* mutable_weight();
-  std::string* release_weight();
+  PROTOBUF_NODISCARD std::string* release_weight();
   void set_allocated_weight(std::string* weight);
   private:
   const std::string& _internal_weight() const;
-  void _internal_set_weight(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_weight(const std::string& value);
   std::string* _internal_mutable_weight();
   public:
 
+  // string group = 3;
+  void clear_group();
+  const std::string& group() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_group(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_group();
+  PROTOBUF_NODISCARD std::string* release_group();
+  void set_allocated_group(std::string* group);
+  private:
+  const std::string& _internal_group() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_group(const std::string& value);
+  std::string* _internal_mutable_group();
+  public:
+
+  // float maxStep = 4;
+  void clear_maxstep();
+  float maxstep() const;
+  void set_maxstep(float value);
+  private:
+  float _internal_maxstep() const;
+  void _internal_set_maxstep(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:Analytics.LineEvent)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr radius_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr weight_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr radius_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr weight_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr group_;
+    float maxstep_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EditorChangeValue :
+class EditorChangeValue final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.EditorChangeValue) */ {
  public:
-  EditorChangeValue();
-  virtual ~EditorChangeValue();
+  inline EditorChangeValue() : EditorChangeValue(nullptr) {}
+  ~EditorChangeValue() override;
+  explicit PROTOBUF_CONSTEXPR EditorChangeValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   EditorChangeValue(const EditorChangeValue& from);
   EditorChangeValue(EditorChangeValue&& from) noexcept
@@ -640,8 +702,13 @@ class EditorChangeValue :
     return *this;
   }
   inline EditorChangeValue& operator=(EditorChangeValue&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -652,14 +719,14 @@ class EditorChangeValue :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EditorChangeValue& default_instance() {
+    return *internal_default_instance();
   }
-  static const EditorChangeValue& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const EditorChangeValue* internal_default_instance() {
     return reinterpret_cast<const EditorChangeValue*>(
                &_EditorChangeValue_default_instance_);
@@ -672,57 +739,66 @@ class EditorChangeValue :
   }
   inline void Swap(EditorChangeValue* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EditorChangeValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline EditorChangeValue* New() const final {
-    return CreateMaybeMessage<EditorChangeValue>(nullptr);
-  }
-
-  EditorChangeValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  EditorChangeValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<EditorChangeValue>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const EditorChangeValue& from);
-  void MergeFrom(const EditorChangeValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EditorChangeValue& from) {
+    EditorChangeValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(EditorChangeValue* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.EditorChangeValue";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit EditorChangeValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -736,48 +812,42 @@ class EditorChangeValue :
   // string messageType = 1;
   void clear_messagetype();
   const std::string& messagetype() const;
-  void set_messagetype(const std::string& value);
-  void set_messagetype(std::string&& value);
-  void set_messagetype(const char* value);
-  void set_messagetype(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_messagetype(ArgT0&& arg0, ArgT... args);
   std::string* mutable_messagetype();
-  std::string* release_messagetype();
+  PROTOBUF_NODISCARD std::string* release_messagetype();
   void set_allocated_messagetype(std::string* messagetype);
   private:
   const std::string& _internal_messagetype() const;
-  void _internal_set_messagetype(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_messagetype(const std::string& value);
   std::string* _internal_mutable_messagetype();
   public:
 
   // string fieldName = 2;
   void clear_fieldname();
   const std::string& fieldname() const;
-  void set_fieldname(const std::string& value);
-  void set_fieldname(std::string&& value);
-  void set_fieldname(const char* value);
-  void set_fieldname(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_fieldname(ArgT0&& arg0, ArgT... args);
   std::string* mutable_fieldname();
-  std::string* release_fieldname();
+  PROTOBUF_NODISCARD std::string* release_fieldname();
   void set_allocated_fieldname(std::string* fieldname);
   private:
   const std::string& _internal_fieldname() const;
-  void _internal_set_fieldname(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_fieldname(const std::string& value);
   std::string* _internal_mutable_fieldname();
   public:
 
   // string payload = 3;
   void clear_payload();
   const std::string& payload() const;
-  void set_payload(const std::string& value);
-  void set_payload(std::string&& value);
-  void set_payload(const char* value);
-  void set_payload(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
   std::string* mutable_payload();
-  std::string* release_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
   void set_allocated_payload(std::string* payload);
   private:
   const std::string& _internal_payload() const;
-  void _internal_set_payload(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
   std::string* _internal_mutable_payload();
   public:
 
@@ -785,20 +855,26 @@ class EditorChangeValue :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr messagetype_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr fieldname_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr messagetype_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr fieldname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EditorChanges :
+class EditorChanges final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.EditorChanges) */ {
  public:
-  EditorChanges();
-  virtual ~EditorChanges();
+  inline EditorChanges() : EditorChanges(nullptr) {}
+  ~EditorChanges() override;
+  explicit PROTOBUF_CONSTEXPR EditorChanges(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   EditorChanges(const EditorChanges& from);
   EditorChanges(EditorChanges&& from) noexcept
@@ -811,8 +887,13 @@ class EditorChanges :
     return *this;
   }
   inline EditorChanges& operator=(EditorChanges&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -823,14 +904,14 @@ class EditorChanges :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EditorChanges& default_instance() {
+    return *internal_default_instance();
   }
-  static const EditorChanges& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const EditorChanges* internal_default_instance() {
     return reinterpret_cast<const EditorChanges*>(
                &_EditorChanges_default_instance_);
@@ -843,57 +924,66 @@ class EditorChanges :
   }
   inline void Swap(EditorChanges* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EditorChanges* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline EditorChanges* New() const final {
-    return CreateMaybeMessage<EditorChanges>(nullptr);
-  }
-
-  EditorChanges* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  EditorChanges* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<EditorChanges>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const EditorChanges& from);
-  void MergeFrom(const EditorChanges& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EditorChanges& from) {
+    EditorChanges::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(EditorChanges* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.EditorChanges";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit EditorChanges(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -924,18 +1014,24 @@ class EditorChanges :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::EditorChangeValue > changes_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::EditorChangeValue > changes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RangeF :
+class RangeF final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.RangeF) */ {
  public:
-  RangeF();
-  virtual ~RangeF();
+  inline RangeF() : RangeF(nullptr) {}
+  ~RangeF() override;
+  explicit PROTOBUF_CONSTEXPR RangeF(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RangeF(const RangeF& from);
   RangeF(RangeF&& from) noexcept
@@ -948,8 +1044,13 @@ class RangeF :
     return *this;
   }
   inline RangeF& operator=(RangeF&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -960,14 +1061,14 @@ class RangeF :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RangeF& default_instance() {
+    return *internal_default_instance();
   }
-  static const RangeF& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RangeF* internal_default_instance() {
     return reinterpret_cast<const RangeF*>(
                &_RangeF_default_instance_);
@@ -980,57 +1081,66 @@ class RangeF :
   }
   inline void Swap(RangeF* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RangeF* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RangeF* New() const final {
-    return CreateMaybeMessage<RangeF>(nullptr);
-  }
-
-  RangeF* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RangeF* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RangeF>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RangeF& from);
-  void MergeFrom(const RangeF& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RangeF& from) {
+    RangeF::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RangeF* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.RangeF";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit RangeF(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1062,19 +1172,25 @@ class RangeF :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  float min_;
-  float max_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float min_;
+    float max_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RangeI :
+class RangeI final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.RangeI) */ {
  public:
-  RangeI();
-  virtual ~RangeI();
+  inline RangeI() : RangeI(nullptr) {}
+  ~RangeI() override;
+  explicit PROTOBUF_CONSTEXPR RangeI(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RangeI(const RangeI& from);
   RangeI(RangeI&& from) noexcept
@@ -1087,8 +1203,13 @@ class RangeI :
     return *this;
   }
   inline RangeI& operator=(RangeI&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1099,14 +1220,14 @@ class RangeI :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RangeI& default_instance() {
+    return *internal_default_instance();
   }
-  static const RangeI& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RangeI* internal_default_instance() {
     return reinterpret_cast<const RangeI*>(
                &_RangeI_default_instance_);
@@ -1119,57 +1240,66 @@ class RangeI :
   }
   inline void Swap(RangeI* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RangeI* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RangeI* New() const final {
-    return CreateMaybeMessage<RangeI>(nullptr);
-  }
-
-  RangeI* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RangeI* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RangeI>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RangeI& from);
-  void MergeFrom(const RangeI& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RangeI& from) {
+    RangeI::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RangeI* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.RangeI";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit RangeI(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1181,39 +1311,45 @@ class RangeI :
   };
   // int32 min = 1;
   void clear_min();
-  ::PROTOBUF_NAMESPACE_ID::int32 min() const;
-  void set_min(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t min() const;
+  void set_min(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_min() const;
-  void _internal_set_min(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_min() const;
+  void _internal_set_min(int32_t value);
   public:
 
   // int32 max = 2;
   void clear_max();
-  ::PROTOBUF_NAMESPACE_ID::int32 max() const;
-  void set_max(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t max() const;
+  void set_max(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_max() const;
-  void _internal_set_max(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_max() const;
+  void _internal_set_max(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.RangeI)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::int32 min_;
-  ::PROTOBUF_NAMESPACE_ID::int32 max_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t min_;
+    int32_t max_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Vec3 :
+class Vec3 final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.Vec3) */ {
  public:
-  Vec3();
-  virtual ~Vec3();
+  inline Vec3() : Vec3(nullptr) {}
+  ~Vec3() override;
+  explicit PROTOBUF_CONSTEXPR Vec3(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Vec3(const Vec3& from);
   Vec3(Vec3&& from) noexcept
@@ -1226,8 +1362,13 @@ class Vec3 :
     return *this;
   }
   inline Vec3& operator=(Vec3&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1238,14 +1379,14 @@ class Vec3 :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Vec3& default_instance() {
+    return *internal_default_instance();
   }
-  static const Vec3& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Vec3* internal_default_instance() {
     return reinterpret_cast<const Vec3*>(
                &_Vec3_default_instance_);
@@ -1258,57 +1399,66 @@ class Vec3 :
   }
   inline void Swap(Vec3* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Vec3* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Vec3* New() const final {
-    return CreateMaybeMessage<Vec3>(nullptr);
-  }
-
-  Vec3* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Vec3* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Vec3>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Vec3& from);
-  void MergeFrom(const Vec3& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Vec3& from) {
+    Vec3::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Vec3* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.Vec3";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Vec3(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1317,6 +1467,7 @@ class Vec3 :
   enum : int {
     kXFieldNumber = 1,
     kYFieldNumber = 2,
+    kQuantizedFieldNumber = 4,
     kZFieldNumber = 3,
   };
   // float x = 1;
@@ -1337,6 +1488,15 @@ class Vec3 :
   void _internal_set_y(float value);
   public:
 
+  // uint64 quantized = 4;
+  void clear_quantized();
+  uint64_t quantized() const;
+  void set_quantized(uint64_t value);
+  private:
+  uint64_t _internal_quantized() const;
+  void _internal_set_quantized(uint64_t value);
+  public:
+
   // float z = 3;
   void clear_z();
   float z() const;
@@ -1350,20 +1510,27 @@ class Vec3 :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  float x_;
-  float y_;
-  float z_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float x_;
+    float y_;
+    uint64_t quantized_;
+    float z_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Vec3Color :
+class Vec3Color final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.Vec3Color) */ {
  public:
-  Vec3Color();
-  virtual ~Vec3Color();
+  inline Vec3Color() : Vec3Color(nullptr) {}
+  ~Vec3Color() override;
+  explicit PROTOBUF_CONSTEXPR Vec3Color(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Vec3Color(const Vec3Color& from);
   Vec3Color(Vec3Color&& from) noexcept
@@ -1376,8 +1543,13 @@ class Vec3Color :
     return *this;
   }
   inline Vec3Color& operator=(Vec3Color&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1388,14 +1560,14 @@ class Vec3Color :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Vec3Color& default_instance() {
+    return *internal_default_instance();
   }
-  static const Vec3Color& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Vec3Color* internal_default_instance() {
     return reinterpret_cast<const Vec3Color*>(
                &_Vec3Color_default_instance_);
@@ -1408,57 +1580,66 @@ class Vec3Color :
   }
   inline void Swap(Vec3Color* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Vec3Color* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Vec3Color* New() const final {
-    return CreateMaybeMessage<Vec3Color>(nullptr);
-  }
-
-  Vec3Color* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Vec3Color* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Vec3Color>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Vec3Color& from);
-  void MergeFrom(const Vec3Color& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Vec3Color& from) {
+    Vec3Color::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Vec3Color* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.Vec3Color";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Vec3Color(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1499,32 +1680,38 @@ class Vec3Color :
 
   // uint32 color = 4;
   void clear_color();
-  ::PROTOBUF_NAMESPACE_ID::uint32 color() const;
-  void set_color(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t color() const;
+  void set_color(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_color() const;
-  void _internal_set_color(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_color() const;
+  void _internal_set_color(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.Vec3Color)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  float x_;
-  float y_;
-  float z_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 color_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float x_;
+    float y_;
+    float z_;
+    uint32_t color_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Vec4 :
+class Vec4 final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.Vec4) */ {
  public:
-  Vec4();
-  virtual ~Vec4();
+  inline Vec4() : Vec4(nullptr) {}
+  ~Vec4() override;
+  explicit PROTOBUF_CONSTEXPR Vec4(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Vec4(const Vec4& from);
   Vec4(Vec4&& from) noexcept
@@ -1537,8 +1724,13 @@ class Vec4 :
     return *this;
   }
   inline Vec4& operator=(Vec4&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1549,14 +1741,14 @@ class Vec4 :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Vec4& default_instance() {
+    return *internal_default_instance();
   }
-  static const Vec4& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Vec4* internal_default_instance() {
     return reinterpret_cast<const Vec4*>(
                &_Vec4_default_instance_);
@@ -1569,57 +1761,66 @@ class Vec4 :
   }
   inline void Swap(Vec4* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Vec4* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Vec4* New() const final {
-    return CreateMaybeMessage<Vec4>(nullptr);
-  }
-
-  Vec4* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Vec4* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Vec4>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Vec4& from);
-  void MergeFrom(const Vec4& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Vec4& from) {
+    Vec4::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Vec4* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.Vec4";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Vec4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1671,21 +1872,27 @@ class Vec4 :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  float x_;
-  float y_;
-  float z_;
-  float w_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float x_;
+    float y_;
+    float z_;
+    float w_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Line :
+class Line final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.Line) */ {
  public:
-  Line();
-  virtual ~Line();
+  inline Line() : Line(nullptr) {}
+  ~Line() override;
+  explicit PROTOBUF_CONSTEXPR Line(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Line(const Line& from);
   Line(Line&& from) noexcept
@@ -1698,8 +1905,13 @@ class Line :
     return *this;
   }
   inline Line& operator=(Line&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1710,14 +1922,14 @@ class Line :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Line& default_instance() {
+    return *internal_default_instance();
   }
-  static const Line& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Line* internal_default_instance() {
     return reinterpret_cast<const Line*>(
                &_Line_default_instance_);
@@ -1730,57 +1942,66 @@ class Line :
   }
   inline void Swap(Line* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Line* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Line* New() const final {
-    return CreateMaybeMessage<Line>(nullptr);
-  }
-
-  Line* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Line* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Line>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Line& from);
-  void MergeFrom(const Line& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Line& from) {
+    Line::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Line* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.Line";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Line(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1797,13 +2018,16 @@ class Line :
   public:
   void clear_p0();
   const ::Analytics::Vec3& p0() const;
-  ::Analytics::Vec3* release_p0();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_p0();
   ::Analytics::Vec3* mutable_p0();
   void set_allocated_p0(::Analytics::Vec3* p0);
   private:
   const ::Analytics::Vec3& _internal_p0() const;
   ::Analytics::Vec3* _internal_mutable_p0();
   public:
+  void unsafe_arena_set_allocated_p0(
+      ::Analytics::Vec3* p0);
+  ::Analytics::Vec3* unsafe_arena_release_p0();
 
   // .Analytics.Vec3 p1 = 2;
   bool has_p1() const;
@@ -1812,31 +2036,40 @@ class Line :
   public:
   void clear_p1();
   const ::Analytics::Vec3& p1() const;
-  ::Analytics::Vec3* release_p1();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_p1();
   ::Analytics::Vec3* mutable_p1();
   void set_allocated_p1(::Analytics::Vec3* p1);
   private:
   const ::Analytics::Vec3& _internal_p1() const;
   ::Analytics::Vec3* _internal_mutable_p1();
   public:
+  void unsafe_arena_set_allocated_p1(
+      ::Analytics::Vec3* p1);
+  ::Analytics::Vec3* unsafe_arena_release_p1();
 
   // @@protoc_insertion_point(class_scope:Analytics.Line)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::Analytics::Vec3* p0_;
-  ::Analytics::Vec3* p1_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::Analytics::Vec3* p0_;
+    ::Analytics::Vec3* p1_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Euler :
+class Euler final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.Euler) */ {
  public:
-  Euler();
-  virtual ~Euler();
+  inline Euler() : Euler(nullptr) {}
+  ~Euler() override;
+  explicit PROTOBUF_CONSTEXPR Euler(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Euler(const Euler& from);
   Euler(Euler&& from) noexcept
@@ -1849,8 +2082,13 @@ class Euler :
     return *this;
   }
   inline Euler& operator=(Euler&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1861,14 +2099,14 @@ class Euler :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Euler& default_instance() {
+    return *internal_default_instance();
   }
-  static const Euler& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Euler* internal_default_instance() {
     return reinterpret_cast<const Euler*>(
                &_Euler_default_instance_);
@@ -1881,57 +2119,66 @@ class Euler :
   }
   inline void Swap(Euler* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Euler* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Euler* New() const final {
-    return CreateMaybeMessage<Euler>(nullptr);
-  }
-
-  Euler* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Euler* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Euler>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Euler& from);
-  void MergeFrom(const Euler& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Euler& from) {
+    Euler::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Euler* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.Euler";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Euler(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1973,20 +2220,26 @@ class Euler :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  float heading_;
-  float pitch_;
-  float roll_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float heading_;
+    float pitch_;
+    float roll_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Material :
+class Material final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.Material) */ {
  public:
-  Material();
-  virtual ~Material();
+  inline Material() : Material(nullptr) {}
+  ~Material() override;
+  explicit PROTOBUF_CONSTEXPR Material(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Material(const Material& from);
   Material(Material&& from) noexcept
@@ -1999,8 +2252,13 @@ class Material :
     return *this;
   }
   inline Material& operator=(Material&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2011,14 +2269,14 @@ class Material :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Material& default_instance() {
+    return *internal_default_instance();
   }
-  static const Material& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Material* internal_default_instance() {
     return reinterpret_cast<const Material*>(
                &_Material_default_instance_);
@@ -2031,57 +2289,66 @@ class Material :
   }
   inline void Swap(Material* other) {
     if (other == this) return;
-    InternalSwap(other);
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Material* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Material* New() const final {
-    return CreateMaybeMessage<Material>(nullptr);
-  }
-
-  Material* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Material* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Material>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Material& from);
-  void MergeFrom(const Material& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Material& from) {
+    Material::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Material* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.Material";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Material(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2096,35 +2363,33 @@ class Material :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
   // uint32 contents = 2 [(.Analytics.enumkey) = "CONTENT_FLAGS", (.Analytics.enumflags) = true];
   void clear_contents();
-  ::PROTOBUF_NAMESPACE_ID::uint32 contents() const;
-  void set_contents(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t contents() const;
+  void set_contents(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_contents() const;
-  void _internal_set_contents(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_contents() const;
+  void _internal_set_contents(uint32_t value);
   public:
 
   // uint32 surfaceFlags = 3 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.enumflags) = true];
   void clear_surfaceflags();
-  ::PROTOBUF_NAMESPACE_ID::uint32 surfaceflags() const;
-  void set_surfaceflags(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t surfaceflags() const;
+  void set_surfaceflags(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_surfaceflags() const;
-  void _internal_set_surfaceflags(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_surfaceflags() const;
+  void _internal_set_surfaceflags(uint32_t value);
   public:
 
   // bool renderEvents = 4;
@@ -2140,21 +2405,27 @@ class Material :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 contents_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 surfaceflags_;
-  bool renderevents_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t contents_;
+    uint32_t surfaceflags_;
+    bool renderevents_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PrimitiveOptions :
+class PrimitiveOptions final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.PrimitiveOptions) */ {
  public:
-  PrimitiveOptions();
-  virtual ~PrimitiveOptions();
+  inline PrimitiveOptions() : PrimitiveOptions(nullptr) {}
+  ~PrimitiveOptions() override;
+  explicit PROTOBUF_CONSTEXPR PrimitiveOptions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PrimitiveOptions(const PrimitiveOptions& from);
   PrimitiveOptions(PrimitiveOptions&& from) noexcept
@@ -2167,8 +2438,13 @@ class PrimitiveOptions :
     return *this;
   }
   inline PrimitiveOptions& operator=(PrimitiveOptions&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2179,14 +2455,14 @@ class PrimitiveOptions :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrimitiveOptions& default_instance() {
+    return *internal_default_instance();
   }
-  static const PrimitiveOptions& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const PrimitiveOptions* internal_default_instance() {
     return reinterpret_cast<const PrimitiveOptions*>(
                &_PrimitiveOptions_default_instance_);
@@ -2199,57 +2475,66 @@ class PrimitiveOptions :
   }
   inline void Swap(PrimitiveOptions* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrimitiveOptions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline PrimitiveOptions* New() const final {
-    return CreateMaybeMessage<PrimitiveOptions>(nullptr);
-  }
-
-  PrimitiveOptions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  PrimitiveOptions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PrimitiveOptions>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PrimitiveOptions& from);
-  void MergeFrom(const PrimitiveOptions& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrimitiveOptions& from) {
+    PrimitiveOptions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PrimitiveOptions* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.PrimitiveOptions";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit PrimitiveOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2261,39 +2546,45 @@ class PrimitiveOptions :
   };
   // uint32 partIndex = 1 [(.Analytics.editable_key) = true];
   void clear_partindex();
-  ::PROTOBUF_NAMESPACE_ID::uint32 partindex() const;
-  void set_partindex(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t partindex() const;
+  void set_partindex(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_partindex() const;
-  void _internal_set_partindex(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_partindex() const;
+  void _internal_set_partindex(uint32_t value);
   public:
 
   // uint32 overrideSurfaceFlags = 2 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.editable) = true, (.Analytics.enumflags) = true];
   void clear_overridesurfaceflags();
-  ::PROTOBUF_NAMESPACE_ID::uint32 overridesurfaceflags() const;
-  void set_overridesurfaceflags(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t overridesurfaceflags() const;
+  void set_overridesurfaceflags(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_overridesurfaceflags() const;
-  void _internal_set_overridesurfaceflags(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_overridesurfaceflags() const;
+  void _internal_set_overridesurfaceflags(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.PrimitiveOptions)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 partindex_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 overridesurfaceflags_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t partindex_;
+    uint32_t overridesurfaceflags_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Primitive :
+class Primitive final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.Primitive) */ {
  public:
-  Primitive();
-  virtual ~Primitive();
+  inline Primitive() : Primitive(nullptr) {}
+  ~Primitive() override;
+  explicit PROTOBUF_CONSTEXPR Primitive(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Primitive(const Primitive& from);
   Primitive(Primitive&& from) noexcept
@@ -2306,8 +2597,13 @@ class Primitive :
     return *this;
   }
   inline Primitive& operator=(Primitive&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2318,14 +2614,14 @@ class Primitive :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Primitive& default_instance() {
+    return *internal_default_instance();
   }
-  static const Primitive& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Primitive* internal_default_instance() {
     return reinterpret_cast<const Primitive*>(
                &_Primitive_default_instance_);
@@ -2338,57 +2634,66 @@ class Primitive :
   }
   inline void Swap(Primitive* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Primitive* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Primitive* New() const final {
-    return CreateMaybeMessage<Primitive>(nullptr);
-  }
-
-  Primitive* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Primitive* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Primitive>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Primitive& from);
-  void MergeFrom(const Primitive& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Primitive& from) {
+    Primitive::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Primitive* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.Primitive";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Primitive(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2426,13 +2731,16 @@ class Primitive :
   public:
   void clear_options();
   const ::Analytics::PrimitiveOptions& options() const;
-  ::Analytics::PrimitiveOptions* release_options();
+  PROTOBUF_NODISCARD ::Analytics::PrimitiveOptions* release_options();
   ::Analytics::PrimitiveOptions* mutable_options();
   void set_allocated_options(::Analytics::PrimitiveOptions* options);
   private:
   const ::Analytics::PrimitiveOptions& _internal_options() const;
   ::Analytics::PrimitiveOptions* _internal_mutable_options();
   public:
+  void unsafe_arena_set_allocated_options(
+      ::Analytics::PrimitiveOptions* options);
+  ::Analytics::PrimitiveOptions* unsafe_arena_release_options();
 
   // .Analytics.PrimitiveType type = 1;
   void clear_type();
@@ -2445,11 +2753,11 @@ class Primitive :
 
   // uint32 materialIndex = 2;
   void clear_materialindex();
-  ::PROTOBUF_NAMESPACE_ID::uint32 materialindex() const;
-  void set_materialindex(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t materialindex() const;
+  void set_materialindex(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_materialindex() const;
-  void _internal_set_materialindex(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_materialindex() const;
+  void _internal_set_materialindex(uint32_t value);
   public:
 
   // float size = 4;
@@ -2465,22 +2773,28 @@ class Primitive :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Vec3Color > vertices_;
-  ::Analytics::PrimitiveOptions* options_;
-  int type_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 materialindex_;
-  float size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Vec3Color > vertices_;
+    ::Analytics::PrimitiveOptions* options_;
+    int type_;
+    uint32_t materialindex_;
+    float size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Mesh :
+class Mesh final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.Mesh) */ {
  public:
-  Mesh();
-  virtual ~Mesh();
+  inline Mesh() : Mesh(nullptr) {}
+  ~Mesh() override;
+  explicit PROTOBUF_CONSTEXPR Mesh(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Mesh(const Mesh& from);
   Mesh(Mesh&& from) noexcept
@@ -2493,8 +2807,13 @@ class Mesh :
     return *this;
   }
   inline Mesh& operator=(Mesh&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2505,14 +2824,14 @@ class Mesh :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mesh& default_instance() {
+    return *internal_default_instance();
   }
-  static const Mesh& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Mesh* internal_default_instance() {
     return reinterpret_cast<const Mesh*>(
                &_Mesh_default_instance_);
@@ -2525,57 +2844,66 @@ class Mesh :
   }
   inline void Swap(Mesh* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mesh* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Mesh* New() const final {
-    return CreateMaybeMessage<Mesh>(nullptr);
-  }
-
-  Mesh* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Mesh* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Mesh>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Mesh& from);
-  void MergeFrom(const Mesh& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Mesh& from) {
+    Mesh::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Mesh* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.Mesh";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Mesh(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2625,16 +2953,14 @@ class Mesh :
   // string name = 3;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -2642,20 +2968,26 @@ class Mesh :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Primitive > primitives_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Material > materials_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Primitive > primitives_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Material > materials_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UTCTime :
+class UTCTime final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.UTCTime) */ {
  public:
-  UTCTime();
-  virtual ~UTCTime();
+  inline UTCTime() : UTCTime(nullptr) {}
+  ~UTCTime() override;
+  explicit PROTOBUF_CONSTEXPR UTCTime(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UTCTime(const UTCTime& from);
   UTCTime(UTCTime&& from) noexcept
@@ -2668,8 +3000,13 @@ class UTCTime :
     return *this;
   }
   inline UTCTime& operator=(UTCTime&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2680,14 +3017,14 @@ class UTCTime :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UTCTime& default_instance() {
+    return *internal_default_instance();
   }
-  static const UTCTime& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const UTCTime* internal_default_instance() {
     return reinterpret_cast<const UTCTime*>(
                &_UTCTime_default_instance_);
@@ -2700,57 +3037,66 @@ class UTCTime :
   }
   inline void Swap(UTCTime* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UTCTime* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UTCTime* New() const final {
-    return CreateMaybeMessage<UTCTime>(nullptr);
-  }
-
-  UTCTime* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  UTCTime* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<UTCTime>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UTCTime& from);
-  void MergeFrom(const UTCTime& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UTCTime& from) {
+    UTCTime::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(UTCTime* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.UTCTime";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit UTCTime(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2766,79 +3112,85 @@ class UTCTime :
   };
   // int32 hour = 1;
   void clear_hour();
-  ::PROTOBUF_NAMESPACE_ID::int32 hour() const;
-  void set_hour(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t hour() const;
+  void set_hour(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_hour() const;
-  void _internal_set_hour(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_hour() const;
+  void _internal_set_hour(int32_t value);
   public:
 
   // int32 minute = 2;
   void clear_minute();
-  ::PROTOBUF_NAMESPACE_ID::int32 minute() const;
-  void set_minute(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t minute() const;
+  void set_minute(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_minute() const;
-  void _internal_set_minute(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_minute() const;
+  void _internal_set_minute(int32_t value);
   public:
 
   // int32 second = 3;
   void clear_second();
-  ::PROTOBUF_NAMESPACE_ID::int32 second() const;
-  void set_second(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t second() const;
+  void set_second(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_second() const;
-  void _internal_set_second(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_second() const;
+  void _internal_set_second(int32_t value);
   public:
 
   // int32 day = 4;
   void clear_day();
-  ::PROTOBUF_NAMESPACE_ID::int32 day() const;
-  void set_day(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t day() const;
+  void set_day(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_day() const;
-  void _internal_set_day(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_day() const;
+  void _internal_set_day(int32_t value);
   public:
 
   // int32 month = 5;
   void clear_month();
-  ::PROTOBUF_NAMESPACE_ID::int32 month() const;
-  void set_month(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t month() const;
+  void set_month(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_month() const;
-  void _internal_set_month(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_month() const;
+  void _internal_set_month(int32_t value);
   public:
 
   // int32 year = 6;
   void clear_year();
-  ::PROTOBUF_NAMESPACE_ID::int32 year() const;
-  void set_year(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t year() const;
+  void set_year(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_year() const;
-  void _internal_set_year(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_year() const;
+  void _internal_set_year(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.UTCTime)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::int32 hour_;
-  ::PROTOBUF_NAMESPACE_ID::int32 minute_;
-  ::PROTOBUF_NAMESPACE_ID::int32 second_;
-  ::PROTOBUF_NAMESPACE_ID::int32 day_;
-  ::PROTOBUF_NAMESPACE_ID::int32 month_;
-  ::PROTOBUF_NAMESPACE_ID::int32 year_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t hour_;
+    int32_t minute_;
+    int32_t second_;
+    int32_t day_;
+    int32_t month_;
+    int32_t year_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameInfo :
+class GameInfo final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameInfo) */ {
  public:
-  GameInfo();
-  virtual ~GameInfo();
+  inline GameInfo() : GameInfo(nullptr) {}
+  ~GameInfo() override;
+  explicit PROTOBUF_CONSTEXPR GameInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameInfo(const GameInfo& from);
   GameInfo(GameInfo&& from) noexcept
@@ -2851,8 +3203,13 @@ class GameInfo :
     return *this;
   }
   inline GameInfo& operator=(GameInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2863,14 +3220,14 @@ class GameInfo :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameInfo& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameInfo& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameInfo* internal_default_instance() {
     return reinterpret_cast<const GameInfo*>(
                &_GameInfo_default_instance_);
@@ -2883,57 +3240,66 @@ class GameInfo :
   }
   inline void Swap(GameInfo* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameInfo* New() const final {
-    return CreateMaybeMessage<GameInfo>(nullptr);
-  }
-
-  GameInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameInfo>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameInfo& from);
-  void MergeFrom(const GameInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameInfo& from) {
+    GameInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameInfo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameInfo";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2944,52 +3310,48 @@ class GameInfo :
     kGameNameFieldNumber = 3,
     kGameVersionFieldNumber = 4,
     kTimeStampFieldNumber = 1,
+    kWorldMinsFieldNumber = 5,
+    kWorldMaxsFieldNumber = 6,
   };
   // string mapName = 2;
   void clear_mapname();
   const std::string& mapname() const;
-  void set_mapname(const std::string& value);
-  void set_mapname(std::string&& value);
-  void set_mapname(const char* value);
-  void set_mapname(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mapname(ArgT0&& arg0, ArgT... args);
   std::string* mutable_mapname();
-  std::string* release_mapname();
+  PROTOBUF_NODISCARD std::string* release_mapname();
   void set_allocated_mapname(std::string* mapname);
   private:
   const std::string& _internal_mapname() const;
-  void _internal_set_mapname(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mapname(const std::string& value);
   std::string* _internal_mutable_mapname();
   public:
 
   // string gameName = 3;
   void clear_gamename();
   const std::string& gamename() const;
-  void set_gamename(const std::string& value);
-  void set_gamename(std::string&& value);
-  void set_gamename(const char* value);
-  void set_gamename(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_gamename(ArgT0&& arg0, ArgT... args);
   std::string* mutable_gamename();
-  std::string* release_gamename();
+  PROTOBUF_NODISCARD std::string* release_gamename();
   void set_allocated_gamename(std::string* gamename);
   private:
   const std::string& _internal_gamename() const;
-  void _internal_set_gamename(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_gamename(const std::string& value);
   std::string* _internal_mutable_gamename();
   public:
 
   // string gameVersion = 4;
   void clear_gameversion();
   const std::string& gameversion() const;
-  void set_gameversion(const std::string& value);
-  void set_gameversion(std::string&& value);
-  void set_gameversion(const char* value);
-  void set_gameversion(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_gameversion(ArgT0&& arg0, ArgT... args);
   std::string* mutable_gameversion();
-  std::string* release_gameversion();
+  PROTOBUF_NODISCARD std::string* release_gameversion();
   void set_allocated_gameversion(std::string* gameversion);
   private:
   const std::string& _internal_gameversion() const;
-  void _internal_set_gameversion(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_gameversion(const std::string& value);
   std::string* _internal_mutable_gameversion();
   public:
 
@@ -3000,33 +3362,80 @@ class GameInfo :
   public:
   void clear_timestamp();
   const ::Analytics::UTCTime& timestamp() const;
-  ::Analytics::UTCTime* release_timestamp();
+  PROTOBUF_NODISCARD ::Analytics::UTCTime* release_timestamp();
   ::Analytics::UTCTime* mutable_timestamp();
   void set_allocated_timestamp(::Analytics::UTCTime* timestamp);
   private:
   const ::Analytics::UTCTime& _internal_timestamp() const;
   ::Analytics::UTCTime* _internal_mutable_timestamp();
   public:
+  void unsafe_arena_set_allocated_timestamp(
+      ::Analytics::UTCTime* timestamp);
+  ::Analytics::UTCTime* unsafe_arena_release_timestamp();
+
+  // .Analytics.Vec3 worldMins = 5;
+  bool has_worldmins() const;
+  private:
+  bool _internal_has_worldmins() const;
+  public:
+  void clear_worldmins();
+  const ::Analytics::Vec3& worldmins() const;
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_worldmins();
+  ::Analytics::Vec3* mutable_worldmins();
+  void set_allocated_worldmins(::Analytics::Vec3* worldmins);
+  private:
+  const ::Analytics::Vec3& _internal_worldmins() const;
+  ::Analytics::Vec3* _internal_mutable_worldmins();
+  public:
+  void unsafe_arena_set_allocated_worldmins(
+      ::Analytics::Vec3* worldmins);
+  ::Analytics::Vec3* unsafe_arena_release_worldmins();
+
+  // .Analytics.Vec3 worldMaxs = 6;
+  bool has_worldmaxs() const;
+  private:
+  bool _internal_has_worldmaxs() const;
+  public:
+  void clear_worldmaxs();
+  const ::Analytics::Vec3& worldmaxs() const;
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_worldmaxs();
+  ::Analytics::Vec3* mutable_worldmaxs();
+  void set_allocated_worldmaxs(::Analytics::Vec3* worldmaxs);
+  private:
+  const ::Analytics::Vec3& _internal_worldmaxs() const;
+  ::Analytics::Vec3* _internal_mutable_worldmaxs();
+  public:
+  void unsafe_arena_set_allocated_worldmaxs(
+      ::Analytics::Vec3* worldmaxs);
+  ::Analytics::Vec3* unsafe_arena_release_worldmaxs();
 
   // @@protoc_insertion_point(class_scope:Analytics.GameInfo)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mapname_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr gamename_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr gameversion_;
-  ::Analytics::UTCTime* timestamp_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mapname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr gamename_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr gameversion_;
+    ::Analytics::UTCTime* timestamp_;
+    ::Analytics::Vec3* worldmins_;
+    ::Analytics::Vec3* worldmaxs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameEnum_EnumPair :
+class GameEnum_EnumPair final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameEnum.EnumPair) */ {
  public:
-  GameEnum_EnumPair();
-  virtual ~GameEnum_EnumPair();
+  inline GameEnum_EnumPair() : GameEnum_EnumPair(nullptr) {}
+  ~GameEnum_EnumPair() override;
+  explicit PROTOBUF_CONSTEXPR GameEnum_EnumPair(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameEnum_EnumPair(const GameEnum_EnumPair& from);
   GameEnum_EnumPair(GameEnum_EnumPair&& from) noexcept
@@ -3039,8 +3448,13 @@ class GameEnum_EnumPair :
     return *this;
   }
   inline GameEnum_EnumPair& operator=(GameEnum_EnumPair&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3051,14 +3465,14 @@ class GameEnum_EnumPair :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameEnum_EnumPair& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameEnum_EnumPair& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameEnum_EnumPair* internal_default_instance() {
     return reinterpret_cast<const GameEnum_EnumPair*>(
                &_GameEnum_EnumPair_default_instance_);
@@ -3071,57 +3485,66 @@ class GameEnum_EnumPair :
   }
   inline void Swap(GameEnum_EnumPair* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameEnum_EnumPair* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameEnum_EnumPair* New() const final {
-    return CreateMaybeMessage<GameEnum_EnumPair>(nullptr);
-  }
-
-  GameEnum_EnumPair* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameEnum_EnumPair* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameEnum_EnumPair>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameEnum_EnumPair& from);
-  void MergeFrom(const GameEnum_EnumPair& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameEnum_EnumPair& from) {
+    GameEnum_EnumPair::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameEnum_EnumPair* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameEnum.EnumPair";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameEnum_EnumPair(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3134,45 +3557,49 @@ class GameEnum_EnumPair :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
   // int64 value = 2;
   void clear_value();
-  ::PROTOBUF_NAMESPACE_ID::int64 value() const;
-  void set_value(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t value() const;
+  void set_value(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_value() const;
-  void _internal_set_value(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_value() const;
+  void _internal_set_value(int64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.GameEnum.EnumPair)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::int64 value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int64_t value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameEnum :
+class GameEnum final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameEnum) */ {
  public:
-  GameEnum();
-  virtual ~GameEnum();
+  inline GameEnum() : GameEnum(nullptr) {}
+  ~GameEnum() override;
+  explicit PROTOBUF_CONSTEXPR GameEnum(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameEnum(const GameEnum& from);
   GameEnum(GameEnum&& from) noexcept
@@ -3185,8 +3612,13 @@ class GameEnum :
     return *this;
   }
   inline GameEnum& operator=(GameEnum&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3197,14 +3629,14 @@ class GameEnum :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameEnum& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameEnum& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameEnum* internal_default_instance() {
     return reinterpret_cast<const GameEnum*>(
                &_GameEnum_default_instance_);
@@ -3217,57 +3649,66 @@ class GameEnum :
   }
   inline void Swap(GameEnum* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameEnum* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameEnum* New() const final {
-    return CreateMaybeMessage<GameEnum>(nullptr);
-  }
-
-  GameEnum* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameEnum* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameEnum>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameEnum& from);
-  void MergeFrom(const GameEnum& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameEnum& from) {
+    GameEnum::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameEnum* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameEnum";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameEnum(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3301,16 +3742,14 @@ class GameEnum :
   // string enumname = 2;
   void clear_enumname();
   const std::string& enumname() const;
-  void set_enumname(const std::string& value);
-  void set_enumname(std::string&& value);
-  void set_enumname(const char* value);
-  void set_enumname(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_enumname(ArgT0&& arg0, ArgT... args);
   std::string* mutable_enumname();
-  std::string* release_enumname();
+  PROTOBUF_NODISCARD std::string* release_enumname();
   void set_allocated_enumname(std::string* enumname);
   private:
   const std::string& _internal_enumname() const;
-  void _internal_set_enumname(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_enumname(const std::string& value);
   std::string* _internal_mutable_enumname();
   public:
 
@@ -3327,34 +3766,45 @@ class GameEnum :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::GameEnum_EnumPair > values_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr enumname_;
-  bool isbitfield_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::GameEnum_EnumPair > values_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr enumname_;
+    bool isbitfield_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameNavNotFound :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameNavNotFound) */ {
+class GameString final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameString) */ {
  public:
-  GameNavNotFound();
-  virtual ~GameNavNotFound();
+  inline GameString() : GameString(nullptr) {}
+  ~GameString() override;
+  explicit PROTOBUF_CONSTEXPR GameString(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  GameNavNotFound(const GameNavNotFound& from);
-  GameNavNotFound(GameNavNotFound&& from) noexcept
-    : GameNavNotFound() {
+  GameString(const GameString& from);
+  GameString(GameString&& from) noexcept
+    : GameString() {
     *this = ::std::move(from);
   }
 
-  inline GameNavNotFound& operator=(const GameNavNotFound& from) {
+  inline GameString& operator=(const GameString& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GameNavNotFound& operator=(GameNavNotFound&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline GameString& operator=(GameString&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3365,131 +3815,160 @@ class GameNavNotFound :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const GameNavNotFound& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const GameNavNotFound* internal_default_instance() {
-    return reinterpret_cast<const GameNavNotFound*>(
-               &_GameNavNotFound_default_instance_);
+  static const GameString& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameString* internal_default_instance() {
+    return reinterpret_cast<const GameString*>(
+               &_GameString_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     19;
 
-  friend void swap(GameNavNotFound& a, GameNavNotFound& b) {
+  friend void swap(GameString& a, GameString& b) {
     a.Swap(&b);
   }
-  inline void Swap(GameNavNotFound* other) {
+  inline void Swap(GameString* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameString* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameNavNotFound* New() const final {
-    return CreateMaybeMessage<GameNavNotFound>(nullptr);
+  GameString* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameString>(arena);
   }
-
-  GameNavNotFound* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<GameNavNotFound>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameString& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameString& from) {
+    GameString::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const GameNavNotFound& from);
-  void MergeFrom(const GameNavNotFound& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(GameNavNotFound* other);
+  void InternalSwap(GameString* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Analytics.GameNavNotFound";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "Analytics.GameString";
   }
+  protected:
+  explicit GameString(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMapNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kIdFieldNumber = 1,
   };
-  // string mapName = 1;
-  void clear_mapname();
-  const std::string& mapname() const;
-  void set_mapname(const std::string& value);
-  void set_mapname(std::string&& value);
-  void set_mapname(const char* value);
-  void set_mapname(const char* value, size_t size);
-  std::string* mutable_mapname();
-  std::string* release_mapname();
-  void set_allocated_mapname(std::string* mapname);
+  // string value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
   private:
-  const std::string& _internal_mapname() const;
-  void _internal_set_mapname(const std::string& value);
-  std::string* _internal_mutable_mapname();
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
   public:
 
-  // @@protoc_insertion_point(class_scope:Analytics.GameNavNotFound)
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Analytics.GameString)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mapname_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameNavAutoDownloaded :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameNavAutoDownloaded) */ {
+class LiveHeatmap final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.LiveHeatmap) */ {
  public:
-  GameNavAutoDownloaded();
-  virtual ~GameNavAutoDownloaded();
+  inline LiveHeatmap() : LiveHeatmap(nullptr) {}
+  ~LiveHeatmap() override;
+  explicit PROTOBUF_CONSTEXPR LiveHeatmap(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  GameNavAutoDownloaded(const GameNavAutoDownloaded& from);
-  GameNavAutoDownloaded(GameNavAutoDownloaded&& from) noexcept
-    : GameNavAutoDownloaded() {
+  LiveHeatmap(const LiveHeatmap& from);
+  LiveHeatmap(LiveHeatmap&& from) noexcept
+    : LiveHeatmap() {
     *this = ::std::move(from);
   }
 
-  inline GameNavAutoDownloaded& operator=(const GameNavAutoDownloaded& from) {
+  inline LiveHeatmap& operator=(const LiveHeatmap& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GameNavAutoDownloaded& operator=(GameNavAutoDownloaded&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline LiveHeatmap& operator=(LiveHeatmap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3500,117 +3979,574 @@ class GameNavAutoDownloaded :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const GameNavAutoDownloaded& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const GameNavAutoDownloaded* internal_default_instance() {
-    return reinterpret_cast<const GameNavAutoDownloaded*>(
-               &_GameNavAutoDownloaded_default_instance_);
+  static const LiveHeatmap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LiveHeatmap* internal_default_instance() {
+    return reinterpret_cast<const LiveHeatmap*>(
+               &_LiveHeatmap_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     20;
 
-  friend void swap(GameNavAutoDownloaded& a, GameNavAutoDownloaded& b) {
+  friend void swap(LiveHeatmap& a, LiveHeatmap& b) {
     a.Swap(&b);
   }
-  inline void Swap(GameNavAutoDownloaded* other) {
+  inline void Swap(LiveHeatmap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LiveHeatmap* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameNavAutoDownloaded* New() const final {
-    return CreateMaybeMessage<GameNavAutoDownloaded>(nullptr);
+  LiveHeatmap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LiveHeatmap>(arena);
   }
-
-  GameNavAutoDownloaded* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<GameNavAutoDownloaded>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LiveHeatmap& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LiveHeatmap& from) {
+    LiveHeatmap::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const GameNavAutoDownloaded& from);
-  void MergeFrom(const GameNavAutoDownloaded& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(GameNavAutoDownloaded* other);
+  void InternalSwap(LiveHeatmap* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Analytics.GameNavAutoDownloaded";
+    return "Analytics.LiveHeatmap";
   }
+  protected:
+  explicit LiveHeatmap(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventTypeFieldNumber = 1,
+    kKeyFieldNumber = 2,
+    kValuesFieldNumber = 9,
+    kWorldMinsFieldNumber = 7,
+    kWorldMaxsFieldNumber = 8,
+    kTimeStampFieldNumber = 3,
+    kWidthFieldNumber = 4,
+    kHeightFieldNumber = 5,
+    kMaxValueFieldNumber = 6,
+  };
+  // string eventType = 1;
+  void clear_eventtype();
+  const std::string& eventtype() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_eventtype(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_eventtype();
+  PROTOBUF_NODISCARD std::string* release_eventtype();
+  void set_allocated_eventtype(std::string* eventtype);
+  private:
+  const std::string& _internal_eventtype() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_eventtype(const std::string& value);
+  std::string* _internal_mutable_eventtype();
+  public:
+
+  // string key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes values = 9;
+  void clear_values();
+  const std::string& values() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_values(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_values();
+  PROTOBUF_NODISCARD std::string* release_values();
+  void set_allocated_values(std::string* values);
+  private:
+  const std::string& _internal_values() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_values(const std::string& value);
+  std::string* _internal_mutable_values();
+  public:
+
+  // .Analytics.Vec3 worldMins = 7;
+  bool has_worldmins() const;
+  private:
+  bool _internal_has_worldmins() const;
+  public:
+  void clear_worldmins();
+  const ::Analytics::Vec3& worldmins() const;
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_worldmins();
+  ::Analytics::Vec3* mutable_worldmins();
+  void set_allocated_worldmins(::Analytics::Vec3* worldmins);
+  private:
+  const ::Analytics::Vec3& _internal_worldmins() const;
+  ::Analytics::Vec3* _internal_mutable_worldmins();
+  public:
+  void unsafe_arena_set_allocated_worldmins(
+      ::Analytics::Vec3* worldmins);
+  ::Analytics::Vec3* unsafe_arena_release_worldmins();
+
+  // .Analytics.Vec3 worldMaxs = 8;
+  bool has_worldmaxs() const;
+  private:
+  bool _internal_has_worldmaxs() const;
+  public:
+  void clear_worldmaxs();
+  const ::Analytics::Vec3& worldmaxs() const;
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_worldmaxs();
+  ::Analytics::Vec3* mutable_worldmaxs();
+  void set_allocated_worldmaxs(::Analytics::Vec3* worldmaxs);
+  private:
+  const ::Analytics::Vec3& _internal_worldmaxs() const;
+  ::Analytics::Vec3* _internal_mutable_worldmaxs();
+  public:
+  void unsafe_arena_set_allocated_worldmaxs(
+      ::Analytics::Vec3* worldmaxs);
+  ::Analytics::Vec3* unsafe_arena_release_worldmaxs();
+
+  // int64 timeStamp = 3;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // int32 width = 4;
+  void clear_width();
+  int32_t width() const;
+  void set_width(int32_t value);
+  private:
+  int32_t _internal_width() const;
+  void _internal_set_width(int32_t value);
+  public:
+
+  // int32 height = 5;
+  void clear_height();
+  int32_t height() const;
+  void set_height(int32_t value);
   private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
+  int32_t _internal_height() const;
+  void _internal_set_height(int32_t value);
+  public:
+
+  // float maxValue = 6;
+  void clear_maxvalue();
+  float maxvalue() const;
+  void set_maxvalue(float value);
+  private:
+  float _internal_maxvalue() const;
+  void _internal_set_maxvalue(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Analytics.LiveHeatmap)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr eventtype_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr values_;
+    ::Analytics::Vec3* worldmins_;
+    ::Analytics::Vec3* worldmaxs_;
+    int64_t timestamp_;
+    int32_t width_;
+    int32_t height_;
+    float maxvalue_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_analytics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GameNavNotFound final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameNavNotFound) */ {
+ public:
+  inline GameNavNotFound() : GameNavNotFound(nullptr) {}
+  ~GameNavNotFound() override;
+  explicit PROTOBUF_CONSTEXPR GameNavNotFound(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameNavNotFound(const GameNavNotFound& from);
+  GameNavNotFound(GameNavNotFound&& from) noexcept
+    : GameNavNotFound() {
+    *this = ::std::move(from);
+  }
+
+  inline GameNavNotFound& operator=(const GameNavNotFound& from) {
+    CopyFrom(from);
+    return *this;
   }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+  inline GameNavNotFound& operator=(GameNavNotFound&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameNavNotFound& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameNavNotFound* internal_default_instance() {
+    return reinterpret_cast<const GameNavNotFound*>(
+               &_GameNavNotFound_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(GameNavNotFound& a, GameNavNotFound& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameNavNotFound* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
   }
+  void UnsafeArenaSwap(GameNavNotFound* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameNavNotFound* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameNavNotFound>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameNavNotFound& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameNavNotFound& from) {
+    GameNavNotFound::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameNavNotFound* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Analytics.GameNavNotFound";
+  }
+  protected:
+  explicit GameNavNotFound(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMapNameFieldNumber = 1,
+    kMapNameIdFieldNumber = 2,
+  };
+  // string mapName = 1 [(.Analytics.intern) = "mapNameId"];
+  void clear_mapname();
+  const std::string& mapname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mapname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mapname();
+  PROTOBUF_NODISCARD std::string* release_mapname();
+  void set_allocated_mapname(std::string* mapname);
   private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
+  const std::string& _internal_mapname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mapname(const std::string& value);
+  std::string* _internal_mutable_mapname();
+  public:
+
+  // uint32 mapNameId = 2 [(.Analytics.hidden) = true];
+  void clear_mapnameid();
+  uint32_t mapnameid() const;
+  void set_mapnameid(uint32_t value);
+  private:
+  uint32_t _internal_mapnameid() const;
+  void _internal_set_mapnameid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Analytics.GameNavNotFound)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mapname_;
+    uint32_t mapnameid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_analytics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GameNavAutoDownloaded final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameNavAutoDownloaded) */ {
+ public:
+  inline GameNavAutoDownloaded() : GameNavAutoDownloaded(nullptr) {}
+  ~GameNavAutoDownloaded() override;
+  explicit PROTOBUF_CONSTEXPR GameNavAutoDownloaded(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameNavAutoDownloaded(const GameNavAutoDownloaded& from);
+  GameNavAutoDownloaded(GameNavAutoDownloaded&& from) noexcept
+    : GameNavAutoDownloaded() {
+    *this = ::std::move(from);
+  }
+
+  inline GameNavAutoDownloaded& operator=(const GameNavAutoDownloaded& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameNavAutoDownloaded& operator=(GameNavAutoDownloaded&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameNavAutoDownloaded& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameNavAutoDownloaded* internal_default_instance() {
+    return reinterpret_cast<const GameNavAutoDownloaded*>(
+               &_GameNavAutoDownloaded_default_instance_);
   }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(GameNavAutoDownloaded& a, GameNavAutoDownloaded& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameNavAutoDownloaded* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameNavAutoDownloaded* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameNavAutoDownloaded* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameNavAutoDownloaded>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameNavAutoDownloaded& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameNavAutoDownloaded& from) {
+    GameNavAutoDownloaded::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameNavAutoDownloaded* other);
 
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Analytics.GameNavAutoDownloaded";
+  }
+  protected:
+  explicit GameNavAutoDownloaded(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
     kMapNameFieldNumber = 1,
+    kMapNameIdFieldNumber = 2,
   };
-  // string mapName = 1;
+  // string mapName = 1 [(.Analytics.intern) = "mapNameId"];
   void clear_mapname();
   const std::string& mapname() const;
-  void set_mapname(const std::string& value);
-  void set_mapname(std::string&& value);
-  void set_mapname(const char* value);
-  void set_mapname(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mapname(ArgT0&& arg0, ArgT... args);
   std::string* mutable_mapname();
-  std::string* release_mapname();
+  PROTOBUF_NODISCARD std::string* release_mapname();
   void set_allocated_mapname(std::string* mapname);
   private:
   const std::string& _internal_mapname() const;
-  void _internal_set_mapname(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mapname(const std::string& value);
   std::string* _internal_mutable_mapname();
   public:
 
+  // uint32 mapNameId = 2 [(.Analytics.hidden) = true];
+  void clear_mapnameid();
+  uint32_t mapnameid() const;
+  void set_mapnameid(uint32_t value);
+  private:
+  uint32_t _internal_mapnameid() const;
+  void _internal_set_mapnameid(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:Analytics.GameNavAutoDownloaded)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mapname_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mapname_;
+    uint32_t mapnameid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameAssert :
+class GameAssert final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameAssert) */ {
  public:
-  GameAssert();
-  virtual ~GameAssert();
+  inline GameAssert() : GameAssert(nullptr) {}
+  ~GameAssert() override;
+  explicit PROTOBUF_CONSTEXPR GameAssert(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameAssert(const GameAssert& from);
   GameAssert(GameAssert&& from) noexcept
@@ -3623,8 +4559,13 @@ class GameAssert :
     return *this;
   }
   inline GameAssert& operator=(GameAssert&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3635,77 +4576,86 @@ class GameAssert :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameAssert& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameAssert& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameAssert* internal_default_instance() {
     return reinterpret_cast<const GameAssert*>(
                &_GameAssert_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    21;
+    23;
 
   friend void swap(GameAssert& a, GameAssert& b) {
     a.Swap(&b);
   }
   inline void Swap(GameAssert* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameAssert* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameAssert* New() const final {
-    return CreateMaybeMessage<GameAssert>(nullptr);
-  }
-
-  GameAssert* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameAssert* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameAssert>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameAssert& from);
-  void MergeFrom(const GameAssert& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameAssert& from) {
+    GameAssert::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameAssert* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameAssert";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameAssert(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3719,62 +4669,64 @@ class GameAssert :
   // string condition = 1;
   void clear_condition();
   const std::string& condition() const;
-  void set_condition(const std::string& value);
-  void set_condition(std::string&& value);
-  void set_condition(const char* value);
-  void set_condition(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_condition(ArgT0&& arg0, ArgT... args);
   std::string* mutable_condition();
-  std::string* release_condition();
+  PROTOBUF_NODISCARD std::string* release_condition();
   void set_allocated_condition(std::string* condition);
   private:
   const std::string& _internal_condition() const;
-  void _internal_set_condition(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_condition(const std::string& value);
   std::string* _internal_mutable_condition();
   public:
 
   // string file = 2;
   void clear_file();
   const std::string& file() const;
-  void set_file(const std::string& value);
-  void set_file(std::string&& value);
-  void set_file(const char* value);
-  void set_file(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file(ArgT0&& arg0, ArgT... args);
   std::string* mutable_file();
-  std::string* release_file();
+  PROTOBUF_NODISCARD std::string* release_file();
   void set_allocated_file(std::string* file);
   private:
   const std::string& _internal_file() const;
-  void _internal_set_file(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file(const std::string& value);
   std::string* _internal_mutable_file();
   public:
 
   // int32 line = 3;
   void clear_line();
-  ::PROTOBUF_NAMESPACE_ID::int32 line() const;
-  void set_line(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t line() const;
+  void set_line(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_line() const;
-  void _internal_set_line(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_line() const;
+  void _internal_set_line(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.GameAssert)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr condition_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_;
-  ::PROTOBUF_NAMESPACE_ID::int32 line_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr condition_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_;
+    int32_t line_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameCrash :
+class GameCrash final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameCrash) */ {
  public:
-  GameCrash();
-  virtual ~GameCrash();
+  inline GameCrash() : GameCrash(nullptr) {}
+  ~GameCrash() override;
+  explicit PROTOBUF_CONSTEXPR GameCrash(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameCrash(const GameCrash& from);
   GameCrash(GameCrash&& from) noexcept
@@ -3787,8 +4739,13 @@ class GameCrash :
     return *this;
   }
   inline GameCrash& operator=(GameCrash&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3799,77 +4756,86 @@ class GameCrash :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameCrash& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameCrash& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameCrash* internal_default_instance() {
     return reinterpret_cast<const GameCrash*>(
                &_GameCrash_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    22;
+    24;
 
   friend void swap(GameCrash& a, GameCrash& b) {
     a.Swap(&b);
   }
   inline void Swap(GameCrash* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameCrash* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameCrash* New() const final {
-    return CreateMaybeMessage<GameCrash>(nullptr);
-  }
-
-  GameCrash* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameCrash* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameCrash>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameCrash& from);
-  void MergeFrom(const GameCrash& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameCrash& from) {
+    GameCrash::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameCrash* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameCrash";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameCrash(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3881,16 +4847,14 @@ class GameCrash :
   // string info = 1;
   void clear_info();
   const std::string& info() const;
-  void set_info(const std::string& value);
-  void set_info(std::string&& value);
-  void set_info(const char* value);
-  void set_info(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_info(ArgT0&& arg0, ArgT... args);
   std::string* mutable_info();
-  std::string* release_info();
+  PROTOBUF_NODISCARD std::string* release_info();
   void set_allocated_info(std::string* info);
   private:
   const std::string& _internal_info() const;
-  void _internal_set_info(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_info(const std::string& value);
   std::string* _internal_mutable_info();
   public:
 
@@ -3898,18 +4862,24 @@ class GameCrash :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr info_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr info_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameMeshData :
+class GameMeshData final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameMeshData) */ {
  public:
-  GameMeshData();
-  virtual ~GameMeshData();
+  inline GameMeshData() : GameMeshData(nullptr) {}
+  ~GameMeshData() override;
+  explicit PROTOBUF_CONSTEXPR GameMeshData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameMeshData(const GameMeshData& from);
   GameMeshData(GameMeshData&& from) noexcept
@@ -3922,8 +4892,13 @@ class GameMeshData :
     return *this;
   }
   inline GameMeshData& operator=(GameMeshData&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3934,77 +4909,86 @@ class GameMeshData :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameMeshData& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameMeshData& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameMeshData* internal_default_instance() {
     return reinterpret_cast<const GameMeshData*>(
                &_GameMeshData_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    23;
+    25;
 
   friend void swap(GameMeshData& a, GameMeshData& b) {
     a.Swap(&b);
   }
   inline void Swap(GameMeshData* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameMeshData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameMeshData* New() const final {
-    return CreateMaybeMessage<GameMeshData>(nullptr);
-  }
-
-  GameMeshData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameMeshData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameMeshData>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameMeshData& from);
-  void MergeFrom(const GameMeshData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameMeshData& from) {
+    GameMeshData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameMeshData* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameMeshData";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameMeshData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4019,32 +5003,28 @@ class GameMeshData :
   // string modelName = 2;
   void clear_modelname();
   const std::string& modelname() const;
-  void set_modelname(const std::string& value);
-  void set_modelname(std::string&& value);
-  void set_modelname(const char* value);
-  void set_modelname(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_modelname(ArgT0&& arg0, ArgT... args);
   std::string* mutable_modelname();
-  std::string* release_modelname();
+  PROTOBUF_NODISCARD std::string* release_modelname();
   void set_allocated_modelname(std::string* modelname);
   private:
   const std::string& _internal_modelname() const;
-  void _internal_set_modelname(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_modelname(const std::string& value);
   std::string* _internal_mutable_modelname();
   public:
 
   // bytes modelBytes = 3;
   void clear_modelbytes();
   const std::string& modelbytes() const;
-  void set_modelbytes(const std::string& value);
-  void set_modelbytes(std::string&& value);
-  void set_modelbytes(const char* value);
-  void set_modelbytes(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_modelbytes(ArgT0&& arg0, ArgT... args);
   std::string* mutable_modelbytes();
-  std::string* release_modelbytes();
+  PROTOBUF_NODISCARD std::string* release_modelbytes();
   void set_allocated_modelbytes(std::string* modelbytes);
   private:
   const std::string& _internal_modelbytes() const;
-  void _internal_set_modelbytes(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_modelbytes(const std::string& value);
   std::string* _internal_mutable_modelbytes();
   public:
 
@@ -4059,32 +5039,38 @@ class GameMeshData :
 
   // uint32 modelBytesUncompressed = 4;
   void clear_modelbytesuncompressed();
-  ::PROTOBUF_NAMESPACE_ID::uint32 modelbytesuncompressed() const;
-  void set_modelbytesuncompressed(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t modelbytesuncompressed() const;
+  void set_modelbytesuncompressed(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_modelbytesuncompressed() const;
-  void _internal_set_modelbytesuncompressed(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_modelbytesuncompressed() const;
+  void _internal_set_modelbytesuncompressed(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.GameMeshData)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr modelname_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr modelbytes_;
-  int compressiontype_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 modelbytesuncompressed_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr modelname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr modelbytes_;
+    int compressiontype_;
+    uint32_t modelbytesuncompressed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameEntityInfo_Ammo :
+class GameEntityInfo_Ammo final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameEntityInfo.Ammo) */ {
  public:
-  GameEntityInfo_Ammo();
-  virtual ~GameEntityInfo_Ammo();
+  inline GameEntityInfo_Ammo() : GameEntityInfo_Ammo(nullptr) {}
+  ~GameEntityInfo_Ammo() override;
+  explicit PROTOBUF_CONSTEXPR GameEntityInfo_Ammo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameEntityInfo_Ammo(const GameEntityInfo_Ammo& from);
   GameEntityInfo_Ammo(GameEntityInfo_Ammo&& from) noexcept
@@ -4097,8 +5083,13 @@ class GameEntityInfo_Ammo :
     return *this;
   }
   inline GameEntityInfo_Ammo& operator=(GameEntityInfo_Ammo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4109,77 +5100,86 @@ class GameEntityInfo_Ammo :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameEntityInfo_Ammo& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameEntityInfo_Ammo& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameEntityInfo_Ammo* internal_default_instance() {
     return reinterpret_cast<const GameEntityInfo_Ammo*>(
                &_GameEntityInfo_Ammo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    24;
+    26;
 
   friend void swap(GameEntityInfo_Ammo& a, GameEntityInfo_Ammo& b) {
     a.Swap(&b);
   }
   inline void Swap(GameEntityInfo_Ammo* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameEntityInfo_Ammo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameEntityInfo_Ammo* New() const final {
-    return CreateMaybeMessage<GameEntityInfo_Ammo>(nullptr);
-  }
-
-  GameEntityInfo_Ammo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameEntityInfo_Ammo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameEntityInfo_Ammo>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameEntityInfo_Ammo& from);
-  void MergeFrom(const GameEntityInfo_Ammo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameEntityInfo_Ammo& from) {
+    GameEntityInfo_Ammo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameEntityInfo_Ammo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameEntityInfo.Ammo";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameEntityInfo_Ammo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4191,39 +5191,45 @@ class GameEntityInfo_Ammo :
   };
   // uint32 ammoType = 1 [(.Analytics.enumkey) = "AMMO_TYPE"];
   void clear_ammotype();
-  ::PROTOBUF_NAMESPACE_ID::uint32 ammotype() const;
-  void set_ammotype(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t ammotype() const;
+  void set_ammotype(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_ammotype() const;
-  void _internal_set_ammotype(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_ammotype() const;
+  void _internal_set_ammotype(uint32_t value);
   public:
 
   // uint32 ammoCount = 2;
   void clear_ammocount();
-  ::PROTOBUF_NAMESPACE_ID::uint32 ammocount() const;
-  void set_ammocount(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t ammocount() const;
+  void set_ammocount(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_ammocount() const;
-  void _internal_set_ammocount(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_ammocount() const;
+  void _internal_set_ammocount(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.GameEntityInfo.Ammo)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 ammotype_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 ammocount_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t ammotype_;
+    uint32_t ammocount_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameEntityInfo :
+class GameEntityInfo final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameEntityInfo) */ {
  public:
-  GameEntityInfo();
-  virtual ~GameEntityInfo();
+  inline GameEntityInfo() : GameEntityInfo(nullptr) {}
+  ~GameEntityInfo() override;
+  explicit PROTOBUF_CONSTEXPR GameEntityInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameEntityInfo(const GameEntityInfo& from);
   GameEntityInfo(GameEntityInfo&& from) noexcept
@@ -4236,8 +5242,13 @@ class GameEntityInfo :
     return *this;
   }
   inline GameEntityInfo& operator=(GameEntityInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4248,77 +5259,86 @@ class GameEntityInfo :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameEntityInfo& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameEntityInfo& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameEntityInfo* internal_default_instance() {
     return reinterpret_cast<const GameEntityInfo*>(
                &_GameEntityInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    25;
+    27;
 
   friend void swap(GameEntityInfo& a, GameEntityInfo& b) {
     a.Swap(&b);
   }
   inline void Swap(GameEntityInfo* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameEntityInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameEntityInfo* New() const final {
-    return CreateMaybeMessage<GameEntityInfo>(nullptr);
-  }
-
-  GameEntityInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameEntityInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameEntityInfo>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameEntityInfo& from);
-  void MergeFrom(const GameEntityInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameEntityInfo& from) {
+    GameEntityInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameEntityInfo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameEntityInfo";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameEntityInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4346,6 +5366,7 @@ class GameEntityInfo :
     kCategoryFieldNumber = 8,
     kNavFlagsFieldNumber = 10,
     kPowerUpsFieldNumber = 9,
+    kEntityNameIdFieldNumber = 20,
     kDeletedFieldNumber = 1000,
   };
   // repeated .Analytics.GameEntityInfo.Ammo ammo = 19;
@@ -4366,19 +5387,17 @@ class GameEntityInfo :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::GameEntityInfo_Ammo >&
       ammo() const;
 
-  // string entityName = 1;
+  // string entityName = 1 [(.Analytics.intern) = "entityNameId"];
   void clear_entityname();
   const std::string& entityname() const;
-  void set_entityname(const std::string& value);
-  void set_entityname(std::string&& value);
-  void set_entityname(const char* value);
-  void set_entityname(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_entityname(ArgT0&& arg0, ArgT... args);
   std::string* mutable_entityname();
-  std::string* release_entityname();
+  PROTOBUF_NODISCARD std::string* release_entityname();
   void set_allocated_entityname(std::string* entityname);
   private:
   const std::string& _internal_entityname() const;
-  void _internal_set_entityname(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_entityname(const std::string& value);
   std::string* _internal_mutable_entityname();
   public:
 
@@ -4389,13 +5408,16 @@ class GameEntityInfo :
   public:
   void clear_eulerrotation();
   const ::Analytics::Vec3& eulerrotation() const;
-  ::Analytics::Vec3* release_eulerrotation();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_eulerrotation();
   ::Analytics::Vec3* mutable_eulerrotation();
   void set_allocated_eulerrotation(::Analytics::Vec3* eulerrotation);
   private:
   const ::Analytics::Vec3& _internal_eulerrotation() const;
   ::Analytics::Vec3* _internal_mutable_eulerrotation();
   public:
+  void unsafe_arena_set_allocated_eulerrotation(
+      ::Analytics::Vec3* eulerrotation);
+  ::Analytics::Vec3* unsafe_arena_release_eulerrotation();
 
   // .Analytics.Vec3 position = 12 [(.Analytics.hidden) = true];
   bool has_position() const;
@@ -4404,13 +5426,16 @@ class GameEntityInfo :
   public:
   void clear_position();
   const ::Analytics::Vec3& position() const;
-  ::Analytics::Vec3* release_position();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_position();
   ::Analytics::Vec3* mutable_position();
   void set_allocated_position(::Analytics::Vec3* position);
   private:
   const ::Analytics::Vec3& _internal_position() const;
   ::Analytics::Vec3* _internal_mutable_position();
   public:
+  void unsafe_arena_set_allocated_position(
+      ::Analytics::Vec3* position);
+  ::Analytics::Vec3* unsafe_arena_release_position();
 
   // .Analytics.Vec3 eyeOffset = 13 [(.Analytics.hidden) = true];
   bool has_eyeoffset() const;
@@ -4419,13 +5444,16 @@ class GameEntityInfo :
   public:
   void clear_eyeoffset();
   const ::Analytics::Vec3& eyeoffset() const;
-  ::Analytics::Vec3* release_eyeoffset();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_eyeoffset();
   ::Analytics::Vec3* mutable_eyeoffset();
   void set_allocated_eyeoffset(::Analytics::Vec3* eyeoffset);
   private:
   const ::Analytics::Vec3& _internal_eyeoffset() const;
   ::Analytics::Vec3* _internal_mutable_eyeoffset();
   public:
+  void unsafe_arena_set_allocated_eyeoffset(
+      ::Analytics::Vec3* eyeoffset);
+  ::Analytics::Vec3* unsafe_arena_release_eyeoffset();
 
   // .Analytics.Vec3 eyeDir = 14 [(.Analytics.hidden) = true];
   bool has_eyedir() const;
@@ -4434,13 +5462,16 @@ class GameEntityInfo :
   public:
   void clear_eyedir();
   const ::Analytics::Vec3& eyedir() const;
-  ::Analytics::Vec3* release_eyedir();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_eyedir();
   ::Analytics::Vec3* mutable_eyedir();
   void set_allocated_eyedir(::Analytics::Vec3* eyedir);
   private:
   const ::Analytics::Vec3& _internal_eyedir() const;
   ::Analytics::Vec3* _internal_mutable_eyedir();
   public:
+  void unsafe_arena_set_allocated_eyedir(
+      ::Analytics::Vec3* eyedir);
+  ::Analytics::Vec3* unsafe_arena_release_eyedir();
 
   // .Analytics.RangeI health = 15;
   bool has_health() const;
@@ -4449,13 +5480,16 @@ class GameEntityInfo :
   public:
   void clear_health();
   const ::Analytics::RangeI& health() const;
-  ::Analytics::RangeI* release_health();
+  PROTOBUF_NODISCARD ::Analytics::RangeI* release_health();
   ::Analytics::RangeI* mutable_health();
   void set_allocated_health(::Analytics::RangeI* health);
   private:
   const ::Analytics::RangeI& _internal_health() const;
   ::Analytics::RangeI* _internal_mutable_health();
   public:
+  void unsafe_arena_set_allocated_health(
+      ::Analytics::RangeI* health);
+  ::Analytics::RangeI* unsafe_arena_release_health();
 
   // .Analytics.RangeI armor = 16;
   bool has_armor() const;
@@ -4464,13 +5498,16 @@ class GameEntityInfo :
   public:
   void clear_armor();
   const ::Analytics::RangeI& armor() const;
-  ::Analytics::RangeI* release_armor();
+  PROTOBUF_NODISCARD ::Analytics::RangeI* release_armor();
   ::Analytics::RangeI* mutable_armor();
   void set_allocated_armor(::Analytics::RangeI* armor);
   private:
   const ::Analytics::RangeI& _internal_armor() const;
   ::Analytics::RangeI* _internal_mutable_armor();
   public:
+  void unsafe_arena_set_allocated_armor(
+      ::Analytics::RangeI* armor);
+  ::Analytics::RangeI* unsafe_arena_release_armor();
 
   // .Analytics.Vec3 boundsMin = 17;
   bool has_boundsmin() const;
@@ -4479,13 +5516,16 @@ class GameEntityInfo :
   public:
   void clear_boundsmin();
   const ::Analytics::Vec3& boundsmin() const;
-  ::Analytics::Vec3* release_boundsmin();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_boundsmin();
   ::Analytics::Vec3* mutable_boundsmin();
   void set_allocated_boundsmin(::Analytics::Vec3* boundsmin);
   private:
   const ::Analytics::Vec3& _internal_boundsmin() const;
   ::Analytics::Vec3* _internal_mutable_boundsmin();
   public:
+  void unsafe_arena_set_allocated_boundsmin(
+      ::Analytics::Vec3* boundsmin);
+  ::Analytics::Vec3* unsafe_arena_release_boundsmin();
 
   // .Analytics.Vec3 boundsMax = 18;
   bool has_boundsmax() const;
@@ -4494,93 +5534,105 @@ class GameEntityInfo :
   public:
   void clear_boundsmax();
   const ::Analytics::Vec3& boundsmax() const;
-  ::Analytics::Vec3* release_boundsmax();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_boundsmax();
   ::Analytics::Vec3* mutable_boundsmax();
   void set_allocated_boundsmax(::Analytics::Vec3* boundsmax);
   private:
   const ::Analytics::Vec3& _internal_boundsmax() const;
   ::Analytics::Vec3* _internal_mutable_boundsmax();
   public:
+  void unsafe_arena_set_allocated_boundsmax(
+      ::Analytics::Vec3* boundsmax);
+  ::Analytics::Vec3* unsafe_arena_release_boundsmax();
 
   // int32 entityIndex = 2;
   void clear_entityindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 entityindex() const;
-  void set_entityindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t entityindex() const;
+  void set_entityindex(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_entityindex() const;
-  void _internal_set_entityindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_entityindex() const;
+  void _internal_set_entityindex(int32_t value);
   public:
 
   // int32 entitySerial = 3;
   void clear_entityserial();
-  ::PROTOBUF_NAMESPACE_ID::int32 entityserial() const;
-  void set_entityserial(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t entityserial() const;
+  void set_entityserial(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_entityserial() const;
-  void _internal_set_entityserial(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_entityserial() const;
+  void _internal_set_entityserial(int32_t value);
   public:
 
   // int32 groupId = 4 [(.Analytics.enumkey) = "GROUP_ID"];
   void clear_groupid();
-  ::PROTOBUF_NAMESPACE_ID::int32 groupid() const;
-  void set_groupid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_groupid() const;
-  void _internal_set_groupid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
   public:
 
   // int32 classId = 5 [(.Analytics.enumkey) = "CLASS_ID"];
   void clear_classid();
-  ::PROTOBUF_NAMESPACE_ID::int32 classid() const;
-  void set_classid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t classid() const;
+  void set_classid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_classid() const;
-  void _internal_set_classid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_classid() const;
+  void _internal_set_classid(int32_t value);
   public:
 
   // int64 entityFlags = 7 [(.Analytics.enumkey) = "ENTITY_FLAGS", (.Analytics.enumflagsindexed) = true];
   void clear_entityflags();
-  ::PROTOBUF_NAMESPACE_ID::int64 entityflags() const;
-  void set_entityflags(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t entityflags() const;
+  void set_entityflags(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_entityflags() const;
-  void _internal_set_entityflags(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_entityflags() const;
+  void _internal_set_entityflags(int64_t value);
   public:
 
   // int32 team = 6 [(.Analytics.enumkey) = "TEAM_ID"];
   void clear_team();
-  ::PROTOBUF_NAMESPACE_ID::int32 team() const;
-  void set_team(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t team() const;
+  void set_team(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_team() const;
-  void _internal_set_team(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_team() const;
+  void _internal_set_team(int32_t value);
   public:
 
   // int32 category = 8 [(.Analytics.enumkey) = "CATEGORY_ID", (.Analytics.enumflagsindexed) = true];
   void clear_category();
-  ::PROTOBUF_NAMESPACE_ID::int32 category() const;
-  void set_category(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t category() const;
+  void set_category(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_category() const;
-  void _internal_set_category(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_category() const;
+  void _internal_set_category(int32_t value);
   public:
 
   // int64 navFlags = 10 [(.Analytics.enumkey) = "NAV_FLAGS"];
   void clear_navflags();
-  ::PROTOBUF_NAMESPACE_ID::int64 navflags() const;
-  void set_navflags(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t navflags() const;
+  void set_navflags(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_navflags() const;
-  void _internal_set_navflags(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_navflags() const;
+  void _internal_set_navflags(int64_t value);
   public:
 
   // int32 powerUps = 9 [(.Analytics.enumkey) = "POWERUP_ID", (.Analytics.enumflagsindexed) = true];
   void clear_powerups();
-  ::PROTOBUF_NAMESPACE_ID::int32 powerups() const;
-  void set_powerups(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t powerups() const;
+  void set_powerups(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_powerups() const;
-  void _internal_set_powerups(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_powerups() const;
+  void _internal_set_powerups(int32_t value);
+  public:
+
+  // uint32 entityNameId = 20 [(.Analytics.hidden) = true];
+  void clear_entitynameid();
+  uint32_t entitynameid() const;
+  void set_entitynameid(uint32_t value);
+  private:
+  uint32_t _internal_entitynameid() const;
+  void _internal_set_entitynameid(uint32_t value);
   public:
 
   // bool deleted = 1000 [(.Analytics.hidden) = true];
@@ -4596,37 +5648,44 @@ class GameEntityInfo :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::GameEntityInfo_Ammo > ammo_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entityname_;
-  ::Analytics::Vec3* eulerrotation_;
-  ::Analytics::Vec3* position_;
-  ::Analytics::Vec3* eyeoffset_;
-  ::Analytics::Vec3* eyedir_;
-  ::Analytics::RangeI* health_;
-  ::Analytics::RangeI* armor_;
-  ::Analytics::Vec3* boundsmin_;
-  ::Analytics::Vec3* boundsmax_;
-  ::PROTOBUF_NAMESPACE_ID::int32 entityindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 entityserial_;
-  ::PROTOBUF_NAMESPACE_ID::int32 groupid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 classid_;
-  ::PROTOBUF_NAMESPACE_ID::int64 entityflags_;
-  ::PROTOBUF_NAMESPACE_ID::int32 team_;
-  ::PROTOBUF_NAMESPACE_ID::int32 category_;
-  ::PROTOBUF_NAMESPACE_ID::int64 navflags_;
-  ::PROTOBUF_NAMESPACE_ID::int32 powerups_;
-  bool deleted_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::GameEntityInfo_Ammo > ammo_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entityname_;
+    ::Analytics::Vec3* eulerrotation_;
+    ::Analytics::Vec3* position_;
+    ::Analytics::Vec3* eyeoffset_;
+    ::Analytics::Vec3* eyedir_;
+    ::Analytics::RangeI* health_;
+    ::Analytics::RangeI* armor_;
+    ::Analytics::Vec3* boundsmin_;
+    ::Analytics::Vec3* boundsmax_;
+    int32_t entityindex_;
+    int32_t entityserial_;
+    int32_t groupid_;
+    int32_t classid_;
+    int64_t entityflags_;
+    int32_t team_;
+    int32_t category_;
+    int64_t navflags_;
+    int32_t powerups_;
+    uint32_t entitynameid_;
+    bool deleted_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameEntityPosition :
+class GameEntityPosition final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameEntityPosition) */ {
  public:
-  GameEntityPosition();
-  virtual ~GameEntityPosition();
+  inline GameEntityPosition() : GameEntityPosition(nullptr) {}
+  ~GameEntityPosition() override;
+  explicit PROTOBUF_CONSTEXPR GameEntityPosition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameEntityPosition(const GameEntityPosition& from);
   GameEntityPosition(GameEntityPosition&& from) noexcept
@@ -4639,8 +5698,13 @@ class GameEntityPosition :
     return *this;
   }
   inline GameEntityPosition& operator=(GameEntityPosition&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4651,127 +5715,384 @@ class GameEntityPosition :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameEntityPosition& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameEntityPosition& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameEntityPosition* internal_default_instance() {
     return reinterpret_cast<const GameEntityPosition*>(
                &_GameEntityPosition_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    26;
+    28;
 
   friend void swap(GameEntityPosition& a, GameEntityPosition& b) {
     a.Swap(&b);
   }
   inline void Swap(GameEntityPosition* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameEntityPosition* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameEntityPosition* New() const final {
-    return CreateMaybeMessage<GameEntityPosition>(nullptr);
-  }
-
-  GameEntityPosition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameEntityPosition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameEntityPosition>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameEntityPosition& from);
-  void MergeFrom(const GameEntityPosition& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameEntityPosition& from) {
+    GameEntityPosition::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameEntityPosition* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameEntityPosition";
   }
+  protected:
+  explicit GameEntityPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPositionFieldNumber = 1,
+    kVelocityFieldNumber = 4,
+    kTeamFieldNumber = 2,
+    kEntityIndexFieldNumber = 3,
+    kTimeStampFieldNumber = 5,
+  };
+  // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
+  bool has_position() const;
+  private:
+  bool _internal_has_position() const;
+  public:
+  void clear_position();
+  const ::Analytics::Vec3& position() const;
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_position();
+  ::Analytics::Vec3* mutable_position();
+  void set_allocated_position(::Analytics::Vec3* position);
+  private:
+  const ::Analytics::Vec3& _internal_position() const;
+  ::Analytics::Vec3* _internal_mutable_position();
+  public:
+  void unsafe_arena_set_allocated_position(
+      ::Analytics::Vec3* position);
+  ::Analytics::Vec3* unsafe_arena_release_position();
+
+  // .Analytics.Vec3 velocity = 4 [(.Analytics.hidden) = true];
+  bool has_velocity() const;
+  private:
+  bool _internal_has_velocity() const;
+  public:
+  void clear_velocity();
+  const ::Analytics::Vec3& velocity() const;
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_velocity();
+  ::Analytics::Vec3* mutable_velocity();
+  void set_allocated_velocity(::Analytics::Vec3* velocity);
   private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
+  const ::Analytics::Vec3& _internal_velocity() const;
+  ::Analytics::Vec3* _internal_mutable_velocity();
+  public:
+  void unsafe_arena_set_allocated_velocity(
+      ::Analytics::Vec3* velocity);
+  ::Analytics::Vec3* unsafe_arena_release_velocity();
+
+  // int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
+  void clear_team();
+  int32_t team() const;
+  void set_team(int32_t value);
+  private:
+  int32_t _internal_team() const;
+  void _internal_set_team(int32_t value);
+  public:
+
+  // int32 entityIndex = 3;
+  void clear_entityindex();
+  int32_t entityindex() const;
+  void set_entityindex(int32_t value);
+  private:
+  int32_t _internal_entityindex() const;
+  void _internal_set_entityindex(int32_t value);
+  public:
+
+  // int64 timeStamp = 5 [(.Analytics.hidden) = true];
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Analytics.GameEntityPosition)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::Analytics::Vec3* position_;
+    ::Analytics::Vec3* velocity_;
+    int32_t team_;
+    int32_t entityindex_;
+    int64_t timestamp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_analytics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GameEntityTrajectory final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameEntityTrajectory) */ {
+ public:
+  inline GameEntityTrajectory() : GameEntityTrajectory(nullptr) {}
+  ~GameEntityTrajectory() override;
+  explicit PROTOBUF_CONSTEXPR GameEntityTrajectory(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameEntityTrajectory(const GameEntityTrajectory& from);
+  GameEntityTrajectory(GameEntityTrajectory&& from) noexcept
+    : GameEntityTrajectory() {
+    *this = ::std::move(from);
+  }
+
+  inline GameEntityTrajectory& operator=(const GameEntityTrajectory& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameEntityTrajectory& operator=(GameEntityTrajectory&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameEntityTrajectory& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameEntityTrajectory* internal_default_instance() {
+    return reinterpret_cast<const GameEntityTrajectory*>(
+               &_GameEntityTrajectory_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(GameEntityTrajectory& a, GameEntityTrajectory& b) {
+    a.Swap(&b);
   }
+  inline void Swap(GameEntityTrajectory* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameEntityTrajectory* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameEntityTrajectory* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameEntityTrajectory>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameEntityTrajectory& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameEntityTrajectory& from) {
+    GameEntityTrajectory::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
   private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameEntityTrajectory* other);
 
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Analytics.GameEntityTrajectory";
+  }
+  protected:
+  explicit GameEntityTrajectory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPositionFieldNumber = 1,
+    kSamplesFieldNumber = 5,
+    kEntityIndexFieldNumber = 1,
     kTeamFieldNumber = 2,
+    kSampleCountFieldNumber = 3,
+    kPrecisionFieldNumber = 4,
   };
-  // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
-  bool has_position() const;
+  // bytes samples = 5;
+  void clear_samples();
+  const std::string& samples() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_samples(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_samples();
+  PROTOBUF_NODISCARD std::string* release_samples();
+  void set_allocated_samples(std::string* samples);
   private:
-  bool _internal_has_position() const;
+  const std::string& _internal_samples() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_samples(const std::string& value);
+  std::string* _internal_mutable_samples();
   public:
-  void clear_position();
-  const ::Analytics::Vec3& position() const;
-  ::Analytics::Vec3* release_position();
-  ::Analytics::Vec3* mutable_position();
-  void set_allocated_position(::Analytics::Vec3* position);
+
+  // int32 entityIndex = 1;
+  void clear_entityindex();
+  int32_t entityindex() const;
+  void set_entityindex(int32_t value);
   private:
-  const ::Analytics::Vec3& _internal_position() const;
-  ::Analytics::Vec3* _internal_mutable_position();
+  int32_t _internal_entityindex() const;
+  void _internal_set_entityindex(int32_t value);
   public:
 
-  // int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
+  // int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID"];
   void clear_team();
-  ::PROTOBUF_NAMESPACE_ID::int32 team() const;
-  void set_team(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t team() const;
+  void set_team(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_team() const;
-  void _internal_set_team(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_team() const;
+  void _internal_set_team(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:Analytics.GameEntityPosition)
+  // uint32 sampleCount = 3;
+  void clear_samplecount();
+  uint32_t samplecount() const;
+  void set_samplecount(uint32_t value);
+  private:
+  uint32_t _internal_samplecount() const;
+  void _internal_set_samplecount(uint32_t value);
+  public:
+
+  // float precision = 4;
+  void clear_precision();
+  float precision() const;
+  void set_precision(float value);
+  private:
+  float _internal_precision() const;
+  void _internal_set_precision(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Analytics.GameEntityTrajectory)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::Analytics::Vec3* position_;
-  ::PROTOBUF_NAMESPACE_ID::int32 team_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr samples_;
+    int32_t entityindex_;
+    int32_t team_;
+    uint32_t samplecount_;
+    float precision_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameNode :
+class GameNode final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameNode) */ {
  public:
-  GameNode();
-  virtual ~GameNode();
+  inline GameNode() : GameNode(nullptr) {}
+  ~GameNode() override;
+  explicit PROTOBUF_CONSTEXPR GameNode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameNode(const GameNode& from);
   GameNode(GameNode&& from) noexcept
@@ -4784,8 +6105,13 @@ class GameNode :
     return *this;
   }
   inline GameNode& operator=(GameNode&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4796,77 +6122,86 @@ class GameNode :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameNode& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameNode& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameNode* internal_default_instance() {
     return reinterpret_cast<const GameNode*>(
                &_GameNode_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    27;
+    30;
 
   friend void swap(GameNode& a, GameNode& b) {
     a.Swap(&b);
   }
   inline void Swap(GameNode* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameNode* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameNode* New() const final {
-    return CreateMaybeMessage<GameNode>(nullptr);
-  }
-
-  GameNode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameNode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameNode>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameNode& from);
-  void MergeFrom(const GameNode& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameNode& from) {
+    GameNode::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameNode* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameNode";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4880,55 +6215,50 @@ class GameNode :
     kTranslationFieldNumber = 3,
     kEntityIdFieldNumber = 10,
     kActiveStateFieldNumber = 12,
-    kShapeModeFieldNumber = 15,
     kNavFlagsActiveFieldNumber = 13,
     kNavFlagsOverrideFieldNumber = 14,
+    kShapeModeFieldNumber = 15,
+    kEntityNameIdFieldNumber = 16,
   };
   // string nodePath = 1 [(.Analytics.editable_key) = true];
   void clear_nodepath();
   const std::string& nodepath() const;
-  void set_nodepath(const std::string& value);
-  void set_nodepath(std::string&& value);
-  void set_nodepath(const char* value);
-  void set_nodepath(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nodepath(ArgT0&& arg0, ArgT... args);
   std::string* mutable_nodepath();
-  std::string* release_nodepath();
+  PROTOBUF_NODISCARD std::string* release_nodepath();
   void set_allocated_nodepath(std::string* nodepath);
   private:
   const std::string& _internal_nodepath() const;
-  void _internal_set_nodepath(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nodepath(const std::string& value);
   std::string* _internal_mutable_nodepath();
   public:
 
   // string meshName = 4;
   void clear_meshname();
   const std::string& meshname() const;
-  void set_meshname(const std::string& value);
-  void set_meshname(std::string&& value);
-  void set_meshname(const char* value);
-  void set_meshname(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_meshname(ArgT0&& arg0, ArgT... args);
   std::string* mutable_meshname();
-  std::string* release_meshname();
+  PROTOBUF_NODISCARD std::string* release_meshname();
   void set_allocated_meshname(std::string* meshname);
   private:
   const std::string& _internal_meshname() const;
-  void _internal_set_meshname(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_meshname(const std::string& value);
   std::string* _internal_mutable_meshname();
   public:
 
-  // string entityName = 11;
+  // string entityName = 11 [(.Analytics.intern) = "entityNameId"];
   void clear_entityname();
   const std::string& entityname() const;
-  void set_entityname(const std::string& value);
-  void set_entityname(std::string&& value);
-  void set_entityname(const char* value);
-  void set_entityname(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_entityname(ArgT0&& arg0, ArgT... args);
   std::string* mutable_entityname();
-  std::string* release_entityname();
+  PROTOBUF_NODISCARD std::string* release_entityname();
   void set_allocated_entityname(std::string* entityname);
   private:
   const std::string& _internal_entityname() const;
-  void _internal_set_entityname(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_entityname(const std::string& value);
   std::string* _internal_mutable_entityname();
   public:
 
@@ -4939,13 +6269,16 @@ class GameNode :
   public:
   void clear_eulerrotation();
   const ::Analytics::Vec3& eulerrotation() const;
-  ::Analytics::Vec3* release_eulerrotation();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_eulerrotation();
   ::Analytics::Vec3* mutable_eulerrotation();
   void set_allocated_eulerrotation(::Analytics::Vec3* eulerrotation);
   private:
   const ::Analytics::Vec3& _internal_eulerrotation() const;
   ::Analytics::Vec3* _internal_mutable_eulerrotation();
   public:
+  void unsafe_arena_set_allocated_eulerrotation(
+      ::Analytics::Vec3* eulerrotation);
+  ::Analytics::Vec3* unsafe_arena_release_eulerrotation();
 
   // .Analytics.Vec3 translation = 3;
   bool has_translation() const;
@@ -4954,84 +6287,103 @@ class GameNode :
   public:
   void clear_translation();
   const ::Analytics::Vec3& translation() const;
-  ::Analytics::Vec3* release_translation();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_translation();
   ::Analytics::Vec3* mutable_translation();
   void set_allocated_translation(::Analytics::Vec3* translation);
   private:
   const ::Analytics::Vec3& _internal_translation() const;
   ::Analytics::Vec3* _internal_mutable_translation();
   public:
+  void unsafe_arena_set_allocated_translation(
+      ::Analytics::Vec3* translation);
+  ::Analytics::Vec3* unsafe_arena_release_translation();
 
   // int32 entityId = 10;
   void clear_entityid();
-  ::PROTOBUF_NAMESPACE_ID::int32 entityid() const;
-  void set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t entityid() const;
+  void set_entityid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_entityid() const;
-  void _internal_set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_entityid() const;
+  void _internal_set_entityid(int32_t value);
   public:
 
   // int32 activeState = 12 [(.Analytics.enumkey) = "MODEL_STATE"];
   void clear_activestate();
-  ::PROTOBUF_NAMESPACE_ID::int32 activestate() const;
-  void set_activestate(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_activestate() const;
-  void _internal_set_activestate(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 shapeMode = 15 [(.Analytics.enumkey) = "SHAPEMODE", (.Analytics.editable) = true];
-  void clear_shapemode();
-  ::PROTOBUF_NAMESPACE_ID::int32 shapemode() const;
-  void set_shapemode(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t activestate() const;
+  void set_activestate(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_shapemode() const;
-  void _internal_set_shapemode(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_activestate() const;
+  void _internal_set_activestate(int32_t value);
   public:
 
   // int64 navFlagsActive = 13 [(.Analytics.enumkey) = "NAV_FLAGS"];
   void clear_navflagsactive();
-  ::PROTOBUF_NAMESPACE_ID::int64 navflagsactive() const;
-  void set_navflagsactive(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t navflagsactive() const;
+  void set_navflagsactive(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_navflagsactive() const;
-  void _internal_set_navflagsactive(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_navflagsactive() const;
+  void _internal_set_navflagsactive(int64_t value);
   public:
 
   // int64 navFlagsOverride = 14 [(.Analytics.enumkey) = "NAV_FLAGS", (.Analytics.editable) = true];
   void clear_navflagsoverride();
-  ::PROTOBUF_NAMESPACE_ID::int64 navflagsoverride() const;
-  void set_navflagsoverride(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t navflagsoverride() const;
+  void set_navflagsoverride(int64_t value);
+  private:
+  int64_t _internal_navflagsoverride() const;
+  void _internal_set_navflagsoverride(int64_t value);
+  public:
+
+  // int32 shapeMode = 15 [(.Analytics.enumkey) = "SHAPEMODE", (.Analytics.editable) = true];
+  void clear_shapemode();
+  int32_t shapemode() const;
+  void set_shapemode(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_navflagsoverride() const;
-  void _internal_set_navflagsoverride(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int32_t _internal_shapemode() const;
+  void _internal_set_shapemode(int32_t value);
+  public:
+
+  // uint32 entityNameId = 16 [(.Analytics.hidden) = true];
+  void clear_entitynameid();
+  uint32_t entitynameid() const;
+  void set_entitynameid(uint32_t value);
+  private:
+  uint32_t _internal_entitynameid() const;
+  void _internal_set_entitynameid(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.GameNode)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nodepath_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr meshname_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entityname_;
-  ::Analytics::Vec3* eulerrotation_;
-  ::Analytics::Vec3* translation_;
-  ::PROTOBUF_NAMESPACE_ID::int32 entityid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 activestate_;
-  ::PROTOBUF_NAMESPACE_ID::int32 shapemode_;
-  ::PROTOBUF_NAMESPACE_ID::int64 navflagsactive_;
-  ::PROTOBUF_NAMESPACE_ID::int64 navflagsoverride_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nodepath_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr meshname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr entityname_;
+    ::Analytics::Vec3* eulerrotation_;
+    ::Analytics::Vec3* translation_;
+    int32_t entityid_;
+    int32_t activestate_;
+    int64_t navflagsactive_;
+    int64_t navflagsoverride_;
+    int32_t shapemode_;
+    uint32_t entitynameid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameWeaponFired :
+class GameWeaponFired final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameWeaponFired) */ {
  public:
-  GameWeaponFired();
-  virtual ~GameWeaponFired();
+  inline GameWeaponFired() : GameWeaponFired(nullptr) {}
+  ~GameWeaponFired() override;
+  explicit PROTOBUF_CONSTEXPR GameWeaponFired(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameWeaponFired(const GameWeaponFired& from);
   GameWeaponFired(GameWeaponFired&& from) noexcept
@@ -5044,8 +6396,13 @@ class GameWeaponFired :
     return *this;
   }
   inline GameWeaponFired& operator=(GameWeaponFired&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5056,77 +6413,86 @@ class GameWeaponFired :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameWeaponFired& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameWeaponFired& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameWeaponFired* internal_default_instance() {
     return reinterpret_cast<const GameWeaponFired*>(
                &_GameWeaponFired_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    28;
+    31;
 
   friend void swap(GameWeaponFired& a, GameWeaponFired& b) {
     a.Swap(&b);
   }
   inline void Swap(GameWeaponFired* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameWeaponFired* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameWeaponFired* New() const final {
-    return CreateMaybeMessage<GameWeaponFired>(nullptr);
-  }
-
-  GameWeaponFired* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameWeaponFired* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameWeaponFired>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameWeaponFired& from);
-  void MergeFrom(const GameWeaponFired& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameWeaponFired& from) {
+    GameWeaponFired::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameWeaponFired* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameWeaponFired";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameWeaponFired(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5134,6 +6500,7 @@ class GameWeaponFired :
 
   enum : int {
     kPositionFieldNumber = 1,
+    kTraceFieldNumber = 5,
     kAttackTeamFieldNumber = 2,
     kWeaponIdFieldNumber = 3,
     kFiredByClassFieldNumber = 4,
@@ -5145,60 +6512,88 @@ class GameWeaponFired :
   public:
   void clear_position();
   const ::Analytics::Vec3& position() const;
-  ::Analytics::Vec3* release_position();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_position();
   ::Analytics::Vec3* mutable_position();
   void set_allocated_position(::Analytics::Vec3* position);
   private:
   const ::Analytics::Vec3& _internal_position() const;
   ::Analytics::Vec3* _internal_mutable_position();
   public:
+  void unsafe_arena_set_allocated_position(
+      ::Analytics::Vec3* position);
+  ::Analytics::Vec3* unsafe_arena_release_position();
+
+  // .Analytics.Line trace = 5 [(.Analytics.line_event) = {
+  bool has_trace() const;
+  private:
+  bool _internal_has_trace() const;
+  public:
+  void clear_trace();
+  const ::Analytics::Line& trace() const;
+  PROTOBUF_NODISCARD ::Analytics::Line* release_trace();
+  ::Analytics::Line* mutable_trace();
+  void set_allocated_trace(::Analytics::Line* trace);
+  private:
+  const ::Analytics::Line& _internal_trace() const;
+  ::Analytics::Line* _internal_mutable_trace();
+  public:
+  void unsafe_arena_set_allocated_trace(
+      ::Analytics::Line* trace);
+  ::Analytics::Line* unsafe_arena_release_trace();
 
   // int32 attackTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
   void clear_attackteam();
-  ::PROTOBUF_NAMESPACE_ID::int32 attackteam() const;
-  void set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t attackteam() const;
+  void set_attackteam(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_attackteam() const;
-  void _internal_set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_attackteam() const;
+  void _internal_set_attackteam(int32_t value);
   public:
 
   // int32 weaponId = 3 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
   void clear_weaponid();
-  ::PROTOBUF_NAMESPACE_ID::int32 weaponid() const;
-  void set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t weaponid() const;
+  void set_weaponid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_weaponid() const;
-  void _internal_set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_weaponid() const;
+  void _internal_set_weaponid(int32_t value);
   public:
 
   // int32 firedByClass = 4 [(.Analytics.enumkey) = "CLASS_ID", (.Analytics.track_event) = true];
   void clear_firedbyclass();
-  ::PROTOBUF_NAMESPACE_ID::int32 firedbyclass() const;
-  void set_firedbyclass(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t firedbyclass() const;
+  void set_firedbyclass(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_firedbyclass() const;
-  void _internal_set_firedbyclass(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_firedbyclass() const;
+  void _internal_set_firedbyclass(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.GameWeaponFired)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::Analytics::Vec3* position_;
-  ::PROTOBUF_NAMESPACE_ID::int32 attackteam_;
-  ::PROTOBUF_NAMESPACE_ID::int32 weaponid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 firedbyclass_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::Analytics::Vec3* position_;
+    ::Analytics::Line* trace_;
+    int32_t attackteam_;
+    int32_t weaponid_;
+    int32_t firedbyclass_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameDeath :
+class GameDeath final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameDeath) */ {
  public:
-  GameDeath();
-  virtual ~GameDeath();
+  inline GameDeath() : GameDeath(nullptr) {}
+  ~GameDeath() override;
+  explicit PROTOBUF_CONSTEXPR GameDeath(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameDeath(const GameDeath& from);
   GameDeath(GameDeath&& from) noexcept
@@ -5211,8 +6606,13 @@ class GameDeath :
     return *this;
   }
   inline GameDeath& operator=(GameDeath&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5223,77 +6623,86 @@ class GameDeath :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameDeath& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameDeath& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameDeath* internal_default_instance() {
     return reinterpret_cast<const GameDeath*>(
                &_GameDeath_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    29;
+    32;
 
   friend void swap(GameDeath& a, GameDeath& b) {
     a.Swap(&b);
   }
   inline void Swap(GameDeath* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameDeath* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameDeath* New() const final {
-    return CreateMaybeMessage<GameDeath>(nullptr);
-  }
-
-  GameDeath* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameDeath* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameDeath>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameDeath& from);
-  void MergeFrom(const GameDeath& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameDeath& from) {
+    GameDeath::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameDeath* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameDeath";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameDeath(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5304,20 +6713,19 @@ class GameDeath :
     kPositionFieldNumber = 1,
     kVictimTeamFieldNumber = 2,
     kAttackTeamFieldNumber = 3,
+    kMeansOfDeathIdFieldNumber = 5,
   };
-  // string meansOfDeath = 4 [(.Analytics.track_event) = true];
+  // string meansOfDeath = 4 [(.Analytics.track_event) = true, (.Analytics.intern) = "meansOfDeathId"];
   void clear_meansofdeath();
   const std::string& meansofdeath() const;
-  void set_meansofdeath(const std::string& value);
-  void set_meansofdeath(std::string&& value);
-  void set_meansofdeath(const char* value);
-  void set_meansofdeath(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_meansofdeath(ArgT0&& arg0, ArgT... args);
   std::string* mutable_meansofdeath();
-  std::string* release_meansofdeath();
+  PROTOBUF_NODISCARD std::string* release_meansofdeath();
   void set_allocated_meansofdeath(std::string* meansofdeath);
   private:
   const std::string& _internal_meansofdeath() const;
-  void _internal_set_meansofdeath(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_meansofdeath(const std::string& value);
   std::string* _internal_mutable_meansofdeath();
   public:
 
@@ -5328,51 +6736,70 @@ class GameDeath :
   public:
   void clear_position();
   const ::Analytics::Vec3& position() const;
-  ::Analytics::Vec3* release_position();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_position();
   ::Analytics::Vec3* mutable_position();
   void set_allocated_position(::Analytics::Vec3* position);
   private:
   const ::Analytics::Vec3& _internal_position() const;
   ::Analytics::Vec3* _internal_mutable_position();
   public:
+  void unsafe_arena_set_allocated_position(
+      ::Analytics::Vec3* position);
+  ::Analytics::Vec3* unsafe_arena_release_position();
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
   void clear_victimteam();
-  ::PROTOBUF_NAMESPACE_ID::int32 victimteam() const;
-  void set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t victimteam() const;
+  void set_victimteam(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_victimteam() const;
-  void _internal_set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_victimteam() const;
+  void _internal_set_victimteam(int32_t value);
   public:
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
   void clear_attackteam();
-  ::PROTOBUF_NAMESPACE_ID::int32 attackteam() const;
-  void set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t attackteam() const;
+  void set_attackteam(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_attackteam() const;
-  void _internal_set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_attackteam() const;
+  void _internal_set_attackteam(int32_t value);
+  public:
+
+  // uint32 meansOfDeathId = 5 [(.Analytics.hidden) = true];
+  void clear_meansofdeathid();
+  uint32_t meansofdeathid() const;
+  void set_meansofdeathid(uint32_t value);
+  private:
+  uint32_t _internal_meansofdeathid() const;
+  void _internal_set_meansofdeathid(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.GameDeath)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr meansofdeath_;
-  ::Analytics::Vec3* position_;
-  ::PROTOBUF_NAMESPACE_ID::int32 victimteam_;
-  ::PROTOBUF_NAMESPACE_ID::int32 attackteam_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr meansofdeath_;
+    ::Analytics::Vec3* position_;
+    int32_t victimteam_;
+    int32_t attackteam_;
+    uint32_t meansofdeathid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameKilledSomeone :
+class GameKilledSomeone final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameKilledSomeone) */ {
  public:
-  GameKilledSomeone();
-  virtual ~GameKilledSomeone();
+  inline GameKilledSomeone() : GameKilledSomeone(nullptr) {}
+  ~GameKilledSomeone() override;
+  explicit PROTOBUF_CONSTEXPR GameKilledSomeone(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameKilledSomeone(const GameKilledSomeone& from);
   GameKilledSomeone(GameKilledSomeone&& from) noexcept
@@ -5385,8 +6812,13 @@ class GameKilledSomeone :
     return *this;
   }
   inline GameKilledSomeone& operator=(GameKilledSomeone&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5397,77 +6829,86 @@ class GameKilledSomeone :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameKilledSomeone& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameKilledSomeone& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameKilledSomeone* internal_default_instance() {
     return reinterpret_cast<const GameKilledSomeone*>(
                &_GameKilledSomeone_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    30;
+    33;
 
   friend void swap(GameKilledSomeone& a, GameKilledSomeone& b) {
     a.Swap(&b);
   }
   inline void Swap(GameKilledSomeone* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameKilledSomeone* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameKilledSomeone* New() const final {
-    return CreateMaybeMessage<GameKilledSomeone>(nullptr);
-  }
-
-  GameKilledSomeone* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameKilledSomeone* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameKilledSomeone>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameKilledSomeone& from);
-  void MergeFrom(const GameKilledSomeone& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameKilledSomeone& from) {
+    GameKilledSomeone::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameKilledSomeone* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameKilledSomeone";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameKilledSomeone(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5478,20 +6919,19 @@ class GameKilledSomeone :
     kPositionFieldNumber = 1,
     kVictimTeamFieldNumber = 2,
     kAttackTeamFieldNumber = 3,
+    kMeansOfDeathIdFieldNumber = 5,
   };
-  // string meansOfDeath = 4 [(.Analytics.track_event) = true];
+  // string meansOfDeath = 4 [(.Analytics.track_event) = true, (.Analytics.intern) = "meansOfDeathId"];
   void clear_meansofdeath();
   const std::string& meansofdeath() const;
-  void set_meansofdeath(const std::string& value);
-  void set_meansofdeath(std::string&& value);
-  void set_meansofdeath(const char* value);
-  void set_meansofdeath(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_meansofdeath(ArgT0&& arg0, ArgT... args);
   std::string* mutable_meansofdeath();
-  std::string* release_meansofdeath();
+  PROTOBUF_NODISCARD std::string* release_meansofdeath();
   void set_allocated_meansofdeath(std::string* meansofdeath);
   private:
   const std::string& _internal_meansofdeath() const;
-  void _internal_set_meansofdeath(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_meansofdeath(const std::string& value);
   std::string* _internal_mutable_meansofdeath();
   public:
 
@@ -5502,51 +6942,70 @@ class GameKilledSomeone :
   public:
   void clear_position();
   const ::Analytics::Vec3& position() const;
-  ::Analytics::Vec3* release_position();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_position();
   ::Analytics::Vec3* mutable_position();
   void set_allocated_position(::Analytics::Vec3* position);
   private:
   const ::Analytics::Vec3& _internal_position() const;
   ::Analytics::Vec3* _internal_mutable_position();
   public:
+  void unsafe_arena_set_allocated_position(
+      ::Analytics::Vec3* position);
+  ::Analytics::Vec3* unsafe_arena_release_position();
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
   void clear_victimteam();
-  ::PROTOBUF_NAMESPACE_ID::int32 victimteam() const;
-  void set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t victimteam() const;
+  void set_victimteam(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_victimteam() const;
-  void _internal_set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_victimteam() const;
+  void _internal_set_victimteam(int32_t value);
   public:
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
   void clear_attackteam();
-  ::PROTOBUF_NAMESPACE_ID::int32 attackteam() const;
-  void set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t attackteam() const;
+  void set_attackteam(int32_t value);
+  private:
+  int32_t _internal_attackteam() const;
+  void _internal_set_attackteam(int32_t value);
+  public:
+
+  // uint32 meansOfDeathId = 5 [(.Analytics.hidden) = true];
+  void clear_meansofdeathid();
+  uint32_t meansofdeathid() const;
+  void set_meansofdeathid(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_attackteam() const;
-  void _internal_set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  uint32_t _internal_meansofdeathid() const;
+  void _internal_set_meansofdeathid(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.GameKilledSomeone)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr meansofdeath_;
-  ::Analytics::Vec3* position_;
-  ::PROTOBUF_NAMESPACE_ID::int32 victimteam_;
-  ::PROTOBUF_NAMESPACE_ID::int32 attackteam_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr meansofdeath_;
+    ::Analytics::Vec3* position_;
+    int32_t victimteam_;
+    int32_t attackteam_;
+    uint32_t meansofdeathid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameRecieveDamage :
+class GameRecieveDamage final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameRecieveDamage) */ {
  public:
-  GameRecieveDamage();
-  virtual ~GameRecieveDamage();
+  inline GameRecieveDamage() : GameRecieveDamage(nullptr) {}
+  ~GameRecieveDamage() override;
+  explicit PROTOBUF_CONSTEXPR GameRecieveDamage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameRecieveDamage(const GameRecieveDamage& from);
   GameRecieveDamage(GameRecieveDamage&& from) noexcept
@@ -5559,8 +7018,13 @@ class GameRecieveDamage :
     return *this;
   }
   inline GameRecieveDamage& operator=(GameRecieveDamage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5571,77 +7035,86 @@ class GameRecieveDamage :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameRecieveDamage& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameRecieveDamage& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameRecieveDamage* internal_default_instance() {
     return reinterpret_cast<const GameRecieveDamage*>(
                &_GameRecieveDamage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    31;
+    34;
 
   friend void swap(GameRecieveDamage& a, GameRecieveDamage& b) {
     a.Swap(&b);
   }
   inline void Swap(GameRecieveDamage* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameRecieveDamage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameRecieveDamage* New() const final {
-    return CreateMaybeMessage<GameRecieveDamage>(nullptr);
-  }
-
-  GameRecieveDamage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameRecieveDamage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameRecieveDamage>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameRecieveDamage& from);
-  void MergeFrom(const GameRecieveDamage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameRecieveDamage& from) {
+    GameRecieveDamage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameRecieveDamage* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameRecieveDamage";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameRecieveDamage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5654,20 +7127,19 @@ class GameRecieveDamage :
     kAttackTeamFieldNumber = 3,
     kWeaponIdFieldNumber = 4,
     kDamageAmountFieldNumber = 6,
+    kDamageTypeIdFieldNumber = 7,
   };
-  // string damageType = 5 [(.Analytics.track_event) = true];
+  // string damageType = 5 [(.Analytics.track_event) = true, (.Analytics.intern) = "damageTypeId"];
   void clear_damagetype();
   const std::string& damagetype() const;
-  void set_damagetype(const std::string& value);
-  void set_damagetype(std::string&& value);
-  void set_damagetype(const char* value);
-  void set_damagetype(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_damagetype(ArgT0&& arg0, ArgT... args);
   std::string* mutable_damagetype();
-  std::string* release_damagetype();
+  PROTOBUF_NODISCARD std::string* release_damagetype();
   void set_allocated_damagetype(std::string* damagetype);
   private:
   const std::string& _internal_damagetype() const;
-  void _internal_set_damagetype(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_damagetype(const std::string& value);
   std::string* _internal_mutable_damagetype();
   public:
 
@@ -5678,39 +7150,42 @@ class GameRecieveDamage :
   public:
   void clear_position();
   const ::Analytics::Vec3& position() const;
-  ::Analytics::Vec3* release_position();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_position();
   ::Analytics::Vec3* mutable_position();
   void set_allocated_position(::Analytics::Vec3* position);
   private:
   const ::Analytics::Vec3& _internal_position() const;
   ::Analytics::Vec3* _internal_mutable_position();
   public:
+  void unsafe_arena_set_allocated_position(
+      ::Analytics::Vec3* position);
+  ::Analytics::Vec3* unsafe_arena_release_position();
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
   void clear_victimteam();
-  ::PROTOBUF_NAMESPACE_ID::int32 victimteam() const;
-  void set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t victimteam() const;
+  void set_victimteam(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_victimteam() const;
-  void _internal_set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_victimteam() const;
+  void _internal_set_victimteam(int32_t value);
   public:
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
   void clear_attackteam();
-  ::PROTOBUF_NAMESPACE_ID::int32 attackteam() const;
-  void set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t attackteam() const;
+  void set_attackteam(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_attackteam() const;
-  void _internal_set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_attackteam() const;
+  void _internal_set_attackteam(int32_t value);
   public:
 
   // int32 weaponId = 4 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
   void clear_weaponid();
-  ::PROTOBUF_NAMESPACE_ID::int32 weaponid() const;
-  void set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t weaponid() const;
+  void set_weaponid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_weaponid() const;
-  void _internal_set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_weaponid() const;
+  void _internal_set_weaponid(int32_t value);
   public:
 
   // float damageAmount = 6;
@@ -5722,27 +7197,43 @@ class GameRecieveDamage :
   void _internal_set_damageamount(float value);
   public:
 
+  // uint32 damageTypeId = 7 [(.Analytics.hidden) = true];
+  void clear_damagetypeid();
+  uint32_t damagetypeid() const;
+  void set_damagetypeid(uint32_t value);
+  private:
+  uint32_t _internal_damagetypeid() const;
+  void _internal_set_damagetypeid(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:Analytics.GameRecieveDamage)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr damagetype_;
-  ::Analytics::Vec3* position_;
-  ::PROTOBUF_NAMESPACE_ID::int32 victimteam_;
-  ::PROTOBUF_NAMESPACE_ID::int32 attackteam_;
-  ::PROTOBUF_NAMESPACE_ID::int32 weaponid_;
-  float damageamount_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr damagetype_;
+    ::Analytics::Vec3* position_;
+    int32_t victimteam_;
+    int32_t attackteam_;
+    int32_t weaponid_;
+    float damageamount_;
+    uint32_t damagetypeid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameInflictDamage :
+class GameInflictDamage final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameInflictDamage) */ {
  public:
-  GameInflictDamage();
-  virtual ~GameInflictDamage();
+  inline GameInflictDamage() : GameInflictDamage(nullptr) {}
+  ~GameInflictDamage() override;
+  explicit PROTOBUF_CONSTEXPR GameInflictDamage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameInflictDamage(const GameInflictDamage& from);
   GameInflictDamage(GameInflictDamage&& from) noexcept
@@ -5755,8 +7246,13 @@ class GameInflictDamage :
     return *this;
   }
   inline GameInflictDamage& operator=(GameInflictDamage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5767,77 +7263,86 @@ class GameInflictDamage :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameInflictDamage& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameInflictDamage& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameInflictDamage* internal_default_instance() {
     return reinterpret_cast<const GameInflictDamage*>(
                &_GameInflictDamage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    32;
+    35;
 
   friend void swap(GameInflictDamage& a, GameInflictDamage& b) {
     a.Swap(&b);
   }
   inline void Swap(GameInflictDamage* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameInflictDamage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameInflictDamage* New() const final {
-    return CreateMaybeMessage<GameInflictDamage>(nullptr);
-  }
-
-  GameInflictDamage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameInflictDamage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameInflictDamage>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameInflictDamage& from);
-  void MergeFrom(const GameInflictDamage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameInflictDamage& from) {
+    GameInflictDamage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameInflictDamage* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameInflictDamage";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameInflictDamage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -5850,20 +7355,19 @@ class GameInflictDamage :
     kAttackTeamFieldNumber = 3,
     kWeaponIdFieldNumber = 4,
     kDamageAmountFieldNumber = 6,
+    kDamageTypeIdFieldNumber = 7,
   };
-  // string damageType = 5 [(.Analytics.track_event) = true];
+  // string damageType = 5 [(.Analytics.track_event) = true, (.Analytics.intern) = "damageTypeId"];
   void clear_damagetype();
   const std::string& damagetype() const;
-  void set_damagetype(const std::string& value);
-  void set_damagetype(std::string&& value);
-  void set_damagetype(const char* value);
-  void set_damagetype(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_damagetype(ArgT0&& arg0, ArgT... args);
   std::string* mutable_damagetype();
-  std::string* release_damagetype();
+  PROTOBUF_NODISCARD std::string* release_damagetype();
   void set_allocated_damagetype(std::string* damagetype);
   private:
   const std::string& _internal_damagetype() const;
-  void _internal_set_damagetype(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_damagetype(const std::string& value);
   std::string* _internal_mutable_damagetype();
   public:
 
@@ -5874,39 +7378,42 @@ class GameInflictDamage :
   public:
   void clear_position();
   const ::Analytics::Vec3& position() const;
-  ::Analytics::Vec3* release_position();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_position();
   ::Analytics::Vec3* mutable_position();
   void set_allocated_position(::Analytics::Vec3* position);
   private:
   const ::Analytics::Vec3& _internal_position() const;
   ::Analytics::Vec3* _internal_mutable_position();
   public:
+  void unsafe_arena_set_allocated_position(
+      ::Analytics::Vec3* position);
+  ::Analytics::Vec3* unsafe_arena_release_position();
 
   // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
   void clear_victimteam();
-  ::PROTOBUF_NAMESPACE_ID::int32 victimteam() const;
-  void set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t victimteam() const;
+  void set_victimteam(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_victimteam() const;
-  void _internal_set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_victimteam() const;
+  void _internal_set_victimteam(int32_t value);
   public:
 
   // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
   void clear_attackteam();
-  ::PROTOBUF_NAMESPACE_ID::int32 attackteam() const;
-  void set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t attackteam() const;
+  void set_attackteam(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_attackteam() const;
-  void _internal_set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_attackteam() const;
+  void _internal_set_attackteam(int32_t value);
   public:
 
   // int32 weaponId = 4 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
   void clear_weaponid();
-  ::PROTOBUF_NAMESPACE_ID::int32 weaponid() const;
-  void set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t weaponid() const;
+  void set_weaponid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_weaponid() const;
-  void _internal_set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_weaponid() const;
+  void _internal_set_weaponid(int32_t value);
   public:
 
   // float damageAmount = 6;
@@ -5918,27 +7425,43 @@ class GameInflictDamage :
   void _internal_set_damageamount(float value);
   public:
 
+  // uint32 damageTypeId = 7 [(.Analytics.hidden) = true];
+  void clear_damagetypeid();
+  uint32_t damagetypeid() const;
+  void set_damagetypeid(uint32_t value);
+  private:
+  uint32_t _internal_damagetypeid() const;
+  void _internal_set_damagetypeid(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:Analytics.GameInflictDamage)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr damagetype_;
-  ::Analytics::Vec3* position_;
-  ::PROTOBUF_NAMESPACE_ID::int32 victimteam_;
-  ::PROTOBUF_NAMESPACE_ID::int32 attackteam_;
-  ::PROTOBUF_NAMESPACE_ID::int32 weaponid_;
-  float damageamount_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr damagetype_;
+    ::Analytics::Vec3* position_;
+    int32_t victimteam_;
+    int32_t attackteam_;
+    int32_t weaponid_;
+    float damageamount_;
+    uint32_t damagetypeid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameRadiusDamage :
+class GameRadiusDamage final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameRadiusDamage) */ {
  public:
-  GameRadiusDamage();
-  virtual ~GameRadiusDamage();
+  inline GameRadiusDamage() : GameRadiusDamage(nullptr) {}
+  ~GameRadiusDamage() override;
+  explicit PROTOBUF_CONSTEXPR GameRadiusDamage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameRadiusDamage(const GameRadiusDamage& from);
   GameRadiusDamage(GameRadiusDamage&& from) noexcept
@@ -5951,8 +7474,13 @@ class GameRadiusDamage :
     return *this;
   }
   inline GameRadiusDamage& operator=(GameRadiusDamage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -5963,77 +7491,86 @@ class GameRadiusDamage :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameRadiusDamage& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameRadiusDamage& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameRadiusDamage* internal_default_instance() {
     return reinterpret_cast<const GameRadiusDamage*>(
                &_GameRadiusDamage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    33;
+    36;
 
   friend void swap(GameRadiusDamage& a, GameRadiusDamage& b) {
     a.Swap(&b);
   }
   inline void Swap(GameRadiusDamage* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameRadiusDamage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameRadiusDamage* New() const final {
-    return CreateMaybeMessage<GameRadiusDamage>(nullptr);
-  }
-
-  GameRadiusDamage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameRadiusDamage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameRadiusDamage>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameRadiusDamage& from);
-  void MergeFrom(const GameRadiusDamage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameRadiusDamage& from) {
+    GameRadiusDamage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameRadiusDamage* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameRadiusDamage";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameRadiusDamage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -6044,20 +7581,19 @@ class GameRadiusDamage :
     kPositionFieldNumber = 1,
     kDamageAmountFieldNumber = 3,
     kDamageRadiusFieldNumber = 4,
+    kDamageTypeIdFieldNumber = 5,
   };
-  // string damageType = 2;
+  // string damageType = 2 [(.Analytics.intern) = "damageTypeId"];
   void clear_damagetype();
   const std::string& damagetype() const;
-  void set_damagetype(const std::string& value);
-  void set_damagetype(std::string&& value);
-  void set_damagetype(const char* value);
-  void set_damagetype(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_damagetype(ArgT0&& arg0, ArgT... args);
   std::string* mutable_damagetype();
-  std::string* release_damagetype();
+  PROTOBUF_NODISCARD std::string* release_damagetype();
   void set_allocated_damagetype(std::string* damagetype);
   private:
   const std::string& _internal_damagetype() const;
-  void _internal_set_damagetype(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_damagetype(const std::string& value);
   std::string* _internal_mutable_damagetype();
   public:
 
@@ -6068,13 +7604,16 @@ class GameRadiusDamage :
   public:
   void clear_position();
   const ::Analytics::Vec3& position() const;
-  ::Analytics::Vec3* release_position();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_position();
   ::Analytics::Vec3* mutable_position();
   void set_allocated_position(::Analytics::Vec3* position);
   private:
   const ::Analytics::Vec3& _internal_position() const;
   ::Analytics::Vec3* _internal_mutable_position();
   public:
+  void unsafe_arena_set_allocated_position(
+      ::Analytics::Vec3* position);
+  ::Analytics::Vec3* unsafe_arena_release_position();
 
   // float damageAmount = 3;
   void clear_damageamount();
@@ -6094,25 +7633,41 @@ class GameRadiusDamage :
   void _internal_set_damageradius(float value);
   public:
 
+  // uint32 damageTypeId = 5 [(.Analytics.hidden) = true];
+  void clear_damagetypeid();
+  uint32_t damagetypeid() const;
+  void set_damagetypeid(uint32_t value);
+  private:
+  uint32_t _internal_damagetypeid() const;
+  void _internal_set_damagetypeid(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:Analytics.GameRadiusDamage)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr damagetype_;
-  ::Analytics::Vec3* position_;
-  float damageamount_;
-  float damageradius_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr damagetype_;
+    ::Analytics::Vec3* position_;
+    float damageamount_;
+    float damageradius_;
+    uint32_t damagetypeid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameNavigationStuck :
+class GameNavigationStuck final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameNavigationStuck) */ {
  public:
-  GameNavigationStuck();
-  virtual ~GameNavigationStuck();
+  inline GameNavigationStuck() : GameNavigationStuck(nullptr) {}
+  ~GameNavigationStuck() override;
+  explicit PROTOBUF_CONSTEXPR GameNavigationStuck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameNavigationStuck(const GameNavigationStuck& from);
   GameNavigationStuck(GameNavigationStuck&& from) noexcept
@@ -6125,8 +7680,13 @@ class GameNavigationStuck :
     return *this;
   }
   inline GameNavigationStuck& operator=(GameNavigationStuck&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -6137,77 +7697,86 @@ class GameNavigationStuck :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameNavigationStuck& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameNavigationStuck& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameNavigationStuck* internal_default_instance() {
     return reinterpret_cast<const GameNavigationStuck*>(
                &_GameNavigationStuck_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    34;
+    37;
 
   friend void swap(GameNavigationStuck& a, GameNavigationStuck& b) {
     a.Swap(&b);
   }
   inline void Swap(GameNavigationStuck* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameNavigationStuck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameNavigationStuck* New() const final {
-    return CreateMaybeMessage<GameNavigationStuck>(nullptr);
-  }
-
-  GameNavigationStuck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameNavigationStuck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameNavigationStuck>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameNavigationStuck& from);
-  void MergeFrom(const GameNavigationStuck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameNavigationStuck& from) {
+    GameNavigationStuck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameNavigationStuck* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameNavigationStuck";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameNavigationStuck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -6224,40 +7793,49 @@ class GameNavigationStuck :
   public:
   void clear_position();
   const ::Analytics::Vec3& position() const;
-  ::Analytics::Vec3* release_position();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_position();
   ::Analytics::Vec3* mutable_position();
   void set_allocated_position(::Analytics::Vec3* position);
   private:
   const ::Analytics::Vec3& _internal_position() const;
   ::Analytics::Vec3* _internal_mutable_position();
   public:
+  void unsafe_arena_set_allocated_position(
+      ::Analytics::Vec3* position);
+  ::Analytics::Vec3* unsafe_arena_release_position();
 
   // int32 entityId = 1;
   void clear_entityid();
-  ::PROTOBUF_NAMESPACE_ID::int32 entityid() const;
-  void set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t entityid() const;
+  void set_entityid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_entityid() const;
-  void _internal_set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_entityid() const;
+  void _internal_set_entityid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.GameNavigationStuck)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::Analytics::Vec3* position_;
-  ::PROTOBUF_NAMESPACE_ID::int32 entityid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::Analytics::Vec3* position_;
+    int32_t entityid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameVoiceMacro :
+class GameVoiceMacro final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameVoiceMacro) */ {
  public:
-  GameVoiceMacro();
-  virtual ~GameVoiceMacro();
+  inline GameVoiceMacro() : GameVoiceMacro(nullptr) {}
+  ~GameVoiceMacro() override;
+  explicit PROTOBUF_CONSTEXPR GameVoiceMacro(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameVoiceMacro(const GameVoiceMacro& from);
   GameVoiceMacro(GameVoiceMacro&& from) noexcept
@@ -6270,8 +7848,13 @@ class GameVoiceMacro :
     return *this;
   }
   inline GameVoiceMacro& operator=(GameVoiceMacro&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -6282,77 +7865,86 @@ class GameVoiceMacro :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameVoiceMacro& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameVoiceMacro& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameVoiceMacro* internal_default_instance() {
     return reinterpret_cast<const GameVoiceMacro*>(
                &_GameVoiceMacro_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    35;
+    38;
 
   friend void swap(GameVoiceMacro& a, GameVoiceMacro& b) {
     a.Swap(&b);
   }
   inline void Swap(GameVoiceMacro* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameVoiceMacro* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameVoiceMacro* New() const final {
-    return CreateMaybeMessage<GameVoiceMacro>(nullptr);
-  }
-
-  GameVoiceMacro* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameVoiceMacro* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameVoiceMacro>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameVoiceMacro& from);
-  void MergeFrom(const GameVoiceMacro& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameVoiceMacro& from) {
+    GameVoiceMacro::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameVoiceMacro* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameVoiceMacro";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameVoiceMacro(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -6370,50 +7962,59 @@ class GameVoiceMacro :
   public:
   void clear_position();
   const ::Analytics::Vec3& position() const;
-  ::Analytics::Vec3* release_position();
+  PROTOBUF_NODISCARD ::Analytics::Vec3* release_position();
   ::Analytics::Vec3* mutable_position();
   void set_allocated_position(::Analytics::Vec3* position);
   private:
   const ::Analytics::Vec3& _internal_position() const;
   ::Analytics::Vec3* _internal_mutable_position();
   public:
+  void unsafe_arena_set_allocated_position(
+      ::Analytics::Vec3* position);
+  ::Analytics::Vec3* unsafe_arena_release_position();
 
   // int32 entityId = 1;
   void clear_entityid();
-  ::PROTOBUF_NAMESPACE_ID::int32 entityid() const;
-  void set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t entityid() const;
+  void set_entityid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_entityid() const;
-  void _internal_set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_entityid() const;
+  void _internal_set_entityid(int32_t value);
   public:
 
   // int32 voiceMacro = 2 [(.Analytics.enumkey) = "VOICE_MACRO", (.Analytics.track_event) = true];
   void clear_voicemacro();
-  ::PROTOBUF_NAMESPACE_ID::int32 voicemacro() const;
-  void set_voicemacro(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t voicemacro() const;
+  void set_voicemacro(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_voicemacro() const;
-  void _internal_set_voicemacro(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_voicemacro() const;
+  void _internal_set_voicemacro(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:Analytics.GameVoiceMacro)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::Analytics::Vec3* position_;
-  ::PROTOBUF_NAMESPACE_ID::int32 entityid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 voicemacro_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::Analytics::Vec3* position_;
+    int32_t entityid_;
+    int32_t voicemacro_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameLogMessage :
+class GameLogMessage final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Analytics.GameLogMessage) */ {
  public:
-  GameLogMessage();
-  virtual ~GameLogMessage();
+  inline GameLogMessage() : GameLogMessage(nullptr) {}
+  ~GameLogMessage() override;
+  explicit PROTOBUF_CONSTEXPR GameLogMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameLogMessage(const GameLogMessage& from);
   GameLogMessage(GameLogMessage&& from) noexcept
@@ -6426,8 +8027,13 @@ class GameLogMessage :
     return *this;
   }
   inline GameLogMessage& operator=(GameLogMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -6438,77 +8044,86 @@ class GameLogMessage :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameLogMessage& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameLogMessage& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameLogMessage* internal_default_instance() {
     return reinterpret_cast<const GameLogMessage*>(
                &_GameLogMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    36;
+    39;
 
   friend void swap(GameLogMessage& a, GameLogMessage& b) {
     a.Swap(&b);
   }
   inline void Swap(GameLogMessage* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameLogMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameLogMessage* New() const final {
-    return CreateMaybeMessage<GameLogMessage>(nullptr);
-  }
-
-  GameLogMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameLogMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameLogMessage>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameLogMessage& from);
-  void MergeFrom(const GameLogMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameLogMessage& from) {
+    GameLogMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameLogMessage* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Analytics.GameLogMessage";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GameLogMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_analytics_2eproto);
-    return ::descriptor_table_analytics_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -6518,36 +8133,33 @@ class GameLogMessage :
     kLogMessageFieldNumber = 2,
     kLogExtraInfoFieldNumber = 3,
     kLogTypeFieldNumber = 1,
+    kLogMessageIdFieldNumber = 4,
   };
-  // string logMessage = 2;
+  // string logMessage = 2 [(.Analytics.intern) = "logMessageId"];
   void clear_logmessage();
   const std::string& logmessage() const;
-  void set_logmessage(const std::string& value);
-  void set_logmessage(std::string&& value);
-  void set_logmessage(const char* value);
-  void set_logmessage(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_logmessage(ArgT0&& arg0, ArgT... args);
   std::string* mutable_logmessage();
-  std::string* release_logmessage();
+  PROTOBUF_NODISCARD std::string* release_logmessage();
   void set_allocated_logmessage(std::string* logmessage);
   private:
   const std::string& _internal_logmessage() const;
-  void _internal_set_logmessage(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_logmessage(const std::string& value);
   std::string* _internal_mutable_logmessage();
   public:
 
   // string logExtraInfo = 3;
   void clear_logextrainfo();
   const std::string& logextrainfo() const;
-  void set_logextrainfo(const std::string& value);
-  void set_logextrainfo(std::string&& value);
-  void set_logextrainfo(const char* value);
-  void set_logextrainfo(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_logextrainfo(ArgT0&& arg0, ArgT... args);
   std::string* mutable_logextrainfo();
-  std::string* release_logextrainfo();
+  PROTOBUF_NODISCARD std::string* release_logextrainfo();
   void set_allocated_logextrainfo(std::string* logextrainfo);
   private:
   const std::string& _internal_logextrainfo() const;
-  void _internal_set_logextrainfo(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_logextrainfo(const std::string& value);
   std::string* _internal_mutable_logextrainfo();
   public:
 
@@ -6560,83 +8172,106 @@ class GameLogMessage :
   void _internal_set_logtype(::Analytics::LogType value);
   public:
 
+  // uint32 logMessageId = 4 [(.Analytics.hidden) = true];
+  void clear_logmessageid();
+  uint32_t logmessageid() const;
+  void set_logmessageid(uint32_t value);
+  private:
+  uint32_t _internal_logmessageid() const;
+  void _internal_set_logmessageid(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:Analytics.GameLogMessage)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr logmessage_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr logextrainfo_;
-  int logtype_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr logmessage_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr logextrainfo_;
+    int logtype_;
+    uint32_t logmessageid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_analytics_2eproto;
 };
 // ===================================================================
 
 static const int kRediskeytypeFieldNumber = 5000;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MessageOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::EnumTypeTraits< ::Analytics::RedisKeyType, ::Analytics::RedisKeyType_IsValid>, 14, false >
   rediskeytype;
 static const int kRedishmsetkeyFieldNumber = 5001;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MessageOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
   redishmsetkey;
 static const int kRediskeysuffixFieldNumber = 5002;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MessageOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
   rediskeysuffix;
 static const int kUseJsonEncodingFieldNumber = 5003;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MessageOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
   useJsonEncoding;
 static const int kObjectnameFieldNumber = 5005;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MessageOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
   objectname;
 static const int kEnumkeyFieldNumber = 4001;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
   enumkey;
 static const int kEditableFieldNumber = 4002;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
   editable;
 static const int kExpiresFieldNumber = 4003;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< ::PROTOBUF_NAMESPACE_ID::int32 >, 5, false >
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< int32_t >, 5, false >
   expires;
 static const int kEnumflagsFieldNumber = 4004;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
   enumflags;
 static const int kTooltipFieldNumber = 4005;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
   tooltip;
 static const int kHiddenFieldNumber = 4006;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
   hidden;
 static const int kEnumflagsindexedFieldNumber = 4007;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
   enumflagsindexed;
 static const int kEditableKeyFieldNumber = 4008;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
   editable_key;
 static const int kTrackEventFieldNumber = 4009;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
   track_event;
 static const int kPointEventFieldNumber = 4012;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::Analytics::PointEvent >, 11, false >
   point_event;
 static const int kLineEventFieldNumber = 4013;
-extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
     ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::Analytics::LineEvent >, 11, false >
   line_event;
+static const int kQuantizeFieldNumber = 4014;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< int32_t >, 5, false >
+  quantize;
+static const int kInternFieldNumber = 4015;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false >
+  intern;
 
 // ===================================================================
 
@@ -6648,53 +8283,38 @@ extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::google::protobu
 
 // string radius = 1;
 inline void PointEvent::clear_radius() {
-  radius_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.radius_.ClearToEmpty();
 }
 inline const std::string& PointEvent::radius() const {
   // @@protoc_insertion_point(field_get:Analytics.PointEvent.radius)
   return _internal_radius();
 }
-inline void PointEvent::set_radius(const std::string& value) {
-  _internal_set_radius(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PointEvent::set_radius(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.radius_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.PointEvent.radius)
 }
 inline std::string* PointEvent::mutable_radius() {
+  std::string* _s = _internal_mutable_radius();
   // @@protoc_insertion_point(field_mutable:Analytics.PointEvent.radius)
-  return _internal_mutable_radius();
+  return _s;
 }
 inline const std::string& PointEvent::_internal_radius() const {
-  return radius_.GetNoArena();
+  return _impl_.radius_.Get();
 }
 inline void PointEvent::_internal_set_radius(const std::string& value) {
   
-  radius_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void PointEvent::set_radius(std::string&& value) {
-  
-  radius_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.PointEvent.radius)
-}
-inline void PointEvent::set_radius(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  radius_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.PointEvent.radius)
-}
-inline void PointEvent::set_radius(const char* value, size_t size) {
-  
-  radius_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.PointEvent.radius)
+  _impl_.radius_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PointEvent::_internal_mutable_radius() {
   
-  return radius_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.radius_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PointEvent::release_radius() {
   // @@protoc_insertion_point(field_release:Analytics.PointEvent.radius)
-  
-  return radius_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.radius_.Release();
 }
 inline void PointEvent::set_allocated_radius(std::string* radius) {
   if (radius != nullptr) {
@@ -6702,59 +8322,49 @@ inline void PointEvent::set_allocated_radius(std::string* radius) {
   } else {
     
   }
-  radius_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), radius);
+  _impl_.radius_.SetAllocated(radius, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.radius_.IsDefault()) {
+    _impl_.radius_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.PointEvent.radius)
 }
 
 // string weight = 2;
 inline void PointEvent::clear_weight() {
-  weight_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.weight_.ClearToEmpty();
 }
 inline const std::string& PointEvent::weight() const {
   // @@protoc_insertion_point(field_get:Analytics.PointEvent.weight)
   return _internal_weight();
 }
-inline void PointEvent::set_weight(const std::string& value) {
-  _internal_set_weight(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PointEvent::set_weight(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.weight_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.PointEvent.weight)
 }
 inline std::string* PointEvent::mutable_weight() {
+  std::string* _s = _internal_mutable_weight();
   // @@protoc_insertion_point(field_mutable:Analytics.PointEvent.weight)
-  return _internal_mutable_weight();
+  return _s;
 }
 inline const std::string& PointEvent::_internal_weight() const {
-  return weight_.GetNoArena();
+  return _impl_.weight_.Get();
 }
 inline void PointEvent::_internal_set_weight(const std::string& value) {
   
-  weight_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void PointEvent::set_weight(std::string&& value) {
-  
-  weight_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.PointEvent.weight)
-}
-inline void PointEvent::set_weight(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  weight_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.PointEvent.weight)
-}
-inline void PointEvent::set_weight(const char* value, size_t size) {
-  
-  weight_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.PointEvent.weight)
+  _impl_.weight_.Set(value, GetArenaForAllocation());
 }
 inline std::string* PointEvent::_internal_mutable_weight() {
   
-  return weight_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.weight_.Mutable(GetArenaForAllocation());
 }
 inline std::string* PointEvent::release_weight() {
   // @@protoc_insertion_point(field_release:Analytics.PointEvent.weight)
-  
-  return weight_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.weight_.Release();
 }
 inline void PointEvent::set_allocated_weight(std::string* weight) {
   if (weight != nullptr) {
@@ -6762,7 +8372,12 @@ inline void PointEvent::set_allocated_weight(std::string* weight) {
   } else {
     
   }
-  weight_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), weight);
+  _impl_.weight_.SetAllocated(weight, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.weight_.IsDefault()) {
+    _impl_.weight_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.PointEvent.weight)
 }
 
@@ -6772,53 +8387,38 @@ inline void PointEvent::set_allocated_weight(std::string* weight) {
 
 // string radius = 1;
 inline void LineEvent::clear_radius() {
-  radius_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.radius_.ClearToEmpty();
 }
 inline const std::string& LineEvent::radius() const {
   // @@protoc_insertion_point(field_get:Analytics.LineEvent.radius)
   return _internal_radius();
 }
-inline void LineEvent::set_radius(const std::string& value) {
-  _internal_set_radius(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LineEvent::set_radius(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.radius_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.LineEvent.radius)
 }
 inline std::string* LineEvent::mutable_radius() {
+  std::string* _s = _internal_mutable_radius();
   // @@protoc_insertion_point(field_mutable:Analytics.LineEvent.radius)
-  return _internal_mutable_radius();
+  return _s;
 }
 inline const std::string& LineEvent::_internal_radius() const {
-  return radius_.GetNoArena();
+  return _impl_.radius_.Get();
 }
 inline void LineEvent::_internal_set_radius(const std::string& value) {
   
-  radius_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void LineEvent::set_radius(std::string&& value) {
-  
-  radius_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.LineEvent.radius)
-}
-inline void LineEvent::set_radius(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  radius_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.LineEvent.radius)
-}
-inline void LineEvent::set_radius(const char* value, size_t size) {
-  
-  radius_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.LineEvent.radius)
+  _impl_.radius_.Set(value, GetArenaForAllocation());
 }
 inline std::string* LineEvent::_internal_mutable_radius() {
   
-  return radius_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.radius_.Mutable(GetArenaForAllocation());
 }
 inline std::string* LineEvent::release_radius() {
   // @@protoc_insertion_point(field_release:Analytics.LineEvent.radius)
-  
-  return radius_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.radius_.Release();
 }
 inline void LineEvent::set_allocated_radius(std::string* radius) {
   if (radius != nullptr) {
@@ -6826,59 +8426,49 @@ inline void LineEvent::set_allocated_radius(std::string* radius) {
   } else {
     
   }
-  radius_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), radius);
+  _impl_.radius_.SetAllocated(radius, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.radius_.IsDefault()) {
+    _impl_.radius_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.LineEvent.radius)
 }
 
 // string weight = 2;
 inline void LineEvent::clear_weight() {
-  weight_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.weight_.ClearToEmpty();
 }
 inline const std::string& LineEvent::weight() const {
   // @@protoc_insertion_point(field_get:Analytics.LineEvent.weight)
   return _internal_weight();
 }
-inline void LineEvent::set_weight(const std::string& value) {
-  _internal_set_weight(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LineEvent::set_weight(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.weight_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.LineEvent.weight)
 }
 inline std::string* LineEvent::mutable_weight() {
+  std::string* _s = _internal_mutable_weight();
   // @@protoc_insertion_point(field_mutable:Analytics.LineEvent.weight)
-  return _internal_mutable_weight();
+  return _s;
 }
 inline const std::string& LineEvent::_internal_weight() const {
-  return weight_.GetNoArena();
+  return _impl_.weight_.Get();
 }
 inline void LineEvent::_internal_set_weight(const std::string& value) {
   
-  weight_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void LineEvent::set_weight(std::string&& value) {
-  
-  weight_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.LineEvent.weight)
-}
-inline void LineEvent::set_weight(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  weight_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.LineEvent.weight)
-}
-inline void LineEvent::set_weight(const char* value, size_t size) {
-  
-  weight_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.LineEvent.weight)
+  _impl_.weight_.Set(value, GetArenaForAllocation());
 }
 inline std::string* LineEvent::_internal_mutable_weight() {
   
-  return weight_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.weight_.Mutable(GetArenaForAllocation());
 }
 inline std::string* LineEvent::release_weight() {
   // @@protoc_insertion_point(field_release:Analytics.LineEvent.weight)
-  
-  return weight_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.weight_.Release();
 }
 inline void LineEvent::set_allocated_weight(std::string* weight) {
   if (weight != nullptr) {
@@ -6886,63 +8476,123 @@ inline void LineEvent::set_allocated_weight(std::string* weight) {
   } else {
     
   }
-  weight_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), weight);
+  _impl_.weight_.SetAllocated(weight, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.weight_.IsDefault()) {
+    _impl_.weight_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.LineEvent.weight)
 }
 
+// string group = 3;
+inline void LineEvent::clear_group() {
+  _impl_.group_.ClearToEmpty();
+}
+inline const std::string& LineEvent::group() const {
+  // @@protoc_insertion_point(field_get:Analytics.LineEvent.group)
+  return _internal_group();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LineEvent::set_group(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.group_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Analytics.LineEvent.group)
+}
+inline std::string* LineEvent::mutable_group() {
+  std::string* _s = _internal_mutable_group();
+  // @@protoc_insertion_point(field_mutable:Analytics.LineEvent.group)
+  return _s;
+}
+inline const std::string& LineEvent::_internal_group() const {
+  return _impl_.group_.Get();
+}
+inline void LineEvent::_internal_set_group(const std::string& value) {
+  
+  _impl_.group_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LineEvent::_internal_mutable_group() {
+  
+  return _impl_.group_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LineEvent::release_group() {
+  // @@protoc_insertion_point(field_release:Analytics.LineEvent.group)
+  return _impl_.group_.Release();
+}
+inline void LineEvent::set_allocated_group(std::string* group) {
+  if (group != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.group_.SetAllocated(group, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.group_.IsDefault()) {
+    _impl_.group_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Analytics.LineEvent.group)
+}
+
+// float maxStep = 4;
+inline void LineEvent::clear_maxstep() {
+  _impl_.maxstep_ = 0;
+}
+inline float LineEvent::_internal_maxstep() const {
+  return _impl_.maxstep_;
+}
+inline float LineEvent::maxstep() const {
+  // @@protoc_insertion_point(field_get:Analytics.LineEvent.maxStep)
+  return _internal_maxstep();
+}
+inline void LineEvent::_internal_set_maxstep(float value) {
+  
+  _impl_.maxstep_ = value;
+}
+inline void LineEvent::set_maxstep(float value) {
+  _internal_set_maxstep(value);
+  // @@protoc_insertion_point(field_set:Analytics.LineEvent.maxStep)
+}
+
 // -------------------------------------------------------------------
 
 // EditorChangeValue
 
 // string messageType = 1;
 inline void EditorChangeValue::clear_messagetype() {
-  messagetype_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.messagetype_.ClearToEmpty();
 }
 inline const std::string& EditorChangeValue::messagetype() const {
   // @@protoc_insertion_point(field_get:Analytics.EditorChangeValue.messageType)
   return _internal_messagetype();
 }
-inline void EditorChangeValue::set_messagetype(const std::string& value) {
-  _internal_set_messagetype(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EditorChangeValue::set_messagetype(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.messagetype_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.EditorChangeValue.messageType)
 }
 inline std::string* EditorChangeValue::mutable_messagetype() {
+  std::string* _s = _internal_mutable_messagetype();
   // @@protoc_insertion_point(field_mutable:Analytics.EditorChangeValue.messageType)
-  return _internal_mutable_messagetype();
+  return _s;
 }
 inline const std::string& EditorChangeValue::_internal_messagetype() const {
-  return messagetype_.GetNoArena();
+  return _impl_.messagetype_.Get();
 }
 inline void EditorChangeValue::_internal_set_messagetype(const std::string& value) {
   
-  messagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void EditorChangeValue::set_messagetype(std::string&& value) {
-  
-  messagetype_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.EditorChangeValue.messageType)
-}
-inline void EditorChangeValue::set_messagetype(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  messagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.EditorChangeValue.messageType)
-}
-inline void EditorChangeValue::set_messagetype(const char* value, size_t size) {
-  
-  messagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.EditorChangeValue.messageType)
+  _impl_.messagetype_.Set(value, GetArenaForAllocation());
 }
 inline std::string* EditorChangeValue::_internal_mutable_messagetype() {
   
-  return messagetype_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.messagetype_.Mutable(GetArenaForAllocation());
 }
 inline std::string* EditorChangeValue::release_messagetype() {
   // @@protoc_insertion_point(field_release:Analytics.EditorChangeValue.messageType)
-  
-  return messagetype_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.messagetype_.Release();
 }
 inline void EditorChangeValue::set_allocated_messagetype(std::string* messagetype) {
   if (messagetype != nullptr) {
@@ -6950,59 +8600,49 @@ inline void EditorChangeValue::set_allocated_messagetype(std::string* messagetyp
   } else {
     
   }
-  messagetype_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), messagetype);
+  _impl_.messagetype_.SetAllocated(messagetype, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.messagetype_.IsDefault()) {
+    _impl_.messagetype_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.EditorChangeValue.messageType)
 }
 
 // string fieldName = 2;
 inline void EditorChangeValue::clear_fieldname() {
-  fieldname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.fieldname_.ClearToEmpty();
 }
 inline const std::string& EditorChangeValue::fieldname() const {
   // @@protoc_insertion_point(field_get:Analytics.EditorChangeValue.fieldName)
   return _internal_fieldname();
 }
-inline void EditorChangeValue::set_fieldname(const std::string& value) {
-  _internal_set_fieldname(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EditorChangeValue::set_fieldname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.fieldname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.EditorChangeValue.fieldName)
 }
 inline std::string* EditorChangeValue::mutable_fieldname() {
+  std::string* _s = _internal_mutable_fieldname();
   // @@protoc_insertion_point(field_mutable:Analytics.EditorChangeValue.fieldName)
-  return _internal_mutable_fieldname();
+  return _s;
 }
 inline const std::string& EditorChangeValue::_internal_fieldname() const {
-  return fieldname_.GetNoArena();
+  return _impl_.fieldname_.Get();
 }
 inline void EditorChangeValue::_internal_set_fieldname(const std::string& value) {
   
-  fieldname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void EditorChangeValue::set_fieldname(std::string&& value) {
-  
-  fieldname_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.EditorChangeValue.fieldName)
-}
-inline void EditorChangeValue::set_fieldname(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  fieldname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.EditorChangeValue.fieldName)
-}
-inline void EditorChangeValue::set_fieldname(const char* value, size_t size) {
-  
-  fieldname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.EditorChangeValue.fieldName)
+  _impl_.fieldname_.Set(value, GetArenaForAllocation());
 }
 inline std::string* EditorChangeValue::_internal_mutable_fieldname() {
   
-  return fieldname_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.fieldname_.Mutable(GetArenaForAllocation());
 }
 inline std::string* EditorChangeValue::release_fieldname() {
   // @@protoc_insertion_point(field_release:Analytics.EditorChangeValue.fieldName)
-  
-  return fieldname_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.fieldname_.Release();
 }
 inline void EditorChangeValue::set_allocated_fieldname(std::string* fieldname) {
   if (fieldname != nullptr) {
@@ -7010,59 +8650,49 @@ inline void EditorChangeValue::set_allocated_fieldname(std::string* fieldname) {
   } else {
     
   }
-  fieldname_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), fieldname);
+  _impl_.fieldname_.SetAllocated(fieldname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.fieldname_.IsDefault()) {
+    _impl_.fieldname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.EditorChangeValue.fieldName)
 }
 
 // string payload = 3;
 inline void EditorChangeValue::clear_payload() {
-  payload_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.payload_.ClearToEmpty();
 }
 inline const std::string& EditorChangeValue::payload() const {
   // @@protoc_insertion_point(field_get:Analytics.EditorChangeValue.payload)
   return _internal_payload();
 }
-inline void EditorChangeValue::set_payload(const std::string& value) {
-  _internal_set_payload(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EditorChangeValue::set_payload(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.payload_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.EditorChangeValue.payload)
 }
 inline std::string* EditorChangeValue::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
   // @@protoc_insertion_point(field_mutable:Analytics.EditorChangeValue.payload)
-  return _internal_mutable_payload();
+  return _s;
 }
 inline const std::string& EditorChangeValue::_internal_payload() const {
-  return payload_.GetNoArena();
+  return _impl_.payload_.Get();
 }
 inline void EditorChangeValue::_internal_set_payload(const std::string& value) {
   
-  payload_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void EditorChangeValue::set_payload(std::string&& value) {
-  
-  payload_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.EditorChangeValue.payload)
-}
-inline void EditorChangeValue::set_payload(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  payload_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.EditorChangeValue.payload)
-}
-inline void EditorChangeValue::set_payload(const char* value, size_t size) {
-  
-  payload_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.EditorChangeValue.payload)
+  _impl_.payload_.Set(value, GetArenaForAllocation());
 }
 inline std::string* EditorChangeValue::_internal_mutable_payload() {
   
-  return payload_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
 }
 inline std::string* EditorChangeValue::release_payload() {
   // @@protoc_insertion_point(field_release:Analytics.EditorChangeValue.payload)
-  
-  return payload_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.payload_.Release();
 }
 inline void EditorChangeValue::set_allocated_payload(std::string* payload) {
   if (payload != nullptr) {
@@ -7070,7 +8700,12 @@ inline void EditorChangeValue::set_allocated_payload(std::string* payload) {
   } else {
     
   }
-  payload_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), payload);
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.EditorChangeValue.payload)
 }
 
@@ -7080,41 +8715,42 @@ inline void EditorChangeValue::set_allocated_payload(std::string* payload) {
 
 // repeated .Analytics.EditorChangeValue changes = 1;
 inline int EditorChanges::_internal_changes_size() const {
-  return changes_.size();
+  return _impl_.changes_.size();
 }
 inline int EditorChanges::changes_size() const {
   return _internal_changes_size();
 }
 inline void EditorChanges::clear_changes() {
-  changes_.Clear();
+  _impl_.changes_.Clear();
 }
 inline ::Analytics::EditorChangeValue* EditorChanges::mutable_changes(int index) {
   // @@protoc_insertion_point(field_mutable:Analytics.EditorChanges.changes)
-  return changes_.Mutable(index);
+  return _impl_.changes_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::EditorChangeValue >*
 EditorChanges::mutable_changes() {
   // @@protoc_insertion_point(field_mutable_list:Analytics.EditorChanges.changes)
-  return &changes_;
+  return &_impl_.changes_;
 }
 inline const ::Analytics::EditorChangeValue& EditorChanges::_internal_changes(int index) const {
-  return changes_.Get(index);
+  return _impl_.changes_.Get(index);
 }
 inline const ::Analytics::EditorChangeValue& EditorChanges::changes(int index) const {
   // @@protoc_insertion_point(field_get:Analytics.EditorChanges.changes)
   return _internal_changes(index);
 }
 inline ::Analytics::EditorChangeValue* EditorChanges::_internal_add_changes() {
-  return changes_.Add();
+  return _impl_.changes_.Add();
 }
 inline ::Analytics::EditorChangeValue* EditorChanges::add_changes() {
+  ::Analytics::EditorChangeValue* _add = _internal_add_changes();
   // @@protoc_insertion_point(field_add:Analytics.EditorChanges.changes)
-  return _internal_add_changes();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::EditorChangeValue >&
 EditorChanges::changes() const {
   // @@protoc_insertion_point(field_list:Analytics.EditorChanges.changes)
-  return changes_;
+  return _impl_.changes_;
 }
 
 // -------------------------------------------------------------------
@@ -7123,10 +8759,10 @@ EditorChanges::changes() const {
 
 // float min = 1;
 inline void RangeF::clear_min() {
-  min_ = 0;
+  _impl_.min_ = 0;
 }
 inline float RangeF::_internal_min() const {
-  return min_;
+  return _impl_.min_;
 }
 inline float RangeF::min() const {
   // @@protoc_insertion_point(field_get:Analytics.RangeF.min)
@@ -7134,7 +8770,7 @@ inline float RangeF::min() const {
 }
 inline void RangeF::_internal_set_min(float value) {
   
-  min_ = value;
+  _impl_.min_ = value;
 }
 inline void RangeF::set_min(float value) {
   _internal_set_min(value);
@@ -7143,10 +8779,10 @@ inline void RangeF::set_min(float value) {
 
 // float max = 2;
 inline void RangeF::clear_max() {
-  max_ = 0;
+  _impl_.max_ = 0;
 }
 inline float RangeF::_internal_max() const {
-  return max_;
+  return _impl_.max_;
 }
 inline float RangeF::max() const {
   // @@protoc_insertion_point(field_get:Analytics.RangeF.max)
@@ -7154,7 +8790,7 @@ inline float RangeF::max() const {
 }
 inline void RangeF::_internal_set_max(float value) {
   
-  max_ = value;
+  _impl_.max_ = value;
 }
 inline void RangeF::set_max(float value) {
   _internal_set_max(value);
@@ -7167,40 +8803,40 @@ inline void RangeF::set_max(float value) {
 
 // int32 min = 1;
 inline void RangeI::clear_min() {
-  min_ = 0;
+  _impl_.min_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RangeI::_internal_min() const {
-  return min_;
+inline int32_t RangeI::_internal_min() const {
+  return _impl_.min_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RangeI::min() const {
+inline int32_t RangeI::min() const {
   // @@protoc_insertion_point(field_get:Analytics.RangeI.min)
   return _internal_min();
 }
-inline void RangeI::_internal_set_min(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RangeI::_internal_set_min(int32_t value) {
   
-  min_ = value;
+  _impl_.min_ = value;
 }
-inline void RangeI::set_min(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RangeI::set_min(int32_t value) {
   _internal_set_min(value);
   // @@protoc_insertion_point(field_set:Analytics.RangeI.min)
 }
 
 // int32 max = 2;
 inline void RangeI::clear_max() {
-  max_ = 0;
+  _impl_.max_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RangeI::_internal_max() const {
-  return max_;
+inline int32_t RangeI::_internal_max() const {
+  return _impl_.max_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RangeI::max() const {
+inline int32_t RangeI::max() const {
   // @@protoc_insertion_point(field_get:Analytics.RangeI.max)
   return _internal_max();
 }
-inline void RangeI::_internal_set_max(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RangeI::_internal_set_max(int32_t value) {
   
-  max_ = value;
+  _impl_.max_ = value;
 }
-inline void RangeI::set_max(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RangeI::set_max(int32_t value) {
   _internal_set_max(value);
   // @@protoc_insertion_point(field_set:Analytics.RangeI.max)
 }
@@ -7211,10 +8847,10 @@ inline void RangeI::set_max(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // float x = 1;
 inline void Vec3::clear_x() {
-  x_ = 0;
+  _impl_.x_ = 0;
 }
 inline float Vec3::_internal_x() const {
-  return x_;
+  return _impl_.x_;
 }
 inline float Vec3::x() const {
   // @@protoc_insertion_point(field_get:Analytics.Vec3.x)
@@ -7222,7 +8858,7 @@ inline float Vec3::x() const {
 }
 inline void Vec3::_internal_set_x(float value) {
   
-  x_ = value;
+  _impl_.x_ = value;
 }
 inline void Vec3::set_x(float value) {
   _internal_set_x(value);
@@ -7231,10 +8867,10 @@ inline void Vec3::set_x(float value) {
 
 // float y = 2;
 inline void Vec3::clear_y() {
-  y_ = 0;
+  _impl_.y_ = 0;
 }
 inline float Vec3::_internal_y() const {
-  return y_;
+  return _impl_.y_;
 }
 inline float Vec3::y() const {
   // @@protoc_insertion_point(field_get:Analytics.Vec3.y)
@@ -7242,7 +8878,7 @@ inline float Vec3::y() const {
 }
 inline void Vec3::_internal_set_y(float value) {
   
-  y_ = value;
+  _impl_.y_ = value;
 }
 inline void Vec3::set_y(float value) {
   _internal_set_y(value);
@@ -7251,10 +8887,10 @@ inline void Vec3::set_y(float value) {
 
 // float z = 3;
 inline void Vec3::clear_z() {
-  z_ = 0;
+  _impl_.z_ = 0;
 }
 inline float Vec3::_internal_z() const {
-  return z_;
+  return _impl_.z_;
 }
 inline float Vec3::z() const {
   // @@protoc_insertion_point(field_get:Analytics.Vec3.z)
@@ -7262,23 +8898,43 @@ inline float Vec3::z() const {
 }
 inline void Vec3::_internal_set_z(float value) {
   
-  z_ = value;
+  _impl_.z_ = value;
 }
 inline void Vec3::set_z(float value) {
   _internal_set_z(value);
   // @@protoc_insertion_point(field_set:Analytics.Vec3.z)
 }
 
+// uint64 quantized = 4;
+inline void Vec3::clear_quantized() {
+  _impl_.quantized_ = uint64_t{0u};
+}
+inline uint64_t Vec3::_internal_quantized() const {
+  return _impl_.quantized_;
+}
+inline uint64_t Vec3::quantized() const {
+  // @@protoc_insertion_point(field_get:Analytics.Vec3.quantized)
+  return _internal_quantized();
+}
+inline void Vec3::_internal_set_quantized(uint64_t value) {
+  
+  _impl_.quantized_ = value;
+}
+inline void Vec3::set_quantized(uint64_t value) {
+  _internal_set_quantized(value);
+  // @@protoc_insertion_point(field_set:Analytics.Vec3.quantized)
+}
+
 // -------------------------------------------------------------------
 
 // Vec3Color
 
 // float x = 1;
 inline void Vec3Color::clear_x() {
-  x_ = 0;
+  _impl_.x_ = 0;
 }
 inline float Vec3Color::_internal_x() const {
-  return x_;
+  return _impl_.x_;
 }
 inline float Vec3Color::x() const {
   // @@protoc_insertion_point(field_get:Analytics.Vec3Color.x)
@@ -7286,7 +8942,7 @@ inline float Vec3Color::x() const {
 }
 inline void Vec3Color::_internal_set_x(float value) {
   
-  x_ = value;
+  _impl_.x_ = value;
 }
 inline void Vec3Color::set_x(float value) {
   _internal_set_x(value);
@@ -7295,10 +8951,10 @@ inline void Vec3Color::set_x(float value) {
 
 // float y = 2;
 inline void Vec3Color::clear_y() {
-  y_ = 0;
+  _impl_.y_ = 0;
 }
 inline float Vec3Color::_internal_y() const {
-  return y_;
+  return _impl_.y_;
 }
 inline float Vec3Color::y() const {
   // @@protoc_insertion_point(field_get:Analytics.Vec3Color.y)
@@ -7306,7 +8962,7 @@ inline float Vec3Color::y() const {
 }
 inline void Vec3Color::_internal_set_y(float value) {
   
-  y_ = value;
+  _impl_.y_ = value;
 }
 inline void Vec3Color::set_y(float value) {
   _internal_set_y(value);
@@ -7315,10 +8971,10 @@ inline void Vec3Color::set_y(float value) {
 
 // float z = 3;
 inline void Vec3Color::clear_z() {
-  z_ = 0;
+  _impl_.z_ = 0;
 }
 inline float Vec3Color::_internal_z() const {
-  return z_;
+  return _impl_.z_;
 }
 inline float Vec3Color::z() const {
   // @@protoc_insertion_point(field_get:Analytics.Vec3Color.z)
@@ -7326,7 +8982,7 @@ inline float Vec3Color::z() const {
 }
 inline void Vec3Color::_internal_set_z(float value) {
   
-  z_ = value;
+  _impl_.z_ = value;
 }
 inline void Vec3Color::set_z(float value) {
   _internal_set_z(value);
@@ -7335,20 +8991,20 @@ inline void Vec3Color::set_z(float value) {
 
 // uint32 color = 4;
 inline void Vec3Color::clear_color() {
-  color_ = 0u;
+  _impl_.color_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Vec3Color::_internal_color() const {
-  return color_;
+inline uint32_t Vec3Color::_internal_color() const {
+  return _impl_.color_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Vec3Color::color() const {
+inline uint32_t Vec3Color::color() const {
   // @@protoc_insertion_point(field_get:Analytics.Vec3Color.color)
   return _internal_color();
 }
-inline void Vec3Color::_internal_set_color(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Vec3Color::_internal_set_color(uint32_t value) {
   
-  color_ = value;
+  _impl_.color_ = value;
 }
-inline void Vec3Color::set_color(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Vec3Color::set_color(uint32_t value) {
   _internal_set_color(value);
   // @@protoc_insertion_point(field_set:Analytics.Vec3Color.color)
 }
@@ -7359,10 +9015,10 @@ inline void Vec3Color::set_color(::PROTOBUF_NAMESPACE_ID::uint32 value) {
 
 // float x = 1;
 inline void Vec4::clear_x() {
-  x_ = 0;
+  _impl_.x_ = 0;
 }
 inline float Vec4::_internal_x() const {
-  return x_;
+  return _impl_.x_;
 }
 inline float Vec4::x() const {
   // @@protoc_insertion_point(field_get:Analytics.Vec4.x)
@@ -7370,7 +9026,7 @@ inline float Vec4::x() const {
 }
 inline void Vec4::_internal_set_x(float value) {
   
-  x_ = value;
+  _impl_.x_ = value;
 }
 inline void Vec4::set_x(float value) {
   _internal_set_x(value);
@@ -7379,10 +9035,10 @@ inline void Vec4::set_x(float value) {
 
 // float y = 2;
 inline void Vec4::clear_y() {
-  y_ = 0;
+  _impl_.y_ = 0;
 }
 inline float Vec4::_internal_y() const {
-  return y_;
+  return _impl_.y_;
 }
 inline float Vec4::y() const {
   // @@protoc_insertion_point(field_get:Analytics.Vec4.y)
@@ -7390,7 +9046,7 @@ inline float Vec4::y() const {
 }
 inline void Vec4::_internal_set_y(float value) {
   
-  y_ = value;
+  _impl_.y_ = value;
 }
 inline void Vec4::set_y(float value) {
   _internal_set_y(value);
@@ -7399,10 +9055,10 @@ inline void Vec4::set_y(float value) {
 
 // float z = 3;
 inline void Vec4::clear_z() {
-  z_ = 0;
+  _impl_.z_ = 0;
 }
 inline float Vec4::_internal_z() const {
-  return z_;
+  return _impl_.z_;
 }
 inline float Vec4::z() const {
   // @@protoc_insertion_point(field_get:Analytics.Vec4.z)
@@ -7410,7 +9066,7 @@ inline float Vec4::z() const {
 }
 inline void Vec4::_internal_set_z(float value) {
   
-  z_ = value;
+  _impl_.z_ = value;
 }
 inline void Vec4::set_z(float value) {
   _internal_set_z(value);
@@ -7419,10 +9075,10 @@ inline void Vec4::set_z(float value) {
 
 // float w = 4;
 inline void Vec4::clear_w() {
-  w_ = 0;
+  _impl_.w_ = 0;
 }
 inline float Vec4::_internal_w() const {
-  return w_;
+  return _impl_.w_;
 }
 inline float Vec4::w() const {
   // @@protoc_insertion_point(field_get:Analytics.Vec4.w)
@@ -7430,7 +9086,7 @@ inline float Vec4::w() const {
 }
 inline void Vec4::_internal_set_w(float value) {
   
-  w_ = value;
+  _impl_.w_ = value;
 }
 inline void Vec4::set_w(float value) {
   _internal_set_w(value);
@@ -7443,52 +9099,82 @@ inline void Vec4::set_w(float value) {
 
 // .Analytics.Vec3 p0 = 1;
 inline bool Line::_internal_has_p0() const {
-  return this != internal_default_instance() && p0_ != nullptr;
+  return this != internal_default_instance() && _impl_.p0_ != nullptr;
 }
 inline bool Line::has_p0() const {
   return _internal_has_p0();
 }
 inline void Line::clear_p0() {
-  if (GetArenaNoVirtual() == nullptr && p0_ != nullptr) {
-    delete p0_;
+  if (GetArenaForAllocation() == nullptr && _impl_.p0_ != nullptr) {
+    delete _impl_.p0_;
   }
-  p0_ = nullptr;
+  _impl_.p0_ = nullptr;
 }
 inline const ::Analytics::Vec3& Line::_internal_p0() const {
-  const ::Analytics::Vec3* p = p0_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.p0_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& Line::p0() const {
   // @@protoc_insertion_point(field_get:Analytics.Line.p0)
   return _internal_p0();
 }
+inline void Line::unsafe_arena_set_allocated_p0(
+    ::Analytics::Vec3* p0) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.p0_);
+  }
+  _impl_.p0_ = p0;
+  if (p0) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.Line.p0)
+}
 inline ::Analytics::Vec3* Line::release_p0() {
+  
+  ::Analytics::Vec3* temp = _impl_.p0_;
+  _impl_.p0_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* Line::unsafe_arena_release_p0() {
   // @@protoc_insertion_point(field_release:Analytics.Line.p0)
   
-  ::Analytics::Vec3* temp = p0_;
-  p0_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.p0_;
+  _impl_.p0_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* Line::_internal_mutable_p0() {
   
-  if (p0_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    p0_ = p;
+  if (_impl_.p0_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.p0_ = p;
   }
-  return p0_;
+  return _impl_.p0_;
 }
 inline ::Analytics::Vec3* Line::mutable_p0() {
+  ::Analytics::Vec3* _msg = _internal_mutable_p0();
   // @@protoc_insertion_point(field_mutable:Analytics.Line.p0)
-  return _internal_mutable_p0();
+  return _msg;
 }
 inline void Line::set_allocated_p0(::Analytics::Vec3* p0) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete p0_;
+    delete _impl_.p0_;
   }
   if (p0) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(p0);
     if (message_arena != submessage_arena) {
       p0 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, p0, submessage_arena);
@@ -7497,58 +9183,88 @@ inline void Line::set_allocated_p0(::Analytics::Vec3* p0) {
   } else {
     
   }
-  p0_ = p0;
+  _impl_.p0_ = p0;
   // @@protoc_insertion_point(field_set_allocated:Analytics.Line.p0)
 }
 
 // .Analytics.Vec3 p1 = 2;
 inline bool Line::_internal_has_p1() const {
-  return this != internal_default_instance() && p1_ != nullptr;
+  return this != internal_default_instance() && _impl_.p1_ != nullptr;
 }
 inline bool Line::has_p1() const {
   return _internal_has_p1();
 }
 inline void Line::clear_p1() {
-  if (GetArenaNoVirtual() == nullptr && p1_ != nullptr) {
-    delete p1_;
+  if (GetArenaForAllocation() == nullptr && _impl_.p1_ != nullptr) {
+    delete _impl_.p1_;
   }
-  p1_ = nullptr;
+  _impl_.p1_ = nullptr;
 }
 inline const ::Analytics::Vec3& Line::_internal_p1() const {
-  const ::Analytics::Vec3* p = p1_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.p1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& Line::p1() const {
   // @@protoc_insertion_point(field_get:Analytics.Line.p1)
   return _internal_p1();
 }
+inline void Line::unsafe_arena_set_allocated_p1(
+    ::Analytics::Vec3* p1) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.p1_);
+  }
+  _impl_.p1_ = p1;
+  if (p1) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.Line.p1)
+}
 inline ::Analytics::Vec3* Line::release_p1() {
+  
+  ::Analytics::Vec3* temp = _impl_.p1_;
+  _impl_.p1_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* Line::unsafe_arena_release_p1() {
   // @@protoc_insertion_point(field_release:Analytics.Line.p1)
   
-  ::Analytics::Vec3* temp = p1_;
-  p1_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.p1_;
+  _impl_.p1_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* Line::_internal_mutable_p1() {
   
-  if (p1_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    p1_ = p;
+  if (_impl_.p1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.p1_ = p;
   }
-  return p1_;
+  return _impl_.p1_;
 }
 inline ::Analytics::Vec3* Line::mutable_p1() {
+  ::Analytics::Vec3* _msg = _internal_mutable_p1();
   // @@protoc_insertion_point(field_mutable:Analytics.Line.p1)
-  return _internal_mutable_p1();
+  return _msg;
 }
 inline void Line::set_allocated_p1(::Analytics::Vec3* p1) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete p1_;
+    delete _impl_.p1_;
   }
   if (p1) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(p1);
     if (message_arena != submessage_arena) {
       p1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, p1, submessage_arena);
@@ -7557,7 +9273,7 @@ inline void Line::set_allocated_p1(::Analytics::Vec3* p1) {
   } else {
     
   }
-  p1_ = p1;
+  _impl_.p1_ = p1;
   // @@protoc_insertion_point(field_set_allocated:Analytics.Line.p1)
 }
 
@@ -7567,10 +9283,10 @@ inline void Line::set_allocated_p1(::Analytics::Vec3* p1) {
 
 // float heading = 1;
 inline void Euler::clear_heading() {
-  heading_ = 0;
+  _impl_.heading_ = 0;
 }
 inline float Euler::_internal_heading() const {
-  return heading_;
+  return _impl_.heading_;
 }
 inline float Euler::heading() const {
   // @@protoc_insertion_point(field_get:Analytics.Euler.heading)
@@ -7578,7 +9294,7 @@ inline float Euler::heading() const {
 }
 inline void Euler::_internal_set_heading(float value) {
   
-  heading_ = value;
+  _impl_.heading_ = value;
 }
 inline void Euler::set_heading(float value) {
   _internal_set_heading(value);
@@ -7587,10 +9303,10 @@ inline void Euler::set_heading(float value) {
 
 // float pitch = 2;
 inline void Euler::clear_pitch() {
-  pitch_ = 0;
+  _impl_.pitch_ = 0;
 }
 inline float Euler::_internal_pitch() const {
-  return pitch_;
+  return _impl_.pitch_;
 }
 inline float Euler::pitch() const {
   // @@protoc_insertion_point(field_get:Analytics.Euler.pitch)
@@ -7598,7 +9314,7 @@ inline float Euler::pitch() const {
 }
 inline void Euler::_internal_set_pitch(float value) {
   
-  pitch_ = value;
+  _impl_.pitch_ = value;
 }
 inline void Euler::set_pitch(float value) {
   _internal_set_pitch(value);
@@ -7607,10 +9323,10 @@ inline void Euler::set_pitch(float value) {
 
 // float roll = 3;
 inline void Euler::clear_roll() {
-  roll_ = 0;
+  _impl_.roll_ = 0;
 }
 inline float Euler::_internal_roll() const {
-  return roll_;
+  return _impl_.roll_;
 }
 inline float Euler::roll() const {
   // @@protoc_insertion_point(field_get:Analytics.Euler.roll)
@@ -7618,7 +9334,7 @@ inline float Euler::roll() const {
 }
 inline void Euler::_internal_set_roll(float value) {
   
-  roll_ = value;
+  _impl_.roll_ = value;
 }
 inline void Euler::set_roll(float value) {
   _internal_set_roll(value);
@@ -7631,53 +9347,38 @@ inline void Euler::set_roll(float value) {
 
 // string name = 1;
 inline void Material::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& Material::name() const {
   // @@protoc_insertion_point(field_get:Analytics.Material.name)
   return _internal_name();
 }
-inline void Material::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Material::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.Material.name)
 }
 inline std::string* Material::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:Analytics.Material.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& Material::_internal_name() const {
-  return name_.GetNoArena();
+  return _impl_.name_.Get();
 }
 inline void Material::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void Material::set_name(std::string&& value) {
-  
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.Material.name)
-}
-inline void Material::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.Material.name)
-}
-inline void Material::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.Material.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Material::_internal_mutable_name() {
   
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Material::release_name() {
   // @@protoc_insertion_point(field_release:Analytics.Material.name)
-  
-  return name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
 inline void Material::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -7685,56 +9386,61 @@ inline void Material::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.Material.name)
 }
 
 // uint32 contents = 2 [(.Analytics.enumkey) = "CONTENT_FLAGS", (.Analytics.enumflags) = true];
 inline void Material::clear_contents() {
-  contents_ = 0u;
+  _impl_.contents_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Material::_internal_contents() const {
-  return contents_;
+inline uint32_t Material::_internal_contents() const {
+  return _impl_.contents_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Material::contents() const {
+inline uint32_t Material::contents() const {
   // @@protoc_insertion_point(field_get:Analytics.Material.contents)
   return _internal_contents();
 }
-inline void Material::_internal_set_contents(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Material::_internal_set_contents(uint32_t value) {
   
-  contents_ = value;
+  _impl_.contents_ = value;
 }
-inline void Material::set_contents(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Material::set_contents(uint32_t value) {
   _internal_set_contents(value);
   // @@protoc_insertion_point(field_set:Analytics.Material.contents)
 }
 
 // uint32 surfaceFlags = 3 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.enumflags) = true];
 inline void Material::clear_surfaceflags() {
-  surfaceflags_ = 0u;
+  _impl_.surfaceflags_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Material::_internal_surfaceflags() const {
-  return surfaceflags_;
+inline uint32_t Material::_internal_surfaceflags() const {
+  return _impl_.surfaceflags_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Material::surfaceflags() const {
+inline uint32_t Material::surfaceflags() const {
   // @@protoc_insertion_point(field_get:Analytics.Material.surfaceFlags)
   return _internal_surfaceflags();
 }
-inline void Material::_internal_set_surfaceflags(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Material::_internal_set_surfaceflags(uint32_t value) {
   
-  surfaceflags_ = value;
+  _impl_.surfaceflags_ = value;
 }
-inline void Material::set_surfaceflags(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Material::set_surfaceflags(uint32_t value) {
   _internal_set_surfaceflags(value);
   // @@protoc_insertion_point(field_set:Analytics.Material.surfaceFlags)
 }
 
 // bool renderEvents = 4;
 inline void Material::clear_renderevents() {
-  renderevents_ = false;
+  _impl_.renderevents_ = false;
 }
 inline bool Material::_internal_renderevents() const {
-  return renderevents_;
+  return _impl_.renderevents_;
 }
 inline bool Material::renderevents() const {
   // @@protoc_insertion_point(field_get:Analytics.Material.renderEvents)
@@ -7742,7 +9448,7 @@ inline bool Material::renderevents() const {
 }
 inline void Material::_internal_set_renderevents(bool value) {
   
-  renderevents_ = value;
+  _impl_.renderevents_ = value;
 }
 inline void Material::set_renderevents(bool value) {
   _internal_set_renderevents(value);
@@ -7755,40 +9461,40 @@ inline void Material::set_renderevents(bool value) {
 
 // uint32 partIndex = 1 [(.Analytics.editable_key) = true];
 inline void PrimitiveOptions::clear_partindex() {
-  partindex_ = 0u;
+  _impl_.partindex_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 PrimitiveOptions::_internal_partindex() const {
-  return partindex_;
+inline uint32_t PrimitiveOptions::_internal_partindex() const {
+  return _impl_.partindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 PrimitiveOptions::partindex() const {
+inline uint32_t PrimitiveOptions::partindex() const {
   // @@protoc_insertion_point(field_get:Analytics.PrimitiveOptions.partIndex)
   return _internal_partindex();
 }
-inline void PrimitiveOptions::_internal_set_partindex(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void PrimitiveOptions::_internal_set_partindex(uint32_t value) {
   
-  partindex_ = value;
+  _impl_.partindex_ = value;
 }
-inline void PrimitiveOptions::set_partindex(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void PrimitiveOptions::set_partindex(uint32_t value) {
   _internal_set_partindex(value);
   // @@protoc_insertion_point(field_set:Analytics.PrimitiveOptions.partIndex)
 }
 
 // uint32 overrideSurfaceFlags = 2 [(.Analytics.enumkey) = "SURFACE_FLAGS", (.Analytics.editable) = true, (.Analytics.enumflags) = true];
 inline void PrimitiveOptions::clear_overridesurfaceflags() {
-  overridesurfaceflags_ = 0u;
+  _impl_.overridesurfaceflags_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 PrimitiveOptions::_internal_overridesurfaceflags() const {
-  return overridesurfaceflags_;
+inline uint32_t PrimitiveOptions::_internal_overridesurfaceflags() const {
+  return _impl_.overridesurfaceflags_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 PrimitiveOptions::overridesurfaceflags() const {
+inline uint32_t PrimitiveOptions::overridesurfaceflags() const {
   // @@protoc_insertion_point(field_get:Analytics.PrimitiveOptions.overrideSurfaceFlags)
   return _internal_overridesurfaceflags();
 }
-inline void PrimitiveOptions::_internal_set_overridesurfaceflags(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void PrimitiveOptions::_internal_set_overridesurfaceflags(uint32_t value) {
   
-  overridesurfaceflags_ = value;
+  _impl_.overridesurfaceflags_ = value;
 }
-inline void PrimitiveOptions::set_overridesurfaceflags(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void PrimitiveOptions::set_overridesurfaceflags(uint32_t value) {
   _internal_set_overridesurfaceflags(value);
   // @@protoc_insertion_point(field_set:Analytics.PrimitiveOptions.overrideSurfaceFlags)
 }
@@ -7799,10 +9505,10 @@ inline void PrimitiveOptions::set_overridesurfaceflags(::PROTOBUF_NAMESPACE_ID::
 
 // .Analytics.PrimitiveType type = 1;
 inline void Primitive::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
 }
 inline ::Analytics::PrimitiveType Primitive::_internal_type() const {
-  return static_cast< ::Analytics::PrimitiveType >(type_);
+  return static_cast< ::Analytics::PrimitiveType >(_impl_.type_);
 }
 inline ::Analytics::PrimitiveType Primitive::type() const {
   // @@protoc_insertion_point(field_get:Analytics.Primitive.type)
@@ -7810,7 +9516,7 @@ inline ::Analytics::PrimitiveType Primitive::type() const {
 }
 inline void Primitive::_internal_set_type(::Analytics::PrimitiveType value) {
   
-  type_ = value;
+  _impl_.type_ = value;
 }
 inline void Primitive::set_type(::Analytics::PrimitiveType value) {
   _internal_set_type(value);
@@ -7819,72 +9525,102 @@ inline void Primitive::set_type(::Analytics::PrimitiveType value) {
 
 // uint32 materialIndex = 2;
 inline void Primitive::clear_materialindex() {
-  materialindex_ = 0u;
+  _impl_.materialindex_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::_internal_materialindex() const {
-  return materialindex_;
+inline uint32_t Primitive::_internal_materialindex() const {
+  return _impl_.materialindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Primitive::materialindex() const {
+inline uint32_t Primitive::materialindex() const {
   // @@protoc_insertion_point(field_get:Analytics.Primitive.materialIndex)
   return _internal_materialindex();
 }
-inline void Primitive::_internal_set_materialindex(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Primitive::_internal_set_materialindex(uint32_t value) {
   
-  materialindex_ = value;
+  _impl_.materialindex_ = value;
 }
-inline void Primitive::set_materialindex(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Primitive::set_materialindex(uint32_t value) {
   _internal_set_materialindex(value);
   // @@protoc_insertion_point(field_set:Analytics.Primitive.materialIndex)
 }
 
 // .Analytics.PrimitiveOptions options = 3;
 inline bool Primitive::_internal_has_options() const {
-  return this != internal_default_instance() && options_ != nullptr;
+  return this != internal_default_instance() && _impl_.options_ != nullptr;
 }
 inline bool Primitive::has_options() const {
   return _internal_has_options();
 }
 inline void Primitive::clear_options() {
-  if (GetArenaNoVirtual() == nullptr && options_ != nullptr) {
-    delete options_;
+  if (GetArenaForAllocation() == nullptr && _impl_.options_ != nullptr) {
+    delete _impl_.options_;
   }
-  options_ = nullptr;
+  _impl_.options_ = nullptr;
 }
 inline const ::Analytics::PrimitiveOptions& Primitive::_internal_options() const {
-  const ::Analytics::PrimitiveOptions* p = options_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::PrimitiveOptions*>(
-      &::Analytics::_PrimitiveOptions_default_instance_);
+  const ::Analytics::PrimitiveOptions* p = _impl_.options_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::PrimitiveOptions&>(
+      ::Analytics::_PrimitiveOptions_default_instance_);
 }
 inline const ::Analytics::PrimitiveOptions& Primitive::options() const {
   // @@protoc_insertion_point(field_get:Analytics.Primitive.options)
   return _internal_options();
 }
+inline void Primitive::unsafe_arena_set_allocated_options(
+    ::Analytics::PrimitiveOptions* options) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.options_);
+  }
+  _impl_.options_ = options;
+  if (options) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.Primitive.options)
+}
 inline ::Analytics::PrimitiveOptions* Primitive::release_options() {
+  
+  ::Analytics::PrimitiveOptions* temp = _impl_.options_;
+  _impl_.options_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::PrimitiveOptions* Primitive::unsafe_arena_release_options() {
   // @@protoc_insertion_point(field_release:Analytics.Primitive.options)
   
-  ::Analytics::PrimitiveOptions* temp = options_;
-  options_ = nullptr;
+  ::Analytics::PrimitiveOptions* temp = _impl_.options_;
+  _impl_.options_ = nullptr;
   return temp;
 }
 inline ::Analytics::PrimitiveOptions* Primitive::_internal_mutable_options() {
   
-  if (options_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::PrimitiveOptions>(GetArenaNoVirtual());
-    options_ = p;
+  if (_impl_.options_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::PrimitiveOptions>(GetArenaForAllocation());
+    _impl_.options_ = p;
   }
-  return options_;
+  return _impl_.options_;
 }
 inline ::Analytics::PrimitiveOptions* Primitive::mutable_options() {
+  ::Analytics::PrimitiveOptions* _msg = _internal_mutable_options();
   // @@protoc_insertion_point(field_mutable:Analytics.Primitive.options)
-  return _internal_mutable_options();
+  return _msg;
 }
 inline void Primitive::set_allocated_options(::Analytics::PrimitiveOptions* options) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete options_;
+    delete _impl_.options_;
   }
   if (options) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(options);
     if (message_arena != submessage_arena) {
       options = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, options, submessage_arena);
@@ -7893,16 +9629,16 @@ inline void Primitive::set_allocated_options(::Analytics::PrimitiveOptions* opti
   } else {
     
   }
-  options_ = options;
+  _impl_.options_ = options;
   // @@protoc_insertion_point(field_set_allocated:Analytics.Primitive.options)
 }
 
 // float size = 4;
 inline void Primitive::clear_size() {
-  size_ = 0;
+  _impl_.size_ = 0;
 }
 inline float Primitive::_internal_size() const {
-  return size_;
+  return _impl_.size_;
 }
 inline float Primitive::size() const {
   // @@protoc_insertion_point(field_get:Analytics.Primitive.size)
@@ -7910,7 +9646,7 @@ inline float Primitive::size() const {
 }
 inline void Primitive::_internal_set_size(float value) {
   
-  size_ = value;
+  _impl_.size_ = value;
 }
 inline void Primitive::set_size(float value) {
   _internal_set_size(value);
@@ -7919,41 +9655,42 @@ inline void Primitive::set_size(float value) {
 
 // repeated .Analytics.Vec3Color vertices = 5;
 inline int Primitive::_internal_vertices_size() const {
-  return vertices_.size();
+  return _impl_.vertices_.size();
 }
 inline int Primitive::vertices_size() const {
   return _internal_vertices_size();
 }
 inline void Primitive::clear_vertices() {
-  vertices_.Clear();
+  _impl_.vertices_.Clear();
 }
 inline ::Analytics::Vec3Color* Primitive::mutable_vertices(int index) {
   // @@protoc_insertion_point(field_mutable:Analytics.Primitive.vertices)
-  return vertices_.Mutable(index);
+  return _impl_.vertices_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Vec3Color >*
 Primitive::mutable_vertices() {
   // @@protoc_insertion_point(field_mutable_list:Analytics.Primitive.vertices)
-  return &vertices_;
+  return &_impl_.vertices_;
 }
 inline const ::Analytics::Vec3Color& Primitive::_internal_vertices(int index) const {
-  return vertices_.Get(index);
+  return _impl_.vertices_.Get(index);
 }
 inline const ::Analytics::Vec3Color& Primitive::vertices(int index) const {
   // @@protoc_insertion_point(field_get:Analytics.Primitive.vertices)
   return _internal_vertices(index);
 }
 inline ::Analytics::Vec3Color* Primitive::_internal_add_vertices() {
-  return vertices_.Add();
+  return _impl_.vertices_.Add();
 }
 inline ::Analytics::Vec3Color* Primitive::add_vertices() {
+  ::Analytics::Vec3Color* _add = _internal_add_vertices();
   // @@protoc_insertion_point(field_add:Analytics.Primitive.vertices)
-  return _internal_add_vertices();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Vec3Color >&
 Primitive::vertices() const {
   // @@protoc_insertion_point(field_list:Analytics.Primitive.vertices)
-  return vertices_;
+  return _impl_.vertices_;
 }
 
 // -------------------------------------------------------------------
@@ -7962,131 +9699,118 @@ Primitive::vertices() const {
 
 // repeated .Analytics.Primitive primitives = 1;
 inline int Mesh::_internal_primitives_size() const {
-  return primitives_.size();
+  return _impl_.primitives_.size();
 }
 inline int Mesh::primitives_size() const {
   return _internal_primitives_size();
 }
 inline void Mesh::clear_primitives() {
-  primitives_.Clear();
+  _impl_.primitives_.Clear();
 }
 inline ::Analytics::Primitive* Mesh::mutable_primitives(int index) {
   // @@protoc_insertion_point(field_mutable:Analytics.Mesh.primitives)
-  return primitives_.Mutable(index);
+  return _impl_.primitives_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Primitive >*
 Mesh::mutable_primitives() {
   // @@protoc_insertion_point(field_mutable_list:Analytics.Mesh.primitives)
-  return &primitives_;
+  return &_impl_.primitives_;
 }
 inline const ::Analytics::Primitive& Mesh::_internal_primitives(int index) const {
-  return primitives_.Get(index);
+  return _impl_.primitives_.Get(index);
 }
 inline const ::Analytics::Primitive& Mesh::primitives(int index) const {
   // @@protoc_insertion_point(field_get:Analytics.Mesh.primitives)
   return _internal_primitives(index);
 }
 inline ::Analytics::Primitive* Mesh::_internal_add_primitives() {
-  return primitives_.Add();
+  return _impl_.primitives_.Add();
 }
 inline ::Analytics::Primitive* Mesh::add_primitives() {
+  ::Analytics::Primitive* _add = _internal_add_primitives();
   // @@protoc_insertion_point(field_add:Analytics.Mesh.primitives)
-  return _internal_add_primitives();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Primitive >&
 Mesh::primitives() const {
   // @@protoc_insertion_point(field_list:Analytics.Mesh.primitives)
-  return primitives_;
+  return _impl_.primitives_;
 }
 
 // repeated .Analytics.Material materials = 2;
 inline int Mesh::_internal_materials_size() const {
-  return materials_.size();
+  return _impl_.materials_.size();
 }
 inline int Mesh::materials_size() const {
   return _internal_materials_size();
 }
 inline void Mesh::clear_materials() {
-  materials_.Clear();
+  _impl_.materials_.Clear();
 }
 inline ::Analytics::Material* Mesh::mutable_materials(int index) {
   // @@protoc_insertion_point(field_mutable:Analytics.Mesh.materials)
-  return materials_.Mutable(index);
+  return _impl_.materials_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Material >*
 Mesh::mutable_materials() {
   // @@protoc_insertion_point(field_mutable_list:Analytics.Mesh.materials)
-  return &materials_;
+  return &_impl_.materials_;
 }
 inline const ::Analytics::Material& Mesh::_internal_materials(int index) const {
-  return materials_.Get(index);
+  return _impl_.materials_.Get(index);
 }
 inline const ::Analytics::Material& Mesh::materials(int index) const {
   // @@protoc_insertion_point(field_get:Analytics.Mesh.materials)
   return _internal_materials(index);
 }
 inline ::Analytics::Material* Mesh::_internal_add_materials() {
-  return materials_.Add();
+  return _impl_.materials_.Add();
 }
 inline ::Analytics::Material* Mesh::add_materials() {
+  ::Analytics::Material* _add = _internal_add_materials();
   // @@protoc_insertion_point(field_add:Analytics.Mesh.materials)
-  return _internal_add_materials();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::Material >&
 Mesh::materials() const {
   // @@protoc_insertion_point(field_list:Analytics.Mesh.materials)
-  return materials_;
+  return _impl_.materials_;
 }
 
 // string name = 3;
 inline void Mesh::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& Mesh::name() const {
   // @@protoc_insertion_point(field_get:Analytics.Mesh.name)
   return _internal_name();
 }
-inline void Mesh::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Mesh::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.Mesh.name)
 }
 inline std::string* Mesh::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:Analytics.Mesh.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& Mesh::_internal_name() const {
-  return name_.GetNoArena();
+  return _impl_.name_.Get();
 }
 inline void Mesh::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void Mesh::set_name(std::string&& value) {
-  
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.Mesh.name)
-}
-inline void Mesh::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.Mesh.name)
-}
-inline void Mesh::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.Mesh.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Mesh::_internal_mutable_name() {
   
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Mesh::release_name() {
   // @@protoc_insertion_point(field_release:Analytics.Mesh.name)
-  
-  return name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
 inline void Mesh::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -8094,7 +9818,12 @@ inline void Mesh::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.Mesh.name)
 }
 
@@ -8104,120 +9833,120 @@ inline void Mesh::set_allocated_name(std::string* name) {
 
 // int32 hour = 1;
 inline void UTCTime::clear_hour() {
-  hour_ = 0;
+  _impl_.hour_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::_internal_hour() const {
-  return hour_;
+inline int32_t UTCTime::_internal_hour() const {
+  return _impl_.hour_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::hour() const {
+inline int32_t UTCTime::hour() const {
   // @@protoc_insertion_point(field_get:Analytics.UTCTime.hour)
   return _internal_hour();
 }
-inline void UTCTime::_internal_set_hour(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::_internal_set_hour(int32_t value) {
   
-  hour_ = value;
+  _impl_.hour_ = value;
 }
-inline void UTCTime::set_hour(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::set_hour(int32_t value) {
   _internal_set_hour(value);
   // @@protoc_insertion_point(field_set:Analytics.UTCTime.hour)
 }
 
 // int32 minute = 2;
 inline void UTCTime::clear_minute() {
-  minute_ = 0;
+  _impl_.minute_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::_internal_minute() const {
-  return minute_;
+inline int32_t UTCTime::_internal_minute() const {
+  return _impl_.minute_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::minute() const {
+inline int32_t UTCTime::minute() const {
   // @@protoc_insertion_point(field_get:Analytics.UTCTime.minute)
   return _internal_minute();
 }
-inline void UTCTime::_internal_set_minute(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::_internal_set_minute(int32_t value) {
   
-  minute_ = value;
+  _impl_.minute_ = value;
 }
-inline void UTCTime::set_minute(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::set_minute(int32_t value) {
   _internal_set_minute(value);
   // @@protoc_insertion_point(field_set:Analytics.UTCTime.minute)
 }
 
 // int32 second = 3;
 inline void UTCTime::clear_second() {
-  second_ = 0;
+  _impl_.second_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::_internal_second() const {
-  return second_;
+inline int32_t UTCTime::_internal_second() const {
+  return _impl_.second_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::second() const {
+inline int32_t UTCTime::second() const {
   // @@protoc_insertion_point(field_get:Analytics.UTCTime.second)
   return _internal_second();
 }
-inline void UTCTime::_internal_set_second(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::_internal_set_second(int32_t value) {
   
-  second_ = value;
+  _impl_.second_ = value;
 }
-inline void UTCTime::set_second(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::set_second(int32_t value) {
   _internal_set_second(value);
   // @@protoc_insertion_point(field_set:Analytics.UTCTime.second)
 }
 
 // int32 day = 4;
 inline void UTCTime::clear_day() {
-  day_ = 0;
+  _impl_.day_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::_internal_day() const {
-  return day_;
+inline int32_t UTCTime::_internal_day() const {
+  return _impl_.day_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::day() const {
+inline int32_t UTCTime::day() const {
   // @@protoc_insertion_point(field_get:Analytics.UTCTime.day)
   return _internal_day();
 }
-inline void UTCTime::_internal_set_day(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::_internal_set_day(int32_t value) {
   
-  day_ = value;
+  _impl_.day_ = value;
 }
-inline void UTCTime::set_day(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::set_day(int32_t value) {
   _internal_set_day(value);
   // @@protoc_insertion_point(field_set:Analytics.UTCTime.day)
 }
 
 // int32 month = 5;
 inline void UTCTime::clear_month() {
-  month_ = 0;
+  _impl_.month_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::_internal_month() const {
-  return month_;
+inline int32_t UTCTime::_internal_month() const {
+  return _impl_.month_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::month() const {
+inline int32_t UTCTime::month() const {
   // @@protoc_insertion_point(field_get:Analytics.UTCTime.month)
   return _internal_month();
 }
-inline void UTCTime::_internal_set_month(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::_internal_set_month(int32_t value) {
   
-  month_ = value;
+  _impl_.month_ = value;
 }
-inline void UTCTime::set_month(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::set_month(int32_t value) {
   _internal_set_month(value);
   // @@protoc_insertion_point(field_set:Analytics.UTCTime.month)
 }
 
 // int32 year = 6;
 inline void UTCTime::clear_year() {
-  year_ = 0;
+  _impl_.year_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::_internal_year() const {
-  return year_;
+inline int32_t UTCTime::_internal_year() const {
+  return _impl_.year_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 UTCTime::year() const {
+inline int32_t UTCTime::year() const {
   // @@protoc_insertion_point(field_get:Analytics.UTCTime.year)
   return _internal_year();
 }
-inline void UTCTime::_internal_set_year(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::_internal_set_year(int32_t value) {
   
-  year_ = value;
+  _impl_.year_ = value;
 }
-inline void UTCTime::set_year(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void UTCTime::set_year(int32_t value) {
   _internal_set_year(value);
   // @@protoc_insertion_point(field_set:Analytics.UTCTime.year)
 }
@@ -8228,52 +9957,82 @@ inline void UTCTime::set_year(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // .Analytics.UTCTime timeStamp = 1;
 inline bool GameInfo::_internal_has_timestamp() const {
-  return this != internal_default_instance() && timestamp_ != nullptr;
+  return this != internal_default_instance() && _impl_.timestamp_ != nullptr;
 }
 inline bool GameInfo::has_timestamp() const {
   return _internal_has_timestamp();
 }
 inline void GameInfo::clear_timestamp() {
-  if (GetArenaNoVirtual() == nullptr && timestamp_ != nullptr) {
-    delete timestamp_;
+  if (GetArenaForAllocation() == nullptr && _impl_.timestamp_ != nullptr) {
+    delete _impl_.timestamp_;
   }
-  timestamp_ = nullptr;
+  _impl_.timestamp_ = nullptr;
 }
 inline const ::Analytics::UTCTime& GameInfo::_internal_timestamp() const {
-  const ::Analytics::UTCTime* p = timestamp_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::UTCTime*>(
-      &::Analytics::_UTCTime_default_instance_);
+  const ::Analytics::UTCTime* p = _impl_.timestamp_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::UTCTime&>(
+      ::Analytics::_UTCTime_default_instance_);
 }
 inline const ::Analytics::UTCTime& GameInfo::timestamp() const {
   // @@protoc_insertion_point(field_get:Analytics.GameInfo.timeStamp)
   return _internal_timestamp();
 }
+inline void GameInfo::unsafe_arena_set_allocated_timestamp(
+    ::Analytics::UTCTime* timestamp) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.timestamp_);
+  }
+  _impl_.timestamp_ = timestamp;
+  if (timestamp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameInfo.timeStamp)
+}
 inline ::Analytics::UTCTime* GameInfo::release_timestamp() {
+  
+  ::Analytics::UTCTime* temp = _impl_.timestamp_;
+  _impl_.timestamp_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::UTCTime* GameInfo::unsafe_arena_release_timestamp() {
   // @@protoc_insertion_point(field_release:Analytics.GameInfo.timeStamp)
   
-  ::Analytics::UTCTime* temp = timestamp_;
-  timestamp_ = nullptr;
+  ::Analytics::UTCTime* temp = _impl_.timestamp_;
+  _impl_.timestamp_ = nullptr;
   return temp;
 }
 inline ::Analytics::UTCTime* GameInfo::_internal_mutable_timestamp() {
   
-  if (timestamp_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::UTCTime>(GetArenaNoVirtual());
-    timestamp_ = p;
+  if (_impl_.timestamp_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::UTCTime>(GetArenaForAllocation());
+    _impl_.timestamp_ = p;
   }
-  return timestamp_;
+  return _impl_.timestamp_;
 }
 inline ::Analytics::UTCTime* GameInfo::mutable_timestamp() {
+  ::Analytics::UTCTime* _msg = _internal_mutable_timestamp();
   // @@protoc_insertion_point(field_mutable:Analytics.GameInfo.timeStamp)
-  return _internal_mutable_timestamp();
+  return _msg;
 }
 inline void GameInfo::set_allocated_timestamp(::Analytics::UTCTime* timestamp) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete timestamp_;
+    delete _impl_.timestamp_;
   }
   if (timestamp) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(timestamp);
     if (message_arena != submessage_arena) {
       timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, timestamp, submessage_arena);
@@ -8282,59 +10041,44 @@ inline void GameInfo::set_allocated_timestamp(::Analytics::UTCTime* timestamp) {
   } else {
     
   }
-  timestamp_ = timestamp;
+  _impl_.timestamp_ = timestamp;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameInfo.timeStamp)
 }
 
 // string mapName = 2;
 inline void GameInfo::clear_mapname() {
-  mapname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.mapname_.ClearToEmpty();
 }
 inline const std::string& GameInfo::mapname() const {
   // @@protoc_insertion_point(field_get:Analytics.GameInfo.mapName)
   return _internal_mapname();
 }
-inline void GameInfo::set_mapname(const std::string& value) {
-  _internal_set_mapname(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameInfo::set_mapname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.mapname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameInfo.mapName)
 }
 inline std::string* GameInfo::mutable_mapname() {
+  std::string* _s = _internal_mutable_mapname();
   // @@protoc_insertion_point(field_mutable:Analytics.GameInfo.mapName)
-  return _internal_mutable_mapname();
+  return _s;
 }
 inline const std::string& GameInfo::_internal_mapname() const {
-  return mapname_.GetNoArena();
+  return _impl_.mapname_.Get();
 }
 inline void GameInfo::_internal_set_mapname(const std::string& value) {
   
-  mapname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameInfo::set_mapname(std::string&& value) {
-  
-  mapname_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameInfo.mapName)
-}
-inline void GameInfo::set_mapname(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  mapname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameInfo.mapName)
-}
-inline void GameInfo::set_mapname(const char* value, size_t size) {
-  
-  mapname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameInfo.mapName)
+  _impl_.mapname_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameInfo::_internal_mutable_mapname() {
   
-  return mapname_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.mapname_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameInfo::release_mapname() {
   // @@protoc_insertion_point(field_release:Analytics.GameInfo.mapName)
-  
-  return mapname_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.mapname_.Release();
 }
 inline void GameInfo::set_allocated_mapname(std::string* mapname) {
   if (mapname != nullptr) {
@@ -8342,59 +10086,49 @@ inline void GameInfo::set_allocated_mapname(std::string* mapname) {
   } else {
     
   }
-  mapname_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), mapname);
+  _impl_.mapname_.SetAllocated(mapname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mapname_.IsDefault()) {
+    _impl_.mapname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameInfo.mapName)
 }
 
 // string gameName = 3;
 inline void GameInfo::clear_gamename() {
-  gamename_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.gamename_.ClearToEmpty();
 }
 inline const std::string& GameInfo::gamename() const {
   // @@protoc_insertion_point(field_get:Analytics.GameInfo.gameName)
   return _internal_gamename();
 }
-inline void GameInfo::set_gamename(const std::string& value) {
-  _internal_set_gamename(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameInfo::set_gamename(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.gamename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameInfo.gameName)
 }
 inline std::string* GameInfo::mutable_gamename() {
+  std::string* _s = _internal_mutable_gamename();
   // @@protoc_insertion_point(field_mutable:Analytics.GameInfo.gameName)
-  return _internal_mutable_gamename();
+  return _s;
 }
 inline const std::string& GameInfo::_internal_gamename() const {
-  return gamename_.GetNoArena();
+  return _impl_.gamename_.Get();
 }
 inline void GameInfo::_internal_set_gamename(const std::string& value) {
   
-  gamename_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameInfo::set_gamename(std::string&& value) {
-  
-  gamename_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameInfo.gameName)
-}
-inline void GameInfo::set_gamename(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  gamename_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameInfo.gameName)
-}
-inline void GameInfo::set_gamename(const char* value, size_t size) {
-  
-  gamename_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameInfo.gameName)
+  _impl_.gamename_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameInfo::_internal_mutable_gamename() {
   
-  return gamename_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.gamename_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameInfo::release_gamename() {
   // @@protoc_insertion_point(field_release:Analytics.GameInfo.gameName)
-  
-  return gamename_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.gamename_.Release();
 }
 inline void GameInfo::set_allocated_gamename(std::string* gamename) {
   if (gamename != nullptr) {
@@ -8402,68 +10136,243 @@ inline void GameInfo::set_allocated_gamename(std::string* gamename) {
   } else {
     
   }
-  gamename_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), gamename);
+  _impl_.gamename_.SetAllocated(gamename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.gamename_.IsDefault()) {
+    _impl_.gamename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameInfo.gameName)
 }
 
 // string gameVersion = 4;
 inline void GameInfo::clear_gameversion() {
-  gameversion_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.gameversion_.ClearToEmpty();
 }
 inline const std::string& GameInfo::gameversion() const {
   // @@protoc_insertion_point(field_get:Analytics.GameInfo.gameVersion)
   return _internal_gameversion();
 }
-inline void GameInfo::set_gameversion(const std::string& value) {
-  _internal_set_gameversion(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameInfo::set_gameversion(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.gameversion_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameInfo.gameVersion)
 }
 inline std::string* GameInfo::mutable_gameversion() {
+  std::string* _s = _internal_mutable_gameversion();
   // @@protoc_insertion_point(field_mutable:Analytics.GameInfo.gameVersion)
-  return _internal_mutable_gameversion();
+  return _s;
+}
+inline const std::string& GameInfo::_internal_gameversion() const {
+  return _impl_.gameversion_.Get();
+}
+inline void GameInfo::_internal_set_gameversion(const std::string& value) {
+  
+  _impl_.gameversion_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GameInfo::_internal_mutable_gameversion() {
+  
+  return _impl_.gameversion_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameInfo::release_gameversion() {
+  // @@protoc_insertion_point(field_release:Analytics.GameInfo.gameVersion)
+  return _impl_.gameversion_.Release();
+}
+inline void GameInfo::set_allocated_gameversion(std::string* gameversion) {
+  if (gameversion != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.gameversion_.SetAllocated(gameversion, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.gameversion_.IsDefault()) {
+    _impl_.gameversion_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Analytics.GameInfo.gameVersion)
+}
+
+// .Analytics.Vec3 worldMins = 5;
+inline bool GameInfo::_internal_has_worldmins() const {
+  return this != internal_default_instance() && _impl_.worldmins_ != nullptr;
+}
+inline bool GameInfo::has_worldmins() const {
+  return _internal_has_worldmins();
+}
+inline void GameInfo::clear_worldmins() {
+  if (GetArenaForAllocation() == nullptr && _impl_.worldmins_ != nullptr) {
+    delete _impl_.worldmins_;
+  }
+  _impl_.worldmins_ = nullptr;
+}
+inline const ::Analytics::Vec3& GameInfo::_internal_worldmins() const {
+  const ::Analytics::Vec3* p = _impl_.worldmins_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
+}
+inline const ::Analytics::Vec3& GameInfo::worldmins() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameInfo.worldMins)
+  return _internal_worldmins();
+}
+inline void GameInfo::unsafe_arena_set_allocated_worldmins(
+    ::Analytics::Vec3* worldmins) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.worldmins_);
+  }
+  _impl_.worldmins_ = worldmins;
+  if (worldmins) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameInfo.worldMins)
+}
+inline ::Analytics::Vec3* GameInfo::release_worldmins() {
+  
+  ::Analytics::Vec3* temp = _impl_.worldmins_;
+  _impl_.worldmins_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameInfo::unsafe_arena_release_worldmins() {
+  // @@protoc_insertion_point(field_release:Analytics.GameInfo.worldMins)
+  
+  ::Analytics::Vec3* temp = _impl_.worldmins_;
+  _impl_.worldmins_ = nullptr;
+  return temp;
+}
+inline ::Analytics::Vec3* GameInfo::_internal_mutable_worldmins() {
+  
+  if (_impl_.worldmins_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.worldmins_ = p;
+  }
+  return _impl_.worldmins_;
+}
+inline ::Analytics::Vec3* GameInfo::mutable_worldmins() {
+  ::Analytics::Vec3* _msg = _internal_mutable_worldmins();
+  // @@protoc_insertion_point(field_mutable:Analytics.GameInfo.worldMins)
+  return _msg;
+}
+inline void GameInfo::set_allocated_worldmins(::Analytics::Vec3* worldmins) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.worldmins_;
+  }
+  if (worldmins) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(worldmins);
+    if (message_arena != submessage_arena) {
+      worldmins = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, worldmins, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.worldmins_ = worldmins;
+  // @@protoc_insertion_point(field_set_allocated:Analytics.GameInfo.worldMins)
+}
+
+// .Analytics.Vec3 worldMaxs = 6;
+inline bool GameInfo::_internal_has_worldmaxs() const {
+  return this != internal_default_instance() && _impl_.worldmaxs_ != nullptr;
+}
+inline bool GameInfo::has_worldmaxs() const {
+  return _internal_has_worldmaxs();
 }
-inline const std::string& GameInfo::_internal_gameversion() const {
-  return gameversion_.GetNoArena();
+inline void GameInfo::clear_worldmaxs() {
+  if (GetArenaForAllocation() == nullptr && _impl_.worldmaxs_ != nullptr) {
+    delete _impl_.worldmaxs_;
+  }
+  _impl_.worldmaxs_ = nullptr;
 }
-inline void GameInfo::_internal_set_gameversion(const std::string& value) {
-  
-  gameversion_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+inline const ::Analytics::Vec3& GameInfo::_internal_worldmaxs() const {
+  const ::Analytics::Vec3* p = _impl_.worldmaxs_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
-inline void GameInfo::set_gameversion(std::string&& value) {
-  
-  gameversion_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameInfo.gameVersion)
+inline const ::Analytics::Vec3& GameInfo::worldmaxs() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameInfo.worldMaxs)
+  return _internal_worldmaxs();
 }
-inline void GameInfo::set_gameversion(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  gameversion_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameInfo.gameVersion)
+inline void GameInfo::unsafe_arena_set_allocated_worldmaxs(
+    ::Analytics::Vec3* worldmaxs) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.worldmaxs_);
+  }
+  _impl_.worldmaxs_ = worldmaxs;
+  if (worldmaxs) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameInfo.worldMaxs)
 }
-inline void GameInfo::set_gameversion(const char* value, size_t size) {
+inline ::Analytics::Vec3* GameInfo::release_worldmaxs() {
   
-  gameversion_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameInfo.gameVersion)
+  ::Analytics::Vec3* temp = _impl_.worldmaxs_;
+  _impl_.worldmaxs_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* GameInfo::_internal_mutable_gameversion() {
+inline ::Analytics::Vec3* GameInfo::unsafe_arena_release_worldmaxs() {
+  // @@protoc_insertion_point(field_release:Analytics.GameInfo.worldMaxs)
   
-  return gameversion_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::Analytics::Vec3* temp = _impl_.worldmaxs_;
+  _impl_.worldmaxs_ = nullptr;
+  return temp;
 }
-inline std::string* GameInfo::release_gameversion() {
-  // @@protoc_insertion_point(field_release:Analytics.GameInfo.gameVersion)
+inline ::Analytics::Vec3* GameInfo::_internal_mutable_worldmaxs() {
   
-  return gameversion_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.worldmaxs_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.worldmaxs_ = p;
+  }
+  return _impl_.worldmaxs_;
 }
-inline void GameInfo::set_allocated_gameversion(std::string* gameversion) {
-  if (gameversion != nullptr) {
+inline ::Analytics::Vec3* GameInfo::mutable_worldmaxs() {
+  ::Analytics::Vec3* _msg = _internal_mutable_worldmaxs();
+  // @@protoc_insertion_point(field_mutable:Analytics.GameInfo.worldMaxs)
+  return _msg;
+}
+inline void GameInfo::set_allocated_worldmaxs(::Analytics::Vec3* worldmaxs) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.worldmaxs_;
+  }
+  if (worldmaxs) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(worldmaxs);
+    if (message_arena != submessage_arena) {
+      worldmaxs = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, worldmaxs, submessage_arena);
+    }
     
   } else {
     
   }
-  gameversion_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), gameversion);
-  // @@protoc_insertion_point(field_set_allocated:Analytics.GameInfo.gameVersion)
+  _impl_.worldmaxs_ = worldmaxs;
+  // @@protoc_insertion_point(field_set_allocated:Analytics.GameInfo.worldMaxs)
 }
 
 // -------------------------------------------------------------------
@@ -8472,53 +10381,38 @@ inline void GameInfo::set_allocated_gameversion(std::string* gameversion) {
 
 // string name = 1;
 inline void GameEnum_EnumPair::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& GameEnum_EnumPair::name() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEnum.EnumPair.name)
   return _internal_name();
 }
-inline void GameEnum_EnumPair::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameEnum_EnumPair::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameEnum.EnumPair.name)
 }
 inline std::string* GameEnum_EnumPair::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEnum.EnumPair.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& GameEnum_EnumPair::_internal_name() const {
-  return name_.GetNoArena();
+  return _impl_.name_.Get();
 }
 inline void GameEnum_EnumPair::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameEnum_EnumPair::set_name(std::string&& value) {
-  
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameEnum.EnumPair.name)
-}
-inline void GameEnum_EnumPair::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameEnum.EnumPair.name)
-}
-inline void GameEnum_EnumPair::set_name(const char* value, size_t size) {
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameEnum.EnumPair.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameEnum_EnumPair::_internal_mutable_name() {
   
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameEnum_EnumPair::release_name() {
   // @@protoc_insertion_point(field_release:Analytics.GameEnum.EnumPair.name)
-  
-  return name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
 inline void GameEnum_EnumPair::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -8526,26 +10420,31 @@ inline void GameEnum_EnumPair::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEnum.EnumPair.name)
 }
 
 // int64 value = 2;
 inline void GameEnum_EnumPair::clear_value() {
-  value_ = PROTOBUF_LONGLONG(0);
+  _impl_.value_ = int64_t{0};
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 GameEnum_EnumPair::_internal_value() const {
-  return value_;
+inline int64_t GameEnum_EnumPair::_internal_value() const {
+  return _impl_.value_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 GameEnum_EnumPair::value() const {
+inline int64_t GameEnum_EnumPair::value() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEnum.EnumPair.value)
   return _internal_value();
 }
-inline void GameEnum_EnumPair::_internal_set_value(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void GameEnum_EnumPair::_internal_set_value(int64_t value) {
   
-  value_ = value;
+  _impl_.value_ = value;
 }
-inline void GameEnum_EnumPair::set_value(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void GameEnum_EnumPair::set_value(int64_t value) {
   _internal_set_value(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEnum.EnumPair.value)
 }
@@ -8556,92 +10455,78 @@ inline void GameEnum_EnumPair::set_value(::PROTOBUF_NAMESPACE_ID::int64 value) {
 
 // repeated .Analytics.GameEnum.EnumPair values = 1;
 inline int GameEnum::_internal_values_size() const {
-  return values_.size();
+  return _impl_.values_.size();
 }
 inline int GameEnum::values_size() const {
   return _internal_values_size();
 }
 inline void GameEnum::clear_values() {
-  values_.Clear();
+  _impl_.values_.Clear();
 }
 inline ::Analytics::GameEnum_EnumPair* GameEnum::mutable_values(int index) {
   // @@protoc_insertion_point(field_mutable:Analytics.GameEnum.values)
-  return values_.Mutable(index);
+  return _impl_.values_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::GameEnum_EnumPair >*
 GameEnum::mutable_values() {
   // @@protoc_insertion_point(field_mutable_list:Analytics.GameEnum.values)
-  return &values_;
+  return &_impl_.values_;
 }
 inline const ::Analytics::GameEnum_EnumPair& GameEnum::_internal_values(int index) const {
-  return values_.Get(index);
+  return _impl_.values_.Get(index);
 }
 inline const ::Analytics::GameEnum_EnumPair& GameEnum::values(int index) const {
   // @@protoc_insertion_point(field_get:Analytics.GameEnum.values)
   return _internal_values(index);
 }
 inline ::Analytics::GameEnum_EnumPair* GameEnum::_internal_add_values() {
-  return values_.Add();
+  return _impl_.values_.Add();
 }
 inline ::Analytics::GameEnum_EnumPair* GameEnum::add_values() {
+  ::Analytics::GameEnum_EnumPair* _add = _internal_add_values();
   // @@protoc_insertion_point(field_add:Analytics.GameEnum.values)
-  return _internal_add_values();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::GameEnum_EnumPair >&
 GameEnum::values() const {
   // @@protoc_insertion_point(field_list:Analytics.GameEnum.values)
-  return values_;
+  return _impl_.values_;
 }
 
 // string enumname = 2;
 inline void GameEnum::clear_enumname() {
-  enumname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.enumname_.ClearToEmpty();
 }
 inline const std::string& GameEnum::enumname() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEnum.enumname)
   return _internal_enumname();
 }
-inline void GameEnum::set_enumname(const std::string& value) {
-  _internal_set_enumname(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameEnum::set_enumname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.enumname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameEnum.enumname)
 }
 inline std::string* GameEnum::mutable_enumname() {
+  std::string* _s = _internal_mutable_enumname();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEnum.enumname)
-  return _internal_mutable_enumname();
+  return _s;
 }
 inline const std::string& GameEnum::_internal_enumname() const {
-  return enumname_.GetNoArena();
+  return _impl_.enumname_.Get();
 }
 inline void GameEnum::_internal_set_enumname(const std::string& value) {
   
-  enumname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameEnum::set_enumname(std::string&& value) {
-  
-  enumname_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameEnum.enumname)
-}
-inline void GameEnum::set_enumname(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  enumname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameEnum.enumname)
-}
-inline void GameEnum::set_enumname(const char* value, size_t size) {
-  
-  enumname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameEnum.enumname)
+  _impl_.enumname_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameEnum::_internal_mutable_enumname() {
   
-  return enumname_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.enumname_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameEnum::release_enumname() {
   // @@protoc_insertion_point(field_release:Analytics.GameEnum.enumname)
-  
-  return enumname_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.enumname_.Release();
 }
 inline void GameEnum::set_allocated_enumname(std::string* enumname) {
   if (enumname != nullptr) {
@@ -8649,16 +10534,21 @@ inline void GameEnum::set_allocated_enumname(std::string* enumname) {
   } else {
     
   }
-  enumname_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), enumname);
+  _impl_.enumname_.SetAllocated(enumname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.enumname_.IsDefault()) {
+    _impl_.enumname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEnum.enumname)
 }
 
 // bool isbitfield = 3;
 inline void GameEnum::clear_isbitfield() {
-  isbitfield_ = false;
+  _impl_.isbitfield_ = false;
 }
 inline bool GameEnum::_internal_isbitfield() const {
-  return isbitfield_;
+  return _impl_.isbitfield_;
 }
 inline bool GameEnum::isbitfield() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEnum.isbitfield)
@@ -8666,7 +10556,7 @@ inline bool GameEnum::isbitfield() const {
 }
 inline void GameEnum::_internal_set_isbitfield(bool value) {
   
-  isbitfield_ = value;
+  _impl_.isbitfield_ = value;
 }
 inline void GameEnum::set_isbitfield(bool value) {
   _internal_set_isbitfield(value);
@@ -8675,57 +10565,530 @@ inline void GameEnum::set_isbitfield(bool value) {
 
 // -------------------------------------------------------------------
 
+// GameString
+
+// uint32 id = 1;
+inline void GameString::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t GameString::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t GameString::id() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameString.id)
+  return _internal_id();
+}
+inline void GameString::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void GameString::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameString.id)
+}
+
+// string value = 2;
+inline void GameString::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& GameString::value() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameString.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameString::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Analytics.GameString.value)
+}
+inline std::string* GameString::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:Analytics.GameString.value)
+  return _s;
+}
+inline const std::string& GameString::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void GameString::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GameString::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameString::release_value() {
+  // @@protoc_insertion_point(field_release:Analytics.GameString.value)
+  return _impl_.value_.Release();
+}
+inline void GameString::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Analytics.GameString.value)
+}
+
+// -------------------------------------------------------------------
+
+// LiveHeatmap
+
+// string eventType = 1;
+inline void LiveHeatmap::clear_eventtype() {
+  _impl_.eventtype_.ClearToEmpty();
+}
+inline const std::string& LiveHeatmap::eventtype() const {
+  // @@protoc_insertion_point(field_get:Analytics.LiveHeatmap.eventType)
+  return _internal_eventtype();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LiveHeatmap::set_eventtype(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.eventtype_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Analytics.LiveHeatmap.eventType)
+}
+inline std::string* LiveHeatmap::mutable_eventtype() {
+  std::string* _s = _internal_mutable_eventtype();
+  // @@protoc_insertion_point(field_mutable:Analytics.LiveHeatmap.eventType)
+  return _s;
+}
+inline const std::string& LiveHeatmap::_internal_eventtype() const {
+  return _impl_.eventtype_.Get();
+}
+inline void LiveHeatmap::_internal_set_eventtype(const std::string& value) {
+  
+  _impl_.eventtype_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LiveHeatmap::_internal_mutable_eventtype() {
+  
+  return _impl_.eventtype_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LiveHeatmap::release_eventtype() {
+  // @@protoc_insertion_point(field_release:Analytics.LiveHeatmap.eventType)
+  return _impl_.eventtype_.Release();
+}
+inline void LiveHeatmap::set_allocated_eventtype(std::string* eventtype) {
+  if (eventtype != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.eventtype_.SetAllocated(eventtype, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.eventtype_.IsDefault()) {
+    _impl_.eventtype_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Analytics.LiveHeatmap.eventType)
+}
+
+// string key = 2;
+inline void LiveHeatmap::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& LiveHeatmap::key() const {
+  // @@protoc_insertion_point(field_get:Analytics.LiveHeatmap.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LiveHeatmap::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Analytics.LiveHeatmap.key)
+}
+inline std::string* LiveHeatmap::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:Analytics.LiveHeatmap.key)
+  return _s;
+}
+inline const std::string& LiveHeatmap::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void LiveHeatmap::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LiveHeatmap::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LiveHeatmap::release_key() {
+  // @@protoc_insertion_point(field_release:Analytics.LiveHeatmap.key)
+  return _impl_.key_.Release();
+}
+inline void LiveHeatmap::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Analytics.LiveHeatmap.key)
+}
+
+// int64 timeStamp = 3;
+inline void LiveHeatmap::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t LiveHeatmap::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t LiveHeatmap::timestamp() const {
+  // @@protoc_insertion_point(field_get:Analytics.LiveHeatmap.timeStamp)
+  return _internal_timestamp();
+}
+inline void LiveHeatmap::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void LiveHeatmap::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:Analytics.LiveHeatmap.timeStamp)
+}
+
+// int32 width = 4;
+inline void LiveHeatmap::clear_width() {
+  _impl_.width_ = 0;
+}
+inline int32_t LiveHeatmap::_internal_width() const {
+  return _impl_.width_;
+}
+inline int32_t LiveHeatmap::width() const {
+  // @@protoc_insertion_point(field_get:Analytics.LiveHeatmap.width)
+  return _internal_width();
+}
+inline void LiveHeatmap::_internal_set_width(int32_t value) {
+  
+  _impl_.width_ = value;
+}
+inline void LiveHeatmap::set_width(int32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:Analytics.LiveHeatmap.width)
+}
+
+// int32 height = 5;
+inline void LiveHeatmap::clear_height() {
+  _impl_.height_ = 0;
+}
+inline int32_t LiveHeatmap::_internal_height() const {
+  return _impl_.height_;
+}
+inline int32_t LiveHeatmap::height() const {
+  // @@protoc_insertion_point(field_get:Analytics.LiveHeatmap.height)
+  return _internal_height();
+}
+inline void LiveHeatmap::_internal_set_height(int32_t value) {
+  
+  _impl_.height_ = value;
+}
+inline void LiveHeatmap::set_height(int32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:Analytics.LiveHeatmap.height)
+}
+
+// float maxValue = 6;
+inline void LiveHeatmap::clear_maxvalue() {
+  _impl_.maxvalue_ = 0;
+}
+inline float LiveHeatmap::_internal_maxvalue() const {
+  return _impl_.maxvalue_;
+}
+inline float LiveHeatmap::maxvalue() const {
+  // @@protoc_insertion_point(field_get:Analytics.LiveHeatmap.maxValue)
+  return _internal_maxvalue();
+}
+inline void LiveHeatmap::_internal_set_maxvalue(float value) {
+  
+  _impl_.maxvalue_ = value;
+}
+inline void LiveHeatmap::set_maxvalue(float value) {
+  _internal_set_maxvalue(value);
+  // @@protoc_insertion_point(field_set:Analytics.LiveHeatmap.maxValue)
+}
+
+// .Analytics.Vec3 worldMins = 7;
+inline bool LiveHeatmap::_internal_has_worldmins() const {
+  return this != internal_default_instance() && _impl_.worldmins_ != nullptr;
+}
+inline bool LiveHeatmap::has_worldmins() const {
+  return _internal_has_worldmins();
+}
+inline void LiveHeatmap::clear_worldmins() {
+  if (GetArenaForAllocation() == nullptr && _impl_.worldmins_ != nullptr) {
+    delete _impl_.worldmins_;
+  }
+  _impl_.worldmins_ = nullptr;
+}
+inline const ::Analytics::Vec3& LiveHeatmap::_internal_worldmins() const {
+  const ::Analytics::Vec3* p = _impl_.worldmins_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
+}
+inline const ::Analytics::Vec3& LiveHeatmap::worldmins() const {
+  // @@protoc_insertion_point(field_get:Analytics.LiveHeatmap.worldMins)
+  return _internal_worldmins();
+}
+inline void LiveHeatmap::unsafe_arena_set_allocated_worldmins(
+    ::Analytics::Vec3* worldmins) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.worldmins_);
+  }
+  _impl_.worldmins_ = worldmins;
+  if (worldmins) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.LiveHeatmap.worldMins)
+}
+inline ::Analytics::Vec3* LiveHeatmap::release_worldmins() {
+  
+  ::Analytics::Vec3* temp = _impl_.worldmins_;
+  _impl_.worldmins_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* LiveHeatmap::unsafe_arena_release_worldmins() {
+  // @@protoc_insertion_point(field_release:Analytics.LiveHeatmap.worldMins)
+  
+  ::Analytics::Vec3* temp = _impl_.worldmins_;
+  _impl_.worldmins_ = nullptr;
+  return temp;
+}
+inline ::Analytics::Vec3* LiveHeatmap::_internal_mutable_worldmins() {
+  
+  if (_impl_.worldmins_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.worldmins_ = p;
+  }
+  return _impl_.worldmins_;
+}
+inline ::Analytics::Vec3* LiveHeatmap::mutable_worldmins() {
+  ::Analytics::Vec3* _msg = _internal_mutable_worldmins();
+  // @@protoc_insertion_point(field_mutable:Analytics.LiveHeatmap.worldMins)
+  return _msg;
+}
+inline void LiveHeatmap::set_allocated_worldmins(::Analytics::Vec3* worldmins) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.worldmins_;
+  }
+  if (worldmins) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(worldmins);
+    if (message_arena != submessage_arena) {
+      worldmins = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, worldmins, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.worldmins_ = worldmins;
+  // @@protoc_insertion_point(field_set_allocated:Analytics.LiveHeatmap.worldMins)
+}
+
+// .Analytics.Vec3 worldMaxs = 8;
+inline bool LiveHeatmap::_internal_has_worldmaxs() const {
+  return this != internal_default_instance() && _impl_.worldmaxs_ != nullptr;
+}
+inline bool LiveHeatmap::has_worldmaxs() const {
+  return _internal_has_worldmaxs();
+}
+inline void LiveHeatmap::clear_worldmaxs() {
+  if (GetArenaForAllocation() == nullptr && _impl_.worldmaxs_ != nullptr) {
+    delete _impl_.worldmaxs_;
+  }
+  _impl_.worldmaxs_ = nullptr;
+}
+inline const ::Analytics::Vec3& LiveHeatmap::_internal_worldmaxs() const {
+  const ::Analytics::Vec3* p = _impl_.worldmaxs_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
+}
+inline const ::Analytics::Vec3& LiveHeatmap::worldmaxs() const {
+  // @@protoc_insertion_point(field_get:Analytics.LiveHeatmap.worldMaxs)
+  return _internal_worldmaxs();
+}
+inline void LiveHeatmap::unsafe_arena_set_allocated_worldmaxs(
+    ::Analytics::Vec3* worldmaxs) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.worldmaxs_);
+  }
+  _impl_.worldmaxs_ = worldmaxs;
+  if (worldmaxs) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.LiveHeatmap.worldMaxs)
+}
+inline ::Analytics::Vec3* LiveHeatmap::release_worldmaxs() {
+  
+  ::Analytics::Vec3* temp = _impl_.worldmaxs_;
+  _impl_.worldmaxs_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* LiveHeatmap::unsafe_arena_release_worldmaxs() {
+  // @@protoc_insertion_point(field_release:Analytics.LiveHeatmap.worldMaxs)
+  
+  ::Analytics::Vec3* temp = _impl_.worldmaxs_;
+  _impl_.worldmaxs_ = nullptr;
+  return temp;
+}
+inline ::Analytics::Vec3* LiveHeatmap::_internal_mutable_worldmaxs() {
+  
+  if (_impl_.worldmaxs_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.worldmaxs_ = p;
+  }
+  return _impl_.worldmaxs_;
+}
+inline ::Analytics::Vec3* LiveHeatmap::mutable_worldmaxs() {
+  ::Analytics::Vec3* _msg = _internal_mutable_worldmaxs();
+  // @@protoc_insertion_point(field_mutable:Analytics.LiveHeatmap.worldMaxs)
+  return _msg;
+}
+inline void LiveHeatmap::set_allocated_worldmaxs(::Analytics::Vec3* worldmaxs) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.worldmaxs_;
+  }
+  if (worldmaxs) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(worldmaxs);
+    if (message_arena != submessage_arena) {
+      worldmaxs = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, worldmaxs, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.worldmaxs_ = worldmaxs;
+  // @@protoc_insertion_point(field_set_allocated:Analytics.LiveHeatmap.worldMaxs)
+}
+
+// bytes values = 9;
+inline void LiveHeatmap::clear_values() {
+  _impl_.values_.ClearToEmpty();
+}
+inline const std::string& LiveHeatmap::values() const {
+  // @@protoc_insertion_point(field_get:Analytics.LiveHeatmap.values)
+  return _internal_values();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LiveHeatmap::set_values(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.values_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Analytics.LiveHeatmap.values)
+}
+inline std::string* LiveHeatmap::mutable_values() {
+  std::string* _s = _internal_mutable_values();
+  // @@protoc_insertion_point(field_mutable:Analytics.LiveHeatmap.values)
+  return _s;
+}
+inline const std::string& LiveHeatmap::_internal_values() const {
+  return _impl_.values_.Get();
+}
+inline void LiveHeatmap::_internal_set_values(const std::string& value) {
+  
+  _impl_.values_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LiveHeatmap::_internal_mutable_values() {
+  
+  return _impl_.values_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LiveHeatmap::release_values() {
+  // @@protoc_insertion_point(field_release:Analytics.LiveHeatmap.values)
+  return _impl_.values_.Release();
+}
+inline void LiveHeatmap::set_allocated_values(std::string* values) {
+  if (values != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.values_.SetAllocated(values, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.values_.IsDefault()) {
+    _impl_.values_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Analytics.LiveHeatmap.values)
+}
+
+// -------------------------------------------------------------------
+
 // GameNavNotFound
 
-// string mapName = 1;
+// string mapName = 1 [(.Analytics.intern) = "mapNameId"];
 inline void GameNavNotFound::clear_mapname() {
-  mapname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.mapname_.ClearToEmpty();
 }
 inline const std::string& GameNavNotFound::mapname() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNavNotFound.mapName)
   return _internal_mapname();
 }
-inline void GameNavNotFound::set_mapname(const std::string& value) {
-  _internal_set_mapname(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameNavNotFound::set_mapname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.mapname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameNavNotFound.mapName)
 }
 inline std::string* GameNavNotFound::mutable_mapname() {
+  std::string* _s = _internal_mutable_mapname();
   // @@protoc_insertion_point(field_mutable:Analytics.GameNavNotFound.mapName)
-  return _internal_mutable_mapname();
+  return _s;
 }
 inline const std::string& GameNavNotFound::_internal_mapname() const {
-  return mapname_.GetNoArena();
+  return _impl_.mapname_.Get();
 }
 inline void GameNavNotFound::_internal_set_mapname(const std::string& value) {
   
-  mapname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameNavNotFound::set_mapname(std::string&& value) {
-  
-  mapname_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameNavNotFound.mapName)
-}
-inline void GameNavNotFound::set_mapname(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  mapname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameNavNotFound.mapName)
-}
-inline void GameNavNotFound::set_mapname(const char* value, size_t size) {
-  
-  mapname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameNavNotFound.mapName)
+  _impl_.mapname_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameNavNotFound::_internal_mutable_mapname() {
   
-  return mapname_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.mapname_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameNavNotFound::release_mapname() {
   // @@protoc_insertion_point(field_release:Analytics.GameNavNotFound.mapName)
-  
-  return mapname_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.mapname_.Release();
 }
 inline void GameNavNotFound::set_allocated_mapname(std::string* mapname) {
   if (mapname != nullptr) {
@@ -8733,63 +11096,73 @@ inline void GameNavNotFound::set_allocated_mapname(std::string* mapname) {
   } else {
     
   }
-  mapname_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), mapname);
+  _impl_.mapname_.SetAllocated(mapname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mapname_.IsDefault()) {
+    _impl_.mapname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameNavNotFound.mapName)
 }
 
+// uint32 mapNameId = 2 [(.Analytics.hidden) = true];
+inline void GameNavNotFound::clear_mapnameid() {
+  _impl_.mapnameid_ = 0u;
+}
+inline uint32_t GameNavNotFound::_internal_mapnameid() const {
+  return _impl_.mapnameid_;
+}
+inline uint32_t GameNavNotFound::mapnameid() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameNavNotFound.mapNameId)
+  return _internal_mapnameid();
+}
+inline void GameNavNotFound::_internal_set_mapnameid(uint32_t value) {
+  
+  _impl_.mapnameid_ = value;
+}
+inline void GameNavNotFound::set_mapnameid(uint32_t value) {
+  _internal_set_mapnameid(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameNavNotFound.mapNameId)
+}
+
 // -------------------------------------------------------------------
 
 // GameNavAutoDownloaded
 
-// string mapName = 1;
+// string mapName = 1 [(.Analytics.intern) = "mapNameId"];
 inline void GameNavAutoDownloaded::clear_mapname() {
-  mapname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.mapname_.ClearToEmpty();
 }
 inline const std::string& GameNavAutoDownloaded::mapname() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNavAutoDownloaded.mapName)
   return _internal_mapname();
 }
-inline void GameNavAutoDownloaded::set_mapname(const std::string& value) {
-  _internal_set_mapname(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameNavAutoDownloaded::set_mapname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.mapname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameNavAutoDownloaded.mapName)
 }
 inline std::string* GameNavAutoDownloaded::mutable_mapname() {
+  std::string* _s = _internal_mutable_mapname();
   // @@protoc_insertion_point(field_mutable:Analytics.GameNavAutoDownloaded.mapName)
-  return _internal_mutable_mapname();
+  return _s;
 }
 inline const std::string& GameNavAutoDownloaded::_internal_mapname() const {
-  return mapname_.GetNoArena();
+  return _impl_.mapname_.Get();
 }
 inline void GameNavAutoDownloaded::_internal_set_mapname(const std::string& value) {
   
-  mapname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameNavAutoDownloaded::set_mapname(std::string&& value) {
-  
-  mapname_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameNavAutoDownloaded.mapName)
-}
-inline void GameNavAutoDownloaded::set_mapname(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  mapname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameNavAutoDownloaded.mapName)
-}
-inline void GameNavAutoDownloaded::set_mapname(const char* value, size_t size) {
-  
-  mapname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameNavAutoDownloaded.mapName)
+  _impl_.mapname_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameNavAutoDownloaded::_internal_mutable_mapname() {
   
-  return mapname_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.mapname_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameNavAutoDownloaded::release_mapname() {
   // @@protoc_insertion_point(field_release:Analytics.GameNavAutoDownloaded.mapName)
-  
-  return mapname_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.mapname_.Release();
 }
 inline void GameNavAutoDownloaded::set_allocated_mapname(std::string* mapname) {
   if (mapname != nullptr) {
@@ -8797,63 +11170,73 @@ inline void GameNavAutoDownloaded::set_allocated_mapname(std::string* mapname) {
   } else {
     
   }
-  mapname_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), mapname);
+  _impl_.mapname_.SetAllocated(mapname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mapname_.IsDefault()) {
+    _impl_.mapname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameNavAutoDownloaded.mapName)
 }
 
+// uint32 mapNameId = 2 [(.Analytics.hidden) = true];
+inline void GameNavAutoDownloaded::clear_mapnameid() {
+  _impl_.mapnameid_ = 0u;
+}
+inline uint32_t GameNavAutoDownloaded::_internal_mapnameid() const {
+  return _impl_.mapnameid_;
+}
+inline uint32_t GameNavAutoDownloaded::mapnameid() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameNavAutoDownloaded.mapNameId)
+  return _internal_mapnameid();
+}
+inline void GameNavAutoDownloaded::_internal_set_mapnameid(uint32_t value) {
+  
+  _impl_.mapnameid_ = value;
+}
+inline void GameNavAutoDownloaded::set_mapnameid(uint32_t value) {
+  _internal_set_mapnameid(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameNavAutoDownloaded.mapNameId)
+}
+
 // -------------------------------------------------------------------
 
 // GameAssert
 
 // string condition = 1;
 inline void GameAssert::clear_condition() {
-  condition_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.condition_.ClearToEmpty();
 }
 inline const std::string& GameAssert::condition() const {
   // @@protoc_insertion_point(field_get:Analytics.GameAssert.condition)
   return _internal_condition();
 }
-inline void GameAssert::set_condition(const std::string& value) {
-  _internal_set_condition(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameAssert::set_condition(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.condition_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameAssert.condition)
 }
 inline std::string* GameAssert::mutable_condition() {
+  std::string* _s = _internal_mutable_condition();
   // @@protoc_insertion_point(field_mutable:Analytics.GameAssert.condition)
-  return _internal_mutable_condition();
-}
-inline const std::string& GameAssert::_internal_condition() const {
-  return condition_.GetNoArena();
-}
-inline void GameAssert::_internal_set_condition(const std::string& value) {
-  
-  condition_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameAssert::set_condition(std::string&& value) {
-  
-  condition_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameAssert.condition)
+  return _s;
 }
-inline void GameAssert::set_condition(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  condition_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameAssert.condition)
+inline const std::string& GameAssert::_internal_condition() const {
+  return _impl_.condition_.Get();
 }
-inline void GameAssert::set_condition(const char* value, size_t size) {
+inline void GameAssert::_internal_set_condition(const std::string& value) {
   
-  condition_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameAssert.condition)
+  _impl_.condition_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameAssert::_internal_mutable_condition() {
   
-  return condition_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.condition_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameAssert::release_condition() {
   // @@protoc_insertion_point(field_release:Analytics.GameAssert.condition)
-  
-  return condition_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.condition_.Release();
 }
 inline void GameAssert::set_allocated_condition(std::string* condition) {
   if (condition != nullptr) {
@@ -8861,59 +11244,49 @@ inline void GameAssert::set_allocated_condition(std::string* condition) {
   } else {
     
   }
-  condition_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), condition);
+  _impl_.condition_.SetAllocated(condition, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.condition_.IsDefault()) {
+    _impl_.condition_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameAssert.condition)
 }
 
 // string file = 2;
 inline void GameAssert::clear_file() {
-  file_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.file_.ClearToEmpty();
 }
 inline const std::string& GameAssert::file() const {
   // @@protoc_insertion_point(field_get:Analytics.GameAssert.file)
   return _internal_file();
 }
-inline void GameAssert::set_file(const std::string& value) {
-  _internal_set_file(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameAssert::set_file(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameAssert.file)
 }
 inline std::string* GameAssert::mutable_file() {
+  std::string* _s = _internal_mutable_file();
   // @@protoc_insertion_point(field_mutable:Analytics.GameAssert.file)
-  return _internal_mutable_file();
+  return _s;
 }
 inline const std::string& GameAssert::_internal_file() const {
-  return file_.GetNoArena();
+  return _impl_.file_.Get();
 }
 inline void GameAssert::_internal_set_file(const std::string& value) {
   
-  file_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameAssert::set_file(std::string&& value) {
-  
-  file_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameAssert.file)
-}
-inline void GameAssert::set_file(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  file_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameAssert.file)
-}
-inline void GameAssert::set_file(const char* value, size_t size) {
-  
-  file_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameAssert.file)
+  _impl_.file_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameAssert::_internal_mutable_file() {
   
-  return file_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.file_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameAssert::release_file() {
   // @@protoc_insertion_point(field_release:Analytics.GameAssert.file)
-  
-  return file_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.file_.Release();
 }
 inline void GameAssert::set_allocated_file(std::string* file) {
   if (file != nullptr) {
@@ -8921,26 +11294,31 @@ inline void GameAssert::set_allocated_file(std::string* file) {
   } else {
     
   }
-  file_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), file);
+  _impl_.file_.SetAllocated(file, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_.IsDefault()) {
+    _impl_.file_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameAssert.file)
 }
 
 // int32 line = 3;
 inline void GameAssert::clear_line() {
-  line_ = 0;
+  _impl_.line_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameAssert::_internal_line() const {
-  return line_;
+inline int32_t GameAssert::_internal_line() const {
+  return _impl_.line_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameAssert::line() const {
+inline int32_t GameAssert::line() const {
   // @@protoc_insertion_point(field_get:Analytics.GameAssert.line)
   return _internal_line();
 }
-inline void GameAssert::_internal_set_line(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameAssert::_internal_set_line(int32_t value) {
   
-  line_ = value;
+  _impl_.line_ = value;
 }
-inline void GameAssert::set_line(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameAssert::set_line(int32_t value) {
   _internal_set_line(value);
   // @@protoc_insertion_point(field_set:Analytics.GameAssert.line)
 }
@@ -8951,53 +11329,38 @@ inline void GameAssert::set_line(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // string info = 1;
 inline void GameCrash::clear_info() {
-  info_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.info_.ClearToEmpty();
 }
 inline const std::string& GameCrash::info() const {
   // @@protoc_insertion_point(field_get:Analytics.GameCrash.info)
   return _internal_info();
 }
-inline void GameCrash::set_info(const std::string& value) {
-  _internal_set_info(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameCrash::set_info(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.info_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameCrash.info)
 }
 inline std::string* GameCrash::mutable_info() {
+  std::string* _s = _internal_mutable_info();
   // @@protoc_insertion_point(field_mutable:Analytics.GameCrash.info)
-  return _internal_mutable_info();
+  return _s;
 }
 inline const std::string& GameCrash::_internal_info() const {
-  return info_.GetNoArena();
+  return _impl_.info_.Get();
 }
 inline void GameCrash::_internal_set_info(const std::string& value) {
   
-  info_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameCrash::set_info(std::string&& value) {
-  
-  info_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameCrash.info)
-}
-inline void GameCrash::set_info(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  info_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameCrash.info)
-}
-inline void GameCrash::set_info(const char* value, size_t size) {
-  
-  info_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameCrash.info)
+  _impl_.info_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameCrash::_internal_mutable_info() {
   
-  return info_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.info_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameCrash::release_info() {
   // @@protoc_insertion_point(field_release:Analytics.GameCrash.info)
-  
-  return info_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.info_.Release();
 }
 inline void GameCrash::set_allocated_info(std::string* info) {
   if (info != nullptr) {
@@ -9005,7 +11368,12 @@ inline void GameCrash::set_allocated_info(std::string* info) {
   } else {
     
   }
-  info_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), info);
+  _impl_.info_.SetAllocated(info, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.info_.IsDefault()) {
+    _impl_.info_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameCrash.info)
 }
 
@@ -9015,10 +11383,10 @@ inline void GameCrash::set_allocated_info(std::string* info) {
 
 // .Analytics.Compression compressionType = 1;
 inline void GameMeshData::clear_compressiontype() {
-  compressiontype_ = 0;
+  _impl_.compressiontype_ = 0;
 }
 inline ::Analytics::Compression GameMeshData::_internal_compressiontype() const {
-  return static_cast< ::Analytics::Compression >(compressiontype_);
+  return static_cast< ::Analytics::Compression >(_impl_.compressiontype_);
 }
 inline ::Analytics::Compression GameMeshData::compressiontype() const {
   // @@protoc_insertion_point(field_get:Analytics.GameMeshData.compressionType)
@@ -9026,7 +11394,7 @@ inline ::Analytics::Compression GameMeshData::compressiontype() const {
 }
 inline void GameMeshData::_internal_set_compressiontype(::Analytics::Compression value) {
   
-  compressiontype_ = value;
+  _impl_.compressiontype_ = value;
 }
 inline void GameMeshData::set_compressiontype(::Analytics::Compression value) {
   _internal_set_compressiontype(value);
@@ -9035,53 +11403,38 @@ inline void GameMeshData::set_compressiontype(::Analytics::Compression value) {
 
 // string modelName = 2;
 inline void GameMeshData::clear_modelname() {
-  modelname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.modelname_.ClearToEmpty();
 }
 inline const std::string& GameMeshData::modelname() const {
   // @@protoc_insertion_point(field_get:Analytics.GameMeshData.modelName)
   return _internal_modelname();
 }
-inline void GameMeshData::set_modelname(const std::string& value) {
-  _internal_set_modelname(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameMeshData::set_modelname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.modelname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameMeshData.modelName)
 }
 inline std::string* GameMeshData::mutable_modelname() {
+  std::string* _s = _internal_mutable_modelname();
   // @@protoc_insertion_point(field_mutable:Analytics.GameMeshData.modelName)
-  return _internal_mutable_modelname();
+  return _s;
 }
 inline const std::string& GameMeshData::_internal_modelname() const {
-  return modelname_.GetNoArena();
+  return _impl_.modelname_.Get();
 }
 inline void GameMeshData::_internal_set_modelname(const std::string& value) {
   
-  modelname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameMeshData::set_modelname(std::string&& value) {
-  
-  modelname_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameMeshData.modelName)
-}
-inline void GameMeshData::set_modelname(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  modelname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameMeshData.modelName)
-}
-inline void GameMeshData::set_modelname(const char* value, size_t size) {
-  
-  modelname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameMeshData.modelName)
+  _impl_.modelname_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameMeshData::_internal_mutable_modelname() {
   
-  return modelname_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.modelname_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameMeshData::release_modelname() {
   // @@protoc_insertion_point(field_release:Analytics.GameMeshData.modelName)
-  
-  return modelname_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.modelname_.Release();
 }
 inline void GameMeshData::set_allocated_modelname(std::string* modelname) {
   if (modelname != nullptr) {
@@ -9089,59 +11442,49 @@ inline void GameMeshData::set_allocated_modelname(std::string* modelname) {
   } else {
     
   }
-  modelname_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), modelname);
+  _impl_.modelname_.SetAllocated(modelname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.modelname_.IsDefault()) {
+    _impl_.modelname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameMeshData.modelName)
 }
 
 // bytes modelBytes = 3;
 inline void GameMeshData::clear_modelbytes() {
-  modelbytes_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.modelbytes_.ClearToEmpty();
 }
 inline const std::string& GameMeshData::modelbytes() const {
   // @@protoc_insertion_point(field_get:Analytics.GameMeshData.modelBytes)
   return _internal_modelbytes();
 }
-inline void GameMeshData::set_modelbytes(const std::string& value) {
-  _internal_set_modelbytes(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameMeshData::set_modelbytes(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.modelbytes_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameMeshData.modelBytes)
 }
 inline std::string* GameMeshData::mutable_modelbytes() {
+  std::string* _s = _internal_mutable_modelbytes();
   // @@protoc_insertion_point(field_mutable:Analytics.GameMeshData.modelBytes)
-  return _internal_mutable_modelbytes();
+  return _s;
 }
 inline const std::string& GameMeshData::_internal_modelbytes() const {
-  return modelbytes_.GetNoArena();
+  return _impl_.modelbytes_.Get();
 }
 inline void GameMeshData::_internal_set_modelbytes(const std::string& value) {
   
-  modelbytes_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameMeshData::set_modelbytes(std::string&& value) {
-  
-  modelbytes_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameMeshData.modelBytes)
-}
-inline void GameMeshData::set_modelbytes(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  modelbytes_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameMeshData.modelBytes)
-}
-inline void GameMeshData::set_modelbytes(const void* value, size_t size) {
-  
-  modelbytes_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameMeshData.modelBytes)
+  _impl_.modelbytes_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameMeshData::_internal_mutable_modelbytes() {
   
-  return modelbytes_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.modelbytes_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameMeshData::release_modelbytes() {
   // @@protoc_insertion_point(field_release:Analytics.GameMeshData.modelBytes)
-  
-  return modelbytes_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.modelbytes_.Release();
 }
 inline void GameMeshData::set_allocated_modelbytes(std::string* modelbytes) {
   if (modelbytes != nullptr) {
@@ -9149,26 +11492,31 @@ inline void GameMeshData::set_allocated_modelbytes(std::string* modelbytes) {
   } else {
     
   }
-  modelbytes_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), modelbytes);
+  _impl_.modelbytes_.SetAllocated(modelbytes, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.modelbytes_.IsDefault()) {
+    _impl_.modelbytes_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameMeshData.modelBytes)
 }
 
 // uint32 modelBytesUncompressed = 4;
 inline void GameMeshData::clear_modelbytesuncompressed() {
-  modelbytesuncompressed_ = 0u;
+  _impl_.modelbytesuncompressed_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 GameMeshData::_internal_modelbytesuncompressed() const {
-  return modelbytesuncompressed_;
+inline uint32_t GameMeshData::_internal_modelbytesuncompressed() const {
+  return _impl_.modelbytesuncompressed_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 GameMeshData::modelbytesuncompressed() const {
+inline uint32_t GameMeshData::modelbytesuncompressed() const {
   // @@protoc_insertion_point(field_get:Analytics.GameMeshData.modelBytesUncompressed)
   return _internal_modelbytesuncompressed();
 }
-inline void GameMeshData::_internal_set_modelbytesuncompressed(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void GameMeshData::_internal_set_modelbytesuncompressed(uint32_t value) {
   
-  modelbytesuncompressed_ = value;
+  _impl_.modelbytesuncompressed_ = value;
 }
-inline void GameMeshData::set_modelbytesuncompressed(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void GameMeshData::set_modelbytesuncompressed(uint32_t value) {
   _internal_set_modelbytesuncompressed(value);
   // @@protoc_insertion_point(field_set:Analytics.GameMeshData.modelBytesUncompressed)
 }
@@ -9179,40 +11527,40 @@ inline void GameMeshData::set_modelbytesuncompressed(::PROTOBUF_NAMESPACE_ID::ui
 
 // uint32 ammoType = 1 [(.Analytics.enumkey) = "AMMO_TYPE"];
 inline void GameEntityInfo_Ammo::clear_ammotype() {
-  ammotype_ = 0u;
+  _impl_.ammotype_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 GameEntityInfo_Ammo::_internal_ammotype() const {
-  return ammotype_;
+inline uint32_t GameEntityInfo_Ammo::_internal_ammotype() const {
+  return _impl_.ammotype_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 GameEntityInfo_Ammo::ammotype() const {
+inline uint32_t GameEntityInfo_Ammo::ammotype() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.Ammo.ammoType)
   return _internal_ammotype();
 }
-inline void GameEntityInfo_Ammo::_internal_set_ammotype(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void GameEntityInfo_Ammo::_internal_set_ammotype(uint32_t value) {
   
-  ammotype_ = value;
+  _impl_.ammotype_ = value;
 }
-inline void GameEntityInfo_Ammo::set_ammotype(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void GameEntityInfo_Ammo::set_ammotype(uint32_t value) {
   _internal_set_ammotype(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.Ammo.ammoType)
 }
 
 // uint32 ammoCount = 2;
 inline void GameEntityInfo_Ammo::clear_ammocount() {
-  ammocount_ = 0u;
+  _impl_.ammocount_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 GameEntityInfo_Ammo::_internal_ammocount() const {
-  return ammocount_;
+inline uint32_t GameEntityInfo_Ammo::_internal_ammocount() const {
+  return _impl_.ammocount_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 GameEntityInfo_Ammo::ammocount() const {
+inline uint32_t GameEntityInfo_Ammo::ammocount() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.Ammo.ammoCount)
   return _internal_ammocount();
 }
-inline void GameEntityInfo_Ammo::_internal_set_ammocount(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void GameEntityInfo_Ammo::_internal_set_ammocount(uint32_t value) {
   
-  ammocount_ = value;
+  _impl_.ammocount_ = value;
 }
-inline void GameEntityInfo_Ammo::set_ammocount(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void GameEntityInfo_Ammo::set_ammocount(uint32_t value) {
   _internal_set_ammocount(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.Ammo.ammoCount)
 }
@@ -9221,55 +11569,40 @@ inline void GameEntityInfo_Ammo::set_ammocount(::PROTOBUF_NAMESPACE_ID::uint32 v
 
 // GameEntityInfo
 
-// string entityName = 1;
+// string entityName = 1 [(.Analytics.intern) = "entityNameId"];
 inline void GameEntityInfo::clear_entityname() {
-  entityname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.entityname_.ClearToEmpty();
 }
 inline const std::string& GameEntityInfo::entityname() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.entityName)
   return _internal_entityname();
 }
-inline void GameEntityInfo::set_entityname(const std::string& value) {
-  _internal_set_entityname(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameEntityInfo::set_entityname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.entityname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.entityName)
 }
 inline std::string* GameEntityInfo::mutable_entityname() {
+  std::string* _s = _internal_mutable_entityname();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEntityInfo.entityName)
-  return _internal_mutable_entityname();
+  return _s;
 }
 inline const std::string& GameEntityInfo::_internal_entityname() const {
-  return entityname_.GetNoArena();
+  return _impl_.entityname_.Get();
 }
 inline void GameEntityInfo::_internal_set_entityname(const std::string& value) {
   
-  entityname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameEntityInfo::set_entityname(std::string&& value) {
-  
-  entityname_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameEntityInfo.entityName)
-}
-inline void GameEntityInfo::set_entityname(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  entityname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameEntityInfo.entityName)
-}
-inline void GameEntityInfo::set_entityname(const char* value, size_t size) {
-  
-  entityname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameEntityInfo.entityName)
+  _impl_.entityname_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameEntityInfo::_internal_mutable_entityname() {
   
-  return entityname_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.entityname_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameEntityInfo::release_entityname() {
   // @@protoc_insertion_point(field_release:Analytics.GameEntityInfo.entityName)
-  
-  return entityname_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.entityname_.Release();
 }
 inline void GameEntityInfo::set_allocated_entityname(std::string* entityname) {
   if (entityname != nullptr) {
@@ -9277,238 +11610,273 @@ inline void GameEntityInfo::set_allocated_entityname(std::string* entityname) {
   } else {
     
   }
-  entityname_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), entityname);
+  _impl_.entityname_.SetAllocated(entityname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entityname_.IsDefault()) {
+    _impl_.entityname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityInfo.entityName)
 }
 
 // int32 entityIndex = 2;
 inline void GameEntityInfo::clear_entityindex() {
-  entityindex_ = 0;
+  _impl_.entityindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::_internal_entityindex() const {
-  return entityindex_;
+inline int32_t GameEntityInfo::_internal_entityindex() const {
+  return _impl_.entityindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::entityindex() const {
+inline int32_t GameEntityInfo::entityindex() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.entityIndex)
   return _internal_entityindex();
 }
-inline void GameEntityInfo::_internal_set_entityindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::_internal_set_entityindex(int32_t value) {
   
-  entityindex_ = value;
+  _impl_.entityindex_ = value;
 }
-inline void GameEntityInfo::set_entityindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::set_entityindex(int32_t value) {
   _internal_set_entityindex(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.entityIndex)
 }
 
 // int32 entitySerial = 3;
 inline void GameEntityInfo::clear_entityserial() {
-  entityserial_ = 0;
+  _impl_.entityserial_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::_internal_entityserial() const {
-  return entityserial_;
+inline int32_t GameEntityInfo::_internal_entityserial() const {
+  return _impl_.entityserial_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::entityserial() const {
+inline int32_t GameEntityInfo::entityserial() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.entitySerial)
   return _internal_entityserial();
 }
-inline void GameEntityInfo::_internal_set_entityserial(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::_internal_set_entityserial(int32_t value) {
   
-  entityserial_ = value;
+  _impl_.entityserial_ = value;
 }
-inline void GameEntityInfo::set_entityserial(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::set_entityserial(int32_t value) {
   _internal_set_entityserial(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.entitySerial)
 }
 
 // int32 groupId = 4 [(.Analytics.enumkey) = "GROUP_ID"];
 inline void GameEntityInfo::clear_groupid() {
-  groupid_ = 0;
+  _impl_.groupid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::_internal_groupid() const {
-  return groupid_;
+inline int32_t GameEntityInfo::_internal_groupid() const {
+  return _impl_.groupid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::groupid() const {
+inline int32_t GameEntityInfo::groupid() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.groupId)
   return _internal_groupid();
 }
-inline void GameEntityInfo::_internal_set_groupid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::_internal_set_groupid(int32_t value) {
   
-  groupid_ = value;
+  _impl_.groupid_ = value;
 }
-inline void GameEntityInfo::set_groupid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::set_groupid(int32_t value) {
   _internal_set_groupid(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.groupId)
 }
 
 // int32 classId = 5 [(.Analytics.enumkey) = "CLASS_ID"];
 inline void GameEntityInfo::clear_classid() {
-  classid_ = 0;
+  _impl_.classid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::_internal_classid() const {
-  return classid_;
+inline int32_t GameEntityInfo::_internal_classid() const {
+  return _impl_.classid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::classid() const {
+inline int32_t GameEntityInfo::classid() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.classId)
   return _internal_classid();
 }
-inline void GameEntityInfo::_internal_set_classid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::_internal_set_classid(int32_t value) {
   
-  classid_ = value;
+  _impl_.classid_ = value;
 }
-inline void GameEntityInfo::set_classid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::set_classid(int32_t value) {
   _internal_set_classid(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.classId)
 }
 
 // int32 team = 6 [(.Analytics.enumkey) = "TEAM_ID"];
 inline void GameEntityInfo::clear_team() {
-  team_ = 0;
+  _impl_.team_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::_internal_team() const {
-  return team_;
+inline int32_t GameEntityInfo::_internal_team() const {
+  return _impl_.team_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::team() const {
+inline int32_t GameEntityInfo::team() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.team)
   return _internal_team();
 }
-inline void GameEntityInfo::_internal_set_team(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::_internal_set_team(int32_t value) {
   
-  team_ = value;
+  _impl_.team_ = value;
 }
-inline void GameEntityInfo::set_team(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::set_team(int32_t value) {
   _internal_set_team(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.team)
 }
 
 // int64 entityFlags = 7 [(.Analytics.enumkey) = "ENTITY_FLAGS", (.Analytics.enumflagsindexed) = true];
 inline void GameEntityInfo::clear_entityflags() {
-  entityflags_ = PROTOBUF_LONGLONG(0);
+  _impl_.entityflags_ = int64_t{0};
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 GameEntityInfo::_internal_entityflags() const {
-  return entityflags_;
+inline int64_t GameEntityInfo::_internal_entityflags() const {
+  return _impl_.entityflags_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 GameEntityInfo::entityflags() const {
+inline int64_t GameEntityInfo::entityflags() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.entityFlags)
   return _internal_entityflags();
 }
-inline void GameEntityInfo::_internal_set_entityflags(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void GameEntityInfo::_internal_set_entityflags(int64_t value) {
   
-  entityflags_ = value;
+  _impl_.entityflags_ = value;
 }
-inline void GameEntityInfo::set_entityflags(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void GameEntityInfo::set_entityflags(int64_t value) {
   _internal_set_entityflags(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.entityFlags)
 }
 
 // int32 category = 8 [(.Analytics.enumkey) = "CATEGORY_ID", (.Analytics.enumflagsindexed) = true];
 inline void GameEntityInfo::clear_category() {
-  category_ = 0;
+  _impl_.category_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::_internal_category() const {
-  return category_;
+inline int32_t GameEntityInfo::_internal_category() const {
+  return _impl_.category_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::category() const {
+inline int32_t GameEntityInfo::category() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.category)
   return _internal_category();
 }
-inline void GameEntityInfo::_internal_set_category(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::_internal_set_category(int32_t value) {
   
-  category_ = value;
+  _impl_.category_ = value;
 }
-inline void GameEntityInfo::set_category(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::set_category(int32_t value) {
   _internal_set_category(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.category)
 }
 
 // int32 powerUps = 9 [(.Analytics.enumkey) = "POWERUP_ID", (.Analytics.enumflagsindexed) = true];
 inline void GameEntityInfo::clear_powerups() {
-  powerups_ = 0;
+  _impl_.powerups_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::_internal_powerups() const {
-  return powerups_;
+inline int32_t GameEntityInfo::_internal_powerups() const {
+  return _impl_.powerups_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityInfo::powerups() const {
+inline int32_t GameEntityInfo::powerups() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.powerUps)
   return _internal_powerups();
 }
-inline void GameEntityInfo::_internal_set_powerups(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::_internal_set_powerups(int32_t value) {
   
-  powerups_ = value;
+  _impl_.powerups_ = value;
 }
-inline void GameEntityInfo::set_powerups(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityInfo::set_powerups(int32_t value) {
   _internal_set_powerups(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.powerUps)
 }
 
 // int64 navFlags = 10 [(.Analytics.enumkey) = "NAV_FLAGS"];
 inline void GameEntityInfo::clear_navflags() {
-  navflags_ = PROTOBUF_LONGLONG(0);
+  _impl_.navflags_ = int64_t{0};
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 GameEntityInfo::_internal_navflags() const {
-  return navflags_;
+inline int64_t GameEntityInfo::_internal_navflags() const {
+  return _impl_.navflags_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 GameEntityInfo::navflags() const {
+inline int64_t GameEntityInfo::navflags() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.navFlags)
   return _internal_navflags();
 }
-inline void GameEntityInfo::_internal_set_navflags(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void GameEntityInfo::_internal_set_navflags(int64_t value) {
   
-  navflags_ = value;
+  _impl_.navflags_ = value;
 }
-inline void GameEntityInfo::set_navflags(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void GameEntityInfo::set_navflags(int64_t value) {
   _internal_set_navflags(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.navFlags)
 }
 
 // .Analytics.Vec3 eulerRotation = 11 [(.Analytics.hidden) = true];
 inline bool GameEntityInfo::_internal_has_eulerrotation() const {
-  return this != internal_default_instance() && eulerrotation_ != nullptr;
+  return this != internal_default_instance() && _impl_.eulerrotation_ != nullptr;
 }
 inline bool GameEntityInfo::has_eulerrotation() const {
   return _internal_has_eulerrotation();
 }
 inline void GameEntityInfo::clear_eulerrotation() {
-  if (GetArenaNoVirtual() == nullptr && eulerrotation_ != nullptr) {
-    delete eulerrotation_;
+  if (GetArenaForAllocation() == nullptr && _impl_.eulerrotation_ != nullptr) {
+    delete _impl_.eulerrotation_;
   }
-  eulerrotation_ = nullptr;
+  _impl_.eulerrotation_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameEntityInfo::_internal_eulerrotation() const {
-  const ::Analytics::Vec3* p = eulerrotation_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.eulerrotation_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameEntityInfo::eulerrotation() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.eulerRotation)
   return _internal_eulerrotation();
 }
+inline void GameEntityInfo::unsafe_arena_set_allocated_eulerrotation(
+    ::Analytics::Vec3* eulerrotation) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.eulerrotation_);
+  }
+  _impl_.eulerrotation_ = eulerrotation;
+  if (eulerrotation) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameEntityInfo.eulerRotation)
+}
 inline ::Analytics::Vec3* GameEntityInfo::release_eulerrotation() {
+  
+  ::Analytics::Vec3* temp = _impl_.eulerrotation_;
+  _impl_.eulerrotation_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameEntityInfo::unsafe_arena_release_eulerrotation() {
   // @@protoc_insertion_point(field_release:Analytics.GameEntityInfo.eulerRotation)
   
-  ::Analytics::Vec3* temp = eulerrotation_;
-  eulerrotation_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.eulerrotation_;
+  _impl_.eulerrotation_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameEntityInfo::_internal_mutable_eulerrotation() {
   
-  if (eulerrotation_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    eulerrotation_ = p;
+  if (_impl_.eulerrotation_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.eulerrotation_ = p;
   }
-  return eulerrotation_;
+  return _impl_.eulerrotation_;
 }
 inline ::Analytics::Vec3* GameEntityInfo::mutable_eulerrotation() {
+  ::Analytics::Vec3* _msg = _internal_mutable_eulerrotation();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEntityInfo.eulerRotation)
-  return _internal_mutable_eulerrotation();
+  return _msg;
 }
 inline void GameEntityInfo::set_allocated_eulerrotation(::Analytics::Vec3* eulerrotation) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete eulerrotation_;
+    delete _impl_.eulerrotation_;
   }
   if (eulerrotation) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(eulerrotation);
     if (message_arena != submessage_arena) {
       eulerrotation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, eulerrotation, submessage_arena);
@@ -9517,58 +11885,88 @@ inline void GameEntityInfo::set_allocated_eulerrotation(::Analytics::Vec3* euler
   } else {
     
   }
-  eulerrotation_ = eulerrotation;
+  _impl_.eulerrotation_ = eulerrotation;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityInfo.eulerRotation)
 }
 
 // .Analytics.Vec3 position = 12 [(.Analytics.hidden) = true];
 inline bool GameEntityInfo::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
 inline bool GameEntityInfo::has_position() const {
   return _internal_has_position();
 }
 inline void GameEntityInfo::clear_position() {
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameEntityInfo::_internal_position() const {
-  const ::Analytics::Vec3* p = position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameEntityInfo::position() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.position)
   return _internal_position();
 }
+inline void GameEntityInfo::unsafe_arena_set_allocated_position(
+    ::Analytics::Vec3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameEntityInfo.position)
+}
 inline ::Analytics::Vec3* GameEntityInfo::release_position() {
+  
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameEntityInfo::unsafe_arena_release_position() {
   // @@protoc_insertion_point(field_release:Analytics.GameEntityInfo.position)
   
-  ::Analytics::Vec3* temp = position_;
-  position_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameEntityInfo::_internal_mutable_position() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    position_ = p;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.position_ = p;
   }
-  return position_;
+  return _impl_.position_;
 }
 inline ::Analytics::Vec3* GameEntityInfo::mutable_position() {
+  ::Analytics::Vec3* _msg = _internal_mutable_position();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEntityInfo.position)
-  return _internal_mutable_position();
+  return _msg;
 }
 inline void GameEntityInfo::set_allocated_position(::Analytics::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete position_;
+    delete _impl_.position_;
   }
   if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
     if (message_arena != submessage_arena) {
       position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, position, submessage_arena);
@@ -9577,58 +11975,88 @@ inline void GameEntityInfo::set_allocated_position(::Analytics::Vec3* position)
   } else {
     
   }
-  position_ = position;
+  _impl_.position_ = position;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityInfo.position)
 }
 
 // .Analytics.Vec3 eyeOffset = 13 [(.Analytics.hidden) = true];
 inline bool GameEntityInfo::_internal_has_eyeoffset() const {
-  return this != internal_default_instance() && eyeoffset_ != nullptr;
+  return this != internal_default_instance() && _impl_.eyeoffset_ != nullptr;
 }
 inline bool GameEntityInfo::has_eyeoffset() const {
   return _internal_has_eyeoffset();
 }
 inline void GameEntityInfo::clear_eyeoffset() {
-  if (GetArenaNoVirtual() == nullptr && eyeoffset_ != nullptr) {
-    delete eyeoffset_;
+  if (GetArenaForAllocation() == nullptr && _impl_.eyeoffset_ != nullptr) {
+    delete _impl_.eyeoffset_;
   }
-  eyeoffset_ = nullptr;
+  _impl_.eyeoffset_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameEntityInfo::_internal_eyeoffset() const {
-  const ::Analytics::Vec3* p = eyeoffset_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.eyeoffset_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameEntityInfo::eyeoffset() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.eyeOffset)
   return _internal_eyeoffset();
 }
+inline void GameEntityInfo::unsafe_arena_set_allocated_eyeoffset(
+    ::Analytics::Vec3* eyeoffset) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.eyeoffset_);
+  }
+  _impl_.eyeoffset_ = eyeoffset;
+  if (eyeoffset) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameEntityInfo.eyeOffset)
+}
 inline ::Analytics::Vec3* GameEntityInfo::release_eyeoffset() {
+  
+  ::Analytics::Vec3* temp = _impl_.eyeoffset_;
+  _impl_.eyeoffset_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameEntityInfo::unsafe_arena_release_eyeoffset() {
   // @@protoc_insertion_point(field_release:Analytics.GameEntityInfo.eyeOffset)
   
-  ::Analytics::Vec3* temp = eyeoffset_;
-  eyeoffset_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.eyeoffset_;
+  _impl_.eyeoffset_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameEntityInfo::_internal_mutable_eyeoffset() {
   
-  if (eyeoffset_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    eyeoffset_ = p;
+  if (_impl_.eyeoffset_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.eyeoffset_ = p;
   }
-  return eyeoffset_;
+  return _impl_.eyeoffset_;
 }
 inline ::Analytics::Vec3* GameEntityInfo::mutable_eyeoffset() {
+  ::Analytics::Vec3* _msg = _internal_mutable_eyeoffset();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEntityInfo.eyeOffset)
-  return _internal_mutable_eyeoffset();
+  return _msg;
 }
 inline void GameEntityInfo::set_allocated_eyeoffset(::Analytics::Vec3* eyeoffset) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete eyeoffset_;
+    delete _impl_.eyeoffset_;
   }
   if (eyeoffset) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(eyeoffset);
     if (message_arena != submessage_arena) {
       eyeoffset = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, eyeoffset, submessage_arena);
@@ -9637,58 +12065,88 @@ inline void GameEntityInfo::set_allocated_eyeoffset(::Analytics::Vec3* eyeoffset
   } else {
     
   }
-  eyeoffset_ = eyeoffset;
+  _impl_.eyeoffset_ = eyeoffset;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityInfo.eyeOffset)
 }
 
 // .Analytics.Vec3 eyeDir = 14 [(.Analytics.hidden) = true];
 inline bool GameEntityInfo::_internal_has_eyedir() const {
-  return this != internal_default_instance() && eyedir_ != nullptr;
+  return this != internal_default_instance() && _impl_.eyedir_ != nullptr;
 }
 inline bool GameEntityInfo::has_eyedir() const {
   return _internal_has_eyedir();
 }
 inline void GameEntityInfo::clear_eyedir() {
-  if (GetArenaNoVirtual() == nullptr && eyedir_ != nullptr) {
-    delete eyedir_;
+  if (GetArenaForAllocation() == nullptr && _impl_.eyedir_ != nullptr) {
+    delete _impl_.eyedir_;
   }
-  eyedir_ = nullptr;
+  _impl_.eyedir_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameEntityInfo::_internal_eyedir() const {
-  const ::Analytics::Vec3* p = eyedir_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.eyedir_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameEntityInfo::eyedir() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.eyeDir)
   return _internal_eyedir();
 }
+inline void GameEntityInfo::unsafe_arena_set_allocated_eyedir(
+    ::Analytics::Vec3* eyedir) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.eyedir_);
+  }
+  _impl_.eyedir_ = eyedir;
+  if (eyedir) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameEntityInfo.eyeDir)
+}
 inline ::Analytics::Vec3* GameEntityInfo::release_eyedir() {
+  
+  ::Analytics::Vec3* temp = _impl_.eyedir_;
+  _impl_.eyedir_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameEntityInfo::unsafe_arena_release_eyedir() {
   // @@protoc_insertion_point(field_release:Analytics.GameEntityInfo.eyeDir)
   
-  ::Analytics::Vec3* temp = eyedir_;
-  eyedir_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.eyedir_;
+  _impl_.eyedir_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameEntityInfo::_internal_mutable_eyedir() {
   
-  if (eyedir_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    eyedir_ = p;
+  if (_impl_.eyedir_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.eyedir_ = p;
   }
-  return eyedir_;
+  return _impl_.eyedir_;
 }
 inline ::Analytics::Vec3* GameEntityInfo::mutable_eyedir() {
+  ::Analytics::Vec3* _msg = _internal_mutable_eyedir();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEntityInfo.eyeDir)
-  return _internal_mutable_eyedir();
+  return _msg;
 }
 inline void GameEntityInfo::set_allocated_eyedir(::Analytics::Vec3* eyedir) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete eyedir_;
+    delete _impl_.eyedir_;
   }
   if (eyedir) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(eyedir);
     if (message_arena != submessage_arena) {
       eyedir = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, eyedir, submessage_arena);
@@ -9697,58 +12155,88 @@ inline void GameEntityInfo::set_allocated_eyedir(::Analytics::Vec3* eyedir) {
   } else {
     
   }
-  eyedir_ = eyedir;
+  _impl_.eyedir_ = eyedir;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityInfo.eyeDir)
 }
 
 // .Analytics.RangeI health = 15;
 inline bool GameEntityInfo::_internal_has_health() const {
-  return this != internal_default_instance() && health_ != nullptr;
+  return this != internal_default_instance() && _impl_.health_ != nullptr;
 }
 inline bool GameEntityInfo::has_health() const {
   return _internal_has_health();
 }
 inline void GameEntityInfo::clear_health() {
-  if (GetArenaNoVirtual() == nullptr && health_ != nullptr) {
-    delete health_;
+  if (GetArenaForAllocation() == nullptr && _impl_.health_ != nullptr) {
+    delete _impl_.health_;
   }
-  health_ = nullptr;
+  _impl_.health_ = nullptr;
 }
 inline const ::Analytics::RangeI& GameEntityInfo::_internal_health() const {
-  const ::Analytics::RangeI* p = health_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::RangeI*>(
-      &::Analytics::_RangeI_default_instance_);
+  const ::Analytics::RangeI* p = _impl_.health_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::RangeI&>(
+      ::Analytics::_RangeI_default_instance_);
 }
 inline const ::Analytics::RangeI& GameEntityInfo::health() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.health)
   return _internal_health();
 }
+inline void GameEntityInfo::unsafe_arena_set_allocated_health(
+    ::Analytics::RangeI* health) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.health_);
+  }
+  _impl_.health_ = health;
+  if (health) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameEntityInfo.health)
+}
 inline ::Analytics::RangeI* GameEntityInfo::release_health() {
+  
+  ::Analytics::RangeI* temp = _impl_.health_;
+  _impl_.health_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::RangeI* GameEntityInfo::unsafe_arena_release_health() {
   // @@protoc_insertion_point(field_release:Analytics.GameEntityInfo.health)
   
-  ::Analytics::RangeI* temp = health_;
-  health_ = nullptr;
+  ::Analytics::RangeI* temp = _impl_.health_;
+  _impl_.health_ = nullptr;
   return temp;
 }
 inline ::Analytics::RangeI* GameEntityInfo::_internal_mutable_health() {
   
-  if (health_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::RangeI>(GetArenaNoVirtual());
-    health_ = p;
+  if (_impl_.health_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::RangeI>(GetArenaForAllocation());
+    _impl_.health_ = p;
   }
-  return health_;
+  return _impl_.health_;
 }
 inline ::Analytics::RangeI* GameEntityInfo::mutable_health() {
+  ::Analytics::RangeI* _msg = _internal_mutable_health();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEntityInfo.health)
-  return _internal_mutable_health();
+  return _msg;
 }
 inline void GameEntityInfo::set_allocated_health(::Analytics::RangeI* health) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete health_;
+    delete _impl_.health_;
   }
   if (health) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(health);
     if (message_arena != submessage_arena) {
       health = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, health, submessage_arena);
@@ -9757,58 +12245,88 @@ inline void GameEntityInfo::set_allocated_health(::Analytics::RangeI* health) {
   } else {
     
   }
-  health_ = health;
+  _impl_.health_ = health;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityInfo.health)
 }
 
 // .Analytics.RangeI armor = 16;
 inline bool GameEntityInfo::_internal_has_armor() const {
-  return this != internal_default_instance() && armor_ != nullptr;
+  return this != internal_default_instance() && _impl_.armor_ != nullptr;
 }
 inline bool GameEntityInfo::has_armor() const {
   return _internal_has_armor();
 }
 inline void GameEntityInfo::clear_armor() {
-  if (GetArenaNoVirtual() == nullptr && armor_ != nullptr) {
-    delete armor_;
+  if (GetArenaForAllocation() == nullptr && _impl_.armor_ != nullptr) {
+    delete _impl_.armor_;
   }
-  armor_ = nullptr;
+  _impl_.armor_ = nullptr;
 }
 inline const ::Analytics::RangeI& GameEntityInfo::_internal_armor() const {
-  const ::Analytics::RangeI* p = armor_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::RangeI*>(
-      &::Analytics::_RangeI_default_instance_);
+  const ::Analytics::RangeI* p = _impl_.armor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::RangeI&>(
+      ::Analytics::_RangeI_default_instance_);
 }
 inline const ::Analytics::RangeI& GameEntityInfo::armor() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.armor)
   return _internal_armor();
 }
+inline void GameEntityInfo::unsafe_arena_set_allocated_armor(
+    ::Analytics::RangeI* armor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.armor_);
+  }
+  _impl_.armor_ = armor;
+  if (armor) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameEntityInfo.armor)
+}
 inline ::Analytics::RangeI* GameEntityInfo::release_armor() {
+  
+  ::Analytics::RangeI* temp = _impl_.armor_;
+  _impl_.armor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::RangeI* GameEntityInfo::unsafe_arena_release_armor() {
   // @@protoc_insertion_point(field_release:Analytics.GameEntityInfo.armor)
   
-  ::Analytics::RangeI* temp = armor_;
-  armor_ = nullptr;
+  ::Analytics::RangeI* temp = _impl_.armor_;
+  _impl_.armor_ = nullptr;
   return temp;
 }
 inline ::Analytics::RangeI* GameEntityInfo::_internal_mutable_armor() {
   
-  if (armor_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::RangeI>(GetArenaNoVirtual());
-    armor_ = p;
+  if (_impl_.armor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::RangeI>(GetArenaForAllocation());
+    _impl_.armor_ = p;
   }
-  return armor_;
+  return _impl_.armor_;
 }
 inline ::Analytics::RangeI* GameEntityInfo::mutable_armor() {
+  ::Analytics::RangeI* _msg = _internal_mutable_armor();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEntityInfo.armor)
-  return _internal_mutable_armor();
+  return _msg;
 }
 inline void GameEntityInfo::set_allocated_armor(::Analytics::RangeI* armor) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete armor_;
+    delete _impl_.armor_;
   }
   if (armor) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(armor);
     if (message_arena != submessage_arena) {
       armor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, armor, submessage_arena);
@@ -9817,58 +12335,88 @@ inline void GameEntityInfo::set_allocated_armor(::Analytics::RangeI* armor) {
   } else {
     
   }
-  armor_ = armor;
+  _impl_.armor_ = armor;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityInfo.armor)
 }
 
 // .Analytics.Vec3 boundsMin = 17;
 inline bool GameEntityInfo::_internal_has_boundsmin() const {
-  return this != internal_default_instance() && boundsmin_ != nullptr;
+  return this != internal_default_instance() && _impl_.boundsmin_ != nullptr;
 }
 inline bool GameEntityInfo::has_boundsmin() const {
   return _internal_has_boundsmin();
 }
 inline void GameEntityInfo::clear_boundsmin() {
-  if (GetArenaNoVirtual() == nullptr && boundsmin_ != nullptr) {
-    delete boundsmin_;
+  if (GetArenaForAllocation() == nullptr && _impl_.boundsmin_ != nullptr) {
+    delete _impl_.boundsmin_;
   }
-  boundsmin_ = nullptr;
+  _impl_.boundsmin_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameEntityInfo::_internal_boundsmin() const {
-  const ::Analytics::Vec3* p = boundsmin_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.boundsmin_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameEntityInfo::boundsmin() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.boundsMin)
   return _internal_boundsmin();
 }
+inline void GameEntityInfo::unsafe_arena_set_allocated_boundsmin(
+    ::Analytics::Vec3* boundsmin) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.boundsmin_);
+  }
+  _impl_.boundsmin_ = boundsmin;
+  if (boundsmin) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameEntityInfo.boundsMin)
+}
 inline ::Analytics::Vec3* GameEntityInfo::release_boundsmin() {
+  
+  ::Analytics::Vec3* temp = _impl_.boundsmin_;
+  _impl_.boundsmin_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameEntityInfo::unsafe_arena_release_boundsmin() {
   // @@protoc_insertion_point(field_release:Analytics.GameEntityInfo.boundsMin)
   
-  ::Analytics::Vec3* temp = boundsmin_;
-  boundsmin_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.boundsmin_;
+  _impl_.boundsmin_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameEntityInfo::_internal_mutable_boundsmin() {
   
-  if (boundsmin_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    boundsmin_ = p;
+  if (_impl_.boundsmin_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.boundsmin_ = p;
   }
-  return boundsmin_;
+  return _impl_.boundsmin_;
 }
 inline ::Analytics::Vec3* GameEntityInfo::mutable_boundsmin() {
+  ::Analytics::Vec3* _msg = _internal_mutable_boundsmin();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEntityInfo.boundsMin)
-  return _internal_mutable_boundsmin();
+  return _msg;
 }
 inline void GameEntityInfo::set_allocated_boundsmin(::Analytics::Vec3* boundsmin) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete boundsmin_;
+    delete _impl_.boundsmin_;
   }
   if (boundsmin) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(boundsmin);
     if (message_arena != submessage_arena) {
       boundsmin = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, boundsmin, submessage_arena);
@@ -9877,58 +12425,88 @@ inline void GameEntityInfo::set_allocated_boundsmin(::Analytics::Vec3* boundsmin
   } else {
     
   }
-  boundsmin_ = boundsmin;
+  _impl_.boundsmin_ = boundsmin;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityInfo.boundsMin)
 }
 
 // .Analytics.Vec3 boundsMax = 18;
 inline bool GameEntityInfo::_internal_has_boundsmax() const {
-  return this != internal_default_instance() && boundsmax_ != nullptr;
+  return this != internal_default_instance() && _impl_.boundsmax_ != nullptr;
 }
 inline bool GameEntityInfo::has_boundsmax() const {
   return _internal_has_boundsmax();
 }
 inline void GameEntityInfo::clear_boundsmax() {
-  if (GetArenaNoVirtual() == nullptr && boundsmax_ != nullptr) {
-    delete boundsmax_;
+  if (GetArenaForAllocation() == nullptr && _impl_.boundsmax_ != nullptr) {
+    delete _impl_.boundsmax_;
   }
-  boundsmax_ = nullptr;
+  _impl_.boundsmax_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameEntityInfo::_internal_boundsmax() const {
-  const ::Analytics::Vec3* p = boundsmax_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.boundsmax_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameEntityInfo::boundsmax() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.boundsMax)
   return _internal_boundsmax();
 }
+inline void GameEntityInfo::unsafe_arena_set_allocated_boundsmax(
+    ::Analytics::Vec3* boundsmax) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.boundsmax_);
+  }
+  _impl_.boundsmax_ = boundsmax;
+  if (boundsmax) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameEntityInfo.boundsMax)
+}
 inline ::Analytics::Vec3* GameEntityInfo::release_boundsmax() {
+  
+  ::Analytics::Vec3* temp = _impl_.boundsmax_;
+  _impl_.boundsmax_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameEntityInfo::unsafe_arena_release_boundsmax() {
   // @@protoc_insertion_point(field_release:Analytics.GameEntityInfo.boundsMax)
   
-  ::Analytics::Vec3* temp = boundsmax_;
-  boundsmax_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.boundsmax_;
+  _impl_.boundsmax_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameEntityInfo::_internal_mutable_boundsmax() {
   
-  if (boundsmax_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    boundsmax_ = p;
+  if (_impl_.boundsmax_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.boundsmax_ = p;
   }
-  return boundsmax_;
+  return _impl_.boundsmax_;
 }
 inline ::Analytics::Vec3* GameEntityInfo::mutable_boundsmax() {
+  ::Analytics::Vec3* _msg = _internal_mutable_boundsmax();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEntityInfo.boundsMax)
-  return _internal_mutable_boundsmax();
+  return _msg;
 }
 inline void GameEntityInfo::set_allocated_boundsmax(::Analytics::Vec3* boundsmax) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete boundsmax_;
+    delete _impl_.boundsmax_;
   }
   if (boundsmax) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(boundsmax);
     if (message_arena != submessage_arena) {
       boundsmax = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, boundsmax, submessage_arena);
@@ -9937,55 +12515,76 @@ inline void GameEntityInfo::set_allocated_boundsmax(::Analytics::Vec3* boundsmax
   } else {
     
   }
-  boundsmax_ = boundsmax;
+  _impl_.boundsmax_ = boundsmax;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityInfo.boundsMax)
 }
 
 // repeated .Analytics.GameEntityInfo.Ammo ammo = 19;
 inline int GameEntityInfo::_internal_ammo_size() const {
-  return ammo_.size();
+  return _impl_.ammo_.size();
 }
 inline int GameEntityInfo::ammo_size() const {
   return _internal_ammo_size();
 }
 inline void GameEntityInfo::clear_ammo() {
-  ammo_.Clear();
+  _impl_.ammo_.Clear();
 }
 inline ::Analytics::GameEntityInfo_Ammo* GameEntityInfo::mutable_ammo(int index) {
   // @@protoc_insertion_point(field_mutable:Analytics.GameEntityInfo.ammo)
-  return ammo_.Mutable(index);
+  return _impl_.ammo_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::GameEntityInfo_Ammo >*
 GameEntityInfo::mutable_ammo() {
   // @@protoc_insertion_point(field_mutable_list:Analytics.GameEntityInfo.ammo)
-  return &ammo_;
+  return &_impl_.ammo_;
 }
 inline const ::Analytics::GameEntityInfo_Ammo& GameEntityInfo::_internal_ammo(int index) const {
-  return ammo_.Get(index);
+  return _impl_.ammo_.Get(index);
 }
 inline const ::Analytics::GameEntityInfo_Ammo& GameEntityInfo::ammo(int index) const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.ammo)
   return _internal_ammo(index);
 }
 inline ::Analytics::GameEntityInfo_Ammo* GameEntityInfo::_internal_add_ammo() {
-  return ammo_.Add();
+  return _impl_.ammo_.Add();
 }
 inline ::Analytics::GameEntityInfo_Ammo* GameEntityInfo::add_ammo() {
+  ::Analytics::GameEntityInfo_Ammo* _add = _internal_add_ammo();
   // @@protoc_insertion_point(field_add:Analytics.GameEntityInfo.ammo)
-  return _internal_add_ammo();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Analytics::GameEntityInfo_Ammo >&
 GameEntityInfo::ammo() const {
   // @@protoc_insertion_point(field_list:Analytics.GameEntityInfo.ammo)
-  return ammo_;
+  return _impl_.ammo_;
+}
+
+// uint32 entityNameId = 20 [(.Analytics.hidden) = true];
+inline void GameEntityInfo::clear_entitynameid() {
+  _impl_.entitynameid_ = 0u;
+}
+inline uint32_t GameEntityInfo::_internal_entitynameid() const {
+  return _impl_.entitynameid_;
+}
+inline uint32_t GameEntityInfo::entitynameid() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.entityNameId)
+  return _internal_entitynameid();
+}
+inline void GameEntityInfo::_internal_set_entitynameid(uint32_t value) {
+  
+  _impl_.entitynameid_ = value;
+}
+inline void GameEntityInfo::set_entitynameid(uint32_t value) {
+  _internal_set_entitynameid(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameEntityInfo.entityNameId)
 }
 
 // bool deleted = 1000 [(.Analytics.hidden) = true];
 inline void GameEntityInfo::clear_deleted() {
-  deleted_ = false;
+  _impl_.deleted_ = false;
 }
 inline bool GameEntityInfo::_internal_deleted() const {
-  return deleted_;
+  return _impl_.deleted_;
 }
 inline bool GameEntityInfo::deleted() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityInfo.deleted)
@@ -9993,7 +12592,7 @@ inline bool GameEntityInfo::deleted() const {
 }
 inline void GameEntityInfo::_internal_set_deleted(bool value) {
   
-  deleted_ = value;
+  _impl_.deleted_ = value;
 }
 inline void GameEntityInfo::set_deleted(bool value) {
   _internal_set_deleted(value);
@@ -10006,52 +12605,82 @@ inline void GameEntityInfo::set_deleted(bool value) {
 
 // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
 inline bool GameEntityPosition::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
 inline bool GameEntityPosition::has_position() const {
   return _internal_has_position();
 }
 inline void GameEntityPosition::clear_position() {
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameEntityPosition::_internal_position() const {
-  const ::Analytics::Vec3* p = position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameEntityPosition::position() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityPosition.position)
   return _internal_position();
 }
+inline void GameEntityPosition::unsafe_arena_set_allocated_position(
+    ::Analytics::Vec3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameEntityPosition.position)
+}
 inline ::Analytics::Vec3* GameEntityPosition::release_position() {
+  
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameEntityPosition::unsafe_arena_release_position() {
   // @@protoc_insertion_point(field_release:Analytics.GameEntityPosition.position)
   
-  ::Analytics::Vec3* temp = position_;
-  position_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameEntityPosition::_internal_mutable_position() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    position_ = p;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.position_ = p;
   }
-  return position_;
+  return _impl_.position_;
 }
 inline ::Analytics::Vec3* GameEntityPosition::mutable_position() {
+  ::Analytics::Vec3* _msg = _internal_mutable_position();
   // @@protoc_insertion_point(field_mutable:Analytics.GameEntityPosition.position)
-  return _internal_mutable_position();
+  return _msg;
 }
 inline void GameEntityPosition::set_allocated_position(::Analytics::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete position_;
+    delete _impl_.position_;
   }
   if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
     if (message_arena != submessage_arena) {
       position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, position, submessage_arena);
@@ -10060,83 +12689,332 @@ inline void GameEntityPosition::set_allocated_position(::Analytics::Vec3* positi
   } else {
     
   }
-  position_ = position;
+  _impl_.position_ = position;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityPosition.position)
 }
 
 // int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
 inline void GameEntityPosition::clear_team() {
-  team_ = 0;
+  _impl_.team_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityPosition::_internal_team() const {
-  return team_;
+inline int32_t GameEntityPosition::_internal_team() const {
+  return _impl_.team_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameEntityPosition::team() const {
+inline int32_t GameEntityPosition::team() const {
   // @@protoc_insertion_point(field_get:Analytics.GameEntityPosition.team)
   return _internal_team();
 }
-inline void GameEntityPosition::_internal_set_team(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityPosition::_internal_set_team(int32_t value) {
   
-  team_ = value;
+  _impl_.team_ = value;
 }
-inline void GameEntityPosition::set_team(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameEntityPosition::set_team(int32_t value) {
   _internal_set_team(value);
   // @@protoc_insertion_point(field_set:Analytics.GameEntityPosition.team)
 }
 
+// int32 entityIndex = 3;
+inline void GameEntityPosition::clear_entityindex() {
+  _impl_.entityindex_ = 0;
+}
+inline int32_t GameEntityPosition::_internal_entityindex() const {
+  return _impl_.entityindex_;
+}
+inline int32_t GameEntityPosition::entityindex() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameEntityPosition.entityIndex)
+  return _internal_entityindex();
+}
+inline void GameEntityPosition::_internal_set_entityindex(int32_t value) {
+  
+  _impl_.entityindex_ = value;
+}
+inline void GameEntityPosition::set_entityindex(int32_t value) {
+  _internal_set_entityindex(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameEntityPosition.entityIndex)
+}
+
+// .Analytics.Vec3 velocity = 4 [(.Analytics.hidden) = true];
+inline bool GameEntityPosition::_internal_has_velocity() const {
+  return this != internal_default_instance() && _impl_.velocity_ != nullptr;
+}
+inline bool GameEntityPosition::has_velocity() const {
+  return _internal_has_velocity();
+}
+inline void GameEntityPosition::clear_velocity() {
+  if (GetArenaForAllocation() == nullptr && _impl_.velocity_ != nullptr) {
+    delete _impl_.velocity_;
+  }
+  _impl_.velocity_ = nullptr;
+}
+inline const ::Analytics::Vec3& GameEntityPosition::_internal_velocity() const {
+  const ::Analytics::Vec3* p = _impl_.velocity_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
+}
+inline const ::Analytics::Vec3& GameEntityPosition::velocity() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameEntityPosition.velocity)
+  return _internal_velocity();
+}
+inline void GameEntityPosition::unsafe_arena_set_allocated_velocity(
+    ::Analytics::Vec3* velocity) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.velocity_);
+  }
+  _impl_.velocity_ = velocity;
+  if (velocity) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameEntityPosition.velocity)
+}
+inline ::Analytics::Vec3* GameEntityPosition::release_velocity() {
+  
+  ::Analytics::Vec3* temp = _impl_.velocity_;
+  _impl_.velocity_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameEntityPosition::unsafe_arena_release_velocity() {
+  // @@protoc_insertion_point(field_release:Analytics.GameEntityPosition.velocity)
+  
+  ::Analytics::Vec3* temp = _impl_.velocity_;
+  _impl_.velocity_ = nullptr;
+  return temp;
+}
+inline ::Analytics::Vec3* GameEntityPosition::_internal_mutable_velocity() {
+  
+  if (_impl_.velocity_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.velocity_ = p;
+  }
+  return _impl_.velocity_;
+}
+inline ::Analytics::Vec3* GameEntityPosition::mutable_velocity() {
+  ::Analytics::Vec3* _msg = _internal_mutable_velocity();
+  // @@protoc_insertion_point(field_mutable:Analytics.GameEntityPosition.velocity)
+  return _msg;
+}
+inline void GameEntityPosition::set_allocated_velocity(::Analytics::Vec3* velocity) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.velocity_;
+  }
+  if (velocity) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(velocity);
+    if (message_arena != submessage_arena) {
+      velocity = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, velocity, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.velocity_ = velocity;
+  // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityPosition.velocity)
+}
+
+// int64 timeStamp = 5 [(.Analytics.hidden) = true];
+inline void GameEntityPosition::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t GameEntityPosition::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t GameEntityPosition::timestamp() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameEntityPosition.timeStamp)
+  return _internal_timestamp();
+}
+inline void GameEntityPosition::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void GameEntityPosition::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameEntityPosition.timeStamp)
+}
+
+// -------------------------------------------------------------------
+
+// GameEntityTrajectory
+
+// int32 entityIndex = 1;
+inline void GameEntityTrajectory::clear_entityindex() {
+  _impl_.entityindex_ = 0;
+}
+inline int32_t GameEntityTrajectory::_internal_entityindex() const {
+  return _impl_.entityindex_;
+}
+inline int32_t GameEntityTrajectory::entityindex() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameEntityTrajectory.entityIndex)
+  return _internal_entityindex();
+}
+inline void GameEntityTrajectory::_internal_set_entityindex(int32_t value) {
+  
+  _impl_.entityindex_ = value;
+}
+inline void GameEntityTrajectory::set_entityindex(int32_t value) {
+  _internal_set_entityindex(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameEntityTrajectory.entityIndex)
+}
+
+// int32 team = 2 [(.Analytics.enumkey) = "TEAM_ID"];
+inline void GameEntityTrajectory::clear_team() {
+  _impl_.team_ = 0;
+}
+inline int32_t GameEntityTrajectory::_internal_team() const {
+  return _impl_.team_;
+}
+inline int32_t GameEntityTrajectory::team() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameEntityTrajectory.team)
+  return _internal_team();
+}
+inline void GameEntityTrajectory::_internal_set_team(int32_t value) {
+  
+  _impl_.team_ = value;
+}
+inline void GameEntityTrajectory::set_team(int32_t value) {
+  _internal_set_team(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameEntityTrajectory.team)
+}
+
+// uint32 sampleCount = 3;
+inline void GameEntityTrajectory::clear_samplecount() {
+  _impl_.samplecount_ = 0u;
+}
+inline uint32_t GameEntityTrajectory::_internal_samplecount() const {
+  return _impl_.samplecount_;
+}
+inline uint32_t GameEntityTrajectory::samplecount() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameEntityTrajectory.sampleCount)
+  return _internal_samplecount();
+}
+inline void GameEntityTrajectory::_internal_set_samplecount(uint32_t value) {
+  
+  _impl_.samplecount_ = value;
+}
+inline void GameEntityTrajectory::set_samplecount(uint32_t value) {
+  _internal_set_samplecount(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameEntityTrajectory.sampleCount)
+}
+
+// float precision = 4;
+inline void GameEntityTrajectory::clear_precision() {
+  _impl_.precision_ = 0;
+}
+inline float GameEntityTrajectory::_internal_precision() const {
+  return _impl_.precision_;
+}
+inline float GameEntityTrajectory::precision() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameEntityTrajectory.precision)
+  return _internal_precision();
+}
+inline void GameEntityTrajectory::_internal_set_precision(float value) {
+  
+  _impl_.precision_ = value;
+}
+inline void GameEntityTrajectory::set_precision(float value) {
+  _internal_set_precision(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameEntityTrajectory.precision)
+}
+
+// bytes samples = 5;
+inline void GameEntityTrajectory::clear_samples() {
+  _impl_.samples_.ClearToEmpty();
+}
+inline const std::string& GameEntityTrajectory::samples() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameEntityTrajectory.samples)
+  return _internal_samples();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameEntityTrajectory::set_samples(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.samples_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Analytics.GameEntityTrajectory.samples)
+}
+inline std::string* GameEntityTrajectory::mutable_samples() {
+  std::string* _s = _internal_mutable_samples();
+  // @@protoc_insertion_point(field_mutable:Analytics.GameEntityTrajectory.samples)
+  return _s;
+}
+inline const std::string& GameEntityTrajectory::_internal_samples() const {
+  return _impl_.samples_.Get();
+}
+inline void GameEntityTrajectory::_internal_set_samples(const std::string& value) {
+  
+  _impl_.samples_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GameEntityTrajectory::_internal_mutable_samples() {
+  
+  return _impl_.samples_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameEntityTrajectory::release_samples() {
+  // @@protoc_insertion_point(field_release:Analytics.GameEntityTrajectory.samples)
+  return _impl_.samples_.Release();
+}
+inline void GameEntityTrajectory::set_allocated_samples(std::string* samples) {
+  if (samples != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.samples_.SetAllocated(samples, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.samples_.IsDefault()) {
+    _impl_.samples_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Analytics.GameEntityTrajectory.samples)
+}
+
 // -------------------------------------------------------------------
 
 // GameNode
 
 // string nodePath = 1 [(.Analytics.editable_key) = true];
 inline void GameNode::clear_nodepath() {
-  nodepath_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.nodepath_.ClearToEmpty();
 }
 inline const std::string& GameNode::nodepath() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNode.nodePath)
   return _internal_nodepath();
 }
-inline void GameNode::set_nodepath(const std::string& value) {
-  _internal_set_nodepath(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameNode::set_nodepath(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.nodepath_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameNode.nodePath)
 }
 inline std::string* GameNode::mutable_nodepath() {
+  std::string* _s = _internal_mutable_nodepath();
   // @@protoc_insertion_point(field_mutable:Analytics.GameNode.nodePath)
-  return _internal_mutable_nodepath();
+  return _s;
 }
 inline const std::string& GameNode::_internal_nodepath() const {
-  return nodepath_.GetNoArena();
+  return _impl_.nodepath_.Get();
 }
 inline void GameNode::_internal_set_nodepath(const std::string& value) {
   
-  nodepath_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameNode::set_nodepath(std::string&& value) {
-  
-  nodepath_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameNode.nodePath)
-}
-inline void GameNode::set_nodepath(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  nodepath_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameNode.nodePath)
-}
-inline void GameNode::set_nodepath(const char* value, size_t size) {
-  
-  nodepath_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameNode.nodePath)
+  _impl_.nodepath_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameNode::_internal_mutable_nodepath() {
   
-  return nodepath_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.nodepath_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameNode::release_nodepath() {
   // @@protoc_insertion_point(field_release:Analytics.GameNode.nodePath)
-  
-  return nodepath_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.nodepath_.Release();
 }
 inline void GameNode::set_allocated_nodepath(std::string* nodepath) {
   if (nodepath != nullptr) {
@@ -10144,58 +13022,93 @@ inline void GameNode::set_allocated_nodepath(std::string* nodepath) {
   } else {
     
   }
-  nodepath_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nodepath);
+  _impl_.nodepath_.SetAllocated(nodepath, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nodepath_.IsDefault()) {
+    _impl_.nodepath_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameNode.nodePath)
 }
 
 // .Analytics.Vec3 eulerRotation = 2;
 inline bool GameNode::_internal_has_eulerrotation() const {
-  return this != internal_default_instance() && eulerrotation_ != nullptr;
+  return this != internal_default_instance() && _impl_.eulerrotation_ != nullptr;
 }
 inline bool GameNode::has_eulerrotation() const {
   return _internal_has_eulerrotation();
 }
 inline void GameNode::clear_eulerrotation() {
-  if (GetArenaNoVirtual() == nullptr && eulerrotation_ != nullptr) {
-    delete eulerrotation_;
+  if (GetArenaForAllocation() == nullptr && _impl_.eulerrotation_ != nullptr) {
+    delete _impl_.eulerrotation_;
   }
-  eulerrotation_ = nullptr;
+  _impl_.eulerrotation_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameNode::_internal_eulerrotation() const {
-  const ::Analytics::Vec3* p = eulerrotation_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.eulerrotation_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameNode::eulerrotation() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNode.eulerRotation)
   return _internal_eulerrotation();
 }
+inline void GameNode::unsafe_arena_set_allocated_eulerrotation(
+    ::Analytics::Vec3* eulerrotation) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.eulerrotation_);
+  }
+  _impl_.eulerrotation_ = eulerrotation;
+  if (eulerrotation) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameNode.eulerRotation)
+}
 inline ::Analytics::Vec3* GameNode::release_eulerrotation() {
+  
+  ::Analytics::Vec3* temp = _impl_.eulerrotation_;
+  _impl_.eulerrotation_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameNode::unsafe_arena_release_eulerrotation() {
   // @@protoc_insertion_point(field_release:Analytics.GameNode.eulerRotation)
   
-  ::Analytics::Vec3* temp = eulerrotation_;
-  eulerrotation_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.eulerrotation_;
+  _impl_.eulerrotation_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameNode::_internal_mutable_eulerrotation() {
   
-  if (eulerrotation_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    eulerrotation_ = p;
+  if (_impl_.eulerrotation_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.eulerrotation_ = p;
   }
-  return eulerrotation_;
+  return _impl_.eulerrotation_;
 }
 inline ::Analytics::Vec3* GameNode::mutable_eulerrotation() {
+  ::Analytics::Vec3* _msg = _internal_mutable_eulerrotation();
   // @@protoc_insertion_point(field_mutable:Analytics.GameNode.eulerRotation)
-  return _internal_mutable_eulerrotation();
+  return _msg;
 }
 inline void GameNode::set_allocated_eulerrotation(::Analytics::Vec3* eulerrotation) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete eulerrotation_;
+    delete _impl_.eulerrotation_;
   }
   if (eulerrotation) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(eulerrotation);
     if (message_arena != submessage_arena) {
       eulerrotation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, eulerrotation, submessage_arena);
@@ -10204,58 +13117,88 @@ inline void GameNode::set_allocated_eulerrotation(::Analytics::Vec3* eulerrotati
   } else {
     
   }
-  eulerrotation_ = eulerrotation;
+  _impl_.eulerrotation_ = eulerrotation;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameNode.eulerRotation)
 }
 
 // .Analytics.Vec3 translation = 3;
 inline bool GameNode::_internal_has_translation() const {
-  return this != internal_default_instance() && translation_ != nullptr;
+  return this != internal_default_instance() && _impl_.translation_ != nullptr;
 }
 inline bool GameNode::has_translation() const {
   return _internal_has_translation();
 }
 inline void GameNode::clear_translation() {
-  if (GetArenaNoVirtual() == nullptr && translation_ != nullptr) {
-    delete translation_;
+  if (GetArenaForAllocation() == nullptr && _impl_.translation_ != nullptr) {
+    delete _impl_.translation_;
   }
-  translation_ = nullptr;
+  _impl_.translation_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameNode::_internal_translation() const {
-  const ::Analytics::Vec3* p = translation_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.translation_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameNode::translation() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNode.translation)
   return _internal_translation();
 }
+inline void GameNode::unsafe_arena_set_allocated_translation(
+    ::Analytics::Vec3* translation) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.translation_);
+  }
+  _impl_.translation_ = translation;
+  if (translation) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameNode.translation)
+}
 inline ::Analytics::Vec3* GameNode::release_translation() {
+  
+  ::Analytics::Vec3* temp = _impl_.translation_;
+  _impl_.translation_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameNode::unsafe_arena_release_translation() {
   // @@protoc_insertion_point(field_release:Analytics.GameNode.translation)
   
-  ::Analytics::Vec3* temp = translation_;
-  translation_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.translation_;
+  _impl_.translation_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameNode::_internal_mutable_translation() {
   
-  if (translation_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    translation_ = p;
+  if (_impl_.translation_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.translation_ = p;
   }
-  return translation_;
+  return _impl_.translation_;
 }
 inline ::Analytics::Vec3* GameNode::mutable_translation() {
+  ::Analytics::Vec3* _msg = _internal_mutable_translation();
   // @@protoc_insertion_point(field_mutable:Analytics.GameNode.translation)
-  return _internal_mutable_translation();
+  return _msg;
 }
 inline void GameNode::set_allocated_translation(::Analytics::Vec3* translation) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete translation_;
+    delete _impl_.translation_;
   }
   if (translation) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(translation);
     if (message_arena != submessage_arena) {
       translation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, translation, submessage_arena);
@@ -10264,59 +13207,44 @@ inline void GameNode::set_allocated_translation(::Analytics::Vec3* translation)
   } else {
     
   }
-  translation_ = translation;
+  _impl_.translation_ = translation;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameNode.translation)
 }
 
 // string meshName = 4;
 inline void GameNode::clear_meshname() {
-  meshname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.meshname_.ClearToEmpty();
 }
 inline const std::string& GameNode::meshname() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNode.meshName)
   return _internal_meshname();
 }
-inline void GameNode::set_meshname(const std::string& value) {
-  _internal_set_meshname(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameNode::set_meshname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.meshname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameNode.meshName)
 }
 inline std::string* GameNode::mutable_meshname() {
+  std::string* _s = _internal_mutable_meshname();
   // @@protoc_insertion_point(field_mutable:Analytics.GameNode.meshName)
-  return _internal_mutable_meshname();
+  return _s;
 }
 inline const std::string& GameNode::_internal_meshname() const {
-  return meshname_.GetNoArena();
+  return _impl_.meshname_.Get();
 }
 inline void GameNode::_internal_set_meshname(const std::string& value) {
   
-  meshname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameNode::set_meshname(std::string&& value) {
-  
-  meshname_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameNode.meshName)
-}
-inline void GameNode::set_meshname(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  meshname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameNode.meshName)
-}
-inline void GameNode::set_meshname(const char* value, size_t size) {
-  
-  meshname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameNode.meshName)
+  _impl_.meshname_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameNode::_internal_mutable_meshname() {
   
-  return meshname_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.meshname_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameNode::release_meshname() {
   // @@protoc_insertion_point(field_release:Analytics.GameNode.meshName)
-  
-  return meshname_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.meshname_.Release();
 }
 inline void GameNode::set_allocated_meshname(std::string* meshname) {
   if (meshname != nullptr) {
@@ -10324,79 +13252,69 @@ inline void GameNode::set_allocated_meshname(std::string* meshname) {
   } else {
     
   }
-  meshname_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), meshname);
+  _impl_.meshname_.SetAllocated(meshname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.meshname_.IsDefault()) {
+    _impl_.meshname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameNode.meshName)
 }
 
 // int32 entityId = 10;
 inline void GameNode::clear_entityid() {
-  entityid_ = 0;
+  _impl_.entityid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameNode::_internal_entityid() const {
-  return entityid_;
+inline int32_t GameNode::_internal_entityid() const {
+  return _impl_.entityid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameNode::entityid() const {
+inline int32_t GameNode::entityid() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNode.entityId)
   return _internal_entityid();
 }
-inline void GameNode::_internal_set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameNode::_internal_set_entityid(int32_t value) {
   
-  entityid_ = value;
+  _impl_.entityid_ = value;
 }
-inline void GameNode::set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameNode::set_entityid(int32_t value) {
   _internal_set_entityid(value);
   // @@protoc_insertion_point(field_set:Analytics.GameNode.entityId)
 }
 
-// string entityName = 11;
+// string entityName = 11 [(.Analytics.intern) = "entityNameId"];
 inline void GameNode::clear_entityname() {
-  entityname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.entityname_.ClearToEmpty();
 }
 inline const std::string& GameNode::entityname() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNode.entityName)
   return _internal_entityname();
 }
-inline void GameNode::set_entityname(const std::string& value) {
-  _internal_set_entityname(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameNode::set_entityname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.entityname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameNode.entityName)
 }
 inline std::string* GameNode::mutable_entityname() {
+  std::string* _s = _internal_mutable_entityname();
   // @@protoc_insertion_point(field_mutable:Analytics.GameNode.entityName)
-  return _internal_mutable_entityname();
+  return _s;
 }
 inline const std::string& GameNode::_internal_entityname() const {
-  return entityname_.GetNoArena();
+  return _impl_.entityname_.Get();
 }
 inline void GameNode::_internal_set_entityname(const std::string& value) {
   
-  entityname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameNode::set_entityname(std::string&& value) {
-  
-  entityname_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameNode.entityName)
-}
-inline void GameNode::set_entityname(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  entityname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameNode.entityName)
-}
-inline void GameNode::set_entityname(const char* value, size_t size) {
-  
-  entityname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameNode.entityName)
+  _impl_.entityname_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameNode::_internal_mutable_entityname() {
   
-  return entityname_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.entityname_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameNode::release_entityname() {
   // @@protoc_insertion_point(field_release:Analytics.GameNode.entityName)
-  
-  return entityname_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.entityname_.Release();
 }
 inline void GameNode::set_allocated_entityname(std::string* entityname) {
   if (entityname != nullptr) {
@@ -10404,142 +13322,197 @@ inline void GameNode::set_allocated_entityname(std::string* entityname) {
   } else {
     
   }
-  entityname_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), entityname);
+  _impl_.entityname_.SetAllocated(entityname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.entityname_.IsDefault()) {
+    _impl_.entityname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameNode.entityName)
 }
 
 // int32 activeState = 12 [(.Analytics.enumkey) = "MODEL_STATE"];
 inline void GameNode::clear_activestate() {
-  activestate_ = 0;
+  _impl_.activestate_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameNode::_internal_activestate() const {
-  return activestate_;
+inline int32_t GameNode::_internal_activestate() const {
+  return _impl_.activestate_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameNode::activestate() const {
+inline int32_t GameNode::activestate() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNode.activeState)
   return _internal_activestate();
 }
-inline void GameNode::_internal_set_activestate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameNode::_internal_set_activestate(int32_t value) {
   
-  activestate_ = value;
+  _impl_.activestate_ = value;
 }
-inline void GameNode::set_activestate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameNode::set_activestate(int32_t value) {
   _internal_set_activestate(value);
   // @@protoc_insertion_point(field_set:Analytics.GameNode.activeState)
 }
 
 // int64 navFlagsActive = 13 [(.Analytics.enumkey) = "NAV_FLAGS"];
 inline void GameNode::clear_navflagsactive() {
-  navflagsactive_ = PROTOBUF_LONGLONG(0);
+  _impl_.navflagsactive_ = int64_t{0};
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 GameNode::_internal_navflagsactive() const {
-  return navflagsactive_;
+inline int64_t GameNode::_internal_navflagsactive() const {
+  return _impl_.navflagsactive_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 GameNode::navflagsactive() const {
+inline int64_t GameNode::navflagsactive() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNode.navFlagsActive)
   return _internal_navflagsactive();
 }
-inline void GameNode::_internal_set_navflagsactive(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void GameNode::_internal_set_navflagsactive(int64_t value) {
   
-  navflagsactive_ = value;
+  _impl_.navflagsactive_ = value;
 }
-inline void GameNode::set_navflagsactive(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void GameNode::set_navflagsactive(int64_t value) {
   _internal_set_navflagsactive(value);
   // @@protoc_insertion_point(field_set:Analytics.GameNode.navFlagsActive)
 }
 
 // int64 navFlagsOverride = 14 [(.Analytics.enumkey) = "NAV_FLAGS", (.Analytics.editable) = true];
 inline void GameNode::clear_navflagsoverride() {
-  navflagsoverride_ = PROTOBUF_LONGLONG(0);
+  _impl_.navflagsoverride_ = int64_t{0};
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 GameNode::_internal_navflagsoverride() const {
-  return navflagsoverride_;
+inline int64_t GameNode::_internal_navflagsoverride() const {
+  return _impl_.navflagsoverride_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 GameNode::navflagsoverride() const {
+inline int64_t GameNode::navflagsoverride() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNode.navFlagsOverride)
   return _internal_navflagsoverride();
 }
-inline void GameNode::_internal_set_navflagsoverride(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void GameNode::_internal_set_navflagsoverride(int64_t value) {
   
-  navflagsoverride_ = value;
+  _impl_.navflagsoverride_ = value;
 }
-inline void GameNode::set_navflagsoverride(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void GameNode::set_navflagsoverride(int64_t value) {
   _internal_set_navflagsoverride(value);
   // @@protoc_insertion_point(field_set:Analytics.GameNode.navFlagsOverride)
 }
 
 // int32 shapeMode = 15 [(.Analytics.enumkey) = "SHAPEMODE", (.Analytics.editable) = true];
 inline void GameNode::clear_shapemode() {
-  shapemode_ = 0;
+  _impl_.shapemode_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameNode::_internal_shapemode() const {
-  return shapemode_;
+inline int32_t GameNode::_internal_shapemode() const {
+  return _impl_.shapemode_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameNode::shapemode() const {
+inline int32_t GameNode::shapemode() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNode.shapeMode)
   return _internal_shapemode();
 }
-inline void GameNode::_internal_set_shapemode(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameNode::_internal_set_shapemode(int32_t value) {
   
-  shapemode_ = value;
+  _impl_.shapemode_ = value;
 }
-inline void GameNode::set_shapemode(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameNode::set_shapemode(int32_t value) {
   _internal_set_shapemode(value);
   // @@protoc_insertion_point(field_set:Analytics.GameNode.shapeMode)
 }
 
+// uint32 entityNameId = 16 [(.Analytics.hidden) = true];
+inline void GameNode::clear_entitynameid() {
+  _impl_.entitynameid_ = 0u;
+}
+inline uint32_t GameNode::_internal_entitynameid() const {
+  return _impl_.entitynameid_;
+}
+inline uint32_t GameNode::entitynameid() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameNode.entityNameId)
+  return _internal_entitynameid();
+}
+inline void GameNode::_internal_set_entitynameid(uint32_t value) {
+  
+  _impl_.entitynameid_ = value;
+}
+inline void GameNode::set_entitynameid(uint32_t value) {
+  _internal_set_entitynameid(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameNode.entityNameId)
+}
+
 // -------------------------------------------------------------------
 
 // GameWeaponFired
 
 // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
 inline bool GameWeaponFired::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
 inline bool GameWeaponFired::has_position() const {
   return _internal_has_position();
 }
 inline void GameWeaponFired::clear_position() {
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameWeaponFired::_internal_position() const {
-  const ::Analytics::Vec3* p = position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameWeaponFired::position() const {
   // @@protoc_insertion_point(field_get:Analytics.GameWeaponFired.position)
   return _internal_position();
 }
+inline void GameWeaponFired::unsafe_arena_set_allocated_position(
+    ::Analytics::Vec3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameWeaponFired.position)
+}
 inline ::Analytics::Vec3* GameWeaponFired::release_position() {
+  
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameWeaponFired::unsafe_arena_release_position() {
   // @@protoc_insertion_point(field_release:Analytics.GameWeaponFired.position)
   
-  ::Analytics::Vec3* temp = position_;
-  position_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameWeaponFired::_internal_mutable_position() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    position_ = p;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.position_ = p;
   }
-  return position_;
+  return _impl_.position_;
 }
 inline ::Analytics::Vec3* GameWeaponFired::mutable_position() {
+  ::Analytics::Vec3* _msg = _internal_mutable_position();
   // @@protoc_insertion_point(field_mutable:Analytics.GameWeaponFired.position)
-  return _internal_mutable_position();
+  return _msg;
 }
 inline void GameWeaponFired::set_allocated_position(::Analytics::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete position_;
+    delete _impl_.position_;
   }
   if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
     if (message_arena != submessage_arena) {
       position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, position, submessage_arena);
@@ -10548,122 +13521,242 @@ inline void GameWeaponFired::set_allocated_position(::Analytics::Vec3* position)
   } else {
     
   }
-  position_ = position;
+  _impl_.position_ = position;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameWeaponFired.position)
 }
 
 // int32 attackTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
 inline void GameWeaponFired::clear_attackteam() {
-  attackteam_ = 0;
+  _impl_.attackteam_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameWeaponFired::_internal_attackteam() const {
-  return attackteam_;
+inline int32_t GameWeaponFired::_internal_attackteam() const {
+  return _impl_.attackteam_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameWeaponFired::attackteam() const {
+inline int32_t GameWeaponFired::attackteam() const {
   // @@protoc_insertion_point(field_get:Analytics.GameWeaponFired.attackTeam)
   return _internal_attackteam();
 }
-inline void GameWeaponFired::_internal_set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameWeaponFired::_internal_set_attackteam(int32_t value) {
   
-  attackteam_ = value;
+  _impl_.attackteam_ = value;
 }
-inline void GameWeaponFired::set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameWeaponFired::set_attackteam(int32_t value) {
   _internal_set_attackteam(value);
   // @@protoc_insertion_point(field_set:Analytics.GameWeaponFired.attackTeam)
 }
 
 // int32 weaponId = 3 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
 inline void GameWeaponFired::clear_weaponid() {
-  weaponid_ = 0;
+  _impl_.weaponid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameWeaponFired::_internal_weaponid() const {
-  return weaponid_;
+inline int32_t GameWeaponFired::_internal_weaponid() const {
+  return _impl_.weaponid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameWeaponFired::weaponid() const {
+inline int32_t GameWeaponFired::weaponid() const {
   // @@protoc_insertion_point(field_get:Analytics.GameWeaponFired.weaponId)
   return _internal_weaponid();
 }
-inline void GameWeaponFired::_internal_set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameWeaponFired::_internal_set_weaponid(int32_t value) {
   
-  weaponid_ = value;
+  _impl_.weaponid_ = value;
 }
-inline void GameWeaponFired::set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameWeaponFired::set_weaponid(int32_t value) {
   _internal_set_weaponid(value);
   // @@protoc_insertion_point(field_set:Analytics.GameWeaponFired.weaponId)
 }
 
 // int32 firedByClass = 4 [(.Analytics.enumkey) = "CLASS_ID", (.Analytics.track_event) = true];
 inline void GameWeaponFired::clear_firedbyclass() {
-  firedbyclass_ = 0;
+  _impl_.firedbyclass_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameWeaponFired::_internal_firedbyclass() const {
-  return firedbyclass_;
+inline int32_t GameWeaponFired::_internal_firedbyclass() const {
+  return _impl_.firedbyclass_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameWeaponFired::firedbyclass() const {
+inline int32_t GameWeaponFired::firedbyclass() const {
   // @@protoc_insertion_point(field_get:Analytics.GameWeaponFired.firedByClass)
   return _internal_firedbyclass();
 }
-inline void GameWeaponFired::_internal_set_firedbyclass(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameWeaponFired::_internal_set_firedbyclass(int32_t value) {
   
-  firedbyclass_ = value;
+  _impl_.firedbyclass_ = value;
 }
-inline void GameWeaponFired::set_firedbyclass(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameWeaponFired::set_firedbyclass(int32_t value) {
   _internal_set_firedbyclass(value);
   // @@protoc_insertion_point(field_set:Analytics.GameWeaponFired.firedByClass)
 }
 
+// .Analytics.Line trace = 5 [(.Analytics.line_event) = {
+inline bool GameWeaponFired::_internal_has_trace() const {
+  return this != internal_default_instance() && _impl_.trace_ != nullptr;
+}
+inline bool GameWeaponFired::has_trace() const {
+  return _internal_has_trace();
+}
+inline void GameWeaponFired::clear_trace() {
+  if (GetArenaForAllocation() == nullptr && _impl_.trace_ != nullptr) {
+    delete _impl_.trace_;
+  }
+  _impl_.trace_ = nullptr;
+}
+inline const ::Analytics::Line& GameWeaponFired::_internal_trace() const {
+  const ::Analytics::Line* p = _impl_.trace_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Line&>(
+      ::Analytics::_Line_default_instance_);
+}
+inline const ::Analytics::Line& GameWeaponFired::trace() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameWeaponFired.trace)
+  return _internal_trace();
+}
+inline void GameWeaponFired::unsafe_arena_set_allocated_trace(
+    ::Analytics::Line* trace) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.trace_);
+  }
+  _impl_.trace_ = trace;
+  if (trace) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameWeaponFired.trace)
+}
+inline ::Analytics::Line* GameWeaponFired::release_trace() {
+  
+  ::Analytics::Line* temp = _impl_.trace_;
+  _impl_.trace_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Line* GameWeaponFired::unsafe_arena_release_trace() {
+  // @@protoc_insertion_point(field_release:Analytics.GameWeaponFired.trace)
+  
+  ::Analytics::Line* temp = _impl_.trace_;
+  _impl_.trace_ = nullptr;
+  return temp;
+}
+inline ::Analytics::Line* GameWeaponFired::_internal_mutable_trace() {
+  
+  if (_impl_.trace_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Line>(GetArenaForAllocation());
+    _impl_.trace_ = p;
+  }
+  return _impl_.trace_;
+}
+inline ::Analytics::Line* GameWeaponFired::mutable_trace() {
+  ::Analytics::Line* _msg = _internal_mutable_trace();
+  // @@protoc_insertion_point(field_mutable:Analytics.GameWeaponFired.trace)
+  return _msg;
+}
+inline void GameWeaponFired::set_allocated_trace(::Analytics::Line* trace) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.trace_;
+  }
+  if (trace) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(trace);
+    if (message_arena != submessage_arena) {
+      trace = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, trace, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.trace_ = trace;
+  // @@protoc_insertion_point(field_set_allocated:Analytics.GameWeaponFired.trace)
+}
+
 // -------------------------------------------------------------------
 
 // GameDeath
 
 // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
 inline bool GameDeath::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
 inline bool GameDeath::has_position() const {
   return _internal_has_position();
 }
 inline void GameDeath::clear_position() {
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameDeath::_internal_position() const {
-  const ::Analytics::Vec3* p = position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameDeath::position() const {
   // @@protoc_insertion_point(field_get:Analytics.GameDeath.position)
   return _internal_position();
 }
+inline void GameDeath::unsafe_arena_set_allocated_position(
+    ::Analytics::Vec3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameDeath.position)
+}
 inline ::Analytics::Vec3* GameDeath::release_position() {
+  
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameDeath::unsafe_arena_release_position() {
   // @@protoc_insertion_point(field_release:Analytics.GameDeath.position)
   
-  ::Analytics::Vec3* temp = position_;
-  position_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameDeath::_internal_mutable_position() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    position_ = p;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.position_ = p;
   }
-  return position_;
+  return _impl_.position_;
 }
 inline ::Analytics::Vec3* GameDeath::mutable_position() {
+  ::Analytics::Vec3* _msg = _internal_mutable_position();
   // @@protoc_insertion_point(field_mutable:Analytics.GameDeath.position)
-  return _internal_mutable_position();
+  return _msg;
 }
 inline void GameDeath::set_allocated_position(::Analytics::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete position_;
+    delete _impl_.position_;
   }
   if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
     if (message_arena != submessage_arena) {
       position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, position, submessage_arena);
@@ -10672,99 +13765,84 @@ inline void GameDeath::set_allocated_position(::Analytics::Vec3* position) {
   } else {
     
   }
-  position_ = position;
+  _impl_.position_ = position;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameDeath.position)
 }
 
 // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
 inline void GameDeath::clear_victimteam() {
-  victimteam_ = 0;
+  _impl_.victimteam_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameDeath::_internal_victimteam() const {
-  return victimteam_;
+inline int32_t GameDeath::_internal_victimteam() const {
+  return _impl_.victimteam_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameDeath::victimteam() const {
+inline int32_t GameDeath::victimteam() const {
   // @@protoc_insertion_point(field_get:Analytics.GameDeath.victimTeam)
   return _internal_victimteam();
 }
-inline void GameDeath::_internal_set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameDeath::_internal_set_victimteam(int32_t value) {
   
-  victimteam_ = value;
+  _impl_.victimteam_ = value;
 }
-inline void GameDeath::set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameDeath::set_victimteam(int32_t value) {
   _internal_set_victimteam(value);
   // @@protoc_insertion_point(field_set:Analytics.GameDeath.victimTeam)
 }
 
 // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
 inline void GameDeath::clear_attackteam() {
-  attackteam_ = 0;
+  _impl_.attackteam_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameDeath::_internal_attackteam() const {
-  return attackteam_;
+inline int32_t GameDeath::_internal_attackteam() const {
+  return _impl_.attackteam_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameDeath::attackteam() const {
+inline int32_t GameDeath::attackteam() const {
   // @@protoc_insertion_point(field_get:Analytics.GameDeath.attackTeam)
   return _internal_attackteam();
 }
-inline void GameDeath::_internal_set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameDeath::_internal_set_attackteam(int32_t value) {
   
-  attackteam_ = value;
+  _impl_.attackteam_ = value;
 }
-inline void GameDeath::set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameDeath::set_attackteam(int32_t value) {
   _internal_set_attackteam(value);
   // @@protoc_insertion_point(field_set:Analytics.GameDeath.attackTeam)
 }
 
-// string meansOfDeath = 4 [(.Analytics.track_event) = true];
+// string meansOfDeath = 4 [(.Analytics.track_event) = true, (.Analytics.intern) = "meansOfDeathId"];
 inline void GameDeath::clear_meansofdeath() {
-  meansofdeath_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.meansofdeath_.ClearToEmpty();
 }
 inline const std::string& GameDeath::meansofdeath() const {
   // @@protoc_insertion_point(field_get:Analytics.GameDeath.meansOfDeath)
   return _internal_meansofdeath();
 }
-inline void GameDeath::set_meansofdeath(const std::string& value) {
-  _internal_set_meansofdeath(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameDeath::set_meansofdeath(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.meansofdeath_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameDeath.meansOfDeath)
 }
 inline std::string* GameDeath::mutable_meansofdeath() {
+  std::string* _s = _internal_mutable_meansofdeath();
   // @@protoc_insertion_point(field_mutable:Analytics.GameDeath.meansOfDeath)
-  return _internal_mutable_meansofdeath();
+  return _s;
 }
 inline const std::string& GameDeath::_internal_meansofdeath() const {
-  return meansofdeath_.GetNoArena();
+  return _impl_.meansofdeath_.Get();
 }
 inline void GameDeath::_internal_set_meansofdeath(const std::string& value) {
   
-  meansofdeath_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameDeath::set_meansofdeath(std::string&& value) {
-  
-  meansofdeath_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameDeath.meansOfDeath)
-}
-inline void GameDeath::set_meansofdeath(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  meansofdeath_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameDeath.meansOfDeath)
-}
-inline void GameDeath::set_meansofdeath(const char* value, size_t size) {
-  
-  meansofdeath_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameDeath.meansOfDeath)
+  _impl_.meansofdeath_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameDeath::_internal_mutable_meansofdeath() {
   
-  return meansofdeath_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.meansofdeath_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameDeath::release_meansofdeath() {
   // @@protoc_insertion_point(field_release:Analytics.GameDeath.meansOfDeath)
-  
-  return meansofdeath_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.meansofdeath_.Release();
 }
 inline void GameDeath::set_allocated_meansofdeath(std::string* meansofdeath) {
   if (meansofdeath != nullptr) {
@@ -10772,62 +13850,117 @@ inline void GameDeath::set_allocated_meansofdeath(std::string* meansofdeath) {
   } else {
     
   }
-  meansofdeath_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), meansofdeath);
+  _impl_.meansofdeath_.SetAllocated(meansofdeath, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.meansofdeath_.IsDefault()) {
+    _impl_.meansofdeath_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameDeath.meansOfDeath)
 }
 
+// uint32 meansOfDeathId = 5 [(.Analytics.hidden) = true];
+inline void GameDeath::clear_meansofdeathid() {
+  _impl_.meansofdeathid_ = 0u;
+}
+inline uint32_t GameDeath::_internal_meansofdeathid() const {
+  return _impl_.meansofdeathid_;
+}
+inline uint32_t GameDeath::meansofdeathid() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameDeath.meansOfDeathId)
+  return _internal_meansofdeathid();
+}
+inline void GameDeath::_internal_set_meansofdeathid(uint32_t value) {
+  
+  _impl_.meansofdeathid_ = value;
+}
+inline void GameDeath::set_meansofdeathid(uint32_t value) {
+  _internal_set_meansofdeathid(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameDeath.meansOfDeathId)
+}
+
 // -------------------------------------------------------------------
 
 // GameKilledSomeone
 
 // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
 inline bool GameKilledSomeone::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
 inline bool GameKilledSomeone::has_position() const {
   return _internal_has_position();
 }
 inline void GameKilledSomeone::clear_position() {
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameKilledSomeone::_internal_position() const {
-  const ::Analytics::Vec3* p = position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameKilledSomeone::position() const {
   // @@protoc_insertion_point(field_get:Analytics.GameKilledSomeone.position)
   return _internal_position();
 }
+inline void GameKilledSomeone::unsafe_arena_set_allocated_position(
+    ::Analytics::Vec3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameKilledSomeone.position)
+}
 inline ::Analytics::Vec3* GameKilledSomeone::release_position() {
+  
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameKilledSomeone::unsafe_arena_release_position() {
   // @@protoc_insertion_point(field_release:Analytics.GameKilledSomeone.position)
   
-  ::Analytics::Vec3* temp = position_;
-  position_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameKilledSomeone::_internal_mutable_position() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    position_ = p;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.position_ = p;
   }
-  return position_;
+  return _impl_.position_;
 }
 inline ::Analytics::Vec3* GameKilledSomeone::mutable_position() {
+  ::Analytics::Vec3* _msg = _internal_mutable_position();
   // @@protoc_insertion_point(field_mutable:Analytics.GameKilledSomeone.position)
-  return _internal_mutable_position();
+  return _msg;
 }
 inline void GameKilledSomeone::set_allocated_position(::Analytics::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete position_;
+    delete _impl_.position_;
   }
   if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
     if (message_arena != submessage_arena) {
       position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, position, submessage_arena);
@@ -10836,99 +13969,84 @@ inline void GameKilledSomeone::set_allocated_position(::Analytics::Vec3* positio
   } else {
     
   }
-  position_ = position;
+  _impl_.position_ = position;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameKilledSomeone.position)
 }
 
 // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
 inline void GameKilledSomeone::clear_victimteam() {
-  victimteam_ = 0;
+  _impl_.victimteam_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameKilledSomeone::_internal_victimteam() const {
-  return victimteam_;
+inline int32_t GameKilledSomeone::_internal_victimteam() const {
+  return _impl_.victimteam_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameKilledSomeone::victimteam() const {
+inline int32_t GameKilledSomeone::victimteam() const {
   // @@protoc_insertion_point(field_get:Analytics.GameKilledSomeone.victimTeam)
   return _internal_victimteam();
 }
-inline void GameKilledSomeone::_internal_set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameKilledSomeone::_internal_set_victimteam(int32_t value) {
   
-  victimteam_ = value;
+  _impl_.victimteam_ = value;
 }
-inline void GameKilledSomeone::set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameKilledSomeone::set_victimteam(int32_t value) {
   _internal_set_victimteam(value);
   // @@protoc_insertion_point(field_set:Analytics.GameKilledSomeone.victimTeam)
 }
 
 // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
 inline void GameKilledSomeone::clear_attackteam() {
-  attackteam_ = 0;
+  _impl_.attackteam_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameKilledSomeone::_internal_attackteam() const {
-  return attackteam_;
+inline int32_t GameKilledSomeone::_internal_attackteam() const {
+  return _impl_.attackteam_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameKilledSomeone::attackteam() const {
+inline int32_t GameKilledSomeone::attackteam() const {
   // @@protoc_insertion_point(field_get:Analytics.GameKilledSomeone.attackTeam)
   return _internal_attackteam();
 }
-inline void GameKilledSomeone::_internal_set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameKilledSomeone::_internal_set_attackteam(int32_t value) {
   
-  attackteam_ = value;
+  _impl_.attackteam_ = value;
 }
-inline void GameKilledSomeone::set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameKilledSomeone::set_attackteam(int32_t value) {
   _internal_set_attackteam(value);
   // @@protoc_insertion_point(field_set:Analytics.GameKilledSomeone.attackTeam)
 }
 
-// string meansOfDeath = 4 [(.Analytics.track_event) = true];
+// string meansOfDeath = 4 [(.Analytics.track_event) = true, (.Analytics.intern) = "meansOfDeathId"];
 inline void GameKilledSomeone::clear_meansofdeath() {
-  meansofdeath_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.meansofdeath_.ClearToEmpty();
 }
 inline const std::string& GameKilledSomeone::meansofdeath() const {
   // @@protoc_insertion_point(field_get:Analytics.GameKilledSomeone.meansOfDeath)
   return _internal_meansofdeath();
 }
-inline void GameKilledSomeone::set_meansofdeath(const std::string& value) {
-  _internal_set_meansofdeath(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameKilledSomeone::set_meansofdeath(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.meansofdeath_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameKilledSomeone.meansOfDeath)
 }
 inline std::string* GameKilledSomeone::mutable_meansofdeath() {
+  std::string* _s = _internal_mutable_meansofdeath();
   // @@protoc_insertion_point(field_mutable:Analytics.GameKilledSomeone.meansOfDeath)
-  return _internal_mutable_meansofdeath();
+  return _s;
 }
 inline const std::string& GameKilledSomeone::_internal_meansofdeath() const {
-  return meansofdeath_.GetNoArena();
+  return _impl_.meansofdeath_.Get();
 }
 inline void GameKilledSomeone::_internal_set_meansofdeath(const std::string& value) {
   
-  meansofdeath_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameKilledSomeone::set_meansofdeath(std::string&& value) {
-  
-  meansofdeath_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameKilledSomeone.meansOfDeath)
-}
-inline void GameKilledSomeone::set_meansofdeath(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  meansofdeath_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameKilledSomeone.meansOfDeath)
-}
-inline void GameKilledSomeone::set_meansofdeath(const char* value, size_t size) {
-  
-  meansofdeath_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameKilledSomeone.meansOfDeath)
+  _impl_.meansofdeath_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameKilledSomeone::_internal_mutable_meansofdeath() {
   
-  return meansofdeath_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.meansofdeath_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameKilledSomeone::release_meansofdeath() {
   // @@protoc_insertion_point(field_release:Analytics.GameKilledSomeone.meansOfDeath)
-  
-  return meansofdeath_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.meansofdeath_.Release();
 }
 inline void GameKilledSomeone::set_allocated_meansofdeath(std::string* meansofdeath) {
   if (meansofdeath != nullptr) {
@@ -10936,62 +14054,117 @@ inline void GameKilledSomeone::set_allocated_meansofdeath(std::string* meansofde
   } else {
     
   }
-  meansofdeath_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), meansofdeath);
+  _impl_.meansofdeath_.SetAllocated(meansofdeath, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.meansofdeath_.IsDefault()) {
+    _impl_.meansofdeath_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameKilledSomeone.meansOfDeath)
 }
 
+// uint32 meansOfDeathId = 5 [(.Analytics.hidden) = true];
+inline void GameKilledSomeone::clear_meansofdeathid() {
+  _impl_.meansofdeathid_ = 0u;
+}
+inline uint32_t GameKilledSomeone::_internal_meansofdeathid() const {
+  return _impl_.meansofdeathid_;
+}
+inline uint32_t GameKilledSomeone::meansofdeathid() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameKilledSomeone.meansOfDeathId)
+  return _internal_meansofdeathid();
+}
+inline void GameKilledSomeone::_internal_set_meansofdeathid(uint32_t value) {
+  
+  _impl_.meansofdeathid_ = value;
+}
+inline void GameKilledSomeone::set_meansofdeathid(uint32_t value) {
+  _internal_set_meansofdeathid(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameKilledSomeone.meansOfDeathId)
+}
+
 // -------------------------------------------------------------------
 
 // GameRecieveDamage
 
 // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
 inline bool GameRecieveDamage::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
 inline bool GameRecieveDamage::has_position() const {
   return _internal_has_position();
 }
 inline void GameRecieveDamage::clear_position() {
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameRecieveDamage::_internal_position() const {
-  const ::Analytics::Vec3* p = position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameRecieveDamage::position() const {
   // @@protoc_insertion_point(field_get:Analytics.GameRecieveDamage.position)
   return _internal_position();
 }
+inline void GameRecieveDamage::unsafe_arena_set_allocated_position(
+    ::Analytics::Vec3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameRecieveDamage.position)
+}
 inline ::Analytics::Vec3* GameRecieveDamage::release_position() {
+  
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameRecieveDamage::unsafe_arena_release_position() {
   // @@protoc_insertion_point(field_release:Analytics.GameRecieveDamage.position)
   
-  ::Analytics::Vec3* temp = position_;
-  position_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameRecieveDamage::_internal_mutable_position() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    position_ = p;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.position_ = p;
   }
-  return position_;
+  return _impl_.position_;
 }
 inline ::Analytics::Vec3* GameRecieveDamage::mutable_position() {
+  ::Analytics::Vec3* _msg = _internal_mutable_position();
   // @@protoc_insertion_point(field_mutable:Analytics.GameRecieveDamage.position)
-  return _internal_mutable_position();
+  return _msg;
 }
 inline void GameRecieveDamage::set_allocated_position(::Analytics::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete position_;
+    delete _impl_.position_;
   }
   if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
     if (message_arena != submessage_arena) {
       position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, position, submessage_arena);
@@ -11000,119 +14173,104 @@ inline void GameRecieveDamage::set_allocated_position(::Analytics::Vec3* positio
   } else {
     
   }
-  position_ = position;
+  _impl_.position_ = position;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameRecieveDamage.position)
 }
 
 // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
 inline void GameRecieveDamage::clear_victimteam() {
-  victimteam_ = 0;
+  _impl_.victimteam_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameRecieveDamage::_internal_victimteam() const {
-  return victimteam_;
+inline int32_t GameRecieveDamage::_internal_victimteam() const {
+  return _impl_.victimteam_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameRecieveDamage::victimteam() const {
+inline int32_t GameRecieveDamage::victimteam() const {
   // @@protoc_insertion_point(field_get:Analytics.GameRecieveDamage.victimTeam)
   return _internal_victimteam();
 }
-inline void GameRecieveDamage::_internal_set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameRecieveDamage::_internal_set_victimteam(int32_t value) {
   
-  victimteam_ = value;
+  _impl_.victimteam_ = value;
 }
-inline void GameRecieveDamage::set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameRecieveDamage::set_victimteam(int32_t value) {
   _internal_set_victimteam(value);
   // @@protoc_insertion_point(field_set:Analytics.GameRecieveDamage.victimTeam)
 }
 
 // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
 inline void GameRecieveDamage::clear_attackteam() {
-  attackteam_ = 0;
+  _impl_.attackteam_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameRecieveDamage::_internal_attackteam() const {
-  return attackteam_;
+inline int32_t GameRecieveDamage::_internal_attackteam() const {
+  return _impl_.attackteam_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameRecieveDamage::attackteam() const {
+inline int32_t GameRecieveDamage::attackteam() const {
   // @@protoc_insertion_point(field_get:Analytics.GameRecieveDamage.attackTeam)
   return _internal_attackteam();
 }
-inline void GameRecieveDamage::_internal_set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameRecieveDamage::_internal_set_attackteam(int32_t value) {
   
-  attackteam_ = value;
+  _impl_.attackteam_ = value;
 }
-inline void GameRecieveDamage::set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameRecieveDamage::set_attackteam(int32_t value) {
   _internal_set_attackteam(value);
   // @@protoc_insertion_point(field_set:Analytics.GameRecieveDamage.attackTeam)
 }
 
 // int32 weaponId = 4 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
 inline void GameRecieveDamage::clear_weaponid() {
-  weaponid_ = 0;
+  _impl_.weaponid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameRecieveDamage::_internal_weaponid() const {
-  return weaponid_;
+inline int32_t GameRecieveDamage::_internal_weaponid() const {
+  return _impl_.weaponid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameRecieveDamage::weaponid() const {
+inline int32_t GameRecieveDamage::weaponid() const {
   // @@protoc_insertion_point(field_get:Analytics.GameRecieveDamage.weaponId)
   return _internal_weaponid();
 }
-inline void GameRecieveDamage::_internal_set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameRecieveDamage::_internal_set_weaponid(int32_t value) {
   
-  weaponid_ = value;
+  _impl_.weaponid_ = value;
 }
-inline void GameRecieveDamage::set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameRecieveDamage::set_weaponid(int32_t value) {
   _internal_set_weaponid(value);
   // @@protoc_insertion_point(field_set:Analytics.GameRecieveDamage.weaponId)
 }
 
-// string damageType = 5 [(.Analytics.track_event) = true];
+// string damageType = 5 [(.Analytics.track_event) = true, (.Analytics.intern) = "damageTypeId"];
 inline void GameRecieveDamage::clear_damagetype() {
-  damagetype_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.damagetype_.ClearToEmpty();
 }
 inline const std::string& GameRecieveDamage::damagetype() const {
   // @@protoc_insertion_point(field_get:Analytics.GameRecieveDamage.damageType)
   return _internal_damagetype();
 }
-inline void GameRecieveDamage::set_damagetype(const std::string& value) {
-  _internal_set_damagetype(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameRecieveDamage::set_damagetype(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.damagetype_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameRecieveDamage.damageType)
 }
 inline std::string* GameRecieveDamage::mutable_damagetype() {
+  std::string* _s = _internal_mutable_damagetype();
   // @@protoc_insertion_point(field_mutable:Analytics.GameRecieveDamage.damageType)
-  return _internal_mutable_damagetype();
+  return _s;
 }
 inline const std::string& GameRecieveDamage::_internal_damagetype() const {
-  return damagetype_.GetNoArena();
+  return _impl_.damagetype_.Get();
 }
 inline void GameRecieveDamage::_internal_set_damagetype(const std::string& value) {
   
-  damagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameRecieveDamage::set_damagetype(std::string&& value) {
-  
-  damagetype_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameRecieveDamage.damageType)
-}
-inline void GameRecieveDamage::set_damagetype(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  damagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameRecieveDamage.damageType)
-}
-inline void GameRecieveDamage::set_damagetype(const char* value, size_t size) {
-  
-  damagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameRecieveDamage.damageType)
+  _impl_.damagetype_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameRecieveDamage::_internal_mutable_damagetype() {
   
-  return damagetype_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.damagetype_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameRecieveDamage::release_damagetype() {
   // @@protoc_insertion_point(field_release:Analytics.GameRecieveDamage.damageType)
-  
-  return damagetype_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.damagetype_.Release();
 }
 inline void GameRecieveDamage::set_allocated_damagetype(std::string* damagetype) {
   if (damagetype != nullptr) {
@@ -11120,16 +14278,21 @@ inline void GameRecieveDamage::set_allocated_damagetype(std::string* damagetype)
   } else {
     
   }
-  damagetype_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), damagetype);
+  _impl_.damagetype_.SetAllocated(damagetype, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.damagetype_.IsDefault()) {
+    _impl_.damagetype_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameRecieveDamage.damageType)
 }
 
 // float damageAmount = 6;
 inline void GameRecieveDamage::clear_damageamount() {
-  damageamount_ = 0;
+  _impl_.damageamount_ = 0;
 }
 inline float GameRecieveDamage::_internal_damageamount() const {
-  return damageamount_;
+  return _impl_.damageamount_;
 }
 inline float GameRecieveDamage::damageamount() const {
   // @@protoc_insertion_point(field_get:Analytics.GameRecieveDamage.damageAmount)
@@ -11137,65 +14300,115 @@ inline float GameRecieveDamage::damageamount() const {
 }
 inline void GameRecieveDamage::_internal_set_damageamount(float value) {
   
-  damageamount_ = value;
+  _impl_.damageamount_ = value;
 }
 inline void GameRecieveDamage::set_damageamount(float value) {
   _internal_set_damageamount(value);
   // @@protoc_insertion_point(field_set:Analytics.GameRecieveDamage.damageAmount)
 }
 
+// uint32 damageTypeId = 7 [(.Analytics.hidden) = true];
+inline void GameRecieveDamage::clear_damagetypeid() {
+  _impl_.damagetypeid_ = 0u;
+}
+inline uint32_t GameRecieveDamage::_internal_damagetypeid() const {
+  return _impl_.damagetypeid_;
+}
+inline uint32_t GameRecieveDamage::damagetypeid() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameRecieveDamage.damageTypeId)
+  return _internal_damagetypeid();
+}
+inline void GameRecieveDamage::_internal_set_damagetypeid(uint32_t value) {
+  
+  _impl_.damagetypeid_ = value;
+}
+inline void GameRecieveDamage::set_damagetypeid(uint32_t value) {
+  _internal_set_damagetypeid(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameRecieveDamage.damageTypeId)
+}
+
 // -------------------------------------------------------------------
 
 // GameInflictDamage
 
 // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
 inline bool GameInflictDamage::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
 inline bool GameInflictDamage::has_position() const {
   return _internal_has_position();
 }
 inline void GameInflictDamage::clear_position() {
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameInflictDamage::_internal_position() const {
-  const ::Analytics::Vec3* p = position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameInflictDamage::position() const {
   // @@protoc_insertion_point(field_get:Analytics.GameInflictDamage.position)
   return _internal_position();
 }
+inline void GameInflictDamage::unsafe_arena_set_allocated_position(
+    ::Analytics::Vec3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameInflictDamage.position)
+}
 inline ::Analytics::Vec3* GameInflictDamage::release_position() {
+  
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameInflictDamage::unsafe_arena_release_position() {
   // @@protoc_insertion_point(field_release:Analytics.GameInflictDamage.position)
   
-  ::Analytics::Vec3* temp = position_;
-  position_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameInflictDamage::_internal_mutable_position() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    position_ = p;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.position_ = p;
   }
-  return position_;
+  return _impl_.position_;
 }
 inline ::Analytics::Vec3* GameInflictDamage::mutable_position() {
+  ::Analytics::Vec3* _msg = _internal_mutable_position();
   // @@protoc_insertion_point(field_mutable:Analytics.GameInflictDamage.position)
-  return _internal_mutable_position();
+  return _msg;
 }
 inline void GameInflictDamage::set_allocated_position(::Analytics::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete position_;
+    delete _impl_.position_;
   }
   if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
     if (message_arena != submessage_arena) {
       position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, position, submessage_arena);
@@ -11204,119 +14417,104 @@ inline void GameInflictDamage::set_allocated_position(::Analytics::Vec3* positio
   } else {
     
   }
-  position_ = position;
+  _impl_.position_ = position;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameInflictDamage.position)
 }
 
 // int32 victimTeam = 2 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
 inline void GameInflictDamage::clear_victimteam() {
-  victimteam_ = 0;
+  _impl_.victimteam_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameInflictDamage::_internal_victimteam() const {
-  return victimteam_;
+inline int32_t GameInflictDamage::_internal_victimteam() const {
+  return _impl_.victimteam_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameInflictDamage::victimteam() const {
+inline int32_t GameInflictDamage::victimteam() const {
   // @@protoc_insertion_point(field_get:Analytics.GameInflictDamage.victimTeam)
   return _internal_victimteam();
 }
-inline void GameInflictDamage::_internal_set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameInflictDamage::_internal_set_victimteam(int32_t value) {
   
-  victimteam_ = value;
+  _impl_.victimteam_ = value;
 }
-inline void GameInflictDamage::set_victimteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameInflictDamage::set_victimteam(int32_t value) {
   _internal_set_victimteam(value);
   // @@protoc_insertion_point(field_set:Analytics.GameInflictDamage.victimTeam)
 }
 
 // int32 attackTeam = 3 [(.Analytics.enumkey) = "TEAM_ID", (.Analytics.track_event) = true];
 inline void GameInflictDamage::clear_attackteam() {
-  attackteam_ = 0;
+  _impl_.attackteam_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameInflictDamage::_internal_attackteam() const {
-  return attackteam_;
+inline int32_t GameInflictDamage::_internal_attackteam() const {
+  return _impl_.attackteam_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameInflictDamage::attackteam() const {
+inline int32_t GameInflictDamage::attackteam() const {
   // @@protoc_insertion_point(field_get:Analytics.GameInflictDamage.attackTeam)
   return _internal_attackteam();
 }
-inline void GameInflictDamage::_internal_set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameInflictDamage::_internal_set_attackteam(int32_t value) {
   
-  attackteam_ = value;
+  _impl_.attackteam_ = value;
 }
-inline void GameInflictDamage::set_attackteam(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameInflictDamage::set_attackteam(int32_t value) {
   _internal_set_attackteam(value);
   // @@protoc_insertion_point(field_set:Analytics.GameInflictDamage.attackTeam)
 }
 
 // int32 weaponId = 4 [(.Analytics.enumkey) = "WEAPON_ID", (.Analytics.track_event) = true];
 inline void GameInflictDamage::clear_weaponid() {
-  weaponid_ = 0;
+  _impl_.weaponid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameInflictDamage::_internal_weaponid() const {
-  return weaponid_;
+inline int32_t GameInflictDamage::_internal_weaponid() const {
+  return _impl_.weaponid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameInflictDamage::weaponid() const {
+inline int32_t GameInflictDamage::weaponid() const {
   // @@protoc_insertion_point(field_get:Analytics.GameInflictDamage.weaponId)
   return _internal_weaponid();
 }
-inline void GameInflictDamage::_internal_set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameInflictDamage::_internal_set_weaponid(int32_t value) {
   
-  weaponid_ = value;
+  _impl_.weaponid_ = value;
 }
-inline void GameInflictDamage::set_weaponid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameInflictDamage::set_weaponid(int32_t value) {
   _internal_set_weaponid(value);
   // @@protoc_insertion_point(field_set:Analytics.GameInflictDamage.weaponId)
 }
 
-// string damageType = 5 [(.Analytics.track_event) = true];
+// string damageType = 5 [(.Analytics.track_event) = true, (.Analytics.intern) = "damageTypeId"];
 inline void GameInflictDamage::clear_damagetype() {
-  damagetype_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.damagetype_.ClearToEmpty();
 }
 inline const std::string& GameInflictDamage::damagetype() const {
   // @@protoc_insertion_point(field_get:Analytics.GameInflictDamage.damageType)
   return _internal_damagetype();
 }
-inline void GameInflictDamage::set_damagetype(const std::string& value) {
-  _internal_set_damagetype(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameInflictDamage::set_damagetype(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.damagetype_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameInflictDamage.damageType)
 }
 inline std::string* GameInflictDamage::mutable_damagetype() {
+  std::string* _s = _internal_mutable_damagetype();
   // @@protoc_insertion_point(field_mutable:Analytics.GameInflictDamage.damageType)
-  return _internal_mutable_damagetype();
+  return _s;
 }
 inline const std::string& GameInflictDamage::_internal_damagetype() const {
-  return damagetype_.GetNoArena();
+  return _impl_.damagetype_.Get();
 }
 inline void GameInflictDamage::_internal_set_damagetype(const std::string& value) {
   
-  damagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameInflictDamage::set_damagetype(std::string&& value) {
-  
-  damagetype_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameInflictDamage.damageType)
-}
-inline void GameInflictDamage::set_damagetype(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  damagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameInflictDamage.damageType)
-}
-inline void GameInflictDamage::set_damagetype(const char* value, size_t size) {
-  
-  damagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameInflictDamage.damageType)
+  _impl_.damagetype_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameInflictDamage::_internal_mutable_damagetype() {
   
-  return damagetype_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.damagetype_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameInflictDamage::release_damagetype() {
   // @@protoc_insertion_point(field_release:Analytics.GameInflictDamage.damageType)
-  
-  return damagetype_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.damagetype_.Release();
 }
 inline void GameInflictDamage::set_allocated_damagetype(std::string* damagetype) {
   if (damagetype != nullptr) {
@@ -11324,16 +14522,21 @@ inline void GameInflictDamage::set_allocated_damagetype(std::string* damagetype)
   } else {
     
   }
-  damagetype_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), damagetype);
+  _impl_.damagetype_.SetAllocated(damagetype, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.damagetype_.IsDefault()) {
+    _impl_.damagetype_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameInflictDamage.damageType)
 }
 
 // float damageAmount = 6;
 inline void GameInflictDamage::clear_damageamount() {
-  damageamount_ = 0;
+  _impl_.damageamount_ = 0;
 }
 inline float GameInflictDamage::_internal_damageamount() const {
-  return damageamount_;
+  return _impl_.damageamount_;
 }
 inline float GameInflictDamage::damageamount() const {
   // @@protoc_insertion_point(field_get:Analytics.GameInflictDamage.damageAmount)
@@ -11341,65 +14544,115 @@ inline float GameInflictDamage::damageamount() const {
 }
 inline void GameInflictDamage::_internal_set_damageamount(float value) {
   
-  damageamount_ = value;
+  _impl_.damageamount_ = value;
 }
 inline void GameInflictDamage::set_damageamount(float value) {
   _internal_set_damageamount(value);
   // @@protoc_insertion_point(field_set:Analytics.GameInflictDamage.damageAmount)
 }
 
+// uint32 damageTypeId = 7 [(.Analytics.hidden) = true];
+inline void GameInflictDamage::clear_damagetypeid() {
+  _impl_.damagetypeid_ = 0u;
+}
+inline uint32_t GameInflictDamage::_internal_damagetypeid() const {
+  return _impl_.damagetypeid_;
+}
+inline uint32_t GameInflictDamage::damagetypeid() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameInflictDamage.damageTypeId)
+  return _internal_damagetypeid();
+}
+inline void GameInflictDamage::_internal_set_damagetypeid(uint32_t value) {
+  
+  _impl_.damagetypeid_ = value;
+}
+inline void GameInflictDamage::set_damagetypeid(uint32_t value) {
+  _internal_set_damagetypeid(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameInflictDamage.damageTypeId)
+}
+
 // -------------------------------------------------------------------
 
 // GameRadiusDamage
 
 // .Analytics.Vec3 position = 1 [(.Analytics.point_event) = {
 inline bool GameRadiusDamage::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
 inline bool GameRadiusDamage::has_position() const {
   return _internal_has_position();
 }
 inline void GameRadiusDamage::clear_position() {
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameRadiusDamage::_internal_position() const {
-  const ::Analytics::Vec3* p = position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameRadiusDamage::position() const {
   // @@protoc_insertion_point(field_get:Analytics.GameRadiusDamage.position)
   return _internal_position();
 }
+inline void GameRadiusDamage::unsafe_arena_set_allocated_position(
+    ::Analytics::Vec3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameRadiusDamage.position)
+}
 inline ::Analytics::Vec3* GameRadiusDamage::release_position() {
+  
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameRadiusDamage::unsafe_arena_release_position() {
   // @@protoc_insertion_point(field_release:Analytics.GameRadiusDamage.position)
   
-  ::Analytics::Vec3* temp = position_;
-  position_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameRadiusDamage::_internal_mutable_position() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    position_ = p;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.position_ = p;
   }
-  return position_;
+  return _impl_.position_;
 }
 inline ::Analytics::Vec3* GameRadiusDamage::mutable_position() {
+  ::Analytics::Vec3* _msg = _internal_mutable_position();
   // @@protoc_insertion_point(field_mutable:Analytics.GameRadiusDamage.position)
-  return _internal_mutable_position();
+  return _msg;
 }
 inline void GameRadiusDamage::set_allocated_position(::Analytics::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete position_;
+    delete _impl_.position_;
   }
   if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
     if (message_arena != submessage_arena) {
       position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, position, submessage_arena);
@@ -11408,59 +14661,44 @@ inline void GameRadiusDamage::set_allocated_position(::Analytics::Vec3* position
   } else {
     
   }
-  position_ = position;
+  _impl_.position_ = position;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameRadiusDamage.position)
 }
 
-// string damageType = 2;
+// string damageType = 2 [(.Analytics.intern) = "damageTypeId"];
 inline void GameRadiusDamage::clear_damagetype() {
-  damagetype_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.damagetype_.ClearToEmpty();
 }
 inline const std::string& GameRadiusDamage::damagetype() const {
   // @@protoc_insertion_point(field_get:Analytics.GameRadiusDamage.damageType)
   return _internal_damagetype();
 }
-inline void GameRadiusDamage::set_damagetype(const std::string& value) {
-  _internal_set_damagetype(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameRadiusDamage::set_damagetype(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.damagetype_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameRadiusDamage.damageType)
 }
 inline std::string* GameRadiusDamage::mutable_damagetype() {
+  std::string* _s = _internal_mutable_damagetype();
   // @@protoc_insertion_point(field_mutable:Analytics.GameRadiusDamage.damageType)
-  return _internal_mutable_damagetype();
+  return _s;
 }
 inline const std::string& GameRadiusDamage::_internal_damagetype() const {
-  return damagetype_.GetNoArena();
+  return _impl_.damagetype_.Get();
 }
 inline void GameRadiusDamage::_internal_set_damagetype(const std::string& value) {
   
-  damagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameRadiusDamage::set_damagetype(std::string&& value) {
-  
-  damagetype_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameRadiusDamage.damageType)
-}
-inline void GameRadiusDamage::set_damagetype(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  damagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameRadiusDamage.damageType)
-}
-inline void GameRadiusDamage::set_damagetype(const char* value, size_t size) {
-  
-  damagetype_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameRadiusDamage.damageType)
+  _impl_.damagetype_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameRadiusDamage::_internal_mutable_damagetype() {
   
-  return damagetype_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.damagetype_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameRadiusDamage::release_damagetype() {
   // @@protoc_insertion_point(field_release:Analytics.GameRadiusDamage.damageType)
-  
-  return damagetype_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.damagetype_.Release();
 }
 inline void GameRadiusDamage::set_allocated_damagetype(std::string* damagetype) {
   if (damagetype != nullptr) {
@@ -11468,16 +14706,21 @@ inline void GameRadiusDamage::set_allocated_damagetype(std::string* damagetype)
   } else {
     
   }
-  damagetype_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), damagetype);
+  _impl_.damagetype_.SetAllocated(damagetype, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.damagetype_.IsDefault()) {
+    _impl_.damagetype_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameRadiusDamage.damageType)
 }
 
 // float damageAmount = 3;
 inline void GameRadiusDamage::clear_damageamount() {
-  damageamount_ = 0;
+  _impl_.damageamount_ = 0;
 }
 inline float GameRadiusDamage::_internal_damageamount() const {
-  return damageamount_;
+  return _impl_.damageamount_;
 }
 inline float GameRadiusDamage::damageamount() const {
   // @@protoc_insertion_point(field_get:Analytics.GameRadiusDamage.damageAmount)
@@ -11485,7 +14728,7 @@ inline float GameRadiusDamage::damageamount() const {
 }
 inline void GameRadiusDamage::_internal_set_damageamount(float value) {
   
-  damageamount_ = value;
+  _impl_.damageamount_ = value;
 }
 inline void GameRadiusDamage::set_damageamount(float value) {
   _internal_set_damageamount(value);
@@ -11494,10 +14737,10 @@ inline void GameRadiusDamage::set_damageamount(float value) {
 
 // float damageRadius = 4;
 inline void GameRadiusDamage::clear_damageradius() {
-  damageradius_ = 0;
+  _impl_.damageradius_ = 0;
 }
 inline float GameRadiusDamage::_internal_damageradius() const {
-  return damageradius_;
+  return _impl_.damageradius_;
 }
 inline float GameRadiusDamage::damageradius() const {
   // @@protoc_insertion_point(field_get:Analytics.GameRadiusDamage.damageRadius)
@@ -11505,85 +14748,135 @@ inline float GameRadiusDamage::damageradius() const {
 }
 inline void GameRadiusDamage::_internal_set_damageradius(float value) {
   
-  damageradius_ = value;
+  _impl_.damageradius_ = value;
 }
 inline void GameRadiusDamage::set_damageradius(float value) {
   _internal_set_damageradius(value);
   // @@protoc_insertion_point(field_set:Analytics.GameRadiusDamage.damageRadius)
 }
 
+// uint32 damageTypeId = 5 [(.Analytics.hidden) = true];
+inline void GameRadiusDamage::clear_damagetypeid() {
+  _impl_.damagetypeid_ = 0u;
+}
+inline uint32_t GameRadiusDamage::_internal_damagetypeid() const {
+  return _impl_.damagetypeid_;
+}
+inline uint32_t GameRadiusDamage::damagetypeid() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameRadiusDamage.damageTypeId)
+  return _internal_damagetypeid();
+}
+inline void GameRadiusDamage::_internal_set_damagetypeid(uint32_t value) {
+  
+  _impl_.damagetypeid_ = value;
+}
+inline void GameRadiusDamage::set_damagetypeid(uint32_t value) {
+  _internal_set_damagetypeid(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameRadiusDamage.damageTypeId)
+}
+
 // -------------------------------------------------------------------
 
 // GameNavigationStuck
 
 // int32 entityId = 1;
 inline void GameNavigationStuck::clear_entityid() {
-  entityid_ = 0;
+  _impl_.entityid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameNavigationStuck::_internal_entityid() const {
-  return entityid_;
+inline int32_t GameNavigationStuck::_internal_entityid() const {
+  return _impl_.entityid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameNavigationStuck::entityid() const {
+inline int32_t GameNavigationStuck::entityid() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNavigationStuck.entityId)
   return _internal_entityid();
 }
-inline void GameNavigationStuck::_internal_set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameNavigationStuck::_internal_set_entityid(int32_t value) {
   
-  entityid_ = value;
+  _impl_.entityid_ = value;
 }
-inline void GameNavigationStuck::set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameNavigationStuck::set_entityid(int32_t value) {
   _internal_set_entityid(value);
   // @@protoc_insertion_point(field_set:Analytics.GameNavigationStuck.entityId)
 }
 
 // .Analytics.Vec3 position = 2 [(.Analytics.point_event) = {
 inline bool GameNavigationStuck::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
 inline bool GameNavigationStuck::has_position() const {
   return _internal_has_position();
 }
 inline void GameNavigationStuck::clear_position() {
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameNavigationStuck::_internal_position() const {
-  const ::Analytics::Vec3* p = position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameNavigationStuck::position() const {
   // @@protoc_insertion_point(field_get:Analytics.GameNavigationStuck.position)
   return _internal_position();
 }
+inline void GameNavigationStuck::unsafe_arena_set_allocated_position(
+    ::Analytics::Vec3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameNavigationStuck.position)
+}
 inline ::Analytics::Vec3* GameNavigationStuck::release_position() {
+  
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameNavigationStuck::unsafe_arena_release_position() {
   // @@protoc_insertion_point(field_release:Analytics.GameNavigationStuck.position)
   
-  ::Analytics::Vec3* temp = position_;
-  position_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameNavigationStuck::_internal_mutable_position() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    position_ = p;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.position_ = p;
   }
-  return position_;
+  return _impl_.position_;
 }
 inline ::Analytics::Vec3* GameNavigationStuck::mutable_position() {
+  ::Analytics::Vec3* _msg = _internal_mutable_position();
   // @@protoc_insertion_point(field_mutable:Analytics.GameNavigationStuck.position)
-  return _internal_mutable_position();
+  return _msg;
 }
 inline void GameNavigationStuck::set_allocated_position(::Analytics::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete position_;
+    delete _impl_.position_;
   }
   if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
     if (message_arena != submessage_arena) {
       position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, position, submessage_arena);
@@ -11592,7 +14885,7 @@ inline void GameNavigationStuck::set_allocated_position(::Analytics::Vec3* posit
   } else {
     
   }
-  position_ = position;
+  _impl_.position_ = position;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameNavigationStuck.position)
 }
 
@@ -11602,92 +14895,122 @@ inline void GameNavigationStuck::set_allocated_position(::Analytics::Vec3* posit
 
 // int32 entityId = 1;
 inline void GameVoiceMacro::clear_entityid() {
-  entityid_ = 0;
+  _impl_.entityid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameVoiceMacro::_internal_entityid() const {
-  return entityid_;
+inline int32_t GameVoiceMacro::_internal_entityid() const {
+  return _impl_.entityid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameVoiceMacro::entityid() const {
+inline int32_t GameVoiceMacro::entityid() const {
   // @@protoc_insertion_point(field_get:Analytics.GameVoiceMacro.entityId)
   return _internal_entityid();
 }
-inline void GameVoiceMacro::_internal_set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameVoiceMacro::_internal_set_entityid(int32_t value) {
   
-  entityid_ = value;
+  _impl_.entityid_ = value;
 }
-inline void GameVoiceMacro::set_entityid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameVoiceMacro::set_entityid(int32_t value) {
   _internal_set_entityid(value);
   // @@protoc_insertion_point(field_set:Analytics.GameVoiceMacro.entityId)
 }
 
 // int32 voiceMacro = 2 [(.Analytics.enumkey) = "VOICE_MACRO", (.Analytics.track_event) = true];
 inline void GameVoiceMacro::clear_voicemacro() {
-  voicemacro_ = 0;
+  _impl_.voicemacro_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameVoiceMacro::_internal_voicemacro() const {
-  return voicemacro_;
+inline int32_t GameVoiceMacro::_internal_voicemacro() const {
+  return _impl_.voicemacro_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameVoiceMacro::voicemacro() const {
+inline int32_t GameVoiceMacro::voicemacro() const {
   // @@protoc_insertion_point(field_get:Analytics.GameVoiceMacro.voiceMacro)
   return _internal_voicemacro();
 }
-inline void GameVoiceMacro::_internal_set_voicemacro(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameVoiceMacro::_internal_set_voicemacro(int32_t value) {
   
-  voicemacro_ = value;
+  _impl_.voicemacro_ = value;
 }
-inline void GameVoiceMacro::set_voicemacro(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameVoiceMacro::set_voicemacro(int32_t value) {
   _internal_set_voicemacro(value);
   // @@protoc_insertion_point(field_set:Analytics.GameVoiceMacro.voiceMacro)
 }
 
 // .Analytics.Vec3 position = 3 [(.Analytics.point_event) = {
 inline bool GameVoiceMacro::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
 inline bool GameVoiceMacro::has_position() const {
   return _internal_has_position();
 }
 inline void GameVoiceMacro::clear_position() {
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
 }
 inline const ::Analytics::Vec3& GameVoiceMacro::_internal_position() const {
-  const ::Analytics::Vec3* p = position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::Analytics::Vec3*>(
-      &::Analytics::_Vec3_default_instance_);
+  const ::Analytics::Vec3* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Analytics::Vec3&>(
+      ::Analytics::_Vec3_default_instance_);
 }
 inline const ::Analytics::Vec3& GameVoiceMacro::position() const {
   // @@protoc_insertion_point(field_get:Analytics.GameVoiceMacro.position)
   return _internal_position();
 }
+inline void GameVoiceMacro::unsafe_arena_set_allocated_position(
+    ::Analytics::Vec3* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Analytics.GameVoiceMacro.position)
+}
 inline ::Analytics::Vec3* GameVoiceMacro::release_position() {
+  
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Analytics::Vec3* GameVoiceMacro::unsafe_arena_release_position() {
   // @@protoc_insertion_point(field_release:Analytics.GameVoiceMacro.position)
   
-  ::Analytics::Vec3* temp = position_;
-  position_ = nullptr;
+  ::Analytics::Vec3* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
 inline ::Analytics::Vec3* GameVoiceMacro::_internal_mutable_position() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaNoVirtual());
-    position_ = p;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Analytics::Vec3>(GetArenaForAllocation());
+    _impl_.position_ = p;
   }
-  return position_;
+  return _impl_.position_;
 }
 inline ::Analytics::Vec3* GameVoiceMacro::mutable_position() {
+  ::Analytics::Vec3* _msg = _internal_mutable_position();
   // @@protoc_insertion_point(field_mutable:Analytics.GameVoiceMacro.position)
-  return _internal_mutable_position();
+  return _msg;
 }
 inline void GameVoiceMacro::set_allocated_position(::Analytics::Vec3* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete position_;
+    delete _impl_.position_;
   }
   if (position) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
     if (message_arena != submessage_arena) {
       position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, position, submessage_arena);
@@ -11696,7 +15019,7 @@ inline void GameVoiceMacro::set_allocated_position(::Analytics::Vec3* position)
   } else {
     
   }
-  position_ = position;
+  _impl_.position_ = position;
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameVoiceMacro.position)
 }
 
@@ -11706,10 +15029,10 @@ inline void GameVoiceMacro::set_allocated_position(::Analytics::Vec3* position)
 
 // .Analytics.LogType logType = 1;
 inline void GameLogMessage::clear_logtype() {
-  logtype_ = 0;
+  _impl_.logtype_ = 0;
 }
 inline ::Analytics::LogType GameLogMessage::_internal_logtype() const {
-  return static_cast< ::Analytics::LogType >(logtype_);
+  return static_cast< ::Analytics::LogType >(_impl_.logtype_);
 }
 inline ::Analytics::LogType GameLogMessage::logtype() const {
   // @@protoc_insertion_point(field_get:Analytics.GameLogMessage.logType)
@@ -11717,62 +15040,47 @@ inline ::Analytics::LogType GameLogMessage::logtype() const {
 }
 inline void GameLogMessage::_internal_set_logtype(::Analytics::LogType value) {
   
-  logtype_ = value;
+  _impl_.logtype_ = value;
 }
 inline void GameLogMessage::set_logtype(::Analytics::LogType value) {
   _internal_set_logtype(value);
   // @@protoc_insertion_point(field_set:Analytics.GameLogMessage.logType)
 }
 
-// string logMessage = 2;
+// string logMessage = 2 [(.Analytics.intern) = "logMessageId"];
 inline void GameLogMessage::clear_logmessage() {
-  logmessage_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.logmessage_.ClearToEmpty();
 }
 inline const std::string& GameLogMessage::logmessage() const {
   // @@protoc_insertion_point(field_get:Analytics.GameLogMessage.logMessage)
   return _internal_logmessage();
 }
-inline void GameLogMessage::set_logmessage(const std::string& value) {
-  _internal_set_logmessage(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameLogMessage::set_logmessage(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.logmessage_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameLogMessage.logMessage)
 }
 inline std::string* GameLogMessage::mutable_logmessage() {
+  std::string* _s = _internal_mutable_logmessage();
   // @@protoc_insertion_point(field_mutable:Analytics.GameLogMessage.logMessage)
-  return _internal_mutable_logmessage();
+  return _s;
 }
 inline const std::string& GameLogMessage::_internal_logmessage() const {
-  return logmessage_.GetNoArena();
+  return _impl_.logmessage_.Get();
 }
 inline void GameLogMessage::_internal_set_logmessage(const std::string& value) {
   
-  logmessage_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameLogMessage::set_logmessage(std::string&& value) {
-  
-  logmessage_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameLogMessage.logMessage)
-}
-inline void GameLogMessage::set_logmessage(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  logmessage_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameLogMessage.logMessage)
-}
-inline void GameLogMessage::set_logmessage(const char* value, size_t size) {
-  
-  logmessage_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameLogMessage.logMessage)
+  _impl_.logmessage_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameLogMessage::_internal_mutable_logmessage() {
   
-  return logmessage_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.logmessage_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameLogMessage::release_logmessage() {
   // @@protoc_insertion_point(field_release:Analytics.GameLogMessage.logMessage)
-  
-  return logmessage_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.logmessage_.Release();
 }
 inline void GameLogMessage::set_allocated_logmessage(std::string* logmessage) {
   if (logmessage != nullptr) {
@@ -11780,59 +15088,49 @@ inline void GameLogMessage::set_allocated_logmessage(std::string* logmessage) {
   } else {
     
   }
-  logmessage_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), logmessage);
+  _impl_.logmessage_.SetAllocated(logmessage, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.logmessage_.IsDefault()) {
+    _impl_.logmessage_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameLogMessage.logMessage)
 }
 
 // string logExtraInfo = 3;
 inline void GameLogMessage::clear_logextrainfo() {
-  logextrainfo_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.logextrainfo_.ClearToEmpty();
 }
 inline const std::string& GameLogMessage::logextrainfo() const {
   // @@protoc_insertion_point(field_get:Analytics.GameLogMessage.logExtraInfo)
   return _internal_logextrainfo();
 }
-inline void GameLogMessage::set_logextrainfo(const std::string& value) {
-  _internal_set_logextrainfo(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameLogMessage::set_logextrainfo(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.logextrainfo_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Analytics.GameLogMessage.logExtraInfo)
 }
 inline std::string* GameLogMessage::mutable_logextrainfo() {
+  std::string* _s = _internal_mutable_logextrainfo();
   // @@protoc_insertion_point(field_mutable:Analytics.GameLogMessage.logExtraInfo)
-  return _internal_mutable_logextrainfo();
+  return _s;
 }
 inline const std::string& GameLogMessage::_internal_logextrainfo() const {
-  return logextrainfo_.GetNoArena();
+  return _impl_.logextrainfo_.Get();
 }
 inline void GameLogMessage::_internal_set_logextrainfo(const std::string& value) {
   
-  logextrainfo_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GameLogMessage::set_logextrainfo(std::string&& value) {
-  
-  logextrainfo_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Analytics.GameLogMessage.logExtraInfo)
-}
-inline void GameLogMessage::set_logextrainfo(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  logextrainfo_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Analytics.GameLogMessage.logExtraInfo)
-}
-inline void GameLogMessage::set_logextrainfo(const char* value, size_t size) {
-  
-  logextrainfo_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Analytics.GameLogMessage.logExtraInfo)
+  _impl_.logextrainfo_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GameLogMessage::_internal_mutable_logextrainfo() {
   
-  return logextrainfo_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.logextrainfo_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GameLogMessage::release_logextrainfo() {
   // @@protoc_insertion_point(field_release:Analytics.GameLogMessage.logExtraInfo)
-  
-  return logextrainfo_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.logextrainfo_.Release();
 }
 inline void GameLogMessage::set_allocated_logextrainfo(std::string* logextrainfo) {
   if (logextrainfo != nullptr) {
@@ -11840,10 +15138,35 @@ inline void GameLogMessage::set_allocated_logextrainfo(std::string* logextrainfo
   } else {
     
   }
-  logextrainfo_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), logextrainfo);
+  _impl_.logextrainfo_.SetAllocated(logextrainfo, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.logextrainfo_.IsDefault()) {
+    _impl_.logextrainfo_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Analytics.GameLogMessage.logExtraInfo)
 }
 
+// uint32 logMessageId = 4 [(.Analytics.hidden) = true];
+inline void GameLogMessage::clear_logmessageid() {
+  _impl_.logmessageid_ = 0u;
+}
+inline uint32_t GameLogMessage::_internal_logmessageid() const {
+  return _impl_.logmessageid_;
+}
+inline uint32_t GameLogMessage::logmessageid() const {
+  // @@protoc_insertion_point(field_get:Analytics.GameLogMessage.logMessageId)
+  return _internal_logmessageid();
+}
+inline void GameLogMessage::_internal_set_logmessageid(uint32_t value) {
+  
+  _impl_.logmessageid_ = value;
+}
+inline void GameLogMessage::set_logmessageid(uint32_t value) {
+  _internal_set_logmessageid(value);
+  // @@protoc_insertion_point(field_set:Analytics.GameLogMessage.logMessageId)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -11919,6 +15242,12 @@ inline void GameLogMessage::set_allocated_logextrainfo(std::string* logextrainfo
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
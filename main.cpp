@@ -1,101 +1,991 @@
-#include "zmq.hpp"
-
 #include <iostream>
-#include <windows.h>
 #include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <map>
+#include <set>
 
-#include "GameAnalytics_zmq.h"
+#include "GameAnalytics.h"
+#include "GameAnalytics_jobs.h"
+#include "analytics.ga.h"
 
 static int RandInRange( int minValue, int maxValue )
 {
 	return minValue + rand() % (maxValue-minValue);
 }
 
-class Errors : public ErrorCallbacks
+static float RandFloat( float minValue, float maxValue )
+{
+	return minValue + ( maxValue - minValue ) * ( (float)rand() / (float)RAND_MAX );
+}
+
+static double SecondsSince( const std::chrono::steady_clock::time_point & start )
+{
+	return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+class Errors : public GameAnalyticsCallbacks
 {
 public:
-	void Error( const char * str )
+	void AnalyticsInfo( const char * str )
+	{
+		std::cout << str << std::endl;
+	}
+	void AnalyticsWarn( const char * str )
+	{
+		std::cout << str << std::endl;
+	}
+	void AnalyticsError( const char * str )
 	{
 		std::cout << str << std::endl;
 	}
 };
 
-int main(int argc, char *argv[])
+//////////////////////////////////////////////////////////////////////////
+// benchmarks and checks, run with the mode as the first argument. they return non zero when a check fails
+
+// the size of a GameEntityPosition with the position as floats and quantized at several bit widths, the speed
+// of the scalar and batch quantizers and the round trip error against half a quantization step
+static int BenchQuantize()
 {
-	GameAnalytics::Keys keys;
-	keys.mGameKey		= "3d1b7bb3b2ad8c7d4d784f26505abf44";
-	keys.mSecretKey		= "821f4c5a4690ea2460124f474a65ab582163040d";
-	keys.mDataApiKey	= "a1af2abdb11ef2257f9e8941b072984731c349e0";
-	keys.mVersionKey	= "GameAnalyticsTest";
-	
-	GameAnalytics logger( keys, new Errors );
-	
-	zmq::context_t zmqcontext( 2 );
-	
-	zmqPublisher pub( zmqcontext, "127.0.0.1", 40000 );
-	zmqSubscriber sub( zmqcontext, "127.0.0.1", 40000 );
-	sub.Subscribe( "game" );
+	const size_t numPositions = 1000000;
+	const float worldSize[ 3 ] = { 5000.0f, 3500.0f, 1000.0f };
 
-	logger.CreateDatabase( "analytics.db" );
-	logger.SetPublisher( &pub );
+	Analytics::Vec3 mins, maxs;
+	mins.set_x( -worldSize[ 0 ] ); mins.set_y( -worldSize[ 1 ] ); mins.set_z( -worldSize[ 2 ] );
+	maxs.set_x( worldSize[ 0 ] ); maxs.set_y( worldSize[ 1 ] ); maxs.set_z( worldSize[ 2 ] );
+
+	Vec3Quantizer quantizer;
+	quantizer.SetBounds( mins, maxs );
+
+	std::vector<float> xyz( numPositions * 3 );
+	for ( size_t i = 0; i < numPositions; ++i )
+	{
+		xyz[ i * 3 + 0 ] = RandFloat( -worldSize[ 0 ], worldSize[ 0 ] );
+		xyz[ i * 3 + 1 ] = RandFloat( -worldSize[ 1 ], worldSize[ 1 ] );
+		xyz[ i * 3 + 2 ] = RandFloat( -worldSize[ 2 ], worldSize[ 2 ] );
+	}
+
+	Analytics::GameEntityPosition msg;
+	msg.set_team( 2 );
+	msg.set_entityindex( 17 );
+
+	// float encoding, the baseline
+	size_t floatBytes = 0;
+	std::string payload;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for ( size_t i = 0; i < numPositions; ++i )
+	{
+		Analytics::Vec3* pos = msg.mutable_position();
+		pos->set_x( xyz[ i * 3 + 0 ] );
+		pos->set_y( xyz[ i * 3 + 1 ] );
+		pos->set_z( xyz[ i * 3 + 2 ] );
+		msg.SerializeToString( &payload );
+		floatBytes += payload.size();
+	}
+	const double floatSeconds = SecondsSince( start );
+
+	printf( "%-24s %6.2f bytes/msg %8.1f ns/msg\n", "float", (double)floatBytes / numPositions, floatSeconds * 1e9 / numPositions );
+
+	int failures = 0;
+
+	const int bitWidths[] = { 12, 16, 21 };
+	for ( size_t b = 0; b < sizeof( bitWidths ) / sizeof( bitWidths[ 0 ] ); ++b )
+	{
+		const int bits = bitWidths[ b ];
+
+		// the per message path of SendEvent, quantize and serialize
+		size_t quantizedBytes = 0;
+		start = std::chrono::steady_clock::now();
+		for ( size_t i = 0; i < numPositions; ++i )
+		{
+			const uint64_t packed = quantizer.Quantize( xyz[ i * 3 + 0 ], xyz[ i * 3 + 1 ], xyz[ i * 3 + 2 ], bits );
+			Analytics::Vec3* pos = msg.mutable_position();
+			pos->Clear();
+			pos->set_quantized( packed + 1 );
+			msg.SerializeToString( &payload );
+			quantizedBytes += payload.size();
+		}
+		const double messageSeconds = SecondsSince( start );
+
+		std::vector<uint64_t> scalar( numPositions ), batch( numPositions );
+
+		start = std::chrono::steady_clock::now();
+		for ( size_t i = 0; i < numPositions; ++i )
+			scalar[ i ] = quantizer.Quantize( xyz[ i * 3 + 0 ], xyz[ i * 3 + 1 ], xyz[ i * 3 + 2 ], bits );
+		const double scalarSeconds = SecondsSince( start );
+
+		start = std::chrono::steady_clock::now();
+		quantizer.QuantizeArray( &xyz[ 0 ], numPositions, bits, &batch[ 0 ] );
+		const double batchSeconds = SecondsSince( start );
+
+		std::vector<float> restored( numPositions * 3 );
+		start = std::chrono::steady_clock::now();
+		quantizer.DequantizeArray( &batch[ 0 ], numPositions, bits, &restored[ 0 ] );
+		const double dequantizeSeconds = SecondsSince( start );
 
-	int frameNum = 0;
-	while ( true )
+		size_t mismatches = 0;
+		for ( size_t i = 0; i < numPositions; ++i )
+		{
+			if ( scalar[ i ] != batch[ i ] )
+				++mismatches;
+		}
+
+		// rounding to the nearest step, with some slack for the float math
+		bool withinStep = true;
+		float maxError[ 3 ] = { 0.0f, 0.0f, 0.0f };
+		for ( int axis = 0; axis < 3; ++axis )
+		{
+			const float halfStep = worldSize[ axis ] / (float)( ( 1u << bits ) - 1 );
+			for ( size_t i = 0; i < numPositions; ++i )
+				maxError[ axis ] = std::max( maxError[ axis ], std::fabs( restored[ i * 3 + axis ] - xyz[ i * 3 + axis ] ) );
+			withinStep = withinStep && maxError[ axis ] <= halfStep * 1.01f + 1e-3f;
+		}
+
+		char name[ 32 ];
+		snprintf( name, sizeof( name ), "quantized %d bits", bits );
+		printf( "%-24s %6.2f bytes/msg %8.1f ns/msg, quantize %.2f ns scalar %.2f ns batch, dequantize %.2f ns batch, max error %.4f %.4f %.4f\n",
+			name, (double)quantizedBytes / numPositions, messageSeconds * 1e9 / numPositions,
+			scalarSeconds * 1e9 / numPositions, batchSeconds * 1e9 / numPositions, dequantizeSeconds * 1e9 / numPositions,
+			maxError[ 0 ], maxError[ 1 ], maxError[ 2 ] );
+
+		if ( mismatches > 0 )
+		{
+			printf( "FAILED: %zu batch quantized positions differ from the scalar ones\n", mismatches );
+			++failures;
+		}
+		if ( !withinStep )
+		{
+			printf( "FAILED: round trip error over half a quantization step\n" );
+			++failures;
+		}
+	}
+
+	return failures > 0 ? 1 : 0;
+}
+
+// drives DeadReckoningFilter over synthetic paths, straight runs with turns, circles, stops and teleports, and
+// reconstructs them from the sent samples the way readers do. fails if any sample time is off by more than the tolerance
+static int TestDeadReckoning()
+{
+	const float tolerance = 8.0f;
+	const int numEntities = 16;
+	const int64_t tickTime = 50;
+	const int numTicks = 20 * 60 * 5;
+
+	int failures = 0;
+
+	for ( int pass = 0; pass < 2; ++pass )
 	{
-		try
+		// GameEntityPosition extrapolates with velocity, GameEntityInfo holds the last position
+		const bool extrapolate = pass == 0;
+
+		DeadReckoningFilter filter( tolerance );
+
+		struct Received
+		{
+			int64_t			mTime;
+			Analytics::Vec3	mPosition;
+			Analytics::Vec3	mVelocity;
+		};
+		std::vector<Received> received( numEntities );
+		std::vector<float> headings( numEntities );
+		std::vector<Analytics::Vec3> positions( numEntities );
+		for ( int e = 0; e < numEntities; ++e )
+		{
+			headings[ e ] = RandFloat( 0.0f, 6.2831853f );
+			positions[ e ].set_x( RandFloat( -2000.0f, 2000.0f ) );
+			positions[ e ].set_y( RandFloat( -2000.0f, 2000.0f ) );
+		}
+
+		size_t numSamples = 0, numSent = 0;
+		float maxError = 0.0f;
+
+		for ( int tick = 0; tick < numTicks; ++tick )
 		{
-			Analytics::MessageUnion msg;
+			const int64_t time = tick * tickTime;
 
-			while ( sub.Poll( msg ) )
+			for ( int e = 0; e < numEntities; ++e )
 			{
-				std::vector<const google::protobuf::FieldDescriptor*> fields;
-				msg.GetReflection()->ListFields( msg, &fields );
+				Analytics::Vec3 & pos = positions[ e ];
+
+				// a few seconds of one kind of movement at a time
+				const int phase = ( tick / 80 + e ) % 4;
+				const float speed = phase == 3 ? 0.0f : 320.0f;
+				if ( phase == 1 )
+					headings[ e ] += 0.05f;
+				else if ( phase == 2 && ( tick % 20 ) == 0 )
+					headings[ e ] += RandFloat( -1.5f, 1.5f );
+
+				const float dt = (float)tickTime * 0.001f;
+				pos.set_x( pos.x() + std::cos( headings[ e ] ) * speed * dt );
+				pos.set_y( pos.y() + std::sin( headings[ e ] ) * speed * dt );
+				pos.set_z( 16.0f * std::sin( (float)time * 0.001f ) );
+
+				if ( ( rand() % 2000 ) == 0 )
+				{
+					pos.set_x( RandFloat( -2000.0f, 2000.0f ) );
+					pos.set_y( RandFloat( -2000.0f, 2000.0f ) );
+					filter.MarkDiscontinuity( e );
+				}
+
+				Analytics::Vec3 velocity;
+				if ( filter.Filter( e, 0, time, pos, extrapolate, &velocity ) )
+				{
+					received[ e ].mTime = time;
+					received[ e ].mPosition = pos;
+					received[ e ].mVelocity = velocity;
+					++numSent;
+				}
 
-				std::cout << "Subscriber recieved message: ";
-				for ( size_t i = 0; i < fields.size(); ++i )
-					std::cout << fields[ i ]->camelcase_name() << " ";
-				std::cout << std::endl;
+				Analytics::Vec3 reconstructed;
+				DeadReckoningFilter::Extrapolate( received[ e ].mPosition, received[ e ].mVelocity, received[ e ].mTime, time, reconstructed );
+
+				const float dx = reconstructed.x() - pos.x();
+				const float dy = reconstructed.y() - pos.y();
+				const float dz = reconstructed.z() - pos.z();
+				maxError = std::max( maxError, std::sqrt( dx * dx + dy * dy + dz * dz ) );
+				++numSamples;
 			}
+		}
+
+		printf( "%-12s %zu of %zu samples sent (%.1f%%), max error %.3f, tolerance %.3f\n", extrapolate ? "extrapolate" : "hold",
+			numSent, numSamples, 100.0 * numSent / numSamples, maxError, tolerance );
+
+		if ( maxError > tolerance * 1.0001f )
+		{
+			printf( "FAILED: reconstruction error over the tolerance\n" );
+			++failures;
+		}
+	}
+
+	return failures > 0 ? 1 : 0;
+}
 
-			while ( pub.Poll( msg ) )
+static void RandVec3( Analytics::Vec3 & vec, float extent )
+{
+	vec.set_x( RandFloat( -extent, extent ) );
+	vec.set_y( RandFloat( -extent, extent ) );
+	vec.set_z( RandFloat( -extent, extent ) );
+}
+
+// MessageToJsonString against the generated json writer of a useJsonEncoding type, each payload has to parse back to its message
+template<typename T>
+static int BenchJsonEncoder( const std::vector<T> & messages )
+{
+	const google::protobuf::Descriptor* desc = T::descriptor();
+	const EventEncoder* encoder = Analytics::FindEventEncoder( desc );
+	if ( encoder == NULL || encoder->mEncode == NULL )
+	{
+		printf( "FAILED: no generated encoder for %s\n", desc->name().c_str() );
+		return 1;
+	}
+
+	std::string payload;
+	size_t reflectBytes = 0, generatedBytes = 0;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for ( size_t i = 0; i < messages.size(); ++i )
+	{
+		payload.clear();
+		google::protobuf::util::MessageToJsonString( messages[ i ], &payload );
+		reflectBytes += payload.size();
+	}
+	const double reflectSeconds = SecondsSince( start );
+
+	start = std::chrono::steady_clock::now();
+	for ( size_t i = 0; i < messages.size(); ++i )
+	{
+		payload.clear();
+		encoder->mEncode( messages[ i ], payload );
+		generatedBytes += payload.size();
+	}
+	const double generatedSeconds = SecondsSince( start );
+
+	size_t mismatches = 0;
+	T parsed;
+	for ( size_t i = 0; i < messages.size(); ++i )
+	{
+		payload.clear();
+		encoder->mEncode( messages[ i ], payload );
+
+		parsed.Clear();
+		if ( !google::protobuf::util::JsonStringToMessage( payload, &parsed ).ok() || parsed.SerializeAsString() != messages[ i ].SerializeAsString() )
+			++mismatches;
+	}
+
+	printf( "%-20s json       reflection %8.1f ns %6.1f bytes, generated %8.1f ns %6.1f bytes, %.1fx\n", desc->name().c_str(),
+		reflectSeconds * 1e9 / messages.size(), (double)reflectBytes / messages.size(),
+		generatedSeconds * 1e9 / messages.size(), (double)generatedBytes / messages.size(), reflectSeconds / generatedSeconds );
+
+	if ( mismatches > 0 )
+	{
+		printf( "FAILED: %zu generated %s payloads don't round trip\n", mismatches, desc->name().c_str() );
+		return 1;
+	}
+	return 0;
+}
+
+// the redishmsetkey or rediskeysuffix field looked up through reflection, the way SendEvent does without a generated encoder,
+// against the generated key formatter
+template<typename T>
+static int BenchKeyEncoder( const std::vector<T> & messages, bool hashKey )
+{
+	const google::protobuf::Descriptor* desc = T::descriptor();
+	const EventEncoder* encoder = Analytics::FindEventEncoder( desc );
+	bool (*generate)( const google::protobuf::Message &, std::string & ) = encoder != NULL ? ( hashKey ? encoder->mHashKey : encoder->mKeySuffix ) : NULL;
+	if ( generate == NULL )
+	{
+		printf( "FAILED: no generated key formatter for %s\n", desc->name().c_str() );
+		return 1;
+	}
+
+	const std::string fieldName = hashKey ? desc->options().GetExtension( Analytics::redishmsetkey ) : desc->options().GetExtension( Analytics::rediskeysuffix );
+
+	std::vector<std::string> reflectKeys( messages.size() ), generatedKeys( messages.size() );
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for ( size_t i = 0; i < messages.size(); ++i )
+	{
+		const google::protobuf::FieldDescriptor* fdesc = messages[ i ].GetDescriptor()->FindFieldByCamelcaseName( fieldName );
+		if ( fdesc != NULL && fdesc->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_INT32 )
+			KeyFormatInt( reflectKeys[ i ], messages[ i ].GetReflection()->GetInt32( messages[ i ], fdesc ) );
+	}
+	const double reflectSeconds = SecondsSince( start );
+
+	start = std::chrono::steady_clock::now();
+	for ( size_t i = 0; i < messages.size(); ++i )
+		generate( messages[ i ], generatedKeys[ i ] );
+	const double generatedSeconds = SecondsSince( start );
+
+	size_t mismatches = 0;
+	for ( size_t i = 0; i < messages.size(); ++i )
+	{
+		if ( reflectKeys[ i ].empty() || reflectKeys[ i ] != generatedKeys[ i ] )
+			++mismatches;
+	}
+
+	printf( "%-20s %-10s reflection %8.1f ns, generated %8.1f ns, %.1fx\n", desc->name().c_str(), hashKey ? "hash key" : "key suffix",
+		reflectSeconds * 1e9 / messages.size(), generatedSeconds * 1e9 / messages.size(), reflectSeconds / generatedSeconds );
+
+	if ( mismatches > 0 )
+	{
+		printf( "FAILED: %zu generated %s keys differ from the reflected ones\n", mismatches, desc->name().c_str() );
+		return 1;
+	}
+	return 0;
+}
+
+// the generated encoders of analytics.ga.cc against the reflection path for the json payloads and the key fields of events
+static int BenchEncoders()
+{
+	const size_t numMessages = 100000;
+
+	std::vector<Analytics::GameWeaponFired> weaponFired( numMessages );
+	std::vector<Analytics::GameRadiusDamage> radiusDamage( numMessages );
+	std::vector<Analytics::GameEntityInfo> entityInfo( numMessages );
+	std::vector<Analytics::GameEntityTrajectory> trajectory( numMessages );
+	for ( size_t i = 0; i < numMessages; ++i )
+	{
+		RandVec3( *weaponFired[ i ].mutable_position(), 4000.0f );
+		weaponFired[ i ].set_attackteam( rand() % 4 );
+		weaponFired[ i ].set_weaponid( rand() % 32 );
+		weaponFired[ i ].set_firedbyclass( rand() % 10 );
+		RandVec3( *weaponFired[ i ].mutable_trace()->mutable_p0(), 4000.0f );
+		RandVec3( *weaponFired[ i ].mutable_trace()->mutable_p1(), 4000.0f );
+
+		RandVec3( *radiusDamage[ i ].mutable_position(), 4000.0f );
+		radiusDamage[ i ].set_damagetype( "explosion" );
+		radiusDamage[ i ].set_damageamount( RandFloat( 0.0f, 200.0f ) );
+		radiusDamage[ i ].set_damageradius( RandFloat( 32.0f, 512.0f ) );
+
+		entityInfo[ i ].set_entityindex( RandInRange( -1, 1024 ) );
+		trajectory[ i ].set_entityindex( RandInRange( -1, 1024 ) );
+	}
+
+	int failures = 0;
+	failures += BenchJsonEncoder( weaponFired );
+	failures += BenchJsonEncoder( radiusDamage );
+	failures += BenchKeyEncoder( entityInfo, true );
+	failures += BenchKeyEncoder( trajectory, false );
+	return failures > 0 ? 1 : 0;
+}
+
+// events per second through SqliteEventSink, the game thread cost of AddEvent and EndOfFrame and the total up to the
+// last commit
+template<typename T>
+static int BenchSqliteType( const std::vector<T> & messages, size_t eventsPerFrame )
+{
+	const char * filename = "bench_sqlite.db";
+	remove( filename );
+
+	SqliteEventSink sink;
+	std::string error;
+	if ( !sink.Open( filename, error ) )
+	{
+		printf( "FAILED: %s\n", error.c_str() );
+		return 1;
+	}
+
+	double gameThreadSeconds = 0.0;
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for ( size_t i = 0; i < messages.size(); i += eventsPerFrame )
+	{
+		const std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+
+		const size_t frameEnd = std::min( messages.size(), i + eventsPerFrame );
+		for ( size_t e = i; e < frameEnd; ++e )
+			sink.AddEvent( messages[ e ], (int64_t)( e / eventsPerFrame ) * 16 );
+		sink.EndOfFrame();
+
+		gameThreadSeconds += SecondsSince( frameStart );
+	}
+	sink.Flush();
+	const double totalSeconds = SecondsSince( start );
+
+	std::vector<std::string> errors;
+	sink.GetErrors( errors );
+	sink.Close();
+	remove( filename );
+
+	printf( "%-20s %8.0f events/s, %6.1f ns/event on the game thread\n", T::descriptor()->name().c_str(),
+		messages.size() / totalSeconds, gameThreadSeconds * 1e9 / messages.size() );
+
+	for ( size_t i = 0; i < errors.size(); ++i )
+		printf( "FAILED: %s\n", errors[ i ].c_str() );
+	return errors.empty() ? 0 : 1;
+}
+
+static int BenchSqlite()
+{
+	const size_t numEvents = 1000000;
+	const size_t eventsPerFrame = 1000;
+
+	// GameWeaponFired also goes into the R*Tree of its (point_event) position, the trajectory chunks only into their table
+	std::vector<Analytics::GameWeaponFired> weaponFired( numEvents );
+	std::vector<Analytics::GameEntityTrajectory> trajectories( numEvents );
+	for ( size_t i = 0; i < numEvents; ++i )
+	{
+		RandVec3( *weaponFired[ i ].mutable_position(), 4000.0f );
+		weaponFired[ i ].set_attackteam( rand() % 4 );
+		weaponFired[ i ].set_weaponid( rand() % 32 );
+		weaponFired[ i ].set_firedbyclass( rand() % 10 );
+
+		trajectories[ i ].set_entityindex( rand() % 64 );
+		trajectories[ i ].set_team( rand() % 4 );
+		trajectories[ i ].set_samplecount( 4 );
+		trajectories[ i ].set_precision( 0.0625f );
+		trajectories[ i ].set_samples( std::string( 16, (char)( rand() & 0x7f ) ) );
+	}
+
+	int failures = 0;
+	failures += BenchSqliteType( trajectories, eventsPerFrame );
+	failures += BenchSqliteType( weaponFired, eventsPerFrame );
+	return failures > 0 ? 1 : 0;
+}
+
+static bool NearlyEqual( double a, double b, double tolerance )
+{
+	return std::fabs( a - b ) <= tolerance * std::max( 1.0, std::max( std::fabs( a ), std::fabs( b ) ) );
+}
+
+static std::vector<std::string> Dimensions( int a, int b, int c )
+{
+	std::vector<std::string> dims;
+	dims.push_back( std::to_string( a ) );
+	dims.push_back( std::to_string( b ) );
+	dims.push_back( std::to_string( c ) );
+	return dims;
+}
+
+// the jobs run over the sessions with one worker and with several. counts and sketch registers have to match exactly,
+// float sums, heatmap pixels and quantiles only up to the order they were added in. the results of one worker are
+// also checked against what the fixture put in, the point and event counts, the rollup cells and sums, the distinct
+// entities and the top weapons. RedisSessionSource isn't covered, it needs a redis server with the sessions
+static int TestSessionJobs()
+{
+	const int numSessions = 48;
+	const int eventsPerSession = 2000;
+	const float worldSize = 4000.0f;
+	const char * meansOfDeath[] = { "rocket", "rail", "shotgun", "telefrag", "fall" };
+
+	// the counts of each (track_event) combination, in field order as the rollups key them
+	std::map< std::vector<std::string>, int64_t > expectedFired, expectedPositions;
+	std::map< std::vector<std::string>, std::pair<int64_t, double> > expectedDamage;
+	std::map< std::string, uint64_t > expectedWeapons;
+	std::set<int> expectedEntities;
+	size_t numDamage = 0;
+
+	MemorySessionSource source;
+	for ( int s = 0; s < numSessions; ++s )
+	{
+		char session[ 32 ];
+		snprintf( session, sizeof( session ), "s:%d", s );
+
+		for ( int i = 0; i < eventsPerSession; ++i )
+		{
+			Analytics::GameWeaponFired fired;
+			RandVec3( *fired.mutable_position(), worldSize );
+			fired.set_attackteam( rand() % 4 );
+			fired.set_weaponid( rand() % 8 );
+			fired.set_firedbyclass( rand() % 10 );
+			source.AddEvent( session, fired );
+			++expectedFired[ Dimensions( fired.attackteam(), fired.weaponid(), fired.firedbyclass() ) ];
+			++expectedWeapons[ std::to_string( fired.weaponid() ) ];
+
+			if ( ( i % 4 ) == 0 )
 			{
-				std::vector<const google::protobuf::FieldDescriptor*> fields;
-				msg.GetReflection()->ListFields( msg, &fields );
+				Analytics::GameRecieveDamage damage;
+				RandVec3( *damage.mutable_position(), worldSize );
+				damage.set_victimteam( rand() % 4 );
+				damage.set_attackteam( rand() % 4 );
+				damage.set_weaponid( rand() % 8 );
+				damage.set_damagetype( meansOfDeath[ rand() % 5 ] );
+				damage.set_damageamount( RandFloat( 1.0f, 100.0f ) );
+				source.AddEvent( session, damage );
 
-				std::cout << "Publisher recieved message: ";
-				for ( size_t i = 0; i < fields.size(); ++i )
-					std::cout << fields[ i ]->camelcase_name() << " ";
-				std::cout << std::endl;
+				std::vector<std::string> dims = Dimensions( damage.victimteam(), damage.attackteam(), damage.weaponid() );
+				dims.push_back( damage.damagetype() );
+				std::pair<int64_t, double> & cell = expectedDamage[ dims ];
+				++cell.first;
+				cell.second += damage.damageamount();
+				++numDamage;
 			}
 
-			if ( ( frameNum % 100 ) == 0 )
+			// the entities are counted distinct by their index
+			if ( ( i % 2 ) == 0 )
+			{
+				Analytics::GameEntityPosition position;
+				RandVec3( *position.mutable_position(), worldSize );
+				position.set_team( rand() % 4 );
+				position.set_entityindex( s * 100 + rand() % 100 );
+				source.AddEvent( session, position );
+				++expectedPositions[ std::vector<std::string>( 1, std::to_string( position.team() ) ) ];
+				expectedEntities.insert( position.entityindex() );
+			}
+		}
+	}
+
+	std::vector<const google::protobuf::Descriptor*> types;
+	types.push_back( Analytics::GameWeaponFired::descriptor() );
+	types.push_back( Analytics::GameRecieveDamage::descriptor() );
+	types.push_back( Analytics::GameEntityPosition::descriptor() );
+
+	GameAnalytics::HeatmapDef def;
+	def.mAreaId = "TestJobs";
+	def.mEventId = "GameWeaponFired";
+	def.mImageSize = 256;
+	def.mWorldMins[ 0 ] = def.mWorldMins[ 1 ] = -worldSize;
+	def.mWorldMaxs[ 0 ] = def.mWorldMaxs[ 1 ] = worldSize;
+
+	const int threadCounts[ 2 ] = { 1, (int)std::max( 4u, std::thread::hardware_concurrency() ) };
+
+	HeatmapJob heatmaps[ 2 ];
+	std::unique_ptr<SketchJob> sketches[ 2 ];
+	std::unique_ptr<RollupJob> rollups[ 2 ];
+
+	std::string error;
+	for ( int r = 0; r < 2; ++r )
+	{
+		sketches[ r ].reset( new SketchJob( types ) );
+		rollups[ r ].reset( new RollupJob( types ) );
+
+		SessionJobRunner runner;
+		runner.SetThreadCount( threadCounts[ r ] );
+
+		SessionJob* jobs[ 3 ] = { &heatmaps[ r ], sketches[ r ].get(), rollups[ r ].get() };
+		for ( int j = 0; j < 3; ++j )
+		{
+			if ( ( jobs[ j ] == &heatmaps[ r ] && !heatmaps[ r ].Init( def, error ) ) ||
+				!runner.Run( source, std::vector<std::string>(), *jobs[ j ], error ) )
+			{
+				printf( "FAILED: %s\n", error.c_str() );
+				return 1;
+			}
+			if ( !runner.GetFailed().empty() )
 			{
-				Analytics::MessageUnion msg;
-				//msg.set_timestamp( logger.GetTimeStamp() );
-				msg.mutable_gamedeath()->set_killedbyclass( 5 );
-				msg.mutable_gamedeath()->set_killedbyhealth( 10 );
-				msg.mutable_gamedeath()->set_killedbyweapon( 15 );
+				printf( "FAILED: %s\n", runner.GetFailed()[ 0 ].c_str() );
+				return 1;
+			}
+		}
+
+		printf( "%2d threads, %zu workers: %zu sessions, %zu events\n", threadCounts[ r ], runner.GetNumWorkers(), runner.GetNumSessions(), runner.GetNumEvents() );
+	}
+
+	int failures = 0;
+
+	// the heatmap
+	heatmaps[ 0 ].GetHeatmap().Render();
+	heatmaps[ 1 ].GetHeatmap().Render();
+	const HeatmapRasterizer & h0 = heatmaps[ 0 ].GetHeatmap();
+	const HeatmapRasterizer & h1 = heatmaps[ 1 ].GetHeatmap();
+	if ( h0.GetNumPoints() != h1.GetNumPoints() || h0.GetWidth() != h1.GetWidth() || h0.GetHeight() != h1.GetHeight() || h0.GetImage() == NULL || h1.GetImage() == NULL )
+	{
+		printf( "FAILED: heatmap has %zu points and %dx%d pixels against %zu points and %dx%d\n",
+			h1.GetNumPoints(), h1.GetWidth(), h1.GetHeight(), h0.GetNumPoints(), h0.GetWidth(), h0.GetHeight() );
+		++failures;
+	}
+	else
+	{
+		size_t differentPixels = 0;
+		for ( int i = 0; i < h0.GetWidth() * h0.GetHeight(); ++i )
+		{
+			if ( std::fabs( h0.GetImage()[ i ] - h1.GetImage()[ i ] ) > 1e-4f * h0.GetMaxValue() )
+				++differentPixels;
+		}
+		printf( "heatmap: %zu points, %zu of %d pixels differ\n", h0.GetNumPoints(), differentPixels, h0.GetWidth() * h0.GetHeight() );
+		if ( differentPixels > 0 )
+			++failures;
+	}
+
+	// the sketches
+	std::vector<std::string> distinct, topK, quantiles;
+	sketches[ 0 ]->GetSketches().GetNames( distinct, topK, quantiles );
+	size_t sketchMismatches = 0;
+	for ( size_t i = 0; i < distinct.size(); ++i )
+	{
+		const HyperLogLog* a = sketches[ 0 ]->GetSketches().FindDistinct( distinct[ i ] );
+		const HyperLogLog* b = sketches[ 1 ]->GetSketches().FindDistinct( distinct[ i ] );
+		if ( b == NULL || a->Estimate() != b->Estimate() )
+			++sketchMismatches;
+	}
+	for ( size_t i = 0; i < topK.size(); ++i )
+	{
+		const CountMinTopK* a = sketches[ 0 ]->GetSketches().FindTopK( topK[ i ] );
+		const CountMinTopK* b = sketches[ 1 ]->GetSketches().FindTopK( topK[ i ] );
+		std::vector< std::pair<std::string, uint64_t> > keys;
+		if ( a != NULL )
+			a->GetTopK( keys );
+		for ( size_t k = 0; k < keys.size(); ++k )
+		{
+			if ( b == NULL || a->Estimate( keys[ k ].first ) != b->Estimate( keys[ k ].first ) )
+				++sketchMismatches;
+		}
+	}
+	for ( size_t i = 0; i < quantiles.size(); ++i )
+	{
+		const TDigest* a = sketches[ 0 ]->GetSketches().FindQuantiles( quantiles[ i ] );
+		const TDigest* b = sketches[ 1 ]->GetSketches().FindQuantiles( quantiles[ i ] );
+		if ( b == NULL || a->GetCount() != b->GetCount() )
+		{
+			++sketchMismatches;
+			continue;
+		}
+
+		// digests merged in another order place their centroids differently, within a percent of the range
+		const double range = a->Quantile( 1.0 ) - a->Quantile( 0.0 );
+		const double q[] = { 0.01, 0.25, 0.5, 0.75, 0.99 };
+		for ( size_t k = 0; k < sizeof( q ) / sizeof( q[ 0 ] ); ++k )
+		{
+			if ( std::fabs( a->Quantile( q[ k ] ) - b->Quantile( q[ k ] ) ) > 0.01 * range )
+				++sketchMismatches;
+		}
+	}
+	printf( "sketches: %zu distinct, %zu top k, %zu quantiles, %zu mismatches\n", distinct.size(), topK.size(), quantiles.size(), sketchMismatches );
+	if ( distinct.empty() || topK.empty() || quantiles.empty() || sketchMismatches > 0 )
+		++failures;
+
+	// the rollups
+	size_t numCells = 0, rollupMismatches = 0;
+	for ( size_t t = 0; t < types.size(); ++t )
+	{
+		RollupBucket a, b;
+		rollups[ 0 ]->GetTotals( types[ t ], a );
+		rollups[ 1 ]->GetTotals( types[ t ], b );
+
+		std::map< std::vector<std::string>, const RollupCell* > cells;
+		for ( size_t c = 0; c < b.mCells.size(); ++c )
+			cells[ b.mCells[ c ].mDimensions ] = &b.mCells[ c ];
 
-				logger.AddEvent( msg );
+		numCells += a.mCells.size();
+		if ( a.mCells.size() != b.mCells.size() )
+			++rollupMismatches;
+
+		for ( size_t c = 0; c < a.mCells.size(); ++c )
+		{
+			std::map< std::vector<std::string>, const RollupCell* >::const_iterator it = cells.find( a.mCells[ c ].mDimensions );
+			if ( it == cells.end() || it->second->mCount != a.mCells[ c ].mCount || it->second->mSums.size() != a.mCells[ c ].mSums.size() )
+			{
+				++rollupMismatches;
+				continue;
 			}
 
-			if ( ( frameNum % 100 ) == 0 )
+			for ( std::map<std::string, double>::const_iterator s = a.mCells[ c ].mSums.begin(); s != a.mCells[ c ].mSums.end(); ++s )
 			{
-				Analytics::MessageUnion msg;
-				//msg.set_timestamp( logger.GetTimeStamp() );
-				msg.mutable_gameassert()->set_condition( "test string" );
-				logger.AddEvent( msg );
+				std::map<std::string, double>::const_iterator other = it->second->mSums.find( s->first );
+				if ( other == it->second->mSums.end() || !NearlyEqual( s->second, other->second, 1e-9 ) )
+					++rollupMismatches;
 			}
 		}
-		catch ( const std::exception& ex )
+	}
+	printf( "rollups: %zu cells, %zu mismatches\n", numCells, rollupMismatches );
+	if ( numCells == 0 || rollupMismatches > 0 )
+		++failures;
+
+	if ( failures > 0 )
+	{
+		printf( "FAILED: the results of %d and %d threads differ\n", threadCounts[ 0 ], threadCounts[ 1 ] );
+		return 1;
+	}
+
+	// every shot is inside the map
+	size_t truthMismatches = 0;
+	if ( h0.GetNumPoints() != (size_t)( numSessions * eventsPerSession ) )
+		++truthMismatches;
+
+	// each combination with its count and, for the damage, the sum of the amounts
+	const std::map< std::vector<std::string>, int64_t > * expectedCounts[ 3 ] = { &expectedFired, NULL, &expectedPositions };
+	for ( size_t t = 0; t < types.size(); ++t )
+	{
+		RollupBucket bucket;
+		rollups[ 0 ]->GetTotals( types[ t ], bucket );
+
+		const size_t expectedCells = expectedCounts[ t ] != NULL ? expectedCounts[ t ]->size() : expectedDamage.size();
+		if ( bucket.mCells.size() != expectedCells )
+			++truthMismatches;
+
+		for ( size_t c = 0; c < bucket.mCells.size(); ++c )
 		{
-			std::cout << "Network error: " << ex.what() << std::endl;
-			break;
+			const RollupCell & cell = bucket.mCells[ c ];
+			if ( expectedCounts[ t ] != NULL )
+			{
+				std::map< std::vector<std::string>, int64_t >::const_iterator it = expectedCounts[ t ]->find( cell.mDimensions );
+				if ( it == expectedCounts[ t ]->end() || it->second != cell.mCount )
+					++truthMismatches;
+				continue;
+			}
+
+			std::map< std::vector<std::string>, std::pair<int64_t, double> >::const_iterator it = expectedDamage.find( cell.mDimensions );
+			std::map<std::string, double>::const_iterator sum = cell.mSums.find( "damageAmount" );
+			if ( it == expectedDamage.end() || it->second.first != cell.mCount || sum == cell.mSums.end() || !NearlyEqual( sum->second, it->second.second, 1e-6 ) )
+				++truthMismatches;
 		}
+	}
 
-		Sleep( 100 );
+	// count min never undercounts, the hyperloglog is within a few percent at these counts
+	const EventSketches & sketches0 = sketches[ 0 ]->GetSketches();
+	const HyperLogLog * entities = sketches0.FindDistinct( "GameEntityPosition.entityIndex" );
+	if ( entities == NULL || !NearlyEqual( entities->Estimate(), (double)expectedEntities.size(), 0.05 ) )
+		++truthMismatches;
 
-		++frameNum;
+	const CountMinTopK * weapons = sketches0.FindTopK( "GameWeaponFired.weaponId" );
+	for ( std::map< std::string, uint64_t >::const_iterator it = expectedWeapons.begin(); it != expectedWeapons.end(); ++it )
+	{
+		if ( weapons == NULL || weapons->Estimate( it->first ) < it->second )
+			++truthMismatches;
+	}
+
+	const TDigest * amounts = sketches0.FindQuantiles( "GameRecieveDamage.damageAmount" );
+	if ( amounts == NULL || amounts->GetCount() != (double)numDamage )
+		++truthMismatches;
+
+	printf( "fixture: %zu shots, %zu damage, %zu entities, %zu mismatches\n", h0.GetNumPoints(), numDamage, expectedEntities.size(), truthMismatches );
+	if ( truthMismatches > 0 )
+	{
+		printf( "FAILED: the results don't match the fixture\n" );
+		return 1;
+	}
+	return 0;
+}
+
+// the same paths sent as GameEntityPosition samples in one session and as GameEntityTrajectory chunks in another give
+// the same line heatmap, with the segments that leave the floor or jump past the max step dropped in both
+static int TestTrajectoryHeatmap()
+{
+	const int numEntities = 8;
+	const int samplesPerEntity = 600;
+	const float floorMax = 64.0f;
+	const float maxStep = 512.0f;
+
+	MemorySessionSource source;
+	TrajectoryEncoder encoder( 32, 0.0625f );
+	Analytics::GameEntityTrajectory chunk;
+
+	size_t expectedSegments = 0, numChunks = 0;
+	for ( int e = 0; e < numEntities; ++e )
+	{
+		float x = (float)RandInRange( -2000, 2000 );
+		float y = (float)RandInRange( -2000, 2000 );
+		float lastX = 0.0f, lastY = 0.0f;
+		bool lastOnFloor = false;
+
+		for ( int i = 0; i < samplesPerEntity; ++i )
+		{
+			// whole units are exact at the precision of the chunks. a stretch upstairs and a teleport now and then
+			x += (float)RandInRange( -16, 17 );
+			y += (float)RandInRange( -16, 17 );
+			if ( ( rand() % 200 ) == 0 )
+			{
+				x = (float)RandInRange( -2000, 2000 );
+				y = (float)RandInRange( -2000, 2000 );
+			}
+			const bool onFloor = ( i / 100 ) != 3;
+
+			Analytics::GameEntityPosition position;
+			position.mutable_position()->set_x( x );
+			position.mutable_position()->set_y( y );
+			position.mutable_position()->set_z( onFloor ? 0.0f : 256.0f );
+			position.set_team( e % 2 );
+			position.set_entityindex( e );
+			source.AddEvent( "positions", position );
+
+			if ( encoder.AddSample( e, e % 2, i * 50, position.position(), chunk ) )
+			{
+				source.AddEvent( "trajectories", chunk );
+				++numChunks;
+			}
+
+			if ( onFloor && lastOnFloor && ( x - lastX ) * ( x - lastX ) + ( y - lastY ) * ( y - lastY ) <= maxStep * maxStep )
+				++expectedSegments;
+			lastX = x;
+			lastY = y;
+			lastOnFloor = onFloor;
+		}
+	}
+
+	std::vector<Analytics::GameEntityTrajectory> chunks;
+	encoder.FlushAll( chunks );
+	for ( size_t i = 0; i < chunks.size(); ++i )
+		source.AddEvent( "trajectories", chunks[ i ] );
+	numChunks += chunks.size();
+
+	GameAnalytics::HeatmapDef def;
+	def.mAreaId = "TestTrajectory";
+	def.mEventId = "GameEntityPosition";
+	def.mLines = true;
+	def.mImageSize = 256;
+	def.mWorldMins[ 0 ] = def.mWorldMins[ 1 ] = -2500.0f;
+	def.mWorldMaxs[ 0 ] = def.mWorldMaxs[ 1 ] = 2500.0f;
+	def.mWorldMins[ 2 ] = -floorMax;
+	def.mWorldMaxs[ 2 ] = floorMax;
+
+	const char * sessions[ 2 ] = { "positions", "trajectories" };
+	HeatmapJob heatmaps[ 2 ];
+	std::string error;
+	for ( int s = 0; s < 2; ++s )
+	{
+		SessionJobRunner runner;
+		runner.SetThreadCount( 1 );
+		if ( !heatmaps[ s ].Init( def, error ) || !runner.Run( source, std::vector<std::string>( 1, sessions[ s ] ), heatmaps[ s ], error ) || !runner.GetFailed().empty() )
+		{
+			printf( "FAILED: %s\n", runner.GetFailed().empty() ? error.c_str() : runner.GetFailed()[ 0 ].c_str() );
+			return 1;
+		}
+		heatmaps[ s ].GetHeatmap().Render();
+	}
+
+	int failures = 0;
+
+	const HeatmapRasterizer & h0 = heatmaps[ 0 ].GetHeatmap();
+	const HeatmapRasterizer & h1 = heatmaps[ 1 ].GetHeatmap();
+	printf( "%zu segments expected, %zu from the samples, %zu from %zu chunks\n", expectedSegments, h0.GetNumSegments(), h1.GetNumSegments(), numChunks );
+	if ( h0.GetNumSegments() != expectedSegments || h1.GetNumSegments() != expectedSegments )
+		++failures;
+
+	if ( h0.GetImage() == NULL || h1.GetImage() == NULL || h0.GetMaxValue() <= 0.0f )
+	{
+		printf( "FAILED: nothing rasterized\n" );
+		return 1;
+	}
+
+	size_t differentPixels = 0;
+	for ( int i = 0; i < h0.GetWidth() * h0.GetHeight(); ++i )
+	{
+		if ( std::fabs( h0.GetImage()[ i ] - h1.GetImage()[ i ] ) > 1e-4f * h0.GetMaxValue() )
+			++differentPixels;
+	}
+	printf( "%zu of %d pixels differ\n", differentPixels, h0.GetWidth() * h0.GetHeight() );
+	if ( differentPixels > 0 )
+		++failures;
+
+	if ( failures > 0 )
+		printf( "FAILED: the trajectory heatmap doesn't match the samples\n" );
+	return failures > 0 ? 1 : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+struct TestMode
+{
+	const char *	mName;
+	int				(*mRun)();
+	const char *	mDescription;
+};
+
+static const TestMode sTestModes[] =
+{
+	{ "quantize", BenchQuantize, "quantized Vec3 encoding size, speed and round trip error" },
+	{ "deadreckoning", TestDeadReckoning, "dead reckoning reconstruction error against the tolerance" },
+	{ "encoders", BenchEncoders, "generated against reflective encoders for payloads and keys" },
+	{ "sqlite", BenchSqlite, "SqliteEventSink events per second" },
+	{ "jobs", TestSessionJobs, "session jobs give the same results at 1 and N threads" },
+	{ "trajectoryheatmap", TestTrajectoryHeatmap, "line heatmaps of trajectory chunks match those of the samples" },
+};
+
+static int RunTestMode( const char * name )
+{
+	for ( size_t i = 0; i < sizeof( sTestModes ) / sizeof( sTestModes[ 0 ] ); ++i )
+	{
+		if ( strcmp( sTestModes[ i ].mName, name ) == 0 )
+			return sTestModes[ i ].mRun();
+	}
+
+	std::cout << "usage: TestApplication [mode]" << std::endl;
+	for ( size_t i = 0; i < sizeof( sTestModes ) / sizeof( sTestModes[ 0 ] ); ++i )
+		printf( "\t%-16s %s\n", sTestModes[ i ].mName, sTestModes[ i ].mDescription );
+	return 1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char *argv[])
+{
+	if ( argc > 1 )
+		return RunTestMode( argv[ 1 ] );
+
+	Errors errors;
+	GameAnalytics logger( &errors );
+
+	logger.CreateDatabase( "analytics.db" );
+
+	// the published messages come back through the subscription when a redis server is running
+	if ( logger.OpenRedisConnection() )
+		logger.Subscribe( "game" );
+
+	const int numFrames = 1000;
+	for ( int frameNum = 0; frameNum < numFrames; ++frameNum )
+	{
+		logger.ProcessPublishedMessages( []( const std::string & channel, const std::string & data )
+		{
+			std::cout << "Subscriber recieved message on " << channel << ": " << data.size() << " bytes" << std::endl;
+		} );
+
+		if ( ( frameNum % 100 ) == 0 )
+		{
+			Analytics::GameDeath msg;
+			msg.set_victimteam( 1 );
+			msg.set_attackteam( 2 );
+			msg.set_meansofdeath( "test weapon" );
+			logger.AddEvent( msg );
+		}
+
+		if ( ( frameNum % 100 ) == 0 )
+		{
+			Analytics::GameAssert msg;
+			msg.set_condition( "test string" );
+			logger.AddEvent( msg );
+		}
+
+		logger.EndOfFrame();
+
+		std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
 	}
 
 	/*for ( size_t i = 0; i < 10; ++i )
@@ -111,25 +1001,21 @@ int main(int argc, char *argv[])
 	const int worldSizeY = 3500;
 
 	const char * areaName = "TestAppArea";
-	const char * eventName = "TestAppEvent";
+	const char * eventName = "GameWeaponFired";
 	const size_t numDesignEvents = 10000;
 	
-	Analytics::MessageUnion msg;
 	for ( size_t i = 0; i < numDesignEvents; ++i )
 	{
-		msg.Clear();
-
-		msg.set_timestamp( i * 100 ); // artificial timestamps
-
-		Analytics::GameWeaponFired* event = msg.mutable_gameweaponfired();
-		event->set_weaponid( rand() % 10 );
-		event->set_team( rand() % 4 );
-		event->set_positionx( (float)RandInRange( -worldSizeX, worldSizeX ) );
-		event->set_positiony( (float)RandInRange( -worldSizeY, worldSizeY ) );
-		event->set_positionz( 0.0f );
+		Analytics::GameWeaponFired event;
+		event.set_weaponid( rand() % 10 );
+		event.set_attackteam( rand() % 4 );
+		event.mutable_position()->set_x( (float)RandInRange( -worldSizeX, worldSizeX ) );
+		event.mutable_position()->set_y( (float)RandInRange( -worldSizeY, worldSizeY ) );
+		event.mutable_position()->set_z( 0.0f );
 		
-		logger.AddEvent( msg );
+		logger.AddEvent( event );
 	}
+	logger.EndOfFrame();
 		
 	/*const size_t submittedQualityEvents = logger.SubmitQualityEvents();
 	const size_t submittedDesignEvents = logger.SubmitDesignEvents();	
@@ -155,15 +1041,9 @@ int main(int argc, char *argv[])
 	def.mWorldMins[ 1 ] = -(float)worldSizeY;
 	def.mWorldMaxs[ 1 ] =  (float)worldSizeY;
 
-	std::string script;
-	logger.WriteHeatmapScript( def, script );
-
-	std::fstream scriptOut;
-	scriptOut.open( std::string(areaName) + ".mgk", std::ios_base::out | std::ios_base::trunc );
-	scriptOut << script << std::endl;
-	scriptOut.close();
+	logger.WriteHeatmap( def );
 	
 	logger.CloseDatabase();
 
 	return 0;
-}
\ No newline at end of file
+}